@@ -311,6 +311,10 @@ namespace OloEngine
 
         Application::Get().GetWindow().SetTitle("Test");
 
+        // Build virtual-geometry DAGs on the task pool: a heavy import then streams in level
+        // by level instead of freezing the editor until its whole DAG exists.
+        Renderer3D::GetRendererSettings().VirtualGeometryStreamingBuild = true;
+
         // Toolbar icons are authored colour bitmaps — load as sRGB so the GPU
         // linearises them on sample, matching how every other colour texture
         // in the engine is treated. Each load gets a 1x1 spec-based fallback
@@ -5262,6 +5266,18 @@ namespace OloEngine
         // streams deterministically before ITS key check).
         bakeSettings.BakeKey = SceneLightmapRuntime::ComputeBakeKey(*scene, lmSettings);
 
+        // Incremental re-bake: when the scene still points at the asset the
+        // last bake produced, charts no changed instance or light can reach
+        // keep their texels.
+        Ref<LightmapAsset> previousAsset;
+        if (lmSettings.LightmapAsset != 0 && lmSettings.LightmapAsset == m_LightmapBakeRecordAsset)
+        {
+            previousAsset = AssetManager::GetAsset<LightmapAsset>(lmSettings.LightmapAsset);
+        }
+        const u32 tracedCharts = LightmapBaker::PlanDependencies(*prepared, SceneLightmapRuntime::GatherBakeDependencies(*scene),
+                                                                 bakeSettings, previousAsset ? &m_LightmapBakeRecord : nullptr,
+                                                                 previousAsset);
+
         // ── Capture the reference world (game thread — reads ECS + mesh data) ──
         PathTracing::ReferenceSceneBuilder builder;
         builder.AddScene(*scene, [](Entity entity)
@@ -5283,8 +5299,9 @@ namespace OloEngine
         m_LightmapBakeScene = scene;
         m_LightmapBakeScenePath = m_EditorScenePath;
 
-        OLO_CORE_INFO("Lightmap bake started: {} entities, {} texels, {} spp",
-                      inputs.size(), prepared->Jobs.size(), bakeSettings.SamplesPerTexel);
+        OLO_CORE_INFO("Lightmap bake started: {} entities, {} texels, {} spp — re-tracing {} of {} charts",
+                      inputs.size(), prepared->Jobs.size(), bakeSettings.SamplesPerTexel, tracedCharts,
+                      prepared->Charts.size());
 
         Tasks::Launch("BakeLightmaps", [this, prepared, world, bakeSettings, bakeDone]()
                       {
@@ -5374,6 +5391,9 @@ namespace OloEngine
             return;
         }
 
+        m_LightmapBakeRecord = std::move(result.Record);
+        m_LightmapBakeRecordAsset = stored->GetHandle();
+
         if (bakedScene)
         {
             auto& lmSettings = bakedScene->GetLightmapSettings();
@@ -5389,8 +5409,8 @@ namespace OloEngine
             return;
         }
 
-        OLO_CORE_INFO("Lightmap bake complete: {} entities baked, {} skipped — saved to {} (save the scene to keep the reference)",
-                      result.BakedEntityCount, result.SkippedEntityCount, assetPath.string());
+        OLO_CORE_INFO("Lightmap bake complete: {} entities baked ({} charts reused), {} skipped — saved to {} (save the scene to keep the reference)",
+                      result.BakedEntityCount, result.ReusedChartCount, result.SkippedEntityCount, assetPath.string());
     }
 
     void EditorLayer::BuildShaderPack() const
@@ -333,6 +333,11 @@ namespace OloEngine
         // silently attached to whatever is active at completion.
         Ref<Scene> m_LightmapBakeScene;
         std::filesystem::path m_LightmapBakeScenePath;
+        // Dependency record of the last completed bake and the asset it
+        // produced (game thread only). The next bake of a scene still pointing
+        // at that asset re-traces only the charts an edit can have reached.
+        LightmapBakeRecord m_LightmapBakeRecord;
+        AssetHandle m_LightmapBakeRecordAsset = 0;
 
         enum class SceneState
         {
@@ -72,6 +72,7 @@ registry.push_back(OLO_GFW_FIELD(AudioSoundGraphComponent, "PlayOnAwake", PlayOn
 
 // BehaviorTreeComponent
 registry.push_back(OLO_GFW_FIELD(BehaviorTreeComponent, "BehaviorTreeAssetHandle", BehaviorTreeAssetHandle));
+registry.push_back(OLO_GFW_FIELD(BehaviorTreeComponent, "TickInterval", TickInterval));
 
 // BoatComponent
 registry.push_back(OLO_GFW_FIELD(BoatComponent, "Enabled", m_Enabled));
@@ -529,6 +530,7 @@ registry.push_back(OLO_GFW_FIELD_RANGE(NavAgentComponent, "Acceleration", m_Acce
 registry.push_back(OLO_GFW_FIELD_RANGE(NavAgentComponent, "StoppingDistance", m_StoppingDistance, OLO_GFW_BOUND(0.0f), OLO_GFW_BOUND(100.0f)));
 registry.push_back(OLO_GFW_FIELD(NavAgentComponent, "AvoidancePriority", m_AvoidancePriority));
 registry.push_back(OLO_GFW_FIELD(NavAgentComponent, "LockYAxis", m_LockYAxis));
+registry.push_back(OLO_GFW_FIELD(NavAgentComponent, "FlowFieldGroup", m_FlowFieldGroup));
 
 // NavMeshBoundsComponent
 registry.push_back(OLO_GFW_FIELD(NavMeshBoundsComponent, "Min", m_Min));
@@ -646,6 +648,7 @@ registry.push_back(OLO_GFW_FIELD(PerceptionComponent, "EyeOffset", EyeOffset));
 registry.push_back(OLO_GFW_FIELD(PerceptionComponent, "RequireLineOfSight", RequireLineOfSight));
 registry.push_back(OLO_GFW_FIELD(PerceptionComponent, "PerceiverTeam", PerceiverTeam));
 registry.push_back(OLO_GFW_FIELD(PerceptionComponent, "DetectSameTeam", DetectSameTeam));
+registry.push_back(OLO_GFW_FIELD(PerceptionComponent, "SenseInterval", SenseInterval));
 
 // PhaseComponent
 registry.push_back(OLO_GFW_FIELD(PhaseComponent, "PhaseID", PhaseID));
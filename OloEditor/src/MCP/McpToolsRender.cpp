@@ -641,6 +641,8 @@ namespace OloEngine::MCP
                     return "opengl";
                 case RHI::Backend::Vulkan:
                     return "vulkan";
+                case RHI::Backend::Null:
+                    return "null";
                 case RHI::Backend::None:
                     break;
             }
@@ -4724,6 +4726,7 @@ namespace OloEngine::MCP
                     { "enabledComponents", diagnostics.EnabledComponents },
                     { "unresolvedAssets", diagnostics.UnresolvedAssets },
                     { "registrationFailures", diagnostics.RegistrationFailures },
+                    { "pendingBuilds", diagnostics.PendingBuilds },
                     { "submitted", diagnostics.Submitted },
                     { "fellBackToClassic", diagnostics.FellBackToClassic },
                     { "silentlyDrewNothing", diagnostics.SilentlyDrewNothing() },
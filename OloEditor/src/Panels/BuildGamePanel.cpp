@@ -193,6 +193,7 @@ namespace OloEngine
         ImGui::Checkbox("Compress Assets", &m_Settings.CompressAssets);
         ImGui::Checkbox("Include Script Module", &m_Settings.IncludeScriptModule);
         ImGui::Checkbox("Validate Assets", &m_Settings.ValidateAssets);
+        ImGui::Checkbox("Incremental Asset Pack", &m_Settings.IncrementalAssetPack);
     }
 
     void BuildGamePanel::RenderBuildActions()
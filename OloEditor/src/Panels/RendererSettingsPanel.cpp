@@ -786,6 +786,18 @@ namespace OloEngine
                                       "the suspect in a visual bug.");
                 }
 
+                if (ImGui::Checkbox("Build DAGs in the background", &settings.VirtualGeometryStreamingBuild))
+                {
+                    Renderer3D::ApplyRendererSettings();
+                }
+                if (ImGui::IsItemHovered())
+                {
+                    ImGui::SetTooltip("Build a mesh's cluster DAG on the task pool. The mesh appears\n"
+                                      "once its first level is built and refines as more land.\n\n"
+                                      "When OFF, the first frame that draws an uncooked mesh waits\n"
+                                      "for its whole DAG. Applies to meshes registered from now on.");
+                }
+
                 if (ImGui::Checkbox("Show debug view in viewport", &settings.VirtualDebugToViewport))
                 {
                     Renderer3D::ApplyRendererSettings();
@@ -976,6 +988,14 @@ namespace OloEngine
                                   "only affects dense instanced submissions above the GPU-cull threshold.");
             }
 
+            ImGui::Checkbox("Retained Static Draws", &settings.RetainedStaticDraws);
+            if (ImGui::IsItemHovered())
+            {
+                ImGui::SetTooltip("Keeps static mesh draws sorted and batched across frames so an unchanged\n"
+                                  "draw skips the per-frame sort. Pays off with a still camera; a moving\n"
+                                  "camera re-keys every draw.");
+            }
+
             // Depth pre-pass is forced on when Forward+ is selected
             if (forwardPlusForced)
             {
@@ -5631,7 +5631,7 @@ namespace OloEngine
                 if (ImGui::DragInt("Seed", &component.m_ProceduralSeed, 1))
                     component.m_NeedsRebuild = true;
 
-                if (int procRes = static_cast<int>(component.m_ProceduralResolution); ImGui::DragInt("Resolution", &procRes, 1, 64, 2048))
+                if (int procRes = static_cast<int>(component.m_ProceduralResolution); ImGui::DragInt("Resolution", &procRes, 1, 64, static_cast<int>(kMaxTerrainResolution)))
                 {
                     component.m_ProceduralResolution = static_cast<u32>(procRes);
                     component.m_NeedsRebuild = true;
@@ -5849,9 +5849,9 @@ namespace OloEngine
             if (component.m_AutoMaterial)
             {
                 if (int splatRes = static_cast<int>(component.m_SplatmapGenResolution);
-                    ImGui::DragInt("Splatmap Resolution", &splatRes, 1.0f, 64, 2048))
+                    ImGui::DragInt("Splatmap Resolution", &splatRes, 1.0f, 64, static_cast<int>(kMaxTerrainResolution)))
                 {
-                    component.m_SplatmapGenResolution = static_cast<u32>(std::clamp(splatRes, 64, 2048));
+                    component.m_SplatmapGenResolution = static_cast<u32>(std::clamp(splatRes, 64, static_cast<int>(kMaxTerrainResolution)));
                     component.m_AutoSplatNeedsRebuild = true;
                 }
 
@@ -6206,7 +6206,13 @@ namespace OloEngine
                     }
                     else
                     {
-                        ImGui::Text("Voxel Meshes: %u", static_cast<u32>(component.m_VoxelMeshes.size()));
+                        const auto& voxelMeshes = component.m_VoxelMeshes;
+                        ImGui::Text("Voxel Meshes: %u", voxelMeshes ? static_cast<u32>(voxelMeshes->GetMeshes().size()) : 0u);
+                        ImGui::Text("Triangles: %u", voxelMeshes ? voxelMeshes->GetTriangleCount() : 0u);
+                        if (voxelMeshes && voxelMeshes->HasPendingWork())
+                        {
+                            ImGui::TextUnformatted("Meshing... (background)");
+                        }
                     }
                 }
             }
@@ -7751,8 +7757,13 @@ namespace OloEngine
             ImGui::DragFloat("Stopping Distance", &component.m_StoppingDistance, 0.01f, 0.0f, 100.0f);
             ImGui::DragInt("Avoidance Priority", &component.m_AvoidancePriority, 1, 0, 100);
             ImGui::Checkbox("Lock Y Axis", &component.m_LockYAxis);
+            ImGui::DragScalar("Flow Field Group", ImGuiDataType_U32, &component.m_FlowFieldGroup);
 
-            if (component.m_HasPath)
+            if (component.m_HasPath && component.m_FlowFieldGroup != 0)
+            {
+                ImGui::TextColored(ImVec4(0.0f, 1.0f, 0.0f, 1.0f), "Following flow field %u", component.m_FlowFieldGroup);
+            }
+            else if (component.m_HasPath)
             {
                 ImGui::TextColored(ImVec4(0.0f, 1.0f, 0.0f, 1.0f), "Has path (%d corners)", static_cast<int>(component.m_PathCorners.size()));
             }
@@ -7917,6 +7928,8 @@ namespace OloEngine
                     component.BehaviorTreeAssetHandle = 0;
             }
 
+            ImGui::DragFloat("Tick Interval (s)", &component.TickInterval, 0.01f, 0.0f, 10.0f);
+
             if (component.IsRunning)
                 ImGui::TextColored(ImVec4(0.0f, 1.0f, 0.0f, 1.0f), "Running");
             else
@@ -8023,6 +8036,7 @@ namespace OloEngine
             ImGui::Checkbox("Require Line Of Sight", &component.RequireLineOfSight);
             ImGui::DragInt("Perceiver Team", &component.PerceiverTeam);
             ImGui::Checkbox("Detect Same Team", &component.DetectSameTeam);
+            ImGui::DragFloat("Sense Interval (s)", &component.SenseInterval, 0.01f, 0.0f, 10.0f);
             ImGui::Separator(); // below: read-only live sensor result, filled each tick by PerceptionSystem
             if (component.HasVisibleTarget)
             {
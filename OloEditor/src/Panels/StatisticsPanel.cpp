@@ -255,6 +255,12 @@ namespace OloEngine
                                            "virtual-geometry measurement taken on this scene as meaningful.");
                         ImGui::Separator();
                     }
+                    if (vgDiagnostics.PendingBuilds > 0)
+                    {
+                        ImGui::TextColored(ImVec4(0.6f, 0.8f, 1.0f, 1.0f),
+                                           "%u component(s) waiting for a background DAG build",
+                                           vgDiagnostics.PendingBuilds);
+                    }
                     ImGui::Text("Instances this frame: %u", frameInstances);
 
                     ImGui::Separator();
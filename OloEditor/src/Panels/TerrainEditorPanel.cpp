@@ -199,8 +199,8 @@ namespace OloEngine
         }
         if (ImGui::IsItemHovered())
             ImGui::SetTooltip("Picks a new seed and regenerates immediately.\nEditing the Seed value above instead requires the Generate / Regenerate button.");
-        if (int res = static_cast<int>(tc.m_ProceduralResolution); ImGui::DragInt("Resolution", &res, 1, 64, 2048))
-            tc.m_ProceduralResolution = static_cast<u32>(std::clamp(res, 64, 2048));
+        if (int res = static_cast<int>(tc.m_ProceduralResolution); ImGui::DragInt("Resolution", &res, 1, 64, static_cast<int>(kMaxTerrainResolution)))
+            tc.m_ProceduralResolution = static_cast<u32>(std::clamp(res, 64, static_cast<int>(kMaxTerrainResolution)));
         if (int oct = static_cast<int>(tc.m_ProceduralOctaves); ImGui::DragInt("Octaves", &oct, 1, 1, 12))
             tc.m_ProceduralOctaves = static_cast<u32>(std::clamp(oct, 1, 12));
         ImGui::DragFloat("Frequency", &tc.m_ProceduralFrequency, 0.1f, 0.1f, 20.0f, "%.2f");
@@ -248,9 +248,9 @@ namespace OloEngine
                 tc.m_MaterialNeedsRebuild = true;
                 tc.m_AutoSplatNeedsRebuild = true;
             }
-            if (int splatRes = static_cast<int>(tc.m_SplatmapGenResolution); ImGui::DragInt("Splatmap Resolution", &splatRes, 1.0f, 64, 2048))
+            if (int splatRes = static_cast<int>(tc.m_SplatmapGenResolution); ImGui::DragInt("Splatmap Resolution", &splatRes, 1.0f, 64, static_cast<int>(kMaxTerrainResolution)))
             {
-                tc.m_SplatmapGenResolution = static_cast<u32>(std::clamp(splatRes, 64, 2048));
+                tc.m_SplatmapGenResolution = static_cast<u32>(std::clamp(splatRes, 64, static_cast<int>(kMaxTerrainResolution)));
                 tc.m_AutoSplatNeedsRebuild = true;
             }
 
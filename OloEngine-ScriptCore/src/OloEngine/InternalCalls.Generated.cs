@@ -964,6 +964,10 @@ namespace OloEngine
 		[MethodImpl(MethodImplOptions.InternalCall)]
 		internal static extern void NavAgentComponent_SetLockYAxis(ulong entityID, bool value);
 		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern uint NavAgentComponent_GetFlowFieldGroup(ulong entityID);
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern void NavAgentComponent_SetFlowFieldGroup(ulong entityID, uint value);
+		[MethodImpl(MethodImplOptions.InternalCall)]
 		internal static extern void NavAgentComponent_GetTargetPosition(ulong entityID, out Vector3 value);
 		[MethodImpl(MethodImplOptions.InternalCall)]
 		internal static extern void NavAgentComponent_SetTargetPosition(ulong entityID, ref Vector3 value);
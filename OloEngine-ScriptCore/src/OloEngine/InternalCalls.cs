@@ -528,60 +528,69 @@ namespace OloEngine
 		internal static extern bool SaveGame_ValidateSave(string slotName);
 		#endregion
 
+		#region BlackboardKey
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern uint BlackboardKey_Intern(string name);
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern uint BlackboardKey_Find(string name);
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern string BlackboardKey_GetName(uint keyID);
+		#endregion
+
 		#region BehaviorTreeComponent
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void BehaviorTreeComponent_SetBlackboardBool(ulong entityID, string key, bool value);
+		internal static extern void BehaviorTreeComponent_SetBlackboardBool(ulong entityID, uint keyID, bool value);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern bool BehaviorTreeComponent_GetBlackboardBool(ulong entityID, string key);
+		internal static extern bool BehaviorTreeComponent_GetBlackboardBool(ulong entityID, uint keyID);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void BehaviorTreeComponent_SetBlackboardInt(ulong entityID, string key, int value);
+		internal static extern void BehaviorTreeComponent_SetBlackboardInt(ulong entityID, uint keyID, int value);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern int BehaviorTreeComponent_GetBlackboardInt(ulong entityID, string key);
+		internal static extern int BehaviorTreeComponent_GetBlackboardInt(ulong entityID, uint keyID);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void BehaviorTreeComponent_SetBlackboardFloat(ulong entityID, string key, float value);
+		internal static extern void BehaviorTreeComponent_SetBlackboardFloat(ulong entityID, uint keyID, float value);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern float BehaviorTreeComponent_GetBlackboardFloat(ulong entityID, string key);
+		internal static extern float BehaviorTreeComponent_GetBlackboardFloat(ulong entityID, uint keyID);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void BehaviorTreeComponent_SetBlackboardString(ulong entityID, string key, string value);
+		internal static extern void BehaviorTreeComponent_SetBlackboardString(ulong entityID, uint keyID, string value);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern string BehaviorTreeComponent_GetBlackboardString(ulong entityID, string key);
+		internal static extern string BehaviorTreeComponent_GetBlackboardString(ulong entityID, uint keyID);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void BehaviorTreeComponent_SetBlackboardVec3(ulong entityID, string key, ref Vector3 value);
+		internal static extern void BehaviorTreeComponent_SetBlackboardVec3(ulong entityID, uint keyID, ref Vector3 value);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void BehaviorTreeComponent_GetBlackboardVec3(ulong entityID, string key, out Vector3 result);
+		internal static extern void BehaviorTreeComponent_GetBlackboardVec3(ulong entityID, uint keyID, out Vector3 result);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void BehaviorTreeComponent_RemoveBlackboardKey(ulong entityID, string key);
+		internal static extern void BehaviorTreeComponent_RemoveBlackboardKey(ulong entityID, uint keyID);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern bool BehaviorTreeComponent_HasBlackboardKey(ulong entityID, string key);
+		internal static extern bool BehaviorTreeComponent_HasBlackboardKey(ulong entityID, uint keyID);
 		[MethodImpl(MethodImplOptions.InternalCall)]
 		internal static extern bool BehaviorTreeComponent_IsRunning(ulong entityID);
 		#endregion
 
 		#region StateMachineComponent
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void StateMachineComponent_SetBlackboardBool(ulong entityID, string key, bool value);
+		internal static extern void StateMachineComponent_SetBlackboardBool(ulong entityID, uint keyID, bool value);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern bool StateMachineComponent_GetBlackboardBool(ulong entityID, string key);
+		internal static extern bool StateMachineComponent_GetBlackboardBool(ulong entityID, uint keyID);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void StateMachineComponent_SetBlackboardInt(ulong entityID, string key, int value);
+		internal static extern void StateMachineComponent_SetBlackboardInt(ulong entityID, uint keyID, int value);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern int StateMachineComponent_GetBlackboardInt(ulong entityID, string key);
+		internal static extern int StateMachineComponent_GetBlackboardInt(ulong entityID, uint keyID);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void StateMachineComponent_SetBlackboardFloat(ulong entityID, string key, float value);
+		internal static extern void StateMachineComponent_SetBlackboardFloat(ulong entityID, uint keyID, float value);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern float StateMachineComponent_GetBlackboardFloat(ulong entityID, string key);
+		internal static extern float StateMachineComponent_GetBlackboardFloat(ulong entityID, uint keyID);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void StateMachineComponent_SetBlackboardString(ulong entityID, string key, string value);
+		internal static extern void StateMachineComponent_SetBlackboardString(ulong entityID, uint keyID, string value);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern string StateMachineComponent_GetBlackboardString(ulong entityID, string key);
+		internal static extern string StateMachineComponent_GetBlackboardString(ulong entityID, uint keyID);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void StateMachineComponent_SetBlackboardVec3(ulong entityID, string key, ref Vector3 value);
+		internal static extern void StateMachineComponent_SetBlackboardVec3(ulong entityID, uint keyID, ref Vector3 value);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void StateMachineComponent_GetBlackboardVec3(ulong entityID, string key, out Vector3 result);
+		internal static extern void StateMachineComponent_GetBlackboardVec3(ulong entityID, uint keyID, out Vector3 result);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void StateMachineComponent_RemoveBlackboardKey(ulong entityID, string key);
+		internal static extern void StateMachineComponent_RemoveBlackboardKey(ulong entityID, uint keyID);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern bool StateMachineComponent_HasBlackboardKey(ulong entityID, string key);
+		internal static extern bool StateMachineComponent_HasBlackboardKey(ulong entityID, uint keyID);
 		[MethodImpl(MethodImplOptions.InternalCall)]
 		internal static extern string StateMachineComponent_GetCurrentState(ulong entityID);
 		[MethodImpl(MethodImplOptions.InternalCall)]
@@ -0,0 +1,44 @@
+namespace OloEngine
+{
+	// A blackboard key name resolved once to the engine's interned id.
+	//
+	// Build one per key when the script starts (a static readonly field) and
+	// pass it to the BehaviorTreeComponent / StateMachineComponent blackboard
+	// accessors; the string overloads resolve the name on every call.
+	// default(BlackboardKey) is the invalid key.
+	public readonly struct BlackboardKey : System.IEquatable<BlackboardKey>
+	{
+		// Engine id + 1, so the zero-initialised default is invalid.
+		private readonly uint m_Handle;
+
+		private BlackboardKey(uint engineID, bool _)
+		{
+			m_Handle = engineID == uint.MaxValue ? 0u : engineID + 1u;
+		}
+
+		// Interns `name`, so a key built before anything writes it is valid.
+		public BlackboardKey(string name)
+			: this(InternalCalls.BlackboardKey_Intern(name), false)
+		{
+		}
+
+		// The key for `name` if any blackboard has used it, else invalid.
+		// Unlike the constructor this never grows the engine's key table.
+		public static BlackboardKey Find(string name)
+			=> new BlackboardKey(InternalCalls.BlackboardKey_Find(name), false);
+
+		public bool IsValid => m_Handle != 0u;
+
+		public string Name => InternalCalls.BlackboardKey_GetName(ID);
+
+		internal uint ID => m_Handle - 1u; // 0 - 1 wraps to the engine's invalid id
+
+		public bool Equals(BlackboardKey other) => m_Handle == other.m_Handle;
+		public override bool Equals(object obj) => obj is BlackboardKey other && Equals(other);
+		public override int GetHashCode() => (int)m_Handle;
+		public override string ToString() => Name;
+
+		public static bool operator ==(BlackboardKey a, BlackboardKey b) => a.Equals(b);
+		public static bool operator !=(BlackboardKey a, BlackboardKey b) => !a.Equals(b);
+	}
+}
@@ -1480,6 +1480,12 @@ namespace OloEngine
 			set => InternalCalls.NavAgentComponent_SetLockYAxis(Entity.ID, value);
 		}
 
+		public uint FlowFieldGroup
+		{
+			get => InternalCalls.NavAgentComponent_GetFlowFieldGroup(Entity.ID);
+			set => InternalCalls.NavAgentComponent_SetFlowFieldGroup(Entity.ID, value);
+		}
+
 		public Vector3 TargetPosition
 		{
 			get
@@ -628,88 +628,162 @@ namespace OloEngine
 
 	public class BehaviorTreeComponent : Component
 	{
+		public void SetBlackboardBool(BlackboardKey key, bool value)
+			=> InternalCalls.BehaviorTreeComponent_SetBlackboardBool(Entity.ID, key.ID, value);
+
+		public bool GetBlackboardBool(BlackboardKey key)
+			=> InternalCalls.BehaviorTreeComponent_GetBlackboardBool(Entity.ID, key.ID);
+
+		public void SetBlackboardInt(BlackboardKey key, int value)
+			=> InternalCalls.BehaviorTreeComponent_SetBlackboardInt(Entity.ID, key.ID, value);
+
+		public int GetBlackboardInt(BlackboardKey key)
+			=> InternalCalls.BehaviorTreeComponent_GetBlackboardInt(Entity.ID, key.ID);
+
+		public void SetBlackboardFloat(BlackboardKey key, float value)
+			=> InternalCalls.BehaviorTreeComponent_SetBlackboardFloat(Entity.ID, key.ID, value);
+
+		public float GetBlackboardFloat(BlackboardKey key)
+			=> InternalCalls.BehaviorTreeComponent_GetBlackboardFloat(Entity.ID, key.ID);
+
+		public void SetBlackboardString(BlackboardKey key, string value)
+			=> InternalCalls.BehaviorTreeComponent_SetBlackboardString(Entity.ID, key.ID, value);
+
+		public string GetBlackboardString(BlackboardKey key)
+			=> InternalCalls.BehaviorTreeComponent_GetBlackboardString(Entity.ID, key.ID);
+
+		public void SetBlackboardVec3(BlackboardKey key, Vector3 value)
+			=> InternalCalls.BehaviorTreeComponent_SetBlackboardVec3(Entity.ID, key.ID, ref value);
+
+		public Vector3 GetBlackboardVec3(BlackboardKey key)
+		{
+			InternalCalls.BehaviorTreeComponent_GetBlackboardVec3(Entity.ID, key.ID, out Vector3 result);
+			return result;
+		}
+
+		public void RemoveBlackboardKey(BlackboardKey key)
+			=> InternalCalls.BehaviorTreeComponent_RemoveBlackboardKey(Entity.ID, key.ID);
+
+		public bool HasBlackboardKey(BlackboardKey key)
+			=> InternalCalls.BehaviorTreeComponent_HasBlackboardKey(Entity.ID, key.ID);
+
+		// Name overloads resolve the key on every call; prefer a cached BlackboardKey.
 		public void SetBlackboardBool(string key, bool value)
-			=> InternalCalls.BehaviorTreeComponent_SetBlackboardBool(Entity.ID, key, value);
+			=> SetBlackboardBool(new BlackboardKey(key), value);
 
 		public bool GetBlackboardBool(string key)
-			=> InternalCalls.BehaviorTreeComponent_GetBlackboardBool(Entity.ID, key);
+			=> GetBlackboardBool(BlackboardKey.Find(key));
 
 		public void SetBlackboardInt(string key, int value)
-			=> InternalCalls.BehaviorTreeComponent_SetBlackboardInt(Entity.ID, key, value);
+			=> SetBlackboardInt(new BlackboardKey(key), value);
 
 		public int GetBlackboardInt(string key)
-			=> InternalCalls.BehaviorTreeComponent_GetBlackboardInt(Entity.ID, key);
+			=> GetBlackboardInt(BlackboardKey.Find(key));
 
 		public void SetBlackboardFloat(string key, float value)
-			=> InternalCalls.BehaviorTreeComponent_SetBlackboardFloat(Entity.ID, key, value);
+			=> SetBlackboardFloat(new BlackboardKey(key), value);
 
 		public float GetBlackboardFloat(string key)
-			=> InternalCalls.BehaviorTreeComponent_GetBlackboardFloat(Entity.ID, key);
+			=> GetBlackboardFloat(BlackboardKey.Find(key));
 
 		public void SetBlackboardString(string key, string value)
-			=> InternalCalls.BehaviorTreeComponent_SetBlackboardString(Entity.ID, key, value);
+			=> SetBlackboardString(new BlackboardKey(key), value);
 
 		public string GetBlackboardString(string key)
-			=> InternalCalls.BehaviorTreeComponent_GetBlackboardString(Entity.ID, key);
+			=> GetBlackboardString(BlackboardKey.Find(key));
 
 		public void SetBlackboardVec3(string key, Vector3 value)
-			=> InternalCalls.BehaviorTreeComponent_SetBlackboardVec3(Entity.ID, key, ref value);
+			=> SetBlackboardVec3(new BlackboardKey(key), value);
 
 		public Vector3 GetBlackboardVec3(string key)
-		{
-			InternalCalls.BehaviorTreeComponent_GetBlackboardVec3(Entity.ID, key, out Vector3 result);
-			return result;
-		}
+			=> GetBlackboardVec3(BlackboardKey.Find(key));
 
 		public void RemoveBlackboardKey(string key)
-			=> InternalCalls.BehaviorTreeComponent_RemoveBlackboardKey(Entity.ID, key);
+			=> RemoveBlackboardKey(BlackboardKey.Find(key));
 
 		public bool HasBlackboardKey(string key)
-			=> InternalCalls.BehaviorTreeComponent_HasBlackboardKey(Entity.ID, key);
+			=> HasBlackboardKey(BlackboardKey.Find(key));
 
 		public bool IsRunning => InternalCalls.BehaviorTreeComponent_IsRunning(Entity.ID);
 	}
 
 	public class StateMachineComponent : Component
 	{
+		public void SetBlackboardBool(BlackboardKey key, bool value)
+			=> InternalCalls.StateMachineComponent_SetBlackboardBool(Entity.ID, key.ID, value);
+
+		public bool GetBlackboardBool(BlackboardKey key)
+			=> InternalCalls.StateMachineComponent_GetBlackboardBool(Entity.ID, key.ID);
+
+		public void SetBlackboardInt(BlackboardKey key, int value)
+			=> InternalCalls.StateMachineComponent_SetBlackboardInt(Entity.ID, key.ID, value);
+
+		public int GetBlackboardInt(BlackboardKey key)
+			=> InternalCalls.StateMachineComponent_GetBlackboardInt(Entity.ID, key.ID);
+
+		public void SetBlackboardFloat(BlackboardKey key, float value)
+			=> InternalCalls.StateMachineComponent_SetBlackboardFloat(Entity.ID, key.ID, value);
+
+		public float GetBlackboardFloat(BlackboardKey key)
+			=> InternalCalls.StateMachineComponent_GetBlackboardFloat(Entity.ID, key.ID);
+
+		public void SetBlackboardString(BlackboardKey key, string value)
+			=> InternalCalls.StateMachineComponent_SetBlackboardString(Entity.ID, key.ID, value);
+
+		public string GetBlackboardString(BlackboardKey key)
+			=> InternalCalls.StateMachineComponent_GetBlackboardString(Entity.ID, key.ID);
+
+		public void SetBlackboardVec3(BlackboardKey key, Vector3 value)
+			=> InternalCalls.StateMachineComponent_SetBlackboardVec3(Entity.ID, key.ID, ref value);
+
+		public Vector3 GetBlackboardVec3(BlackboardKey key)
+		{
+			InternalCalls.StateMachineComponent_GetBlackboardVec3(Entity.ID, key.ID, out Vector3 result);
+			return result;
+		}
+
+		public void RemoveBlackboardKey(BlackboardKey key)
+			=> InternalCalls.StateMachineComponent_RemoveBlackboardKey(Entity.ID, key.ID);
+
+		public bool HasBlackboardKey(BlackboardKey key)
+			=> InternalCalls.StateMachineComponent_HasBlackboardKey(Entity.ID, key.ID);
+
+		// Name overloads resolve the key on every call; prefer a cached BlackboardKey.
 		public void SetBlackboardBool(string key, bool value)
-			=> InternalCalls.StateMachineComponent_SetBlackboardBool(Entity.ID, key, value);
+			=> SetBlackboardBool(new BlackboardKey(key), value);
 
 		public bool GetBlackboardBool(string key)
-			=> InternalCalls.StateMachineComponent_GetBlackboardBool(Entity.ID, key);
+			=> GetBlackboardBool(BlackboardKey.Find(key));
 
 		public void SetBlackboardInt(string key, int value)
-			=> InternalCalls.StateMachineComponent_SetBlackboardInt(Entity.ID, key, value);
+			=> SetBlackboardInt(new BlackboardKey(key), value);
 
 		public int GetBlackboardInt(string key)
-			=> InternalCalls.StateMachineComponent_GetBlackboardInt(Entity.ID, key);
+			=> GetBlackboardInt(BlackboardKey.Find(key));
 
 		public void SetBlackboardFloat(string key, float value)
-			=> InternalCalls.StateMachineComponent_SetBlackboardFloat(Entity.ID, key, value);
+			=> SetBlackboardFloat(new BlackboardKey(key), value);
 
 		public float GetBlackboardFloat(string key)
-			=> InternalCalls.StateMachineComponent_GetBlackboardFloat(Entity.ID, key);
+			=> GetBlackboardFloat(BlackboardKey.Find(key));
 
 		public void SetBlackboardString(string key, string value)
-			=> InternalCalls.StateMachineComponent_SetBlackboardString(Entity.ID, key, value);
+			=> SetBlackboardString(new BlackboardKey(key), value);
 
 		public string GetBlackboardString(string key)
-			=> InternalCalls.StateMachineComponent_GetBlackboardString(Entity.ID, key);
+			=> GetBlackboardString(BlackboardKey.Find(key));
 
 		public void SetBlackboardVec3(string key, Vector3 value)
-			=> InternalCalls.StateMachineComponent_SetBlackboardVec3(Entity.ID, key, ref value);
+			=> SetBlackboardVec3(new BlackboardKey(key), value);
 
 		public Vector3 GetBlackboardVec3(string key)
-		{
-			InternalCalls.StateMachineComponent_GetBlackboardVec3(Entity.ID, key, out Vector3 result);
-			return result;
-		}
+			=> GetBlackboardVec3(BlackboardKey.Find(key));
 
 		public void RemoveBlackboardKey(string key)
-			=> InternalCalls.StateMachineComponent_RemoveBlackboardKey(Entity.ID, key);
+			=> RemoveBlackboardKey(BlackboardKey.Find(key));
 
 		public bool HasBlackboardKey(string key)
-			=> InternalCalls.StateMachineComponent_HasBlackboardKey(Entity.ID, key);
+			=> HasBlackboardKey(BlackboardKey.Find(key));
 
 		public string CurrentState => InternalCalls.StateMachineComponent_GetCurrentState(Entity.ID);
 
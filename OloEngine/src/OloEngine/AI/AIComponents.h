@@ -2,6 +2,7 @@
 
 #include "OloEngine/AI/BehaviorTree/BehaviorTree.h"
 #include "OloEngine/AI/BehaviorTree/BTBlackboard.h"
+#include "OloEngine/AI/BehaviorTree/BTCompiledTree.h"
 #include "OloEngine/AI/FSM/StateMachine.h"
 #include "OloEngine/AI/GOAP/GoapAgent.h"
 #include "OloEngine/Asset/Asset.h"
@@ -20,12 +21,28 @@ namespace OloEngine
         AssetHandle BehaviorTreeAssetHandle = 0;
         OLO_SERIALIZE(Skip)
         BTBlackboard Blackboard;
+        // Seconds between ticks (0 = every frame). A tree ticked at an
+        // interval is handed the time since its last tick, and agents are
+        // phase-offset by UUID so a crowd spreads its ticks over the interval.
+        f32 TickInterval = 0.0f;
 
         // Runtime (not serialized)
         OLO_SERIALIZE(Skip)
         Ref<BehaviorTree> RuntimeTree = nullptr;
         OLO_SERIALIZE(Skip)
         bool IsRunning = false;
+        // Asset-driven trees: AISystem binds the asset's compiled tree (unless
+        // a programmatic RuntimeTree is set) and keeps this agent's node state.
+        OLO_SERIALIZE(Skip)
+        Ref<BTCompiledTree> CompiledTree = nullptr;
+        OLO_SERIALIZE(Skip)
+        std::vector<BTNodeState> TreeState;
+        OLO_SERIALIZE(Skip)
+        AssetHandle CompiledAssetHandle = 0; // handle CompiledTree was bound from
+        OLO_SERIALIZE(Skip)
+        f32 TickCountdown = -1.0f; // < 0: phase not assigned yet
+        OLO_SERIALIZE(Skip)
+        f32 TickElapsed = 0.0f;
 
         BehaviorTreeComponent() = default;
 
@@ -33,7 +50,7 @@ namespace OloEngine
         // rebuilt from the asset later. (Used by entt's emplace_or_replace and
         // by serialization round-trips.)
         BehaviorTreeComponent(const BehaviorTreeComponent& other)
-            : BehaviorTreeAssetHandle(other.BehaviorTreeAssetHandle)
+            : BehaviorTreeAssetHandle(other.BehaviorTreeAssetHandle), TickInterval(other.TickInterval)
         {
         }
         BehaviorTreeComponent& operator=(const BehaviorTreeComponent& other)
@@ -41,9 +58,15 @@ namespace OloEngine
             if (this != &other)
             {
                 BehaviorTreeAssetHandle = other.BehaviorTreeAssetHandle;
+                TickInterval = other.TickInterval;
                 Blackboard.Clear();
                 RuntimeTree = nullptr;
                 IsRunning = false;
+                CompiledTree = nullptr;
+                TreeState.clear();
+                CompiledAssetHandle = 0;
+                TickCountdown = -1.0f;
+                TickElapsed = 0.0f;
             }
             return *this;
         }
@@ -165,6 +188,7 @@ namespace OloEngine
         bool RequireLineOfSight = true;             // when true, an occluded target is not seen
         i32 PerceiverTeam = 0;                      // this sensor's faction id
         bool DetectSameTeam = false;                // when false, same-team perceptibles are ignored
+        f32 SenseInterval = 0.0f;                   // seconds between sight updates (0 = every tick)
 
         // --- Runtime result (not serialized; recomputed every tick) ---
         OLO_SERIALIZE(Skip)
@@ -186,7 +210,7 @@ namespace OloEngine
         PerceptionComponent(const PerceptionComponent& other)
             : SightRange(other.SightRange), FovDegrees(other.FovDegrees), EyeOffset(other.EyeOffset),
               RequireLineOfSight(other.RequireLineOfSight), PerceiverTeam(other.PerceiverTeam),
-              DetectSameTeam(other.DetectSameTeam)
+              DetectSameTeam(other.DetectSameTeam), SenseInterval(other.SenseInterval)
         {
         }
         PerceptionComponent(PerceptionComponent&&) noexcept = default;
@@ -201,6 +225,7 @@ namespace OloEngine
                 RequireLineOfSight = other.RequireLineOfSight;
                 PerceiverTeam = other.PerceiverTeam;
                 DetectSameTeam = other.DetectSameTeam;
+                SenseInterval = other.SenseInterval;
                 HasVisibleTarget = false;
                 VisibleTarget = 0;
                 LastKnownPosition = { 0.0f, 0.0f, 0.0f };
@@ -222,7 +247,8 @@ namespace OloEngine
                                   Math::BitwiseEqual(EyeOffset, other.EyeOffset);
             const bool sameFilter = (RequireLineOfSight == other.RequireLineOfSight) &&
                                     (PerceiverTeam == other.PerceiverTeam) &&
-                                    (DetectSameTeam == other.DetectSameTeam);
+                                    (DetectSameTeam == other.DetectSameTeam) &&
+                                    Math::BitwiseEqual(SenseInterval, other.SenseInterval);
             return sameCone && sameFilter;
         }
     };
@@ -1,28 +1,173 @@
 #include "OloEnginePCH.h"
 #include "AISystem.h"
 #include "AIComponents.h"
+#include "OloEngine/AI/BehaviorTree/BehaviorTreeAsset.h"
+#include "OloEngine/Animation/AnimationGraphComponent.h"
+#include "OloEngine/Asset/AssetManager.h"
+#include "OloEngine/Project/Project.h"
+#include "OloEngine/Scene/Components.h"
 #include "OloEngine/Scene/Scene.h"
 #include "OloEngine/Scene/Entity.h"
+#include "OloEngine/Task/ParallelFor.h"
+
+#include <vector>
 
 namespace OloEngine
 {
+    namespace
+    {
+        // Agents per ParallelFor task: a compiled tick is a few hundred
+        // nanoseconds, so smaller batches cost more in scheduling than they save.
+        constexpr i32 kTreeTickBatch = 32;
+
+        struct CompiledTreeTick
+        {
+            BehaviorTreeComponent* Tree = nullptr;
+            BTAgentContext Agent;
+            f32 Dt = 0.0f;
+        };
+
+        // Fixed fraction in [0, 1) per entity (Fibonacci hash of the UUID), so
+        // agents sharing a TickInterval don't all tick on the same frame.
+        f32 TickPhase(UUID id)
+        {
+            const u64 hash = static_cast<u64>(id) * 0x9E3779B97F4A7C15ull;
+            return static_cast<f32>(hash >> 40) / static_cast<f32>(1u << 24);
+        }
+
+        // Advances the agent's tick clock. True when it ticks this frame, with
+        // the time since its previous tick in outDt.
+        bool ConsumeTick(BehaviorTreeComponent& bt, UUID id, f32 dt, f32& outDt)
+        {
+            bt.TickElapsed += dt;
+            if (bt.TickInterval > 0.0f)
+            {
+                if (bt.TickCountdown < 0.0f)
+                {
+                    bt.TickCountdown = bt.TickInterval * TickPhase(id);
+                }
+                bt.TickCountdown -= dt;
+                if (bt.TickCountdown > 0.0f)
+                {
+                    return false;
+                }
+                bt.TickCountdown += bt.TickInterval;
+                if (bt.TickCountdown <= 0.0f)
+                {
+                    // More than a whole interval behind (a hitch): restart
+                    // the cadence instead of ticking every frame to catch up.
+                    bt.TickCountdown = bt.TickInterval;
+                }
+            }
+            outDt = bt.TickElapsed;
+            bt.TickElapsed = 0.0f;
+            return true;
+        }
+
+        // (Re)binds the asset's compiled tree when the handle changed. A handle
+        // that doesn't resolve or compile is remembered, so it isn't retried
+        // every frame.
+        void BindCompiledTree(BehaviorTreeComponent& bt)
+        {
+            if (bt.CompiledAssetHandle == bt.BehaviorTreeAssetHandle)
+            {
+                return;
+            }
+            if (bt.BehaviorTreeAssetHandle != 0 && (!Project::GetActive() || !Project::GetAssetManager()))
+            {
+                return; // no asset manager yet: try again next tick
+            }
+            bt.CompiledAssetHandle = bt.BehaviorTreeAssetHandle;
+            bt.CompiledTree = nullptr;
+            bt.TreeState.clear();
+
+            if (bt.BehaviorTreeAssetHandle == 0)
+            {
+                return;
+            }
+            if (auto asset = AssetManager::GetAsset<BehaviorTreeAsset>(bt.BehaviorTreeAssetHandle))
+            {
+                bt.CompiledTree = asset->GetCompiledTree();
+            }
+            if (bt.CompiledTree)
+            {
+                bt.TreeState.assign(bt.CompiledTree->GetNodeCount(), BTNodeState{});
+            }
+            else
+            {
+                OLO_CORE_WARN("[AISystem] Behavior tree asset {} could not be loaded or compiled", static_cast<u64>(bt.BehaviorTreeAssetHandle));
+            }
+        }
+
+        // Resolves only the components the tree has nodes for.
+        BTAgentContext ResolveAgentContext(Entity entity, const BTCompiledTree& tree)
+        {
+            BTAgentContext agent;
+            if (tree.Uses(BTCompiledTree::NodeKind::MoveTo))
+            {
+                agent.Nav = entity.HasComponent<NavAgentComponent>() ? &entity.GetComponent<NavAgentComponent>() : nullptr;
+                agent.Transform = entity.HasComponent<TransformComponent>() ? &entity.GetComponent<TransformComponent>() : nullptr;
+            }
+            if (tree.Uses(BTCompiledTree::NodeKind::PlayAnimation))
+            {
+                agent.Animation = entity.HasComponent<AnimationGraphComponent>() ? &entity.GetComponent<AnimationGraphComponent>() : nullptr;
+            }
+            if (tree.Uses(BTCompiledTree::NodeKind::CanSeeTarget))
+            {
+                agent.Perception = entity.HasComponent<PerceptionComponent>() ? &entity.GetComponent<PerceptionComponent>() : nullptr;
+            }
+            return agent;
+        }
+    } // namespace
+
     void AISystem::OnUpdate(Scene* scene, f32 dt)
     {
         OLO_PROFILE_FUNCTION();
 
-        // Tick all BehaviorTreeComponents
+        // Tick all BehaviorTreeComponents. A programmatic RuntimeTree ticks
+        // inline (its nodes may be game code touching anything); asset-driven
+        // trees tick from their compiled form, which only touches the agent's
+        // own blackboard, node state and the components resolved here, so
+        // those are collected and ticked in parallel batches.
         {
             OLO_PROFILE_SCOPE("AISystem::BehaviorTrees");
             auto btView = scene->GetAllEntitiesWith<BehaviorTreeComponent>();
+            std::vector<CompiledTreeTick> compiledTicks;
+            compiledTicks.reserve(btView.size());
             for (auto entityId : btView)
             {
                 auto& bt = btView.get<BehaviorTreeComponent>(entityId);
+                if (!bt.RuntimeTree)
+                {
+                    BindCompiledTree(bt);
+                }
+                if (!bt.RuntimeTree && !bt.CompiledTree)
+                {
+                    continue;
+                }
+
+                Entity entity{ entityId, scene };
+                f32 tickDt = 0.0f;
+                if (!ConsumeTick(bt, entity.GetUUID(), dt, tickDt))
+                {
+                    continue;
+                }
+
                 if (bt.RuntimeTree)
                 {
-                    Entity entity{ entityId, scene };
-                    bt.RuntimeTree->Tick(dt, bt.Blackboard, entity);
+                    bt.IsRunning = bt.RuntimeTree->Tick(tickDt, bt.Blackboard, entity) == BTStatus::Running;
+                }
+                else
+                {
+                    compiledTicks.push_back({ &bt, ResolveAgentContext(entity, *bt.CompiledTree), tickDt });
                 }
             }
+
+            ParallelFor("AISystem::CompiledTrees", static_cast<i32>(compiledTicks.size()), kTreeTickBatch, [&compiledTicks](i32 index)
+                        {
+                const CompiledTreeTick& tick = compiledTicks[index];
+                BehaviorTreeComponent& bt = *tick.Tree;
+                bt.IsRunning = bt.CompiledTree->Tick(bt.TreeState, tick.Dt, bt.Blackboard, tick.Agent) == BTStatus::Running; });
         }
 
         // Tick all StateMachineComponents
@@ -44,7 +189,9 @@ namespace OloEngine
             }
         }
 
-        // Tick all GoapAgentComponents (deliberative planners)
+        // Tick all GoapAgentComponents (deliberative planners). Replans that
+        // miss the shared plan cache run as tasks; an agent idles until its
+        // task finishes and never blocks this loop waiting for one.
         {
             OLO_PROFILE_SCOPE("AISystem::GoapAgents");
             auto goapView = scene->GetAllEntitiesWith<GoapAgentComponent>();
@@ -53,7 +200,7 @@ namespace OloEngine
                 auto& goap = goapView.get<GoapAgentComponent>(entityId);
                 if (goap.Enabled && goap.RuntimeAgent)
                 {
-                    goap.RuntimeAgent->Update(dt);
+                    goap.RuntimeAgent->Update(dt, /*planInBackground=*/true);
                 }
             }
         }
@@ -0,0 +1,117 @@
+#include "OloEnginePCH.h"
+#include "BTBlackboard.h"
+#include "OloEngine/Core/TransparentStringHash.h"
+#include "OloEngine/Threading/SharedLock.h"
+#include "OloEngine/Threading/SharedMutex.h"
+#include "OloEngine/Threading/UniqueLock.h"
+
+#include <deque>
+
+namespace OloEngine
+{
+    namespace
+    {
+        // Process-wide name <-> id table. Names live in a deque so the
+        // references GetName() hands out survive later interning.
+        struct BlackboardKeyTable
+        {
+            FSharedMutex Mutex;
+            std::unordered_map<std::string, u32, StringHash, StringEqual> Ids;
+            std::deque<std::string> Names;
+        };
+
+        BlackboardKeyTable& GetKeyTable()
+        {
+            static BlackboardKeyTable s_Table;
+            return s_Table;
+        }
+
+        // Names this thread has already resolved. Ids are never reused, so an
+        // entry can't go stale, and only a name the thread hasn't seen takes
+        // the shared table's lock.
+        using ThreadKeyCache = std::unordered_map<std::string, u32, StringHash, StringEqual>;
+
+        ThreadKeyCache& GetThreadKeyCache()
+        {
+            thread_local ThreadKeyCache s_Cache;
+            return s_Cache;
+        }
+    } // namespace
+
+    BlackboardKey::BlackboardKey(std::string_view name)
+    {
+        auto& cache = GetThreadKeyCache();
+        if (auto it = cache.find(name); it != cache.end())
+        {
+            Id = it->second;
+            return;
+        }
+
+        Id = Intern(name);
+        cache.emplace(std::string(name), Id);
+    }
+
+    u32 BlackboardKey::Intern(std::string_view name)
+    {
+        auto& table = GetKeyTable();
+        {
+            TSharedLock<FSharedMutex> lock(table.Mutex);
+            if (auto it = table.Ids.find(name); it != table.Ids.end())
+            {
+                return it->second;
+            }
+        }
+
+        TUniqueLock<FSharedMutex> lock(table.Mutex);
+        // Another thread may have interned it between the two locks.
+        if (auto it = table.Ids.find(name); it != table.Ids.end())
+        {
+            return it->second;
+        }
+        const auto id = static_cast<u32>(table.Names.size());
+        table.Names.emplace_back(name);
+        table.Ids.emplace(table.Names.back(), id);
+        return id;
+    }
+
+    BlackboardKey BlackboardKey::Find(std::string_view name)
+    {
+        auto& cache = GetThreadKeyCache();
+        if (auto it = cache.find(name); it != cache.end())
+        {
+            return FromId(it->second);
+        }
+
+        // A miss isn't cached: the name may be interned later.
+        auto& table = GetKeyTable();
+        u32 id = kInvalidId;
+        {
+            TSharedLock<FSharedMutex> lock(table.Mutex);
+            if (auto it = table.Ids.find(name); it != table.Ids.end())
+            {
+                id = it->second;
+            }
+        }
+        if (id == kInvalidId)
+        {
+            return {};
+        }
+        cache.emplace(std::string(name), id);
+        return FromId(id);
+    }
+
+    u32 BlackboardKey::GetInternedCount()
+    {
+        auto& table = GetKeyTable();
+        TSharedLock<FSharedMutex> lock(table.Mutex);
+        return static_cast<u32>(table.Names.size());
+    }
+
+    const std::string& BlackboardKey::GetName() const
+    {
+        static const std::string s_Invalid;
+        auto& table = GetKeyTable();
+        TSharedLock<FSharedMutex> lock(table.Mutex);
+        return Id < table.Names.size() ? table.Names[Id] : s_Invalid;
+    }
+} // namespace OloEngine
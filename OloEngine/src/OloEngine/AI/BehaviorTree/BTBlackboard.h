@@ -7,67 +7,240 @@
 
 #include <optional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <variant>
+#include <vector>
 
 namespace OloEngine
 {
+    // A blackboard key interned to a dense, process-wide slot id. Names are
+    // interned once (at asset compile time, or into a function-local static)
+    // and from then on every lookup is an array index instead of a string
+    // hash. Interning is thread-safe; ids stay valid for the process lifetime.
+    // Each thread remembers the names it has resolved, so resolving a name
+    // again takes no lock on the shared key table.
+    struct BlackboardKey
+    {
+        static constexpr u32 kInvalidId = ~0u;
+
+        u32 Id = kInvalidId;
+
+        BlackboardKey() = default;
+        // Interns `name`, allocating a new slot id the first time it is seen.
+        explicit BlackboardKey(std::string_view name);
+
+        [[nodiscard]] static BlackboardKey FromId(u32 id)
+        {
+            BlackboardKey key;
+            key.Id = id;
+            return key;
+        }
+
+        // Looks `name` up without interning it: an invalid key if it has
+        // never been interned (and so can't be on any blackboard).
+        [[nodiscard]] static BlackboardKey Find(std::string_view name);
+        [[nodiscard]] static u32 GetInternedCount();
+
+        [[nodiscard]] const std::string& GetName() const;
+        [[nodiscard]] bool IsValid() const
+        {
+            return Id != kInvalidId;
+        }
+
+        auto operator<=>(const BlackboardKey&) const = default;
+
+      private:
+        // The shared table's id for `name`, interning it if it's new.
+        [[nodiscard]] static u32 Intern(std::string_view name);
+    };
+
+    // An authored key name with its key, interned when the name is assigned.
+    // For nodes built in code, whose key is a plain string field: ticking
+    // them uses Key and never touches the key table.
+    struct NamedBlackboardKey
+    {
+        std::string Name;
+        BlackboardKey Key;
+
+        NamedBlackboardKey() = default;
+        NamedBlackboardKey(std::string name)
+            : Name(std::move(name)), Key(Name)
+        {
+        }
+        NamedBlackboardKey(const char* name)
+            : NamedBlackboardKey(std::string(name))
+        {
+        }
+        NamedBlackboardKey(std::string_view name)
+            : NamedBlackboardKey(std::string(name))
+        {
+        }
+    };
+
+    // Per-agent key/value store shared by BT, FSM, GOAP, perception and
+    // scripts. Entries live in two index-parallel arrays (interned key ids,
+    // values), and a table indexed by key id maps a key to its entry, so a
+    // lookup is two array reads. The table is sized to the highest key id
+    // this blackboard has stored, a u32 per interned key at most. The string
+    // overloads resolve the name to a key first; tick code resolves its keys
+    // once up front and uses the key overloads.
     class BTBlackboard
     {
       public:
         using Value = std::variant<bool, i32, f32, std::string, glm::vec3, UUID>;
 
-        void Set(const std::string& key, Value value)
+        void Set(BlackboardKey key, Value value)
+        {
+            if (!key.IsValid())
+            {
+                return;
+            }
+            if (Value* existing = Find(key))
+            {
+                *existing = std::move(value);
+                return;
+            }
+            if (key.Id >= m_EntryOf.size())
+            {
+                m_EntryOf.resize(key.Id + 1, kNoEntry);
+            }
+            m_EntryOf[key.Id] = static_cast<u32>(m_Keys.size());
+            m_Keys.push_back(key.Id);
+            m_Values.push_back(std::move(value));
+        }
+
+        void Set(std::string_view key, Value value)
         {
-            m_Data[key] = std::move(value);
+            Set(BlackboardKey(key), std::move(value));
         }
 
         template<typename T>
-        [[nodiscard]] T Get(const std::string& key, T defaultValue = {}) const
+        [[nodiscard]] T Get(BlackboardKey key, T defaultValue = {}) const
         {
-            auto it = m_Data.find(key);
-            if (it == m_Data.end())
-            {
-                return defaultValue;
-            }
-            if (auto* val = std::get_if<T>(&it->second))
+            if (const Value* value = Find(key))
             {
-                return *val;
+                if (auto* val = std::get_if<T>(value))
+                {
+                    return *val;
+                }
             }
             return defaultValue;
         }
 
-        [[nodiscard]] bool Has(const std::string& key) const
+        template<typename T>
+        [[nodiscard]] T Get(std::string_view key, T defaultValue = {}) const
         {
-            return m_Data.contains(key);
+            return Get<T>(BlackboardKey::Find(key), std::move(defaultValue));
         }
 
-        void Remove(const std::string& key)
+        [[nodiscard]] bool Has(BlackboardKey key) const
         {
-            m_Data.erase(key);
+            return Find(key) != nullptr;
+        }
+
+        [[nodiscard]] bool Has(std::string_view key) const
+        {
+            return Has(BlackboardKey::Find(key));
+        }
+
+        void Remove(BlackboardKey key)
+        {
+            if (const i32 index = IndexOf(key); index >= 0)
+            {
+                // Swap-and-pop: entry order is not part of the contract.
+                m_EntryOf[m_Keys.back()] = static_cast<u32>(index);
+                m_EntryOf[key.Id] = kNoEntry;
+                m_Keys[index] = m_Keys.back();
+                m_Values[index] = std::move(m_Values.back());
+                m_Keys.pop_back();
+                m_Values.pop_back();
+            }
+        }
+
+        void Remove(std::string_view key)
+        {
+            Remove(BlackboardKey::Find(key));
         }
 
         void Clear()
         {
-            m_Data.clear();
+            for (const u32 id : m_Keys)
+            {
+                m_EntryOf[id] = kNoEntry;
+            }
+            m_Keys.clear();
+            m_Values.clear();
         }
 
-        [[nodiscard]] const std::unordered_map<std::string, Value>& GetAll() const
+        [[nodiscard]] const Value* Find(BlackboardKey key) const
         {
-            return m_Data;
+            const i32 index = IndexOf(key);
+            return index >= 0 ? &m_Values[index] : nullptr;
         }
 
-        [[nodiscard]] std::optional<Value> GetRaw(const std::string& key) const
+        [[nodiscard]] Value* Find(BlackboardKey key)
         {
-            if (auto it = m_Data.find(key); it != m_Data.end())
+            const i32 index = IndexOf(key);
+            return index >= 0 ? &m_Values[index] : nullptr;
+        }
+
+        [[nodiscard]] std::optional<Value> GetRaw(BlackboardKey key) const
+        {
+            if (const Value* value = Find(key))
             {
-                return it->second;
+                return *value;
             }
             return std::nullopt;
         }
 
+        [[nodiscard]] std::optional<Value> GetRaw(std::string_view key) const
+        {
+            return GetRaw(BlackboardKey::Find(key));
+        }
+
+        [[nodiscard]] sizet GetSize() const
+        {
+            return m_Keys.size();
+        }
+
+        // Calls fn(const std::string& name, const Value& value) per entry.
+        template<typename Fn>
+        void ForEach(Fn&& fn) const
+        {
+            for (sizet i = 0; i < m_Keys.size(); ++i)
+            {
+                fn(BlackboardKey::FromId(m_Keys[i]).GetName(), m_Values[i]);
+            }
+        }
+
+        // Name-keyed copy of every entry, for serialization, debug views and
+        // tests. Builds a map on each call; tick code should use Find/Get.
+        [[nodiscard]] std::unordered_map<std::string, Value> GetAll() const
+        {
+            std::unordered_map<std::string, Value> all;
+            all.reserve(m_Keys.size());
+            ForEach([&all](const std::string& name, const Value& value)
+                    { all.emplace(name, value); });
+            return all;
+        }
+
       private:
-        std::unordered_map<std::string, Value> m_Data;
+        static constexpr u32 kNoEntry = ~0u;
+
+        [[nodiscard]] i32 IndexOf(BlackboardKey key) const
+        {
+            // An invalid key's id is past the end of any table.
+            if (key.Id >= m_EntryOf.size() || m_EntryOf[key.Id] == kNoEntry)
+            {
+                return -1;
+            }
+            return static_cast<i32>(m_EntryOf[key.Id]);
+        }
+
+        std::vector<u32> m_Keys;
+        std::vector<Value> m_Values;
+        std::vector<u32> m_EntryOf; // key id -> index into m_Keys/m_Values, or kNoEntry
     };
 
     [[nodiscard]] inline std::string BlackboardValueToString(const BTBlackboard::Value& value)
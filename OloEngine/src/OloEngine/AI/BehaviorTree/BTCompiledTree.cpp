@@ -0,0 +1,621 @@
+#include "OloEnginePCH.h"
+#include "BTCompiledTree.h"
+#include "OloEngine/AI/AIComponents.h"
+#include "OloEngine/AI/BehaviorTree/BehaviorTreeAsset.h"
+#include "OloEngine/Animation/AnimationGraphComponent.h"
+#include "OloEngine/Core/Log.h"
+#include "OloEngine/Scene/Components.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <charconv>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace OloEngine
+{
+    namespace
+    {
+        using NodeKind = BTCompiledTree::NodeKind;
+
+        struct KindName
+        {
+            std::string_view Name;
+            NodeKind Kind;
+        };
+
+        // Same type names BTNodeRegistry registers the node classes under.
+        constexpr std::array<KindName, 14> kKindNames{ {
+            { "Sequence", NodeKind::Sequence },
+            { "Selector", NodeKind::Selector },
+            { "Parallel", NodeKind::Parallel },
+            { "Inverter", NodeKind::Inverter },
+            { "Repeater", NodeKind::Repeater },
+            { "Cooldown", NodeKind::Cooldown },
+            { "ConditionalGuard", NodeKind::ConditionalGuard },
+            { "Wait", NodeKind::Wait },
+            { "SetBlackboardValue", NodeKind::SetBlackboardValue },
+            { "Log", NodeKind::Log },
+            { "CheckBlackboardKey", NodeKind::CheckBlackboardKey },
+            { "MoveTo", NodeKind::MoveTo },
+            { "PlayAnimation", NodeKind::PlayAnimation },
+            { "CanSeeTarget", NodeKind::CanSeeTarget },
+        } };
+
+        [[nodiscard]] const KindName* FindKind(std::string_view typeName)
+        {
+            for (auto const& entry : kKindNames)
+            {
+                if (entry.Name == typeName)
+                {
+                    return &entry;
+                }
+            }
+            return nullptr;
+        }
+
+        using PropertyMap = std::unordered_map<std::string, std::string>;
+
+        [[nodiscard]] const std::string* FindProperty(const PropertyMap& props, const char* name)
+        {
+            auto it = props.find(name);
+            return it != props.end() ? &it->second : nullptr;
+        }
+
+        [[nodiscard]] std::string_view Trim(std::string_view text)
+        {
+            while (!text.empty() && std::isspace(static_cast<unsigned char>(text.front())))
+            {
+                text.remove_prefix(1);
+            }
+            while (!text.empty() && std::isspace(static_cast<unsigned char>(text.back())))
+            {
+                text.remove_suffix(1);
+            }
+            return text;
+        }
+
+        template<typename T>
+        [[nodiscard]] bool ParseNumber(std::string_view text, T& out)
+        {
+            text = Trim(text);
+            auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), out);
+            return ec == std::errc{} && ptr == text.data() + text.size();
+        }
+
+        template<typename T>
+        [[nodiscard]] T NumberProperty(const PropertyMap& props, const char* name, T fallback)
+        {
+            T value{};
+            if (const std::string* text = FindProperty(props, name); text && ParseNumber(*text, value))
+            {
+                return value;
+            }
+            return fallback;
+        }
+
+        [[nodiscard]] bool BoolProperty(const PropertyMap& props, const char* name, bool fallback)
+        {
+            if (const std::string* text = FindProperty(props, name))
+            {
+                return *text == "true" || *text == "1";
+            }
+            return fallback;
+        }
+
+        [[nodiscard]] bool ParseVec3(std::string_view text, glm::vec3& out)
+        {
+            text = Trim(text);
+            if (text.size() >= 2 && text.front() == '(' && text.back() == ')')
+            {
+                text = text.substr(1, text.size() - 2);
+            }
+            for (i32 axis = 0; axis < 3; ++axis)
+            {
+                const sizet comma = text.find(',');
+                if ((axis < 2) == (comma == std::string_view::npos) || !ParseNumber(text.substr(0, comma), out[axis]))
+                {
+                    return false;
+                }
+                text = axis < 2 ? text.substr(comma + 1) : std::string_view{};
+            }
+            return true;
+        }
+
+        // Property string -> blackboard value. The asset's BlackboardKeyDefs
+        // type hint for the key decides the type; without one the literal's
+        // shape does (true/false, integer, decimal, "x, y, z", else string).
+        [[nodiscard]] BTBlackboard::Value ParseValue(const std::string& text, const std::string* typeHint)
+        {
+            const std::string_view hint = typeHint ? std::string_view(*typeHint) : std::string_view{};
+            i32 asInt = 0;
+            f32 asFloat = 0.0f;
+            u64 asId = 0;
+            glm::vec3 asVec{ 0.0f };
+
+            if (hint == "bool" || (hint.empty() && (text == "true" || text == "false")))
+            {
+                return text == "true" || text == "1";
+            }
+            if (hint == "int" || hint == "i32" || (hint.empty() && ParseNumber(text, asInt)))
+            {
+                (void)ParseNumber(text, asInt);
+                return asInt;
+            }
+            if (hint == "float" || hint == "f32" || (hint.empty() && ParseNumber(text, asFloat)))
+            {
+                (void)ParseNumber(text, asFloat);
+                return asFloat;
+            }
+            if (hint == "vec3" || (hint.empty() && ParseVec3(text, asVec)))
+            {
+                (void)ParseVec3(text, asVec);
+                return asVec;
+            }
+            if (hint == "UUID" || hint == "uuid" || hint == "entity")
+            {
+                (void)ParseNumber(text, asId);
+                return UUID(asId);
+            }
+            return text;
+        }
+
+        class Compiler
+        {
+          public:
+            explicit Compiler(const BehaviorTreeAsset& asset)
+                : m_Asset(asset)
+            {
+                for (auto const& node : asset.GetNodes())
+                {
+                    m_ById.emplace(static_cast<u64>(node.ID), &node);
+                }
+                // Intern the declared keys up front so their slots exist even
+                // before a node or script first writes them.
+                for (auto const& [key, typeHint] : asset.BlackboardKeyDefs)
+                {
+                    (void)BlackboardKey(key);
+                }
+            }
+
+            // Emits `id`'s subtree in pre-order; kNone on failure.
+            u32 Emit(UUID id, std::vector<BTCompiledTree::Node>& nodes, std::vector<BTBlackboard::Value>& values,
+                     std::vector<std::string>& strings, u32& kindMask)
+            {
+                auto found = m_ById.find(static_cast<u64>(id));
+                if (found == m_ById.end())
+                {
+                    OLO_CORE_ERROR("[BTCompiledTree] Node {} referenced but not defined", static_cast<u64>(id));
+                    return BTCompiledTree::kNone;
+                }
+                const BTNodeData& data = *found->second;
+                const KindName* kind = FindKind(data.TypeName);
+                if (!kind)
+                {
+                    OLO_CORE_ERROR("[BTCompiledTree] Node type '{}' ({}) has no compiled form", data.TypeName, static_cast<u64>(id));
+                    return BTCompiledTree::kNone;
+                }
+                if (!m_OnPath.insert(static_cast<u64>(id)).second)
+                {
+                    OLO_CORE_ERROR("[BTCompiledTree] Cycle through node {}", static_cast<u64>(id));
+                    return BTCompiledTree::kNone;
+                }
+
+                const u32 index = static_cast<u32>(nodes.size());
+                nodes.emplace_back();
+                kindMask |= 1u << static_cast<u32>(kind->Kind);
+                {
+                    BTCompiledTree::Node& node = nodes[index];
+                    node.Kind = kind->Kind;
+                    ReadParameters(data, node, values, strings);
+                }
+
+                u32 previous = BTCompiledTree::kNone;
+                for (UUID childId : data.ChildIDs)
+                {
+                    const u32 child = Emit(childId, nodes, values, strings, kindMask);
+                    if (child == BTCompiledTree::kNone)
+                    {
+                        return BTCompiledTree::kNone;
+                    }
+                    // `nodes` may have reallocated: index, don't hold references.
+                    if (previous == BTCompiledTree::kNone)
+                    {
+                        nodes[index].FirstChild = child;
+                    }
+                    else
+                    {
+                        nodes[previous].NextSibling = child;
+                    }
+                    previous = child;
+                    ++nodes[index].ChildCount;
+                }
+
+                nodes[index].SubtreeEnd = static_cast<u32>(nodes.size());
+                m_OnPath.erase(static_cast<u64>(id));
+                return index;
+            }
+
+          private:
+            [[nodiscard]] const std::string* TypeHint(const std::string& key) const
+            {
+                auto it = m_Asset.BlackboardKeyDefs.find(key);
+                return it != m_Asset.BlackboardKeyDefs.end() ? &it->second : nullptr;
+            }
+
+            void ReadKey(const PropertyMap& props, const char* name, BTCompiledTree::Node& node, const std::string*& outHint) const
+            {
+                static const std::string s_Empty;
+                const std::string* key = FindProperty(props, name);
+                node.Key = BlackboardKey(key ? *key : s_Empty);
+                outHint = key ? TypeHint(*key) : nullptr;
+            }
+
+            static u32 AddValue(const std::string& text, const std::string* hint, std::vector<BTBlackboard::Value>& values)
+            {
+                values.push_back(ParseValue(text, hint));
+                return static_cast<u32>(values.size() - 1);
+            }
+
+            static u32 AddString(const std::string* text, std::vector<std::string>& strings)
+            {
+                strings.push_back(text ? *text : std::string{});
+                return static_cast<u32>(strings.size() - 1);
+            }
+
+            void ReadParameters(const BTNodeData& data, BTCompiledTree::Node& node, std::vector<BTBlackboard::Value>& values,
+                                std::vector<std::string>& strings) const
+            {
+                const PropertyMap& props = data.Properties;
+                const std::string* hint = nullptr;
+                switch (node.Kind)
+                {
+                    case NodeKind::Parallel:
+                        if (const std::string* policy = FindProperty(props, "SuccessPolicy"); policy && *policy == "RequireOne")
+                        {
+                            node.Flags |= BTCompiledTree::kSucceedOnOne;
+                        }
+                        if (const std::string* policy = FindProperty(props, "FailurePolicy"); policy && *policy == "RequireAll")
+                        {
+                            node.Flags |= BTCompiledTree::kFailOnAll;
+                        }
+                        break;
+                    case NodeKind::Repeater:
+                        node.Count = NumberProperty<u32>(props, "RepeatCount", 0u);
+                        if (BoolProperty(props, "AbortOnFailure", false))
+                        {
+                            node.Flags |= BTCompiledTree::kAbortOnFailure;
+                        }
+                        break;
+                    case NodeKind::Cooldown:
+                        node.Time = NumberProperty<f32>(props, "CooldownTime", 1.0f);
+                        break;
+                    case NodeKind::Wait:
+                        node.Time = NumberProperty<f32>(props, "Duration", 1.0f);
+                        break;
+                    case NodeKind::ConditionalGuard:
+                        ReadKey(props, "BlackboardKey", node, hint);
+                        if (const std::string* expected = FindProperty(props, "ExpectedValue"))
+                        {
+                            node.Operand = AddValue(*expected, hint, values);
+                        }
+                        else
+                        {
+                            // BTConditionalGuard's default-constructed ExpectedValue.
+                            values.emplace_back();
+                            node.Operand = static_cast<u32>(values.size() - 1);
+                        }
+                        break;
+                    case NodeKind::SetBlackboardValue:
+                        ReadKey(props, "Key", node, hint);
+                        if (const std::string* value = FindProperty(props, "ValueToSet"))
+                        {
+                            node.Operand = AddValue(*value, hint, values);
+                        }
+                        else
+                        {
+                            values.emplace_back();
+                            node.Operand = static_cast<u32>(values.size() - 1);
+                        }
+                        break;
+                    case NodeKind::CheckBlackboardKey:
+                        ReadKey(props, "Key", node, hint);
+                        if (const std::string* expected = FindProperty(props, "ExpectedValue"))
+                        {
+                            node.Operand = AddValue(*expected, hint, values);
+                        }
+                        break;
+                    case NodeKind::MoveTo:
+                        ReadKey(props, "TargetBlackboardKey", node, hint);
+                        break;
+                    case NodeKind::Log:
+                        node.Operand = AddString(FindProperty(props, "Message"), strings);
+                        break;
+                    case NodeKind::PlayAnimation:
+                        node.Operand = AddString(FindProperty(props, "AnimationName"), strings);
+                        break;
+                    case NodeKind::Sequence:
+                    case NodeKind::Selector:
+                    case NodeKind::Inverter:
+                    case NodeKind::CanSeeTarget:
+                        break;
+                }
+            }
+
+            const BehaviorTreeAsset& m_Asset;
+            std::unordered_map<u64, const BTNodeData*> m_ById;
+            std::unordered_set<u64> m_OnPath;
+        };
+    } // namespace
+
+    Ref<BTCompiledTree> BTCompiledTree::Compile(const BehaviorTreeAsset& asset)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        if (!asset.FindNode(asset.GetRootNodeID()))
+        {
+            OLO_CORE_ERROR("[BTCompiledTree] Asset {} has no root node", static_cast<u64>(asset.GetHandle()));
+            return nullptr;
+        }
+
+        auto tree = Ref<BTCompiledTree>::Create();
+        tree->m_Nodes.reserve(asset.GetNodes().size());
+        Compiler compiler(asset);
+        if (compiler.Emit(asset.GetRootNodeID(), tree->m_Nodes, tree->m_Values, tree->m_Strings, tree->m_KindMask) == kNone)
+        {
+            return nullptr;
+        }
+        return tree;
+    }
+
+    bool BTCompiledTree::IsCompilable(std::string_view typeName)
+    {
+        return FindKind(typeName) != nullptr;
+    }
+
+    BTStatus BTCompiledTree::Tick(std::span<BTNodeState> state, f32 dt, BTBlackboard& blackboard, const BTAgentContext& agent) const
+    {
+        OLO_CORE_ASSERT(state.size() == m_Nodes.size(), "BTCompiledTree state sized for a different tree");
+        if (m_Nodes.empty() || state.size() != m_Nodes.size())
+        {
+            return BTStatus::Failure;
+        }
+        TickContext ctx{ state, dt, blackboard, agent };
+        return TickNode(0, ctx);
+    }
+
+    void BTCompiledTree::Reset(std::span<BTNodeState> state) const
+    {
+        std::ranges::fill(state, BTNodeState{});
+    }
+
+    void BTCompiledTree::ResetSubtree(u32 index, std::span<BTNodeState> state) const
+    {
+        std::fill(state.begin() + index, state.begin() + m_Nodes[index].SubtreeEnd, BTNodeState{});
+    }
+
+    BTStatus BTCompiledTree::TickNode(u32 index, TickContext& ctx) const
+    {
+        const Node& node = m_Nodes[index];
+        BTNodeState& state = ctx.State[index];
+
+        switch (node.Kind)
+        {
+            case NodeKind::Sequence:
+            case NodeKind::Selector:
+            {
+                // Sequence stops on the first Failure, Selector on the first
+                // Success; either resumes a Running child next tick.
+                const BTStatus stopOn = node.Kind == NodeKind::Sequence ? BTStatus::Failure : BTStatus::Success;
+                for (u32 child = state.Counter != 0 ? state.Counter : node.FirstChild; child != kNone; child = m_Nodes[child].NextSibling)
+                {
+                    state.Counter = child;
+                    const BTStatus status = TickNode(child, ctx);
+                    if (status == BTStatus::Running)
+                    {
+                        return BTStatus::Running;
+                    }
+                    if (status == stopOn)
+                    {
+                        ResetSubtree(index, ctx.State);
+                        return stopOn;
+                    }
+                }
+                ResetSubtree(index, ctx.State);
+                return stopOn == BTStatus::Failure ? BTStatus::Success : BTStatus::Failure;
+            }
+            case NodeKind::Parallel:
+            {
+                u32 successCount = 0;
+                u32 failureCount = 0;
+                for (u32 child = node.FirstChild; child != kNone; child = m_Nodes[child].NextSibling)
+                {
+                    const BTStatus status = TickNode(child, ctx);
+                    successCount += status == BTStatus::Success ? 1u : 0u;
+                    failureCount += status == BTStatus::Failure ? 1u : 0u;
+                }
+
+                const bool failed = (node.Flags & kFailOnAll) ? failureCount == node.ChildCount : failureCount > 0;
+                const bool succeeded = (node.Flags & kSucceedOnOne) ? successCount > 0 : successCount == node.ChildCount;
+                if (failed || succeeded)
+                {
+                    ResetSubtree(index, ctx.State);
+                    return failed ? BTStatus::Failure : BTStatus::Success;
+                }
+                return BTStatus::Running;
+            }
+            case NodeKind::Inverter:
+            {
+                if (node.FirstChild == kNone)
+                {
+                    return BTStatus::Failure;
+                }
+                const BTStatus status = TickNode(node.FirstChild, ctx);
+                if (status == BTStatus::Running)
+                {
+                    return BTStatus::Running;
+                }
+                ResetSubtree(node.FirstChild, ctx.State);
+                return status == BTStatus::Success ? BTStatus::Failure : BTStatus::Success;
+            }
+            case NodeKind::Repeater:
+            {
+                if (node.FirstChild == kNone)
+                {
+                    return BTStatus::Failure;
+                }
+                const BTStatus status = TickNode(node.FirstChild, ctx);
+                if (status == BTStatus::Failure && (node.Flags & kAbortOnFailure))
+                {
+                    state.Counter = 0;
+                    ResetSubtree(node.FirstChild, ctx.State);
+                    return BTStatus::Failure;
+                }
+                if (status == BTStatus::Running)
+                {
+                    return BTStatus::Running;
+                }
+
+                ++state.Counter;
+                ResetSubtree(node.FirstChild, ctx.State);
+                if (node.Count > 0 && state.Counter >= node.Count)
+                {
+                    state.Counter = 0;
+                    return BTStatus::Success;
+                }
+                return BTStatus::Running;
+            }
+            case NodeKind::Cooldown:
+            {
+                if (state.Counter != 0)
+                {
+                    state.Timer -= ctx.Dt;
+                    if (state.Timer > 0.0f)
+                    {
+                        return BTStatus::Failure;
+                    }
+                    state.Counter = 0;
+                }
+                if (node.FirstChild == kNone)
+                {
+                    return BTStatus::Failure;
+                }
+                const BTStatus status = TickNode(node.FirstChild, ctx);
+                if (status != BTStatus::Running)
+                {
+                    state.Counter = 1;
+                    state.Timer = node.Time;
+                    ResetSubtree(node.FirstChild, ctx.State);
+                }
+                return status;
+            }
+            case NodeKind::ConditionalGuard:
+            case NodeKind::CanSeeTarget:
+            {
+                bool pass = false;
+                if (node.Kind == NodeKind::ConditionalGuard)
+                {
+                    const BTBlackboard::Value* value = ctx.Blackboard.Find(node.Key);
+                    pass = value && *value == m_Values[node.Operand];
+                }
+                else
+                {
+                    pass = ctx.Agent.Perception && ctx.Agent.Perception->HasVisibleTarget;
+                }
+
+                if (!pass)
+                {
+                    if (node.FirstChild != kNone)
+                    {
+                        ResetSubtree(node.FirstChild, ctx.State);
+                    }
+                    return BTStatus::Failure;
+                }
+                return node.FirstChild == kNone ? BTStatus::Success : TickNode(node.FirstChild, ctx);
+            }
+            case NodeKind::Wait:
+            {
+                state.Timer += ctx.Dt;
+                if (state.Timer >= node.Time)
+                {
+                    state.Timer = 0.0f;
+                    return BTStatus::Success;
+                }
+                return BTStatus::Running;
+            }
+            case NodeKind::SetBlackboardValue:
+                ctx.Blackboard.Set(node.Key, m_Values[node.Operand]);
+                return BTStatus::Success;
+            case NodeKind::Log:
+                OLO_CORE_INFO("[BehaviorTree] {}", m_Strings[node.Operand]);
+                return BTStatus::Success;
+            case NodeKind::CheckBlackboardKey:
+            {
+                const BTBlackboard::Value* value = ctx.Blackboard.Find(node.Key);
+                if (!value)
+                {
+                    return BTStatus::Failure;
+                }
+                return node.Operand == kNone || *value == m_Values[node.Operand] ? BTStatus::Success : BTStatus::Failure;
+            }
+            case NodeKind::MoveTo:
+                return TickMoveTo(node, ctx);
+            case NodeKind::PlayAnimation:
+                if (!ctx.Agent.Animation)
+                {
+                    OLO_CORE_WARN("[BehaviorTree] BTPlayAnimation: Entity has no AnimationGraphComponent");
+                    return BTStatus::Failure;
+                }
+                ctx.Agent.Animation->Parameters.SetTrigger(m_Strings[node.Operand]);
+                return BTStatus::Success;
+        }
+        return BTStatus::Failure;
+    }
+
+    BTStatus BTCompiledTree::TickMoveTo(const Node& node, TickContext& ctx) const
+    {
+        // Mirrors BTMoveTo::Tick.
+        if (!ctx.Agent.Nav)
+        {
+            OLO_CORE_WARN("[BehaviorTree] BTMoveTo: Entity has no NavAgentComponent");
+            return BTStatus::Failure;
+        }
+        if (!ctx.Agent.Transform)
+        {
+            OLO_CORE_WARN("[BehaviorTree] BTMoveTo: Entity has no TransformComponent");
+            return BTStatus::Failure;
+        }
+
+        NavAgentComponent& nav = *ctx.Agent.Nav;
+        if (nav.m_HasTarget && nav.m_TargetUnreachable)
+        {
+            nav.m_HasTarget = false;
+            nav.m_HasPath = false;
+            nav.m_TargetUnreachable = false;
+            nav.m_PathCorners.clear();
+            nav.m_CurrentCornerIndex = 0;
+            return BTStatus::Failure;
+        }
+
+        if (!nav.m_HasTarget)
+        {
+            const auto* target = ctx.Blackboard.Find(node.Key);
+            if (!target || !std::holds_alternative<glm::vec3>(*target))
+            {
+                return BTStatus::Failure;
+            }
+            nav.m_TargetPosition = std::get<glm::vec3>(*target);
+            nav.m_HasTarget = true;
+            nav.m_HasPath = false;
+            nav.m_TargetUnreachable = false;
+        }
+
+        if (glm::length(ctx.Agent.Transform->Translation - nav.m_TargetPosition) <= nav.m_StoppingDistance)
+        {
+            nav.m_HasTarget = false;
+            return BTStatus::Success;
+        }
+        return BTStatus::Running;
+    }
+} // namespace OloEngine
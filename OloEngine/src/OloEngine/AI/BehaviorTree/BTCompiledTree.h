@@ -0,0 +1,139 @@
+#pragma once
+
+#include "OloEngine/AI/BehaviorTree/BTNode.h"
+#include "OloEngine/AI/BehaviorTree/BTBlackboard.h"
+#include "OloEngine/Core/Base.h"
+#include "OloEngine/Core/Ref.h"
+
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace OloEngine
+{
+    class BehaviorTreeAsset;
+    struct AnimationGraphComponent;
+    struct NavAgentComponent;
+    struct PerceptionComponent;
+    struct TransformComponent;
+
+    // One agent's state for one node of a BTCompiledTree. All-zero is the
+    // reset state, so resetting a subtree is a fill over a contiguous range.
+    struct BTNodeState
+    {
+        u32 Counter = 0;  // Sequence/Selector: running child's node index (0 = first); Repeater: iteration; Cooldown: on-cooldown flag
+        f32 Timer = 0.0f; // Wait: elapsed; Cooldown: time remaining
+    };
+
+    // The components built-in nodes act on, resolved by the caller before the
+    // tick. A compiled tick therefore does no registry lookups and touches only
+    // this agent's data, which is what lets AISystem tick agents in parallel.
+    // Null means the entity doesn't have the component.
+    struct BTAgentContext
+    {
+        NavAgentComponent* Nav = nullptr;
+        const TransformComponent* Transform = nullptr;
+        AnimationGraphComponent* Animation = nullptr;
+        const PerceptionComponent* Perception = nullptr;
+    };
+
+    // A BehaviorTreeAsset flattened for ticking: nodes in one pre-order array
+    // linked by index (first child / next sibling), node parameters inline,
+    // blackboard keys interned to BlackboardKey slots. The tree is immutable
+    // and shared by every agent running the asset; each agent owns a
+    // BTNodeState array of GetNodeCount() entries. Pre-order keeps every
+    // subtree contiguous, so a node's state range is [index, SubtreeEnd).
+    //
+    // Node semantics match the RefCounted node classes (BTSequence, BTWait, ...)
+    // one for one; a node's parameters come from the asset properties named
+    // after the class fields ("Duration", "RepeatCount", "ValueToSet", ...).
+    // Only the built-in node types have a compiled form; a graph with any
+    // other type fails to compile.
+    class BTCompiledTree : public RefCounted
+    {
+      public:
+        enum class NodeKind : u8
+        {
+            Sequence,
+            Selector,
+            Parallel,
+            Inverter,
+            Repeater,
+            Cooldown,
+            ConditionalGuard,
+            Wait,
+            SetBlackboardValue,
+            Log,
+            CheckBlackboardKey,
+            MoveTo,
+            PlayAnimation,
+            CanSeeTarget
+        };
+
+        static constexpr u32 kNone = ~0u;
+
+        enum NodeFlags : u8
+        {
+            kSucceedOnOne = 1 << 0, // Parallel SuccessPolicy RequireOne
+            kFailOnAll = 1 << 1,    // Parallel FailurePolicy RequireAll
+            kAbortOnFailure = 1 << 2,
+        };
+
+        struct Node
+        {
+            NodeKind Kind = NodeKind::Sequence;
+            u8 Flags = 0;
+            u32 FirstChild = kNone;
+            u32 NextSibling = kNone;
+            u32 SubtreeEnd = 0; // one past this subtree's last node
+            u32 ChildCount = 0;
+            BlackboardKey Key;
+            u32 Operand = kNone; // m_Values (ValueToSet / ExpectedValue) or m_Strings (Message / AnimationName)
+            u32 Count = 0;       // RepeatCount
+            f32 Time = 0.0f;     // Duration / CooldownTime
+        };
+
+        // Null (with the reason logged) if the graph has no root, a missing
+        // child, a cycle or a node type with no compiled form.
+        [[nodiscard]] static Ref<BTCompiledTree> Compile(const BehaviorTreeAsset& asset);
+        [[nodiscard]] static bool IsCompilable(std::string_view typeName);
+
+        // `state` must hold GetNodeCount() entries.
+        BTStatus Tick(std::span<BTNodeState> state, f32 dt, BTBlackboard& blackboard, const BTAgentContext& agent) const;
+        void Reset(std::span<BTNodeState> state) const;
+
+        [[nodiscard]] u32 GetNodeCount() const
+        {
+            return static_cast<u32>(m_Nodes.size());
+        }
+        [[nodiscard]] const std::vector<Node>& GetNodes() const
+        {
+            return m_Nodes;
+        }
+        // Whether any node of `kind` is in the tree (callers skip resolving
+        // components no node will read).
+        [[nodiscard]] bool Uses(NodeKind kind) const
+        {
+            return (m_KindMask & (1u << static_cast<u32>(kind))) != 0;
+        }
+
+      private:
+        struct TickContext
+        {
+            std::span<BTNodeState> State;
+            f32 Dt;
+            BTBlackboard& Blackboard;
+            const BTAgentContext& Agent;
+        };
+
+        BTStatus TickNode(u32 index, TickContext& ctx) const;
+        BTStatus TickMoveTo(const Node& node, TickContext& ctx) const;
+        void ResetSubtree(u32 index, std::span<BTNodeState> state) const;
+
+        std::vector<Node> m_Nodes;
+        std::vector<BTBlackboard::Value> m_Values;
+        std::vector<std::string> m_Strings;
+        u32 m_KindMask = 0;
+    };
+} // namespace OloEngine
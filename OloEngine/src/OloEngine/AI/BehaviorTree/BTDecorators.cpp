@@ -137,18 +137,8 @@ namespace OloEngine
     {
         OLO_PROFILE_FUNCTION();
 
-        if (!blackboard.Has(BlackboardKey))
-        {
-            if (!Children.empty())
-            {
-                Children[0]->Reset();
-            }
-            return BTStatus::Failure;
-        }
-
-        // Compare the variant values
-        auto const& allData = blackboard.GetAll();
-        if (auto it = allData.find(BlackboardKey); it == allData.end() || it->second != ExpectedValue)
+        // Missing key or a different value (variant compare: type and value)
+        if (const auto* value = blackboard.Find(BlackboardKey.Key); !value || *value != ExpectedValue)
         {
             if (!Children.empty())
             {
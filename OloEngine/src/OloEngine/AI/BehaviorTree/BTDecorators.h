@@ -47,7 +47,7 @@ namespace OloEngine
     class BTConditionalGuard : public BTNode
     {
       public:
-        std::string BlackboardKey;
+        NamedBlackboardKey BlackboardKey;
         BTBlackboard::Value ExpectedValue;
 
         BTStatus Tick(f32 dt, BTBlackboard& blackboard, Entity entity) override;
@@ -33,7 +33,7 @@ namespace OloEngine
     {
         OLO_PROFILE_FUNCTION();
 
-        blackboard.Set(Key, ValueToSet);
+        blackboard.Set(Key.Key, ValueToSet);
         return BTStatus::Success;
     }
 
@@ -53,17 +53,13 @@ namespace OloEngine
     {
         OLO_PROFILE_FUNCTION();
 
-        if (!blackboard.Has(Key))
+        const BTBlackboard::Value* actual = blackboard.Find(Key.Key);
+        if (!actual)
             return BTStatus::Failure;
 
         if (ExpectedValue.has_value())
         {
-            auto actual = blackboard.GetRaw(Key);
-            if (!actual.has_value())
-            {
-                return BTStatus::Failure;
-            }
-            return (actual.value() == ExpectedValue.value()) ? BTStatus::Success : BTStatus::Failure;
+            return (*actual == ExpectedValue.value()) ? BTStatus::Success : BTStatus::Failure;
         }
 
         return BTStatus::Success;
@@ -105,13 +101,13 @@ namespace OloEngine
         // Set target from blackboard if we don't have one yet
         if (!nav.m_HasTarget)
         {
-            auto raw = blackboard.GetRaw(TargetBlackboardKey);
-            if (!raw.has_value() || !std::holds_alternative<glm::vec3>(raw.value()))
+            const auto* target = blackboard.Find(TargetBlackboardKey.Key);
+            if (!target || !std::holds_alternative<glm::vec3>(*target))
             {
                 return BTStatus::Failure;
             }
 
-            nav.m_TargetPosition = std::get<glm::vec3>(raw.value());
+            nav.m_TargetPosition = std::get<glm::vec3>(*target);
             nav.m_HasTarget = true;
             nav.m_HasPath = false;
             nav.m_TargetUnreachable = false; // fresh target: clear any stale terminal flag
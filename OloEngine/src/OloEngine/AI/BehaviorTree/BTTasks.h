@@ -25,7 +25,7 @@ namespace OloEngine
     class BTSetBlackboardValue : public BTNode
     {
       public:
-        std::string Key;
+        NamedBlackboardKey Key;
         BTBlackboard::Value ValueToSet;
 
         BTStatus Tick(f32 dt, BTBlackboard& blackboard, Entity entity) override;
@@ -44,7 +44,7 @@ namespace OloEngine
     class BTCheckBlackboardKey : public BTNode
     {
       public:
-        std::string Key;
+        NamedBlackboardKey Key;
         std::optional<BTBlackboard::Value> ExpectedValue;
 
         BTStatus Tick(f32 dt, BTBlackboard& blackboard, Entity entity) override;
@@ -54,7 +54,7 @@ namespace OloEngine
     class BTMoveTo : public BTNode
     {
       public:
-        std::string TargetBlackboardKey;
+        NamedBlackboardKey TargetBlackboardKey;
 
         BTStatus Tick(f32 dt, BTBlackboard& blackboard, Entity entity) override;
     };
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "OloEngine/AI/BehaviorTree/BTCompiledTree.h"
 #include "OloEngine/AI/BehaviorTree/BTNode.h"
 #include "OloEngine/Asset/Asset.h"
 #include "OloEngine/Asset/AssetTypes.h"
@@ -43,8 +44,10 @@ namespace OloEngine
         {
             return m_Nodes;
         }
+        // Mutable access: the compiled form is dropped and rebuilt on next use.
         std::vector<BTNodeData>& GetNodes()
         {
+            InvalidateCompiledTree();
             return m_Nodes;
         }
 
@@ -55,11 +58,13 @@ namespace OloEngine
         void SetRootNodeID(UUID id)
         {
             m_RootNodeID = id;
+            InvalidateCompiledTree();
         }
 
         void AddNode(BTNodeData node)
         {
             m_Nodes.push_back(std::move(node));
+            InvalidateCompiledTree();
         }
 
         const BTNodeData* FindNode(UUID id) const
@@ -74,11 +79,32 @@ namespace OloEngine
             return nullptr;
         }
 
+        // The flat, key-interned form AISystem ticks, compiled on first use
+        // (BehaviorTreeSerializer compiles it at load). Null if the graph
+        // doesn't compile; see BTCompiledTree::Compile.
+        const Ref<BTCompiledTree>& GetCompiledTree()
+        {
+            if (!m_CompiledTree && !m_CompileFailed)
+            {
+                m_CompiledTree = BTCompiledTree::Compile(*this);
+                m_CompileFailed = !m_CompiledTree;
+            }
+            return m_CompiledTree;
+        }
+
         // Blackboard key definitions (name -> type hint string)
         std::unordered_map<std::string, std::string> BlackboardKeyDefs;
 
       private:
+        void InvalidateCompiledTree()
+        {
+            m_CompiledTree = nullptr;
+            m_CompileFailed = false;
+        }
+
         std::vector<BTNodeData> m_Nodes;
         UUID m_RootNodeID = 0;
+        Ref<BTCompiledTree> m_CompiledTree;
+        bool m_CompileFailed = false;
     };
 } // namespace OloEngine
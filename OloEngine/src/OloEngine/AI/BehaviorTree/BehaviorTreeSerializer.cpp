@@ -265,6 +265,13 @@ namespace OloEngine
             }
         }
 
+        // Flatten the graph and intern its blackboard keys now, on the loading
+        // thread, rather than on the first AI tick that binds it.
+        if (!btAsset->GetCompiledTree())
+        {
+            OLO_CORE_WARN("BehaviorTreeSerializer - Tree has no compiled form; agents using it won't tick");
+        }
+
         return true;
     }
 } // namespace OloEngine
@@ -35,7 +35,8 @@ namespace OloEngine
     //
     // So this one is deliberately narrow: it stores nothing but positions and
     // hands back INDICES into the caller's own SoA arrays, which is what makes
-    // the flocking inner loop a pair of contiguous array reads.
+    // the flocking inner loop a pair of contiguous array reads. PerceptionSystem
+    // reuses it over its packed perceptible cache for the same reason.
     //
     // Layout is CSR (counting sort), not a linked list: pass 1 counts per
     // bucket, a prefix sum gives the bucket offsets, pass 2 scatters item
@@ -56,8 +57,9 @@ namespace OloEngine
     // bit-identical sums run to run, which is what lets the steering phase move
     // to a worker thread without changing results.
     //
-    // NOT thread-safe: one instance is owned by one Scene and is rebuilt and
-    // queried by the same system within a single scheduler node.
+    // NOT thread-safe to rebuild: one instance is owned by one Scene and is
+    // rebuilt and queried by the same system within a single scheduler node.
+    // Queries are const, so once rebuilt it may be queried from many workers.
     // =========================================================================
     class FlockSpatialHash
     {
@@ -1,30 +1,66 @@
 #include "OloEnginePCH.h"
 #include "OloEngine/AI/GOAP/GoapAgent.h"
+#include "OloEngine/Task/Scheduler.h"
 
 #include <algorithm>
 
 namespace OloEngine
 {
-    bool GoapAgent::SelectGoalAndPlan()
+    const Ref<GoapDomain>& GoapAgent::Domain()
+    {
+        if (!m_DomainResolved || !(m_DomainSettings == PlannerSettings))
+        {
+            m_Domain = GoapDomain::Acquire(m_Actions, PlannerSettings);
+            m_DomainSettings = PlannerSettings;
+            m_DomainResolved = true;
+        }
+        return m_Domain;
+    }
+
+    std::vector<const GoapGoal*> GoapAgent::OrderedGoals() const
     {
-        // Visit goals strongest-first; the first relevant, not-yet-satisfied goal
-        // that yields a plan wins. Ties in priority keep author order.
         std::vector<const GoapGoal*> ordered;
         ordered.reserve(m_Goals.size());
         for (const auto& goal : m_Goals)
-            ordered.push_back(&goal);
+        {
+            if (goal.CheckValid(m_WorldState) && !goal.IsSatisfiedBy(m_WorldState))
+                ordered.push_back(&goal);
+        }
         std::stable_sort(ordered.begin(), ordered.end(),
                          [](const GoapGoal* a, const GoapGoal* b)
                          { return a->Priority > b->Priority; });
+        return ordered;
+    }
 
-        for (const GoapGoal* goal : ordered)
+    u64 GoapAgent::UsableActionMask() const
+    {
+        // IsUsable hooks are game code: sampled here, on the agent's thread,
+        // never from a planning task.
+        u64 usable = 0;
+        for (sizet a = 0; a < m_Actions.size() && a < GoapDomain::kMaxActions; ++a)
         {
-            if (!goal->CheckValid(m_WorldState))
-                continue;
-            if (goal->IsSatisfiedBy(m_WorldState))
-                continue;
+            if (m_Actions[a].CheckUsable())
+                usable |= 1ull << a;
+        }
+        return usable;
+    }
+
+    bool GoapAgent::SelectGoalAndPlan()
+    {
+        // Visit goals strongest-first; the first relevant, not-yet-satisfied goal
+        // that yields a plan wins.
+        const Ref<GoapDomain>& domain = Domain();
+        const u64 usable = domain ? UsableActionMask() : 0;
+
+        for (const GoapGoal* goal : OrderedGoals())
+        {
+            GoapPlan plan;
+            GoapDomain::Query query;
+            if (domain && domain->MakeQuery(m_WorldState, goal->DesiredState, usable, query))
+                plan = GoapDomain::MakePlan(domain->Plan(query), m_Actions);
+            else
+                plan = GoapPlanner::Plan(m_WorldState, *goal, m_Actions, PlannerSettings);
 
-            GoapPlan plan = GoapPlanner::Plan(m_WorldState, *goal, m_Actions, PlannerSettings);
             if (plan.Found && !plan.Steps.empty())
             {
                 m_Plan = std::move(plan);
@@ -41,6 +77,83 @@ namespace OloEngine
         return false;
     }
 
+    void GoapAgent::RequestBackgroundPlan()
+    {
+        const Ref<GoapDomain>& domain = Domain();
+        if (!domain)
+        {
+            SelectGoalAndPlan();
+            return;
+        }
+
+        struct Candidate
+        {
+            std::string GoalName;
+            GoapDomain::Query Query;
+        };
+        std::vector<Candidate> candidates;
+        const u64 usable = UsableActionMask();
+
+        for (const GoapGoal* goal : OrderedGoals())
+        {
+            Candidate candidate{ goal->Name };
+            if (!domain->MakeQuery(m_WorldState, goal->DesiredState, usable, candidate.Query))
+            {
+                SelectGoalAndPlan(); // a goal the domain can't express: plan it all inline
+                return;
+            }
+
+            // While every stronger goal was answered from the cache, this one
+            // can be too; after the first miss the task has to search anyway.
+            GoapDomain::PlanResult cached;
+            if (candidates.empty() && domain->TryGetCached(candidate.Query, cached))
+            {
+                if (cached.Found && !cached.Actions.empty())
+                {
+                    AdoptPlan(candidate.GoalName, cached);
+                    return;
+                }
+                continue;
+            }
+            candidates.push_back(std::move(candidate));
+        }
+
+        m_Plan = {};
+        m_CurrentGoal.clear();
+        m_Step = 0;
+        if (candidates.empty())
+            return;
+
+        // Update only collects a task once it has finished, and with no
+        // started workers a launched task never runs: plan inline instead.
+        if (LowLevelTasks::FScheduler::Get().GetNumWorkers() == 0)
+        {
+            SelectGoalAndPlan();
+            return;
+        }
+
+        m_PendingPlan = Tasks::Launch(
+            "GoapAgent::Plan",
+            [domain, candidates = std::move(candidates)]() -> BackgroundPlan
+            {
+                for (const auto& candidate : candidates)
+                {
+                    GoapDomain::PlanResult result = domain->Plan(candidate.Query);
+                    if (result.Found && !result.Actions.empty())
+                        return BackgroundPlan{ candidate.GoalName, std::move(result) };
+                }
+                return BackgroundPlan{};
+            },
+            Tasks::ETaskPriority::BackgroundNormal);
+    }
+
+    void GoapAgent::AdoptPlan(const std::string& goalName, const GoapDomain::PlanResult& result)
+    {
+        m_Plan = GoapDomain::MakePlan(result, m_Actions);
+        m_CurrentGoal = goalName;
+        m_Step = 0;
+    }
+
     const GoapGoal* GoapAgent::FindGoal(const std::string& name) const
     {
         for (const auto& goal : m_Goals)
@@ -51,13 +164,30 @@ namespace OloEngine
         return nullptr;
     }
 
-    void GoapAgent::Update(f32 dt)
+    void GoapAgent::Update(f32 dt, bool planInBackground)
     {
         OLO_PROFILE_FUNCTION();
 
         if (m_Sensor)
             m_Sensor(m_WorldState);
 
+        // Collect a finished background plan. The checks below treat it like
+        // any other plan, so one made stale by this tick's sensor pass is
+        // dropped or replanned rather than executed. Until the task finishes
+        // the agent idles: GetResult() on a running task would block this
+        // thread (or run the search inline), which is what the task was for.
+        const bool collected = m_PendingPlan.IsValid();
+        if (collected)
+        {
+            if (!m_PendingPlan.IsCompleted())
+                return;
+
+            BackgroundPlan pending = std::move(m_PendingPlan.GetResult());
+            m_PendingPlan = {};
+            if (pending.Result.Found && !pending.Result.Actions.empty())
+                AdoptPlan(pending.GoalName, pending.Result);
+        }
+
         // The sensor may have changed the world so the active plan's goal is
         // already met or no longer relevant (or the goal was removed). Drop the
         // in-flight plan and reconsider rather than finishing a now-pointless one.
@@ -68,9 +198,12 @@ namespace OloEngine
                 m_NeedsReplan = true;
         }
 
-        if (m_NeedsReplan || !HasPlan())
+        if (m_NeedsReplan || (!HasPlan() && !collected))
         {
-            SelectGoalAndPlan();
+            if (planInBackground)
+                RequestBackgroundPlan();
+            else
+                SelectGoalAndPlan();
             m_NeedsReplan = false;
         }
 
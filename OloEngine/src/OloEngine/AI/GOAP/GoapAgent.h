@@ -1,11 +1,13 @@
 #pragma once
 
 #include "OloEngine/AI/GOAP/GoapAction.h"
+#include "OloEngine/AI/GOAP/GoapDomain.h"
 #include "OloEngine/AI/GOAP/GoapGoal.h"
 #include "OloEngine/AI/GOAP/GoapPlanner.h"
 #include "OloEngine/AI/GOAP/GoapWorldState.h"
 #include "OloEngine/Core/Base.h"
 #include "OloEngine/Core/Ref.h"
+#include "OloEngine/Task/Task.h"
 
 #include <functional>
 #include <string>
@@ -23,6 +25,10 @@ namespace OloEngine
     // or a blackboard directly. Game code wires those in through the action
     // hooks (OnEnter/Perform/IsUsable closures) and an optional Sensor that
     // refreshes the world state from the real world each tick.
+    //
+    // Planning goes through a GoapDomain acquired for the action set, so
+    // agents with the same actions share its plan cache; an action set the
+    // domain can't pack plans with GoapPlanner::Plan instead.
     class GoapAgent : public RefCounted
     {
       public:
@@ -36,6 +42,7 @@ namespace OloEngine
         void AddAction(GoapAction action)
         {
             m_Actions.push_back(std::move(action));
+            m_DomainResolved = false;
             Abort(); // a new option may change the best plan; re-evaluate
         }
         void AddGoal(GoapGoal goal)
@@ -46,6 +53,7 @@ namespace OloEngine
         void SetActions(std::vector<GoapAction> actions)
         {
             m_Actions = std::move(actions);
+            m_DomainResolved = false;
             Abort();
         }
         void SetGoals(std::vector<GoapGoal> goals)
@@ -72,12 +80,18 @@ namespace OloEngine
             m_WorldState.Set(key, std::move(value));
         }
 
-        // Advance the brain by one tick.
-        void Update(f32 dt);
+        // Advance the brain by one tick. With `planInBackground` (AISystem's
+        // mode) a replan that misses the domain's plan cache runs as a task and
+        // its result is picked up by the first Update after the task finishes;
+        // the agent idles, neither replanning nor executing, until then. Update
+        // never waits on the task. Otherwise planning runs inline and the new
+        // plan's first step executes at once.
+        void Update(f32 dt, bool planInBackground = false);
 
         // Drop the current plan and force a fresh plan on the next Update.
         void Abort()
         {
+            m_PendingPlan = {}; // its action indices may no longer apply
             m_Plan = {};
             m_Step = 0;
             m_CurrentGoal.clear();
@@ -106,6 +120,13 @@ namespace OloEngine
         {
             return m_Plan.Found && !m_Plan.Steps.empty();
         }
+        // True between a background replan request and the Update that collects it.
+        [[nodiscard]] bool IsPlanPending() const
+        {
+            return m_PendingPlan.IsValid();
+        }
+        // The compiled domain planning uses, or null if the actions don't pack.
+        [[nodiscard]] const Ref<GoapDomain>& Domain();
         [[nodiscard]] const std::vector<GoapAction>& Actions() const
         {
             return m_Actions;
@@ -125,10 +146,25 @@ namespace OloEngine
         GoapPlannerSettings PlannerSettings;
 
       private:
+        struct BackgroundPlan
+        {
+            std::string GoalName;
+            GoapDomain::PlanResult Result;
+        };
+
+        // Relevant goals strongest-first; ties in priority keep author order.
+        [[nodiscard]] std::vector<const GoapGoal*> OrderedGoals() const;
+        [[nodiscard]] u64 UsableActionMask() const;
+
         // Choose the best relevant, unsatisfied goal and plan toward it. Returns
         // true and sets up m_Plan/m_CurrentGoal/m_Step when a plan is found.
         bool SelectGoalAndPlan();
 
+        // SelectGoalAndPlan with the search moved to a task. Goals the plan
+        // cache already answers are settled here; the rest go to the task.
+        void RequestBackgroundPlan();
+        void AdoptPlan(const std::string& goalName, const GoapDomain::PlanResult& result);
+
         // The goal the active plan is pursuing, or nullptr if it no longer exists.
         [[nodiscard]] const GoapGoal* FindGoal(const std::string& name) const;
 
@@ -142,5 +178,10 @@ namespace OloEngine
         std::string m_CurrentGoal;
         bool m_NeedsReplan = true;
         u32 m_GoalsAchieved = 0;
+
+        Ref<GoapDomain> m_Domain;
+        GoapPlannerSettings m_DomainSettings;
+        bool m_DomainResolved = false;
+        Tasks::TTask<BackgroundPlan> m_PendingPlan;
     };
 } // namespace OloEngine
@@ -0,0 +1,487 @@
+#include "OloEnginePCH.h"
+#include "OloEngine/AI/GOAP/GoapDomain.h"
+#include "OloEngine/Threading/UniqueLock.h"
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <queue>
+
+namespace OloEngine
+{
+    namespace
+    {
+        // Domains Acquire has handed out, by planning fingerprint. Cleared
+        // wholesale when it grows past the cap; agents keep their own Ref.
+        constexpr sizet kMaxSharedDomains = 256;
+
+        struct SearchNode
+        {
+            GoapPackedState State;
+            f32 G = 0.0f;
+            i32 Parent = -1;
+            i32 ActionIdx = -1;
+            u32 Depth = 0;
+        };
+
+        // Same ordering as the GoapWorldState search in GoapPlanner.cpp, so
+        // both forms expand in the same order and pick the same plan on ties.
+        struct OpenEntry
+        {
+            f32 F;
+            f32 G;
+            i32 NodeIdx;
+        };
+
+        struct OpenGreater
+        {
+            bool operator()(const OpenEntry& a, const OpenEntry& b) const
+            {
+                if (a.F > b.F)
+                    return true;
+                if (a.F < b.F)
+                    return false;
+                return a.G > b.G;
+            }
+        };
+
+        struct PackedStateHash
+        {
+            sizet operator()(const GoapPackedState& s) const
+            {
+                return static_cast<sizet>(s.Hash());
+            }
+        };
+
+        u64 Mix(u64 hash, u64 word)
+        {
+            hash = (hash ^ word) * 0xFF51AFD7ED558CCDull;
+            return hash ^ (hash >> 33);
+        }
+
+        bool Matches(const GoapPackedState& state, const GoapPackedState& mask, const GoapPackedState& value, u32 wordCount)
+        {
+            for (u32 w = 0; w < wordCount; ++w)
+            {
+                if ((state.Words[w] & mask.Words[w]) != value.Words[w])
+                    return false;
+            }
+            return true;
+        }
+
+        void AppendBytes(std::string& out, const void* data, sizet size)
+        {
+            out.append(static_cast<const char*>(data), size);
+        }
+
+        void AppendFacts(std::string& out, char tag, const GoapWorldState& state)
+        {
+            out.push_back(tag);
+            for (const auto& fact : state.GetFacts())
+            {
+                out.append(fact.Key);
+                out.push_back('\0');
+                out.push_back(static_cast<char>(fact.Val.index()));
+                const i32 value = std::holds_alternative<bool>(fact.Val) ? static_cast<i32>(std::get<bool>(fact.Val)) : std::get<i32>(fact.Val);
+                AppendBytes(out, &value, sizeof(value));
+            }
+        }
+    } // namespace
+
+    u64 GoapPackedState::Hash() const
+    {
+        u64 hash = 0x9E3779B97F4A7C15ull;
+        for (u64 word : Words)
+            hash = Mix(hash, word);
+        return hash;
+    }
+
+    sizet GoapDomain::CacheKeyHash::operator()(const CacheKey& key) const
+    {
+        u64 hash = key.Start.Hash();
+        for (u32 w = 0; w < GoapPackedState::kWords; ++w)
+        {
+            hash = Mix(hash, key.GoalMask.Words[w]);
+            hash = Mix(hash, key.GoalValue.Words[w]);
+        }
+        return static_cast<sizet>(Mix(hash, key.Usable));
+    }
+
+    i32 GoapDomain::EncodeValue(const KeySlot& slot, const GoapWorldState::Value& value)
+    {
+        if (slot.Type == KeyType::Bool)
+        {
+            const bool* b = std::get_if<bool>(&value);
+            return b ? (*b ? 2 : 1) : 0;
+        }
+
+        const i32* i = std::get_if<i32>(&value);
+        if (!i)
+            return 0;
+        auto it = std::lower_bound(slot.Constants.begin(), slot.Constants.end(), *i);
+        if (it == slot.Constants.end() || *it != *i)
+            return -1;
+        return 2 + static_cast<i32>(it - slot.Constants.begin());
+    }
+
+    void GoapDomain::WriteField(GoapPackedState& state, const KeySlot& slot, u64 code)
+    {
+        const u64 fieldMask = ((1ull << slot.Width) - 1) << slot.Shift;
+        state.Words[slot.Word] = (state.Words[slot.Word] & ~fieldMask) | (code << slot.Shift);
+    }
+
+    void GoapDomain::WriteMaskedField(GoapPackedState& mask, GoapPackedState& value, const KeySlot& slot, u64 code)
+    {
+        mask.Words[slot.Word] |= ((1ull << slot.Width) - 1) << slot.Shift;
+        WriteField(value, slot, code);
+    }
+
+    Ref<GoapDomain> GoapDomain::Compile(const std::vector<GoapAction>& actions, const GoapPlannerSettings& settings)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        if (actions.size() > kMaxActions)
+            return nullptr;
+
+        auto domain = Ref<GoapDomain>::Create();
+        domain->m_Settings = settings;
+
+        // Intern every key the actions mention, in first-seen order, and
+        // collect the integer constants each one is compared with or set to.
+        auto intern = [&domain](const GoapWorldState& facts) -> bool
+        {
+            for (const auto& fact : facts.GetFacts())
+            {
+                const KeyType type = std::holds_alternative<bool>(fact.Val) ? KeyType::Bool : KeyType::Int;
+                auto [it, inserted] = domain->m_SlotByKey.try_emplace(fact.Key, static_cast<u32>(domain->m_Slots.size()));
+                if (inserted)
+                {
+                    domain->m_Slots.push_back(KeySlot{ type });
+                }
+                KeySlot& slot = domain->m_Slots[it->second];
+                if (slot.Type != type)
+                    return false;
+                if (type == KeyType::Int)
+                    slot.Constants.push_back(std::get<i32>(fact.Val));
+            }
+            return true;
+        };
+        for (const auto& action : actions)
+        {
+            if (!intern(action.Preconditions) || !intern(action.Effects))
+                return nullptr;
+        }
+
+        // Lay the fields out word by word; no field straddles a word.
+        u32 word = 0;
+        u32 shift = 0;
+        for (auto& slot : domain->m_Slots)
+        {
+            u32 codes = 3; // absent, false, true
+            if (slot.Type == KeyType::Int)
+            {
+                std::sort(slot.Constants.begin(), slot.Constants.end());
+                slot.Constants.erase(std::unique(slot.Constants.begin(), slot.Constants.end()), slot.Constants.end());
+                codes = 2 + static_cast<u32>(slot.Constants.size()); // absent, other, constants
+            }
+            slot.Width = static_cast<u32>(std::bit_width(codes - 1));
+            if (shift + slot.Width > 64)
+            {
+                ++word;
+                shift = 0;
+            }
+            if (word >= GoapPackedState::kWords)
+                return nullptr;
+            slot.Word = word;
+            slot.Shift = shift;
+            shift += slot.Width;
+            domain->m_BitCount += slot.Width;
+        }
+        domain->m_WordCount = domain->m_Slots.empty() ? 0 : word + 1;
+
+        f32 minStepCost = std::numeric_limits<f32>::max();
+        domain->m_Actions.reserve(actions.size());
+        for (const auto& action : actions)
+        {
+            CompiledAction compiled;
+            compiled.Cost = action.Cost < 0.0f ? 0.0f : action.Cost;
+            minStepCost = std::min(minStepCost, compiled.Cost);
+            for (const auto& fact : action.Preconditions.GetFacts())
+            {
+                const KeySlot& slot = domain->m_Slots[domain->m_SlotByKey.at(fact.Key)];
+                WriteMaskedField(compiled.PreMask, compiled.PreValue, slot, static_cast<u64>(EncodeValue(slot, fact.Val)));
+            }
+            for (const auto& fact : action.Effects.GetFacts())
+            {
+                const KeySlot& slot = domain->m_Slots[domain->m_SlotByKey.at(fact.Key)];
+                WriteMaskedField(compiled.EffectMask, compiled.EffectValue, slot, static_cast<u64>(EncodeValue(slot, fact.Val)));
+            }
+            domain->m_Actions.push_back(compiled);
+        }
+        // See GoapPlanner::Plan for why the heuristic is scaled by the cheapest step.
+        domain->m_HeuristicScale = (actions.empty() || minStepCost <= 0.0f) ? 0.0f : minStepCost;
+
+        return domain;
+    }
+
+    Ref<GoapDomain> GoapDomain::Acquire(const std::vector<GoapAction>& actions, const GoapPlannerSettings& settings)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        // The planning fingerprint: settings, then every action's cost,
+        // preconditions and effects. Names and hooks don't affect planning.
+        std::string fingerprint;
+        AppendBytes(fingerprint, &settings.MaxIterations, sizeof(settings.MaxIterations));
+        AppendBytes(fingerprint, &settings.MaxPlanLength, sizeof(settings.MaxPlanLength));
+        AppendBytes(fingerprint, &settings.HeuristicWeight, sizeof(settings.HeuristicWeight));
+        for (const auto& action : actions)
+        {
+            fingerprint.push_back('A');
+            AppendBytes(fingerprint, &action.Cost, sizeof(action.Cost));
+            AppendFacts(fingerprint, 'P', action.Preconditions);
+            AppendFacts(fingerprint, 'E', action.Effects);
+        }
+
+        static FMutex s_Mutex;
+        static std::unordered_map<std::string, Ref<GoapDomain>> s_Domains;
+
+        TUniqueLock<FMutex> lock(s_Mutex);
+        if (auto it = s_Domains.find(fingerprint); it != s_Domains.end())
+            return it->second;
+
+        Ref<GoapDomain> domain = Compile(actions, settings);
+        if (domain)
+        {
+            if (s_Domains.size() >= kMaxSharedDomains)
+                s_Domains.clear();
+            s_Domains.emplace(std::move(fingerprint), domain);
+        }
+        return domain;
+    }
+
+    bool GoapDomain::MakeQuery(const GoapWorldState& start, const GoapWorldState& goal, u64 usable, Query& outQuery) const
+    {
+        outQuery = {};
+        outQuery.Usable = m_Actions.size() >= 64 ? usable : usable & ((1ull << m_Actions.size()) - 1);
+        if (start.Satisfies(goal))
+        {
+            outQuery.Satisfied = true;
+            return true;
+        }
+
+        for (const auto& fact : start.GetFacts())
+        {
+            if (auto it = m_SlotByKey.find(fact.Key); it != m_SlotByKey.end())
+            {
+                const KeySlot& slot = m_Slots[it->second];
+                const i32 code = EncodeValue(slot, fact.Val);
+                WriteField(outQuery.Start, slot, static_cast<u64>(code < 0 ? 1 : code));
+            }
+        }
+
+        for (const auto& fact : goal.GetFacts())
+        {
+            auto it = m_SlotByKey.find(fact.Key);
+            if (it == m_SlotByKey.end())
+            {
+                // No action touches it: it holds throughout or never does.
+                const auto current = start.Get(fact.Key);
+                if (!current || !(*current == fact.Val))
+                    outQuery.Unreachable = true;
+                continue;
+            }
+
+            const KeySlot& slot = m_Slots[it->second];
+            i32 code = EncodeValue(slot, fact.Val);
+            if (code == 0)
+                return false;
+            if (code < 0)
+            {
+                // A constant no action writes: only the start value can match.
+                const auto current = start.Get(fact.Key);
+                if (!current || !(*current == fact.Val))
+                {
+                    outQuery.Unreachable = true;
+                    continue;
+                }
+                code = 1;
+            }
+            WriteMaskedField(outQuery.GoalMask, outQuery.GoalValue, slot, static_cast<u64>(code));
+            outQuery.GoalFields.push_back({ slot.Word, ((1ull << slot.Width) - 1) << slot.Shift, static_cast<u64>(code) << slot.Shift });
+        }
+        return true;
+    }
+
+    GoapDomain::CacheKey GoapDomain::MakeCacheKey(const Query& query)
+    {
+        return CacheKey{ query.Start, query.GoalMask, query.GoalValue, query.Usable };
+    }
+
+    bool GoapDomain::TryGetCached(const Query& query, PlanResult& outResult) const
+    {
+        if (query.Satisfied || query.Unreachable)
+        {
+            outResult = {};
+            outResult.Found = query.Satisfied;
+            return true;
+        }
+
+        TUniqueLock<FMutex> lock(m_CacheMutex);
+        if (auto it = m_Cache.find(MakeCacheKey(query)); it != m_Cache.end())
+        {
+            outResult = it->second;
+            ++m_CacheHits;
+            return true;
+        }
+        return false;
+    }
+
+    GoapDomain::PlanResult GoapDomain::Plan(const Query& query, GoapPlanner::Stats* outStats) const
+    {
+        PlanResult result;
+        if (TryGetCached(query, result))
+        {
+            if (outStats)
+                *outStats = {};
+            return result;
+        }
+
+        ++m_CacheMisses;
+        result = Search(query, outStats);
+
+        TUniqueLock<FMutex> lock(m_CacheMutex);
+        if (m_Cache.size() >= kMaxCachedPlans)
+            m_Cache.clear();
+        m_Cache.emplace(MakeCacheKey(query), result);
+        return result;
+    }
+
+    GoapDomain::PlanResult GoapDomain::Search(const Query& query, GoapPlanner::Stats* outStats) const
+    {
+        OLO_PROFILE_FUNCTION();
+
+        PlanResult result;
+        GoapPlanner::Stats stats;
+
+        if (query.Satisfied || query.Unreachable)
+        {
+            result.Found = query.Satisfied;
+            if (outStats)
+                *outStats = stats;
+            return result;
+        }
+
+        const auto heuristic = [&](const GoapPackedState& s) -> f32
+        {
+            u32 unsatisfied = 0;
+            for (const auto& field : query.GoalFields)
+                unsatisfied += (s.Words[field.Word] & field.Mask) != field.Value ? 1u : 0u;
+            return static_cast<f32>(unsatisfied) * m_Settings.HeuristicWeight * m_HeuristicScale;
+        };
+
+        std::vector<SearchNode> arena;
+        arena.reserve(64);
+        std::unordered_map<GoapPackedState, f32, PackedStateHash> bestG;
+        bestG.reserve(64);
+        std::priority_queue<OpenEntry, std::vector<OpenEntry>, OpenGreater> open;
+
+        arena.push_back(SearchNode{ query.Start });
+        bestG[query.Start] = 0.0f;
+        open.push(OpenEntry{ heuristic(query.Start), 0.0f, 0 });
+
+        i32 goalNodeIdx = -1;
+        u32 iterations = 0;
+        while (!open.empty())
+        {
+            if (iterations >= m_Settings.MaxIterations)
+            {
+                stats.HitIterationCap = true;
+                break;
+            }
+
+            const OpenEntry top = open.top();
+            open.pop();
+            const SearchNode current = arena[static_cast<sizet>(top.NodeIdx)];
+
+            if (auto it = bestG.find(current.State); it != bestG.end() && top.G > it->second)
+                continue;
+
+            ++iterations;
+            ++stats.NodesExpanded;
+
+            if (Matches(current.State, query.GoalMask, query.GoalValue, m_WordCount))
+            {
+                goalNodeIdx = top.NodeIdx;
+                break;
+            }
+            if (current.Depth >= m_Settings.MaxPlanLength)
+                continue;
+
+            for (u64 usable = query.Usable; usable != 0; usable &= usable - 1)
+            {
+                const i32 a = std::countr_zero(usable);
+                const CompiledAction& action = m_Actions[static_cast<sizet>(a)];
+                if (!Matches(current.State, action.PreMask, action.PreValue, m_WordCount))
+                    continue;
+
+                GoapPackedState next = current.State;
+                for (u32 w = 0; w < m_WordCount; ++w)
+                    next.Words[w] = (next.Words[w] & ~action.EffectMask.Words[w]) | action.EffectValue.Words[w];
+
+                const f32 tentativeG = current.G + action.Cost;
+                auto [it, inserted] = bestG.try_emplace(next, tentativeG);
+                if (!inserted)
+                {
+                    if (!(tentativeG < it->second))
+                        continue;
+                    it->second = tentativeG;
+                }
+
+                const i32 childIdx = static_cast<i32>(arena.size());
+                arena.push_back(SearchNode{ next, tentativeG, top.NodeIdx, a, current.Depth + 1 });
+                open.push(OpenEntry{ tentativeG + heuristic(next), tentativeG, childIdx });
+                ++stats.NodesGenerated;
+            }
+        }
+
+        if (goalNodeIdx >= 0)
+        {
+            result.Found = true;
+            result.TotalCost = arena[static_cast<sizet>(goalNodeIdx)].G;
+            for (i32 idx = goalNodeIdx; arena[static_cast<sizet>(idx)].Parent >= 0; idx = arena[static_cast<sizet>(idx)].Parent)
+                result.Actions.push_back(static_cast<u32>(arena[static_cast<sizet>(idx)].ActionIdx));
+            std::reverse(result.Actions.begin(), result.Actions.end());
+        }
+
+        if (outStats)
+            *outStats = stats;
+        return result;
+    }
+
+    GoapPlan GoapDomain::MakePlan(const PlanResult& result, const std::vector<GoapAction>& actions)
+    {
+        GoapPlan plan;
+        plan.Found = result.Found;
+        plan.TotalCost = result.TotalCost;
+        plan.Steps.reserve(result.Actions.size());
+        for (u32 index : result.Actions)
+        {
+            GoapAction step = actions[index];
+            step.ResetRuntime();
+            plan.Steps.push_back(std::move(step));
+        }
+        return plan;
+    }
+
+    GoapDomain::CacheStats GoapDomain::GetCacheStats() const
+    {
+        TUniqueLock<FMutex> lock(m_CacheMutex);
+        return CacheStats{ m_CacheHits.load(), m_CacheMisses.load(), static_cast<u32>(m_Cache.size()) };
+    }
+
+    void GoapDomain::ClearCache()
+    {
+        TUniqueLock<FMutex> lock(m_CacheMutex);
+        m_Cache.clear();
+    }
+} // namespace OloEngine
@@ -0,0 +1,194 @@
+#pragma once
+
+#include "OloEngine/AI/GOAP/GoapAction.h"
+#include "OloEngine/AI/GOAP/GoapPlanner.h"
+#include "OloEngine/AI/GOAP/GoapWorldState.h"
+#include "OloEngine/Core/Base.h"
+#include "OloEngine/Core/Ref.h"
+#include "OloEngine/Threading/Mutex.h"
+
+#include <array>
+#include <atomic>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace OloEngine
+{
+    // A GoapWorldState packed against a GoapDomain: every key the domain's
+    // actions read or write owns a small bit field, so a state is a fixed
+    // block of words. Copying is a memcpy, equality a word compare and hashing
+    // constant-time, which is what the A* closed set spends its time on.
+    struct GoapPackedState
+    {
+        static constexpr u32 kWords = 4;
+
+        std::array<u64, kWords> Words{};
+
+        [[nodiscard]] u64 Hash() const;
+
+        auto operator==(const GoapPackedState& other) const -> bool = default;
+    };
+
+    // A planning domain compiled from an action set: keys interned to bit
+    // fields, preconditions and effects turned into per-word (mask, value)
+    // pairs. Planning runs forward A* over GoapPackedState and returns action
+    // indices, so one domain serves every agent whose actions have the same
+    // planning data, whatever their execution hooks capture.
+    //
+    // Field encoding, per key: 0 = absent (or a value of the other type);
+    // bools use 1 = false, 2 = true; integers use 1 = "some value no action
+    // mentions" and 2.. = the distinct constants the actions mention.
+    // Because effects only ever write those constants, an integer can never
+    // hold anything else once an action has touched it, so the packing loses
+    // nothing the planner could observe. Keys only the start state mentions
+    // are dropped: nothing reads or writes them during the search.
+    //
+    // Results are cached per (packed start, goal, usable-action set), so
+    // agents in identical situations plan once between them. The domain is
+    // immutable after Compile apart from the cache, which is internally
+    // locked; Plan may run on any thread.
+    class GoapDomain : public RefCounted
+    {
+      public:
+        static constexpr u32 kMaxActions = 64; // usable-action set is a u64 mask
+        static constexpr u32 kMaxCachedPlans = 4096;
+
+        struct PlanResult
+        {
+            std::vector<u32> Actions; // indices into the compiled action set, in execution order
+            f32 TotalCost = 0.0f;
+            bool Found = false;
+        };
+
+        // One packed planning problem, built by MakeQuery on the caller's
+        // thread (it reads the goal and start state; Plan doesn't).
+        struct Query
+        {
+            struct Field
+            {
+                u32 Word = 0;
+                u64 Mask = 0;
+                u64 Value = 0;
+            };
+
+            GoapPackedState Start;
+            GoapPackedState GoalMask;
+            GoapPackedState GoalValue;
+            std::vector<Field> GoalFields; // one per goal condition, for the heuristic
+            u64 Usable = 0;
+            bool Satisfied = false;   // the start already meets the goal
+            bool Unreachable = false; // some goal condition can never become true
+        };
+
+        struct CacheStats
+        {
+            u64 Hits = 0;
+            u64 Misses = 0;
+            u32 Entries = 0;
+        };
+
+        // Null when the actions don't fit the packed form: more than
+        // kMaxActions actions, more than GoapPackedState::kWords * 64 bits of
+        // fields, or a key used both as a bool and as an integer. Callers then
+        // plan with the generic GoapWorldState search.
+        [[nodiscard]] static Ref<GoapDomain> Compile(const std::vector<GoapAction>& actions, const GoapPlannerSettings& settings);
+
+        // Compile through a process-wide table keyed by the actions' planning
+        // data and the settings, so agents built from the same action set
+        // share one domain and one plan cache.
+        [[nodiscard]] static Ref<GoapDomain> Acquire(const std::vector<GoapAction>& actions, const GoapPlannerSettings& settings);
+
+        // False when the goal can't be expressed against this domain (it
+        // tests a key the actions use with the other value type).
+        [[nodiscard]] bool MakeQuery(const GoapWorldState& start, const GoapWorldState& goal, u64 usable, Query& outQuery) const;
+
+        // Serves the query from the cache when it can, else searches and
+        // caches the result. `outStats` reports the search (zero on a hit).
+        [[nodiscard]] PlanResult Plan(const Query& query, GoapPlanner::Stats* outStats = nullptr) const;
+        // The cached result for `query`, without searching.
+        [[nodiscard]] bool TryGetCached(const Query& query, PlanResult& outResult) const;
+        // Plans without touching the cache.
+        [[nodiscard]] PlanResult Search(const Query& query, GoapPlanner::Stats* outStats = nullptr) const;
+
+        // Expands a result into executable steps copied from `actions`, the
+        // action set this domain was compiled from.
+        [[nodiscard]] static GoapPlan MakePlan(const PlanResult& result, const std::vector<GoapAction>& actions);
+
+        [[nodiscard]] u32 GetActionCount() const
+        {
+            return static_cast<u32>(m_Actions.size());
+        }
+        [[nodiscard]] u32 GetBitCount() const
+        {
+            return m_BitCount;
+        }
+        [[nodiscard]] const GoapPlannerSettings& GetSettings() const
+        {
+            return m_Settings;
+        }
+        [[nodiscard]] CacheStats GetCacheStats() const;
+        void ClearCache();
+
+      private:
+        enum class KeyType : u8
+        {
+            Bool,
+            Int
+        };
+
+        struct KeySlot
+        {
+            KeyType Type = KeyType::Bool;
+            u32 Word = 0;
+            u32 Shift = 0;
+            u32 Width = 0;
+            std::vector<i32> Constants; // Int only: code = 2 + index
+        };
+
+        struct CompiledAction
+        {
+            GoapPackedState PreMask;
+            GoapPackedState PreValue;
+            GoapPackedState EffectMask;
+            GoapPackedState EffectValue;
+            f32 Cost = 0.0f;
+        };
+
+        struct CacheKey
+        {
+            GoapPackedState Start;
+            GoapPackedState GoalMask;
+            GoapPackedState GoalValue;
+            u64 Usable = 0;
+
+            auto operator==(const CacheKey& other) const -> bool = default;
+        };
+
+        struct CacheKeyHash
+        {
+            sizet operator()(const CacheKey& key) const;
+        };
+
+        // The field code `value` packs to in `slot`: 0 for a value of the
+        // other type, -1 for an integer constant the slot has no code for.
+        [[nodiscard]] static i32 EncodeValue(const KeySlot& slot, const GoapWorldState::Value& value);
+        static void WriteField(GoapPackedState& state, const KeySlot& slot, u64 code);
+        static void WriteMaskedField(GoapPackedState& mask, GoapPackedState& value, const KeySlot& slot, u64 code);
+
+        [[nodiscard]] static CacheKey MakeCacheKey(const Query& query);
+
+        std::vector<KeySlot> m_Slots;
+        std::unordered_map<std::string, u32> m_SlotByKey;
+        std::vector<CompiledAction> m_Actions;
+        GoapPlannerSettings m_Settings;
+        f32 m_HeuristicScale = 0.0f;
+        u32 m_BitCount = 0;
+        u32 m_WordCount = 0;
+
+        mutable FMutex m_CacheMutex;
+        mutable std::unordered_map<CacheKey, PlanResult, CacheKeyHash> m_Cache;
+        mutable std::atomic<u64> m_CacheHits = 0;
+        mutable std::atomic<u64> m_CacheMisses = 0;
+    };
+} // namespace OloEngine
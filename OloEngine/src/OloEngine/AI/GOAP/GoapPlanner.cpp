@@ -1,5 +1,6 @@
 #include "OloEnginePCH.h"
 #include "OloEngine/AI/GOAP/GoapPlanner.h"
+#include "OloEngine/AI/GOAP/GoapDomain.h"
 
 #include <limits>
 #include <queue>
@@ -54,169 +55,196 @@ namespace OloEngine
                 return static_cast<sizet>(s.Hash());
             }
         };
-    } // namespace
-
-    GoapPlan GoapPlanner::Plan(const GoapWorldState& start,
-                               const GoapGoal& goal,
-                               const std::vector<GoapAction>& actions,
-                               const GoapPlannerSettings& settings,
-                               Stats* outStats)
-    {
-        OLO_PROFILE_FUNCTION();
 
-        GoapPlan plan;
-        Stats stats;
-
-        // Goal already met → trivially found with an empty plan.
-        if (start.Satisfies(goal.DesiredState))
+        // The generic search over full GoapWorldStates, for action sets and
+        // goals GoapDomain can't pack.
+        GoapPlan SearchWorldStates(const GoapWorldState& start,
+                                   const GoapGoal& goal,
+                                   const std::vector<GoapAction>& actions,
+                                   const GoapPlannerSettings& settings,
+                                   GoapPlanner::Stats* outStats)
         {
-            plan.Found = true;
-            if (outStats)
-                *outStats = stats;
-            return plan;
-        }
+            OLO_PROFILE_FUNCTION();
 
-        std::vector<SearchNode> arena;
-        arena.reserve(64);
-
-        // Best known cost-to-reach for each finalised state. Keyed by the full
-        // GoapWorldState (collision-safe via operator==). The strict-less check
-        // below both prunes worse revisits and makes zero-cost no-op actions
-        // self-terminating (a state can never improve on itself).
-        std::unordered_map<GoapWorldState, f32, WorldStateHash> bestG;
-
-        std::priority_queue<OpenEntry, std::vector<OpenEntry>, OpenGreater> open;
-
-        // Cheapest non-negative action cost — the least any single step can add.
-        // Scaling the unsatisfied-fact count by it keeps the heuristic admissible
-        // regardless of the cost scale (h = count * minStep <= true cost when no
-        // action satisfies more than one outstanding fact). If any action is free
-        // (cost 0) there is no positive per-fact lower bound, so fall back to 0
-        // (Dijkstra-like, still admissible).
-        f32 minStepCost = std::numeric_limits<f32>::max();
-        for (const auto& candidate : actions)
-        {
-            const f32 c = candidate.Cost < 0.0f ? 0.0f : candidate.Cost; // negatives are floored on expansion too
-            if (c < minStepCost)
-                minStepCost = c;
-        }
-        const f32 heuristicScale = (actions.empty() || minStepCost <= 0.0f) ? 0.0f : minStepCost;
+            GoapPlan plan;
+            GoapPlanner::Stats stats;
 
-        const auto heuristic = [&](const GoapWorldState& s) -> f32
-        {
-            return static_cast<f32>(s.UnsatisfiedCount(goal.DesiredState)) * settings.HeuristicWeight * heuristicScale;
-        };
+            // Goal already met → trivially found with an empty plan.
+            if (start.Satisfies(goal.DesiredState))
+            {
+                plan.Found = true;
+                if (outStats)
+                    *outStats = stats;
+                return plan;
+            }
 
-        // Seed with the start state.
-        {
-            SearchNode root;
-            root.State = start;
-            root.G = 0.0f;
-            root.F = heuristic(start);
-            arena.push_back(std::move(root));
-            bestG[start] = 0.0f;
-            open.push(OpenEntry{ arena[0].F, 0.0f, 0 });
-        }
+            std::vector<SearchNode> arena;
+            arena.reserve(64);
+
+            // Best known cost-to-reach for each finalised state. Keyed by the full
+            // GoapWorldState (collision-safe via operator==). The strict-less check
+            // below both prunes worse revisits and makes zero-cost no-op actions
+            // self-terminating (a state can never improve on itself).
+            std::unordered_map<GoapWorldState, f32, WorldStateHash> bestG;
+
+            std::priority_queue<OpenEntry, std::vector<OpenEntry>, OpenGreater> open;
+
+            // Cheapest non-negative action cost — the least any single step can add.
+            // Scaling the unsatisfied-fact count by it keeps the heuristic admissible
+            // regardless of the cost scale (h = count * minStep <= true cost when no
+            // action satisfies more than one outstanding fact). If any action is free
+            // (cost 0) there is no positive per-fact lower bound, so fall back to 0
+            // (Dijkstra-like, still admissible).
+            f32 minStepCost = std::numeric_limits<f32>::max();
+            for (const auto& candidate : actions)
+            {
+                const f32 c = candidate.Cost < 0.0f ? 0.0f : candidate.Cost; // negatives are floored on expansion too
+                if (c < minStepCost)
+                    minStepCost = c;
+            }
+            const f32 heuristicScale = (actions.empty() || minStepCost <= 0.0f) ? 0.0f : minStepCost;
 
-        i32 goalNodeIdx = -1;
-        u32 iterations = 0;
+            const auto heuristic = [&](const GoapWorldState& s) -> f32
+            {
+                return static_cast<f32>(s.UnsatisfiedCount(goal.DesiredState)) * settings.HeuristicWeight * heuristicScale;
+            };
 
-        while (!open.empty())
-        {
-            if (iterations >= settings.MaxIterations)
+            // Seed with the start state.
             {
-                stats.HitIterationCap = true;
-                break;
+                SearchNode root;
+                root.State = start;
+                root.G = 0.0f;
+                root.F = heuristic(start);
+                arena.push_back(std::move(root));
+                bestG[start] = 0.0f;
+                open.push(OpenEntry{ arena[0].F, 0.0f, 0 });
             }
 
-            const OpenEntry top = open.top();
-            open.pop();
-            const i32 currentIdx = top.NodeIdx;
+            i32 goalNodeIdx = -1;
+            u32 iterations = 0;
+
+            while (!open.empty())
+            {
+                if (iterations >= settings.MaxIterations)
+                {
+                    stats.HitIterationCap = true;
+                    break;
+                }
+
+                const OpenEntry top = open.top();
+                open.pop();
+                const i32 currentIdx = top.NodeIdx;
+
+                // Lazy deletion: skip entries made stale by a cheaper path to the
+                // same state discovered after this one was queued.
+                if (auto it = bestG.find(arena[static_cast<sizet>(currentIdx)].State);
+                    it != bestG.end() && top.G > it->second)
+                    continue;
 
-            // Lazy deletion: skip entries made stale by a cheaper path to the
-            // same state discovered after this one was queued.
-            if (auto it = bestG.find(arena[static_cast<sizet>(currentIdx)].State);
-                it != bestG.end() && top.G > it->second)
-                continue;
+                ++iterations;
+                ++stats.NodesExpanded;
 
-            ++iterations;
-            ++stats.NodesExpanded;
+                // Copy out the fields we need; `arena` may reallocate on push below,
+                // which would dangle a reference into it.
+                const GoapWorldState currentState = arena[static_cast<sizet>(currentIdx)].State;
+                const f32 currentG = arena[static_cast<sizet>(currentIdx)].G;
+                const u32 currentDepth = arena[static_cast<sizet>(currentIdx)].Depth;
 
-            // Copy out the fields we need; `arena` may reallocate on push below,
-            // which would dangle a reference into it.
-            const GoapWorldState currentState = arena[static_cast<sizet>(currentIdx)].State;
-            const f32 currentG = arena[static_cast<sizet>(currentIdx)].G;
-            const u32 currentDepth = arena[static_cast<sizet>(currentIdx)].Depth;
+                if (currentState.Satisfies(goal.DesiredState))
+                {
+                    goalNodeIdx = currentIdx;
+                    break;
+                }
 
-            if (currentState.Satisfies(goal.DesiredState))
-            {
-                goalNodeIdx = currentIdx;
-                break;
-            }
+                if (currentDepth >= settings.MaxPlanLength)
+                    continue;
 
-            if (currentDepth >= settings.MaxPlanLength)
-                continue;
+                for (i32 a = 0; a < static_cast<i32>(actions.size()); ++a)
+                {
+                    const GoapAction& action = actions[static_cast<sizet>(a)];
 
-            for (i32 a = 0; a < static_cast<i32>(actions.size()); ++a)
-            {
-                const GoapAction& action = actions[static_cast<sizet>(a)];
+                    if (!action.CheckUsable())
+                        continue;
+                    if (!currentState.Satisfies(action.Preconditions))
+                        continue;
 
-                if (!action.CheckUsable())
-                    continue;
-                if (!currentState.Satisfies(action.Preconditions))
-                    continue;
+                    GoapWorldState next = currentState;
+                    next.ApplyEffects(action.Effects);
 
-                GoapWorldState next = currentState;
-                next.ApplyEffects(action.Effects);
+                    const f32 stepCost = action.Cost < 0.0f ? 0.0f : action.Cost;
+                    const f32 tentativeG = currentG + stepCost;
 
-                const f32 stepCost = action.Cost < 0.0f ? 0.0f : action.Cost;
-                const f32 tentativeG = currentG + stepCost;
+                    if (auto it = bestG.find(next); it != bestG.end() && !(tentativeG < it->second))
+                        continue; // no improvement over a known path to this state
 
-                if (auto it = bestG.find(next); it != bestG.end() && !(tentativeG < it->second))
-                    continue; // no improvement over a known path to this state
+                    bestG[next] = tentativeG;
 
-                bestG[next] = tentativeG;
+                    SearchNode child;
+                    child.G = tentativeG;
+                    child.F = tentativeG + heuristic(next);
+                    child.Parent = currentIdx;
+                    child.ActionIdx = a;
+                    child.Depth = currentDepth + 1;
+                    child.State = std::move(next);
 
-                SearchNode child;
-                child.G = tentativeG;
-                child.F = tentativeG + heuristic(next);
-                child.Parent = currentIdx;
-                child.ActionIdx = a;
-                child.Depth = currentDepth + 1;
-                child.State = std::move(next);
+                    const i32 childIdx = static_cast<i32>(arena.size());
+                    arena.push_back(std::move(child));
+                    open.push(OpenEntry{ arena[static_cast<sizet>(childIdx)].F, tentativeG, childIdx });
+                    ++stats.NodesGenerated;
+                }
+            }
 
-                const i32 childIdx = static_cast<i32>(arena.size());
-                arena.push_back(std::move(child));
-                open.push(OpenEntry{ arena[static_cast<sizet>(childIdx)].F, tentativeG, childIdx });
-                ++stats.NodesGenerated;
+            if (goalNodeIdx >= 0)
+            {
+                plan.Found = true;
+                plan.TotalCost = arena[static_cast<sizet>(goalNodeIdx)].G;
+
+                // Walk parents back to the root, collecting action indices, then
+                // reverse into execution order.
+                std::vector<i32> actionChain;
+                for (i32 idx = goalNodeIdx; idx >= 0; idx = arena[static_cast<sizet>(idx)].Parent)
+                {
+                    const i32 actionIdx = arena[static_cast<sizet>(idx)].ActionIdx;
+                    if (actionIdx >= 0)
+                        actionChain.push_back(actionIdx);
+                }
+                plan.Steps.reserve(actionChain.size());
+                for (auto it = actionChain.rbegin(); it != actionChain.rend(); ++it)
+                {
+                    GoapAction step = actions[static_cast<sizet>(*it)];
+                    step.ResetRuntime();
+                    plan.Steps.push_back(std::move(step));
+                }
             }
+
+            if (outStats)
+                *outStats = stats;
+            return plan;
         }
+    } // namespace
 
-        if (goalNodeIdx >= 0)
-        {
-            plan.Found = true;
-            plan.TotalCost = arena[static_cast<sizet>(goalNodeIdx)].G;
+    GoapPlan GoapPlanner::Plan(const GoapWorldState& start,
+                               const GoapGoal& goal,
+                               const std::vector<GoapAction>& actions,
+                               const GoapPlannerSettings& settings,
+                               Stats* outStats)
+    {
+        OLO_PROFILE_FUNCTION();
 
-            // Walk parents back to the root, collecting action indices, then
-            // reverse into execution order.
-            std::vector<i32> actionChain;
-            for (i32 idx = goalNodeIdx; idx >= 0; idx = arena[static_cast<sizet>(idx)].Parent)
-            {
-                const i32 actionIdx = arena[static_cast<sizet>(idx)].ActionIdx;
-                if (actionIdx >= 0)
-                    actionChain.push_back(actionIdx);
-            }
-            plan.Steps.reserve(actionChain.size());
-            for (auto it = actionChain.rbegin(); it != actionChain.rend(); ++it)
+        // Search the packed form when the actions and goal fit it. The usable
+        // gates are sampled once up front: they describe "this plan".
+        if (Ref<GoapDomain> domain = GoapDomain::Compile(actions, settings))
+        {
+            u64 usable = 0;
+            for (sizet a = 0; a < actions.size(); ++a)
             {
-                GoapAction step = actions[static_cast<sizet>(*it)];
-                step.ResetRuntime();
-                plan.Steps.push_back(std::move(step));
+                if (actions[a].CheckUsable())
+                    usable |= 1ull << a;
             }
+            GoapDomain::Query query;
+            if (domain->MakeQuery(start, goal.DesiredState, usable, query))
+                return GoapDomain::MakePlan(domain->Search(query, outStats), actions);
         }
-
-        if (outStats)
-            *outStats = stats;
-        return plan;
+        return SearchWorldStates(start, goal, actions, settings, outStats);
     }
 } // namespace OloEngine
@@ -26,6 +26,8 @@ namespace OloEngine
         //   0.0           — pure Dijkstra: slower but provably minimum-cost.
         //   > 1.0         — greedier/faster, may return a costlier plan.
         f32 HeuristicWeight = 1.0f;
+
+        auto operator==(const GoapPlannerSettings& other) const -> bool = default;
     };
 
     struct GoapPlan
@@ -49,6 +51,11 @@ namespace OloEngine
     // hold, until a state satisfies the goal — then walks the parent chain back
     // into an ordered plan. The planner only ever reads the *data* half of a
     // GoapAction, so it has no engine dependencies and is fully unit-testable.
+    //
+    // Plan compiles the actions into a GoapDomain and searches packed states
+    // when they fit, falling back to searching GoapWorldStates directly.
+    // Callers that plan repeatedly over one action set (GoapAgent) should keep
+    // the domain and use its plan cache instead.
     class GoapPlanner
     {
       public:
@@ -3,17 +3,21 @@
 #include "PerceptionMath.h"
 
 #include "OloEngine/AI/AIComponents.h"
+#include "OloEngine/Containers/Array.h"
 #include "OloEngine/Physics3D/JoltScene.h"
 #include "OloEngine/Physics3D/SceneQueries.h"
 #include "OloEngine/Scene/Components.h"
 #include "OloEngine/Scene/Entity.h"
 #include "OloEngine/Scene/Scene.h"
+#include "OloEngine/Task/ParallelFor.h"
 
 #include <glm/glm.hpp>
 #include <glm/gtc/quaternion.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <span>
 #include <vector>
 
 namespace OloEngine
@@ -24,20 +28,24 @@ namespace OloEngine
         // BT / FSM / GOAP / scripts can read PerceptionKeys::*.
         void WriteToBlackboard(BTBlackboard& bb, const PerceptionComponent& pc)
         {
-            bb.Set(PerceptionKeys::CanSeeTarget, pc.HasVisibleTarget);
+            static const BlackboardKey s_CanSeeTarget(PerceptionKeys::CanSeeTarget);
+            static const BlackboardKey s_Target(PerceptionKeys::Target);
+            static const BlackboardKey s_LastKnownPosition(PerceptionKeys::LastKnownPosition);
+
+            bb.Set(s_CanSeeTarget, pc.HasVisibleTarget);
 
             if (pc.HasVisibleTarget)
             {
-                bb.Set(PerceptionKeys::Target, pc.VisibleTarget);
+                bb.Set(s_Target, pc.VisibleTarget);
             }
             else
             {
-                bb.Remove(PerceptionKeys::Target);
+                bb.Remove(s_Target);
             }
 
             if (pc.HasLastKnownPosition)
             {
-                bb.Set(PerceptionKeys::LastKnownPosition, pc.LastKnownPosition);
+                bb.Set(s_LastKnownPosition, pc.LastKnownPosition);
             }
         }
 
@@ -59,142 +67,302 @@ namespace OloEngine
             }
         }
 
-        // True if a solid body sits between the eye and the target. With no live
-        // physics scene we cannot test occlusion, so the line is treated as clear
-        // (range + FOV already passed) — sight degrades to "see-through" rather
-        // than blind, which is the useful default for headless / editor-stopped
-        // contexts.
-        bool IsOccluded(const Scene* scene, const glm::vec3& eye, const glm::vec3& targetPos,
-                        UUID perceiver, UUID target)
+        // Sense pass per-task context: the worker's candidate buffer and its
+        // index, so a Result can point back into it.
+        struct SenseContext
+        {
+            std::vector<PerceptionWorkspace::Candidate>* Candidates = nullptr;
+            u32 Buffer = 0;
+        };
+
+        // Perceivers per sense task. The filter is a handful of grid cells and
+        // cone tests each, so small batches would be all scheduling overhead.
+        constexpr i32 kSenseBatchSize = 32;
+
+        // Range + cone + team filter for one perceiver against the packed
+        // cache. Without line of sight the nearest passing target is the
+        // answer; with it, every passing target is kept nearest-first for the
+        // ray rounds. Ties go to the lower cache index so the choice doesn't
+        // depend on the grid's visit order.
+        void SensePerceiver(PerceptionWorkspace& workspace, u32 index, SenseContext& context)
+        {
+            const PerceptionWorkspace::Perceiver& perceiver = workspace.Perceivers[index];
+            PerceptionWorkspace::Result& result = workspace.Results[index];
+            std::vector<PerceptionWorkspace::Candidate>& candidates = *context.Candidates;
+
+            result = {};
+            result.Buffer = context.Buffer;
+            result.Begin = static_cast<u32>(candidates.size());
+
+            u32 best = std::numeric_limits<u32>::max();
+            f32 bestDistSq = std::numeric_limits<f32>::max();
+
+            workspace.TargetGrid.ForEachInRadius(
+                perceiver.Eye, perceiver.SightRange,
+                [&](u32 target, const glm::vec3& targetPos, f32 distSq)
+                {
+                    if (workspace.TargetIds[target] == perceiver.Id)
+                        return; // a sensor never senses itself
+                    if (!perceiver.DetectSameTeam && (workspace.TargetTeams[target] == perceiver.Team))
+                        return; // ally — filtered out
+                    if (!perceiver.RequireLineOfSight &&
+                        !(distSq < bestDistSq || (distSq == bestDistSq && target < best)))
+                        return; // a nearer target already won — skip the cone test
+
+                    // Range + field-of-view cone gate (single source of truth).
+                    if (!PerceptionMath::IsInSightCone(perceiver.Eye, perceiver.Forward, targetPos,
+                                                       perceiver.SightRange, perceiver.FovDegrees))
+                        return;
+
+                    if (perceiver.RequireLineOfSight)
+                    {
+                        candidates.push_back({ target, distSq });
+                    }
+                    else
+                    {
+                        best = target;
+                        bestDistSq = distSq;
+                    }
+                });
+
+            if (perceiver.RequireLineOfSight)
+            {
+                result.Count = static_cast<u32>(candidates.size()) - result.Begin;
+                std::sort(candidates.begin() + result.Begin, candidates.end(),
+                          [](const PerceptionWorkspace::Candidate& a, const PerceptionWorkspace::Candidate& b)
+                          { return a.DistanceSq < b.DistanceSq || (a.DistanceSq == b.DistanceSq && a.Target < b.Target); });
+            }
+            else if (best != std::numeric_limits<u32>::max())
+            {
+                result.Target = static_cast<i32>(best);
+            }
+        }
+
+        // Resolve every line-of-sight perceiver to its nearest unoccluded
+        // candidate. Each round casts one ray per still-unresolved perceiver
+        // as a single batch; a blocked perceiver moves on to its next
+        // candidate for the following round. Most perceivers settle in the
+        // first round (their nearest candidate is visible, or they have none).
+        //
+        // With no live physics scene we cannot test occlusion, so the line is
+        // treated as clear (range + FOV already passed) — sight degrades to
+        // "see-through" rather than blind, which is the useful default for
+        // headless / editor-stopped contexts.
+        void ResolveLineOfSight(const Scene* scene, PerceptionWorkspace& workspace)
         {
+            OLO_PROFILE_FUNCTION();
+
             JoltScene* physics = scene->GetPhysicsScene();
-            if ((physics == nullptr) || !physics->IsInitialized())
+            const bool canCast = (physics != nullptr) && physics->IsInitialized();
+
+            workspace.Pending.clear();
+            for (u32 i = 0; i < static_cast<u32>(workspace.Perceivers.size()); ++i)
             {
-                return false;
+                if (workspace.Perceivers[i].RequireLineOfSight && (workspace.Results[i].Count > 0))
+                    workspace.Pending.push_back(i);
             }
 
-            const glm::vec3 toTarget = targetPos - eye;
-            const f32 distance = glm::length(toTarget);
-            if (distance <= 0.0001f)
+            const auto candidateOf = [&workspace](const PerceptionWorkspace::Result& result) -> const PerceptionWorkspace::Candidate&
+            {
+                return workspace.WorkerCandidates[result.Buffer][result.Begin + result.Cursor];
+            };
+
+            while (!workspace.Pending.empty())
             {
-                return false;
+                workspace.RayOwners.clear();
+                for (const u32 slot : workspace.Pending)
+                {
+                    const PerceptionWorkspace::Perceiver& perceiver = workspace.Perceivers[slot];
+                    PerceptionWorkspace::Result& result = workspace.Results[slot];
+                    const PerceptionWorkspace::Candidate& candidate = candidateOf(result);
+
+                    const f32 distance = std::sqrt(candidate.DistanceSq);
+                    if (!canCast || (distance <= 0.0001f))
+                    {
+                        result.Target = static_cast<i32>(candidate.Target);
+                        continue;
+                    }
+
+                    const sizet rayIndex = workspace.RayOwners.size();
+                    workspace.RayOwners.push_back(slot);
+                    if (workspace.Rays.size() <= rayIndex)
+                        workspace.Rays.emplace_back();
+
+                    RayCastInfo& ray = workspace.Rays[rayIndex];
+                    ray.m_Origin = perceiver.Eye;
+                    ray.m_Direction = (workspace.TargetPositions[candidate.Target] - perceiver.Eye) / distance;
+                    ray.m_MaxDistance = distance;
+                    // Exclude both endpoints: the perceiver's own body must not
+                    // block its eyes, and the target's collider is exactly what
+                    // we are trying to see — only a *third* body in between
+                    // counts as an occluder.
+                    ray.m_ExcludedEntities.clear();
+                    ray.m_ExcludedEntities.push_back(perceiver.Id);
+                    ray.m_ExcludedEntities.push_back(workspace.TargetIds[candidate.Target]);
+                }
+
+                const sizet rayCount = workspace.RayOwners.size();
+                if (rayCount == 0)
+                    break;
+
+                workspace.RayHits.resize(rayCount);
+                physics->CastRays(std::span<const RayCastInfo>(workspace.Rays.data(), rayCount),
+                                  std::span<SceneQueryHit>(workspace.RayHits.data(), rayCount));
+
+                workspace.NextPending.clear();
+                for (sizet i = 0; i < rayCount; ++i)
+                {
+                    const u32 slot = workspace.RayOwners[i];
+                    PerceptionWorkspace::Result& result = workspace.Results[slot];
+                    if (!workspace.RayHits[i].HasHit())
+                    {
+                        result.Target = static_cast<i32>(candidateOf(result).Target);
+                    }
+                    else if (++result.Cursor < result.Count)
+                    {
+                        workspace.NextPending.push_back(slot); // a wall blocks the view — try the next one
+                    }
+                }
+                std::swap(workspace.Pending, workspace.NextPending);
             }
+        }
 
-            RayCastInfo ray;
-            ray.m_Origin = eye;
-            ray.m_Direction = toTarget / distance;
-            ray.m_MaxDistance = distance;
-            // Exclude both endpoints: the perceiver's own body must not block its
-            // eyes, and the target's collider is exactly what we are trying to
-            // see — only a *third* body in between counts as an occluder.
-            ray.m_ExcludedEntities.push_back(perceiver);
-            ray.m_ExcludedEntities.push_back(target);
-
-            SceneQueryHit hit;
-            return physics->CastRay(ray, hit) && hit.HasHit();
+        // Fraction of the sense interval a perceiver is offset by. A Fibonacci
+        // hash of the UUID, so consecutive UUIDs still land far apart.
+        f64 StaggerPhase(UUID perceiver)
+        {
+            const u64 mixed = static_cast<u64>(perceiver) * 0x9E3779B97F4A7C15ull;
+            return static_cast<f64>(mixed >> 40) / static_cast<f64>(1ull << 24);
         }
     } // namespace
 
-    void PerceptionSystem::OnUpdate(Scene* scene, f32 dt)
+    void PerceptionWorkspace::Clear()
     {
-        OLO_PROFILE_FUNCTION();
+        TargetPositions.clear();
+        TargetIds.clear();
+        TargetTeams.clear();
+        TargetGrid.Clear();
+        Perceivers.clear();
+        Results.clear();
+        for (auto& candidates : WorkerCandidates)
+            candidates.clear();
+        Pending.clear();
+        NextPending.clear();
+        RayOwners.clear();
+    }
 
-        auto perceivers = scene->GetAllEntitiesWith<PerceptionComponent, TransformComponent>();
+    bool PerceptionSystem::IsSenseDue(UUID perceiver, f32 interval, f64 clock, f32 dt)
+    {
+        if (!(interval > 0.0f) || (interval <= dt))
+            return true;
 
-        // Reused across perceivers so the per-perceiver proximity query doesn't
-        // allocate. The spatial index (rebuilt earlier this tick in
-        // Scene::OnUpdateRuntime) lets each perceiver inspect only entities
-        // within its sight range instead of scanning every perceptible entity.
-        std::vector<UUID> candidates;
+        // Due when the clock crossed one of this perceiver's phase-shifted
+        // interval boundaries during the tick.
+        const f64 phase = StaggerPhase(perceiver) * static_cast<f64>(interval);
+        const f64 now = std::floor((clock + phase) / static_cast<f64>(interval));
+        const f64 before = std::floor((clock - static_cast<f64>(dt) + phase) / static_cast<f64>(interval));
+        return now != before;
+    }
 
-        for (auto perceiverId : perceivers)
+    void PerceptionSystem::OnUpdate(Scene* scene, PerceptionWorkspace& workspace, f32 dt)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        workspace.Clock += static_cast<f64>(dt);
+
+        // ── Pass 1: snapshot the perceivers due this tick ────────────────────
+        // The rest keep last tick's result; only their "time since seen" moves.
+        workspace.Perceivers.clear();
+        f32 maxSightRange = FlockSpatialHash::kMinCellSize;
+        auto perceivers = scene->GetAllEntitiesWith<IDComponent, PerceptionComponent, TransformComponent>();
+        for (const auto entity : perceivers)
         {
-            Entity perceiver = { perceiverId, scene };
-            auto& pc = perceiver.GetComponent<PerceptionComponent>();
-            const auto& perceiverTransform = perceiver.GetComponent<TransformComponent>();
+            auto& pc = perceivers.get<PerceptionComponent>(entity);
+            const UUID id = perceivers.get<IDComponent>(entity).ID;
+            if (!PerceptionSystem::IsSenseDue(id, pc.SenseInterval, workspace.Clock, dt))
+            {
+                if (!pc.HasVisibleTarget)
+                    pc.TimeSinceLastSeen += dt;
+                continue;
+            }
 
             // Eye position and look direction in world space. Forward is the
             // entity's local -Z (engine convention; see EditorCamera / fly-cam).
-            const glm::quat orientation = perceiverTransform.GetRotation();
-            const glm::vec3 eye = perceiverTransform.Translation + (orientation * pc.EyeOffset);
-            const glm::vec3 forward = glm::normalize(orientation * glm::vec3(0.0f, 0.0f, -1.0f));
+            const auto& transform = perceivers.get<TransformComponent>(entity);
+            const glm::quat orientation = transform.GetRotation();
 
-            const UUID perceiverUUID = perceiver.GetUUID();
+            PerceptionWorkspace::Perceiver& perceiver = workspace.Perceivers.emplace_back();
+            perceiver.Handle = entity;
+            perceiver.Id = id;
+            perceiver.Eye = transform.Translation + (orientation * pc.EyeOffset);
+            perceiver.Forward = glm::normalize(orientation * glm::vec3(0.0f, 0.0f, -1.0f));
+            perceiver.SightRange = pc.SightRange;
+            perceiver.FovDegrees = pc.FovDegrees;
+            perceiver.Team = pc.PerceiverTeam;
+            perceiver.DetectSameTeam = pc.DetectSameTeam;
+            perceiver.RequireLineOfSight = pc.RequireLineOfSight;
 
-            bool found = false;
-            UUID bestTarget = 0;
-            glm::vec3 bestTargetPos = { 0.0f, 0.0f, 0.0f };
-            f32 bestDistSq = std::numeric_limits<f32>::max();
+            maxSightRange = std::max(maxSightRange, pc.SightRange);
+        }
 
-            // Only entities within the sight range can possibly be inside the
-            // cone (the cone test gates on the same range), so a radius query
-            // around the eye returns a superset of the visible candidates —
-            // identical results to the old full scan, but bounded by local
-            // density instead of the total perceptible-entity count.
-            candidates.clear();
-            scene->GetSpatialIndex().QueryRadius(eye, pc.SightRange, candidates);
+        if (workspace.Perceivers.empty())
+            return;
 
-            for (UUID candidateUUID : candidates)
-            {
-                if (candidateUUID == perceiverUUID)
-                {
-                    continue; // a sensor never senses itself
-                }
+        // ── Pass 2: pack the perceptible cache ───────────────────────────────
+        workspace.TargetPositions.clear();
+        workspace.TargetIds.clear();
+        workspace.TargetTeams.clear();
+        auto perceptibles = scene->GetAllEntitiesWith<IDComponent, PerceptibleComponent, TransformComponent>();
+        for (const auto entity : perceptibles)
+        {
+            const auto& perceptible = perceptibles.get<PerceptibleComponent>(entity);
+            if (!perceptible.IsPerceptible)
+                continue; // hidden / cloaked
 
-                // Resolve via the non-asserting lookup: GetEntityByUUID would
-                // assert on a UUID that's no longer live, so it can't be used to
-                // *skip* a disappeared entity. The index holds every transformed
-                // entity; only those still present and tagged
-                // PerceptibleComponent are sight targets.
-                auto targetOpt = scene->TryGetEntityWithUUID(candidateUUID);
-                if (!targetOpt || !targetOpt->HasComponent<PerceptibleComponent>())
-                {
-                    continue;
-                }
-                Entity targetEntity = *targetOpt;
+            workspace.TargetPositions.push_back(perceptibles.get<TransformComponent>(entity).Translation);
+            workspace.TargetIds.push_back(perceptibles.get<IDComponent>(entity).ID);
+            workspace.TargetTeams.push_back(perceptible.Team);
+        }
 
-                const auto& perceptible = targetEntity.GetComponent<PerceptibleComponent>();
-                if (!perceptible.IsPerceptible)
-                {
-                    continue; // hidden / cloaked
-                }
-                if (!pc.DetectSameTeam && (perceptible.Team == pc.PerceiverTeam))
-                {
-                    continue; // ally — filtered out
-                }
+        // Cell size == the widest sight range due this tick, so no query
+        // sweeps more than 3x3x3 cells.
+        workspace.TargetGrid.Rebuild(workspace.TargetPositions, maxSightRange);
 
-                const glm::vec3 targetPos = targetEntity.GetComponent<TransformComponent>().Translation;
-                const f32 distSq = glm::dot(targetPos - eye, targetPos - eye);
-                if (distSq >= bestDistSq)
-                {
-                    continue; // a nearer target already won — skip costlier checks
-                }
+        // ── Pass 3: range / cone / team filter, in parallel ──────────────────
+        const i32 perceiverCount = static_cast<i32>(workspace.Perceivers.size());
+        workspace.Results.resize(workspace.Perceivers.size());
 
-                // Range + field-of-view cone gate (single source of truth).
-                if (!PerceptionMath::IsInSightCone(eye, forward, targetPos, pc.SightRange, pc.FovDegrees))
-                {
-                    continue;
-                }
+        TArray<SenseContext> contexts;
+        ParallelForWithTaskContext(
+            "PerceptionSystem::Sense", contexts, perceiverCount, kSenseBatchSize,
+            // Runs on this thread before any task starts, so growing the
+            // buffer list here can't move a buffer out from under a worker.
+            [&workspace](i32 contextIndex, i32 numContexts) -> SenseContext
+            {
+                if (workspace.WorkerCandidates.size() < static_cast<sizet>(numContexts))
+                    workspace.WorkerCandidates.resize(static_cast<sizet>(numContexts));
+                auto& candidates = workspace.WorkerCandidates[static_cast<sizet>(contextIndex)];
+                candidates.clear();
+                return { &candidates, static_cast<u32>(contextIndex) };
+            },
+            [&workspace](SenseContext& context, i32 index)
+            { SensePerceiver(workspace, static_cast<u32>(index), context); });
 
-                // Optional line-of-sight raycast.
-                if (pc.RequireLineOfSight &&
-                    IsOccluded(scene, eye, targetPos, perceiverUUID, candidateUUID))
-                {
-                    continue; // a wall blocks the view
-                }
+        // ── Pass 4: line of sight, one ray batch per round ───────────────────
+        ResolveLineOfSight(scene, workspace);
 
-                found = true;
-                bestDistSq = distSq;
-                bestTarget = candidateUUID;
-                bestTargetPos = targetPos;
-            }
+        // ── Pass 5: publish ──────────────────────────────────────────────────
+        for (sizet i = 0; i < workspace.Perceivers.size(); ++i)
+        {
+            Entity perceiver = { workspace.Perceivers[i].Handle, scene };
+            auto& pc = perceiver.GetComponent<PerceptionComponent>();
+            const i32 target = workspace.Results[i].Target;
 
-            // Publish the result onto the component...
-            pc.HasVisibleTarget = found;
-            if (found)
+            pc.HasVisibleTarget = target >= 0;
+            if (pc.HasVisibleTarget)
             {
-                pc.VisibleTarget = bestTarget;
-                pc.LastKnownPosition = bestTargetPos;
+                pc.VisibleTarget = workspace.TargetIds[static_cast<sizet>(target)];
+                pc.LastKnownPosition = workspace.TargetPositions[static_cast<sizet>(target)];
                 pc.HasLastKnownPosition = true;
                 pc.TimeSinceLastSeen = 0.0f;
             }
@@ -1,6 +1,14 @@
 #pragma once
 
+#include "OloEngine/AI/Flocking/FlockSpatialHash.h"
 #include "OloEngine/Core/Base.h"
+#include "OloEngine/Core/UUID.h"
+#include "OloEngine/Physics3D/SceneQueries.h"
+
+#include <entt/entt.hpp>
+#include <glm/glm.hpp>
+
+#include <vector>
 
 namespace OloEngine
 {
@@ -19,16 +27,93 @@ namespace OloEngine
         inline constexpr const char* LastKnownPosition = "Perception.LastKnownPosition"; // glm::vec3
     } // namespace PerceptionKeys
 
+    // Per-Scene scratch for PerceptionSystem. Runtime-only and never copied or
+    // serialized; held across ticks purely so the sensor pass doesn't allocate
+    // (same arrangement as FlockingWorkspace).
+    struct PerceptionWorkspace
+    {
+        // Perceptible cache, index-parallel: every visible PerceptibleComponent
+        // packed once per tick, so candidate filtering never goes back to the
+        // registry. Cloaked entities are left out at packing time.
+        std::vector<glm::vec3> TargetPositions;
+        std::vector<UUID> TargetIds;
+        std::vector<i32> TargetTeams;
+        FlockSpatialHash TargetGrid;
+
+        // Perceivers due to sense this tick, snapshotted off their components.
+        struct Perceiver
+        {
+            entt::entity Handle = entt::null;
+            UUID Id = 0;
+            glm::vec3 Eye{ 0.0f };
+            glm::vec3 Forward{ 0.0f, 0.0f, -1.0f };
+            f32 SightRange = 0.0f;
+            f32 FovDegrees = 0.0f;
+            i32 Team = 0;
+            bool DetectSameTeam = false;
+            bool RequireLineOfSight = false;
+        };
+        std::vector<Perceiver> Perceivers;
+
+        // A cone-passing target, in a worker's candidate buffer.
+        struct Candidate
+        {
+            u32 Target = 0; // index into the perceptible cache
+            f32 DistanceSq = 0.0f;
+        };
+
+        // One per perceiver. Line-of-sight perceivers keep their candidates
+        // nearest-first in Buffer[Begin, Begin + Count) and test them one ray
+        // round at a time from Cursor.
+        struct Result
+        {
+            u32 Buffer = 0;
+            u32 Begin = 0;
+            u32 Count = 0;
+            u32 Cursor = 0;
+            i32 Target = -1; // perceptible cache index, -1 = nothing seen
+        };
+        std::vector<Result> Results;
+        std::vector<std::vector<Candidate>> WorkerCandidates;
+
+        // Line-of-sight batch. Rays are reused round to round so their
+        // exclusion lists keep their capacity.
+        std::vector<u32> Pending;
+        std::vector<u32> NextPending;
+        std::vector<u32> RayOwners;
+        std::vector<RayCastInfo> Rays;
+        std::vector<SceneQueryHit> RayHits;
+
+        // Seconds of simulated time, for the staggered schedule.
+        f64 Clock = 0.0;
+
+        void Clear();
+    };
+
     // Sight-perception sensor pass. For every entity carrying a
-    // PerceptionComponent it scans all PerceptibleComponent entities and marks
-    // the nearest one that falls inside the perceiver's range + field-of-view
-    // cone and (optionally) has clear physics line-of-sight. The result is
-    // stored on the PerceptionComponent and mirrored into the entity's AI
-    // blackboard(s). Driven from Scene::OnUpdateRuntime ahead of AISystem so the
-    // behavior tree / FSM / GOAP tick sees fresh sensor data the same frame.
+    // PerceptionComponent it marks the nearest PerceptibleComponent entity that
+    // falls inside the perceiver's range + field-of-view cone and (optionally)
+    // has clear physics line-of-sight. The result is stored on the
+    // PerceptionComponent and mirrored into the entity's AI blackboard(s).
+    // Driven from Scene::OnUpdateRuntime ahead of AISystem so the behavior
+    // tree / FSM / GOAP tick sees fresh sensor data the same frame.
+    //
+    // A perceiver with a SenseInterval only senses once per interval, at a
+    // phase picked from its UUID, so a crowd of them spreads its sensing over
+    // the interval instead of spiking on one tick; in between it keeps its
+    // last result. The perceivers due this tick are filtered in parallel
+    // against the packed perceptible cache, each worker collecting candidates
+    // into its own buffer, and the line-of-sight rays that remain are cast as
+    // one parallel batch per round: every perceiver tests its nearest
+    // candidate, and only those whose ray was blocked go again with their next
+    // one, so the result matches the serial nearest-unoccluded scan.
     class PerceptionSystem
     {
       public:
-        static void OnUpdate(Scene* scene, f32 dt);
+        static void OnUpdate(Scene* scene, PerceptionWorkspace& workspace, f32 dt);
+
+        // True if a perceiver sensing every `interval` seconds, at the phase
+        // its UUID picks, is due in the tick that advanced the clock to `clock`.
+        [[nodiscard]] static bool IsSenseDue(UUID perceiver, f32 interval, f64 clock, f32 dt);
     };
 } // namespace OloEngine
@@ -248,6 +248,7 @@ namespace OloEngine
         }
 
         AssetType type = asset->GetAssetType();
+        const AssetSerializer* serializer = nullptr;
         {
             TUniqueLock<FMutex> lock(GetSerializersMutex());
             auto& serializers = GetSerializers();
@@ -257,9 +258,12 @@ namespace OloEngine
                 OLO_CORE_WARN("There's currently no serializer for assets of type: {}", AssetUtils::AssetTypeToString(type));
                 return false;
             }
-
-            return it->second->SerializeToAssetPack(handle, stream, outInfo);
+            serializer = it->second.get();
         }
+
+        // Serializers are stateless and the map is never shrunk, so the pack build can
+        // run many of these at once; only the lookup needs the lock.
+        return serializer->SerializeToAssetPack(handle, stream, outInfo);
     }
 
     Ref<Asset> AssetImporter::DeserializeFromAssetPack(FileStreamReader& stream, const AssetPackFile::AssetInfo& assetInfo)
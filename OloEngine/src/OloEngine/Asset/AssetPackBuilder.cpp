@@ -11,15 +11,282 @@
 #include "OloEngine/Project/Project.h"
 #include "OloEngine/Serialization/AssetPackFile.h"
 #include "OloEngine/Serialization/FileStream.h"
+#include "OloEngine/Renderer/VirtualGeometry/VirtualMesh.h"
+#include "OloEngine/Task/ParallelFor.h"
+#include "OloEngine/Task/Scheduler.h"
 #include "OloEngine/Task/Task.h"
 
-#include <unordered_set>
+#include <algorithm>
+#include <cctype>
 #include <fstream>
 #include <filesystem>
-#include <chrono>
+#include <map>
+#include <optional>
+#include <random>
+#include <unordered_map>
 
 namespace OloEngine
 {
+    namespace
+    {
+        // Bump whenever a serializer's pack output changes for the same source, so an
+        // incremental build stops reusing payloads the old code wrote.
+        constexpr u32 s_PayloadFingerprintVersion = 1;
+
+        constexpr u32 s_ManifestMagic = 0x4D4B504F; // "OPKM"
+        constexpr u32 s_ManifestVersion = 1;
+
+        // On-disk sizes of the records BuildImpl writes field by field. The in-memory
+        // structs are padded, so sizeof() of them is not the layout.
+        constexpr u64 s_HeaderBytes = sizeof(u32) + sizeof(u32) + sizeof(u64) + sizeof(u64);
+        constexpr u64 s_IndexBytes = sizeof(u32) + sizeof(u32) + sizeof(u64) + sizeof(u64);
+        constexpr u64 s_AssetInfoBytes = sizeof(AssetHandle) + sizeof(u64) + sizeof(u64) + sizeof(AssetType) + sizeof(u16);
+        constexpr u64 s_SceneInfoBytes = sizeof(AssetHandle) + sizeof(u64) + sizeof(u64) + sizeof(u16) + sizeof(u32);
+
+        constexpr u64 s_CopyChunkBytes = 1024 * 1024;
+
+        // The fingerprints of the pack they were written with, keyed by handle.
+        std::filesystem::path ManifestPathFor(const std::filesystem::path& packPath)
+        {
+            std::filesystem::path path = packPath;
+            path += ".manifest";
+            return path;
+        }
+
+        // A suffix no concurrent build of the same output will pick.
+        std::string UniqueBuildSuffix()
+        {
+            std::random_device rd;
+            return fmt::format("{:08x}{:08x}", rd(), rd());
+        }
+
+        // Lower-cased extension, for matching source formats.
+        std::string LowerExtension(const std::filesystem::path& path)
+        {
+            std::string extension = path.extension().string();
+            std::ranges::transform(extension, extension.begin(), [](unsigned char c)
+                                   { return static_cast<char>(std::tolower(c)); });
+            return extension;
+        }
+
+        // Mesh formats whose geometry or material factors live partly in other files: a
+        // .gltf's buffers, an .obj's material library. Textures are left out; a payload
+        // refers to them by handle.
+        bool ReadsSiblingFiles(const std::filesystem::path& source)
+        {
+            const std::string extension = LowerExtension(source);
+            return extension == ".gltf" || extension == ".obj";
+        }
+
+        bool IsSiblingDependency(const std::filesystem::path& file)
+        {
+            const std::string extension = LowerExtension(file);
+            return extension == ".bin" || extension == ".mtl";
+        }
+
+        std::map<u64, DerivedDataKey> ReadManifest(const std::filesystem::path& manifestPath, const std::filesystem::path& packPath)
+        {
+            std::error_code ec;
+            const u64 packSize = std::filesystem::file_size(packPath, ec);
+            if (ec || !std::filesystem::exists(manifestPath, ec))
+                return {};
+
+            std::ifstream file(manifestPath, std::ios::binary);
+            const auto read = [&file](auto& value)
+            {
+                file.read(reinterpret_cast<char*>(&value), sizeof(value));
+                return static_cast<bool>(file);
+            };
+
+            u32 magic = 0;
+            u32 version = 0;
+            u64 manifestPackSize = 0;
+            u32 count = 0;
+            if (!read(magic) || !read(version) || !read(manifestPackSize) || !read(count) ||
+                magic != s_ManifestMagic || version != s_ManifestVersion)
+            {
+                OLO_CORE_WARN("AssetPackBuilder: Ignoring unreadable build manifest '{}'", manifestPath.string());
+                return {};
+            }
+            // Written after the pack it describes; a pack replaced since (a failed or
+            // non-incremental build) no longer matches it.
+            if (manifestPackSize != packSize)
+            {
+                OLO_CORE_WARN("AssetPackBuilder: Build manifest '{}' does not describe '{}'; rebuilding everything",
+                              manifestPath.string(), packPath.string());
+                return {};
+            }
+
+            std::map<u64, DerivedDataKey> fingerprints;
+            for (u32 i = 0; i < count; ++i)
+            {
+                u64 handle = 0;
+                DerivedDataKey key;
+                if (!read(handle) || !read(key.High) || !read(key.Low))
+                {
+                    OLO_CORE_WARN("AssetPackBuilder: Build manifest '{}' is truncated", manifestPath.string());
+                    return {};
+                }
+                fingerprints[handle] = key;
+            }
+            return fingerprints;
+        }
+
+        bool WriteManifest(const std::filesystem::path& manifestPath, u64 packSize, const std::vector<std::pair<AssetHandle, DerivedDataKey>>& fingerprints)
+        {
+            std::ofstream file(manifestPath, std::ios::binary | std::ios::trunc);
+            const auto write = [&file](const auto& value)
+            {
+                file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+            };
+
+            write(s_ManifestMagic);
+            write(s_ManifestVersion);
+            write(packSize);
+            write(static_cast<u32>(fingerprints.size()));
+            for (const auto& [handle, key] : fingerprints)
+            {
+                write(static_cast<u64>(handle));
+                write(key.High);
+                write(key.Low);
+            }
+            return static_cast<bool>(file);
+        }
+
+        bool CopyBytes(std::istream& in, u64 size, FileStreamWriter& out)
+        {
+            std::vector<char> buffer(static_cast<sizet>(std::min(size, s_CopyChunkBytes)));
+            while (size > 0)
+            {
+                const sizet chunk = static_cast<sizet>(std::min<u64>(size, buffer.size()));
+                in.read(buffer.data(), static_cast<std::streamsize>(chunk));
+                // Never write the stale tail of the buffer after a short read.
+                if (static_cast<sizet>(in.gcount()) != chunk || !out.WriteData(buffer.data(), chunk))
+                    return false;
+                size -= chunk;
+            }
+            return true;
+        }
+
+        // What an asset's pack payload is derived from: its source file (plus the buffer
+        // and material files beside it for formats that keep data there), its project-
+        // relative path, which records embed, the pack version and the cook policy.
+        // Payloads themselves cannot be compared across builds (texture records carry a
+        // build timestamp), and they refer to other assets only by handle, so an asset's
+        // own sources decide whether its previous payload is still current.
+        class SourceFingerprinter
+        {
+          public:
+            SourceFingerprinter(const Ref<AssetManagerBase>& assetManager, bool compressAssets)
+                : m_AssetManager(assetManager), m_EditorAssetManager(assetManager.As<EditorAssetManager>()), m_CompressAssets(compressAssets)
+            {
+            }
+
+            // Resolves the source paths; call on the building thread before Compute.
+            void Prepare(const std::vector<AssetHandle>& assets)
+            {
+                for (const AssetHandle handle : assets)
+                {
+                    const AssetMetadata metadata = m_AssetManager->GetAssetMetadata(handle);
+                    if (metadata.FilePath.empty())
+                        continue;
+
+                    Source& source = m_Sources[static_cast<u64>(handle)];
+                    source.RelativePath = metadata.FilePath.generic_string();
+                    source.Path = ResolvePath(metadata);
+                    if (ReadsSiblingFiles(source.Path))
+                        m_Directories.try_emplace(source.Path.parent_path().generic_string());
+                }
+
+                // Each directory is hashed once however many meshes share it.
+                std::vector<std::pair<const std::string, std::optional<DerivedDataKey>>*> directories;
+                directories.reserve(m_Directories.size());
+                for (auto& entry : m_Directories)
+                    directories.push_back(&entry);
+                ParallelFor("AssetPackBuilder::HashSourceDirectories", static_cast<i32>(directories.size()), 1,
+                            [&directories](i32 index)
+                            {
+                                auto& [directory, key] = *directories[index];
+                                key = HashDirectory(directory);
+                            });
+            }
+
+            // Empty when the asset has no source file (a memory-only asset) or a source
+            // cannot be read; such an asset is always serialized afresh.
+            [[nodiscard]] std::optional<DerivedDataKey> Compute(AssetHandle handle, AssetType type) const
+            {
+                const auto it = m_Sources.find(static_cast<u64>(handle));
+                if (it == m_Sources.end())
+                    return std::nullopt;
+                const Source& source = it->second;
+
+                DerivedDataKeyBuilder builder("AssetPackPayload", s_PayloadFingerprintVersion);
+                builder.AppendValue(AssetPackFile::Version)
+                    .AppendValue(std::to_underlying(type))
+                    .AppendValue(m_CompressAssets)
+                    .Append(source.RelativePath);
+                if (type == AssetType::MeshSource)
+                    builder.AppendValue(VirtualMeshSerializer::CurrentCookFingerprint());
+                if (!builder.AppendFile(source.Path))
+                    return std::nullopt;
+
+                if (ReadsSiblingFiles(source.Path))
+                {
+                    const auto dir = m_Directories.find(source.Path.parent_path().generic_string());
+                    if (dir == m_Directories.end() || !dir->second)
+                        return std::nullopt;
+                    builder.AppendValue(dir->second->High).AppendValue(dir->second->Low);
+                }
+                return builder.Build();
+            }
+
+          private:
+            struct Source
+            {
+                std::filesystem::path Path;
+                std::string RelativePath;
+            };
+
+            std::filesystem::path ResolvePath(const AssetMetadata& metadata) const
+            {
+                if (m_EditorAssetManager)
+                    return m_EditorAssetManager->GetFileSystemPath(metadata);
+                if (metadata.FilePath.is_absolute())
+                    return metadata.FilePath;
+                return Project::GetProjectDirectory() / metadata.FilePath;
+            }
+
+            static std::optional<DerivedDataKey> HashDirectory(const std::filesystem::path& directory)
+            {
+                std::vector<std::filesystem::path> files;
+                std::error_code ec;
+                for (const auto& entry : std::filesystem::directory_iterator(directory, ec))
+                {
+                    if (std::error_code entryEc; entry.is_regular_file(entryEc) && IsSiblingDependency(entry.path()))
+                        files.push_back(entry.path());
+                }
+                if (ec)
+                    return std::nullopt;
+                std::ranges::sort(files);
+
+                DerivedDataKeyBuilder builder("AssetPackSourceDirectory", s_PayloadFingerprintVersion);
+                for (const std::filesystem::path& file : files)
+                {
+                    builder.Append(file.filename().generic_string());
+                    if (!builder.AppendFile(file))
+                        return std::nullopt;
+                }
+                return builder.Build();
+            }
+
+            Ref<AssetManagerBase> m_AssetManager;
+            Ref<EditorAssetManager> m_EditorAssetManager;
+            bool m_CompressAssets;
+            std::unordered_map<u64, Source> m_Sources;
+            std::map<std::string, std::optional<DerivedDataKey>> m_Directories;
+        };
+    } // namespace
+
     AssetPackBuilder::BuildResult AssetPackBuilder::BuildFromActiveProject(const BuildSettings& settings, std::atomic<f32>& progress, const std::atomic<bool>* cancelToken)
     {
         OLO_PROFILE_FUNCTION();
@@ -136,40 +403,12 @@ namespace OloEngine
                 return { false, "Build cancelled by user", 0, 0, {} };
             }
 
-            // Use the existing BuildImpl with the temporary asset manager
-            // The progress will start from 0.3 (30% for loading) and go to 1.0
-
-            // Create a wrapper to update our main progress from BuildImpl's progress
-            std::atomic<f32> internalProgress = 0.0f;
-            std::atomic<bool> progressUpdateActive = true;
-
-            // Launch progress forwarding task using Task System
-            Tasks::Launch(
-                "AssetPackBuilder_ProgressForward",
-                [&progressUpdateActive, &progress, &internalProgress]()
-                {
-                    while (progressUpdateActive.load(std::memory_order_acquire))
-                    {
-                        float internal = internalProgress.load(std::memory_order_relaxed);
-                        progress.store(0.3f + (internal * 0.7f), std::memory_order_relaxed);
-                        std::this_thread::sleep_for(std::chrono::milliseconds(10));
-                    }
-                },
-                Tasks::ETaskPriority::BackgroundNormal);
-
-            // Call the existing implementation with the populated temporary manager
-            result = BuildImpl(tempAssetManager, settings, internalProgress, cancelToken);
-
-            // Stop progress forwarding and wait briefly for task to notice
-            progressUpdateActive.store(false, std::memory_order_release);
-            std::this_thread::sleep_for(std::chrono::milliseconds(20)); // Give task time to exit
+            // Loading took the first 30%; BuildImpl reports straight into the rest.
+            result = BuildImpl(tempAssetManager, settings, progress, cancelToken, 0.3f, 1.0f);
 
             // Clean up the temporary asset manager
             tempAssetManager->Shutdown();
 
-            // Update final progress
-            progress = result.m_Success ? 1.0f : internalProgress.load();
-
             return result;
         }
         catch (const std::exception& e)
@@ -184,11 +423,16 @@ namespace OloEngine
         }
     }
 
-    AssetPackBuilder::BuildResult AssetPackBuilder::BuildImpl(Ref<AssetManagerBase> assetManager, const BuildSettings& settings, std::atomic<f32>& progress, const std::atomic<bool>* cancelToken)
+    AssetPackBuilder::BuildResult AssetPackBuilder::BuildImpl(Ref<AssetManagerBase> assetManager, const BuildSettings& settings, std::atomic<f32>& progress, const std::atomic<bool>* cancelToken,
+                                                              f32 progressBegin, f32 progressEnd)
     {
         OLO_PROFILE_FUNCTION();
 
-        progress = 0.0f;
+        const auto reportProgress = [&progress, progressBegin, progressEnd](f32 fraction)
+        {
+            progress.store(progressBegin + (progressEnd - progressBegin) * fraction, std::memory_order_relaxed);
+        };
+        reportProgress(0.0f);
 
         BuildResult result;
         result.m_OutputPath = settings.m_OutputPath;
@@ -211,7 +455,7 @@ namespace OloEngine
                     result.m_ErrorMessage = "Asset validation failed";
                     return result;
                 }
-                progress = 0.1f;
+                reportProgress(0.1f);
 
                 // Check for cancellation after validation
                 if (cancelToken && cancelToken->load(std::memory_order_acquire))
@@ -224,17 +468,39 @@ namespace OloEngine
             // Create output directory if it doesn't exist
             std::filesystem::create_directories(settings.m_OutputPath.parent_path());
 
+            // Blobs and the pack under construction live beside the output, on the same
+            // volume, so publishing the pack is a rename. The previous pack stays intact
+            // (and readable, for an incremental build) until then.
+            const std::string buildSuffix = UniqueBuildSuffix();
+            std::filesystem::path stagingDir = settings.m_OutputPath;
+            stagingDir += ".staging-" + buildSuffix;
+            std::filesystem::path partialPath = settings.m_OutputPath;
+            partialPath += "." + buildSuffix + ".partial";
+            struct StagingScope
+            {
+                const std::filesystem::path& Dir;
+                const std::filesystem::path& Partial;
+                ~StagingScope()
+                {
+                    std::error_code ec;
+                    std::filesystem::remove_all(Dir, ec);
+                    std::filesystem::remove(Partial, ec);
+                }
+            } stagingScope{ stagingDir, partialPath };
+            std::filesystem::create_directories(stagingDir);
+
             // Initialize asset pack file structure
             AssetPackFile assetPackFile;
 
             // The index table starts immediately after the header
-            assetPackFile.Header.IndexOffset = sizeof(AssetPackFile::FileHeader);
+            assetPackFile.Header.IndexOffset = s_HeaderBytes;
 
             // Serialize all assets. Enable the texture cook policy (#440) for the duration
             // of serialization so uncompressed source textures get BC-compressed into
             // embedded .olotex blobs when m_CompressAssets is set. The guard resets it on
             // every exit path (success, error, or the exception handler below).
-            OLO_CORE_INFO("AssetPackBuilder: Serializing assets... (texture compression: {})", settings.m_CompressAssets ? "on" : "off");
+            OLO_CORE_INFO("AssetPackBuilder: Serializing assets... (texture compression: {}, incremental: {})",
+                          settings.m_CompressAssets ? "on" : "off", settings.m_Incremental ? "on" : "off");
             struct TextureCookScope
             {
                 explicit TextureCookScope(bool enabled)
@@ -249,13 +515,25 @@ namespace OloEngine
                 TextureCookScope& operator=(const TextureCookScope&) = delete;
             } cookScope(settings.m_CompressAssets);
 
-            if (!SerializeAllAssets(assetManager, assetPackFile, progress, cancelToken))
+            // Get script module binary if requested; it sits ahead of the payloads.
+            ScopedBuffer scriptModuleBinary(settings.m_IncludeScriptModule ? GetScriptModuleBinary() : Buffer{});
+            if (settings.m_IncludeScriptModule)
+            {
+                OLO_CORE_INFO("AssetPackBuilder: Script module binary size: {} bytes", scriptModuleBinary.Size());
+            }
+
+            std::vector<PayloadSource> payloads;
+            std::vector<std::pair<AssetHandle, DerivedDataKey>> fingerprints;
+            if (!SerializeAllAssets(assetManager, settings, stagingDir, scriptModuleBinary.Size(), assetPackFile, payloads, fingerprints,
+                                    [&reportProgress](f32 fraction)
+                                    { reportProgress(0.1f + 0.7f * fraction); },
+                                    cancelToken))
             {
                 result.m_ErrorMessage = "Failed to serialize assets or build was cancelled";
                 return result;
             }
 
-            progress = 0.8f;
+            reportProgress(0.8f);
 
             // Check for cancellation after serialization
             if (cancelToken && cancelToken->load(std::memory_order_acquire))
@@ -264,148 +542,141 @@ namespace OloEngine
                 return { false, "Build cancelled by user", 0, 0, {} };
             }
 
-            // Get script module binary if requested
-            Buffer scriptModuleBinary;
-            if (settings.m_IncludeScriptModule)
-            {
-                scriptModuleBinary = GetScriptModuleBinary();
-                OLO_CORE_INFO("AssetPackBuilder: Script module binary size: {} bytes", scriptModuleBinary.Size);
-            }
-
-            progress = 0.9f;
-
             // Serialize the pack to file
             OLO_CORE_INFO("AssetPackBuilder: Writing asset pack to: {}", settings.m_OutputPath.string());
 
-            FileStreamWriter writer(settings.m_OutputPath);
-            if (!writer.IsStreamGood())
             {
-                result.m_ErrorMessage = "Failed to create output file: " + settings.m_OutputPath.string();
-                return result;
-            }
-
-            // Write header
-            writer.WriteRaw(assetPackFile.Header.MagicNumber);
-            writer.WriteRaw(assetPackFile.Header.Version);
-            writer.WriteRaw(assetPackFile.Header.BuildVersion);
-            writer.WriteRaw(assetPackFile.Header.IndexOffset);
-
-            // Write index
-            writer.WriteRaw(assetPackFile.Index.AssetCount);
-            writer.WriteRaw(assetPackFile.Index.SceneCount);
-            writer.WriteRaw(assetPackFile.Index.PackedAppBinaryOffset);
-            writer.WriteRaw(assetPackFile.Index.PackedAppBinarySize);
+                FileStreamWriter writer(partialPath);
+                if (!writer.IsStreamGood())
+                {
+                    result.m_ErrorMessage = "Failed to create output file: " + partialPath.string();
+                    return result;
+                }
 
-            // Write asset infos — field order must match AssetPack::Load read order
-            for (const auto& assetInfo : assetPackFile.AssetInfos)
-            {
-                writer.WriteRaw(assetInfo.Handle);
-                writer.WriteRaw(assetInfo.PackedOffset);
-                writer.WriteRaw(assetInfo.PackedSize);
-                writer.WriteRaw(assetInfo.Type);
-                writer.WriteRaw(assetInfo.Flags);
-            }
+                // Write header
+                writer.WriteRaw(assetPackFile.Header.MagicNumber);
+                writer.WriteRaw(assetPackFile.Header.Version);
+                writer.WriteRaw(assetPackFile.Header.BuildVersion);
+                writer.WriteRaw(assetPackFile.Header.IndexOffset);
 
-            // Write scene infos
-            for (const auto& sceneInfo : assetPackFile.SceneInfos)
-            {
-                writer.WriteRaw(sceneInfo.Handle);
-                writer.WriteRaw(sceneInfo.PackedOffset);
-                writer.WriteRaw(sceneInfo.PackedSize);
-                writer.WriteRaw(sceneInfo.Flags);
+                // Write index
+                writer.WriteRaw(assetPackFile.Index.AssetCount);
+                writer.WriteRaw(assetPackFile.Index.SceneCount);
+                writer.WriteRaw(assetPackFile.Index.PackedAppBinaryOffset);
+                writer.WriteRaw(assetPackFile.Index.PackedAppBinarySize);
 
-                // Write scene assets map
-                u32 sceneAssetCount = static_cast<u32>(sceneInfo.Assets.size());
-                writer.WriteRaw(sceneAssetCount);
-                for (const auto& [handle, assetInfo] : sceneInfo.Assets)
+                // Write asset infos — field order must match AssetPack::Load read order
+                for (const auto& assetInfo : assetPackFile.AssetInfos)
                 {
-                    writer.WriteRaw(handle);
                     writer.WriteRaw(assetInfo.Handle);
                     writer.WriteRaw(assetInfo.PackedOffset);
                     writer.WriteRaw(assetInfo.PackedSize);
                     writer.WriteRaw(assetInfo.Type);
                     writer.WriteRaw(assetInfo.Flags);
                 }
-            }
-
-            // Write script module binary
-            writer.WriteRaw(static_cast<u32>(scriptModuleBinary.Size));
-            if (scriptModuleBinary.Size > 0)
-            {
-                writer.WriteData(reinterpret_cast<const char*>(scriptModuleBinary.Data), scriptModuleBinary.Size);
-            }
 
-            // Write actual asset data from temporary files
-            for (const auto& [handle, tempFilePath] : assetPackFile.TempAssetFiles)
-            {
-                if (std::filesystem::exists(tempFilePath))
+                // Write scene infos
+                for (const auto& sceneInfo : assetPackFile.SceneInfos)
                 {
-                    // Read the temporary file and write its contents to the main pack file
-                    if (std::ifstream tempFile(tempFilePath, std::ios::binary); tempFile.is_open())
+                    writer.WriteRaw(sceneInfo.Handle);
+                    writer.WriteRaw(sceneInfo.PackedOffset);
+                    writer.WriteRaw(sceneInfo.PackedSize);
+                    writer.WriteRaw(sceneInfo.Flags);
+
+                    // Write scene assets map
+                    u32 sceneAssetCount = static_cast<u32>(sceneInfo.Assets.size());
+                    writer.WriteRaw(sceneAssetCount);
+                    for (const auto& [handle, assetInfo] : sceneInfo.Assets)
                     {
-                        // Get file size
-                        tempFile.seekg(0, std::ios::end);
-                        sizet fileSize = tempFile.tellg();
-                        tempFile.seekg(0, std::ios::beg);
-
-                        // Read and write data in chunks
-                        constexpr sizet bufferSize = 8192;
-                        char buffer[bufferSize];
-                        sizet remainingBytes = fileSize;
+                        writer.WriteRaw(handle);
+                        writer.WriteRaw(assetInfo.Handle);
+                        writer.WriteRaw(assetInfo.PackedOffset);
+                        writer.WriteRaw(assetInfo.PackedSize);
+                        writer.WriteRaw(assetInfo.Type);
+                        writer.WriteRaw(assetInfo.Flags);
+                    }
+                }
 
-                        while (remainingBytes > 0)
-                        {
-                            const sizet bytesToRead = std::min(bufferSize, remainingBytes);
-                            tempFile.read(buffer, static_cast<std::streamsize>(bytesToRead));
+                // Write script module binary
+                writer.WriteRaw(static_cast<u32>(scriptModuleBinary.Size()));
+                if (scriptModuleBinary.Size() > 0)
+                {
+                    writer.WriteData(reinterpret_cast<const char*>(scriptModuleBinary.Data()), scriptModuleBinary.Size());
+                }
 
-                            // gcount() reflects what was actually read; on a short read or error
-                            // it is less than requested, so never write the stale tail of the buffer.
-                            const sizet actualBytesRead = static_cast<sizet>(tempFile.gcount());
-                            if (actualBytesRead > 0)
-                            {
-                                writer.WriteData(buffer, actualBytesRead);
-                                remainingBytes -= actualBytesRead;
-                            }
+                // Payloads, in the order SerializeAllAssets laid them out: a fresh blob is
+                // appended whole, a reused payload is copied out of the previous pack.
+                std::ifstream previousPack;
+                if (std::ranges::any_of(payloads, &PayloadSource::m_Reused))
+                {
+                    previousPack.open(settings.m_PreviousPackPath.empty() ? settings.m_OutputPath : settings.m_PreviousPackPath, std::ios::binary);
+                }
 
-                            // Bail out if the stream went bad / hit EOF before all expected bytes
-                            // were read, rather than spinning forever writing nothing.
-                            if (actualBytesRead < bytesToRead)
-                            {
-                                result.m_ErrorMessage =
-                                    "Failed to read temporary asset file: " + tempFilePath.string();
-                                // Best-effort cleanup: close the stream so the temp
-                                // file is no longer held open, then remove it so we
-                                // don't leak entries on every failed build.
-                                tempFile.close();
-                                std::error_code removeEc;
-                                std::filesystem::remove(tempFilePath, removeEc);
-                                return result;
-                            }
-                        }
+                for (sizet i = 0; i < payloads.size(); ++i)
+                {
+                    if (cancelToken && cancelToken->load(std::memory_order_acquire))
+                    {
+                        OLO_CORE_INFO("AssetPackBuilder: Build cancelled while writing the pack");
+                        return { false, "Build cancelled by user", 0, 0, {} };
+                    }
 
-                        tempFile.close();
+                    const PayloadSource& payload = payloads[i];
+                    bool copied = false;
+                    if (payload.m_Reused)
+                    {
+                        previousPack.seekg(static_cast<std::streamoff>(payload.m_PreviousOffset));
+                        copied = previousPack && CopyBytes(previousPack, payload.m_Size, writer);
                     }
-                    else
+                    else if (std::ifstream blob(payload.m_BlobPath, std::ios::binary); blob.is_open())
                     {
-                        OLO_CORE_ERROR("AssetPackBuilder: Failed to read temporary file: {}", tempFilePath.string());
+                        copied = CopyBytes(blob, payload.m_Size, writer);
                     }
 
-                    // Clean up temporary file
-                    std::filesystem::remove(tempFilePath);
+                    if (!copied)
+                    {
+                        result.m_ErrorMessage = fmt::format("Failed to copy the payload of asset {} into the pack", payload.m_Handle);
+                        return result;
+                    }
+
+                    // A blob is dead weight once it is in the pack.
+                    if (!payload.m_Reused)
+                    {
+                        std::error_code ec;
+                        std::filesystem::remove(payload.m_BlobPath, ec);
+                    }
+                    reportProgress(0.8f + 0.15f * static_cast<f32>(i + 1) / static_cast<f32>(payloads.size()));
                 }
-                else
+
+                if (!writer.IsStreamGood())
                 {
-                    OLO_CORE_ERROR("AssetPackBuilder: Temporary file not found: {}", tempFilePath.string());
+                    result.m_ErrorMessage = "Failed to write asset pack file";
+                    return result;
                 }
             }
 
-            // Clear temporary file list
-            assetPackFile.TempAssetFiles.clear();
-
-            if (!writer.IsStreamGood())
+            // Publish. The manifest goes second and records the pack's size, so a crash
+            // between the two leaves a manifest the next build rejects.
+            const std::filesystem::path manifestPath = ManifestPathFor(settings.m_OutputPath);
             {
-                result.m_ErrorMessage = "Failed to write asset pack file";
-                return result;
+                std::error_code ec;
+                std::filesystem::remove(manifestPath, ec);
+                std::filesystem::rename(partialPath, settings.m_OutputPath, ec);
+                if (ec)
+                {
+                    result.m_ErrorMessage = "Failed to move the asset pack into place: " + ec.message();
+                    return result;
+                }
+            }
+            if (settings.m_Incremental)
+            {
+                std::error_code ec;
+                const u64 packSize = std::filesystem::file_size(settings.m_OutputPath, ec);
+                if (ec || !WriteManifest(manifestPath, packSize, fingerprints))
+                {
+                    // Costs the next build its reuse, not this one its pack.
+                    OLO_CORE_WARN("AssetPackBuilder: Failed to write build manifest '{}'", manifestPath.string());
+                    std::filesystem::remove(manifestPath, ec);
+                }
             }
 
             // Copy localization files alongside the .olopack as loose files.
@@ -478,12 +749,14 @@ namespace OloEngine
                 }
             }
 
-            progress = 1.0f;
+            reportProgress(1.0f);
 
             // Success!
             result.m_Success = true;
             result.m_AssetCount = assetPackFile.Index.AssetCount;
             result.m_SceneCount = assetPackFile.Index.SceneCount;
+            result.m_ReusedAssetCount = static_cast<sizet>(std::ranges::count_if(payloads, &PayloadSource::m_Reused));
+            result.m_SerializedAssetCount = payloads.size() - result.m_ReusedAssetCount;
 
             OLO_CORE_INFO("AssetPackBuilder: Successfully built asset pack with {} assets, {} scenes",
                           result.m_AssetCount, result.m_SceneCount);
@@ -498,168 +771,247 @@ namespace OloEngine
         }
     }
 
-    [[nodiscard]] bool AssetPackBuilder::SerializeAllAssets(Ref<AssetManagerBase> assetManager, AssetPackFile& assetPackFile, std::atomic<f32>& progress, const std::atomic<bool>* cancelToken)
+    [[nodiscard]] bool AssetPackBuilder::SerializeAllAssets(Ref<AssetManagerBase> assetManager, const BuildSettings& settings, const std::filesystem::path& stagingDir,
+                                                            u64 scriptModuleBytes, AssetPackFile& assetPackFile, std::vector<PayloadSource>& outPayloads,
+                                                            std::vector<std::pair<AssetHandle, DerivedDataKey>>& outFingerprints,
+                                                            const std::function<void(f32)>& reportProgress, const std::atomic<bool>* cancelToken)
     {
         OLO_PROFILE_FUNCTION();
 
-        // Get all loaded assets from the asset manager
-        auto loadedAssets = assetManager->GetLoadedAssets();
-
-        assetPackFile.Index.AssetCount = static_cast<u32>(loadedAssets.size());
-        assetPackFile.Index.SceneCount = 0; // Will be calculated as we process
-
-        f32 assetProgress = 0.1f;                                            // Start from validation progress
-        f32 progressPerAsset = 0.7f / static_cast<f32>(loadedAssets.size()); // Reserve 0.7 for asset processing
-
-        std::unordered_set<AssetHandle> processedAssets;
-
-        // First pass: Create asset info structures and count assets
-        for (const auto& [handle, asset] : loadedAssets)
+        const auto isCancelled = [cancelToken]
         {
-            // Check for cancellation at the start of each asset processing
-            if (cancelToken && cancelToken->load(std::memory_order_acquire))
-            {
-                OLO_CORE_INFO("AssetPackBuilder: SerializeAllAssets cancelled during first pass");
-                return false;
-            }
+            return cancelToken && cancelToken->load(std::memory_order_acquire);
+        };
 
-            if (processedAssets.find(handle) != processedAssets.end())
-                continue;
-
-            processedAssets.insert(handle);
+        // Handle order, not hash-map order: the same project always packs to the same bytes.
+        std::vector<std::pair<AssetHandle, AssetType>> assets;
+        for (const auto& [handle, asset] : assetManager->GetLoadedAssets())
+        {
+            if (asset)
+                assets.emplace_back(handle, asset->GetAssetType());
+        }
+        std::ranges::sort(assets, {}, [](const auto& entry)
+                          { return static_cast<u64>(entry.first); });
 
-            // Create asset info
-            AssetPackFile::AssetInfo assetInfo;
-            assetInfo.Handle = handle;
-            assetInfo.Type = static_cast<AssetType>(asset->GetAssetType());
-            assetInfo.PackedOffset = 0; // Will be calculated during serialization pass
-            assetInfo.PackedSize = 0;   // Will be calculated during serialization pass
-            assetInfo.Flags = 0;
+        assetPackFile.Index.AssetCount = static_cast<u32>(assets.size());
+        assetPackFile.Index.SceneCount = 0;
 
-            // Count scenes separately
-            if (assetInfo.Type == AssetType::Scene)
+        // A scene's AssetInfo is a type-only record; its bytes are addressed by its
+        // SceneInfo. Payloads go non-scene assets first, then scenes.
+        std::vector<PayloadSource> payloads;
+        std::vector<PayloadSource> scenePayloads;
+        for (const auto& [handle, type] : assets)
+        {
+            assetPackFile.AssetInfos.push_back({ handle, 0, 0, type, 0 });
+            PayloadSource payload;
+            payload.m_Handle = handle;
+            payload.m_Type = type;
+            if (type == AssetType::Scene)
             {
                 ++assetPackFile.Index.SceneCount;
-
-                // Create scene info
                 AssetPackFile::SceneInfo sceneInfo;
                 sceneInfo.Handle = handle;
-                sceneInfo.PackedOffset = 0; // Will be calculated during serialization pass
-                sceneInfo.PackedSize = 0;   // Will be calculated during serialization pass
                 assetPackFile.SceneInfos.push_back(sceneInfo);
+                scenePayloads.push_back(payload);
+            }
+            else
+            {
+                payloads.push_back(payload);
             }
-
-            assetPackFile.AssetInfos.push_back(assetInfo);
-
-            assetProgress += progressPerAsset * 0.5f; // Use half progress for first pass
-            progress = assetProgress;
-        }
-
-        // Second pass: Actually serialize assets and calculate offsets/sizes
-        // We calculate the data layout first, then write everything in order
-        u64 headerSize = sizeof(AssetPackFile::FileHeader);
-        u64 indexSize = sizeof(AssetPackFile::IndexTable);
-        u64 assetInfosSize = assetPackFile.AssetInfos.size() * sizeof(AssetPackFile::AssetInfo);
-        u64 sceneInfosSize = 0;
-        for (const auto& sceneInfo : assetPackFile.SceneInfos)
-        {
-            sceneInfosSize += sizeof(AssetHandle) + sizeof(u64) + sizeof(u64) + sizeof(u16); // Basic scene info
-            sceneInfosSize += sizeof(u32);                                                   // Scene asset count
-            sceneInfosSize += sceneInfo.Assets.size() * sizeof(AssetPackFile::AssetInfo);    // Scene assets
         }
+        payloads.insert(payloads.end(), scenePayloads.begin(), scenePayloads.end());
 
-        Buffer scriptModuleBinary = GetScriptModuleBinary();
-        u64 scriptBinarySize = sizeof(u32) + scriptModuleBinary.Size; // Size field + data
-
-        u64 assetDataStartOffset = headerSize + indexSize + assetInfosSize + sceneInfosSize + scriptBinarySize;
-        u64 currentOffset = assetDataStartOffset;
-
-        // Create temporary files for each asset and calculate sizes
-        std::vector<std::pair<AssetHandle, std::filesystem::path>> tempAssetFiles;
-
-        // Process regular assets
-        for (auto& assetInfo : assetPackFile.AssetInfos)
+        // Incremental: fingerprint every source, and reuse the previous pack's bytes for
+        // each asset whose fingerprint the previous build recorded unchanged.
+        std::vector<std::optional<DerivedDataKey>> fingerprints(payloads.size());
+        sizet reusedCount = 0;
+        if (settings.m_Incremental)
         {
-            // Check for cancellation at the start of each asset serialization
-            if (cancelToken && cancelToken->load(std::memory_order_acquire))
+            std::vector<AssetHandle> handles;
+            handles.reserve(payloads.size());
+            for (const PayloadSource& payload : payloads)
+                handles.push_back(payload.m_Handle);
+
+            SourceFingerprinter fingerprinter(assetManager, settings.m_CompressAssets);
+            fingerprinter.Prepare(handles);
+            ParallelFor("AssetPackBuilder::FingerprintSources", static_cast<i32>(payloads.size()), 1,
+                        [&](i32 index)
+                        {
+                            if (!isCancelled())
+                                fingerprints[index] = fingerprinter.Compute(payloads[index].m_Handle, payloads[index].m_Type);
+                        });
+            if (isCancelled())
             {
-                OLO_CORE_INFO("AssetPackBuilder: SerializeAllAssets cancelled during second pass");
-                // Clean up any temporary files created so far
-                for (const auto& [handle, tempPath] : tempAssetFiles)
-                {
-                    std::error_code ec;
-                    std::filesystem::remove(tempPath, ec);
-                }
+                OLO_CORE_INFO("AssetPackBuilder: SerializeAllAssets cancelled while fingerprinting sources");
                 return false;
             }
 
-            if (assetInfo.Type == AssetType::Scene)
-                continue; // Scenes are handled separately
-
-            // Create a temporary file for this asset
-            std::filesystem::path tempPath = std::filesystem::temp_directory_path() / ("olo_asset_" + std::to_string(assetInfo.Handle) + ".tmp");
-            FileStreamWriter tempWriter(tempPath);
+            const std::filesystem::path previousPackPath = settings.m_PreviousPackPath.empty() ? settings.m_OutputPath : settings.m_PreviousPackPath;
+            const std::map<u64, DerivedDataKey> previousFingerprints = ReadManifest(ManifestPathFor(previousPackPath), previousPackPath);
+            if (!previousFingerprints.empty())
+            {
+                Ref<AssetPack> previousPack = AssetPack::Create();
+                if (const AssetPackLoadResult load = previousPack->Load(previousPackPath); load.Success)
+                {
+                    for (sizet i = 0; i < payloads.size(); ++i)
+                    {
+                        PayloadSource& payload = payloads[i];
+                        const auto previous = previousFingerprints.find(static_cast<u64>(payload.m_Handle));
+                        if (!fingerprints[i] || previous == previousFingerprints.end() || previous->second != *fingerprints[i])
+                            continue;
 
-            // Record the starting position
-            assetInfo.PackedOffset = currentOffset;
+                        std::optional<std::pair<u64, u64>> range;
+                        if (payload.m_Type == AssetType::Scene)
+                        {
+                            if (const auto info = previousPack->GetSceneInfo(payload.m_Handle))
+                                range.emplace(info->PackedOffset, info->PackedSize);
+                        }
+                        else if (const auto info = previousPack->GetAssetInfo(payload.m_Handle); info && info->Type == payload.m_Type)
+                        {
+                            range.emplace(info->PackedOffset, info->PackedSize);
+                        }
 
-            // Serialize the asset
-            if (AssetSerializationInfo serializationInfo; AssetImporter::SerializeToAssetPack(assetInfo.Handle, tempWriter, serializationInfo))
-            {
-                assetInfo.PackedSize = serializationInfo.Size;
-                tempAssetFiles.emplace_back(assetInfo.Handle, tempPath);
-                currentOffset += assetInfo.PackedSize;
+                        // A zero-size record is a failed serialization; retry it.
+                        if (range && range->second > 0)
+                        {
+                            payload.m_Reused = true;
+                            payload.m_PreviousOffset = range->first;
+                            payload.m_Size = range->second;
+                            ++reusedCount;
+                        }
+                    }
+                }
+                else
+                {
+                    OLO_CORE_WARN("AssetPackBuilder: Cannot reuse previous pack '{}': {}", previousPackPath.string(), load.ErrorMessage);
+                }
+                previousPack->Unload();
             }
             else
             {
-                OLO_CORE_ERROR("AssetPackBuilder: Failed to serialize asset with handle: {}", assetInfo.Handle);
-                assetInfo.PackedSize = 0;
+                OLO_CORE_INFO("AssetPackBuilder: No usable build manifest beside '{}'; serializing every asset", previousPackPath.string());
             }
+        }
 
-            assetProgress += progressPerAsset * 0.5f; // Use remaining progress for second pass
-            progress = assetProgress;
+        // Resolve every asset to serialize on this thread first: a load may create GPU
+        // resources, which only this thread may do. Serialization itself reads CPU-side
+        // state and fans out across a bounded pool of workers, one blob per asset.
+        std::vector<u32> pending;
+        for (u32 i = 0; i < static_cast<u32>(payloads.size()); ++i)
+        {
+            if (payloads[i].m_Reused)
+                continue;
+            payloads[i].m_BlobPath = stagingDir / fmt::format("{}.blob", static_cast<u64>(payloads[i].m_Handle));
+            (void)AssetManager::GetAsset<Asset>(payloads[i].m_Handle);
+            pending.push_back(i);
         }
 
-        // Process scene assets
-        for (auto& sceneInfo : assetPackFile.SceneInfos)
+        OLO_CORE_INFO("AssetPackBuilder: Serializing {} assets, reusing {} from the previous pack", pending.size(), reusedCount);
+
+        std::atomic<u32> completed = 0;
+        std::vector<u8> succeeded(payloads.size(), 0);
+        const auto serialize = [&](u32 payloadIndex)
         {
-            // Check for cancellation at the start of each scene processing
-            if (cancelToken && cancelToken->load(std::memory_order_acquire))
+            PayloadSource& payload = payloads[payloadIndex];
+            try
             {
-                OLO_CORE_INFO("AssetPackBuilder: SerializeAllAssets cancelled during scene processing");
-                // Clean up any temporary files created so far
-                for (const auto& [handle, tempPath] : tempAssetFiles)
+                FileStreamWriter blobWriter(payload.m_BlobPath);
+                AssetSerializationInfo serializationInfo;
+                if (AssetImporter::SerializeToAssetPack(payload.m_Handle, blobWriter, serializationInfo) && blobWriter.IsStreamGood())
                 {
-                    std::error_code ec;
-                    std::filesystem::remove(tempPath, ec);
+                    payload.m_Size = serializationInfo.Size;
+                    succeeded[payloadIndex] = 1;
                 }
-                return false;
             }
+            catch (const std::exception& e)
+            {
+                OLO_CORE_ERROR("AssetPackBuilder: Exception serializing asset {}: {}", payload.m_Handle, e.what());
+            }
+
+            if (!succeeded[payloadIndex])
+            {
+                OLO_CORE_ERROR("AssetPackBuilder: Failed to serialize asset with handle: {}", payload.m_Handle);
+                payload.m_Size = 0;
+            }
+            reportProgress(static_cast<f32>(completed.fetch_add(1, std::memory_order_relaxed) + 1) / static_cast<f32>(pending.size()));
+        };
+
+        // A fixed pool of asset workers pulling the next index, rather than one task per
+        // asset, so no more than `assetWorkers` sources are decoded at once (a texture
+        // serializer holds its full-resolution source while it BC-encodes it).
+        u32 maxConcurrentAssets = settings.m_MaxConcurrentAssets;
+        if (maxConcurrentAssets == 0)
+            maxConcurrentAssets = std::max(1u, LowLevelTasks::FScheduler::Get().GetNumWorkers());
+        const u32 assetWorkers = std::min(maxConcurrentAssets, static_cast<u32>(std::max<sizet>(pending.size(), 1)));
+
+        std::atomic<sizet> nextPending{ 0 };
+        const auto drain = [&]()
+        {
+            for (sizet i = nextPending.fetch_add(1, std::memory_order_relaxed); i < pending.size() && !isCancelled();
+                 i = nextPending.fetch_add(1, std::memory_order_relaxed))
+            {
+                serialize(pending[i]);
+            }
+        };
+
+        std::vector<Tasks::TTask<void>> workers;
+        workers.reserve(assetWorkers - 1);
+        for (u32 w = 1; w < assetWorkers; ++w)
+            workers.push_back(Tasks::Launch("AssetPackBuilder::SerializeAssets", [&drain]()
+                                            { drain(); }));
+        drain();
+        for (Tasks::TTask<void>& worker : workers)
+            worker.Wait();
+
+        if (isCancelled())
+        {
+            OLO_CORE_INFO("AssetPackBuilder: SerializeAllAssets cancelled while serializing");
+            return false;
+        }
+
+        // Lay out the payloads from the sizes actually written. A failed asset keeps its
+        // index entry with a zero size, as before, and contributes no bytes.
+        u64 sceneInfosSize = 0;
+        for (const auto& sceneInfo : assetPackFile.SceneInfos)
+            sceneInfosSize += s_SceneInfoBytes + sceneInfo.Assets.size() * (sizeof(u64) + s_AssetInfoBytes);
 
-            // Create a temporary file for this scene
-            std::filesystem::path tempPath = std::filesystem::temp_directory_path() / ("olo_scene_" + std::to_string(sceneInfo.Handle) + ".tmp");
-            FileStreamWriter tempWriter(tempPath);
+        const u64 assetDataStartOffset = s_HeaderBytes + s_IndexBytes + assetPackFile.AssetInfos.size() * s_AssetInfoBytes +
+                                         sceneInfosSize + sizeof(u32) + scriptModuleBytes;
+        u64 currentOffset = assetDataStartOffset;
 
-            // Record the starting position
-            sceneInfo.PackedOffset = currentOffset;
+        std::unordered_map<u64, sizet> assetInfoIndex;
+        for (sizet i = 0; i < assetPackFile.AssetInfos.size(); ++i)
+            assetInfoIndex[static_cast<u64>(assetPackFile.AssetInfos[i].Handle)] = i;
+        std::unordered_map<u64, sizet> sceneInfoIndex;
+        for (sizet i = 0; i < assetPackFile.SceneInfos.size(); ++i)
+            sceneInfoIndex[static_cast<u64>(assetPackFile.SceneInfos[i].Handle)] = i;
 
-            // Serialize the scene asset
-            AssetSerializationInfo serializationInfo;
-            if (AssetImporter::SerializeToAssetPack(sceneInfo.Handle, tempWriter, serializationInfo))
+        outPayloads.clear();
+        outFingerprints.clear();
+        for (sizet i = 0; i < payloads.size(); ++i)
+        {
+            PayloadSource& payload = payloads[i];
+            if (!payload.m_Reused && !succeeded[i])
+                continue;
+
+            if (payload.m_Type == AssetType::Scene)
             {
-                sceneInfo.PackedSize = serializationInfo.Size;
-                tempAssetFiles.emplace_back(sceneInfo.Handle, tempPath);
-                currentOffset += sceneInfo.PackedSize;
+                AssetPackFile::SceneInfo& sceneInfo = assetPackFile.SceneInfos[sceneInfoIndex.at(static_cast<u64>(payload.m_Handle))];
+                sceneInfo.PackedOffset = currentOffset;
+                sceneInfo.PackedSize = payload.m_Size;
             }
             else
             {
-                OLO_CORE_ERROR("AssetPackBuilder: Failed to serialize scene with handle: {}", sceneInfo.Handle);
-                sceneInfo.PackedSize = 0;
+                AssetPackFile::AssetInfo& assetInfo = assetPackFile.AssetInfos[assetInfoIndex.at(static_cast<u64>(payload.m_Handle))];
+                assetInfo.PackedOffset = currentOffset;
+                assetInfo.PackedSize = payload.m_Size;
             }
-        }
+            currentOffset += payload.m_Size;
 
-        // Store the temporary files for writing later
-        assetPackFile.TempAssetFiles = std::move(tempAssetFiles);
+            if (fingerprints[i])
+                outFingerprints.emplace_back(payload.m_Handle, *fingerprints[i]);
+            outPayloads.push_back(std::move(payload));
+        }
 
         OLO_CORE_INFO("AssetPackBuilder: Serialized {} assets ({} scenes), total size: {} bytes",
                       assetPackFile.Index.AssetCount, assetPackFile.Index.SceneCount, currentOffset - assetDataStartOffset);
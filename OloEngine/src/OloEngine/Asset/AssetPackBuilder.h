@@ -5,9 +5,13 @@
 #include "OloEngine/Asset/AssetManager.h"
 #include "OloEngine/Asset/AssetRegistry.h"
 #include "OloEngine/Asset/AssetPack.h"
+#include "OloEngine/Asset/DerivedDataCache.h"
 
 #include <filesystem>
 #include <atomic>
+#include <functional>
+#include <utility>
+#include <vector>
 
 namespace OloEngine
 {
@@ -31,6 +35,9 @@ namespace OloEngine
             sizet m_AssetCount = 0;
             sizet m_SceneCount = 0;
             std::filesystem::path m_OutputPath;
+            // Payloads written by this build vs copied out of the previous pack.
+            sizet m_SerializedAssetCount = 0;
+            sizet m_ReusedAssetCount = 0;
         };
 
         /**
@@ -48,6 +55,18 @@ namespace OloEngine
             // that LocalizationManager owns directly), so they need a
             // side-channel into the shipped game's working directory.
             bool m_IncludeLocalizationFiles = true;
+            // Reuse the payloads of assets whose sources have not changed since the
+            // previous pack, copying them byte-for-byte instead of re-serializing. Needs
+            // the previous pack and the `.manifest` file written beside it; without
+            // both, or if they do not match, every asset is serialized as usual.
+            bool m_Incremental = false;
+            // Where the previous pack lives. Empty means m_OutputPath, i.e. the pack
+            // being replaced.
+            std::filesystem::path m_PreviousPackPath;
+            // How many assets are serialized at once (0 = one per worker thread, 1 =
+            // all on the building thread). A texture serializer decodes and BC-encodes
+            // its whole source, so this bounds the sources held in memory together.
+            u32 m_MaxConcurrentAssets = 0;
         };
 
       public:
@@ -82,17 +101,45 @@ namespace OloEngine
          * @param cancelToken Optional cancellation token for cooperative cancellation
          * @return Build result
          */
-        static BuildResult BuildImpl(Ref<AssetManagerBase> assetManager, const BuildSettings& settings, std::atomic<f32>& progress, const std::atomic<bool>* cancelToken = nullptr);
+        static BuildResult BuildImpl(Ref<AssetManagerBase> assetManager, const BuildSettings& settings, std::atomic<f32>& progress, const std::atomic<bool>* cancelToken = nullptr,
+                                     f32 progressBegin = 0.0f, f32 progressEnd = 1.0f);
+
+        /**
+         * @brief One asset's payload: either a freshly serialized blob or a byte range
+         *        of the previous pack that is still current.
+         */
+        struct PayloadSource
+        {
+            AssetHandle m_Handle = 0;
+            AssetType m_Type = AssetType::None;
+            std::filesystem::path m_BlobPath; // empty when reused
+            u64 m_PreviousOffset = 0;
+            u64 m_Size = 0;
+            bool m_Reused = false;
+        };
 
         /**
          * @brief Serialize all assets from asset manager to pack
+         *
+         * Assets are serialized in parallel, each into its own blob under `stagingDir`.
+         * The index is then laid out in handle order from the sizes actually written,
+         * so the pack is byte-identical however the work was scheduled.
+         *
          * @param assetManager Asset manager to read from
-         * @param assetPackFile Pack file to write to
-         * @param progress Progress tracker
+         * @param settings Build settings (incremental reuse, script module)
+         * @param stagingDir Directory for the per-asset blobs
+         * @param scriptModuleBytes Size of the script module written ahead of the payloads
+         * @param assetPackFile Pack file whose index is filled in
+         * @param outPayloads Payloads in the order they are to be written
+         * @param outFingerprints Source fingerprint of every asset that has one, for the manifest
+         * @param reportProgress Receives serialization progress (0.0 to 1.0)
          * @param cancelToken Optional cancellation token for cooperative cancellation
          * @return Success status
          */
-        [[nodiscard]] static bool SerializeAllAssets(Ref<AssetManagerBase> assetManager, AssetPackFile& assetPackFile, std::atomic<f32>& progress, const std::atomic<bool>* cancelToken = nullptr);
+        [[nodiscard]] static bool SerializeAllAssets(Ref<AssetManagerBase> assetManager, const BuildSettings& settings, const std::filesystem::path& stagingDir,
+                                                     u64 scriptModuleBytes, AssetPackFile& assetPackFile, std::vector<PayloadSource>& outPayloads,
+                                                     std::vector<std::pair<AssetHandle, DerivedDataKey>>& outFingerprints,
+                                                     const std::function<void(f32)>& reportProgress, const std::atomic<bool>* cancelToken = nullptr);
 
         /**
          * @brief Validate that all assets can be serialized
@@ -41,6 +41,10 @@ namespace OloEngine
                 pending.Add(load.Task);
         }
 
+        // Nothing will integrate the results any more: loads no worker has picked
+        // up yet return without reading their pack.
+        m_ShutdownToken.Cancel();
+
         // Wait for every in-flight task outside the lock. Their bodies call back into
         // the owning RuntimeAssetManager, which is destroyed right after this returns,
         // so none may still be running. Tasks::TTask::Wait drives the task to
@@ -86,6 +90,8 @@ namespace OloEngine
             [this, handle]() -> Ref<Asset>
             {
                 OLO_PROFILER_SCOPE("Runtime Asset Load Task");
+                if (m_ShutdownToken.IsCanceled())
+                    return nullptr;
                 try
                 {
                     return LoadAssetFromPack(handle);
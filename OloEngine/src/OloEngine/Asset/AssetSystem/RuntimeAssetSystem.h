@@ -4,6 +4,7 @@
 #include "OloEngine/Asset/Asset.h"
 #include "OloEngine/Asset/AssetMetadata.h"
 #include "OloEngine/Containers/Array.h"
+#include "OloEngine/Task/CancellationToken.h"
 #include "OloEngine/Task/Task.h"
 #include "OloEngine/Threading/Mutex.h"
 
@@ -30,10 +31,11 @@ namespace OloEngine
      *
      * Concurrency is built entirely on the UE-ported task/threading stack: loads run
      * as `Tasks::TTask` jobs on `LowLevelTasks::FScheduler`, in-flight bookkeeping is
-     * a `TArray` guarded by a UE `FMutex`, and shutdown waits on the task handles via
-     * `Tasks::TTask::Wait`. Each task's *result* is the loaded asset, so the handle
-     * doubles as both the completion signal and the result channel — no separate
-     * completion queue or atomic counter is needed.
+     * a `TArray` guarded by a UE `FMutex`, and shutdown cancels the loads no worker
+     * has started and waits on the rest via `Tasks::TTask::Wait`. Each task's
+     * *result* is the loaded asset, so the handle doubles as both the completion
+     * signal and the result channel — no separate completion queue or atomic
+     * counter is needed.
      *
      * Key differences from EditorAssetSystem:
      * - Simpler bookkeeping (no file monitoring)
@@ -131,6 +133,10 @@ namespace OloEngine
         bool m_Running = true;
         TArray<FInFlightLoad> m_InFlight;
         mutable FMutex m_StateMutex;
+
+        // Canceled by StopAndWait(); a load that starts after that returns null
+        // without reaching the manager
+        Tasks::FCancellationToken m_ShutdownToken;
     };
 
 } // namespace OloEngine
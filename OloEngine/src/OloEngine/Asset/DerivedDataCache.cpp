@@ -0,0 +1,608 @@
+#include "OloEnginePCH.h"
+#include "OloEngine/Asset/DerivedDataCache.h"
+
+#include "OloEngine/Core/Environment.h"
+#include "OloEngine/Renderer/MeshSource.h"
+#include "OloEngine/Threading/UniqueLock.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <system_error>
+
+namespace OloEngine
+{
+    namespace
+    {
+        constexpr std::array<u8, 4> kEntryMagic = { 'O', 'D', 'D', 'C' };
+        constexpr u32 kEntryVersion = 1;
+        // magic, version, payload size, payload checksum
+        constexpr sizet kEntryHeaderSize = 4 + 4 + 8 + 8;
+        constexpr const char* kEntryExtension = ".ddc";
+
+        // Eviction trims to this fraction of the bound, so a cache sitting at its limit
+        // does not evict on every single store.
+        constexpr u64 kEvictTargetPercent = 90;
+
+        constexpr u64 kLaneAPrime = 0x9E3779B185EBCA87ull;
+        constexpr u64 kLaneBPrime = 0xC2B2AE3D27D4EB4Full;
+
+        u64 Mix64(u64 value)
+        {
+            value ^= value >> 33;
+            value *= 0xFF51AFD7ED558CCDull;
+            value ^= value >> 33;
+            value *= 0xC4CEB9FE1A85EC53ull;
+            value ^= value >> 33;
+            return value;
+        }
+
+        // Two independent multiply-rotate lanes over 8-byte words; the tail word
+        // carries the remaining bytes and the segment length.
+        void HashSegment(u64& laneA, u64& laneB, const u8* data, sizet size)
+        {
+            const auto absorb = [&laneA, &laneB](u64 word)
+            {
+                laneA = std::rotl(laneA ^ (word * kLaneAPrime), 31) * kLaneBPrime;
+                laneB = std::rotl(laneB + (word * kLaneBPrime), 27) * kLaneAPrime + 0x52DCE729ull;
+            };
+
+            absorb(static_cast<u64>(size));
+            sizet offset = 0;
+            for (; offset + 8 <= size; offset += 8)
+            {
+                u64 word = 0;
+                std::memcpy(&word, data + offset, 8);
+                absorb(word);
+            }
+            u64 tail = static_cast<u64>(size - offset) << 56;
+            for (sizet i = 0; offset + i < size; ++i)
+                tail |= static_cast<u64>(data[offset + i]) << (i * 8);
+            absorb(tail);
+        }
+
+        u64 PayloadChecksum(std::span<const u8> data)
+        {
+            u64 laneA = 0x243F6A8885A308D3ull;
+            u64 laneB = 0x13198A2E03707344ull;
+            HashSegment(laneA, laneB, data.data(), data.size());
+            return Mix64(laneA ^ std::rotl(laneB, 32));
+        }
+
+        void PutU64(u8* dst, u64 value)
+        {
+            for (u32 i = 0; i < 8; ++i)
+                dst[i] = static_cast<u8>(value >> (i * 8));
+        }
+
+        u64 GetU64(const u8* src)
+        {
+            u64 value = 0;
+            for (u32 i = 0; i < 8; ++i)
+                value |= static_cast<u64>(src[i]) << (i * 8);
+            return value;
+        }
+
+        i64 NowTicks()
+        {
+            return static_cast<i64>(std::filesystem::file_time_type::clock::now().time_since_epoch().count());
+        }
+
+        // Persists an entry's recency for the next run's index walk.
+        void WriteLastUse(const std::filesystem::path& path, i64 ticks)
+        {
+            std::error_code ec;
+            std::filesystem::last_write_time(path, std::filesystem::file_time_type(std::filesystem::file_time_type::duration(ticks)), ec);
+        }
+
+        // A name no other writer (thread or process) will pick for the same entry.
+        std::filesystem::path UniqueTempPath(const std::filesystem::path& entryPath)
+        {
+            static const u64 s_ProcessSalt = (static_cast<u64>(std::random_device{}()) << 32) ^ std::random_device{}();
+            static std::atomic<u64> s_Counter{ 0 };
+            const u64 unique = Mix64(s_ProcessSalt + s_Counter.fetch_add(1, std::memory_order_relaxed));
+            std::filesystem::path temp = entryPath;
+            temp += fmt::format(".{:016x}.tmp", unique);
+            return temp;
+        }
+
+        bool ParseKey(std::string_view stem, DerivedDataKey& out)
+        {
+            if (stem.size() != 32)
+                return false;
+            u64 parts[2] = {};
+            for (sizet i = 0; i < 32; ++i)
+            {
+                const char c = stem[i];
+                u64 nibble = 0;
+                if (c >= '0' && c <= '9')
+                    nibble = static_cast<u64>(c - '0');
+                else if (c >= 'a' && c <= 'f')
+                    nibble = static_cast<u64>(c - 'a' + 10);
+                else
+                    return false;
+                parts[i / 16] = (parts[i / 16] << 4) | nibble;
+            }
+            out.High = parts[0];
+            out.Low = parts[1];
+            return true;
+        }
+
+        std::filesystem::path DefaultSharedRoot()
+        {
+            if (auto path = Env::Get("OLO_DDC_PATH"))
+                return *path;
+#if defined(OLO_PLATFORM_WINDOWS)
+            if (auto localAppData = Env::Get("LOCALAPPDATA"))
+                return std::filesystem::path(*localAppData) / "OloEngine" / "DerivedDataCache";
+#else
+            if (auto xdgCache = Env::Get("XDG_CACHE_HOME"))
+                return std::filesystem::path(*xdgCache) / "OloEngine" / "DerivedDataCache";
+            if (auto home = Env::Get("HOME"))
+                return std::filesystem::path(*home) / ".cache" / "OloEngine" / "DerivedDataCache";
+#endif
+            // No per-user location: keep it beside the working directory rather than
+            // turning the cache off.
+            return std::filesystem::path("DerivedDataCache");
+        }
+    } // namespace
+
+    std::string DerivedDataKey::ToString() const
+    {
+        return fmt::format("{:016x}{:016x}", High, Low);
+    }
+
+    DerivedDataKeyBuilder::DerivedDataKeyBuilder(std::string_view cooker, u32 cookerVersion)
+        : m_LaneA(0x6A09E667F3BCC908ull), m_LaneB(0xBB67AE8584CAA73Bull)
+    {
+        Append(cooker);
+        AppendValue(cookerVersion);
+    }
+
+    DerivedDataKeyBuilder& DerivedDataKeyBuilder::Append(std::span<const u8> bytes)
+    {
+        HashSegment(m_LaneA, m_LaneB, bytes.data(), bytes.size());
+        ++m_Segments;
+        return *this;
+    }
+
+    DerivedDataKeyBuilder& DerivedDataKeyBuilder::Append(std::string_view text)
+    {
+        return Append(std::span<const u8>(reinterpret_cast<const u8*>(text.data()), text.size()));
+    }
+
+    DerivedDataKeyBuilder& DerivedDataKeyBuilder::AppendValue(f32 value)
+    {
+        // Bit pattern, with -0 folded onto +0 so the two equal values key alike.
+        return AppendValue(value == 0.0f ? 0u : std::bit_cast<u32>(value));
+    }
+
+    DerivedDataKeyBuilder& DerivedDataKeyBuilder::AppendMeshGeometry(const MeshSource& source)
+    {
+        const TArray<Vertex>& vertices = source.GetVertices();
+        const TArray<u32>& indices = source.GetIndices();
+        Append(std::span<const u8>(reinterpret_cast<const u8*>(vertices.GetData()), sizeof(Vertex) * static_cast<sizet>(vertices.Num())));
+        Append(std::span<const u8>(reinterpret_cast<const u8*>(indices.GetData()), sizeof(u32) * static_cast<sizet>(indices.Num())));
+
+        const TArray<Submesh>& submeshes = source.GetSubmeshes();
+        AppendValue(static_cast<u64>(submeshes.Num()));
+        for (const Submesh& submesh : submeshes)
+        {
+            AppendValue(submesh.m_BaseVertex);
+            AppendValue(submesh.m_BaseIndex);
+            AppendValue(submesh.m_IndexCount);
+            AppendValue(submesh.m_VertexCount);
+            AppendValue(submesh.m_MaterialIndex);
+            AppendValue(submesh.m_IsRigged);
+            Append(std::span<const u8>(reinterpret_cast<const u8*>(&submesh.m_Transform), sizeof(glm::mat4)));
+            Append(std::span<const u8>(reinterpret_cast<const u8*>(&submesh.m_LocalTransform), sizeof(glm::mat4)));
+        }
+        AppendValue(source.HasSkeleton());
+        AppendValue(source.HasMorphTargets());
+        AppendValue(!source.GetBoneInfo().IsEmpty());
+        return *this;
+    }
+
+    bool DerivedDataKeyBuilder::AppendFile(const std::filesystem::path& path)
+    {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file)
+            return false;
+        const std::streamoff size = file.tellg();
+        if (size < 0)
+            return false;
+        std::vector<u8> bytes(static_cast<sizet>(size));
+        file.seekg(0);
+        if (size > 0 && !file.read(reinterpret_cast<char*>(bytes.data()), size))
+            return false;
+        Append(bytes);
+        return true;
+    }
+
+    DerivedDataKey DerivedDataKeyBuilder::Build() const
+    {
+        const u64 a = Mix64(m_LaneA ^ m_Segments);
+        const u64 b = Mix64(m_LaneB + std::rotl(m_Segments, 17));
+        return { Mix64(a + std::rotl(b, 23)), Mix64(b ^ std::rotl(a, 41)) };
+    }
+
+    DerivedDataCache::DerivedDataCache(std::filesystem::path root, u64 maxBytes)
+        : m_Root(std::move(root)), m_MaxBytes(maxBytes)
+    {
+    }
+
+    DerivedDataCache& DerivedDataCache::Get()
+    {
+        static DerivedDataCache s_Instance = []
+        {
+            u64 maxBytes = s_DefaultMaxBytes;
+            if (auto const megabytes = Env::GetInt("OLO_DDC_MAX_MB"); megabytes && *megabytes > 0)
+                maxBytes = static_cast<u64>(*megabytes) * 1024 * 1024;
+            return DerivedDataCache(DefaultSharedRoot(), maxBytes);
+        }();
+        return s_Instance;
+    }
+
+    void DerivedDataCache::SetRoot(std::filesystem::path root)
+    {
+        TUniqueLock<FMutex> lock(m_Mutex);
+        m_Root = std::move(root);
+        m_Index.clear();
+        m_TotalBytes = 0;
+        m_Indexed = false;
+    }
+
+    std::filesystem::path DerivedDataCache::GetRoot() const
+    {
+        TUniqueLock<FMutex> lock(m_Mutex);
+        return m_Root;
+    }
+
+    void DerivedDataCache::SetMaxBytes(u64 maxBytes)
+    {
+        std::vector<EvictionVictim> victims;
+        {
+            TUniqueLock<FMutex> lock(m_Mutex);
+            m_MaxBytes = maxBytes;
+            if (m_Indexed)
+                victims = EvictLocked({});
+        }
+        RemoveEvicted(std::move(victims));
+    }
+
+    u64 DerivedDataCache::GetMaxBytes() const
+    {
+        TUniqueLock<FMutex> lock(m_Mutex);
+        return m_MaxBytes;
+    }
+
+    void DerivedDataCache::SetEnabled(bool enabled)
+    {
+        TUniqueLock<FMutex> lock(m_Mutex);
+        m_Enabled = enabled;
+    }
+
+    bool DerivedDataCache::IsEnabled() const
+    {
+        TUniqueLock<FMutex> lock(m_Mutex);
+        return m_Enabled && !m_Root.empty();
+    }
+
+    std::filesystem::path DerivedDataCache::GetEntryPath(const DerivedDataKey& key) const
+    {
+        TUniqueLock<FMutex> lock(m_Mutex);
+        return EntryPathLocked(key);
+    }
+
+    std::filesystem::path DerivedDataCache::EntryPathLocked(const DerivedDataKey& key) const
+    {
+        const std::string name = key.ToString();
+        return m_Root / name.substr(0, 2) / (name + kEntryExtension);
+    }
+
+    bool DerivedDataCache::Load(const DerivedDataKey& key, std::vector<u8>& outData)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        EnsureIndexed();
+        std::filesystem::path path;
+        {
+            TUniqueLock<FMutex> lock(m_Mutex);
+            if (!m_Enabled || m_Root.empty())
+                return false;
+            path = EntryPathLocked(key);
+        }
+
+        // The read happens outside the lock; the rename-into-place in Store means
+        // whatever file is at `path` is always a complete entry.
+        std::vector<u8> bytes;
+        bool found = false;
+        {
+            std::ifstream file(path, std::ios::binary | std::ios::ate);
+            if (file)
+            {
+                found = true;
+                const std::streamoff size = file.tellg();
+                if (size >= static_cast<std::streamoff>(kEntryHeaderSize))
+                {
+                    bytes.resize(static_cast<sizet>(size));
+                    file.seekg(0);
+                    if (!file.read(reinterpret_cast<char*>(bytes.data()), size))
+                        bytes.clear();
+                }
+            }
+        }
+
+        bool valid = !bytes.empty() && std::equal(kEntryMagic.begin(), kEntryMagic.end(), bytes.begin());
+        if (valid)
+        {
+            u32 version = 0;
+            std::memcpy(&version, bytes.data() + 4, sizeof(version));
+            const u64 payloadSize = GetU64(bytes.data() + 8);
+            const u64 checksum = GetU64(bytes.data() + 16);
+            const std::span<const u8> payload(bytes.data() + kEntryHeaderSize, bytes.size() - kEntryHeaderSize);
+            valid = version == kEntryVersion && payloadSize == payload.size() && checksum == PayloadChecksum(payload);
+        }
+
+        if (!valid)
+        {
+            if (found)
+            {
+                OLO_CORE_WARN("DerivedDataCache: discarding damaged entry '{}'", path.string());
+                std::error_code ec;
+                std::filesystem::remove(path, ec);
+            }
+            TUniqueLock<FMutex> lock(m_Mutex);
+            ForgetLocked(key);
+            ++m_Stats.Misses;
+            return false;
+        }
+
+        outData.assign(bytes.begin() + kEntryHeaderSize, bytes.end());
+        i64 lastUse = 0;
+        {
+            TUniqueLock<FMutex> lock(m_Mutex);
+            lastUse = TouchLocked(key, bytes.size());
+            ++m_Stats.Hits;
+        }
+        WriteLastUse(path, lastUse);
+        return true;
+    }
+
+    bool DerivedDataCache::Store(const DerivedDataKey& key, std::span<const u8> data)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        EnsureIndexed();
+        std::filesystem::path path;
+        {
+            TUniqueLock<FMutex> lock(m_Mutex);
+            if (!m_Enabled || m_Root.empty())
+                return false;
+            path = EntryPathLocked(key);
+        }
+
+        std::error_code ec;
+        std::filesystem::create_directories(path.parent_path(), ec);
+
+        std::array<u8, kEntryHeaderSize> header{};
+        std::copy(kEntryMagic.begin(), kEntryMagic.end(), header.begin());
+        std::memcpy(header.data() + 4, &kEntryVersion, sizeof(kEntryVersion));
+        PutU64(header.data() + 8, data.size());
+        PutU64(header.data() + 16, PayloadChecksum(data));
+
+        const std::filesystem::path tempPath = UniqueTempPath(path);
+        {
+            std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+            file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+            if (!file)
+            {
+                OLO_CORE_WARN("DerivedDataCache: cannot write '{}'", tempPath.string());
+                file.close();
+                std::filesystem::remove(tempPath, ec);
+                return false;
+            }
+        }
+        // Replaces an existing entry atomically; a reader sees the old or the new
+        // file, never a partial one.
+        std::filesystem::rename(tempPath, path, ec);
+        if (ec)
+        {
+            OLO_CORE_WARN("DerivedDataCache: cannot publish '{}': {}", path.string(), ec.message());
+            std::filesystem::remove(tempPath, ec);
+            return false;
+        }
+
+        i64 lastUse = 0;
+        std::vector<EvictionVictim> victims;
+        {
+            TUniqueLock<FMutex> lock(m_Mutex);
+            lastUse = TouchLocked(key, header.size() + data.size());
+            ++m_Stats.Stores;
+            victims = EvictLocked(key);
+        }
+        WriteLastUse(path, lastUse);
+        RemoveEvicted(std::move(victims));
+        return true;
+    }
+
+    bool DerivedDataCache::Contains(const DerivedDataKey& key)
+    {
+        EnsureIndexed();
+        std::filesystem::path path;
+        {
+            TUniqueLock<FMutex> lock(m_Mutex);
+            if (!m_Enabled || m_Root.empty())
+                return false;
+            path = EntryPathLocked(key);
+        }
+        std::error_code ec;
+        return std::filesystem::is_regular_file(path, ec);
+    }
+
+    void DerivedDataCache::Remove(const DerivedDataKey& key)
+    {
+        std::filesystem::path path;
+        {
+            TUniqueLock<FMutex> lock(m_Mutex);
+            if (m_Root.empty())
+                return;
+            path = EntryPathLocked(key);
+            ForgetLocked(key);
+        }
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+    }
+
+    void DerivedDataCache::Clear()
+    {
+        std::filesystem::path root;
+        {
+            TUniqueLock<FMutex> lock(m_Mutex);
+            if (m_Root.empty())
+                return;
+            root = m_Root;
+            m_Index.clear();
+            m_TotalBytes = 0;
+            m_Indexed = true;
+        }
+        // Only the shard directories: the root itself may be a user-chosen folder.
+        std::error_code ec;
+        for (const auto& entry : std::filesystem::directory_iterator(root, ec))
+        {
+            const std::string name = entry.path().filename().string();
+            std::error_code entryEc;
+            if (name.size() == 2 && entry.is_directory(entryEc))
+                std::filesystem::remove_all(entry.path(), entryEc);
+        }
+    }
+
+    DerivedDataCache::Statistics DerivedDataCache::GetStatistics()
+    {
+        EnsureIndexed();
+        TUniqueLock<FMutex> lock(m_Mutex);
+        Statistics stats = m_Stats;
+        stats.TotalBytes = m_TotalBytes;
+        stats.EntryCount = m_Index.size();
+        return stats;
+    }
+
+    void DerivedDataCache::EnsureIndexed()
+    {
+        std::filesystem::path root;
+        {
+            TUniqueLock<FMutex> lock(m_Mutex);
+            if (m_Indexed || m_Root.empty())
+                return;
+            root = m_Root;
+        }
+
+        // One walk per root, picking up what earlier runs (or other processes) left.
+        // Leftover *.tmp files belong to writers that may still be running, so they
+        // are neither counted nor removed. Two threads may both walk a fresh root;
+        // the second merge finds the index already built and is dropped.
+        std::unordered_map<DerivedDataKey, IndexEntry, KeyHasher> found;
+        std::error_code ec;
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(root, ec))
+        {
+            std::error_code entryEc;
+            if (!entry.is_regular_file(entryEc) || entry.path().extension() != kEntryExtension)
+                continue;
+            DerivedDataKey key;
+            if (!ParseKey(entry.path().stem().string(), key))
+                continue;
+            const u64 size = entry.file_size(entryEc);
+            if (entryEc)
+                continue;
+            const auto mtime = entry.last_write_time(entryEc);
+            found[key] = { size, entryEc ? 0 : static_cast<i64>(mtime.time_since_epoch().count()) };
+        }
+
+        TUniqueLock<FMutex> lock(m_Mutex);
+        if (m_Indexed || m_Root != root)
+            return; // Cleared or re-rooted while walking
+        m_Indexed = true;
+        // Loads and stores that finished during the walk already hold fresher entries.
+        for (const auto& [key, entry] : found)
+        {
+            if (m_Index.try_emplace(key, entry).second)
+                m_TotalBytes += entry.Size;
+        }
+    }
+
+    i64 DerivedDataCache::TouchLocked(const DerivedDataKey& key, u64 size)
+    {
+        const i64 now = NowTicks();
+        auto [it, inserted] = m_Index.try_emplace(key);
+        if (!inserted)
+            m_TotalBytes -= it->second.Size;
+        it->second = { size, now };
+        m_TotalBytes += size;
+        return now;
+    }
+
+    void DerivedDataCache::ForgetLocked(const DerivedDataKey& key)
+    {
+        if (auto it = m_Index.find(key); it != m_Index.end())
+        {
+            m_TotalBytes -= it->second.Size;
+            m_Index.erase(it);
+        }
+    }
+
+    std::vector<DerivedDataCache::EvictionVictim> DerivedDataCache::EvictLocked(const DerivedDataKey& keep)
+    {
+        std::vector<EvictionVictim> victims;
+        if (m_TotalBytes <= m_MaxBytes)
+            return victims;
+
+        std::vector<std::pair<i64, DerivedDataKey>> byAge;
+        byAge.reserve(m_Index.size());
+        for (const auto& [key, entry] : m_Index)
+        {
+            if (key != keep)
+                byAge.emplace_back(entry.LastUse, key);
+        }
+        std::ranges::sort(byAge);
+
+        const u64 target = m_MaxBytes / 100 * kEvictTargetPercent;
+        for (const auto& [lastUse, key] : byAge)
+        {
+            if (m_TotalBytes <= target)
+                break;
+            victims.push_back({ key, EntryPathLocked(key), m_Index.at(key) });
+            ForgetLocked(key);
+        }
+        return victims;
+    }
+
+    void DerivedDataCache::RemoveEvicted(std::vector<EvictionVictim> victims)
+    {
+        if (victims.empty())
+            return;
+
+        u64 evicted = 0;
+        std::vector<EvictionVictim> kept;
+        for (auto& victim : victims)
+        {
+            std::error_code ec;
+            std::filesystem::remove(victim.Path, ec);
+            if (ec)
+                kept.push_back(std::move(victim)); // still open elsewhere; try again on a later store
+            else
+                ++evicted;
+        }
+
+        TUniqueLock<FMutex> lock(m_Mutex);
+        m_Stats.Evictions += evicted;
+        for (const auto& victim : kept)
+        {
+            if (m_Index.try_emplace(victim.Key, victim.Entry).second)
+                m_TotalBytes += victim.Entry.Size;
+        }
+    }
+} // namespace OloEngine
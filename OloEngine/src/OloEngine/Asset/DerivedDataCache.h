@@ -0,0 +1,192 @@
+#pragma once
+
+#include "OloEngine/Core/Base.h"
+#include "OloEngine/Threading/Mutex.h"
+
+#include <compare>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+// Content-addressed derived-data cache (DDC) shared by every offline cooker.
+//
+// A cooker names its output by what it was derived FROM: the bytes of the source,
+// the cooker's own version, and every setting that changes the result. It never uses
+// where the source lives or when it was last written. A fresh checkout or a branch
+// switch rewrites every timestamp but no content, so it still finds everything cooked
+// before. Two files with identical content share one entry.
+//
+// Entries are opaque blobs at <root>/<first 2 hex digits>/<32 hex digits>.ddc. Each
+// one is written to a temp file and renamed into place, so a crash or a concurrent
+// writer never leaves a torn entry visible. Every blob also carries a checksum; a
+// damaged one reads as a miss and is deleted.
+//
+// The cache is size-bounded. Once the total passes the limit, the least recently
+// used entries are evicted. A hit refreshes the entry file's mtime, so recency
+// survives restarts and is shared by every process using the same root. Another
+// process's writes are not counted until this one touches them, so the bound is
+// approximate when several processes share a root.
+
+namespace OloEngine
+{
+    class MeshSource;
+
+    struct DerivedDataKey
+    {
+        u64 High = 0;
+        u64 Low = 0;
+
+        // 32 lowercase hex digits; also the entry's file stem.
+        [[nodiscard]] std::string ToString() const;
+
+        auto operator<=>(const DerivedDataKey&) const = default;
+    };
+
+    // Accumulates everything a cooked result depends on into a 128-bit DerivedDataKey.
+    // Every Append is length-delimited, so ("ab", "c") and ("a", "bc") key differently.
+    // Not a cryptographic hash: it guards against accidents, not adversaries.
+    class DerivedDataKeyBuilder
+    {
+      public:
+        // `cooker` namespaces the key so two cookers can never collide on the same
+        // input. Bump `cookerVersion` whenever the cooker's output changes for the
+        // same input; old entries then simply stop being asked for and age out.
+        DerivedDataKeyBuilder(std::string_view cooker, u32 cookerVersion);
+
+        DerivedDataKeyBuilder& Append(std::span<const u8> bytes);
+        DerivedDataKeyBuilder& Append(std::string_view text);
+
+        template<typename T>
+            requires std::is_trivially_copyable_v<T> && std::has_unique_object_representations_v<T>
+        DerivedDataKeyBuilder& AppendValue(const T& value)
+        {
+            return Append(std::span<const u8>(reinterpret_cast<const u8*>(&value), sizeof(T)));
+        }
+
+        DerivedDataKeyBuilder& AppendValue(bool value)
+        {
+            return AppendValue(static_cast<u8>(value ? 1 : 0));
+        }
+
+        DerivedDataKeyBuilder& AppendValue(f32 value);
+
+        // The geometry a mesh cook reads: vertices, indices, each submesh's ranges,
+        // material slot, transforms and rig flag, and whether the source deforms
+        // (skeleton, bones, morph targets). Names and the materials themselves are left
+        // out, because they do not change a geometric cook.
+        DerivedDataKeyBuilder& AppendMeshGeometry(const MeshSource& source);
+
+        // Reads the whole file into the key. Returns false, leaving the key unusable,
+        // if the file cannot be read.
+        [[nodiscard]] bool AppendFile(const std::filesystem::path& path);
+
+        [[nodiscard]] DerivedDataKey Build() const;
+
+      private:
+        u64 m_LaneA;
+        u64 m_LaneB;
+        u64 m_Segments = 0;
+    };
+
+    class DerivedDataCache
+    {
+      public:
+        static constexpr u64 s_DefaultMaxBytes = 8ull * 1024 * 1024 * 1024;
+
+        struct Statistics
+        {
+            u64 Hits = 0;
+            u64 Misses = 0;
+            u64 Stores = 0;
+            u64 Evictions = 0;
+            u64 TotalBytes = 0; // entries this process knows about
+            u64 EntryCount = 0;
+        };
+
+        // A cache rooted at `root`, holding at most `maxBytes` of entries. The directory
+        // is created on the first Store. An empty root disables the cache.
+        explicit DerivedDataCache(std::filesystem::path root, u64 maxBytes = s_DefaultMaxBytes);
+
+        DerivedDataCache(const DerivedDataCache&) = delete;
+        DerivedDataCache& operator=(const DerivedDataCache&) = delete;
+
+        // The cache every cooker shares. It lives outside any checkout so that it
+        // survives one. The root is OLO_DDC_PATH if set, otherwise a per-user directory
+        // (%LOCALAPPDATA%/OloEngine/DerivedDataCache, or $XDG_CACHE_HOME or
+        // ~/.cache/OloEngine/DerivedDataCache). OLO_DDC_MAX_MB overrides the size bound.
+        // Both variables are read once, on first use; SetRoot moves it afterwards.
+        static DerivedDataCache& Get();
+
+        // Re-roots the cache (the test harness points it at its scratch directory, a
+        // build machine at a shared drive). Entries under the old root are left alone.
+        void SetRoot(std::filesystem::path root);
+        [[nodiscard]] std::filesystem::path GetRoot() const;
+
+        void SetMaxBytes(u64 maxBytes);
+        [[nodiscard]] u64 GetMaxBytes() const;
+
+        void SetEnabled(bool enabled);
+        [[nodiscard]] bool IsEnabled() const;
+
+        // On a hit, fills `outData` with the stored blob and marks it most recently used.
+        [[nodiscard]] bool Load(const DerivedDataKey& key, std::vector<u8>& outData);
+        // Publishes `data` under `key`, replacing any existing entry, then evicts down
+        // to the size bound. Returns false if the entry could not be written (logged);
+        // a failed store never affects the cook that produced the data.
+        bool Store(const DerivedDataKey& key, std::span<const u8> data);
+        [[nodiscard]] bool Contains(const DerivedDataKey& key);
+        void Remove(const DerivedDataKey& key);
+        // Deletes every entry under the root.
+        void Clear();
+
+        [[nodiscard]] std::filesystem::path GetEntryPath(const DerivedDataKey& key) const;
+        [[nodiscard]] Statistics GetStatistics();
+
+      private:
+        struct KeyHasher
+        {
+            sizet operator()(const DerivedDataKey& key) const noexcept
+            {
+                return static_cast<sizet>(key.Low ^ (key.High * 0x9E3779B97F4A7C15ull));
+            }
+        };
+
+        struct IndexEntry
+        {
+            u64 Size = 0;
+            i64 LastUse = 0; // file_time_type ticks, same clock as the entry's mtime
+        };
+
+        // An entry picked for eviction. It leaves the index under the lock; its file is
+        // removed after the lock is released, and it is re-indexed if that fails.
+        struct EvictionVictim
+        {
+            DerivedDataKey Key;
+            std::filesystem::path Path;
+            IndexEntry Entry;
+        };
+
+        // The filesystem work (the index walk, the mtime touch, the removes) runs
+        // outside m_Mutex so one thread's disk I/O never stalls another's lookup.
+        // The *Locked helpers only touch the in-memory index.
+        std::filesystem::path EntryPathLocked(const DerivedDataKey& key) const;
+        void EnsureIndexed();
+        i64 TouchLocked(const DerivedDataKey& key, u64 size);
+        void ForgetLocked(const DerivedDataKey& key);
+        [[nodiscard]] std::vector<EvictionVictim> EvictLocked(const DerivedDataKey& keep);
+        void RemoveEvicted(std::vector<EvictionVictim> victims);
+
+        mutable FMutex m_Mutex;
+        std::filesystem::path m_Root;
+        u64 m_MaxBytes;
+        bool m_Enabled = true;
+        bool m_Indexed = false;
+        std::unordered_map<DerivedDataKey, IndexEntry, KeyHasher> m_Index;
+        u64 m_TotalBytes = 0;
+        Statistics m_Stats;
+    };
+} // namespace OloEngine
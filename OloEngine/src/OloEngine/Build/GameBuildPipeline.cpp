@@ -17,6 +17,22 @@
 
 namespace OloEngine
 {
+    namespace
+    {
+        // Where an incremental build parks the previous pack (and its manifest) while the
+        // output directory is cleaned: beside the game folder, not in it.
+        std::filesystem::path PreviousAssetPackPath(const GameBuildSettings& settings)
+        {
+            return settings.OutputDirectory / (settings.GameName + ".previous.olopack");
+        }
+
+        std::filesystem::path WithManifestExtension(std::filesystem::path packPath)
+        {
+            packPath += ".manifest";
+            return packPath;
+        }
+    } // namespace
+
     GameBuildResult GameBuildPipeline::Build(
         const GameBuildSettings& settings,
         std::atomic<f32>& progress,
@@ -62,6 +78,19 @@ namespace OloEngine
         // Create output directory structure (clean staging)
         const std::filesystem::path outputDir = settings.OutputDirectory / settings.GameName;
         std::error_code ec;
+        if (settings.IncrementalAssetPack)
+        {
+            const std::filesystem::path currentPack = outputDir / "Assets" / "AssetPack.olopack";
+            const std::filesystem::path previousPack = PreviousAssetPackPath(settings);
+            if (std::filesystem::exists(currentPack, ec))
+            {
+                std::filesystem::rename(currentPack, previousPack, ec);
+                std::error_code manifestEc;
+                std::filesystem::rename(WithManifestExtension(currentPack), WithManifestExtension(previousPack), manifestEc);
+                if (ec)
+                    OLO_CORE_WARN("[GameBuild] Could not keep the previous asset pack for reuse: {}", ec.message());
+            }
+        }
         if (std::filesystem::exists(outputDir, ec))
         {
             std::filesystem::remove_all(outputDir, ec);
@@ -262,12 +291,23 @@ namespace OloEngine
         packSettings.m_CompressAssets = settings.CompressAssets;
         packSettings.m_IncludeScriptModule = settings.IncludeScriptModule;
         packSettings.m_ValidateAssets = settings.ValidateAssets;
+        packSettings.m_Incremental = settings.IncrementalAssetPack;
+        const std::filesystem::path previousPack = PreviousAssetPackPath(settings);
+        if (settings.IncrementalAssetPack)
+            packSettings.m_PreviousPackPath = previousPack;
 
         // The pack builder reports 0.0-1.0 progress; we map it to 0.05-0.60
         std::atomic<f32> packProgress = 0.0f;
 
         auto buildResult = AssetPackBuilder::BuildFromActiveProject(packSettings, packProgress, cancelToken);
 
+        if (settings.IncrementalAssetPack)
+        {
+            std::error_code ec;
+            std::filesystem::remove(previousPack, ec);
+            std::filesystem::remove(WithManifestExtension(previousPack), ec);
+        }
+
         // Map final pack progress to our overall progress
         progress = 0.05f + (packProgress.load() * 0.55f);
 
@@ -31,6 +31,11 @@ namespace OloEngine
         /// Whether to validate all assets before packing
         bool ValidateAssets = true;
 
+        /// Reuse the previous build's packed payload for every asset whose sources
+        /// are unchanged, serializing only the rest. The first build with this on
+        /// still serializes everything; it writes the manifest the next one reads.
+        bool IncrementalAssetPack = false;
+
         /// Build configuration to use for the runtime executable
         /// Values: "Debug", "Release", "Dist"
         std::string BuildConfiguration = "Release";
@@ -29,6 +29,7 @@
 #include "OloEngine/Task/NamedThreads.h"
 #include "Platform/Steam/SteamManager.h"
 
+#include <atomic>
 #include <chrono>
 #include <stdexcept>
 #include <ranges>
@@ -785,11 +786,22 @@ namespace OloEngine
         return false;
     }
 
+    namespace
+    {
+        // Atomic: the perf scopes also run on task workers.
+        std::atomic<PerformanceProfiler*> s_DetachedPerformanceProfiler{ nullptr };
+    } // namespace
+
     PerformanceProfiler* GetGlobalPerformanceProfiler()
     {
         if (auto* app = Application::TryGet())
             return app->GetPerformanceProfiler();
-        return nullptr;
+        return s_DetachedPerformanceProfiler.load(std::memory_order_acquire);
+    }
+
+    void SetDetachedPerformanceProfiler(PerformanceProfiler* profiler)
+    {
+        s_DetachedPerformanceProfiler.store(profiler, std::memory_order_release);
     }
 
 } // namespace OloEngine
@@ -98,6 +98,11 @@ namespace OloEngine
     // nullptr otherwise. Implemented in PerformanceProfiler.cpp to avoid pulling
     // Application.h into every header that wants OLO_PERF_SCOPE_AUTO.
     [[nodiscard]] PerformanceProfiler* GetGlobalPerformanceProfiler();
+
+    // Profiler GetGlobalPerformanceProfiler() falls back to while no Application
+    // is alive, so a headless benchmark can read the engine's own scope timings.
+    // Pass nullptr to detach. The Application's profiler wins when both exist.
+    void SetDetachedPerformanceProfiler(PerformanceProfiler* profiler);
 } // namespace OloEngine
 
 // Auto-fetching variant: looks up the profiler from Application::TryGet() each
@@ -2,6 +2,7 @@
 #include "OloEngine/Fluid/CPUFluidSolver.h"
 
 #include "OloEngine/Fluid/FluidKernels.h"
+#include "OloEngine/Task/ParallelFor.h"
 
 #include <algorithm>
 #include <cmath>
@@ -70,9 +71,55 @@ namespace OloEngine
         {
             return glm::quat(proxy.Rotation.w, proxy.Rotation.x, proxy.Rotation.y, proxy.Rotation.z);
         }
+
+        /// The proxy loop runs once per constraint iteration, and the lambda
+        /// solve pushes particles back toward a body between iterations, so the
+        /// raw sum over-counts the physical contact impulse by roughly the
+        /// iteration count (empirically: a floating box gets catapulted).
+        /// Average it back to one resolution's worth. GPU mirror:
+        /// GPUFluidSolver::HarvestFeedback divides by the same factor.
+        void AverageFeedbackOverIterations(std::span<FluidBodyFeedback> feedback, u32 iterations)
+        {
+            if (feedback.empty() || iterations <= 1)
+            {
+                return;
+            }
+            const f32 invIterations = 1.0f / static_cast<f32>(iterations);
+            for (FluidBodyFeedback& entry : feedback)
+            {
+                entry.Impulse *= invIterations;
+                entry.AngularImpulse *= invIterations;
+            }
+        }
+
+        /// Sorted particles per parallel work item. Fixed, never derived from
+        /// the worker count, so the chunked reductions combine in the same
+        /// order on every host.
+        constexpr u32 kParallelChunkSize = 1024;
+
+        /// Parallel mode builds neighbour lists once per step, but the
+        /// constraint iterations keep moving particles. Listing pairs out to
+        /// (1 + skin) * h lets pairs that close in during the step still
+        /// interact; every kernel re-tests r < h. The skin only reaches as far
+        /// as the 27-cell neighbourhood does, which is also all the serial
+        /// path sees.
+        constexpr f32 kNeighbourSkinFraction = 0.1f;
+
+        /// s_corr's (W / W(dq))^n. n = 4 is the paper's value and the default;
+        /// multiply it out so the position-correction loop avoids a pow per pair.
+        f32 SCorrPower(f32 ratio, f32 exponent)
+        {
+            if (exponent == 4.0f)
+            {
+                const f32 squared = ratio * ratio;
+                return squared * squared;
+            }
+            return std::pow(ratio, exponent);
+        }
     } // namespace
 
-    CPUFluidSolver::CPUFluidSolver(u32 maxParticles)
+    CPUFluidSolver::CPUFluidSolver(u32 maxParticles, CPUFluidSolverMode mode)
+        : m_Mode(mode)
     {
         Reset(maxParticles);
     }
@@ -101,7 +148,7 @@ namespace OloEngine
         }
     }
 
-    void CPUFluidSolver::BuildGrid(const FluidSolverParams& params)
+    sizet CPUFluidSolver::ConfigureGrid(const FluidSolverParams& params)
     {
         const f32 h = params.SmoothingRadius();
         const glm::vec3 extent = params.BoundsMax - params.BoundsMin;
@@ -113,22 +160,172 @@ namespace OloEngine
             std::max(1u, static_cast<u32>(std::ceil(extent.y / m_CellSize))),
             std::max(1u, static_cast<u32>(std::ceil(extent.z / m_CellSize))));
 
-        const sizet cellCount = static_cast<sizet>(m_GridDims.x) * m_GridDims.y * m_GridDims.z;
+        return static_cast<sizet>(m_GridDims.x) * m_GridDims.y * m_GridDims.z;
+    }
+
+    u32 CPUFluidSolver::CellIndexOf(const glm::vec3& position) const
+    {
+        const glm::vec3 rel = (position - m_GridOrigin) / m_CellSize;
+        const glm::uvec3 cell = glm::min(
+            glm::uvec3(glm::max(rel, glm::vec3(0.0f))),
+            m_GridDims - glm::uvec3(1));
+        return (cell.z * m_GridDims.y + cell.y) * m_GridDims.x + cell.x;
+    }
+
+    void CPUFluidSolver::BuildGrid(const FluidSolverParams& params)
+    {
+        const sizet cellCount = ConfigureGrid(params);
         m_GridHead.assign(cellCount, 0u);
         m_GridNext.assign(m_Predicted.size(), 0u);
 
         for (u32 i = 0; i < static_cast<u32>(m_Predicted.size()); ++i)
         {
-            const glm::vec3 rel = (m_Predicted[i] - m_GridOrigin) / m_CellSize;
-            const glm::uvec3 cell = glm::min(
-                glm::uvec3(glm::max(rel, glm::vec3(0.0f))),
-                m_GridDims - glm::uvec3(1));
-            const sizet cellIndex = (static_cast<sizet>(cell.z) * m_GridDims.y + cell.y) * m_GridDims.x + cell.x;
+            const u32 cellIndex = CellIndexOf(m_Predicted[i]);
             m_GridNext[i] = m_GridHead[cellIndex];
             m_GridHead[cellIndex] = i + 1;
         }
     }
 
+    template<typename Fn>
+    void CPUFluidSolver::ForEachChunk(const char* debugName, Fn&& fn) const
+    {
+        const u32 count = GetCount();
+        ParallelFor(
+            debugName, static_cast<i32>(m_ChunkCount), 1,
+            [&fn, count](i32 chunkIndex)
+            {
+                const u32 chunk = static_cast<u32>(chunkIndex);
+                const u32 begin = chunk * kParallelChunkSize;
+                fn(chunk, begin, std::min(begin + kParallelChunkSize, count));
+            },
+            m_RunInline ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+    }
+
+    void CPUFluidSolver::SortByCell(const FluidSolverParams& params)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        const u32 count = GetCount();
+        const sizet cellCount = ConfigureGrid(params);
+
+        m_CellOfParticle.resize(count);
+        m_RankInCell.resize(count);
+        ForEachChunk("CPUFluidSolver::CellKeys", [this](u32, u32 begin, u32 end)
+                     {
+            for (u32 i = begin; i < end; ++i)
+            {
+                m_CellOfParticle[i] = CellIndexOf(m_Predicted[i]);
+            } });
+
+        // Histogram + exclusive scan. Serial and index-ordered, so the sort is
+        // stable: a cell's particles keep their original relative order, and
+        // the rank recorded here makes the scatter below order-free.
+        m_CellStart.assign(cellCount + 1, 0u);
+        for (u32 i = 0; i < count; ++i)
+        {
+            m_RankInCell[i] = m_CellStart[m_CellOfParticle[i] + 1]++;
+        }
+        for (sizet c = 0; c < cellCount; ++c)
+        {
+            m_CellStart[c + 1] += m_CellStart[c];
+        }
+
+        m_SortedToOriginal.resize(count);
+        m_SortedX.resize(count);
+        m_SortedY.resize(count);
+        m_SortedZ.resize(count);
+        m_SortedStart.resize(count);
+        ForEachChunk("CPUFluidSolver::ScatterSorted", [this](u32, u32 begin, u32 end)
+                     {
+            for (u32 i = begin; i < end; ++i)
+            {
+                const u32 s = m_CellStart[m_CellOfParticle[i]] + m_RankInCell[i];
+                m_SortedToOriginal[s] = i;
+                m_SortedX[s] = m_Predicted[i].x;
+                m_SortedY[s] = m_Predicted[i].y;
+                m_SortedZ[s] = m_Predicted[i].z;
+                m_SortedStart[s] = m_Positions[i];
+            } });
+    }
+
+    u32 CPUFluidSolver::ScanNeighbourhood(u32 s, f32 radius2, u32* outNeighbours) const
+    {
+        const f32 px = m_SortedX[s];
+        const f32 py = m_SortedY[s];
+        const f32 pz = m_SortedZ[s];
+        const glm::vec3 rel = (glm::vec3(px, py, pz) - m_GridOrigin) / m_CellSize;
+        const glm::ivec3 center(glm::floor(rel));
+
+        u32 found = 0;
+        for (i32 dz = -1; dz <= 1; ++dz)
+        {
+            for (i32 dy = -1; dy <= 1; ++dy)
+            {
+                for (i32 dx = -1; dx <= 1; ++dx)
+                {
+                    const glm::ivec3 cell = center + glm::ivec3(dx, dy, dz);
+                    if (cell.x < 0 || cell.y < 0 || cell.z < 0 ||
+                        cell.x >= static_cast<i32>(m_GridDims.x) ||
+                        cell.y >= static_cast<i32>(m_GridDims.y) ||
+                        cell.z >= static_cast<i32>(m_GridDims.z))
+                    {
+                        continue;
+                    }
+                    const u32 cellIndex = (static_cast<u32>(cell.z) * m_GridDims.y + static_cast<u32>(cell.y)) * m_GridDims.x +
+                                          static_cast<u32>(cell.x);
+                    const u32 last = m_CellStart[cellIndex + 1];
+                    for (u32 j = m_CellStart[cellIndex]; j < last; ++j)
+                    {
+                        const f32 ox = px - m_SortedX[j];
+                        const f32 oy = py - m_SortedY[j];
+                        const f32 oz = pz - m_SortedZ[j];
+                        if (j == s || ox * ox + oy * oy + oz * oz >= radius2)
+                        {
+                            continue;
+                        }
+                        if (outNeighbours)
+                        {
+                            outNeighbours[found] = j;
+                        }
+                        ++found;
+                    }
+                }
+            }
+        }
+        return found;
+    }
+
+    void CPUFluidSolver::BuildNeighbourLists(f32 radius)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        // Two passes over the same scan (count, then fill) rather than
+        // per-chunk lists stitched together: the scan is cheap next to the
+        // constraint iterations, and the lists land in one CSR array.
+        const u32 count = GetCount();
+        const f32 radius2 = radius * radius;
+        m_NeighbourStart.resize(static_cast<sizet>(count) + 1);
+        m_NeighbourStart[0] = 0;
+        ForEachChunk("CPUFluidSolver::CountNeighbours", [this, radius2](u32, u32 begin, u32 end)
+                     {
+            for (u32 s = begin; s < end; ++s)
+            {
+                m_NeighbourStart[s + 1] = ScanNeighbourhood(s, radius2, nullptr);
+            } });
+        for (u32 s = 0; s < count; ++s)
+        {
+            m_NeighbourStart[s + 1] += m_NeighbourStart[s];
+        }
+
+        m_Neighbours.resize(m_NeighbourStart[count]);
+        ForEachChunk("CPUFluidSolver::FillNeighbours", [this, radius2](u32, u32 begin, u32 end)
+                     {
+            for (u32 s = begin; s < end; ++s)
+            {
+                ScanNeighbourhood(s, radius2, m_Neighbours.data() + m_NeighbourStart[s]);
+            } });
+    }
+
     template<typename Fn>
     void CPUFluidSolver::ForEachNeighbour(const glm::vec3& position, Fn&& fn) const
     {
@@ -203,14 +400,28 @@ namespace OloEngine
             }
         }
 
-        const u32 count = static_cast<u32>(m_Positions.size());
-        if (count == 0)
+        if (m_Positions.empty())
         {
             m_LastAverageDensity = 0.0f;
             m_LastMaxDensityError = 0.0f;
             return;
         }
 
+        if (m_Mode == CPUFluidSolverMode::Parallel)
+        {
+            SolveParallel(params, dt, bodyProxies, outBodyFeedback);
+        }
+        else
+        {
+            SolveSerial(params, dt, bodyProxies, outBodyFeedback);
+        }
+    }
+
+    void CPUFluidSolver::SolveSerial(const FluidSolverParams& params, f32 dt,
+                                     std::span<const FluidBodyProxy> bodyProxies,
+                                     std::span<FluidBodyFeedback> outBodyFeedback)
+    {
+        const u32 count = static_cast<u32>(m_Positions.size());
         const f32 h = params.SmoothingRadius();
         const f32 poly6Scale = FluidKernels::Poly6Scale(h);
         const f32 spikyScale = FluidKernels::SpikyGradScale(h);
@@ -361,21 +572,7 @@ namespace OloEngine
             }
         }
 
-        // The proxy loop above runs once per constraint iteration, and the
-        // lambda solve pushes particles back toward a body between iterations,
-        // so the raw sum over-counts the physical contact impulse by roughly
-        // the iteration count (empirically: a floating box gets catapulted).
-        // Average it back to one resolution's worth. GPU mirror:
-        // GPUFluidSolver::HarvestFeedback divides by the same factor.
-        if (!outBodyFeedback.empty() && params.SolverIterations > 1)
-        {
-            const f32 invIterations = 1.0f / static_cast<f32>(params.SolverIterations);
-            for (FluidBodyFeedback& feedback : outBodyFeedback)
-            {
-                feedback.Impulse *= invIterations;
-                feedback.AngularImpulse *= invIterations;
-            }
-        }
+        AverageFeedbackOverIterations(outBodyFeedback, params.SolverIterations);
 
         // ---- 4. Velocity update ---------------------------------------------
         for (u32 i = 0; i < count; ++i)
@@ -453,4 +650,323 @@ namespace OloEngine
             m_Positions[i] = m_Predicted[i];
         }
     }
+
+    void CPUFluidSolver::SolveParallel(const FluidSolverParams& params, f32 dt,
+                                       std::span<const FluidBodyProxy> bodyProxies,
+                                       std::span<FluidBodyFeedback> outBodyFeedback)
+    {
+        const u32 count = static_cast<u32>(m_Positions.size());
+        const f32 h = params.SmoothingRadius();
+        const f32 h2 = h * h;
+        const f32 poly6Scale = FluidKernels::Poly6Scale(h);
+        const f32 spikyScale = FluidKernels::SpikyGradScale(h);
+        const f32 mass = params.ParticleMass();
+        const f32 restDensityInv = 1.0f / params.RestDensity;
+        const f32 massOverRho = mass * restDensityInv;
+        const f32 selfDensity = mass * FluidKernels::Poly6(0.0f, h, poly6Scale);
+        const f32 sCorrDenom = FluidKernels::Poly6(params.SCorrDeltaQ * h, h, poly6Scale);
+        const f32 maxDeltaP = kFluidMaxDeltaPFraction * h;
+        const f32 particleRadius = params.ParticleRadius;
+        const glm::vec3 innerMin = params.BoundsMin + glm::vec3(particleRadius);
+        const glm::vec3 innerMax = params.BoundsMax - glm::vec3(particleRadius);
+        const f32 dtInv = 1.0f / dt;
+
+        m_ChunkCount = (count + kParallelChunkSize - 1) / kParallelChunkSize;
+        m_Predicted.resize(count);
+        m_DeltaP.resize(count);
+        m_Lambda.resize(count);
+        m_Density.resize(count);
+        m_Omega.resize(count);
+        m_OmegaLength.resize(count);
+        m_VelocityScratch.resize(count);
+        m_SortedVX.resize(count);
+        m_SortedVY.resize(count);
+        m_SortedVZ.resize(count);
+        m_ChunkDensitySum.resize(m_ChunkCount);
+        m_ChunkMaxError.resize(m_ChunkCount);
+
+        // ---- 1. External forces + prediction (original order) ----------------
+        ForEachChunk("CPUFluidSolver::Predict", [&](u32, u32 begin, u32 end)
+                     {
+            for (u32 i = begin; i < end; ++i)
+            {
+                glm::vec3 v = m_Velocities[i] + params.Gravity * dt;
+                const f32 speed2 = glm::dot(v, v);
+                if (speed2 > params.MaxSpeed * params.MaxSpeed)
+                {
+                    v *= params.MaxSpeed / std::sqrt(speed2);
+                }
+                m_Velocities[i] = v;
+                m_Predicted[i] = glm::clamp(m_Positions[i] + v * dt, innerMin, innerMax);
+            } });
+
+        // ---- 2. Sort by cell + neighbour lists (once per step) ---------------
+        SortByCell(params);
+        BuildNeighbourLists(h * (1.0f + kNeighbourSkinFraction));
+
+        f32* const x = m_SortedX.data();
+        f32* const y = m_SortedY.data();
+        f32* const z = m_SortedZ.data();
+        const u32* const neighbourStart = m_NeighbourStart.data();
+        const u32* const neighbours = m_Neighbours.data();
+        f32* const lambda = m_Lambda.data();
+
+        const sizet proxyCount = bodyProxies.size();
+        const sizet feedbackCount = std::min(proxyCount, outBodyFeedback.size());
+        m_ChunkFeedback.resize(static_cast<sizet>(m_ChunkCount) * feedbackCount);
+
+        // ---- 3. Constraint projection (Jacobi) -------------------------------
+        // Every pass reads neighbours and writes only its own particle, and the
+        // passes are separate ParallelFors, so a pass never sees a half-updated
+        // iteration.
+        for (u32 iteration = 0; iteration < params.SolverIterations; ++iteration)
+        {
+            // 3a. Density + lambda, with per-chunk statistics.
+            ForEachChunk("CPUFluidSolver::Density", [&](u32 chunk, u32 begin, u32 end)
+                         {
+                f32 densitySum = 0.0f;
+                f32 maxError = 0.0f;
+                for (u32 s = begin; s < end; ++s)
+                {
+                    const f32 px = x[s];
+                    const f32 py = y[s];
+                    const f32 pz = z[s];
+                    f32 density = selfDensity;
+                    f32 gx = 0.0f;
+                    f32 gy = 0.0f;
+                    f32 gz = 0.0f;
+                    f32 gradSum = 0.0f;
+                    for (u32 k = neighbourStart[s]; k < neighbourStart[s + 1]; ++k)
+                    {
+                        const u32 j = neighbours[k];
+                        const f32 ox = px - x[j];
+                        const f32 oy = py - y[j];
+                        const f32 oz = pz - z[j];
+                        const f32 r2 = ox * ox + oy * oy + oz * oz;
+                        const f32 r = std::sqrt(r2);
+                        const bool inside = r < h;
+                        const f32 diff = h2 - r2;
+                        const f32 hr = h - r;
+                        const f32 grad = inside && r > 0.0f ? spikyScale * hr * hr / r * massOverRho : 0.0f;
+                        density += inside ? mass * poly6Scale * diff * diff * diff : 0.0f;
+                        gx += ox * grad;
+                        gy += oy * grad;
+                        gz += oz * grad;
+                        gradSum += r2 * grad * grad;
+                    }
+                    m_Density[s] = density;
+                    const f32 constraint = density * restDensityInv - 1.0f;
+                    lambda[s] = -constraint / (gradSum + gx * gx + gy * gy + gz * gz + params.CfmEpsilon);
+                    densitySum += density;
+                    maxError = std::max(maxError, constraint);
+                }
+                m_ChunkDensitySum[chunk] = densitySum;
+                m_ChunkMaxError[chunk] = maxError; });
+
+            f32 densitySum = 0.0f;
+            f32 maxError = 0.0f;
+            for (u32 chunk = 0; chunk < m_ChunkCount; ++chunk)
+            {
+                densitySum += m_ChunkDensitySum[chunk];
+                maxError = std::max(maxError, m_ChunkMaxError[chunk]);
+            }
+            m_LastAverageDensity = densitySum / static_cast<f32>(count);
+            m_LastMaxDensityError = maxError;
+
+            // 3b. Position correction (same formula and clamp as SolveSerial).
+            ForEachChunk("CPUFluidSolver::PositionCorrection", [&](u32, u32 begin, u32 end)
+                         {
+                for (u32 s = begin; s < end; ++s)
+                {
+                    const f32 px = x[s];
+                    const f32 py = y[s];
+                    const f32 pz = z[s];
+                    const f32 lambdaI = lambda[s];
+                    f32 dx = 0.0f;
+                    f32 dy = 0.0f;
+                    f32 dz = 0.0f;
+                    for (u32 k = neighbourStart[s]; k < neighbourStart[s + 1]; ++k)
+                    {
+                        const u32 j = neighbours[k];
+                        const f32 ox = px - x[j];
+                        const f32 oy = py - y[j];
+                        const f32 oz = pz - z[j];
+                        const f32 r2 = ox * ox + oy * oy + oz * oz;
+                        const f32 r = std::sqrt(r2);
+                        if (!(r < h) || r <= 0.0f)
+                        {
+                            continue;
+                        }
+                        const f32 diff = h2 - r2;
+                        const f32 w = poly6Scale * diff * diff * diff;
+                        const f32 sCorr = sCorrDenom > 0.0f ? -params.SCorrK * SCorrPower(w / sCorrDenom, params.SCorrN) : 0.0f;
+                        const f32 hr = h - r;
+                        const f32 scale = (lambdaI + lambda[j] + sCorr) * (spikyScale * hr * hr / r);
+                        dx += ox * scale;
+                        dy += oy * scale;
+                        dz += oz * scale;
+                    }
+                    glm::vec3 correction = glm::vec3(dx, dy, dz) * (massOverRho * kFluidJacobiRelaxation);
+                    const f32 correctionLen2 = glm::dot(correction, correction);
+                    if (correctionLen2 > maxDeltaP * maxDeltaP)
+                    {
+                        correction *= maxDeltaP / std::sqrt(correctionLen2);
+                    }
+                    m_DeltaP[s] = correction;
+                } });
+
+            // 3c. Apply + proxy collisions. Body feedback is accumulated per
+            // chunk and folded into the output in chunk order below.
+            ForEachChunk("CPUFluidSolver::ApplyCorrection", [&](u32 chunk, u32 begin, u32 end)
+                         {
+                FluidBodyFeedback* chunkFeedback = m_ChunkFeedback.data() + static_cast<sizet>(chunk) * feedbackCount;
+                std::fill_n(chunkFeedback, feedbackCount, FluidBodyFeedback{});
+                for (u32 s = begin; s < end; ++s)
+                {
+                    glm::vec3 p = glm::vec3(x[s], y[s], z[s]) + m_DeltaP[s];
+                    for (sizet b = 0; b < proxyCount; ++b)
+                    {
+                        const FluidBodyProxy& proxy = bodyProxies[b];
+                        const glm::quat rotation = ProxyRotation(proxy);
+                        const glm::vec3 com(proxy.Position);
+                        const glm::vec3 local = glm::conjugate(rotation) * (p - com);
+                        glm::vec3 localNormal(0.0f);
+                        const f32 signedDist = ProxySignedDistance(proxy, local, localNormal);
+                        const f32 penetration = particleRadius - signedDist;
+                        if (penetration <= 0.0f)
+                        {
+                            continue;
+                        }
+                        const glm::vec3 correction = (rotation * localNormal) * penetration;
+                        p += correction;
+                        if (b < feedbackCount)
+                        {
+                            const glm::vec3 impulse = -correction * (mass * dtInv * params.CouplingStiffness);
+                            chunkFeedback[b].Impulse += impulse;
+                            chunkFeedback[b].AngularImpulse += glm::cross(p - com, impulse);
+                        }
+                    }
+                    p = glm::clamp(p, innerMin, innerMax);
+                    x[s] = p.x;
+                    y[s] = p.y;
+                    z[s] = p.z;
+                } });
+
+            for (u32 chunk = 0; chunk < m_ChunkCount && feedbackCount > 0; ++chunk)
+            {
+                const FluidBodyFeedback* chunkFeedback = m_ChunkFeedback.data() + static_cast<sizet>(chunk) * feedbackCount;
+                for (sizet b = 0; b < feedbackCount; ++b)
+                {
+                    outBodyFeedback[b].Impulse += chunkFeedback[b].Impulse;
+                    outBodyFeedback[b].AngularImpulse += chunkFeedback[b].AngularImpulse;
+                }
+            }
+        }
+
+        AverageFeedbackOverIterations(outBodyFeedback, params.SolverIterations);
+
+        // ---- 4. Velocity update ---------------------------------------------
+        f32* const vx = m_SortedVX.data();
+        f32* const vy = m_SortedVY.data();
+        f32* const vz = m_SortedVZ.data();
+        ForEachChunk("CPUFluidSolver::Velocity", [&](u32, u32 begin, u32 end)
+                     {
+            for (u32 s = begin; s < end; ++s)
+            {
+                const glm::vec3 start = m_SortedStart[s];
+                vx[s] = (x[s] - start.x) * dtInv;
+                vy[s] = (y[s] - start.y) * dtInv;
+                vz[s] = (z[s] - start.z) * dtInv;
+            } });
+
+        // ---- 5. Vorticity omega_i = sum_j vol * (v_j - v_i) x gradW ----------
+        const f32 volumeWeight = mass * restDensityInv;
+        ForEachChunk("CPUFluidSolver::Vorticity", [&](u32, u32 begin, u32 end)
+                     {
+            for (u32 s = begin; s < end; ++s)
+            {
+                const f32 px = x[s];
+                const f32 py = y[s];
+                const f32 pz = z[s];
+                f32 wx = 0.0f;
+                f32 wy = 0.0f;
+                f32 wz = 0.0f;
+                for (u32 k = neighbourStart[s]; k < neighbourStart[s + 1]; ++k)
+                {
+                    const u32 j = neighbours[k];
+                    const f32 ox = px - x[j];
+                    const f32 oy = py - y[j];
+                    const f32 oz = pz - z[j];
+                    const f32 r = std::sqrt(ox * ox + oy * oy + oz * oz);
+                    const f32 hr = h - r;
+                    const f32 grad = r < h && r > 0.0f ? volumeWeight * spikyScale * hr * hr / r : 0.0f;
+                    const f32 ux = vx[j] - vx[s];
+                    const f32 uy = vy[j] - vy[s];
+                    const f32 uz = vz[j] - vz[s];
+                    // (v_j - v_i) x (offset * grad)
+                    wx += (uy * oz - uz * oy) * grad;
+                    wy += (uz * ox - ux * oz) * grad;
+                    wz += (ux * oy - uy * ox) * grad;
+                }
+                m_Omega[s] = glm::vec3(wx, wy, wz);
+                m_OmegaLength[s] = std::sqrt(wx * wx + wy * wy + wz * wz);
+            } });
+
+        // ---- 6. Vorticity confinement + XSPH viscosity -----------------------
+        ForEachChunk("CPUFluidSolver::ConfinementXsph", [&](u32, u32 begin, u32 end)
+                     {
+            for (u32 s = begin; s < end; ++s)
+            {
+                const f32 px = x[s];
+                const f32 py = y[s];
+                const f32 pz = z[s];
+                glm::vec3 gradMag(0.0f);
+                glm::vec3 xsph(0.0f);
+                for (u32 k = neighbourStart[s]; k < neighbourStart[s + 1]; ++k)
+                {
+                    const u32 j = neighbours[k];
+                    const f32 ox = px - x[j];
+                    const f32 oy = py - y[j];
+                    const f32 oz = pz - z[j];
+                    const f32 r2 = ox * ox + oy * oy + oz * oz;
+                    const f32 r = std::sqrt(r2);
+                    if (!(r < h))
+                    {
+                        continue;
+                    }
+                    const f32 hr = h - r;
+                    const f32 grad = r > 0.0f ? volumeWeight * m_OmegaLength[j] * spikyScale * hr * hr / r : 0.0f;
+                    const f32 diff = h2 - r2;
+                    const f32 w = volumeWeight * poly6Scale * diff * diff * diff;
+                    gradMag += glm::vec3(ox, oy, oz) * grad;
+                    xsph += glm::vec3(vx[j] - vx[s], vy[j] - vy[s], vz[j] - vz[s]) * w;
+                }
+
+                glm::vec3 v(vx[s], vy[s], vz[s]);
+                const f32 gradLen = glm::length(gradMag);
+                if (gradLen > 1.0e-6f)
+                {
+                    const glm::vec3 confinement = params.VorticityEpsilon * glm::cross(gradMag / gradLen, m_Omega[s]);
+                    v += confinement * dt;
+                }
+                v += params.XsphViscosity * xsph;
+
+                const f32 speed2 = glm::dot(v, v);
+                if (speed2 > params.MaxSpeed * params.MaxSpeed)
+                {
+                    v *= params.MaxSpeed / std::sqrt(speed2);
+                }
+                m_VelocityScratch[s] = v;
+            } });
+
+        // ---- 7. Commit, back in original order -------------------------------
+        ForEachChunk("CPUFluidSolver::Commit", [&](u32, u32 begin, u32 end)
+                     {
+            for (u32 s = begin; s < end; ++s)
+            {
+                const u32 i = m_SortedToOriginal[s];
+                m_Positions[i] = glm::vec3(x[s], y[s], z[s]);
+                m_Velocities[i] = m_VelocityScratch[s];
+            } });
+    }
 } // namespace OloEngine
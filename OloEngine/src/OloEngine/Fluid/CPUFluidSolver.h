@@ -15,18 +15,35 @@ namespace OloEngine
     //
     // This is the ground truth the GPU solver is parity-tested against, the
     // backend for headless contexts (OloServer, Functional tests — no GL), and
-    // the OLO_FLUID_SEQUENTIAL determinism fallback. Every loop is serial and
-    // index-ordered: two runs over the same inputs are bit-identical.
+    // the OLO_FLUID_SEQUENTIAL determinism fallback. In Serial mode (the
+    // default) every loop is serial and index-ordered: two runs over the same
+    // inputs are bit-identical.
     //
     // The neighbour search is the same dense-grid linked-list scheme the GPU
     // uses (head[cell] stores index+1, 0 = empty), built once per step from
     // the predicted positions.
+    //
+    // Parallel mode is the throughput path for large headless pools. Each step
+    // it counting-sorts the particles by cell into SoA streams, builds CSR
+    // neighbour lists once, and runs every phase with ParallelFor over fixed
+    // chunks of the sorted order. Each particle writes only its own outputs,
+    // and the two reductions (density statistics, body feedback) are summed per
+    // chunk and then combined in chunk order. The results are therefore
+    // bit-identical for any worker count. They match Serial only within
+    // tolerance, because neighbour lists are frozen at the start of the step
+    // and the sums run in a different order. Serial stays the parity oracle.
     // =========================================================================
+    enum class CPUFluidSolverMode : u8
+    {
+        Serial,
+        Parallel
+    };
+
     class CPUFluidSolver
     {
       public:
         CPUFluidSolver() = default;
-        explicit CPUFluidSolver(u32 maxParticles);
+        explicit CPUFluidSolver(u32 maxParticles, CPUFluidSolverMode mode = CPUFluidSolverMode::Serial);
 
         /// Drop all particles and reallocate for a new capacity.
         void Reset(u32 maxParticles);
@@ -42,6 +59,22 @@ namespace OloEngine
                   std::span<FluidBodyFeedback> outBodyFeedback = {},
                   std::span<const FluidKillBox> killBoxes = {});
 
+        void SetMode(CPUFluidSolverMode mode)
+        {
+            m_Mode = mode;
+        }
+        [[nodiscard]] CPUFluidSolverMode GetMode() const
+        {
+            return m_Mode;
+        }
+
+        /// Parallel mode only: run the same fixed chunks on the calling thread.
+        /// The results do not change, which is what the determinism tests pin.
+        void SetRunInline(bool runInline)
+        {
+            m_RunInline = runInline;
+        }
+
         [[nodiscard]] u32 GetCount() const
         {
             return static_cast<u32>(m_Positions.size());
@@ -71,14 +104,39 @@ namespace OloEngine
         }
 
       private:
+        void SolveSerial(const FluidSolverParams& params, f32 dt,
+                         std::span<const FluidBodyProxy> bodyProxies,
+                         std::span<FluidBodyFeedback> outBodyFeedback);
+        void SolveParallel(const FluidSolverParams& params, f32 dt,
+                           std::span<const FluidBodyProxy> bodyProxies,
+                           std::span<FluidBodyFeedback> outBodyFeedback);
+
+        /// Size the dense grid for `params`; returns the cell count.
+        sizet ConfigureGrid(const FluidSolverParams& params);
+        [[nodiscard]] u32 CellIndexOf(const glm::vec3& position) const;
+
         void BuildGrid(const FluidSolverParams& params);
 
+        /// Parallel mode: counting-sort m_Predicted by cell into the SoA
+        /// streams, then build the CSR neighbour lists over the sorted order.
+        void SortByCell(const FluidSolverParams& params);
+        void BuildNeighbourLists(f32 radius);
+
+        /// Count (and, when `outNeighbours` is set, write) the sorted indices
+        /// within sqrt(radius2) of sorted particle `s`, excluding itself.
+        u32 ScanNeighbourhood(u32 s, f32 radius2, u32* outNeighbours) const;
+
+        template<typename Fn>
+        void ForEachChunk(const char* debugName, Fn&& fn) const;
+
         /// Visit the indices of every particle in the 27-cell neighbourhood of
         /// `position` (includes the querying particle itself when present).
         template<typename Fn>
         void ForEachNeighbour(const glm::vec3& position, Fn&& fn) const;
 
         u32 m_MaxParticles = 0;
+        CPUFluidSolverMode m_Mode = CPUFluidSolverMode::Serial;
+        bool m_RunInline = false;
 
         std::vector<glm::vec3> m_Positions;
         std::vector<glm::vec3> m_Velocities;
@@ -96,6 +154,31 @@ namespace OloEngine
         glm::vec3 m_GridOrigin{ 0.0f };
         f32 m_CellSize = 0.0f;
 
+        // Parallel mode. Sorted particle s is original particle
+        // m_SortedToOriginal[s]; the particles of cell c are the sorted range
+        // [m_CellStart[c], m_CellStart[c + 1]). Cell and rank are per original
+        // particle, everything after them per sorted index. m_Predicted stays
+        // in original order; m_DeltaP, m_Lambda, m_Density, m_Omega and
+        // m_VelocityScratch are reused in sorted order.
+        std::vector<u32> m_CellOfParticle;
+        std::vector<u32> m_RankInCell;
+        std::vector<u32> m_CellStart;
+        std::vector<u32> m_SortedToOriginal;
+        std::vector<u32> m_NeighbourStart;
+        std::vector<u32> m_Neighbours;
+        std::vector<f32> m_SortedX;
+        std::vector<f32> m_SortedY;
+        std::vector<f32> m_SortedZ;
+        std::vector<f32> m_SortedVX;
+        std::vector<f32> m_SortedVY;
+        std::vector<f32> m_SortedVZ;
+        std::vector<f32> m_OmegaLength;
+        std::vector<glm::vec3> m_SortedStart;
+        std::vector<f32> m_ChunkDensitySum;
+        std::vector<f32> m_ChunkMaxError;
+        std::vector<FluidBodyFeedback> m_ChunkFeedback;
+        u32 m_ChunkCount = 0;
+
         f32 m_LastAverageDensity = 0.0f;
         f32 m_LastMaxDensityError = 0.0f;
     };
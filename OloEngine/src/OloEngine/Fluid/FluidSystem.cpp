@@ -505,6 +505,10 @@ namespace OloEngine
                 instance.EmitCarry.clear();
                 instance.EmitRng.SetSeed(ParticleSystem::DeriveSeed(kFluidEmitterSeed, id));
 
+                // Headless pools run the parallel CPU mode; OLO_FLUID_SEQUENTIAL
+                // keeps the serial reference.
+                const CPUFluidSolverMode cpuMode = IsSequentialForced() ? CPUFluidSolverMode::Serial
+                                                                        : CPUFluidSolverMode::Parallel;
                 if (wantGpu)
                 {
                     instance.Gpu = CreateScope<GPUFluidSolver>(maxParticles);
@@ -514,12 +518,12 @@ namespace OloEngine
                                       "falling back to the CPU reference solver",
                                       id);
                         instance.Gpu.reset();
-                        instance.Cpu = CreateScope<CPUFluidSolver>(maxParticles);
+                        instance.Cpu = CreateScope<CPUFluidSolver>(maxParticles, cpuMode);
                     }
                 }
                 else
                 {
-                    instance.Cpu = CreateScope<CPUFluidSolver>(maxParticles);
+                    instance.Cpu = CreateScope<CPUFluidSolver>(maxParticles, cpuMode);
                 }
             }
 
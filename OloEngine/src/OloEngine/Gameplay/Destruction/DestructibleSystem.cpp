@@ -66,6 +66,18 @@ namespace OloEngine
             f32 Lifetime = DestructibleSystem::kDefaultDebrisLifetime;
         };
 
+        // Conservative world-space half extent of a broken source, for marking
+        // navmesh tiles dirty: the bounding sphere of its mesh bounds under the
+        // source scale (so rotation can't escape it), or the scale itself.
+        glm::vec3 BreakFootprint(const BreakRequest& req)
+        {
+            const glm::vec3 scale = glm::abs(req.Scale);
+            if (!req.SourceMesh)
+                return glm::vec3(std::max({ scale.x, scale.y, scale.z }));
+            const BoundingBox& bounds = req.SourceMesh->GetBoundingBox();
+            return glm::vec3(glm::length(glm::max(glm::abs(bounds.Min), glm::abs(bounds.Max)) * scale));
+        }
+
         void SpawnDebris(Scene* scene, const BreakRequest& req, u32 count)
         {
             if (count == 0)
@@ -258,6 +270,14 @@ namespace OloEngine
                 sourcesToDestroy.push_back(e);
         }
 
+        // A break changes the walkable geometry under it; a tiled navmesh
+        // rebuilds just those tiles (no-op for a solo mesh).
+        for (const auto& req : breaks)
+        {
+            const glm::vec3 footprint = BreakFootprint(req);
+            scene->MarkNavMeshDirty(req.Position - footprint, req.Position + footprint);
+        }
+
         // ── Phase 2: age debris; collect expired + surviving (age, entity) ──
         std::vector<entt::entity> debrisToDestroy;
         std::vector<std::pair<f32, entt::entity>> survivors; // (age, entity)
@@ -0,0 +1,701 @@
+#include "OloEnginePCH.h"
+#include "OloEngine/Navigation/FlowFieldManager.h"
+#include "OloEngine/Task/ParallelFor.h"
+
+#include <DetourNavMeshQuery.h>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <queue>
+
+#if defined(_M_X64) || defined(__SSE__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define OLO_FLOWFIELD_HAS_SSE 1
+#include <xmmintrin.h>
+#else
+#define OLO_FLOWFIELD_HAS_SSE 0
+#endif
+
+namespace OloEngine
+{
+    namespace
+    {
+        // Eight neighbours: the four axis steps first, then the diagonals.
+        constexpr i32 kDirX[8] = { 1, -1, 0, 0, 1, 1, -1, -1 };
+        constexpr i32 kDirZ[8] = { 0, 0, 1, -1, 1, -1, 1, -1 };
+        constexpr f32 kStepLength[8] = { 1.0f, 1.0f, 1.0f, 1.0f, 1.41421356f, 1.41421356f, 1.41421356f, 1.41421356f };
+        constexpr f32 kInvSqrt2 = 0.70710678f;
+        constexpr glm::vec2 kDirection[8] = {
+            { 1.0f, 0.0f }, { -1.0f, 0.0f }, { 0.0f, 1.0f }, { 0.0f, -1.0f },
+            { kInvSqrt2, kInvSqrt2 }, { kInvSqrt2, -kInvSqrt2 }, { -kInvSqrt2, kInvSqrt2 }, { -kInvSqrt2, -kInvSqrt2 }
+        };
+
+        // Rings searched around a goal that lands on a blocked cell.
+        constexpr i32 kGoalSnapRings = 4;
+        // Grid rows sampled per navmesh query when building the grid.
+        constexpr i32 kRowsPerBand = 8;
+
+        u32 HashBucket(i32 x, i32 z)
+        {
+            return (static_cast<u32>(x) * 73856093u) ^ (static_cast<u32>(z) * 19349663u);
+        }
+
+        // Sum of (overlap / distance) * offset over agents [begin, end) of the
+        // sorted SoA arrays that overlap a disc at (x, z) of radius r. The
+        // agent's own entry has a zero offset and drops out.
+        void AccumulateSeparation(const f32* xs, const f32* zs, const f32* rs, u32 begin, u32 end,
+                                  f32 x, f32 z, f32 r, f32& outX, f32& outZ)
+        {
+            constexpr f32 kMinDistanceSq = 1e-8f;
+            u32 k = begin;
+#if OLO_FLOWFIELD_HAS_SSE
+            const __m128 px = _mm_set1_ps(x);
+            const __m128 pz = _mm_set1_ps(z);
+            const __m128 pr = _mm_set1_ps(r);
+            const __m128 eps = _mm_set1_ps(kMinDistanceSq);
+            __m128 accX = _mm_setzero_ps();
+            __m128 accZ = _mm_setzero_ps();
+            for (; k + 4 <= end; k += 4)
+            {
+                const __m128 dx = _mm_sub_ps(px, _mm_loadu_ps(xs + k));
+                const __m128 dz = _mm_sub_ps(pz, _mm_loadu_ps(zs + k));
+                const __m128 d2 = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dz, dz));
+                const __m128 minDist = _mm_add_ps(pr, _mm_loadu_ps(rs + k));
+                const __m128 overlaps = _mm_and_ps(_mm_cmplt_ps(d2, _mm_mul_ps(minDist, minDist)), _mm_cmpgt_ps(d2, eps));
+                const __m128 d = _mm_sqrt_ps(_mm_max_ps(d2, eps));
+                const __m128 w = _mm_and_ps(overlaps, _mm_div_ps(_mm_sub_ps(minDist, d), d));
+                accX = _mm_add_ps(accX, _mm_mul_ps(w, dx));
+                accZ = _mm_add_ps(accZ, _mm_mul_ps(w, dz));
+            }
+            alignas(16) f32 lanesX[4];
+            alignas(16) f32 lanesZ[4];
+            _mm_store_ps(lanesX, accX);
+            _mm_store_ps(lanesZ, accZ);
+            outX += (lanesX[0] + lanesX[1]) + (lanesX[2] + lanesX[3]);
+            outZ += (lanesZ[0] + lanesZ[1]) + (lanesZ[2] + lanesZ[3]);
+#endif
+            for (; k < end; ++k)
+            {
+                const f32 dx = x - xs[k];
+                const f32 dz = z - zs[k];
+                const f32 d2 = dx * dx + dz * dz;
+                const f32 minDist = r + rs[k];
+                if (d2 >= minDist * minDist || d2 <= kMinDistanceSq)
+                    continue;
+                const f32 d = std::sqrt(d2);
+                const f32 w = (minDist - d) / d;
+                outX += w * dx;
+                outZ += w * dz;
+            }
+        }
+    } // namespace
+
+    i32 FlowFieldManager::Grid::CellAt(f32 x, f32 z) const
+    {
+        const i32 cx = static_cast<i32>(std::floor((x - Origin.x) / CellSize));
+        const i32 cz = static_cast<i32>(std::floor((z - Origin.y) / CellSize));
+        if (cx < 0 || cz < 0 || cx >= Width || cz >= Height)
+            return -1;
+        return cz * Width + cx;
+    }
+
+    FlowFieldManager::FlowFieldManager(const Ref<NavMesh>& navMesh, const FlowFieldSettings& settings)
+        : m_NavMesh(navMesh), m_Settings(settings)
+    {
+    }
+
+    FlowFieldManager::~FlowFieldManager()
+    {
+        // Integrations read m_Grid and write into the groups' Building fields.
+        for (auto& [id, group] : m_Groups)
+        {
+            if (group.Building)
+                group.Task.Wait();
+        }
+    }
+
+    void FlowFieldManager::EnsureGrid()
+    {
+        if (m_GridBuilt)
+            return;
+        m_GridBuilt = true;
+        BuildGrid();
+    }
+
+    void FlowFieldManager::BuildGrid()
+    {
+        OLO_PROFILE_FUNCTION();
+
+        m_Grid = Grid{};
+        m_Grid.CellSize = std::max(m_Settings.CellSize, 0.05f);
+        if (!IsValid())
+            return;
+
+        const dtNavMesh* navMesh = m_NavMesh->GetDetourNavMesh();
+        glm::vec3 boundsMin(std::numeric_limits<f32>::max());
+        glm::vec3 boundsMax(std::numeric_limits<f32>::lowest());
+        for (i32 i = 0; i < navMesh->getMaxTiles(); ++i)
+        {
+            const dtMeshTile* tile = navMesh->getTile(i);
+            if (!tile || !tile->header)
+                continue;
+            boundsMin = glm::min(boundsMin, glm::vec3(tile->header->bmin[0], tile->header->bmin[1], tile->header->bmin[2]));
+            boundsMax = glm::max(boundsMax, glm::vec3(tile->header->bmax[0], tile->header->bmax[1], tile->header->bmax[2]));
+        }
+        if (boundsMin.x > boundsMax.x)
+            return;
+
+        f32 cellSize = m_Grid.CellSize;
+        const glm::vec2 extent(boundsMax.x - boundsMin.x, boundsMax.z - boundsMin.z);
+        const f64 wanted = std::ceil(extent.x / cellSize) * std::ceil(extent.y / cellSize);
+        if (wanted > static_cast<f64>(m_Settings.MaxCells))
+        {
+            cellSize *= static_cast<f32>(std::sqrt(wanted / static_cast<f64>(m_Settings.MaxCells))) * 1.01f;
+            OLO_CORE_WARN("FlowFieldManager: navmesh too large for {} cells at {:.2f} m; using {:.2f} m cells",
+                          m_Settings.MaxCells, m_Settings.CellSize, cellSize);
+        }
+
+        Grid& grid = m_Grid;
+        grid.CellSize = cellSize;
+        grid.Origin = { boundsMin.x, boundsMin.z };
+        grid.Width = std::max(1, static_cast<i32>(std::ceil(extent.x / cellSize)));
+        grid.Height = std::max(1, static_cast<i32>(std::ceil(extent.y / cellSize)));
+        const sizet cellCount = static_cast<sizet>(grid.Width) * static_cast<sizet>(grid.Height);
+        grid.Walkable.assign(cellCount, 0);
+        grid.Links.assign(cellCount, 0);
+        grid.Heights.assign(cellCount, 0.0f);
+
+        // A cell is walkable if the navmesh covers its centre column; its height
+        // is the surface there. One query per band of rows.
+        const NavMeshSettings& navSettings = m_NavMesh->GetSettings();
+        const f32 midY = 0.5f * (boundsMin.y + boundsMax.y);
+        const f32 halfCell = 0.5f * cellSize;
+        const f32 extents[3] = { halfCell, 0.5f * (boundsMax.y - boundsMin.y) + navSettings.AgentHeight, halfCell };
+        const i32 bandCount = (grid.Height + kRowsPerBand - 1) / kRowsPerBand;
+        ParallelFor("FlowFieldManager::SampleGrid", bandCount, 1, [&grid, navMesh, &extents, midY, halfCell](i32 band)
+                    {
+                        dtNavMeshQuery* query = dtAllocNavMeshQuery();
+                        if (!query || dtStatusFailed(query->init(navMesh, 64)))
+                        {
+                            dtFreeNavMeshQuery(query);
+                            return;
+                        }
+                        const dtQueryFilter filter;
+                        const i32 rowEnd = std::min(grid.Height, (band + 1) * kRowsPerBand);
+                        for (i32 z = band * kRowsPerBand; z < rowEnd; ++z)
+                        {
+                            for (i32 x = 0; x < grid.Width; ++x)
+                            {
+                                const f32 center[3] = { grid.Origin.x + (static_cast<f32>(x) + 0.5f) * grid.CellSize, midY,
+                                                        grid.Origin.y + (static_cast<f32>(z) + 0.5f) * grid.CellSize };
+                                dtPolyRef ref = 0;
+                                f32 nearest[3];
+                                if (dtStatusFailed(query->findNearestPoly(center, extents, &filter, &ref, nearest)) || ref == 0)
+                                    continue;
+                                if (std::abs(nearest[0] - center[0]) > halfCell || std::abs(nearest[2] - center[2]) > halfCell)
+                                    continue;
+                                const sizet cell = static_cast<sizet>(z) * static_cast<sizet>(grid.Width) + static_cast<sizet>(x);
+                                grid.Walkable[cell] = 1;
+                                grid.Heights[cell] = nearest[1];
+                            }
+                        }
+                        dtFreeNavMeshQuery(query);
+                    });
+
+        // Links: a step is allowed into a walkable cell within climb height; a
+        // diagonal also needs both cells it squeezes between.
+        const f32 maxClimb = navSettings.AgentMaxClimb + cellSize;
+        ParallelFor("FlowFieldManager::LinkGrid", grid.Height, 8, [&grid, maxClimb](i32 z)
+                    {
+                        const auto canStep = [&grid, maxClimb](i32 from, i32 x, i32 z)
+                        {
+                            if (x < 0 || z < 0 || x >= grid.Width || z >= grid.Height)
+                                return false;
+                            const i32 to = z * grid.Width + x;
+                            return grid.Walkable[static_cast<sizet>(to)] != 0 &&
+                                   std::abs(grid.Heights[static_cast<sizet>(to)] - grid.Heights[static_cast<sizet>(from)]) <= maxClimb;
+                        };
+                        for (i32 x = 0; x < grid.Width; ++x)
+                        {
+                            const i32 cell = z * grid.Width + x;
+                            if (!grid.Walkable[static_cast<sizet>(cell)])
+                                continue;
+                            u8 links = 0;
+                            for (i32 d = 0; d < 8; ++d)
+                            {
+                                if (!canStep(cell, x + kDirX[d], z + kDirZ[d]))
+                                    continue;
+                                if (d >= 4 && (!canStep(cell, x + kDirX[d], z) || !canStep(cell, x, z + kDirZ[d])))
+                                    continue;
+                                links |= static_cast<u8>(1u << d);
+                            }
+                            grid.Links[static_cast<sizet>(cell)] = links;
+                        }
+                    });
+    }
+
+    i32 FlowFieldManager::ResolveGoalCell(const glm::vec3& goal) const
+    {
+        const Grid& grid = m_Grid;
+        if (grid.Width == 0)
+            return -1;
+
+        // Not clamped: a goal just past the mesh edge still snaps (the rings
+        // reach back into the grid), one far off it resolves to nothing.
+        const i32 cx = static_cast<i32>(std::floor((goal.x - grid.Origin.x) / grid.CellSize));
+        const i32 cz = static_cast<i32>(std::floor((goal.z - grid.Origin.y) / grid.CellSize));
+        if (const i32 cell = grid.CellAt(goal.x, goal.z); cell >= 0 && grid.Walkable[static_cast<sizet>(cell)])
+            return cell;
+
+        for (i32 ring = 1; ring <= kGoalSnapRings; ++ring)
+        {
+            i32 best = -1;
+            i32 bestDistSq = std::numeric_limits<i32>::max();
+            for (i32 z = cz - ring; z <= cz + ring; ++z)
+            {
+                for (i32 x = cx - ring; x <= cx + ring; ++x)
+                {
+                    if (std::max(std::abs(x - cx), std::abs(z - cz)) != ring)
+                        continue;
+                    if (x < 0 || z < 0 || x >= grid.Width || z >= grid.Height)
+                        continue;
+                    const i32 cell = z * grid.Width + x;
+                    const i32 distSq = (x - cx) * (x - cx) + (z - cz) * (z - cz);
+                    if (grid.Walkable[static_cast<sizet>(cell)] && distSq < bestDistSq)
+                    {
+                        best = cell;
+                        bestDistSq = distSq;
+                    }
+                }
+            }
+            if (best >= 0)
+                return best;
+        }
+        return -1;
+    }
+
+    void FlowFieldManager::Integrate(const Grid& grid, i32 goalCell, Field& outField)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        const sizet cellCount = grid.Walkable.size();
+        outField.GoalCell = goalCell;
+        outField.Cost.assign(cellCount, kUnreachable);
+        outField.Next.assign(cellCount, kNoDirection);
+        if (goalCell < 0)
+            return;
+
+        // Dijkstra outward from the goal over the linked cells.
+        using Entry = std::pair<f32, i32>;
+        std::vector<Entry> heap;
+        heap.reserve(cellCount / 4 + 16);
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<>> open(std::greater<>{}, std::move(heap));
+        outField.Cost[static_cast<sizet>(goalCell)] = 0.0f;
+        open.emplace(0.0f, goalCell);
+        while (!open.empty())
+        {
+            const auto [cost, cell] = open.top();
+            open.pop();
+            if (cost > outField.Cost[static_cast<sizet>(cell)])
+                continue;
+            const u8 links = grid.Links[static_cast<sizet>(cell)];
+            for (i32 d = 0; d < 8; ++d)
+            {
+                if (!(links & (1u << d)))
+                    continue;
+                const i32 next = cell + kDirX[d] + kDirZ[d] * grid.Width;
+                const f32 nextCost = cost + kStepLength[d] * grid.CellSize;
+                if (nextCost < outField.Cost[static_cast<sizet>(next)])
+                {
+                    outField.Cost[static_cast<sizet>(next)] = nextCost;
+                    open.emplace(nextCost, next);
+                }
+            }
+        }
+
+        // Each reached cell points at its cheapest linked neighbour.
+        ParallelFor("FlowFieldManager::Directions", grid.Height, 16, [&grid, &outField, goalCell](i32 z)
+                    {
+                        for (i32 x = 0; x < grid.Width; ++x)
+                        {
+                            const i32 cell = z * grid.Width + x;
+                            if (cell == goalCell || outField.Cost[static_cast<sizet>(cell)] == kUnreachable)
+                                continue;
+                            const u8 links = grid.Links[static_cast<sizet>(cell)];
+                            f32 best = outField.Cost[static_cast<sizet>(cell)];
+                            for (i32 d = 0; d < 8; ++d)
+                            {
+                                if (!(links & (1u << d)))
+                                    continue;
+                                const f32 cost = outField.Cost[static_cast<sizet>(cell + kDirX[d] + kDirZ[d] * grid.Width)];
+                                if (cost < best)
+                                {
+                                    best = cost;
+                                    outField.Next[static_cast<sizet>(cell)] = static_cast<u8>(d);
+                                }
+                            }
+                        }
+                    });
+    }
+
+    void FlowFieldManager::LaunchIntegration(Group& group)
+    {
+        group.Building = CreateScope<Field>();
+        ++m_IntegrationCount;
+
+        // The task only reads m_Grid, which doesn't change while any task is
+        // in flight (Rebuild() and the destructor wait first).
+        Field* raw = group.Building.get();
+        const Grid* grid = &m_Grid;
+        const i32 goalCell = group.GoalCell;
+        group.Task = Tasks::Launch(
+            "FlowFieldIntegrate", [grid, goalCell, raw]
+            { Integrate(*grid, goalCell, *raw); },
+            Tasks::ETaskPriority::BackgroundNormal);
+    }
+
+    void FlowFieldManager::PublishFields(bool wait)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        for (auto& [id, group] : m_Groups)
+        {
+            // A goal can change cell again while its field integrates; keep
+            // going until the published field matches the latest goal.
+            while (true)
+            {
+                if (group.Building)
+                {
+                    if (wait)
+                        group.Task.Wait();
+                    if (!group.Task.IsCompleted())
+                        break;
+                    group.Live = std::move(group.Building);
+                    group.Task = {};
+                }
+                if (group.Live && group.Live->GoalCell == group.GoalCell)
+                    break;
+                LaunchIntegration(group);
+                if (!wait)
+                    break;
+            }
+        }
+    }
+
+    void FlowFieldManager::SetGoal(u32 groupId, const glm::vec3& goal)
+    {
+        EnsureGrid();
+
+        Group& group = m_Groups[groupId];
+        group.Goal = goal;
+        const i32 cell = ResolveGoalCell(goal);
+        if (cell == group.GoalCell && (group.Live || group.Building))
+            return;
+
+        group.GoalCell = cell;
+        // With one already in flight, PublishFields() relaunches once it lands.
+        if (!group.Building)
+            LaunchIntegration(group);
+    }
+
+    void FlowFieldManager::RemoveGroup(u32 groupId)
+    {
+        if (auto it = m_Groups.find(groupId); it != m_Groups.end())
+        {
+            if (it->second.Building)
+                it->second.Task.Wait();
+            m_Groups.erase(it);
+        }
+    }
+
+    void FlowFieldManager::Rebuild()
+    {
+        OLO_PROFILE_FUNCTION();
+
+        for (auto& [id, group] : m_Groups)
+        {
+            if (group.Building)
+            {
+                group.Task.Wait();
+                group.Building.reset();
+                group.Task = {};
+            }
+        }
+
+        const i32 oldWidth = m_Grid.Width;
+        const i32 oldHeight = m_Grid.Height;
+        m_GridBuilt = true;
+        BuildGrid();
+
+        // Same grid shape: groups keep steering by their old field until the
+        // new one lands. Otherwise its indices mean nothing any more.
+        const bool sameShape = m_Grid.Width == oldWidth && m_Grid.Height == oldHeight;
+        for (auto& [id, group] : m_Groups)
+        {
+            if (!sameShape)
+                group.Live.reset();
+            group.GoalCell = ResolveGoalCell(group.Goal);
+            LaunchIntegration(group);
+        }
+    }
+
+    void FlowFieldManager::WaitForFields()
+    {
+        PublishFields(true);
+    }
+
+    bool FlowFieldManager::SampleCell(const Group& group, const glm::vec3& position, glm::vec2& outDirection) const
+    {
+        const Grid& grid = m_Grid;
+        const Field& field = *group.Live;
+        const i32 cell = grid.CellAt(position.x, position.z);
+        if (cell < 0)
+            return false;
+
+        if (cell == field.GoalCell)
+        {
+            const glm::vec2 toGoal(group.Goal.x - position.x, group.Goal.z - position.z);
+            const f32 length = glm::length(toGoal);
+            outDirection = length > 1e-4f ? toGoal / length : glm::vec2(0.0f);
+            return true;
+        }
+        if (const u8 next = field.Next[static_cast<sizet>(cell)]; next != kNoDirection)
+        {
+            outDirection = kDirection[next];
+            return true;
+        }
+        if (grid.Walkable[static_cast<sizet>(cell)])
+            return false; // walkable, but cut off from the goal
+
+        // Pushed off the walkable area (separation against an edge): head back
+        // to the cheapest reached neighbour.
+        const i32 cx = cell % grid.Width;
+        const i32 cz = cell / grid.Width;
+        f32 best = kUnreachable;
+        for (i32 d = 0; d < 8; ++d)
+        {
+            const i32 x = cx + kDirX[d];
+            const i32 z = cz + kDirZ[d];
+            if (x < 0 || z < 0 || x >= grid.Width || z >= grid.Height)
+                continue;
+            if (const f32 cost = field.Cost[static_cast<sizet>(z * grid.Width + x)]; cost < best)
+            {
+                best = cost;
+                outDirection = kDirection[d];
+            }
+        }
+        return best != kUnreachable;
+    }
+
+    bool FlowFieldManager::SampleDirection(u32 groupId, const glm::vec3& position, glm::vec2& outDirection) const
+    {
+        const auto it = m_Groups.find(groupId);
+        if (it == m_Groups.end() || !it->second.Live)
+            return false;
+        return SampleCell(it->second, position, outDirection);
+    }
+
+    f32 FlowFieldManager::SampleDistance(u32 groupId, const glm::vec3& position) const
+    {
+        const auto it = m_Groups.find(groupId);
+        if (it == m_Groups.end() || !it->second.Live)
+            return kUnreachable;
+        const i32 cell = m_Grid.CellAt(position.x, position.z);
+        return cell < 0 ? kUnreachable : it->second.Live->Cost[static_cast<sizet>(cell)];
+    }
+
+    void FlowFieldManager::Update(std::span<FlowFieldAgent> agents, f32 dt)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        EnsureGrid();
+        PublishFields(false);
+        if (agents.empty() || dt <= 0.0f)
+            return;
+
+        // Bucket a snapshot of every agent's disc by a hashed uniform grid so
+        // separation reads contiguous SoA runs. Every agent steers off this
+        // snapshot, so the result doesn't depend on the order agents are
+        // processed in.
+        const u32 count = static_cast<u32>(agents.size());
+        f32 maxRadius = 0.0f;
+        for (const FlowFieldAgent& agent : agents)
+            maxRadius = std::max(maxRadius, agent.Radius);
+        const f32 halfSpace = 0.5f * m_Settings.PersonalSpace;
+        const f32 bucketSize = std::max(2.0f * (maxRadius + halfSpace), 0.25f);
+        const u32 bucketMask = std::bit_ceil(std::max(count * 2u, 64u)) - 1u;
+        const auto bucketOf = [bucketSize](f32 v)
+        { return static_cast<i32>(std::floor(v / bucketSize)); };
+
+        m_BucketStart.assign(static_cast<sizet>(bucketMask) + 2, 0);
+        m_AgentBucket.resize(count);
+        for (u32 i = 0; i < count; ++i)
+        {
+            const u32 bucket = HashBucket(bucketOf(agents[i].Position.x), bucketOf(agents[i].Position.z)) & bucketMask;
+            m_AgentBucket[i] = bucket;
+            ++m_BucketStart[static_cast<sizet>(bucket) + 1];
+        }
+        for (sizet b = 1; b < m_BucketStart.size(); ++b)
+            m_BucketStart[b] += m_BucketStart[b - 1];
+        m_SortedX.resize(count);
+        m_SortedZ.resize(count);
+        m_SortedRadius.resize(count);
+        m_SortedIndex.resize(count);
+        {
+            std::vector<u32> fill(m_BucketStart.begin(), m_BucketStart.end() - 1);
+            for (u32 i = 0; i < count; ++i)
+            {
+                const u32 slot = fill[m_AgentBucket[i]]++;
+                m_SortedX[slot] = agents[i].Position.x;
+                m_SortedZ[slot] = agents[i].Position.z;
+                m_SortedRadius[slot] = agents[i].Radius + halfSpace;
+                m_SortedIndex[slot] = i;
+            }
+        }
+
+        const f32 approachDistance = m_Settings.ApproachCells * m_Grid.CellSize;
+        const auto walkableAt = [this](f32 x, f32 z)
+        {
+            const i32 cell = m_Grid.CellAt(x, z);
+            return cell >= 0 && m_Grid.Walkable[static_cast<sizet>(cell)] != 0;
+        };
+
+        ParallelFor("FlowFieldManager::Steer", static_cast<i32>(count), 256, [&](i32 index)
+                    {
+                        FlowFieldAgent& agent = agents[static_cast<sizet>(index)];
+                        glm::vec2 desired(0.0f);
+
+                        agent.State = FlowFieldAgentState::Idle;
+                        if (agent.HasTarget)
+                        {
+                            const auto it = m_Groups.find(agent.Group);
+                            const glm::vec2 toTarget(agent.Target.x - agent.Position.x, agent.Target.z - agent.Position.z);
+                            const f32 distance = glm::length(toTarget);
+                            if (it == m_Groups.end() || !it->second.Live)
+                                agent.State = FlowFieldAgentState::Waiting;
+                            else if (distance < std::max(agent.StoppingDistance, 1e-4f))
+                                agent.State = FlowFieldAgentState::Arrived;
+                            else if (!walkableAt(agent.Target.x, agent.Target.z) &&
+                                     m_Grid.CellAt(agent.Position.x, agent.Position.z) == it->second.Live->GoalCell)
+                            {
+                                // Off-mesh target: the goal snapped to the nearest walkable
+                                // cell and the agent is standing in it. As close as it gets.
+                                agent.State = FlowFieldAgentState::Unreachable;
+                            }
+                            else if (distance <= approachDistance)
+                            {
+                                // Final approach: straight at the exact point, without overshooting.
+                                desired = toTarget / distance * std::min(agent.MaxSpeed, distance / dt);
+                                agent.State = FlowFieldAgentState::Moving;
+                            }
+                            else if (glm::vec2 direction; SampleCell(it->second, agent.Position, direction))
+                            {
+                                desired = direction * agent.MaxSpeed;
+                                agent.State = FlowFieldAgentState::Moving;
+                            }
+                            else
+                                agent.State = FlowFieldAgentState::Unreachable;
+                        }
+
+                        // Separation from the 3x3 neighbouring buckets (deduplicated:
+                        // distinct cells can hash to the same bucket).
+                        const i32 bx = bucketOf(agent.Position.x);
+                        const i32 bz = bucketOf(agent.Position.z);
+                        u32 buckets[9];
+                        u32 bucketCount = 0;
+                        for (i32 dz = -1; dz <= 1; ++dz)
+                        {
+                            for (i32 dx = -1; dx <= 1; ++dx)
+                            {
+                                const u32 bucket = HashBucket(bx + dx, bz + dz) & bucketMask;
+                                if (std::find(buckets, buckets + bucketCount, bucket) == buckets + bucketCount)
+                                    buckets[bucketCount++] = bucket;
+                            }
+                        }
+                        f32 pushX = 0.0f;
+                        f32 pushZ = 0.0f;
+                        for (u32 b = 0; b < bucketCount; ++b)
+                        {
+                            AccumulateSeparation(m_SortedX.data(), m_SortedZ.data(), m_SortedRadius.data(),
+                                                 m_BucketStart[buckets[b]], m_BucketStart[static_cast<sizet>(buckets[b]) + 1],
+                                                 agent.Position.x, agent.Position.z, agent.Radius + halfSpace, pushX, pushZ);
+                        }
+
+                        // A horde can't all stand on one point: touching a group mate
+                        // that already settled on the same target counts as arriving.
+                        if (agent.State == FlowFieldAgentState::Moving && (pushX != 0.0f || pushZ != 0.0f))
+                        {
+                            const f32 sameTargetSq = m_Grid.CellSize * m_Grid.CellSize;
+                            for (u32 b = 0; b < bucketCount && agent.State == FlowFieldAgentState::Moving; ++b)
+                            {
+                                for (u32 k = m_BucketStart[buckets[b]]; k < m_BucketStart[static_cast<sizet>(buckets[b]) + 1]; ++k)
+                                {
+                                    // HasTarget/Target/Group are inputs; no one writes them here.
+                                    const FlowFieldAgent& other = agents[m_SortedIndex[k]];
+                                    if (m_SortedIndex[k] == static_cast<u32>(index) || other.HasTarget || other.Group != agent.Group)
+                                        continue;
+                                    const glm::vec2 targetDelta(other.Target.x - agent.Target.x, other.Target.z - agent.Target.z);
+                                    if (glm::dot(targetDelta, targetDelta) > sameTargetSq)
+                                        continue;
+                                    const f32 dx = agent.Position.x - m_SortedX[k];
+                                    const f32 dz = agent.Position.z - m_SortedZ[k];
+                                    const f32 contact = agent.Radius + halfSpace + m_SortedRadius[k];
+                                    if (dx * dx + dz * dz < contact * contact)
+                                    {
+                                        agent.State = FlowFieldAgentState::Arrived;
+                                        desired = glm::vec2(0.0f);
+                                        break;
+                                    }
+                                }
+                            }
+                        }
+
+                        // Don't keep walking into whoever we overlap: turn the part of
+                        // the desired velocity that points against the push into a
+                        // sidestep, so a packed crowd slides around itself instead of
+                        // compressing and two agents meeting head-on pass each other.
+                        const glm::vec2 push(pushX, pushZ);
+                        if (const f32 pushLength = glm::length(push); pushLength > 1e-6f)
+                        {
+                            const glm::vec2 away = push / pushLength;
+                            if (const f32 into = glm::dot(desired, away); into < 0.0f)
+                            {
+                                // Always the same hand relative to the push, so two
+                                // agents meeting head-on pick opposite sides, unless
+                                // that side is a wall.
+                                glm::vec2 side(-away.y, away.x);
+                                if (!walkableAt(agent.Position.x + side.x * m_Grid.CellSize, agent.Position.z + side.y * m_Grid.CellSize))
+                                    side = -side;
+                                desired -= (away + side) * into;
+                            }
+                        }
+
+                        glm::vec2 velocity = desired + push * m_Settings.SeparationStiffness;
+                        if (const f32 speed = glm::length(velocity); speed > agent.MaxSpeed)
+                            velocity *= agent.MaxSpeed / speed;
+
+                        // Stay on walkable cells, sliding along blocked ones. An agent
+                        // already off them may move anywhere (it is heading back).
+                        glm::vec2 from(agent.Position.x, agent.Position.z);
+                        glm::vec2 to = from + velocity * dt;
+                        if (walkableAt(from.x, from.y) && !walkableAt(to.x, to.y))
+                        {
+                            if (walkableAt(to.x, from.y))
+                                to.y = from.y;
+                            else if (walkableAt(from.x, to.y))
+                                to.x = from.x;
+                            else
+                                to = from;
+                        }
+
+                        agent.Velocity = glm::vec3(to.x - from.x, 0.0f, to.y - from.y) / dt;
+                        agent.Position.x = to.x;
+                        agent.Position.z = to.y;
+                        if (!agent.LockYAxis)
+                        {
+                            if (const i32 cell = m_Grid.CellAt(to.x, to.y); cell >= 0 && m_Grid.Walkable[static_cast<sizet>(cell)])
+                                agent.Position.y = m_Grid.Heights[static_cast<sizet>(cell)];
+                        }
+                    });
+    }
+} // namespace OloEngine
@@ -0,0 +1,188 @@
+#pragma once
+
+#include "OloEngine/Core/Base.h"
+#include "OloEngine/Core/Ref.h"
+#include "OloEngine/Navigation/NavMesh.h"
+#include "OloEngine/Task/Task.h"
+
+#include <glm/glm.hpp>
+
+#include <limits>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace OloEngine
+{
+    struct FlowFieldSettings
+    {
+        // Edge length of a grid cell in metres. Grown automatically if the
+        // navmesh bounds would need more than MaxCells.
+        f32 CellSize = 0.5f;
+        u32 MaxCells = 1u << 22;
+        // How hard overlapping agents push apart: metres of overlap → m/s.
+        f32 SeparationStiffness = 6.0f;
+        // Clearance kept between agents on top of their radii, so they start
+        // sidestepping before they touch.
+        f32 PersonalSpace = 0.2f;
+        // Within this many cells of its own target an agent stops following
+        // the field and steers straight at the exact point.
+        f32 ApproachCells = 1.5f;
+    };
+
+    enum class FlowFieldAgentState : u8
+    {
+        Idle,        // no target; still takes part in separation
+        Waiting,     // the group's first field is still integrating
+        Moving,
+        Arrived,     // within StoppingDistance, or touching a group mate settled on the same target
+        Unreachable, // no walkable route to the goal, or an off-mesh target got as close as it can
+    };
+
+    // One agent's input and output for FlowFieldManager::Update().
+    struct FlowFieldAgent
+    {
+        glm::vec3 Position{ 0.0f };
+        glm::vec3 Target{ 0.0f };
+        f32 Radius = 0.5f;
+        f32 MaxSpeed = 3.5f;
+        f32 StoppingDistance = 0.1f;
+        u32 Group = 0;
+        bool HasTarget = false;
+        bool LockYAxis = false;
+
+        // Written by Update().
+        glm::vec3 Velocity{ 0.0f };
+        FlowFieldAgentState State = FlowFieldAgentState::Idle;
+    };
+
+    // Grid flow fields for hordes that share a destination (NavAgentComponent::
+    // m_FlowFieldGroup != 0). DetourCrowd plans a corridor per agent; here a
+    // group pays for one Dijkstra over a walkability grid sampled from the
+    // navmesh and every member then reads its heading from its cell in O(1),
+    // so the cost of a goal is independent of the number of agents chasing it.
+    //
+    // Moving a goal within its cell only nudges the final approach point. A
+    // goal that changes cell is re-integrated on the task pool while the
+    // group keeps steering by the previous field; the new one is swapped in by
+    // the first Update() after it finishes. Neighbour separation runs over SoA
+    // positions bucketed by a uniform hash, vectorised where SSE is available;
+    // an agent that bumps into a group mate already standing at the same
+    // target stops there, so a horde packs around its goal instead of piling
+    // onto one point.
+    //
+    // The grid is sampled lazily on first use and is a single layer: where
+    // walkable surfaces overlap vertically the one nearest the navmesh's mid
+    // height wins. After a tile swap call Rebuild().
+    class FlowFieldManager
+    {
+      public:
+        explicit FlowFieldManager(const Ref<NavMesh>& navMesh, const FlowFieldSettings& settings = {});
+        ~FlowFieldManager();
+
+        FlowFieldManager(const FlowFieldManager&) = delete;
+        FlowFieldManager& operator=(const FlowFieldManager&) = delete;
+
+        // Every agent of a group heads for the last goal set on it.
+        void SetGoal(u32 group, const glm::vec3& goal);
+        void RemoveGroup(u32 group);
+
+        // Publishes finished fields, then steers and moves every agent
+        // (positions, velocities and states are written back in place).
+        void Update(std::span<FlowFieldAgent> agents, f32 dt);
+
+        // Heading (unit XZ) at `position` by the group's live field. False if
+        // the group has no field yet or the cell can't reach the goal.
+        [[nodiscard]] bool SampleDirection(u32 group, const glm::vec3& position, glm::vec2& outDirection) const;
+        // Walking distance to the goal by the live field; infinity if unreachable.
+        [[nodiscard]] f32 SampleDistance(u32 group, const glm::vec3& position) const;
+
+        // Resamples the grid from the navmesh and re-integrates every group.
+        void Rebuild();
+        // Blocks until every group's field matches its latest goal.
+        void WaitForFields();
+
+        [[nodiscard]] bool IsValid() const
+        {
+            return m_NavMesh && m_NavMesh->IsValid();
+        }
+        [[nodiscard]] const FlowFieldSettings& GetSettings() const
+        {
+            return m_Settings;
+        }
+        [[nodiscard]] f32 GetCellSize()
+        {
+            EnsureGrid();
+            return m_Grid.CellSize;
+        }
+        [[nodiscard]] u32 GetGroupCount() const
+        {
+            return static_cast<u32>(m_Groups.size());
+        }
+        // Integrations launched so far (goal cell changes, rebuilds).
+        [[nodiscard]] u64 GetIntegrationCount() const
+        {
+            return m_IntegrationCount;
+        }
+
+      private:
+        static constexpr f32 kUnreachable = std::numeric_limits<f32>::infinity();
+        static constexpr u8 kNoDirection = 0xFF;
+
+        struct Grid
+        {
+            i32 Width = 0;
+            i32 Height = 0;
+            f32 CellSize = 0.5f;
+            glm::vec2 Origin{ 0.0f }; // XZ of cell (0, 0)'s min corner
+            std::vector<u8> Walkable;
+            // Bit d set: the step in direction d is walkable (in bounds,
+            // within climb, and diagonals don't cut a blocked corner).
+            std::vector<u8> Links;
+            std::vector<f32> Heights;
+
+            [[nodiscard]] i32 CellAt(f32 x, f32 z) const;
+        };
+
+        struct Field
+        {
+            std::vector<f32> Cost; // metres to the goal
+            std::vector<u8> Next;  // direction index toward the goal
+            i32 GoalCell = -1;
+        };
+
+        struct Group
+        {
+            glm::vec3 Goal{ 0.0f };
+            i32 GoalCell = -1;      // cell the latest goal resolves to
+            Scope<Field> Live;      // sampled by agents
+            Scope<Field> Building;  // filled by Task
+            Tasks::TTask<void> Task;
+        };
+
+        void EnsureGrid();
+        void BuildGrid();
+        // Nearest walkable cell to the goal, searching a few rings out.
+        [[nodiscard]] i32 ResolveGoalCell(const glm::vec3& goal) const;
+        static void Integrate(const Grid& grid, i32 goalCell, Field& outField);
+        void LaunchIntegration(Group& group);
+        // Swaps finished fields in; relaunches groups whose goal moved on.
+        void PublishFields(bool wait);
+        [[nodiscard]] bool SampleCell(const Group& group, const glm::vec3& position, glm::vec2& outDirection) const;
+
+        Ref<NavMesh> m_NavMesh;
+        FlowFieldSettings m_Settings;
+        Grid m_Grid;
+        bool m_GridBuilt = false;
+        std::unordered_map<u32, Group> m_Groups;
+        u64 m_IntegrationCount = 0;
+
+        // Separation scratch, sorted by hash bucket.
+        std::vector<u32> m_BucketStart;
+        std::vector<u32> m_AgentBucket;
+        std::vector<f32> m_SortedX;
+        std::vector<f32> m_SortedZ;
+        std::vector<f32> m_SortedRadius;
+        std::vector<u32> m_SortedIndex;
+    };
+} // namespace OloEngine
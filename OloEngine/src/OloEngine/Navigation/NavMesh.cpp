@@ -12,6 +12,9 @@ namespace OloEngine
     {
         OLO_PROFILE_FUNCTION();
 
+        // The builder's in-flight rebuild never touches the Detour mesh, so
+        // the order here is free; it just has to finish before the batch dies.
+        m_TileBuilder.reset();
         if (m_NavMesh)
         {
             dtFreeNavMesh(m_NavMesh);
@@ -20,7 +23,7 @@ namespace OloEngine
     }
 
     NavMesh::NavMesh(NavMesh&& other) noexcept
-        : m_NavMesh(other.m_NavMesh), m_Settings(other.m_Settings)
+        : m_NavMesh(other.m_NavMesh), m_Settings(other.m_Settings), m_TileBuilder(std::move(other.m_TileBuilder))
     {
         OLO_PROFILE_FUNCTION();
 
@@ -37,6 +40,7 @@ namespace OloEngine
                 dtFreeNavMesh(m_NavMesh);
             m_NavMesh = other.m_NavMesh;
             m_Settings = other.m_Settings;
+            m_TileBuilder = std::move(other.m_TileBuilder);
             other.m_NavMesh = nullptr;
         }
         return *this;
@@ -49,6 +53,7 @@ namespace OloEngine
         if (navMesh == m_NavMesh)
             return;
 
+        m_TileBuilder.reset();
         if (m_NavMesh)
             dtFreeNavMesh(m_NavMesh);
         m_NavMesh = navMesh;
@@ -73,7 +78,8 @@ namespace OloEngine
     }
 
     // --- Serialization helpers ---------------------------------------------------
-    static constexpr u32 NAVMESH_FORMAT_VERSION = 1;
+    // v2 appends NavMeshSettings::TileSize; v1 files load as solo (TileSize 0).
+    static constexpr u32 NAVMESH_FORMAT_VERSION = 2;
 
     template<typename T>
     static void WriteValue(std::vector<u8>& buf, const T& val)
@@ -119,6 +125,7 @@ namespace OloEngine
         WriteValue(outData, m_Settings.VertsPerPoly);
         WriteValue(outData, m_Settings.DetailSampleDist);
         WriteValue(outData, m_Settings.DetailSampleMaxError);
+        WriteValue(outData, m_Settings.TileSize);
 
         // Persist dtNavMeshParams so Deserialize can reconstruct exactly
         const dtNavMeshParams* navParams = m_NavMesh->getParams();
@@ -168,7 +175,8 @@ namespace OloEngine
         size_t offset = 0;
 
         // Version header
-        if (u32 version = 0; !ReadValue(data, offset, version) || version != NAVMESH_FORMAT_VERSION)
+        u32 version = 0;
+        if (!ReadValue(data, offset, version) || version == 0 || version > NAVMESH_FORMAT_VERSION)
             return false;
 
         // Settings — per-field (read into local, commit only on full success)
@@ -199,6 +207,8 @@ namespace OloEngine
             return false;
         if (!ReadValue(data, offset, settings.DetailSampleMaxError))
             return false;
+        if (version >= 2 && !ReadValue(data, offset, settings.TileSize))
+            return false;
 
         // Restore dtNavMeshParams
         dtNavMeshParams params{};
@@ -2,6 +2,7 @@
 
 #include "OloEngine/Asset/Asset.h"
 #include "OloEngine/Navigation/NavMeshSettings.h"
+#include "OloEngine/Navigation/NavMeshTileBuilder.h"
 
 #include <DetourNavMesh.h>
 
@@ -24,8 +25,20 @@ namespace OloEngine
         {
             return m_NavMesh;
         }
+        // Replacing the Detour mesh drops any tile builder: it describes the old one.
         void SetDetourNavMesh(dtNavMesh* navMesh);
 
+        // Tiled bakes only (NavMeshSettings::TileSize > 0); null for solo meshes
+        // and for meshes loaded from disk.
+        [[nodiscard]] NavMeshTileBuilder* GetTileBuilder() const
+        {
+            return m_TileBuilder.get();
+        }
+        void SetTileBuilder(Scope<NavMeshTileBuilder> tileBuilder)
+        {
+            m_TileBuilder = std::move(tileBuilder);
+        }
+
         [[nodiscard]] const NavMeshSettings& GetSettings() const
         {
             return m_Settings;
@@ -57,5 +70,6 @@ namespace OloEngine
       private:
         dtNavMesh* m_NavMesh = nullptr;
         NavMeshSettings m_Settings;
+        Scope<NavMeshTileBuilder> m_TileBuilder;
     };
 } // namespace OloEngine
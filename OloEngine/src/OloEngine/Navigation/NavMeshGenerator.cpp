@@ -537,6 +537,25 @@ namespace OloEngine
             return nullptr;
         }
 
+        if (settings.TileSize > 0)
+        {
+            auto builder = CreateScope<NavMeshTileBuilder>(settings, boundsMin, boundsMax, links);
+            const NavMeshInputGeometry geometry{ std::move(verts), std::move(tris) };
+            dtNavMesh* navMesh = builder->BuildAll(geometry);
+            if (!navMesh)
+                return nullptr;
+
+            auto result = Ref<NavMesh>::Create();
+            result->SetDetourNavMesh(navMesh);
+            result->SetSettings(settings);
+            result->SetTileBuilder(std::move(builder));
+
+            OLO_CORE_INFO("NavMeshGenerator: Generated tiled navmesh ({}x{} tiles) with {} polygons",
+                          result->GetTileBuilder()->GetTilesX(), result->GetTileBuilder()->GetTilesZ(),
+                          result->GetPolyCount());
+            return result;
+        }
+
         // Step 1: Initialize Recast config
         rcConfig cfg{};
         cfg.cs = settings.CellSize;
@@ -785,4 +804,17 @@ namespace OloEngine
         OLO_CORE_INFO("NavMeshGenerator: Generated navmesh with {} polygons", result->GetPolyCount());
         return result;
     }
+
+    u32 NavMeshGenerator::UpdateTiles(Scene* scene, NavMesh& navMesh, bool wait)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        NavMeshTileBuilder* builder = navMesh.GetTileBuilder();
+        dtNavMesh* detourMesh = navMesh.GetDetourNavMesh();
+        if (!scene || !builder || !detourMesh)
+            return 0;
+
+        return builder->Update(*detourMesh, [scene](NavMeshInputGeometry& geometry)
+                               { CollectSceneGeometry(scene, geometry.Verts, geometry.Tris); }, wait);
+    }
 } // namespace OloEngine
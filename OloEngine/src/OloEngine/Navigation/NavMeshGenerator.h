@@ -4,6 +4,7 @@
 #include "OloEngine/Core/Ref.h"
 #include "OloEngine/Navigation/NavMesh.h"
 #include "OloEngine/Navigation/NavMeshSettings.h"
+#include "OloEngine/Navigation/NavMeshTileBuilder.h"
 #include "OloEngine/Navigation/OffMeshLink.h"
 
 #include <glm/glm.hpp>
@@ -20,9 +21,16 @@ namespace OloEngine
         // Generate navmesh from all MeshComponents + TerrainComponents + Collider3DComponents in scene.
         // Optional off-mesh links are baked in as Detour off-mesh connections so agents can cross gaps the
         // walkable surface can't span (caller collects them from the scene's NavMeshBoundsComponent(s)).
+        // With settings.TileSize > 0 the bake is tiled: tiles build in parallel and the result carries
+        // a NavMeshTileBuilder (see UpdateTiles).
         static Ref<NavMesh> Generate(Scene* scene, const NavMeshSettings& settings, const glm::vec3& boundsMin,
                                      const glm::vec3& boundsMax, const std::vector<OffMeshLink>& links = {});
 
+        // Drive a tiled navmesh's runtime rebuilds: swap finished tiles in and start the next batch,
+        // re-collecting the scene geometry only if a tile needs re-rasterising. No-op for solo meshes.
+        // With `wait`, returns only once every queued change is live. Returns the tiles swapped in.
+        static u32 UpdateTiles(Scene* scene, NavMesh& navMesh, bool wait = false);
+
       private:
         // Collect world-space triangles from scene geometry
         static void CollectSceneGeometry(Scene* scene, std::vector<f32>& outVerts, std::vector<i32>& outTris);
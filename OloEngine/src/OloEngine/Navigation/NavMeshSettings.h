@@ -19,5 +19,9 @@ namespace OloEngine
         i32 VertsPerPoly = 6;
         f32 DetailSampleDist = 6.0f;
         f32 DetailSampleMaxError = 1.0f;
+        // Cells per tile side. 0 bakes one solo mesh over the bounds; > 0 bakes
+        // tiles in parallel and keeps a NavMeshTileBuilder on the result for
+        // runtime rebuilds of changed tiles and temporary obstacles.
+        i32 TileSize = 0;
     };
 } // namespace OloEngine
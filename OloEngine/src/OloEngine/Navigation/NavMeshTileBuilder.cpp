@@ -0,0 +1,656 @@
+#include "OloEnginePCH.h"
+#include "OloEngine/Navigation/NavMeshTileBuilder.h"
+#include "OloEngine/Core/Log.h"
+#include "OloEngine/Math/Math.h"
+#include "OloEngine/Task/ParallelFor.h"
+
+#include <Recast.h>
+#include <DetourNavMesh.h>
+#include <DetourNavMeshBuilder.h>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+
+namespace OloEngine
+{
+    namespace
+    {
+        constexpr u8 kDirtyGeometry = 1 << 0; // re-rasterise, then rebuild
+        constexpr u8 kDirtyObstacle = 1 << 1; // rebuild from the cached heightfield
+
+        // Detour's 32-bit poly refs split 22 bits between tile and poly index.
+        constexpr i32 kMaxTileBits = 14;
+        constexpr i32 kTileAndPolyBits = 22;
+
+        // Deep copy, so obstacles can be marked into a throwaway heightfield and
+        // the cached one stays pristine for the next rebuild.
+        rcCompactHeightfield* CloneCompactHeightfield(const rcCompactHeightfield& src)
+        {
+            rcCompactHeightfield* dst = rcAllocCompactHeightfield();
+            if (!dst)
+                return nullptr;
+
+            dst->width = src.width;
+            dst->height = src.height;
+            dst->spanCount = src.spanCount;
+            dst->walkableHeight = src.walkableHeight;
+            dst->walkableClimb = src.walkableClimb;
+            dst->borderSize = src.borderSize;
+            dst->maxDistance = src.maxDistance;
+            dst->maxRegions = src.maxRegions;
+            rcVcopy(dst->bmin, src.bmin);
+            rcVcopy(dst->bmax, src.bmax);
+            dst->cs = src.cs;
+            dst->ch = src.ch;
+
+            const auto cellCount = static_cast<sizet>(src.width) * static_cast<sizet>(src.height);
+            const auto spanCount = static_cast<sizet>(src.spanCount);
+            dst->cells = static_cast<rcCompactCell*>(rcAlloc(sizeof(rcCompactCell) * cellCount, RC_ALLOC_PERM));
+            dst->spans = static_cast<rcCompactSpan*>(rcAlloc(sizeof(rcCompactSpan) * spanCount, RC_ALLOC_PERM));
+            dst->areas = static_cast<unsigned char*>(rcAlloc(sizeof(unsigned char) * spanCount, RC_ALLOC_PERM));
+            if (src.dist)
+                dst->dist = static_cast<unsigned short*>(rcAlloc(sizeof(unsigned short) * spanCount, RC_ALLOC_PERM));
+            if (!dst->cells || !dst->spans || !dst->areas || (src.dist && !dst->dist))
+            {
+                rcFreeCompactHeightfield(dst);
+                return nullptr;
+            }
+
+            std::memcpy(dst->cells, src.cells, sizeof(rcCompactCell) * cellCount);
+            std::memcpy(dst->spans, src.spans, sizeof(rcCompactSpan) * spanCount);
+            std::memcpy(dst->areas, src.areas, sizeof(unsigned char) * spanCount);
+            if (src.dist)
+                std::memcpy(dst->dist, src.dist, sizeof(unsigned short) * spanCount);
+            return dst;
+        }
+    } // namespace
+
+    void NavMeshTileBuilder::CompactHeightfieldDeleter::operator()(rcCompactHeightfield* chf) const
+    {
+        rcFreeCompactHeightfield(chf);
+    }
+
+    NavMeshTileBuilder::NavMeshTileBuilder(const NavMeshSettings& settings, const glm::vec3& boundsMin,
+                                           const glm::vec3& boundsMax, const std::vector<OffMeshLink>& links)
+        : m_Settings(settings), m_BoundsMin(boundsMin), m_BoundsMax(boundsMax)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        i32 gridWidth = 0;
+        i32 gridHeight = 0;
+        rcCalcGridSize(&m_BoundsMin.x, &m_BoundsMax.x, m_Settings.CellSize, &gridWidth, &gridHeight);
+
+        const i32 tileSize = std::max(m_Settings.TileSize, 1);
+        m_TilesX = (gridWidth + tileSize - 1) / tileSize;
+        m_TilesZ = (gridHeight + tileSize - 1) / tileSize;
+        m_TileWorldSize = static_cast<f32>(tileSize) * m_Settings.CellSize;
+        m_BorderCells = static_cast<i32>(std::ceilf(m_Settings.AgentRadius / m_Settings.CellSize)) + 3;
+
+        const auto tileCount = static_cast<sizet>(m_TilesX) * static_cast<sizet>(m_TilesZ);
+        m_Rasters.resize(tileCount);
+        m_Dirty.assign(tileCount, 0);
+
+        // Same conventions as the solo bake: endpoint flags/area pinned to the
+        // walkable poly's so the default query filter routes across them.
+        u32 userId = 0;
+        for (const auto& link : links)
+        {
+            if (!Math::IsFinite(link.m_Start) || !Math::IsFinite(link.m_End) || !std::isfinite(link.m_Radius))
+            {
+                OLO_CORE_WARN("NavMeshTileBuilder: skipping off-mesh link with non-finite coordinates");
+                continue;
+            }
+
+            m_OffMeshVerts.insert(m_OffMeshVerts.end(), { link.m_Start.x, link.m_Start.y, link.m_Start.z,
+                                                          link.m_End.x, link.m_End.y, link.m_End.z });
+            m_OffMeshRads.push_back(link.m_Radius > 0.0f ? link.m_Radius : m_Settings.AgentRadius);
+            m_OffMeshFlags.push_back(static_cast<u16>(1));
+            m_OffMeshAreas.push_back(static_cast<u8>(RC_WALKABLE_AREA));
+            m_OffMeshDirs.push_back(link.m_Bidirectional ? static_cast<u8>(DT_OFFMESH_CON_BIDIR) : static_cast<u8>(0));
+            m_OffMeshUserIds.push_back(userId++);
+        }
+    }
+
+    NavMeshTileBuilder::~NavMeshTileBuilder()
+    {
+        OLO_PROFILE_FUNCTION();
+
+        // The batch is read by the task; let it finish before freeing it.
+        m_InFlightTask.Wait();
+        if (m_InFlight)
+        {
+            for (auto& job : m_InFlight->Jobs)
+                dtFree(job.Data);
+        }
+    }
+
+    dtNavMesh* NavMeshTileBuilder::BuildAll(const NavMeshInputGeometry& geometry)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        const i32 tileCount = m_TilesX * m_TilesZ;
+        const i32 tileBits = static_cast<i32>(std::bit_width(std::bit_ceil(static_cast<u32>(std::max(tileCount, 1))))) - 1;
+        if (tileCount <= 0 || tileBits > kMaxTileBits)
+        {
+            OLO_CORE_ERROR("NavMeshTileBuilder: {}x{} tiles is outside Detour's tile budget ({}); raise TileSize",
+                           m_TilesX, m_TilesZ, 1 << kMaxTileBits);
+            return nullptr;
+        }
+
+        std::vector<TileJob> jobs(static_cast<sizet>(tileCount));
+        for (i32 z = 0; z < m_TilesZ; ++z)
+        {
+            for (i32 x = 0; x < m_TilesX; ++x)
+            {
+                auto& job = jobs[static_cast<sizet>(TileIndex(x, z))];
+                job.X = x;
+                job.Z = z;
+                job.Rasterise = true;
+            }
+        }
+        BucketTriangles(geometry, jobs);
+
+        const std::vector<NavMeshObstacle> noObstacles;
+        ParallelFor("NavMeshTileBuilder::BuildAll", tileCount, 1, [this, &jobs, &geometry, &noObstacles](i32 i)
+                    { RunJob(jobs[static_cast<sizet>(i)], geometry, noObstacles); });
+
+        dtNavMeshParams params{};
+        params.orig[0] = m_BoundsMin.x;
+        params.orig[1] = m_BoundsMin.y;
+        params.orig[2] = m_BoundsMin.z;
+        params.tileWidth = m_TileWorldSize;
+        params.tileHeight = m_TileWorldSize;
+        params.maxTiles = 1 << tileBits;
+        params.maxPolys = 1 << (kTileAndPolyBits - tileBits);
+
+        auto* navMesh = dtAllocNavMesh();
+        if (!navMesh || dtStatusFailed(navMesh->init(&params)))
+        {
+            OLO_CORE_ERROR("NavMeshTileBuilder: Could not init Detour navmesh");
+            dtFreeNavMesh(navMesh);
+            for (auto& job : jobs)
+                dtFree(job.Data);
+            return nullptr;
+        }
+
+        // addTile is not thread-safe; tiles go in serially, in tile order.
+        bool failed = false;
+        for (auto& job : jobs)
+        {
+            failed = failed || job.Failed;
+            m_Rasters[static_cast<sizet>(TileIndex(job.X, job.Z))] = std::move(job.Raster);
+            if (!job.Data)
+                continue;
+            if (dtStatusFailed(navMesh->addTile(job.Data, job.DataSize, DT_TILE_FREE_DATA, 0, nullptr)))
+            {
+                dtFree(job.Data);
+                failed = true;
+            }
+            job.Data = nullptr;
+        }
+
+        if (failed)
+        {
+            OLO_CORE_ERROR("NavMeshTileBuilder: one or more tiles failed to build");
+            dtFreeNavMesh(navMesh);
+            return nullptr;
+        }
+        return navMesh;
+    }
+
+    void NavMeshTileBuilder::TileRangeOf(const glm::vec3& boundsMin, const glm::vec3& boundsMax, f32 pad,
+                                         i32& x0, i32& z0, i32& x1, i32& z1) const
+    {
+        const auto toTile = [this](f32 v, f32 origin)
+        { return static_cast<i32>(std::floor((v - origin) / m_TileWorldSize)); };
+
+        x0 = std::max(toTile(boundsMin.x - pad, m_BoundsMin.x), 0);
+        z0 = std::max(toTile(boundsMin.z - pad, m_BoundsMin.z), 0);
+        x1 = std::min(toTile(boundsMax.x + pad, m_BoundsMin.x), m_TilesX - 1);
+        z1 = std::min(toTile(boundsMax.z + pad, m_BoundsMin.z), m_TilesZ - 1);
+    }
+
+    void NavMeshTileBuilder::MarkTiles(const glm::vec3& boundsMin, const glm::vec3& boundsMax, f32 pad, u8 reason)
+    {
+        if (!Math::IsFinite(boundsMin) || !Math::IsFinite(boundsMax))
+            return;
+
+        i32 x0 = 0;
+        i32 z0 = 0;
+        i32 x1 = -1;
+        i32 z1 = -1;
+        TileRangeOf(boundsMin, boundsMax, pad, x0, z0, x1, z1);
+        for (i32 z = z0; z <= z1; ++z)
+        {
+            for (i32 x = x0; x <= x1; ++x)
+                m_Dirty[static_cast<sizet>(TileIndex(x, z))] |= reason;
+        }
+    }
+
+    void NavMeshTileBuilder::MarkDirty(const glm::vec3& boundsMin, const glm::vec3& boundsMax)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        // A tile rasterises its border too, so geometry that far outside it
+        // still shapes its edge.
+        MarkTiles(boundsMin, boundsMax, static_cast<f32>(m_BorderCells) * m_Settings.CellSize, kDirtyGeometry);
+    }
+
+    u32 NavMeshTileBuilder::AddObstacle(const NavMeshObstacle& obstacle)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        if (!Math::IsFinite(obstacle.Position) || !std::isfinite(obstacle.Radius) || !std::isfinite(obstacle.Height) ||
+            obstacle.Radius <= 0.0f || obstacle.Height <= 0.0f)
+        {
+            OLO_CORE_WARN("NavMeshTileBuilder: ignoring obstacle with non-finite or non-positive extents");
+            return 0;
+        }
+
+        const u32 handle = m_NextObstacleHandle++;
+        m_Obstacles.push_back({ handle, obstacle });
+
+        const glm::vec3 extent(obstacle.Radius, 0.0f, obstacle.Radius);
+        MarkTiles(obstacle.Position - extent, obstacle.Position + extent,
+                  static_cast<f32>(m_BorderCells) * m_Settings.CellSize, kDirtyObstacle);
+        return handle;
+    }
+
+    bool NavMeshTileBuilder::RemoveObstacle(u32 handle)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        const auto it = std::ranges::find(m_Obstacles, handle, &ObstacleSlot::Handle);
+        if (handle == 0 || it == m_Obstacles.end())
+            return false;
+
+        const NavMeshObstacle obstacle = it->Obstacle;
+        m_Obstacles.erase(it);
+
+        const glm::vec3 extent(obstacle.Radius, 0.0f, obstacle.Radius);
+        MarkTiles(obstacle.Position - extent, obstacle.Position + extent,
+                  static_cast<f32>(m_BorderCells) * m_Settings.CellSize, kDirtyObstacle);
+        return true;
+    }
+
+    void NavMeshTileBuilder::BucketTriangles(const NavMeshInputGeometry& geometry, std::vector<TileJob>& jobs) const
+    {
+        OLO_PROFILE_FUNCTION();
+
+        std::unordered_map<i32, sizet> jobOfTile;
+        jobOfTile.reserve(jobs.size());
+        for (sizet j = 0; j < jobs.size(); ++j)
+        {
+            if (jobs[j].Rasterise)
+                jobOfTile.emplace(TileIndex(jobs[j].X, jobs[j].Z), j);
+        }
+        if (jobOfTile.empty())
+            return;
+
+        const f32 pad = static_cast<f32>(m_BorderCells) * m_Settings.CellSize;
+        const auto triCount = static_cast<i32>(geometry.Tris.size() / 3);
+        for (i32 t = 0; t < triCount; ++t)
+        {
+            const i32* tri = &geometry.Tris[static_cast<sizet>(t) * 3];
+            glm::vec3 triMin(std::numeric_limits<f32>::max());
+            glm::vec3 triMax(std::numeric_limits<f32>::lowest());
+            for (i32 k = 0; k < 3; ++k)
+            {
+                const f32* v = &geometry.Verts[static_cast<sizet>(tri[k]) * 3];
+                triMin = glm::min(triMin, glm::vec3(v[0], v[1], v[2]));
+                triMax = glm::max(triMax, glm::vec3(v[0], v[1], v[2]));
+            }
+
+            i32 x0 = 0;
+            i32 z0 = 0;
+            i32 x1 = -1;
+            i32 z1 = -1;
+            TileRangeOf(triMin, triMax, pad, x0, z0, x1, z1);
+            for (i32 z = z0; z <= z1; ++z)
+            {
+                for (i32 x = x0; x <= x1; ++x)
+                {
+                    if (const auto it = jobOfTile.find(TileIndex(x, z)); it != jobOfTile.end())
+                        jobs[it->second].Tris.insert(jobs[it->second].Tris.end(), tri, tri + 3);
+                }
+            }
+        }
+    }
+
+    void NavMeshTileBuilder::RunJob(TileJob& job, const NavMeshInputGeometry& geometry,
+                                    const std::vector<NavMeshObstacle>& obstacles) const
+    {
+        OLO_PROFILE_FUNCTION();
+
+        const rcCompactHeightfield* raster = job.Cached;
+        if (job.Rasterise)
+        {
+            if (!job.Tris.empty())
+            {
+                job.Raster = RasteriseTile(geometry, job.Tris, job.X, job.Z);
+                job.Failed = !job.Raster;
+            }
+            raster = job.Raster.get();
+        }
+
+        // No walkable spans: an empty tile, which is not a failure.
+        if (job.Failed || !raster || raster->spanCount == 0)
+            return;
+
+        job.Failed = !BuildTileData(*raster, obstacles, job.X, job.Z, job.Data, job.DataSize);
+    }
+
+    NavMeshTileBuilder::CompactHeightfieldPtr NavMeshTileBuilder::RasteriseTile(const NavMeshInputGeometry& geometry,
+                                                                                const std::vector<i32>& tris,
+                                                                                i32 x, i32 z) const
+    {
+        OLO_PROFILE_FUNCTION();
+
+        const i32 tileSize = std::max(m_Settings.TileSize, 1);
+        const f32 border = static_cast<f32>(m_BorderCells) * m_Settings.CellSize;
+        const i32 walkableHeight = static_cast<i32>(std::ceilf(m_Settings.AgentHeight / m_Settings.CellHeight));
+        const i32 walkableClimb = static_cast<i32>(std::floorf(m_Settings.AgentMaxClimb / m_Settings.CellHeight));
+
+        f32 bmin[3] = { m_BoundsMin.x + static_cast<f32>(x) * m_TileWorldSize - border, m_BoundsMin.y,
+                        m_BoundsMin.z + static_cast<f32>(z) * m_TileWorldSize - border };
+        f32 bmax[3] = { m_BoundsMin.x + static_cast<f32>(x + 1) * m_TileWorldSize + border, m_BoundsMax.y,
+                        m_BoundsMin.z + static_cast<f32>(z + 1) * m_TileWorldSize + border };
+        const i32 size = tileSize + m_BorderCells * 2;
+
+        // rcContext is not thread-safe; one per tile.
+        rcContext ctx;
+
+        auto* solid = rcAllocHeightfield();
+        if (!solid || !rcCreateHeightfield(&ctx, *solid, size, size, bmin, bmax, m_Settings.CellSize, m_Settings.CellHeight))
+        {
+            OLO_CORE_ERROR("NavMeshTileBuilder: Could not create heightfield for tile ({}, {})", x, z);
+            rcFreeHeightField(solid);
+            return nullptr;
+        }
+
+        const auto nverts = static_cast<i32>(geometry.Verts.size() / 3);
+        const auto ntris = static_cast<i32>(tris.size() / 3);
+        std::vector<u8> triAreas(static_cast<sizet>(ntris), 0);
+        rcMarkWalkableTriangles(&ctx, m_Settings.AgentMaxSlope, geometry.Verts.data(), nverts, tris.data(), ntris,
+                                triAreas.data());
+        if (!rcRasterizeTriangles(&ctx, geometry.Verts.data(), nverts, tris.data(), triAreas.data(), ntris, *solid,
+                                  walkableClimb))
+        {
+            OLO_CORE_ERROR("NavMeshTileBuilder: Could not rasterize tile ({}, {})", x, z);
+            rcFreeHeightField(solid);
+            return nullptr;
+        }
+
+        rcFilterLowHangingWalkableObstacles(&ctx, walkableClimb, *solid);
+        rcFilterLedgeSpans(&ctx, walkableHeight, walkableClimb, *solid);
+        rcFilterWalkableLowHeightSpans(&ctx, walkableHeight, *solid);
+
+        CompactHeightfieldPtr chf(rcAllocCompactHeightfield());
+        if (!chf || !rcBuildCompactHeightfield(&ctx, walkableHeight, walkableClimb, *solid, *chf))
+        {
+            OLO_CORE_ERROR("NavMeshTileBuilder: Could not build compact heightfield for tile ({}, {})", x, z);
+            rcFreeHeightField(solid);
+            return nullptr;
+        }
+        rcFreeHeightField(solid);
+        return chf;
+    }
+
+    bool NavMeshTileBuilder::BuildTileData(const rcCompactHeightfield& raster, const std::vector<NavMeshObstacle>& obstacles,
+                                           i32 x, i32 z, u8*& outData, i32& outDataSize) const
+    {
+        OLO_PROFILE_FUNCTION();
+
+        outData = nullptr;
+        outDataSize = 0;
+
+        const i32 walkableRadius = static_cast<i32>(std::ceilf(m_Settings.AgentRadius / m_Settings.CellSize));
+        const i32 minRegionArea = m_Settings.RegionMinSize * m_Settings.RegionMinSize;
+        const i32 mergeRegionArea = m_Settings.RegionMergeSize * m_Settings.RegionMergeSize;
+        const auto maxEdgeLen = static_cast<i32>(m_Settings.EdgeMaxLen / m_Settings.CellSize);
+        const f32 detailSampleDist = m_Settings.DetailSampleDist < 0.9f ? 0.0f : m_Settings.CellSize * m_Settings.DetailSampleDist;
+        const f32 detailSampleMaxError = m_Settings.CellHeight * m_Settings.DetailSampleMaxError;
+
+        rcContext ctx;
+
+        CompactHeightfieldPtr chf(CloneCompactHeightfield(raster));
+        if (!chf)
+        {
+            OLO_CORE_ERROR("NavMeshTileBuilder: Could not copy heightfield for tile ({}, {})", x, z);
+            return false;
+        }
+
+        // Obstacles are carved before erosion so they get the agent-radius
+        // margin every other wall gets.
+        for (const auto& obstacle : obstacles)
+        {
+            const f32 reach = obstacle.Radius;
+            if (obstacle.Position.x + reach < chf->bmin[0] || obstacle.Position.x - reach > chf->bmax[0] ||
+                obstacle.Position.z + reach < chf->bmin[2] || obstacle.Position.z - reach > chf->bmax[2])
+                continue;
+            rcMarkCylinderArea(&ctx, &obstacle.Position.x, obstacle.Radius, obstacle.Height, RC_NULL_AREA, *chf);
+        }
+
+        if (!rcErodeWalkableArea(&ctx, walkableRadius, *chf) || !rcBuildDistanceField(&ctx, *chf) ||
+            !rcBuildRegions(&ctx, *chf, m_BorderCells, minRegionArea, mergeRegionArea))
+        {
+            OLO_CORE_ERROR("NavMeshTileBuilder: Could not partition tile ({}, {})", x, z);
+            return false;
+        }
+
+        auto* cset = rcAllocContourSet();
+        if (!cset || !rcBuildContours(&ctx, *chf, m_Settings.EdgeMaxError, maxEdgeLen, *cset))
+        {
+            OLO_CORE_ERROR("NavMeshTileBuilder: Could not create contours for tile ({}, {})", x, z);
+            rcFreeContourSet(cset);
+            return false;
+        }
+        if (cset->nconts == 0)
+        {
+            rcFreeContourSet(cset);
+            return true;
+        }
+
+        auto* pmesh = rcAllocPolyMesh();
+        if (!pmesh || !rcBuildPolyMesh(&ctx, *cset, m_Settings.VertsPerPoly, *pmesh))
+        {
+            OLO_CORE_ERROR("NavMeshTileBuilder: Could not triangulate tile ({}, {})", x, z);
+            rcFreeContourSet(cset);
+            rcFreePolyMesh(pmesh);
+            return false;
+        }
+        rcFreeContourSet(cset);
+
+        auto* dmesh = rcAllocPolyMeshDetail();
+        if (!dmesh || !rcBuildPolyMeshDetail(&ctx, *pmesh, *chf, detailSampleDist, detailSampleMaxError, *dmesh))
+        {
+            OLO_CORE_ERROR("NavMeshTileBuilder: Could not build detail mesh for tile ({}, {})", x, z);
+            rcFreePolyMesh(pmesh);
+            rcFreePolyMeshDetail(dmesh);
+            return false;
+        }
+        chf.reset();
+
+        if (pmesh->npolys == 0)
+        {
+            rcFreePolyMesh(pmesh);
+            rcFreePolyMeshDetail(dmesh);
+            return true;
+        }
+
+        for (i32 i = 0; i < pmesh->npolys; ++i)
+        {
+            if (pmesh->areas[i] != RC_NULL_AREA)
+            {
+                pmesh->areas[i] = RC_WALKABLE_AREA;
+                pmesh->flags[i] = 1;
+            }
+        }
+
+        dtNavMeshCreateParams params{};
+        params.verts = pmesh->verts;
+        params.vertCount = pmesh->nverts;
+        params.polys = pmesh->polys;
+        params.polyAreas = pmesh->areas;
+        params.polyFlags = pmesh->flags;
+        params.polyCount = pmesh->npolys;
+        params.nvp = pmesh->nvp;
+        params.detailMeshes = dmesh->meshes;
+        params.detailVerts = dmesh->verts;
+        params.detailVertsCount = dmesh->nverts;
+        params.detailTris = dmesh->tris;
+        params.detailTriCount = dmesh->ntris;
+        params.walkableHeight = m_Settings.AgentHeight;
+        params.walkableRadius = m_Settings.AgentRadius;
+        params.walkableClimb = m_Settings.AgentMaxClimb;
+        params.tileX = x;
+        params.tileY = z;
+        params.tileLayer = 0;
+        rcVcopy(params.bmin, pmesh->bmin);
+        rcVcopy(params.bmax, pmesh->bmax);
+        params.cs = m_Settings.CellSize;
+        params.ch = m_Settings.CellHeight;
+        params.buildBvTree = true;
+        if (!m_OffMeshRads.empty())
+        {
+            params.offMeshConVerts = m_OffMeshVerts.data();
+            params.offMeshConRad = m_OffMeshRads.data();
+            params.offMeshConFlags = m_OffMeshFlags.data();
+            params.offMeshConAreas = m_OffMeshAreas.data();
+            params.offMeshConDir = m_OffMeshDirs.data();
+            params.offMeshConUserID = m_OffMeshUserIds.data();
+            params.offMeshConCount = static_cast<i32>(m_OffMeshRads.size());
+        }
+
+        const bool created = dtCreateNavMeshData(&params, &outData, &outDataSize);
+        rcFreePolyMesh(pmesh);
+        rcFreePolyMeshDetail(dmesh);
+        if (!created)
+        {
+            OLO_CORE_ERROR("NavMeshTileBuilder: Could not build Detour data for tile ({}, {})", x, z);
+            outData = nullptr;
+            outDataSize = 0;
+            return false;
+        }
+        return true;
+    }
+
+    bool NavMeshTileBuilder::HasPendingWork() const
+    {
+        return m_InFlight || std::ranges::any_of(m_Dirty, [](u8 dirty)
+                                                 { return dirty != 0; });
+    }
+
+    void NavMeshTileBuilder::Launch(const std::function<void(NavMeshInputGeometry&)>& collectGeometry)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        auto batch = CreateScope<RebuildBatch>();
+        bool needGeometry = false;
+        for (i32 z = 0; z < m_TilesZ; ++z)
+        {
+            for (i32 x = 0; x < m_TilesX; ++x)
+            {
+                const auto index = static_cast<sizet>(TileIndex(x, z));
+                const u8 dirty = std::exchange(m_Dirty[index], static_cast<u8>(0));
+                if (dirty == 0)
+                    continue;
+
+                TileJob job;
+                job.X = x;
+                job.Z = z;
+                job.Rasterise = (dirty & kDirtyGeometry) != 0;
+                job.Cached = m_Rasters[index].get();
+                // Nothing cached means nothing walkable to carve an obstacle from.
+                if (!job.Rasterise && !job.Cached)
+                    continue;
+                needGeometry = needGeometry || job.Rasterise;
+                batch->Jobs.push_back(std::move(job));
+            }
+        }
+        if (batch->Jobs.empty())
+            return;
+
+        if (needGeometry && collectGeometry)
+            collectGeometry(batch->Geometry);
+        batch->Obstacles.reserve(m_Obstacles.size());
+        for (const auto& slot : m_Obstacles)
+            batch->Obstacles.push_back(slot.Obstacle);
+
+        // The batch is owned here and only read/written by the task until
+        // SwapIn sees it complete; `this` is only read for immutable config.
+        RebuildBatch* raw = batch.get();
+        m_InFlight = std::move(batch);
+        m_InFlightTask = Tasks::Launch(
+            "NavMeshTileRebuild", [this, raw]
+            {
+                BucketTriangles(raw->Geometry, raw->Jobs);
+                ParallelFor("NavMeshTileBuilder::Rebuild", static_cast<i32>(raw->Jobs.size()), 1, [this, raw](i32 i)
+                            { RunJob(raw->Jobs[static_cast<sizet>(i)], raw->Geometry, raw->Obstacles); });
+            },
+            Tasks::ETaskPriority::BackgroundNormal);
+    }
+
+    u32 NavMeshTileBuilder::SwapIn(dtNavMesh& navMesh)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        u32 swapped = 0;
+        for (auto& job : m_InFlight->Jobs)
+        {
+            // A failed rebuild keeps the old tile; it is still walkable, just stale.
+            if (job.Failed)
+            {
+                dtFree(job.Data);
+                continue;
+            }
+
+            if (job.Rasterise)
+                m_Rasters[static_cast<sizet>(TileIndex(job.X, job.Z))] = std::move(job.Raster);
+
+            if (const dtTileRef old = navMesh.getTileRefAt(job.X, job.Z, 0); old != 0)
+                navMesh.removeTile(old, nullptr, nullptr);
+            if (job.Data && dtStatusFailed(navMesh.addTile(job.Data, job.DataSize, DT_TILE_FREE_DATA, 0, nullptr)))
+            {
+                OLO_CORE_ERROR("NavMeshTileBuilder: Could not add rebuilt tile ({}, {})", job.X, job.Z);
+                dtFree(job.Data);
+            }
+            job.Data = nullptr;
+            ++swapped;
+        }
+
+        m_InFlight.reset();
+        m_InFlightTask = {};
+        m_RebuiltTileCount += swapped;
+        return swapped;
+    }
+
+    u32 NavMeshTileBuilder::Update(dtNavMesh& navMesh, const std::function<void(NavMeshInputGeometry&)>& collectGeometry,
+                                   bool wait)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        u32 swapped = 0;
+        if (m_InFlight)
+        {
+            if (wait)
+                m_InFlightTask.Wait();
+            if (!m_InFlightTask.IsCompleted())
+                return 0;
+            swapped += SwapIn(navMesh);
+        }
+
+        Launch(collectGeometry);
+        if (wait && m_InFlight)
+        {
+            m_InFlightTask.Wait();
+            swapped += SwapIn(navMesh);
+        }
+        return swapped;
+    }
+} // namespace OloEngine
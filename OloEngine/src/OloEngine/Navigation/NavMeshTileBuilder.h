@@ -0,0 +1,180 @@
+#pragma once
+
+#include "OloEngine/Core/Base.h"
+#include "OloEngine/Navigation/NavMeshSettings.h"
+#include "OloEngine/Navigation/OffMeshLink.h"
+#include "OloEngine/Task/Task.h"
+
+#include <glm/glm.hpp>
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+class dtNavMesh;
+struct rcCompactHeightfield;
+
+namespace OloEngine
+{
+    // World-space triangle soup a navmesh is built from (x,y,z per vertex,
+    // three indices per triangle), as gathered by NavMeshGenerator.
+    struct NavMeshInputGeometry
+    {
+        std::vector<f32> Verts;
+        std::vector<i32> Tris;
+    };
+
+    // A temporary obstacle: an upright cylinder standing on Position. Carved out
+    // of the walkable area (inflated by the agent radius like any wall) without
+    // re-rasterising the scene.
+    struct NavMeshObstacle
+    {
+        glm::vec3 Position{ 0.0f };
+        f32 Radius = 0.5f;
+        f32 Height = 2.0f;
+    };
+
+    // Runtime side of a tiled navmesh (NavMeshSettings::TileSize > 0).
+    //
+    // The bounds are cut into TileSize x TileSize-cell tiles, each built by its
+    // own Recast pipeline (with a walkableRadius + 3 cell border so seams line
+    // up) on the task pool and added to one multi-tile dtNavMesh. Per tile it
+    // keeps the rasterised, filtered compact heightfield — the expensive half
+    // of the pipeline — so that:
+    //   * MarkDirty() (geometry changed: a destructible broke, a static body
+    //     came or went) re-rasterises only the overlapping tiles;
+    //   * obstacles only mark a copy of the cached heightfield and re-run the
+    //     cheap half (erode -> regions -> contours -> polys -> detail).
+    //
+    // Rebuilds run asynchronously. Update() is called on the game thread once
+    // a frame, before the crowd; it swaps finished tiles into the live
+    // dtNavMesh (removeTile + addTile per tile) and then launches the next
+    // batch. Agents keep walking the old tiles until the swap; the swap bumps
+    // the tile salt, and DetourCrowd re-plans any corridor left holding a
+    // stale poly ref.
+    class NavMeshTileBuilder
+    {
+      public:
+        NavMeshTileBuilder(const NavMeshSettings& settings, const glm::vec3& boundsMin, const glm::vec3& boundsMax,
+                           const std::vector<OffMeshLink>& links);
+        ~NavMeshTileBuilder();
+
+        NavMeshTileBuilder(const NavMeshTileBuilder&) = delete;
+        NavMeshTileBuilder& operator=(const NavMeshTileBuilder&) = delete;
+
+        // Build every tile in parallel and return a new multi-tile navmesh
+        // (caller owns; free with dtFreeNavMesh), or nullptr on failure.
+        [[nodiscard]] dtNavMesh* BuildAll(const NavMeshInputGeometry& geometry);
+
+        // Queue the tiles overlapping the box for re-rasterisation.
+        void MarkDirty(const glm::vec3& boundsMin, const glm::vec3& boundsMax);
+
+        // Returns a non-zero handle, or 0 if the obstacle is invalid.
+        u32 AddObstacle(const NavMeshObstacle& obstacle);
+        bool RemoveObstacle(u32 handle);
+
+        // Swap in finished tiles, then start rebuilding whatever is dirty.
+        // `collectGeometry` is only called when a tile needs re-rasterising.
+        // With `wait` set, blocks until everything queued so far is live.
+        // Returns the number of tiles swapped in.
+        u32 Update(dtNavMesh& navMesh, const std::function<void(NavMeshInputGeometry&)>& collectGeometry,
+                   bool wait = false);
+
+        [[nodiscard]] bool HasPendingWork() const;
+
+        [[nodiscard]] i32 GetTilesX() const
+        {
+            return m_TilesX;
+        }
+        [[nodiscard]] i32 GetTilesZ() const
+        {
+            return m_TilesZ;
+        }
+        // Total tiles swapped in by Update() since construction.
+        [[nodiscard]] u64 GetRebuiltTileCount() const
+        {
+            return m_RebuiltTileCount;
+        }
+
+      private:
+        struct CompactHeightfieldDeleter
+        {
+            void operator()(rcCompactHeightfield* chf) const;
+        };
+        using CompactHeightfieldPtr = std::unique_ptr<rcCompactHeightfield, CompactHeightfieldDeleter>;
+
+        struct ObstacleSlot
+        {
+            u32 Handle = 0;
+            NavMeshObstacle Obstacle;
+        };
+
+        struct TileJob
+        {
+            i32 X = 0;
+            i32 Z = 0;
+            bool Rasterise = false;
+            std::vector<i32> Tris; // Rasterise only: this tile's triangles
+            const rcCompactHeightfield* Cached = nullptr;
+
+            // Out
+            CompactHeightfieldPtr Raster;
+            u8* Data = nullptr;
+            i32 DataSize = 0;
+            bool Failed = false;
+        };
+
+        struct RebuildBatch
+        {
+            NavMeshInputGeometry Geometry;
+            std::vector<NavMeshObstacle> Obstacles;
+            std::vector<TileJob> Jobs;
+        };
+
+        [[nodiscard]] i32 TileIndex(i32 x, i32 z) const
+        {
+            return z * m_TilesX + x;
+        }
+        void TileRangeOf(const glm::vec3& boundsMin, const glm::vec3& boundsMax, f32 pad,
+                         i32& x0, i32& z0, i32& x1, i32& z1) const;
+        void MarkTiles(const glm::vec3& boundsMin, const glm::vec3& boundsMax, f32 pad, u8 reason);
+        void BucketTriangles(const NavMeshInputGeometry& geometry, std::vector<TileJob>& jobs) const;
+
+        void RunJob(TileJob& job, const NavMeshInputGeometry& geometry,
+                    const std::vector<NavMeshObstacle>& obstacles) const;
+        [[nodiscard]] CompactHeightfieldPtr RasteriseTile(const NavMeshInputGeometry& geometry,
+                                                          const std::vector<i32>& tris, i32 x, i32 z) const;
+        [[nodiscard]] bool BuildTileData(const rcCompactHeightfield& raster, const std::vector<NavMeshObstacle>& obstacles,
+                                         i32 x, i32 z, u8*& outData, i32& outDataSize) const;
+
+        u32 SwapIn(dtNavMesh& navMesh);
+        void Launch(const std::function<void(NavMeshInputGeometry&)>& collectGeometry);
+
+        NavMeshSettings m_Settings;
+        glm::vec3 m_BoundsMin{ 0.0f };
+        glm::vec3 m_BoundsMax{ 0.0f };
+
+        // Off-mesh links as the flat arrays dtCreateNavMeshData reads; every
+        // tile gets all of them and Detour keeps those starting inside it.
+        std::vector<f32> m_OffMeshVerts;
+        std::vector<f32> m_OffMeshRads;
+        std::vector<u16> m_OffMeshFlags;
+        std::vector<u8> m_OffMeshAreas;
+        std::vector<u8> m_OffMeshDirs;
+        std::vector<u32> m_OffMeshUserIds;
+
+        i32 m_TilesX = 0;
+        i32 m_TilesZ = 0;
+        f32 m_TileWorldSize = 0.0f;
+        i32 m_BorderCells = 0;
+
+        std::vector<CompactHeightfieldPtr> m_Rasters; // per tile; null = nothing walkable to cache
+        std::vector<u8> m_Dirty;                      // per tile: kDirty* bits
+        std::vector<ObstacleSlot> m_Obstacles;
+        u32 m_NextObstacleHandle = 1;
+
+        Scope<RebuildBatch> m_InFlight;
+        Tasks::TTask<void> m_InFlightTask;
+        u64 m_RebuiltTileCount = 0;
+    };
+} // namespace OloEngine
@@ -1,36 +1,123 @@
 #include "OloEnginePCH.h"
 #include "OloEngine/Navigation/NavigationSystem.h"
 #include "OloEngine/Navigation/CrowdManager.h"
+#include "OloEngine/Navigation/FlowFieldManager.h"
+#include "OloEngine/Navigation/NavMeshGenerator.h"
+#include "OloEngine/Navigation/PathRequestService.h"
 #include "OloEngine/Scene/Scene.h"
 #include "OloEngine/Scene/Entity.h"
 #include "OloEngine/Scene/Components.h"
 
 #include <glm/glm.hpp>
 
+#include <vector>
+
 namespace OloEngine
 {
+    namespace
+    {
+        // The manual follower's verdict on a fresh path (m_PathCorners already
+        // holds its corners).
+        void ApplyPathResult(NavAgentComponent& agent, FindPathResult result)
+        {
+            agent.m_CurrentCornerIndex = 0;
+            if (result == FindPathResult::Failed)
+            {
+                // No path at all. Latch unreachable but keep m_HasTarget set so
+                // consumers (BTMoveTo / scripts) can observe the terminal outcome.
+                agent.m_HasPath = false;
+                agent.m_TargetUnreachable = true;
+            }
+            else
+            {
+                // Complete OR Partial: follow the corners we have. A partial path
+                // walks the agent to the nearest reachable point; the flag marks
+                // that it will never actually arrive at the requested target.
+                agent.m_HasPath = true;
+                agent.m_TargetUnreachable = (result == FindPathResult::Partial);
+            }
+        }
+    } // namespace
+
     void NavigationSystem::OnUpdate(Scene* scene, f32 dt)
     {
         OLO_PROFILE_FUNCTION();
 
         auto* crowdMgr = scene->GetCrowdManager();
         const auto* navQuery = scene->GetNavMeshQuery();
+        auto* pathService = scene->GetPathRequestService();
+        auto* flowFields = scene->GetFlowFieldManager();
 
         if (!navQuery || !navQuery->IsValid())
             return;
 
+        // Tiled meshes: swap rebuilt tiles in before anyone walks this frame.
+        // DetourCrowd re-plans corridors left holding stale poly refs itself; the
+        // manual follower's corners are plain positions, so those agents re-path
+        // (and get a fresh reachability verdict) against the new tiles.
+        bool tilesSwapped = false;
+        if (const Ref<NavMesh> navMesh = scene->GetNavMesh(); navMesh && navMesh->GetTileBuilder())
+            tilesSwapped = NavMeshGenerator::UpdateTiles(scene, *navMesh) > 0;
+        if (tilesSwapped && pathService)
+            pathService->Invalidate();
+        if (tilesSwapped && flowFields)
+            flowFields->Rebuild();
+
         // Update crowd first so agents get current-frame positions
         if (crowdMgr && crowdMgr->IsValid())
             crowdMgr->Update(dt);
 
         auto view = scene->GetAllEntitiesWith<NavAgentComponent, TransformComponent>();
 
+        // Flow-field agents are gathered here and stepped together after the
+        // loop; they never hold a crowd slot or a path request.
+        std::vector<entt::entity> flowEntities;
+        std::vector<FlowFieldAgent> flowAgents;
+
         for (auto e : view)
         {
             Entity entity = { e, scene };
             auto& agent = entity.GetComponent<NavAgentComponent>();
             auto& transform = entity.GetComponent<TransformComponent>();
 
+            if (agent.m_FlowFieldGroup != 0 && flowFields && flowFields->IsValid())
+            {
+                // Switched to a flow group at runtime: give back what the other
+                // followers were holding.
+                if (agent.m_CrowdAgentId >= 0 && crowdMgr)
+                {
+                    crowdMgr->RemoveAgent(agent.m_CrowdAgentId);
+                    agent.m_CrowdAgentId = -1;
+                }
+                if (agent.m_PathRequest != 0 && pathService)
+                {
+                    pathService->Cancel(agent.m_PathRequest);
+                    agent.m_PathRequest = 0;
+                }
+                agent.m_PathCorners.clear();
+                agent.m_CurrentCornerIndex = 0;
+
+                // New tiles may have opened a route (same as the manual follower).
+                if (tilesSwapped && agent.m_HasTarget)
+                    agent.m_TargetUnreachable = false;
+
+                FlowFieldAgent flowAgent;
+                flowAgent.Position = transform.Translation;
+                flowAgent.Target = agent.m_TargetPosition;
+                flowAgent.Radius = agent.m_Radius;
+                flowAgent.MaxSpeed = agent.m_MaxSpeed;
+                flowAgent.StoppingDistance = agent.m_StoppingDistance;
+                flowAgent.Group = agent.m_FlowFieldGroup;
+                flowAgent.HasTarget = agent.m_HasTarget && !agent.m_TargetUnreachable;
+                flowAgent.LockYAxis = agent.m_LockYAxis;
+                // Cheap unless the goal moved to another cell: the group shares one goal.
+                if (flowAgent.HasTarget)
+                    flowFields->SetGoal(agent.m_FlowFieldGroup, agent.m_TargetPosition);
+                flowEntities.push_back(e);
+                flowAgents.push_back(flowAgent);
+                continue;
+            }
+
             // If a crowd is running, every NavAgent participates in it (even one with
             // no target yet) so DetourCrowd's separation/avoidance accounts for it
             // against its neighbours. Register lazily on first tick rather than via
@@ -44,6 +131,14 @@ namespace OloEngine
 
                 if (agent.m_CrowdAgentId >= 0)
                 {
+                    // A manual-follower request left over from before the agent
+                    // got a crowd slot.
+                    if (agent.m_PathRequest != 0 && pathService)
+                    {
+                        pathService->Cancel(agent.m_PathRequest);
+                        agent.m_PathRequest = 0;
+                    }
+
                     // Issue the move request once per target (mirrors the manual
                     // follower's "!m_HasPath && m_HasTarget" repath gate below —
                     // m_HasPath here means "request issued", not "corners computed").
@@ -104,31 +199,44 @@ namespace OloEngine
                 // tick retries registration.
             }
 
-            // Manual pathfinding for agents not in crowd. Once a target is flagged
-            // unreachable we stop recomputing — otherwise a disconnected/off-navmesh
-            // target would re-run FindPath every frame and (via the manual follower or
-            // BTMoveTo) spin forever. The unreachable flag is the terminal signal.
-            if (!agent.m_HasPath && agent.m_HasTarget && !agent.m_TargetUnreachable)
+            if (tilesSwapped && agent.m_HasTarget)
             {
-                const FindPathResult result =
-                    navQuery->FindPath(transform.Translation, agent.m_TargetPosition, agent.m_PathCorners);
+                agent.m_HasPath = false;
+                agent.m_TargetUnreachable = false;
+                agent.m_PathCorners.clear();
                 agent.m_CurrentCornerIndex = 0;
+            }
 
-                if (result == FindPathResult::Failed)
+            // Manual pathfinding for agents not in crowd goes through the
+            // PathRequestService: the request is searched (time-sliced, off this
+            // thread) in the Update() after this loop and picked up here next
+            // frame; the agent holds position meanwhile. A result for a target
+            // the agent has since moved away from is dropped and re-requested.
+            if (agent.m_PathRequest != 0 && pathService)
+            {
+                PathRequestResult request;
+                if (!pathService->TakeResult(agent.m_PathRequest, request))
+                    continue;
+                agent.m_PathRequest = 0;
+                if (agent.m_HasTarget && !agent.m_HasPath && request.Target == agent.m_TargetPosition)
                 {
-                    // No path at all. Latch unreachable but keep m_HasTarget set so
-                    // consumers (BTMoveTo / scripts) can observe the terminal outcome.
-                    agent.m_HasPath = false;
-                    agent.m_TargetUnreachable = true;
+                    agent.m_PathCorners = std::move(request.Corners);
+                    ApplyPathResult(agent, request.Result);
                 }
-                else
+            }
+
+            // Once a target is flagged unreachable we stop recomputing — otherwise
+            // a disconnected/off-navmesh target would re-run FindPath every frame
+            // and (via the manual follower or BTMoveTo) spin forever. The
+            // unreachable flag is the terminal signal.
+            if (!agent.m_HasPath && agent.m_HasTarget && !agent.m_TargetUnreachable)
+            {
+                if (pathService && pathService->IsValid())
                 {
-                    // Complete OR Partial: follow the corners we have. A partial path
-                    // walks the agent to the nearest reachable point; the flag marks
-                    // that it will never actually arrive at the requested target.
-                    agent.m_HasPath = true;
-                    agent.m_TargetUnreachable = (result == FindPathResult::Partial);
+                    agent.m_PathRequest = pathService->Submit(transform.Translation, agent.m_TargetPosition);
+                    continue;
                 }
+                ApplyPathResult(agent, navQuery->FindPath(transform.Translation, agent.m_TargetPosition, agent.m_PathCorners));
             }
 
             if (!agent.m_HasPath || agent.m_PathCorners.empty())
@@ -166,5 +274,48 @@ namespace OloEngine
                 transform.Translation += direction * speed;
             }
         }
+
+        // Step every flow-field agent at once, then hand back the same
+        // m_HasTarget / m_TargetUnreachable contract the other followers keep.
+        if (flowFields && !flowAgents.empty())
+        {
+            flowFields->Update(flowAgents, dt);
+            for (sizet i = 0; i < flowAgents.size(); ++i)
+            {
+                const FlowFieldAgent& flowAgent = flowAgents[i];
+                Entity entity = { flowEntities[i], scene };
+                auto& agent = entity.GetComponent<NavAgentComponent>();
+                auto& transform = entity.GetComponent<TransformComponent>();
+
+                glm::vec3 pos = flowAgent.Position;
+                if (agent.m_LockYAxis)
+                    pos.y = transform.Translation.y;
+                transform.Translation = pos;
+
+                switch (flowAgent.State)
+                {
+                    case FlowFieldAgentState::Moving:
+                        agent.m_HasPath = true;
+                        break;
+                    case FlowFieldAgentState::Arrived:
+                        agent.m_HasPath = false;
+                        agent.m_HasTarget = false;
+                        break;
+                    case FlowFieldAgentState::Unreachable:
+                        agent.m_HasPath = false;
+                        agent.m_TargetUnreachable = true;
+                        break;
+                    case FlowFieldAgentState::Idle:
+                        agent.m_HasPath = false;
+                        break;
+                    case FlowFieldAgentState::Waiting:
+                        break;
+                }
+            }
+        }
+
+        // Search this frame's requests (and carry-overs) within the node budget.
+        if (pathService)
+            pathService->Update();
     }
 } // namespace OloEngine
@@ -0,0 +1,391 @@
+#include "OloEnginePCH.h"
+#include "OloEngine/Navigation/PathRequestService.h"
+#include "OloEngine/Core/Log.h"
+#include "OloEngine/Task/ParallelFor.h"
+#include "OloEngine/Task/Scheduler.h"
+#include "OloEngine/Threading/UniqueLock.h"
+
+#include <DetourNavMeshQuery.h>
+
+#include <algorithm>
+
+namespace OloEngine
+{
+    namespace
+    {
+        // Results nobody claimed (the agent was destroyed or retargeted) are
+        // dropped after this many updates.
+        constexpr u64 kResultLifetimeFrames = 8;
+        constexpr u32 kMaxAutoSlots = 8;
+
+        // Read-only, so the slots can share it across threads.
+        const dtQueryFilter& DefaultFilter()
+        {
+            static const dtQueryFilter s_Filter = []
+            {
+                dtQueryFilter filter;
+                filter.setIncludeFlags(0xFFFF);
+                filter.setExcludeFlags(0);
+                return filter;
+            }();
+            return s_Filter;
+        }
+    } // namespace
+
+    PathRequestService::PathRequestService(const Ref<NavMesh>& navMesh, const PathRequestSettings& settings)
+        : m_NavMesh(navMesh), m_Settings(settings)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        m_Settings.MaxNodesPerFrame = std::max(m_Settings.MaxNodesPerFrame, 1);
+        m_Settings.MaxPathPolys = std::max(m_Settings.MaxPathPolys, 64);
+
+        if (!m_NavMesh || !m_NavMesh->GetDetourNavMesh())
+        {
+            OLO_CORE_WARN("PathRequestService: no navmesh, requests will be refused");
+            return;
+        }
+
+        // Same extents as NavMeshQuery, so both snap a point to the same poly.
+        const auto& navSettings = m_NavMesh->GetSettings();
+        m_Extent[0] = std::max(navSettings.AgentRadius * 2.0f, navSettings.CellSize);
+        m_Extent[1] = std::max(navSettings.AgentHeight, navSettings.CellHeight);
+        m_Extent[2] = m_Extent[0];
+
+        u32 slotCount = m_Settings.Slots;
+        if (slotCount == 0)
+            slotCount = std::clamp(LowLevelTasks::FScheduler::Get().GetNumWorkers(), 1u, kMaxAutoSlots);
+
+        const auto maxPolys = static_cast<sizet>(m_Settings.MaxPathPolys);
+        m_Slots.resize(slotCount);
+        for (Slot& slot : m_Slots)
+        {
+            slot.Query = dtAllocNavMeshQuery();
+            if (!slot.Query || dtStatusFailed(slot.Query->init(m_NavMesh->GetDetourNavMesh(), m_Settings.MaxPathPolys)))
+            {
+                OLO_CORE_ERROR("PathRequestService: could not initialize a navmesh query");
+                for (Slot& other : m_Slots)
+                    dtFreeNavMeshQuery(other.Query);
+                m_Slots.clear();
+                return;
+            }
+            slot.Polys.resize(maxPolys);
+            slot.Straight.resize(maxPolys * 3);
+            slot.StraightFlags.resize(maxPolys);
+            slot.StraightPolys.resize(maxPolys);
+        }
+    }
+
+    PathRequestService::~PathRequestService()
+    {
+        OLO_PROFILE_FUNCTION();
+
+        for (Slot& slot : m_Slots)
+            dtFreeNavMeshQuery(slot.Query);
+    }
+
+    u32 PathRequestService::Submit(const glm::vec3& start, const glm::vec3& end)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        if (!IsValid())
+            return 0;
+
+        Request request;
+        request.Ticket = m_NextTicket++;
+        if (m_NextTicket == 0)
+            m_NextTicket = 1;
+        request.Start = start;
+        request.End = end;
+        request.SubmitTime = Clock::now();
+        request.SubmitFrame = m_Frame;
+        {
+            TUniqueLock<FMutex> lock(m_QueueMutex);
+            m_Queue.push_back(request);
+        }
+        ++m_Stats.Submitted;
+        ++m_Stats.Pending;
+        return request.Ticket;
+    }
+
+    void PathRequestService::Cancel(u32 ticket)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        if (ticket == 0 || m_Ready.erase(ticket) > 0)
+            return;
+        TUniqueLock<FMutex> lock(m_QueueMutex);
+        m_Cancelled.insert(ticket);
+    }
+
+    bool PathRequestService::TakeResult(u32 ticket, PathRequestResult& outResult)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        const auto it = m_Ready.find(ticket);
+        if (it == m_Ready.end())
+            return false;
+        outResult = std::move(it->second.Result);
+        m_Ready.erase(it);
+        return true;
+    }
+
+    void PathRequestService::Update()
+    {
+        OLO_PROFILE_FUNCTION();
+
+        if (!IsValid())
+            return;
+
+        const auto slotCount = static_cast<i32>(m_Slots.size());
+        const i32 budget = std::max(1, m_Settings.MaxNodesPerFrame / slotCount);
+        ParallelFor(
+            "PathRequestService", slotCount, 1,
+            [this, budget](i32 index)
+            {
+                RunSlot(m_Slots[static_cast<sizet>(index)], budget);
+            },
+            EParallelForFlags::Unbalanced);
+
+        // Back on the game thread: publish, and account for latency.
+        const Clock::time_point now = Clock::now();
+        m_Stats.CompletedLastUpdate = 0;
+        m_Stats.NodesLastUpdate = 0;
+        u32 active = 0;
+        for (Slot& slot : m_Slots)
+        {
+            m_Stats.NodesLastUpdate += slot.NodesUsed;
+            active += slot.Active ? 1u : 0u;
+            for (Completion& completion : slot.Done)
+            {
+                if (m_Cancelled.erase(completion.Source.Ticket) > 0)
+                    continue;
+
+                const f64 latencyMs = std::chrono::duration<f64, std::milli>(now - completion.Source.SubmitTime).count();
+                const auto latencyFrames = static_cast<u32>(m_Frame - completion.Source.SubmitFrame);
+                ++m_Stats.Completed;
+                ++m_Stats.CompletedLastUpdate;
+                m_Stats.CacheHits += completion.CacheHit ? 1u : 0u;
+                m_LatencyMsSum += latencyMs;
+                m_LatencyFramesSum += latencyFrames;
+                m_Stats.MaxLatencyMs = std::max(m_Stats.MaxLatencyMs, latencyMs);
+                m_Stats.MaxLatencyFrames = std::max(m_Stats.MaxLatencyFrames, latencyFrames);
+
+                m_Ready[completion.Source.Ticket] = Ready{ completion.Source, std::move(completion.Result), m_Frame };
+            }
+            slot.Done.clear();
+        }
+        if (m_Stats.Completed > 0)
+        {
+            m_Stats.MeanLatencyMs = m_LatencyMsSum / static_cast<f64>(m_Stats.Completed);
+            m_Stats.MeanLatencyFrames = static_cast<f64>(m_LatencyFramesSum) / static_cast<f64>(m_Stats.Completed);
+        }
+
+        std::erase_if(m_Ready, [this](const auto& entry)
+                      { return entry.second.Frame + kResultLifetimeFrames < m_Frame; });
+
+        {
+            TUniqueLock<FMutex> lock(m_QueueMutex);
+            m_Stats.Pending = static_cast<u32>(m_Queue.size()) + active;
+            // Nothing left that a stale cancel could still match.
+            if (m_Stats.Pending == 0)
+                m_Cancelled.clear();
+        }
+        ++m_Frame;
+    }
+
+    void PathRequestService::Flush()
+    {
+        OLO_PROFILE_FUNCTION();
+
+        while (IsValid() && m_Stats.Pending > 0)
+            Update();
+    }
+
+    void PathRequestService::Invalidate()
+    {
+        OLO_PROFILE_FUNCTION();
+
+        // Poly refs from before the swap may now point into rebuilt tiles:
+        // restart every search, and recompute anything not yet claimed.
+        TUniqueLock<FMutex> lock(m_QueueMutex);
+        for (Slot& slot : m_Slots)
+        {
+            if (slot.Active)
+                m_Queue.push_front(slot.Current);
+            slot.Active = false;
+        }
+        for (auto& [ticket, ready] : m_Ready)
+            m_Queue.push_back(ready.Source);
+        m_Stats.Pending += static_cast<u32>(m_Ready.size());
+        m_Ready.clear();
+
+        TUniqueLock<FMutex> cacheLock(m_CacheMutex);
+        m_Cache.clear();
+    }
+
+    void PathRequestService::ResetStats()
+    {
+        const u32 pending = m_Stats.Pending;
+        m_Stats = {};
+        m_Stats.Pending = pending;
+        m_LatencyMsSum = 0.0;
+        m_LatencyFramesSum = 0;
+    }
+
+    void PathRequestService::RunSlot(Slot& slot, i32 budget)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        slot.NodesUsed = 0;
+        while (slot.NodesUsed < budget)
+        {
+            if (!slot.Active)
+            {
+                if (!PopRequest(slot.Current))
+                    break;
+                ++slot.NodesUsed;
+                slot.Active = BeginRequest(slot);
+                continue;
+            }
+
+            i32 iterations = 0;
+            const dtStatus status = slot.Query->updateSlicedFindPath(budget - slot.NodesUsed, &iterations);
+            slot.NodesUsed += std::max(iterations, 1);
+            if (dtStatusInProgress(status))
+                continue;
+
+            slot.Active = false;
+            if (dtStatusFailed(status))
+                Complete(slot, FindPathResult::Failed, nullptr, 0, false);
+            else
+                FinishRequest(slot);
+        }
+    }
+
+    bool PathRequestService::PopRequest(Request& outRequest)
+    {
+        TUniqueLock<FMutex> lock(m_QueueMutex);
+        while (!m_Queue.empty())
+        {
+            outRequest = m_Queue.front();
+            m_Queue.pop_front();
+            if (m_Cancelled.erase(outRequest.Ticket) == 0)
+                return true;
+        }
+        return false;
+    }
+
+    bool PathRequestService::BeginRequest(Slot& slot)
+    {
+        const dtQueryFilter& filter = DefaultFilter();
+        const f32 start[3] = { slot.Current.Start.x, slot.Current.Start.y, slot.Current.Start.z };
+        const f32 end[3] = { slot.Current.End.x, slot.Current.End.y, slot.Current.End.z };
+
+        slot.StartRef = 0;
+        slot.EndRef = 0;
+        dtStatus status = slot.Query->findNearestPoly(start, m_Extent, &filter, &slot.StartRef, slot.StartPos);
+        if (!dtStatusFailed(status) && slot.StartRef)
+            status = slot.Query->findNearestPoly(end, m_Extent, &filter, &slot.EndRef, slot.EndPos);
+        if (dtStatusFailed(status) || !slot.StartRef || !slot.EndRef)
+        {
+            Complete(slot, FindPathResult::Failed, nullptr, 0, false);
+            return false;
+        }
+
+        bool partial = false;
+        if (LookupCorridor({ slot.StartRef, slot.EndRef }, slot.Polys, partial))
+        {
+            Complete(slot, partial ? FindPathResult::Partial : FindPathResult::Complete,
+                     slot.Polys.data(), static_cast<i32>(slot.Polys.size()), true);
+            return false;
+        }
+
+        status = slot.Query->initSlicedFindPath(slot.StartRef, slot.EndRef, slot.StartPos, slot.EndPos, &filter);
+        if (dtStatusFailed(status))
+        {
+            Complete(slot, FindPathResult::Failed, nullptr, 0, false);
+            return false;
+        }
+        return true;
+    }
+
+    void PathRequestService::FinishRequest(Slot& slot)
+    {
+        slot.Polys.resize(static_cast<sizet>(m_Settings.MaxPathPolys));
+        i32 polyCount = 0;
+        const dtStatus status = slot.Query->finalizeSlicedFindPath(slot.Polys.data(), &polyCount, m_Settings.MaxPathPolys);
+        if (dtStatusFailed(status) || polyCount == 0)
+        {
+            Complete(slot, FindPathResult::Failed, nullptr, 0, false);
+            return;
+        }
+
+        // As in NavMeshQuery::FindPath: the corridor stops at the nearest
+        // reachable poly when the target can't be reached.
+        const bool partial = dtStatusDetail(status, DT_PARTIAL_RESULT);
+        StoreCorridor({ slot.StartRef, slot.EndRef }, slot.Polys.data(), polyCount, partial);
+        Complete(slot, partial ? FindPathResult::Partial : FindPathResult::Complete, slot.Polys.data(), polyCount, false);
+    }
+
+    void PathRequestService::Complete(Slot& slot, FindPathResult result, const dtPolyRef* polys, i32 polyCount,
+                                      bool cacheHit)
+    {
+        Completion& completion = slot.Done.emplace_back();
+        completion.Source = slot.Current;
+        completion.CacheHit = cacheHit;
+        completion.Result.Target = slot.Current.End;
+        completion.Result.Result = result;
+        if (result == FindPathResult::Failed)
+            return;
+
+        i32 cornerCount = 0;
+        const dtStatus status = slot.Query->findStraightPath(slot.StartPos, slot.EndPos, polys, polyCount,
+                                                             slot.Straight.data(), slot.StraightFlags.data(),
+                                                             slot.StraightPolys.data(), &cornerCount,
+                                                             m_Settings.MaxPathPolys);
+        if (dtStatusFailed(status) || cornerCount == 0)
+        {
+            completion.Result.Result = FindPathResult::Failed;
+            return;
+        }
+
+        completion.Result.Corners.reserve(static_cast<sizet>(cornerCount));
+        for (i32 i = 0; i < cornerCount; ++i)
+            completion.Result.Corners.emplace_back(slot.Straight[i * 3], slot.Straight[i * 3 + 1], slot.Straight[i * 3 + 2]);
+    }
+
+    bool PathRequestService::LookupCorridor(const CorridorKey& key, std::vector<dtPolyRef>& outPolys, bool& outPartial)
+    {
+        if (m_Settings.CacheCapacity == 0)
+            return false;
+
+        TUniqueLock<FMutex> lock(m_CacheMutex);
+        const auto it = m_Cache.find(key);
+        if (it == m_Cache.end())
+            return false;
+        it->second.LastUse = ++m_CacheClock;
+        outPolys = it->second.Polys;
+        outPartial = it->second.Partial;
+        return true;
+    }
+
+    void PathRequestService::StoreCorridor(const CorridorKey& key, const dtPolyRef* polys, i32 polyCount, bool partial)
+    {
+        if (m_Settings.CacheCapacity == 0)
+            return;
+
+        TUniqueLock<FMutex> lock(m_CacheMutex);
+        if (m_Cache.size() >= m_Settings.CacheCapacity && !m_Cache.contains(key))
+        {
+            // Least recently used; the cache is small and this only runs on a miss.
+            const auto oldest = std::ranges::min_element(m_Cache, {}, [](const auto& entry)
+                                                         { return entry.second.LastUse; });
+            m_Cache.erase(oldest);
+        }
+        CachedCorridor& entry = m_Cache[key];
+        entry.Polys.assign(polys, polys + polyCount);
+        entry.Partial = partial;
+        entry.LastUse = ++m_CacheClock;
+    }
+} // namespace OloEngine
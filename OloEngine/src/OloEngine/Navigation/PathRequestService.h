@@ -0,0 +1,214 @@
+#pragma once
+
+#include "OloEngine/Core/Base.h"
+#include "OloEngine/Core/Ref.h"
+#include "OloEngine/Navigation/NavMesh.h"
+#include "OloEngine/Navigation/NavMeshQuery.h"
+#include "OloEngine/Threading/Mutex.h"
+
+#include <DetourNavMesh.h>
+
+#include <glm/glm.hpp>
+
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+class dtNavMeshQuery;
+
+namespace OloEngine
+{
+    struct PathRequestSettings
+    {
+        // Detour node expansions (A* iterations) per Update(), across all
+        // slots. Starting a request is charged one expansion so a burst of
+        // cache hits can't run unbounded either.
+        i32 MaxNodesPerFrame = 4096;
+        // Parallel searches, each with its own dtNavMeshQuery. 0 = one per
+        // task worker, capped at 8.
+        u32 Slots = 0;
+        // Corridors remembered per (start poly, end poly) pair.
+        u32 CacheCapacity = 256;
+        // Node pool per query and longest corridor a result can hold.
+        i32 MaxPathPolys = 2048;
+    };
+
+    struct PathRequestResult
+    {
+        FindPathResult Result = FindPathResult::Failed;
+        std::vector<glm::vec3> Corners;
+        // The request's end point, so a caller whose target moved meanwhile
+        // can tell the answer is stale.
+        glm::vec3 Target{ 0.0f };
+    };
+
+    struct PathRequestStats
+    {
+        u64 Submitted = 0;
+        u64 Completed = 0;
+        u64 CacheHits = 0; // completed from a cached corridor, no A*
+        u32 Pending = 0; // queued + in flight
+        u32 CompletedLastUpdate = 0;
+        i32 NodesLastUpdate = 0;
+        // Submit() to result available, over everything completed since the
+        // last ResetStats().
+        f64 MeanLatencyMs = 0.0;
+        f64 MaxLatencyMs = 0.0;
+        f64 MeanLatencyFrames = 0.0;
+        u32 MaxLatencyFrames = 0;
+    };
+
+    // Asynchronous, time-sliced FindPath for NavigationSystem's manual
+    // follower (DetourCrowd queues its own agents' paths).
+    //
+    // Submit() only enqueues. Update(), once a frame on the game thread, runs
+    // the slots on the task pool: each pulls requests off the shared queue and
+    // advances them with Detour's sliced A* (init/update/finalizeSlicedFindPath)
+    // until its share of the node budget is spent, so a search that doesn't
+    // finish carries over to the next frame. Results land in a completion map
+    // that TakeResult() drains by ticket; unclaimed results expire after a few
+    // updates. Identical start-poly/end-poly pairs reuse a cached corridor and
+    // only rerun the cheap findStraightPath.
+    //
+    // The navmesh must not change while Update() runs. After a tile swap call
+    // Invalidate(): in-flight searches restart and the cache is dropped.
+    class PathRequestService
+    {
+      public:
+        explicit PathRequestService(const Ref<NavMesh>& navMesh, const PathRequestSettings& settings = {});
+        ~PathRequestService();
+
+        PathRequestService(const PathRequestService&) = delete;
+        PathRequestService& operator=(const PathRequestService&) = delete;
+
+        // Returns a non-zero ticket, or 0 if the service has no navmesh.
+        [[nodiscard]] u32 Submit(const glm::vec3& start, const glm::vec3& end);
+        void Cancel(u32 ticket);
+        // True (and the ticket is spent) once the result is in.
+        bool TakeResult(u32 ticket, PathRequestResult& outResult);
+
+        void Update();
+        // Runs Update() until nothing is pending (loading screens, tests).
+        void Flush();
+        void Invalidate();
+
+        [[nodiscard]] bool IsValid() const
+        {
+            return !m_Slots.empty();
+        }
+        [[nodiscard]] u32 GetSlotCount() const
+        {
+            return static_cast<u32>(m_Slots.size());
+        }
+        [[nodiscard]] const PathRequestSettings& GetSettings() const
+        {
+            return m_Settings;
+        }
+        [[nodiscard]] const PathRequestStats& GetStats() const
+        {
+            return m_Stats;
+        }
+        void ResetStats();
+
+      private:
+        using Clock = std::chrono::steady_clock;
+
+        struct Request
+        {
+            u32 Ticket = 0;
+            glm::vec3 Start{ 0.0f };
+            glm::vec3 End{ 0.0f };
+            Clock::time_point SubmitTime;
+            u64 SubmitFrame = 0;
+        };
+
+        struct Completion
+        {
+            Request Source;
+            PathRequestResult Result;
+            bool CacheHit = false;
+        };
+
+        struct Slot
+        {
+            dtNavMeshQuery* Query = nullptr;
+            bool Active = false;
+            Request Current;
+            dtPolyRef StartRef = 0;
+            dtPolyRef EndRef = 0;
+            f32 StartPos[3]{};
+            f32 EndPos[3]{};
+            i32 NodesUsed = 0;
+            std::vector<Completion> Done;
+            // Scratch for finalize/findStraightPath.
+            std::vector<dtPolyRef> Polys;
+            std::vector<f32> Straight;
+            std::vector<u8> StraightFlags;
+            std::vector<dtPolyRef> StraightPolys;
+        };
+
+        struct CorridorKey
+        {
+            dtPolyRef Start = 0;
+            dtPolyRef End = 0;
+
+            bool operator==(const CorridorKey&) const = default;
+        };
+        struct CorridorKeyHash
+        {
+            sizet operator()(const CorridorKey& key) const
+            {
+                return std::hash<u64>{}((static_cast<u64>(key.Start) * 0x9E3779B97F4A7C15ull) ^ static_cast<u64>(key.End));
+            }
+        };
+        struct CachedCorridor
+        {
+            std::vector<dtPolyRef> Polys;
+            bool Partial = false;
+            u64 LastUse = 0;
+        };
+
+        struct Ready
+        {
+            Request Source;
+            PathRequestResult Result;
+            u64 Frame = 0;
+        };
+
+        void RunSlot(Slot& slot, i32 budget);
+        [[nodiscard]] bool PopRequest(Request& outRequest);
+        // Finds the end polys and either completes the request on the spot
+        // (failure, cache hit) or starts a sliced search. Returns true if the
+        // slot now has a search in flight.
+        bool BeginRequest(Slot& slot);
+        void FinishRequest(Slot& slot);
+        void Complete(Slot& slot, FindPathResult result, const dtPolyRef* polys, i32 polyCount, bool cacheHit);
+        [[nodiscard]] bool LookupCorridor(const CorridorKey& key, std::vector<dtPolyRef>& outPolys, bool& outPartial);
+        void StoreCorridor(const CorridorKey& key, const dtPolyRef* polys, i32 polyCount, bool partial);
+
+        Ref<NavMesh> m_NavMesh;
+        PathRequestSettings m_Settings;
+        f32 m_Extent[3]{ 2.0f, 4.0f, 2.0f };
+        std::vector<Slot> m_Slots;
+
+        // Written on the game thread; popped by the slots inside Update().
+        FMutex m_QueueMutex;
+        std::deque<Request> m_Queue;
+        std::unordered_set<u32> m_Cancelled;
+
+        FMutex m_CacheMutex;
+        std::unordered_map<CorridorKey, CachedCorridor, CorridorKeyHash> m_Cache;
+        u64 m_CacheClock = 0;
+
+        std::unordered_map<u32, Ready> m_Ready;
+        u32 m_NextTicket = 1;
+        u64 m_Frame = 0;
+
+        PathRequestStats m_Stats;
+        f64 m_LatencyMsSum = 0.0;
+        u64 m_LatencyFramesSum = 0;
+    };
+} // namespace OloEngine
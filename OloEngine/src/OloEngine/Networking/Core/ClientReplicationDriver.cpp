@@ -163,6 +163,16 @@ namespace OloEngine
         m_Prediction.ResetSession();
     }
 
+    const ClientReplicationDriver::SnapshotReceiveStats& ClientReplicationDriver::GetSnapshotStats() const
+    {
+        return m_SnapshotStats;
+    }
+
+    void ClientReplicationDriver::ResetSnapshotStats()
+    {
+        m_SnapshotStats = {};
+    }
+
     void ClientReplicationDriver::SendInput(Scene& scene, NetworkClient& client, u64 entityUUID,
                                             std::vector<u8> inputData)
     {
@@ -324,6 +334,10 @@ namespace OloEngine
             return;
         }
 
+        ++m_SnapshotStats.Count;
+        m_SnapshotStats.TotalBytes += size;
+        m_SnapshotStats.MaxBytes = std::max(m_SnapshotStats.MaxBytes, size);
+
         u32 serverTick = 0;
         {
             FMemoryReader reader(data, static_cast<i64>(size));
@@ -110,6 +110,18 @@ namespace OloEngine
         [[nodiscard]] u32 GetCurrentInputTick() const;
         [[nodiscard]] const std::unordered_set<u64>& GetLocallySpawnedEntities() const;
 
+        // Every snapshot/delta payload that reached HandleSnapshot, stale ones
+        // included — this is what the wire cost, not what was applied.
+        struct SnapshotReceiveStats
+        {
+            u64 Count = 0;
+            u64 TotalBytes = 0;
+            u32 MaxBytes = 0;
+        };
+
+        [[nodiscard]] const SnapshotReceiveStats& GetSnapshotStats() const;
+        void ResetSnapshotStats();
+
         // Drop all per-session state (authoritative map, spawned set, prediction
         // buffers, client id). Call on disconnect so a reconnect never mixes
         // session-A state into session-B.
@@ -147,6 +159,8 @@ namespace OloEngine
         // despawns are erased.
         ParsedSnapshot m_Authoritative;
 
+        SnapshotReceiveStats m_SnapshotStats;
+
         // Entities THIS driver created from a spawn message. A despawn may destroy
         // only these — an entity that came from the client's own scene file must
         // survive leaving relevance, or walking out of range would permanently
@@ -0,0 +1,233 @@
+#include "OloEnginePCH.h"
+#include "InterZoneMessageBus.h"
+
+#include "OloEngine/Debug/Profiler.h"
+#include "OloEngine/Threading/UniqueLock.h"
+
+#include <algorithm>
+
+namespace OloEngine
+{
+    InterZoneMessageBus::InterZoneMessageBus()
+    {
+        auto table = std::make_unique<FShardTable>();
+        m_Table.store(table.get(), std::memory_order_release);
+        m_Tables.push_back(std::move(table));
+    }
+
+    InterZoneMessageBus::~InterZoneMessageBus()
+    {
+        // Release every undelivered envelope so broadcast tickets go back to the
+        // allocator before it is destroyed; the payload handles free themselves.
+        std::vector<FEnvelope> leftovers;
+        DrainShardLocked(m_Unrouted, leftovers);
+        for (auto const& shard : m_Shards)
+        {
+            DrainShardLocked(*shard, leftovers);
+        }
+        for (auto& envelope : leftovers)
+        {
+            CompleteDelivery(envelope);
+        }
+    }
+
+    void InterZoneMessageBus::RegisterZone(u32 zoneID)
+    {
+        if (zoneID != 0)
+        {
+            FindOrCreateShard(zoneID);
+        }
+    }
+
+    void InterZoneMessageBus::Push(InterZoneMessage message)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        u64 const sequence = m_NextSequence.fetch_add(1, std::memory_order_relaxed);
+        m_PendingCount.fetch_add(1, std::memory_order_release);
+
+        if (message.TargetZoneID != 0)
+        {
+            FZoneShard* shard = FindOrCreateShard(message.TargetZoneID);
+            shard->Depth.fetch_add(1, std::memory_order_relaxed);
+            shard->Queue.Enqueue(FEnvelope{ std::move(message), sequence, nullptr });
+            return;
+        }
+
+        // Broadcast: one ticket per message, one envelope per known zone, one payload block shared by all.
+        const FShardTable* table = m_Table.load(std::memory_order_acquire);
+        sizet const recipients = table->Shards.size();
+        if (recipients == 0)
+        {
+            m_Unrouted.Depth.fetch_add(1, std::memory_order_relaxed);
+            m_Unrouted.Queue.Enqueue(FEnvelope{ std::move(message), sequence, nullptr });
+            return;
+        }
+
+        auto* ticket = ::new (m_TicketAllocator.Allocate()) FBroadcastTicket();
+        ticket->Remaining.store(static_cast<u32>(recipients), std::memory_order_relaxed);
+        for (sizet i = 0; i < recipients; ++i)
+        {
+            FZoneShard* shard = table->Shards[i];
+            shard->Depth.fetch_add(1, std::memory_order_relaxed);
+            if (i + 1 == recipients)
+            {
+                shard->Queue.Enqueue(FEnvelope{ std::move(message), sequence, ticket });
+            }
+            else
+            {
+                shard->Queue.Enqueue(FEnvelope{ message, sequence, ticket });
+            }
+        }
+    }
+
+    std::vector<InterZoneMessage> InterZoneMessageBus::DrainAll()
+    {
+        OLO_PROFILE_FUNCTION();
+
+        std::vector<FEnvelope> envelopes;
+        {
+            TUniqueLock<FMutex> lock(m_Unrouted.ConsumerMutex);
+            DrainShardLocked(m_Unrouted, envelopes);
+        }
+
+        std::vector<FZoneShard*> shards;
+        {
+            TUniqueLock<FMutex> lock(m_RegistrationMutex);
+            shards.reserve(m_Shards.size());
+            for (auto const& shard : m_Shards)
+            {
+                shards.push_back(shard.get());
+            }
+        }
+        for (FZoneShard* shard : shards)
+        {
+            TUniqueLock<FMutex> lock(shard->ConsumerMutex);
+            DrainShardLocked(*shard, envelopes);
+        }
+
+        // Shards are individually FIFO; the global push order is the sequence number.
+        // Broadcast copies share a sequence, so the stable sort keeps them adjacent.
+        std::ranges::stable_sort(envelopes, {}, &FEnvelope::Sequence);
+
+        std::vector<InterZoneMessage> result;
+        result.reserve(envelopes.size());
+        for (sizet i = 0; i < envelopes.size(); ++i)
+        {
+            FEnvelope& envelope = envelopes[i];
+            bool const firstCopy = (i == 0) || envelopes[i - 1].Sequence != envelope.Sequence;
+            // Consume every drained copy, but hand the message out once.
+            CompleteDelivery(envelope);
+            if (firstCopy)
+            {
+                result.push_back(std::move(envelope.Message));
+            }
+        }
+        return result;
+    }
+
+    std::vector<InterZoneMessage> InterZoneMessageBus::DrainForZone(u32 zoneID)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        std::vector<InterZoneMessage> result;
+        if (zoneID == 0)
+        {
+            return result;
+        }
+
+        FZoneShard* shard = FindOrCreateShard(zoneID);
+        std::vector<FEnvelope> envelopes;
+        {
+            TUniqueLock<FMutex> lock(shard->ConsumerMutex);
+            DrainShardLocked(*shard, envelopes);
+        }
+
+        result.reserve(envelopes.size());
+        for (auto& envelope : envelopes)
+        {
+            CompleteDelivery(envelope);
+            result.push_back(std::move(envelope.Message));
+        }
+        return result;
+    }
+
+    u32 InterZoneMessageBus::GetPendingCountForZone(u32 zoneID) const
+    {
+        const FZoneShard* shard = FindShard(zoneID);
+        return shard ? shard->Depth.load(std::memory_order_acquire) : 0;
+    }
+
+    u32 InterZoneMessageBus::GetZoneCount() const
+    {
+        return static_cast<u32>(m_Table.load(std::memory_order_acquire)->Shards.size());
+    }
+
+    InterZoneMessageBus::FZoneShard* InterZoneMessageBus::FindShard(u32 zoneID) const
+    {
+        const FShardTable* table = m_Table.load(std::memory_order_acquire);
+        auto const it = std::ranges::lower_bound(table->ZoneIDs, zoneID);
+        if (it == table->ZoneIDs.end() || *it != zoneID)
+        {
+            return nullptr;
+        }
+        return table->Shards[static_cast<sizet>(it - table->ZoneIDs.begin())];
+    }
+
+    InterZoneMessageBus::FZoneShard* InterZoneMessageBus::FindOrCreateShard(u32 zoneID)
+    {
+        if (FZoneShard* shard = FindShard(zoneID))
+        {
+            return shard;
+        }
+
+        TUniqueLock<FMutex> lock(m_RegistrationMutex);
+
+        // Re-check under the lock: another thread may have published it meanwhile.
+        const FShardTable* current = m_Table.load(std::memory_order_acquire);
+        auto const it = std::ranges::lower_bound(current->ZoneIDs, zoneID);
+        auto const index = static_cast<sizet>(it - current->ZoneIDs.begin());
+        if (it != current->ZoneIDs.end() && *it == zoneID)
+        {
+            return current->Shards[index];
+        }
+
+        auto shard = std::make_unique<FZoneShard>();
+        shard->ZoneID = zoneID;
+        FZoneShard* created = shard.get();
+        m_Shards.push_back(std::move(shard));
+
+        auto next = std::make_unique<FShardTable>(*current);
+        next->ZoneIDs.insert(next->ZoneIDs.begin() + static_cast<std::ptrdiff_t>(index), zoneID);
+        next->Shards.insert(next->Shards.begin() + static_cast<std::ptrdiff_t>(index), created);
+        m_Table.store(next.get(), std::memory_order_release);
+        m_Tables.push_back(std::move(next));
+        return created;
+    }
+
+    void InterZoneMessageBus::DrainShardLocked(FZoneShard& shard, std::vector<FEnvelope>& out)
+    {
+        u32 drained = 0;
+        while (std::optional<FEnvelope> envelope = shard.Queue.Dequeue())
+        {
+            out.push_back(std::move(*envelope));
+            ++drained;
+        }
+        shard.Depth.fetch_sub(drained, std::memory_order_release);
+    }
+
+    void InterZoneMessageBus::CompleteDelivery(FEnvelope& envelope)
+    {
+        FBroadcastTicket* ticket = std::exchange(envelope.Ticket, nullptr);
+        if (ticket)
+        {
+            if (ticket->Remaining.fetch_sub(1, std::memory_order_acq_rel) != 1)
+            {
+                return; // other recipients still hold a copy
+            }
+            ticket->~FBroadcastTicket();
+            m_TicketAllocator.Free(ticket);
+        }
+        m_PendingCount.fetch_sub(1, std::memory_order_release);
+    }
+} // namespace OloEngine
@@ -1,11 +1,14 @@
 #pragma once
 
 #include "OloEngine/Core/Base.h"
+#include "OloEngine/Containers/MpscQueue.h"
+#include "OloEngine/Memory/LockFreeFixedSizeAllocator.h"
+#include "OloEngine/Memory/Platform.h"
+#include "OloEngine/Networking/MMO/InterZonePayload.h"
 #include "OloEngine/Threading/Mutex.h"
-#include "OloEngine/Threading/UniqueLock.h"
 
-#include <functional>
-#include <queue>
+#include <atomic>
+#include <memory>
 #include <vector>
 
 namespace OloEngine
@@ -25,102 +28,120 @@ namespace OloEngine
         EInterZoneMessageType Type = EInterZoneMessageType::PlayerHandoff;
         u32 SourceZoneID = 0;
         u32 TargetZoneID = 0; // 0 = broadcast to all zones
-        std::vector<u8> Payload;
+        InterZonePayload Payload; // refcounted; copies share the same pooled block
     };
 
-    // Thread-safe message queue for cross-zone communication.
-    // Producers push messages from any zone thread; consumers drain them
-    // during the main update loop or from the target zone thread.
+    // Thread-safe message bus for cross-zone communication.
+    //
+    // Every destination zone owns a shard: a lock-free MPSC queue that any zone
+    // thread can push into and only that zone drains. DrainForZone therefore
+    // touches its own messages only — O(messages for this zone), not
+    // O(zones x messages) as with a single shared queue.
+    //
+    // A broadcast (TargetZoneID == 0) is fanned out at push time to every zone
+    // known to the bus. Each shard receives a copy of the message header, but the
+    // payload handle shares one pooled block, so the bytes are never copied per
+    // zone. A broadcast stays "pending" until the last recipient zone drains it.
+    //
+    // A zone becomes known when it is registered (ZoneServer::SetMessageBus),
+    // when it drains, or when a targeted message is first pushed to it. A
+    // broadcast pushed while no zone is known is held back and only returned by
+    // DrainAll.
+    //
+    // Producers never take a lock, except for the one push that first creates a
+    // zone's shard. Drains take a per-shard consumer lock, so DrainAll may run
+    // alongside DrainForZone calls.
     class InterZoneMessageBus
     {
       public:
-        InterZoneMessageBus() = default;
+        InterZoneMessageBus();
+        ~InterZoneMessageBus();
+
+        InterZoneMessageBus(const InterZoneMessageBus&) = delete;
+        InterZoneMessageBus& operator=(const InterZoneMessageBus&) = delete;
+
+        // Make `zoneID` a broadcast recipient. Idempotent; 0 is not a zone ID.
+        void RegisterZone(u32 zoneID);
 
         // Push a message onto the bus (thread-safe).
-        void Push(InterZoneMessage message)
-        {
-            TUniqueLock<FMutex> lock(m_Mutex);
-            m_Queue.push(std::move(message));
-        }
+        void Push(InterZoneMessage message);
 
-        // Drain all pending messages. Returns them in FIFO order.
-        [[nodiscard]] std::vector<InterZoneMessage> DrainAll()
-        {
-            TUniqueLock<FMutex> lock(m_Mutex);
-            std::vector<InterZoneMessage> result;
-            result.reserve(m_Queue.size());
-            while (!m_Queue.empty())
-            {
-                result.push_back(std::move(m_Queue.front()));
-                m_Queue.pop();
-            }
-            return result;
-        }
+        // Drain all pending messages in FIFO (push) order. A broadcast appears
+        // once, however many zones it was fanned out to.
+        [[nodiscard]] std::vector<InterZoneMessage> DrainAll();
 
-        // Drain messages targeted at a specific zone (or broadcast messages with targetZoneID=0).
-        // Broadcast messages are COPIED to every drainer; targeted messages are consumed.
-        [[nodiscard]] std::vector<InterZoneMessage> DrainForZone(u32 zoneID)
-        {
-            std::queue<InterZoneMessage> snapshot;
-            {
-                TUniqueLock<FMutex> lock(m_Mutex);
-                snapshot = std::move(m_Queue);
-                // m_Queue is now empty (moved-from)
-            }
-
-            std::vector<InterZoneMessage> result;
-            std::queue<InterZoneMessage> remaining;
-            while (!snapshot.empty())
-            {
-                if (auto& msg = snapshot.front(); msg.TargetZoneID == zoneID)
-                {
-                    // Targeted message — consume (move to result, don't put back)
-                    result.push_back(std::move(msg));
-                }
-                else if (msg.TargetZoneID == 0)
-                {
-                    // Broadcast — copy to result, put original back for other zones
-                    result.push_back(msg);
-                    remaining.push(std::move(msg));
-                }
-                else
-                {
-                    remaining.push(std::move(msg));
-                }
-                snapshot.pop();
-            }
-
-            if (!remaining.empty())
-            {
-                TUniqueLock<FMutex> lock(m_Mutex);
-                // Prepend remaining items back (new messages pushed since we drained go after)
-                while (!m_Queue.empty())
-                {
-                    remaining.push(std::move(m_Queue.front()));
-                    m_Queue.pop();
-                }
-                m_Queue = std::move(remaining);
-            }
-
-            return result;
-        }
+        // Drain messages targeted at a specific zone plus the broadcasts fanned out to it.
+        // Broadcast payloads are SHARED with every other recipient; targeted messages are consumed.
+        [[nodiscard]] std::vector<InterZoneMessage> DrainForZone(u32 zoneID);
 
         // Check if the bus has any pending messages.
         [[nodiscard]] bool HasMessages() const
         {
-            TUniqueLock<FMutex> lock(m_Mutex);
-            return !m_Queue.empty();
+            return GetPendingCount() != 0;
         }
 
-        // Get the number of pending messages.
+        // Get the number of pending messages. A broadcast counts once until every recipient has drained it.
         [[nodiscard]] u32 GetPendingCount() const
         {
-            TUniqueLock<FMutex> lock(m_Mutex);
-            return static_cast<u32>(m_Queue.size());
+            return m_PendingCount.load(std::memory_order_acquire);
         }
 
+        // Number of messages waiting in one zone's shard (targeted + broadcast copies).
+        [[nodiscard]] u32 GetPendingCountForZone(u32 zoneID) const;
+
+        [[nodiscard]] u32 GetZoneCount() const;
+
       private:
-        mutable FMutex m_Mutex;
-        std::queue<InterZoneMessage> m_Queue;
+        // Shared by every shard copy of one broadcast; counts recipients still to drain it.
+        struct FBroadcastTicket
+        {
+            std::atomic<u32> Remaining{ 0 };
+        };
+
+        struct FEnvelope
+        {
+            InterZoneMessage Message;
+            u64 Sequence = 0;
+            FBroadcastTicket* Ticket = nullptr; // null for targeted messages
+        };
+
+        struct alignas(OLO_PLATFORM_CACHE_LINE_SIZE) FZoneShard
+        {
+            u32 ZoneID = 0;
+            std::atomic<u32> Depth{ 0 };
+            FMutex ConsumerMutex; // serialises DrainForZone against DrainAll
+            TMpscQueue<FEnvelope> Queue;
+        };
+
+        // Immutable snapshot of the zone -> shard mapping, sorted by zone ID.
+        // Readers load it without a lock; registration publishes a new one.
+        struct FShardTable
+        {
+            std::vector<u32> ZoneIDs;
+            std::vector<FZoneShard*> Shards;
+        };
+
+        [[nodiscard]] FZoneShard* FindShard(u32 zoneID) const;
+        FZoneShard* FindOrCreateShard(u32 zoneID);
+
+        // Pop every envelope from `shard` (consumer lock must be held).
+        void DrainShardLocked(FZoneShard& shard, std::vector<FEnvelope>& out);
+
+        // Account for one delivered copy; the message stops being pending with its last copy.
+        void CompleteDelivery(FEnvelope& envelope);
+
+        std::atomic<const FShardTable*> m_Table{ nullptr };
+        std::atomic<u64> m_NextSequence{ 0 };
+        std::atomic<u32> m_PendingCount{ 0 };
+
+        // Broadcasts pushed while no zone was known; drained by DrainAll only.
+        FZoneShard m_Unrouted;
+
+        mutable FMutex m_RegistrationMutex;
+        std::vector<std::unique_ptr<FZoneShard>> m_Shards;
+        // Superseded snapshots stay alive until the bus dies: a producer may still be reading one.
+        std::vector<std::unique_ptr<const FShardTable>> m_Tables;
+
+        TLockFreeFixedSizeAllocator<sizeof(FBroadcastTicket), OLO_PLATFORM_CACHE_LINE_SIZE> m_TicketAllocator;
     };
 } // namespace OloEngine
@@ -0,0 +1,235 @@
+#include "OloEnginePCH.h"
+#include "InterZonePayload.h"
+
+#include "OloEngine/Memory/LockFreeList.h"
+#include "OloEngine/Memory/Platform.h"
+#include "OloEngine/Memory/UnrealMemory.h"
+
+#include <array>
+#include <atomic>
+#include <cstring>
+
+namespace OloEngine
+{
+    namespace
+    {
+        // Size classes cover the common inter-zone traffic (handoff packets,
+        // chat lines, world-event blobs). Anything larger is rare enough that a
+        // plain heap allocation is fine.
+        constexpr std::array<sizet, 5> kSizeClasses = { 64, 256, 1024, 4096, 16384 };
+        constexpr u32 kHeapSizeClass = static_cast<u32>(kSizeClasses.size());
+        constexpr sizet kBlockAlignment = 16;
+    } // namespace
+
+    struct alignas(kBlockAlignment) InterZonePayload::BlockHeader
+    {
+        std::atomic<u32> RefCount{ 1 };
+        u32 SizeClass = 0;
+        sizet Size = 0;
+
+        [[nodiscard]] u8* Bytes()
+        {
+            return reinterpret_cast<u8*>(this + 1);
+        }
+    };
+
+    namespace
+    {
+        using BlockHeader = InterZonePayload::BlockHeader;
+
+        class PayloadPool
+        {
+          public:
+            void* Acquire(u32 sizeClass)
+            {
+                m_Live.fetch_add(1, std::memory_order_relaxed);
+                if (sizeClass == kHeapSizeClass)
+                {
+                    m_HeapFallbacks.fetch_add(1, std::memory_order_relaxed);
+                    return nullptr;
+                }
+                if (void* block = m_FreeLists[sizeClass].Pop())
+                {
+                    m_Pooled.fetch_sub(1, std::memory_order_relaxed);
+                    return block;
+                }
+                return FMemory::Malloc(sizeof(BlockHeader) + kSizeClasses[sizeClass], kBlockAlignment);
+            }
+
+            void Return(BlockHeader* block)
+            {
+                m_Live.fetch_sub(1, std::memory_order_relaxed);
+                u32 const sizeClass = block->SizeClass;
+                block->~BlockHeader();
+                if (sizeClass == kHeapSizeClass)
+                {
+                    FMemory::Free(block);
+                    return;
+                }
+                m_FreeLists[sizeClass].Push(block);
+                m_Pooled.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            void Trim()
+            {
+                for (auto& freeList : m_FreeLists)
+                {
+                    while (void* block = freeList.Pop())
+                    {
+                        FMemory::Free(block);
+                        m_Pooled.fetch_sub(1, std::memory_order_relaxed);
+                    }
+                }
+            }
+
+            [[nodiscard]] InterZonePayload::PoolStats GetStats() const
+            {
+                InterZonePayload::PoolStats stats;
+                stats.BlocksLive = m_Live.load(std::memory_order_relaxed);
+                stats.BlocksPooled = m_Pooled.load(std::memory_order_relaxed);
+                stats.HeapFallbacks = m_HeapFallbacks.load(std::memory_order_relaxed);
+                return stats;
+            }
+
+          private:
+            std::array<TLockFreePointerListUnordered<void, OLO_PLATFORM_CACHE_LINE_SIZE>, kSizeClasses.size()> m_FreeLists;
+            std::atomic<u64> m_Live{ 0 };
+            std::atomic<u64> m_Pooled{ 0 };
+            std::atomic<u64> m_HeapFallbacks{ 0 };
+        };
+
+        // Intentionally never destroyed: a payload handle can outlive any bus
+        // (a drained message kept by the caller), and static teardown order
+        // against FMemory is not defined.
+        PayloadPool& GetPool()
+        {
+            static auto* s_Pool = new PayloadPool();
+            return *s_Pool;
+        }
+
+        u32 SizeClassFor(sizet size)
+        {
+            for (u32 i = 0; i < kSizeClasses.size(); ++i)
+            {
+                if (size <= kSizeClasses[i])
+                {
+                    return i;
+                }
+            }
+            return kHeapSizeClass;
+        }
+    } // namespace
+
+    InterZonePayload::~InterZonePayload()
+    {
+        Release();
+    }
+
+    InterZonePayload::InterZonePayload(const InterZonePayload& other)
+        : m_Block(other.m_Block)
+    {
+        if (m_Block)
+        {
+            m_Block->RefCount.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    InterZonePayload& InterZonePayload::operator=(const InterZonePayload& other)
+    {
+        if (this != &other)
+        {
+            if (other.m_Block)
+            {
+                other.m_Block->RefCount.fetch_add(1, std::memory_order_relaxed);
+            }
+            Release();
+            m_Block = other.m_Block;
+        }
+        return *this;
+    }
+
+    InterZonePayload::InterZonePayload(InterZonePayload&& other) noexcept
+        : m_Block(std::exchange(other.m_Block, nullptr))
+    {
+    }
+
+    InterZonePayload& InterZonePayload::operator=(InterZonePayload&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Release();
+            m_Block = std::exchange(other.m_Block, nullptr);
+        }
+        return *this;
+    }
+
+    InterZonePayload InterZonePayload::Allocate(sizet size)
+    {
+        if (size == 0)
+        {
+            return {};
+        }
+
+        u32 const sizeClass = SizeClassFor(size);
+        void* memory = GetPool().Acquire(sizeClass);
+        if (!memory)
+        {
+            memory = FMemory::Malloc(sizeof(BlockHeader) + size, kBlockAlignment);
+        }
+
+        auto* block = ::new (memory) BlockHeader();
+        block->SizeClass = sizeClass;
+        block->Size = size;
+        return InterZonePayload(block);
+    }
+
+    InterZonePayload InterZonePayload::CopyFrom(std::span<const u8> bytes)
+    {
+        InterZonePayload payload = Allocate(bytes.size());
+        if (!payload.IsEmpty())
+        {
+            std::memcpy(payload.m_Block->Bytes(), bytes.data(), bytes.size());
+        }
+        return payload;
+    }
+
+    const u8* InterZonePayload::GetData() const
+    {
+        return m_Block ? m_Block->Bytes() : nullptr;
+    }
+
+    sizet InterZonePayload::GetSize() const
+    {
+        return m_Block ? m_Block->Size : 0;
+    }
+
+    u8* InterZonePayload::GetMutableData()
+    {
+        OLO_CORE_ASSERT(GetRefCount() <= 1, "InterZonePayload: cannot write a shared payload");
+        return m_Block ? m_Block->Bytes() : nullptr;
+    }
+
+    u32 InterZonePayload::GetRefCount() const
+    {
+        return m_Block ? m_Block->RefCount.load(std::memory_order_acquire) : 0;
+    }
+
+    InterZonePayload::PoolStats InterZonePayload::GetPoolStats()
+    {
+        return GetPool().GetStats();
+    }
+
+    void InterZonePayload::TrimPool()
+    {
+        GetPool().Trim();
+    }
+
+    void InterZonePayload::Release()
+    {
+        if (BlockHeader* block = std::exchange(m_Block, nullptr);
+            block && block->RefCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            GetPool().Return(block);
+        }
+    }
+} // namespace OloEngine
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "OloEngine/Core/Base.h"
+
+#include <span>
+
+namespace OloEngine
+{
+    // Immutable, reference-counted byte payload carried by an InterZoneMessage.
+    //
+    // The bytes live in a block drawn from a process-wide pool of fixed size
+    // classes (larger payloads fall back to the heap). Copying the handle only
+    // bumps an atomic refcount, so a broadcast fanned out to N zone queues shares
+    // one block instead of N vector copies. The block returns to its pool when
+    // the last handle goes away — on whichever thread that happens to be.
+    //
+    // Writes are only allowed through GetMutableData() before the handle is
+    // shared (refcount 1); after that the payload is read-only by contract.
+    class InterZonePayload
+    {
+      public:
+        InterZonePayload() = default;
+        ~InterZonePayload();
+
+        InterZonePayload(const InterZonePayload& other);
+        InterZonePayload& operator=(const InterZonePayload& other);
+        InterZonePayload(InterZonePayload&& other) noexcept;
+        InterZonePayload& operator=(InterZonePayload&& other) noexcept;
+
+        // Allocate an uninitialised payload of `size` bytes. A zero size yields an empty handle.
+        [[nodiscard]] static InterZonePayload Allocate(sizet size);
+
+        // Allocate a payload and copy `bytes` into it.
+        [[nodiscard]] static InterZonePayload CopyFrom(std::span<const u8> bytes);
+
+        [[nodiscard]] const u8* GetData() const;
+        [[nodiscard]] sizet GetSize() const;
+        [[nodiscard]] bool IsEmpty() const
+        {
+            return m_Block == nullptr;
+        }
+        [[nodiscard]] std::span<const u8> GetView() const
+        {
+            return { GetData(), GetSize() };
+        }
+
+        // Writable view of the bytes. Asserts the handle is not shared.
+        [[nodiscard]] u8* GetMutableData();
+
+        // Number of handles currently referencing the block (0 for an empty handle).
+        [[nodiscard]] u32 GetRefCount() const;
+
+        // Two handles share storage (not just equal bytes).
+        [[nodiscard]] bool SharesStorageWith(const InterZonePayload& other) const
+        {
+            return m_Block != nullptr && m_Block == other.m_Block;
+        }
+
+        struct PoolStats
+        {
+            u64 BlocksLive = 0;   // handed out and still referenced
+            u64 BlocksPooled = 0; // returned and waiting on a free list
+            u64 HeapFallbacks = 0; // payloads too large for any size class
+        };
+
+        [[nodiscard]] static PoolStats GetPoolStats();
+
+        // Return every pooled (unused) block to the heap.
+        static void TrimPool();
+
+        // Pooled block layout; opaque outside InterZonePayload.cpp.
+        struct BlockHeader;
+
+      private:
+        explicit InterZonePayload(BlockHeader* block)
+            : m_Block(block)
+        {
+        }
+
+        void Release();
+
+        BlockHeader* m_Block = nullptr;
+    };
+} // namespace OloEngine
@@ -75,6 +75,11 @@ namespace OloEngine
     void ZoneServer::SetMessageBus(InterZoneMessageBus* bus)
     {
         m_MessageBus = bus;
+        if (m_MessageBus)
+        {
+            // Broadcasts fan out to the zones the bus knows about at push time.
+            m_MessageBus->RegisterZone(m_Definition.ID);
+        }
     }
 
     bool ZoneServer::AddPlayer(u32 clientID)
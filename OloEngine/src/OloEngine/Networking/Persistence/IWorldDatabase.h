@@ -11,6 +11,34 @@
 
 namespace OloEngine
 {
+    // A group of writes applied together by IWorldDatabase::ApplyBatch. Each key
+    // appears at most once per batch, so the order of operations within it does
+    // not matter.
+    struct WorldDatabaseBatch
+    {
+        struct EntityWrite
+        {
+            u64 UUID = 0;
+            ZoneID Zone = 0;
+            std::vector<u8> Data;
+        };
+
+        std::vector<EntityWrite> EntityWrites;
+        std::vector<u64> EntityDeletes;
+        std::vector<std::pair<u32, PlayerStatePacket>> PlayerWrites;
+        std::vector<std::pair<std::string, std::string>> WorldStateWrites;
+
+        [[nodiscard]] sizet GetOperationCount() const
+        {
+            return EntityWrites.size() + EntityDeletes.size() + PlayerWrites.size() + WorldStateWrites.size();
+        }
+
+        [[nodiscard]] bool IsEmpty() const
+        {
+            return GetOperationCount() == 0;
+        }
+    };
+
     // Abstract database interface for persistent world state.
     // Implementations can use SQLite (local dev), PostgreSQL (production), etc.
     class IWorldDatabase
@@ -32,6 +60,47 @@ namespace OloEngine
         virtual bool SetWorldState(const std::string& key, const std::string& value) = 0;
         virtual bool GetWorldState(const std::string& key, std::string& outValue) = 0;
 
+        // Bulk write: one transaction in a real database. The default applies the
+        // operations one by one and stops at the first failure; implementations
+        // that can should apply all of it or none of it.
+        virtual bool ApplyBatch(const WorldDatabaseBatch& batch)
+        {
+            for (auto const& write : batch.EntityWrites)
+            {
+                if (!SaveEntityState(write.UUID, write.Zone, write.Data))
+                {
+                    return false;
+                }
+            }
+            for (u64 const uuid : batch.EntityDeletes)
+            {
+                // Deleting an entity that was never stored is not an error here
+                (void)DeleteEntityState(uuid);
+            }
+            for (auto const& [accountID, state] : batch.PlayerWrites)
+            {
+                if (!SavePlayerState(accountID, state))
+                {
+                    return false;
+                }
+            }
+            for (auto const& [key, value] : batch.WorldStateWrites)
+            {
+                if (!SetWorldState(key, value))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // Make everything applied so far durable. Stores without a durable medium
+        // have nothing to do.
+        virtual bool Flush()
+        {
+            return true;
+        }
+
         // Lifecycle
         virtual bool Initialize(const std::string& connectionString) = 0;
         virtual void Shutdown() = 0;
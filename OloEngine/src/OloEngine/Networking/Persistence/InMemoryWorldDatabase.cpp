@@ -108,6 +108,32 @@ namespace OloEngine
         return true;
     }
 
+    bool InMemoryWorldDatabase::ApplyBatch(const WorldDatabaseBatch& batch)
+    {
+        TUniqueLock<FMutex> lock(m_Mutex);
+        if (!m_Initialized)
+        {
+            return false;
+        }
+        for (auto const& write : batch.EntityWrites)
+        {
+            m_EntityStates[write.UUID] = { write.Zone, write.Data };
+        }
+        for (u64 const uuid : batch.EntityDeletes)
+        {
+            m_EntityStates.erase(uuid);
+        }
+        for (auto const& [accountID, state] : batch.PlayerWrites)
+        {
+            m_PlayerStates[accountID] = state;
+        }
+        for (auto const& [key, value] : batch.WorldStateWrites)
+        {
+            m_WorldState[key] = value;
+        }
+        return true;
+    }
+
     bool InMemoryWorldDatabase::Initialize([[maybe_unused]] const std::string& connectionString)
     {
         TUniqueLock<FMutex> lock(m_Mutex);
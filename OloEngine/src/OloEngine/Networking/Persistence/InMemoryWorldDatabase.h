@@ -28,6 +28,9 @@ namespace OloEngine
         bool SetWorldState(const std::string& key, const std::string& value) override;
         bool GetWorldState(const std::string& key, std::string& outValue) override;
 
+        // Applied under a single lock: readers see all of a batch or none of it.
+        bool ApplyBatch(const WorldDatabaseBatch& batch) override;
+
         bool Initialize(const std::string& connectionString) override;
         void Shutdown() override;
         [[nodiscard]] bool IsInitialized() const override;
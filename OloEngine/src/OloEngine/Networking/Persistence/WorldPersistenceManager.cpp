@@ -4,11 +4,33 @@
 
 namespace OloEngine
 {
-    void WorldPersistenceManager::Initialize(IWorldDatabase* database, f32 saveIntervalSeconds)
+    WorldPersistenceManager::~WorldPersistenceManager()
     {
+        // The writer's I/O thread must not outlive the database pointer it was given
+        if (m_Writer)
+        {
+            m_Writer->Stop();
+        }
+    }
+
+    void WorldPersistenceManager::Initialize(IWorldDatabase* database, f32 saveIntervalSeconds,
+                                             const WorldPersistenceWriterConfig& writerConfig)
+    {
+        if (m_Writer)
+        {
+            m_Writer->Stop();
+            m_Writer.reset();
+        }
+
         m_Database = database;
         m_SaveInterval = saveIntervalSeconds;
         m_TimeSinceLastSave = 0.0f;
+
+        if (m_Database && writerConfig.WriteBehind)
+        {
+            m_Writer = CreateScope<WorldPersistenceWriter>(*m_Database, writerConfig);
+            m_Writer->Start();
+        }
     }
 
     void WorldPersistenceManager::Shutdown()
@@ -17,6 +39,12 @@ namespace OloEngine
         {
             SaveAll();
         }
+        if (m_Writer)
+        {
+            // Stop() commits what is still queued as a final checkpoint
+            m_Writer->Stop();
+            m_Writer.reset();
+        }
         m_Database = nullptr;
         m_DirtyEntities.clear();
     }
@@ -64,7 +92,12 @@ namespace OloEngine
                 std::vector<u8> data;
                 if (m_DataProvider(uuid, zoneID, data))
                 {
-                    if (m_Database->SaveEntityState(uuid, zoneID, data))
+                    if (m_Writer)
+                    {
+                        m_Writer->SaveEntity(uuid, zoneID, std::move(data));
+                        saved.push_back(uuid);
+                    }
+                    else if (m_Database->SaveEntityState(uuid, zoneID, data))
                     {
                         saved.push_back(uuid);
                     }
@@ -80,6 +113,11 @@ namespace OloEngine
             m_DirtyEntities.clear();
         }
 
+        if (m_Writer)
+        {
+            m_Writer->RequestCheckpoint();
+        }
+
         m_TimeSinceLastSave = 0.0f;
     }
 
@@ -94,7 +132,15 @@ namespace OloEngine
         {
             return false;
         }
-        bool result = m_Database->SaveEntityState(uuid, zoneID, data);
+        bool result = true;
+        if (m_Writer)
+        {
+            m_Writer->SaveEntity(uuid, zoneID, data);
+        }
+        else
+        {
+            result = m_Database->SaveEntityState(uuid, zoneID, data);
+        }
         if (result)
         {
             m_DirtyEntities.erase(uuid);
@@ -102,12 +148,44 @@ namespace OloEngine
         return result;
     }
 
+    bool WorldPersistenceManager::DeleteEntity(u64 uuid)
+    {
+        if (!m_Database)
+        {
+            return false;
+        }
+        m_DirtyEntities.erase(uuid);
+        if (m_Writer)
+        {
+            m_Writer->DeleteEntity(uuid);
+            return true;
+        }
+        return m_Database->DeleteEntityState(uuid);
+    }
+
+    bool WorldPersistenceManager::Checkpoint()
+    {
+        if (!m_Database)
+        {
+            return false;
+        }
+        if (m_Writer)
+        {
+            return m_Writer->WaitForCheckpoint(m_Writer->RequestCheckpoint());
+        }
+        return m_Database->Flush();
+    }
+
     bool WorldPersistenceManager::LoadEntitiesForZone(ZoneID zoneID, std::vector<std::pair<u64, std::vector<u8>>>& outEntities)
     {
         if (!m_Database)
         {
             return false;
         }
+        if (m_Writer && !m_Writer->Flush())
+        {
+            OLO_CORE_WARN("[WorldPersistenceManager] Pending writes could not be applied before loading zone {}", zoneID);
+        }
         return m_Database->LoadEntitiesForZone(zoneID, outEntities);
     }
 
@@ -117,6 +195,11 @@ namespace OloEngine
         {
             return false;
         }
+        if (m_Writer)
+        {
+            m_Writer->SavePlayer(accountID, state);
+            return true;
+        }
         return m_Database->SavePlayerState(accountID, state);
     }
 
@@ -126,6 +209,10 @@ namespace OloEngine
         {
             return false;
         }
+        if (m_Writer && !m_Writer->Flush())
+        {
+            OLO_CORE_WARN("[WorldPersistenceManager] Pending writes could not be applied before loading player {}", accountID);
+        }
         return m_Database->LoadPlayerState(accountID, outState);
     }
 
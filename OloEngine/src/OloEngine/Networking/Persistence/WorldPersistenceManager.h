@@ -2,6 +2,7 @@
 
 #include "OloEngine/Core/Base.h"
 #include "OloEngine/Networking/Persistence/IWorldDatabase.h"
+#include "OloEngine/Networking/Persistence/WorldPersistenceWriter.h"
 
 #include <functional>
 #include <unordered_set>
@@ -14,12 +15,17 @@ namespace OloEngine
 
     // Periodically saves dirty entities to the world database.
     // Entities are marked dirty when their state changes, and saved at a configurable interval.
+    // By default writes go through a WorldPersistenceWriter: saves only queue the
+    // data and return, and loads first wait for what is queued to be applied.
     class WorldPersistenceManager
     {
       public:
         WorldPersistenceManager() = default;
+        ~WorldPersistenceManager();
 
-        void Initialize(IWorldDatabase* database, f32 saveIntervalSeconds = 300.0f);
+        void Initialize(IWorldDatabase* database, f32 saveIntervalSeconds = 300.0f,
+                        const WorldPersistenceWriterConfig& writerConfig = {});
+        // Saves the dirty entities and blocks until they are durable.
         void Shutdown();
 
         // Mark an entity as needing to be saved.
@@ -34,7 +40,8 @@ namespace OloEngine
         // Called each frame. Saves dirty entities when interval elapses.
         void Tick(f32 dt);
 
-        // Force save all dirty entities immediately.
+        // Force save all dirty entities immediately. With write-behind this queues
+        // them and requests a checkpoint.
         void SaveAll();
 
         // Set the callback that provides entity data for saving.
@@ -43,6 +50,12 @@ namespace OloEngine
         // Save a specific entity.
         bool SaveEntity(u64 uuid, ZoneID zoneID, const std::vector<u8>& data);
 
+        // Remove an entity's persisted state.
+        bool DeleteEntity(u64 uuid);
+
+        // Block until everything saved so far is durable in the database.
+        bool Checkpoint();
+
         // Load entities for a zone from the database.
         bool LoadEntitiesForZone(ZoneID zoneID, std::vector<std::pair<u64, std::vector<u8>>>& outEntities);
 
@@ -53,8 +66,15 @@ namespace OloEngine
         // Get save interval.
         [[nodiscard]] f32 GetSaveInterval() const;
 
+        // Null when write-behind is disabled.
+        [[nodiscard]] WorldPersistenceWriter* GetWriter() const
+        {
+            return m_Writer.get();
+        }
+
       private:
         IWorldDatabase* m_Database = nullptr;
+        Scope<WorldPersistenceWriter> m_Writer;
         EntityDataProvider m_DataProvider;
         f32 m_SaveInterval = 300.0f;
         f32 m_TimeSinceLastSave = 0.0f;
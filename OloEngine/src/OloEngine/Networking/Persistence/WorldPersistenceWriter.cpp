@@ -0,0 +1,409 @@
+#include "OloEnginePCH.h"
+#include "WorldPersistenceWriter.h"
+#include "OloEngine/Core/Log.h"
+#include "OloEngine/Threading/UniqueLock.h"
+
+#include <algorithm>
+
+namespace OloEngine
+{
+    WorldPersistenceWriter::WorldPersistenceWriter(IWorldDatabase& database, const WorldPersistenceWriterConfig& config)
+        : m_Database(database), m_Config(config)
+    {
+        m_Config.MaxBatchOperations = std::max(m_Config.MaxBatchOperations, 1u);
+        m_Config.MaxPendingOperations = std::max(m_Config.MaxPendingOperations, 1u);
+    }
+
+    WorldPersistenceWriter::~WorldPersistenceWriter()
+    {
+        Stop();
+    }
+
+    void WorldPersistenceWriter::Start()
+    {
+        std::scoped_lock lock(m_Mutex);
+        if (m_Running)
+        {
+            return;
+        }
+        m_Running = true;
+        m_StopRequested = false;
+        m_IOThread = FThread("WorldPersistenceIO", [this]()
+                             { IOThreadFunc(); });
+    }
+
+    void WorldPersistenceWriter::Stop()
+    {
+        {
+            std::scoped_lock lock(m_Mutex);
+            if (!m_Running)
+            {
+                return;
+            }
+            m_StopRequested = true;
+            m_RequestedCheckpoint = ++m_NextCheckpointId;
+        }
+        m_WorkCV.notify_all();
+
+        if (m_IOThread.IsJoinable())
+        {
+            m_IOThread.Join();
+        }
+
+        std::scoped_lock lock(m_Mutex);
+        m_Running = false;
+        if (sizet const lost = m_Pending.Size(); lost > 0)
+        {
+            OLO_CORE_ERROR("[WorldPersistenceWriter] Stopped with {} operations that could not be written", lost);
+        }
+        m_DoneCV.notify_all();
+    }
+
+    bool WorldPersistenceWriter::IsRunning() const
+    {
+        std::scoped_lock lock(m_Mutex);
+        return m_Running;
+    }
+
+    // ========================================================================
+    // Producers
+    // ========================================================================
+
+    void WorldPersistenceWriter::CountEnqueued(bool coalesced)
+    {
+        TUniqueLock<FMutex> statsLock(m_StatsMutex);
+        ++m_Stats.OperationsEnqueued;
+        if (coalesced)
+        {
+            ++m_Stats.OperationsCoalesced;
+        }
+    }
+
+    void WorldPersistenceWriter::WaitForRoom(std::unique_lock<std::mutex>& lock)
+    {
+        if (m_Running && !m_StopRequested && m_Pending.Size() >= m_Config.MaxPendingOperations)
+        {
+            {
+                TUniqueLock<FMutex> statsLock(m_StatsMutex);
+                ++m_Stats.BackPressureWaits;
+            }
+            m_WorkCV.notify_one();
+            m_DoneCV.wait(lock, [this]()
+                          { return !m_Running || m_StopRequested || m_Pending.Size() < m_Config.MaxPendingOperations; });
+        }
+        if (m_Pending.Size() == 0)
+        {
+            m_PendingSince = std::chrono::steady_clock::now();
+        }
+    }
+
+    void WorldPersistenceWriter::SaveEntity(u64 uuid, ZoneID zoneID, std::vector<u8> data)
+    {
+        std::unique_lock lock(m_Mutex);
+        auto it = m_Pending.Entities.find(uuid);
+        CountEnqueued(it != m_Pending.Entities.end());
+        if (it != m_Pending.Entities.end())
+        {
+            it->second = { zoneID, std::move(data), false };
+            return;
+        }
+        WaitForRoom(lock);
+        m_Pending.Entities[uuid] = { zoneID, std::move(data), false };
+    }
+
+    void WorldPersistenceWriter::DeleteEntity(u64 uuid)
+    {
+        std::unique_lock lock(m_Mutex);
+        auto it = m_Pending.Entities.find(uuid);
+        CountEnqueued(it != m_Pending.Entities.end());
+        if (it != m_Pending.Entities.end())
+        {
+            it->second = { 0, {}, true };
+            return;
+        }
+        WaitForRoom(lock);
+        m_Pending.Entities[uuid] = { 0, {}, true };
+    }
+
+    void WorldPersistenceWriter::SavePlayer(u32 accountID, const PlayerStatePacket& state)
+    {
+        std::unique_lock lock(m_Mutex);
+        auto it = m_Pending.Players.find(accountID);
+        CountEnqueued(it != m_Pending.Players.end());
+        if (it != m_Pending.Players.end())
+        {
+            it->second = state;
+            return;
+        }
+        WaitForRoom(lock);
+        m_Pending.Players[accountID] = state;
+    }
+
+    void WorldPersistenceWriter::SetWorldState(const std::string& key, const std::string& value)
+    {
+        std::unique_lock lock(m_Mutex);
+        auto it = m_Pending.WorldState.find(key);
+        CountEnqueued(it != m_Pending.WorldState.end());
+        if (it != m_Pending.WorldState.end())
+        {
+            it->second = value;
+            return;
+        }
+        WaitForRoom(lock);
+        m_Pending.WorldState[key] = value;
+    }
+
+    // ========================================================================
+    // Checkpoints and flushes
+    // ========================================================================
+
+    u64 WorldPersistenceWriter::RequestCheckpoint()
+    {
+        u64 id = 0;
+        {
+            std::scoped_lock lock(m_Mutex);
+            id = ++m_NextCheckpointId;
+            m_RequestedCheckpoint = id;
+        }
+        m_WorkCV.notify_one();
+        return id;
+    }
+
+    bool WorldPersistenceWriter::WaitForCheckpoint(u64 checkpointId)
+    {
+        std::unique_lock lock(m_Mutex);
+        m_DoneCV.wait(lock, [this, checkpointId]()
+                      { return !m_Running || m_CommittedCheckpoint >= checkpointId; });
+        return m_CommittedCheckpoint >= checkpointId;
+    }
+
+    u64 WorldPersistenceWriter::GetCommittedCheckpoint() const
+    {
+        std::scoped_lock lock(m_Mutex);
+        return m_CommittedCheckpoint;
+    }
+
+    bool WorldPersistenceWriter::Flush()
+    {
+        std::unique_lock lock(m_Mutex);
+        u64 const target = m_TakenSets + (m_Pending.Size() > 0 ? 1 : 0);
+        if (m_AppliedSets >= target)
+        {
+            return true;
+        }
+        if (!m_Running)
+        {
+            return false;
+        }
+
+        m_FlushRequested = true;
+        m_WorkCV.notify_one();
+        m_DoneCV.wait(lock, [this, target]()
+                      { return !m_Running || m_AppliedSets >= target; });
+        return m_AppliedSets >= target;
+    }
+
+    u32 WorldPersistenceWriter::GetPendingCount() const
+    {
+        std::scoped_lock lock(m_Mutex);
+        return static_cast<u32>(m_Pending.Size());
+    }
+
+    WorldPersistenceWriterStats WorldPersistenceWriter::GetStats() const
+    {
+        TUniqueLock<FMutex> statsLock(m_StatsMutex);
+        return m_Stats;
+    }
+
+    // ========================================================================
+    // I/O thread
+    // ========================================================================
+
+    void WorldPersistenceWriter::IOThreadFunc()
+    {
+        auto const window = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<f32>(m_Config.FlushWindowSeconds));
+
+        std::unique_lock lock(m_Mutex);
+        while (true)
+        {
+            auto ready = [this, window]()
+            {
+                return m_StopRequested || m_FlushRequested || m_RequestedCheckpoint > m_CommittedCheckpoint ||
+                       m_Pending.Size() >= m_Config.MaxBatchOperations ||
+                       (m_Pending.Size() > 0 && std::chrono::steady_clock::now() - m_PendingSince >= window);
+            };
+            while (!ready())
+            {
+                if (m_Pending.Size() == 0)
+                {
+                    m_WorkCV.wait(lock);
+                }
+                else
+                {
+                    m_WorkCV.wait_until(lock, m_PendingSince + window);
+                }
+            }
+
+            PendingSet set = std::move(m_Pending);
+            m_Pending = {};
+            auto const pendingSince = m_PendingSince;
+            u64 const setNumber = ++m_TakenSets;
+            u64 const checkpointId = m_RequestedCheckpoint > m_CommittedCheckpoint ? m_RequestedCheckpoint : 0;
+            bool const stopping = m_StopRequested;
+            m_FlushRequested = false;
+            m_DoneCV.notify_all(); // producers held back by a full pending set
+
+            lock.unlock();
+            bool const written = WritePendingSet(set, checkpointId);
+            lock.lock();
+
+            if (written)
+            {
+                m_AppliedSets = setNumber;
+                if (checkpointId != 0)
+                {
+                    m_CommittedCheckpoint = std::max(m_CommittedCheckpoint, checkpointId);
+                    TUniqueLock<FMutex> statsLock(m_StatsMutex);
+                    m_Stats.LastCheckpoint = m_CommittedCheckpoint;
+                }
+            }
+            else
+            {
+                // Anything queued since is newer and wins; the rest goes out
+                // with the next pending set.
+                bool const wasEmpty = m_Pending.Size() == 0;
+                Requeue(set);
+                if (wasEmpty)
+                {
+                    m_PendingSince = pendingSince;
+                }
+            }
+            m_DoneCV.notify_all();
+
+            if (stopping)
+            {
+                break;
+            }
+            if (!written)
+            {
+                // Back off for a window rather than hammering a failing database
+                m_WorkCV.wait_for(lock, window, [this]()
+                                  { return m_StopRequested; });
+            }
+        }
+    }
+
+    bool WorldPersistenceWriter::WritePendingSet(PendingSet& set, u64 checkpointId)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        std::vector<WorldDatabaseBatch> batches(1);
+        auto nextBatch = [this, &batches]() -> WorldDatabaseBatch&
+        {
+            if (batches.back().GetOperationCount() >= m_Config.MaxBatchOperations)
+            {
+                batches.emplace_back();
+            }
+            return batches.back();
+        };
+
+        for (auto& [uuid, entity] : set.Entities)
+        {
+            if (entity.Delete)
+            {
+                nextBatch().EntityDeletes.push_back(uuid);
+            }
+            else
+            {
+                nextBatch().EntityWrites.push_back({ uuid, entity.Zone, std::move(entity.Data) });
+            }
+        }
+        for (auto& [accountID, state] : set.Players)
+        {
+            nextBatch().PlayerWrites.emplace_back(accountID, state);
+        }
+        for (auto& [key, value] : set.WorldState)
+        {
+            nextBatch().WorldStateWrites.emplace_back(key, std::move(value));
+        }
+        set = {};
+
+        if (checkpointId != 0)
+        {
+            // In the last batch, so the marker lands together with the tail of the set.
+            batches.back().WorldStateWrites.emplace_back(kCheckpointKey, std::to_string(checkpointId));
+        }
+
+        for (sizet i = 0; i < batches.size(); ++i)
+        {
+            if (batches[i].IsEmpty())
+            {
+                continue;
+            }
+            if (!m_Database.ApplyBatch(batches[i]))
+            {
+                OLO_CORE_ERROR("[WorldPersistenceWriter] Batch of {} operations failed, retrying", batches[i].GetOperationCount());
+                {
+                    TUniqueLock<FMutex> statsLock(m_StatsMutex);
+                    ++m_Stats.BatchesFailed;
+                }
+                for (sizet j = i; j < batches.size(); ++j)
+                {
+                    for (auto& write : batches[j].EntityWrites)
+                    {
+                        set.Entities.try_emplace(write.UUID, PendingEntity{ write.Zone, std::move(write.Data), false });
+                    }
+                    for (u64 const uuid : batches[j].EntityDeletes)
+                    {
+                        set.Entities.try_emplace(uuid, PendingEntity{ 0, {}, true });
+                    }
+                    for (auto& [accountID, state] : batches[j].PlayerWrites)
+                    {
+                        set.Players.try_emplace(accountID, state);
+                    }
+                    for (auto& [key, value] : batches[j].WorldStateWrites)
+                    {
+                        if (key != kCheckpointKey)
+                        {
+                            set.WorldState.try_emplace(key, std::move(value));
+                        }
+                    }
+                }
+                return false;
+            }
+
+            TUniqueLock<FMutex> statsLock(m_StatsMutex);
+            ++m_Stats.BatchesCommitted;
+            m_Stats.OperationsCommitted += batches[i].GetOperationCount();
+        }
+
+        if (checkpointId != 0 && !m_Database.Flush())
+        {
+            // Every write is applied; only durability is missing. The checkpoint
+            // stays requested, so the next pass retries the flush.
+            OLO_CORE_ERROR("[WorldPersistenceWriter] Database flush for checkpoint {} failed", checkpointId);
+            TUniqueLock<FMutex> statsLock(m_StatsMutex);
+            ++m_Stats.BatchesFailed;
+            return false;
+        }
+
+        return true;
+    }
+
+    void WorldPersistenceWriter::Requeue(PendingSet& set)
+    {
+        for (auto& [uuid, entity] : set.Entities)
+        {
+            m_Pending.Entities.try_emplace(uuid, std::move(entity));
+        }
+        for (auto& [accountID, state] : set.Players)
+        {
+            m_Pending.Players.try_emplace(accountID, state);
+        }
+        for (auto& [key, value] : set.WorldState)
+        {
+            m_Pending.WorldState.try_emplace(key, std::move(value));
+        }
+    }
+} // namespace OloEngine
@@ -0,0 +1,151 @@
+#pragma once
+
+#include "OloEngine/Core/Base.h"
+#include "OloEngine/HAL/Thread.h"
+#include "OloEngine/Networking/Persistence/IWorldDatabase.h"
+#include "OloEngine/Threading/Mutex.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace OloEngine
+{
+    struct WorldPersistenceWriterConfig
+    {
+        // False: WorldPersistenceManager calls the database directly, on the
+        // calling thread, and no writer is created.
+        bool WriteBehind = true;
+        // How long a write may sit in memory before the I/O thread picks it up.
+        // Writes to the same key inside the window replace each other.
+        f32 FlushWindowSeconds = 0.25f;
+        // Operations per ApplyBatch call.
+        u32 MaxBatchOperations = 512;
+        // Distinct pending keys past which a write that adds another key blocks
+        // until the I/O thread has taken the pending set.
+        u32 MaxPendingOperations = 16384;
+    };
+
+    struct WorldPersistenceWriterStats
+    {
+        u64 OperationsEnqueued = 0;
+        u64 OperationsCoalesced = 0; // replaced an earlier pending write to the same key
+        u64 OperationsCommitted = 0;
+        u64 BatchesCommitted = 0;
+        u64 BatchesFailed = 0;
+        u64 BackPressureWaits = 0;
+        u64 LastCheckpoint = 0;
+    };
+
+    // Write-behind front end of an IWorldDatabase. The tick thread only records
+    // the latest value per key; a dedicated I/O thread drains the pending set
+    // every flush window and writes it out in ApplyBatch transactions, so a slow
+    // database costs the tick thread nothing until the pending set is full.
+    //
+    // Checkpoints are the crash-consistency points. The pending set taken for a
+    // checkpoint is written with the checkpoint id under kCheckpointKey in its
+    // last batch, and the database is flushed (made durable) only then — never
+    // in the middle of a pending set. A store whose durability point is Flush()
+    // (SaveFileWorldDatabase) therefore always holds exactly the state of its
+    // last committed checkpoint.
+    class WorldPersistenceWriter
+    {
+      public:
+        // World-state key that records the id of the last committed checkpoint.
+        static constexpr const char* kCheckpointKey = "__persistence.checkpoint";
+
+        explicit WorldPersistenceWriter(IWorldDatabase& database, const WorldPersistenceWriterConfig& config = {});
+        ~WorldPersistenceWriter();
+
+        WorldPersistenceWriter(const WorldPersistenceWriter&) = delete;
+        WorldPersistenceWriter& operator=(const WorldPersistenceWriter&) = delete;
+
+        void Start();
+        // Write out everything still pending as a final checkpoint, then join the
+        // I/O thread.
+        void Stop();
+
+        [[nodiscard]] bool IsRunning() const;
+
+        // Queue writes. Return immediately unless back-pressure applies.
+        void SaveEntity(u64 uuid, ZoneID zoneID, std::vector<u8> data);
+        void DeleteEntity(u64 uuid);
+        void SavePlayer(u32 accountID, const PlayerStatePacket& state);
+        void SetWorldState(const std::string& key, const std::string& value);
+
+        // Ask for everything queued so far to be committed as a checkpoint.
+        // Returns its id; see GetCommittedCheckpoint() / WaitForCheckpoint().
+        u64 RequestCheckpoint();
+        // False if the writer stopped before the checkpoint could be committed.
+        bool WaitForCheckpoint(u64 checkpointId);
+        [[nodiscard]] u64 GetCommittedCheckpoint() const;
+
+        // Block until everything queued so far has been applied to the database
+        // (not necessarily flushed). What reads go through, for read-your-writes.
+        bool Flush();
+
+        [[nodiscard]] u32 GetPendingCount() const;
+        [[nodiscard]] WorldPersistenceWriterStats GetStats() const;
+
+      private:
+        struct PendingEntity
+        {
+            ZoneID Zone = 0;
+            std::vector<u8> Data;
+            bool Delete = false;
+        };
+
+        // Everything queued since the I/O thread last took the pending set.
+        struct PendingSet
+        {
+            std::unordered_map<u64, PendingEntity> Entities;
+            std::unordered_map<u32, PlayerStatePacket> Players;
+            std::unordered_map<std::string, std::string> WorldState;
+
+            [[nodiscard]] sizet Size() const
+            {
+                return Entities.size() + Players.size() + WorldState.size();
+            }
+        };
+
+        void IOThreadFunc();
+        void CountEnqueued(bool coalesced);
+        // Call with m_Mutex held. Blocks while the pending set is full.
+        void WaitForRoom(std::unique_lock<std::mutex>& lock);
+        // I/O thread. False if a batch or the checkpoint flush failed; what was not
+        // written is left in `set` for Requeue().
+        bool WritePendingSet(PendingSet& set, u64 checkpointId);
+        // Call with m_Mutex held. Merges `set` back under anything queued since.
+        void Requeue(PendingSet& set);
+
+      private:
+        IWorldDatabase& m_Database;
+        WorldPersistenceWriterConfig m_Config;
+
+        FThread m_IOThread;
+        // The condition variables need a std::mutex; everything they wait on lives under it
+        mutable std::mutex m_Mutex;
+        std::condition_variable m_WorkCV; // wakes the I/O thread
+        std::condition_variable m_DoneCV; // wakes producers and waiters
+
+        // Guarded by m_StatsMutex, taken on its own or inside m_Mutex
+        mutable FMutex m_StatsMutex;
+        WorldPersistenceWriterStats m_Stats;
+
+        // All below guarded by m_Mutex
+        bool m_Running = false;
+        bool m_StopRequested = false;
+        PendingSet m_Pending;
+        std::chrono::steady_clock::time_point m_PendingSince;
+        // Pending sets are numbered in the order the I/O thread takes them.
+        u64 m_TakenSets = 0;
+        u64 m_AppliedSets = 0;
+        bool m_FlushRequested = false;
+        u64 m_NextCheckpointId = 0;
+        u64 m_RequestedCheckpoint = 0;
+        u64 m_CommittedCheckpoint = 0;
+    };
+} // namespace OloEngine
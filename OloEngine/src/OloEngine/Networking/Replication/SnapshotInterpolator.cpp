@@ -44,12 +44,19 @@ namespace OloEngine
         }
     }
 
-    void SnapshotInterpolator::Interpolate(Scene& scene, [[maybe_unused]] f32 dt)
+    void SnapshotInterpolator::Interpolate(Scene& scene, f32 dt)
     {
         OLO_PROFILE_FUNCTION();
 
+        ++m_Stats.Frames;
+        UpdateStallTracking(dt);
+
         if (m_Buffer.Size() < 2)
         {
+            if (m_Buffer.Size() != 0)
+            {
+                ++m_Stats.StarvedFrames;
+            }
             return;
         }
 
@@ -71,6 +78,7 @@ namespace OloEngine
         auto bracket = m_Buffer.GetBracketingEntries(renderTickFloor);
         if (!bracket.has_value())
         {
+            ++m_Stats.StarvedFrames;
             return;
         }
 
@@ -162,6 +170,38 @@ namespace OloEngine
         }
     }
 
+    void SnapshotInterpolator::UpdateStallTracking(f32 dt)
+    {
+        // Nothing received yet is "not started", not a stall.
+        if (m_LatestReceivedTick == 0 || !std::isfinite(dt) || dt < 0.0f)
+        {
+            return;
+        }
+
+        if (m_LatestReceivedTick != m_StallTrackedTick)
+        {
+            m_StallTrackedTick = m_LatestReceivedTick;
+            m_TimeSinceNewSnapshot = 0.0f;
+            m_InStall = false;
+            return;
+        }
+
+        m_TimeSinceNewSnapshot += dt;
+        f32 const interval = m_ServerTickRate > 0 ? 1.0f / static_cast<f32>(m_ServerTickRate) : 0.0f;
+        if (m_TimeSinceNewSnapshot <= kStallSnapshotIntervals * interval)
+        {
+            return;
+        }
+
+        if (!m_InStall)
+        {
+            m_InStall = true;
+            ++m_Stats.Stalls;
+        }
+        m_Stats.StalledSeconds += dt;
+        m_Stats.LongestStallSeconds = std::max(m_Stats.LongestStallSeconds, m_TimeSinceNewSnapshot);
+    }
+
     void SnapshotInterpolator::SetRenderDelay(f32 seconds)
     {
         // Render delay feeds the tick math in Interpolate()/GetRenderTick(); a
@@ -212,10 +252,23 @@ namespace OloEngine
         return m_Buffer;
     }
 
+    const SnapshotInterpolator::Stats& SnapshotInterpolator::GetStats() const
+    {
+        return m_Stats;
+    }
+
+    void SnapshotInterpolator::ResetStats()
+    {
+        m_Stats = {};
+    }
+
     void SnapshotInterpolator::Reset()
     {
         m_Buffer.Clear();
         m_LatestReceivedTick = 0;
+        m_StallTrackedTick = 0;
+        m_TimeSinceNewSnapshot = 0.0f;
+        m_InStall = false;
         m_CachedBeforeTick = UINT32_MAX;
         m_CachedAfterTick = UINT32_MAX;
         m_CachedBefore.clear();
@@ -16,6 +16,24 @@ namespace OloEngine
     class SnapshotInterpolator
     {
       public:
+        // What the client actually experienced, as opposed to what the server
+        // sent. Accumulated by Interpolate(); cleared only by ResetStats().
+        struct Stats
+        {
+            u64 Frames = 0;
+            // Frames that had snapshot data but nothing to interpolate between
+            // (fewer than two buffered, or the render tick fell outside them).
+            u64 StarvedFrames = 0;
+            // A stall is a stretch with no newer snapshot for longer than
+            // kStallSnapshotIntervals snapshot intervals — the point at which
+            // remote entities visibly freeze.
+            u32 Stalls = 0;
+            f32 StalledSeconds = 0.0f;
+            f32 LongestStallSeconds = 0.0f;
+        };
+
+        static constexpr f32 kStallSnapshotIntervals = 2.0f;
+
         explicit SnapshotInterpolator(u32 bufferCapacity = SnapshotBuffer::kDefaultCapacity);
 
         // Feed a new server snapshot into the buffer.
@@ -55,18 +73,29 @@ namespace OloEngine
 
         [[nodiscard]] const SnapshotBuffer& GetBuffer() const;
 
+        [[nodiscard]] const Stats& GetStats() const;
+        void ResetStats();
+
         // Drop all buffered/cached snapshot state (render delay and tick-rate
         // configuration are left untouched). Call on reconnect so a new session
         // never interpolates against the previous session's snapshots.
         void Reset();
 
       private:
+        // Advance the stall clock by `dt`; called once per Interpolate().
+        void UpdateStallTracking(f32 dt);
+
         SnapshotBuffer m_Buffer;
         f32 m_RenderDelay = 0.1f;  // seconds behind latest tick
         u32 m_ServerTickRate = 20; // ticks per second
         u32 m_LatestReceivedTick = 0;
         u32 m_LocalClientID = 0;
 
+        Stats m_Stats;
+        u32 m_StallTrackedTick = 0;      // latest tick seen by the stall clock
+        f32 m_TimeSinceNewSnapshot = 0.0f;
+        bool m_InStall = false;
+
         // Parsed snapshot cache to avoid re-parsing every frame. Each entry is a
         // UUID → per-component byte-blob map (the registry-driven snapshot format).
         u32 m_CachedBeforeTick = UINT32_MAX;
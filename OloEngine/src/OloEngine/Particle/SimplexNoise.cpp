@@ -1,8 +1,17 @@
 #include "OloEnginePCH.h"
 #include "SimplexNoise.h"
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 
+#if defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define OLO_SIMPLEX_HAS_SSE2 1
+#include <emmintrin.h>
+#else
+#define OLO_SIMPLEX_HAS_SSE2 0
+#endif
+
 namespace OloEngine
 {
     // Permutation table (duplicated for overflow safety)
@@ -199,4 +208,159 @@ namespace OloEngine
         // Scale result to [-1, 1]
         return 32.0f * (n0 + n1 + n2 + n3);
     }
+
+#if OLO_SIMPLEX_HAS_SSE2
+    // s_Perm[i] % 12, so the batched path's gradient lookup skips the modulo.
+    static constexpr auto s_PermMod12 = []
+    {
+        std::array<u8, 512> table{};
+        for (u32 i = 0; i < 512; ++i)
+            table[i] = static_cast<u8>(s_Perm[i] % 12);
+        return table;
+    }();
+
+    // Four points of SimplexNoise3D in SSE registers. The arithmetic is the
+    // scalar function's, operation for operation, so the results match it
+    // exactly unless the compiler fused a multiply-add in the scalar build.
+    // The simplex-ordering decision tree becomes lane masks and the falloff
+    // cut-off a select; only the permutation hashes run per lane.
+    static void SimplexNoise3DSSE(const f32* px, const f32* py, const f32* pz, f32* out)
+    {
+        const __m128 F3 = _mm_set1_ps(1.0f / 3.0f);
+        const __m128 G3 = _mm_set1_ps(1.0f / 6.0f);
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128i allOnes = _mm_set1_epi32(-1);
+
+        const __m128 x = _mm_loadu_ps(px);
+        const __m128 y = _mm_loadu_ps(py);
+        const __m128 z = _mm_loadu_ps(pz);
+
+        const auto fastFloor = [](__m128 v)
+        {
+            // Truncate, then step down where truncation rounded up (v < 0).
+            const __m128i truncated = _mm_cvttps_epi32(v);
+            const __m128 roundedUp = _mm_cmplt_ps(v, _mm_cvtepi32_ps(truncated));
+            return _mm_add_epi32(truncated, _mm_castps_si128(roundedUp));
+        };
+
+        // Skew input space to determine simplex cell
+        const __m128 s = _mm_mul_ps(_mm_add_ps(_mm_add_ps(x, y), z), F3);
+        const __m128i i = fastFloor(_mm_add_ps(x, s));
+        const __m128i j = fastFloor(_mm_add_ps(y, s));
+        const __m128i k = fastFloor(_mm_add_ps(z, s));
+
+        // Distances from cell origin
+        const __m128 t = _mm_mul_ps(_mm_cvtepi32_ps(_mm_add_epi32(_mm_add_epi32(i, j), k)), G3);
+        const __m128 x0 = _mm_sub_ps(x, _mm_sub_ps(_mm_cvtepi32_ps(i), t));
+        const __m128 y0 = _mm_sub_ps(y, _mm_sub_ps(_mm_cvtepi32_ps(j), t));
+        const __m128 z0 = _mm_sub_ps(z, _mm_sub_ps(_mm_cvtepi32_ps(k), t));
+
+        // Determine which simplex we're in, as all-ones lane masks
+        const __m128i xy = _mm_castps_si128(_mm_cmpge_ps(x0, y0));
+        const __m128i yz = _mm_castps_si128(_mm_cmpge_ps(y0, z0));
+        const __m128i xz = _mm_castps_si128(_mm_cmpge_ps(x0, z0));
+        const __m128i i1 = _mm_and_si128(xy, xz);
+        const __m128i j1 = _mm_andnot_si128(xy, yz);
+        const __m128i k1 = _mm_or_si128(_mm_andnot_si128(xz, xy), _mm_andnot_si128(_mm_or_si128(xy, yz), allOnes));
+        const __m128i i2 = _mm_or_si128(xy, _mm_and_si128(yz, xz));
+        const __m128i j2 = _mm_or_si128(_mm_andnot_si128(xy, allOnes), yz);
+        const __m128i k2 = _mm_andnot_si128(_mm_and_si128(yz, _mm_or_si128(xy, xz)), allOnes);
+
+        // Hash coordinates of the four simplex corners into gradients
+        alignas(16) i32 ci[4], cj[4], ck[4];
+        alignas(16) i32 oi1[4], oj1[4], ok1[4], oi2[4], oj2[4], ok2[4];
+        const __m128i mask255 = _mm_set1_epi32(255);
+        _mm_store_si128(reinterpret_cast<__m128i*>(ci), _mm_and_si128(i, mask255));
+        _mm_store_si128(reinterpret_cast<__m128i*>(cj), _mm_and_si128(j, mask255));
+        _mm_store_si128(reinterpret_cast<__m128i*>(ck), _mm_and_si128(k, mask255));
+        _mm_store_si128(reinterpret_cast<__m128i*>(oi1), i1);
+        _mm_store_si128(reinterpret_cast<__m128i*>(oj1), j1);
+        _mm_store_si128(reinterpret_cast<__m128i*>(ok1), k1);
+        _mm_store_si128(reinterpret_cast<__m128i*>(oi2), i2);
+        _mm_store_si128(reinterpret_cast<__m128i*>(oj2), j2);
+        _mm_store_si128(reinterpret_cast<__m128i*>(ok2), k2);
+
+        alignas(16) f32 grad[4][3][4];
+        for (u32 l = 0; l < 4; ++l)
+        {
+            const i32 ii = ci[l];
+            const i32 jj = cj[l];
+            const i32 kk = ck[l];
+            // Masks are 0 or -1; the offsets are 0 or 1.
+            const i32 gi[4] = {
+                s_PermMod12[ii + s_Perm[jj + s_Perm[kk]]],
+                s_PermMod12[ii - oi1[l] + s_Perm[jj - oj1[l] + s_Perm[kk - ok1[l]]]],
+                s_PermMod12[ii - oi2[l] + s_Perm[jj - oj2[l] + s_Perm[kk - ok2[l]]]],
+                s_PermMod12[ii + 1 + s_Perm[jj + 1 + s_Perm[kk + 1]]],
+            };
+            for (u32 c = 0; c < 4; ++c)
+            {
+                grad[c][0][l] = s_Grad3[gi[c]][0];
+                grad[c][1][l] = s_Grad3[gi[c]][1];
+                grad[c][2][l] = s_Grad3[gi[c]][2];
+            }
+        }
+
+        const auto corner = [&grad](u32 c, __m128 cx, __m128 cy, __m128 cz)
+        {
+            const __m128 t0 = _mm_sub_ps(_mm_sub_ps(_mm_sub_ps(_mm_set1_ps(0.6f), _mm_mul_ps(cx, cx)), _mm_mul_ps(cy, cy)), _mm_mul_ps(cz, cz));
+            const __m128 t2 = _mm_mul_ps(t0, t0);
+            const __m128 dot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_load_ps(grad[c][0]), cx), _mm_mul_ps(_mm_load_ps(grad[c][1]), cy)),
+                                          _mm_mul_ps(_mm_load_ps(grad[c][2]), cz));
+            return _mm_and_ps(_mm_cmpnlt_ps(t0, _mm_setzero_ps()), _mm_mul_ps(_mm_mul_ps(t2, t2), dot));
+        };
+
+        const __m128 x1 = _mm_add_ps(_mm_sub_ps(x0, _mm_and_ps(_mm_castsi128_ps(i1), one)), G3);
+        const __m128 y1 = _mm_add_ps(_mm_sub_ps(y0, _mm_and_ps(_mm_castsi128_ps(j1), one)), G3);
+        const __m128 z1 = _mm_add_ps(_mm_sub_ps(z0, _mm_and_ps(_mm_castsi128_ps(k1), one)), G3);
+        const __m128 twoG3 = _mm_set1_ps(2.0f * (1.0f / 6.0f));
+        const __m128 x2 = _mm_add_ps(_mm_sub_ps(x0, _mm_and_ps(_mm_castsi128_ps(i2), one)), twoG3);
+        const __m128 y2 = _mm_add_ps(_mm_sub_ps(y0, _mm_and_ps(_mm_castsi128_ps(j2), one)), twoG3);
+        const __m128 z2 = _mm_add_ps(_mm_sub_ps(z0, _mm_and_ps(_mm_castsi128_ps(k2), one)), twoG3);
+        const __m128 threeG3 = _mm_set1_ps(3.0f * (1.0f / 6.0f));
+        const __m128 x3 = _mm_add_ps(_mm_sub_ps(x0, one), threeG3);
+        const __m128 y3 = _mm_add_ps(_mm_sub_ps(y0, one), threeG3);
+        const __m128 z3 = _mm_add_ps(_mm_sub_ps(z0, one), threeG3);
+
+        __m128 n = corner(0, x0, y0, z0);
+        n = _mm_add_ps(n, corner(1, x1, y1, z1));
+        n = _mm_add_ps(n, corner(2, x2, y2, z2));
+        n = _mm_add_ps(n, corner(3, x3, y3, z3));
+
+        // Scale result to [-1, 1]
+        _mm_storeu_ps(out, _mm_mul_ps(_mm_set1_ps(32.0f), n));
+    }
+#endif
+
+    void SimplexNoise3D(const f32* x, const f32* y, const f32* z, f32* out, sizet count)
+    {
+        sizet base = 0;
+#if OLO_SIMPLEX_HAS_SSE2
+        static_assert(kSimplexNoiseLanes % 4 == 0);
+        for (; base + kSimplexNoiseLanes <= count; base += kSimplexNoiseLanes)
+        {
+            for (u32 half = 0; half < kSimplexNoiseLanes; half += 4)
+                SimplexNoise3DSSE(x + base + half, y + base + half, z + base + half, out + base + half);
+        }
+        if (base == count)
+            return;
+
+        // Pad the tail to a full block, so every point takes the same path
+        // whatever block it lands in.
+        f32 tailX[kSimplexNoiseLanes] = {};
+        f32 tailY[kSimplexNoiseLanes] = {};
+        f32 tailZ[kSimplexNoiseLanes] = {};
+        f32 tailOut[kSimplexNoiseLanes];
+        const sizet tail = count - base;
+        std::copy_n(x + base, tail, tailX);
+        std::copy_n(y + base, tail, tailY);
+        std::copy_n(z + base, tail, tailZ);
+        for (u32 half = 0; half < kSimplexNoiseLanes; half += 4)
+            SimplexNoise3DSSE(tailX + half, tailY + half, tailZ + half, tailOut + half);
+        std::copy_n(tailOut, tail, out + base);
+#else
+        for (; base < count; ++base)
+            out[base] = SimplexNoise3D(x[base], y[base], z[base]);
+#endif
+    }
 } // namespace OloEngine
@@ -14,4 +14,15 @@ namespace OloEngine
     {
         return SimplexNoise3D(v.x, v.y, v.z);
     }
+
+    // Points per block of the batched overload below.
+    inline constexpr u32 kSimplexNoiseLanes = 8;
+
+    // Batched SimplexNoise3D: out[i] = SimplexNoise3D(x[i], y[i], z[i]) for
+    // i < count, evaluated kSimplexNoiseLanes points at a time in SSE
+    // registers (a short tail is padded to a full block). The arithmetic is
+    // the scalar call's, so results are identical unless the compiler fused
+    // multiply-adds in the scalar build. Targets without SSE2 loop the
+    // scalar call.
+    void SimplexNoise3D(const f32* x, const f32* y, const f32* z, f32* out, sizet count);
 } // namespace OloEngine
@@ -11,6 +11,7 @@
 #include "OloEngine/Scripting/VisualScript/VisualScriptSystem.h"
 #include "OloEngine/Scene/Components.h"
 #include "OloEngine/Gameplay/GameplayEventBus.h"
+#include "OloEngine/Task/ParallelFor.h"
 #include "OloEngine/Animation/AnimatedMeshComponents.h" // SkeletonComponent (ragdoll skeleton resolution)
 #include "OloEngine/Animation/BoneEntityUtils.h"        // FindBoneEntityIds (ragdoll bone -> entity mapping)
 
@@ -1088,6 +1089,21 @@ namespace OloEngine
         return true;
     }
 
+    void JoltScene::CastRays(std::span<const RayCastInfo> rays, std::span<SceneQueryHit> outHits)
+    {
+        OLO_PROFILE_FUNCTION();
+        OLO_CORE_ASSERT(outHits.size() >= rays.size(), "CastRays: fewer hit slots than rays");
+
+        // CastRay leaves the hit untouched when there is no physics system.
+        for (sizet i = 0; i < rays.size(); ++i)
+            outHits[i].Clear();
+        if (!m_JoltSystem)
+            return;
+
+        ParallelFor("JoltScene::CastRays", static_cast<i32>(rays.size()), 16, [this, rays, outHits](i32 index)
+                    { CastRay(rays[index], outHits[index]); });
+    }
+
     bool JoltScene::CastShape(const ShapeCastInfo& shapeCastInfo, SceneQueryHit& outHit)
     {
         switch (shapeCastInfo.GetCastType())
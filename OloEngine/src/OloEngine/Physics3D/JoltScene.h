@@ -27,6 +27,7 @@
 #include <Jolt/Physics/SoftBody/SoftBodySharedSettings.h>
 
 #include <memory>
+#include <span>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -360,6 +361,11 @@ namespace OloEngine
         i32 CastSphereMultiple(const SphereCastInfo& sphereCastInfo, SceneQueryHit* outHits, i32 maxHits) override;
         i32 CastCapsuleMultiple(const CapsuleCastInfo& capsuleCastInfo, SceneQueryHit* outHits, i32 maxHits) override;
 
+        // Batched closest-hit ray casts: outHits[i] receives what CastRay(rays[i])
+        // would. Narrow-phase queries only read the broad phase, so the batch is
+        // spread over the task workers — call it only while no step is in flight.
+        void CastRays(std::span<const RayCastInfo> rays, std::span<SceneQueryHit> outHits);
+
         // Radial impulse
         void AddRadialImpulse(const glm::vec3& origin, f32 radius, f32 strength, EFalloffMode falloff, bool velocityChange);
 
@@ -2,6 +2,7 @@
 #include "OloEngine/Physics3D/MeshCookingFactory.h"
 #include "OloEngine/Physics3D/JoltUtils.h"
 #include "OloEngine/Physics3D/JoltBinaryStream.h"
+#include "OloEngine/Asset/DerivedDataCache.h"
 #include "OloEngine/Core/Application.h"
 #include "OloEngine/Core/Log.h"
 #include "OloEngine/Asset/AssetManager.h"
@@ -25,11 +26,57 @@
 
 #include <fstream>
 #include <algorithm>
+#include <iterator>
+#include <random>
 #include <unordered_set>
 #include <unordered_map>
 
 namespace OloEngine
 {
+    namespace
+    {
+        // Derived-data cache key version for cooked colliders. Bump when the cook or the
+        // .omc layout changes its output for the same geometry and settings.
+        constexpr u32 s_ColliderDerivedDataVersion = 1;
+
+        std::vector<u8> ReadFileBytes(const std::filesystem::path& path)
+        {
+            std::ifstream file(path, std::ios::binary);
+            if (!file)
+            {
+                return {};
+            }
+            return { std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+        }
+
+        // Temp file + rename, so a crash or a second process cooking the same collider
+        // never leaves a torn .omc where the existence check would accept it.
+        bool WriteFileAtomically(const std::filesystem::path& path, std::span<const u8> bytes)
+        {
+            std::random_device rd;
+            std::filesystem::path tempPath = path;
+            tempPath += fmt::format(".{:08x}{:08x}.tmp", rd(), rd());
+            {
+                std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+                file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+                if (!file)
+                {
+                    file.close();
+                    std::error_code ec;
+                    std::filesystem::remove(tempPath, ec);
+                    return false;
+                }
+            }
+            std::error_code ec;
+            std::filesystem::rename(tempPath, path, ec);
+            if (ec)
+            {
+                std::filesystem::remove(tempPath, ec);
+                return false;
+            }
+            return true;
+        }
+    } // namespace
 
     MeshCookingFactory::MeshCookingFactory(const std::filesystem::path& cacheDirectory)
         : m_CacheDirectory(cacheDirectory)
@@ -155,6 +202,38 @@ namespace OloEngine
             return ECookingResult::SourceDataInvalid;
         }
 
+        // The .omc above is keyed by asset handle and trusted by mtime; the derived-data
+        // cache is keyed by what the cook actually reads, so the same geometry cooked on
+        // another branch, in another project or under another handle is reused as is.
+        DerivedDataKey derivedDataKey;
+        DerivedDataCache& derivedDataCache = DerivedDataCache::Get();
+        const bool useDerivedDataCache = m_CacheAvailable && !cacheFilePath.empty() && derivedDataCache.IsEnabled();
+        if (useDerivedDataCache)
+        {
+            derivedDataKey = DerivedDataKeyBuilder("MeshCollider", s_ColliderDerivedDataVersion)
+                                 .AppendValue(static_cast<u32>(JPH_VERSION_MAJOR * 10000 + JPH_VERSION_MINOR * 100 + JPH_VERSION_PATCH))
+                                 .AppendMeshGeometry(*meshSource)
+                                 .AppendValue(static_cast<u32>(type))
+                                 .AppendValue(colliderAsset->m_ColliderScale.x)
+                                 .AppendValue(colliderAsset->m_ColliderScale.y)
+                                 .AppendValue(colliderAsset->m_ColliderScale.z)
+                                 .AppendValue(m_VertexWeldingEnabled)
+                                 .AppendValue(m_VertexWeldTolerance)
+                                 .AppendValue(m_MaxConvexHullVertices)
+                                 .AppendValue(m_MaxConvexRadius)
+                                 .AppendValue(m_AreaTestEpsilon)
+                                 .AppendValue(m_ConvexSimplificationRatio)
+                                 .Build();
+
+            if (std::vector<u8> cooked; derivedDataCache.Load(derivedDataKey, cooked) && WriteFileAtomically(cacheFilePath, cooked))
+            {
+                OLO_CORE_INFO("MeshCookingFactory: Restored {} mesh collider '{}' from the derived-data cache",
+                              type == EMeshColliderType::Triangle ? "triangle" : "convex", cacheFilePath.string());
+                ++m_CachedMeshCount;
+                return ECookingResult::Success;
+            }
+        }
+
         const auto& submeshes = meshSource->GetSubmeshes();
         for (i32 i = 0; i < submeshes.Num(); ++i)
         {
@@ -181,6 +260,10 @@ namespace OloEngine
                 // Don't return an error here - the cooking succeeded, just cache write failed
                 OLO_CORE_WARN("MeshCookingFactory: Cache write failed but cooking succeeded, continuing without cache");
             }
+            else if (useDerivedDataCache)
+            {
+                derivedDataCache.Store(derivedDataKey, ReadFileBytes(cacheFilePath));
+            }
         }
 
         // Update statistics
@@ -1,6 +1,7 @@
 #include "OloEnginePCH.h"
 #include "OloEngine/Renderer/Baking/LightmapBaker.h"
 
+#include "OloEngine/Core/Hash.h"
 #include "OloEngine/Renderer/Baking/LightmapUnwrap.h"
 #include "OloEngine/Renderer/AtlasAllocator.h"
 #include "OloEngine/Renderer/PathTracing/PathTracer.h"
@@ -12,6 +13,7 @@
 #include <bit>
 #include <cmath>
 #include <span>
+#include <unordered_map>
 #include <vector>
 
 namespace OloEngine
@@ -55,6 +57,32 @@ namespace OloEngine
             return area;
         }
 
+        // The settings that shape texel values. Two bakes agreeing on these
+        // (and on the scene) produce identical texels, so a chart may only be
+        // reused across bakes that agree.
+        [[nodiscard]] u64 HashTexelSettings(const LightmapBakeSettings& settings)
+        {
+            const u32 integers[] = { settings.AtlasSize, settings.MinRegionSize, settings.SamplesPerTexel,
+                                     settings.MaxBounces, settings.DilationPasses, settings.Seed };
+            u64 hash = Hash::FNV1a64(integers, sizeof(integers));
+            return Hash::FNV1a64(&settings.TexelsPerMeter, sizeof(settings.TexelsPerMeter), hash);
+        }
+
+        [[nodiscard]] bool BoundsOverlap(const BoundingBox& a, const BoundingBox& b)
+        {
+            return a.Min.x <= b.Max.x && b.Min.x <= a.Max.x &&
+                   a.Min.y <= b.Max.y && b.Min.y <= a.Max.y &&
+                   a.Min.z <= b.Max.z && b.Min.z <= a.Max.z;
+        }
+
+        [[nodiscard]] const LightmapBakeDependency* FindDependency(std::span<const LightmapBakeDependency> sorted, u64 id)
+        {
+            const auto it = std::lower_bound(sorted.begin(), sorted.end(), id,
+                                             [](const LightmapBakeDependency& d, u64 value)
+                                             { return d.Id < value; });
+            return (it != sorted.end() && it->Id == id) ? &*it : nullptr;
+        }
+
         [[nodiscard]] u32 CeilPow2(u32 v)
         {
             return v <= 1 ? 1u : std::bit_ceil(v);
@@ -431,6 +459,7 @@ namespace OloEngine
                                         static_cast<f32>(plan.Region.X) / atlasSizeF,
                                         static_cast<f32>(plan.Region.Y) / atlasSizeF);
 
+            const sizet firstJob = outPrepared.Jobs.size();
             RasterizeEntity(*input.Mesh, input.WorldTransform, scaleOffset, settings.AtlasSize,
                             outPrepared.Jobs, texelClaimed);
 
@@ -440,6 +469,9 @@ namespace OloEngine
             entry.ScaleOffset = scaleOffset;
             outPrepared.Entries.push_back(entry);
             outPrepared.Regions.push_back(LightmapAtlasRegion{ plan.Region.X, plan.Region.Y, plan.RegionSize });
+            outPrepared.Charts.push_back(LightmapChartJobs{ static_cast<u32>(firstJob),
+                                                            static_cast<u32>(outPrepared.Jobs.size() - firstJob),
+                                                            input.Mesh->GetBoundingBox().Transform(input.WorldTransform) });
             ++outPrepared.BakedEntityCount;
         }
 
@@ -453,6 +485,120 @@ namespace OloEngine
         return true;
     }
 
+    u32 LightmapBaker::PlanDependencies(LightmapBakePrepared& prepared,
+                                        std::span<const LightmapBakeDependency> sources,
+                                        const LightmapBakeSettings& settings,
+                                        const LightmapBakeRecord* previousRecord,
+                                        const Ref<LightmapAsset>& previousAsset)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        const sizet chartCount = prepared.Entries.size();
+        OLO_CORE_ASSERT(prepared.Charts.size() == chartCount && prepared.Regions.size() == chartCount,
+                        "LightmapBaker::PlanDependencies: prepared chart tables out of step");
+
+        LightmapBakeRecord& record = prepared.Record;
+        record = LightmapBakeRecord{};
+        record.SettingsHash = HashTexelSettings(settings);
+        record.Sources.assign(sources.begin(), sources.end());
+        std::sort(record.Sources.begin(), record.Sources.end(),
+                  [](const LightmapBakeDependency& a, const LightmapBakeDependency& b)
+                  { return a.Id < b.Id; });
+
+        // ── Who each chart depends on: every source when the radius is
+        // unbounded, else every source whose reach overlaps the chart's bounds
+        // grown by the radius, plus the chart's own entity ──
+        const bool unbounded = !(settings.DependencyRadius > 0.0f) || !std::isfinite(settings.DependencyRadius);
+        const glm::vec3 radius(unbounded ? 0.0f : settings.DependencyRadius);
+        record.Charts.resize(chartCount);
+        for (sizet c = 0; c < chartCount; ++c)
+        {
+            LightmapChartRecord& chart = record.Charts[c];
+            chart.EntityUUID = prepared.Entries[c].EntityUUID;
+            chart.X = prepared.Regions[c].X;
+            chart.Y = prepared.Regions[c].Y;
+            chart.Size = prepared.Regions[c].Size;
+
+            const BoundingBox& bounds = prepared.Charts[c].WorldBounds;
+            const BoundingBox reach(bounds.Min - radius, bounds.Max + radius);
+            for (const LightmapBakeDependency& source : record.Sources)
+            {
+                if (unbounded || source.Id == chart.EntityUUID || BoundsOverlap(reach, source.Bounds))
+                    chart.Dependencies.push_back(source.Id);
+            }
+        }
+
+        prepared.ReusedCharts.assign(chartCount, 0);
+        prepared.ReuseAsset = nullptr;
+
+        const bool comparable = previousRecord && !previousRecord->IsEmpty() && previousAsset &&
+                                previousRecord->SettingsHash == record.SettingsHash &&
+                                previousAsset->GetPageCount() == 1 &&
+                                previousAsset->GetWidth() == prepared.AtlasSize &&
+                                previousAsset->GetHeight() == prepared.AtlasSize &&
+                                previousAsset->GetTexelData().size() == previousAsset->GetExpectedTexelCount();
+        if (!comparable)
+            return static_cast<u32>(chartCount);
+
+        // ── What changed since the previous bake: sources added, removed, or
+        // with a different fingerprint or reach ──
+        std::vector<u64> changed;
+        for (const LightmapBakeDependency& source : record.Sources)
+        {
+            const LightmapBakeDependency* before = FindDependency(previousRecord->Sources, source.Id);
+            if (!before || before->Fingerprint != source.Fingerprint ||
+                before->Bounds.Min != source.Bounds.Min || before->Bounds.Max != source.Bounds.Max)
+                changed.push_back(source.Id);
+        }
+        for (const LightmapBakeDependency& before : previousRecord->Sources)
+        {
+            if (!FindDependency(record.Sources, before.Id))
+                changed.push_back(before.Id);
+        }
+        std::sort(changed.begin(), changed.end());
+
+        const auto touchesChange = [&](const std::vector<u64>& dependencies)
+        {
+            // Both lists are ascending.
+            auto d = dependencies.begin();
+            auto x = changed.begin();
+            while (d != dependencies.end() && x != changed.end())
+            {
+                if (*d == *x)
+                    return true;
+                if (*d < *x)
+                    ++d;
+                else
+                    ++x;
+            }
+            return false;
+        };
+
+        std::unordered_map<u64, const LightmapChartRecord*> previousCharts;
+        previousCharts.reserve(previousRecord->Charts.size());
+        for (const LightmapChartRecord& chart : previousRecord->Charts)
+            previousCharts.emplace(chart.EntityUUID, &chart);
+
+        // A chart is reused only when its region did not move and nothing it
+        // depended on before (the old position of a moved prop) or depends on
+        // now (its new position) changed.
+        u32 tracedCharts = 0;
+        for (sizet c = 0; c < chartCount; ++c)
+        {
+            const LightmapChartRecord& chart = record.Charts[c];
+            const auto it = previousCharts.find(chart.EntityUUID);
+            const bool reusable = it != previousCharts.end() &&
+                                  it->second->X == chart.X && it->second->Y == chart.Y && it->second->Size == chart.Size &&
+                                  !touchesChange(it->second->Dependencies) && !touchesChange(chart.Dependencies);
+            prepared.ReusedCharts[c] = reusable ? 1 : 0;
+            tracedCharts += reusable ? 0u : 1u;
+        }
+
+        if (tracedCharts < chartCount)
+            prepared.ReuseAsset = previousAsset;
+        return tracedCharts;
+    }
+
     LightmapBakeResult LightmapBaker::BakeTexels(const LightmapBakePrepared& prepared,
                                                  const PathTracing::ReferenceScene& world,
                                                  const LightmapBakeSettings& settings,
@@ -489,39 +635,111 @@ namespace OloEngine
         tracerSettings.MaxBounces = settings.MaxBounces;
         tracerSettings.RussianRouletteStartBounce = 0; // deterministic cost, lower variance (matches the DDGI parity fixtures)
         tracerSettings.Seed = settings.Seed;
+        tracerSettings.UseRayStreams = settings.UseRayStreams;
+
+        // Charts PlanDependencies marked reusable are not traced at all.
+        const bool reusing = prepared.ReuseAsset && prepared.ReusedCharts.size() == prepared.Charts.size();
+        std::vector<u32> tracedJobs;
+        if (reusing)
+        {
+            for (sizet c = 0; c < prepared.Charts.size(); ++c)
+            {
+                if (prepared.ReusedCharts[c] != 0)
+                {
+                    ++result.ReusedChartCount;
+                    continue;
+                }
+                const LightmapChartJobs& chart = prepared.Charts[c];
+                for (u32 j = chart.FirstJob; j < chart.FirstJob + chart.JobCount; ++j)
+                    tracedJobs.push_back(j);
+            }
+        }
+        const sizet jobCount = reusing ? tracedJobs.size() : prepared.Jobs.size();
+        const auto jobAt = [&](sizet i) -> const LightmapTexelJob&
+        {
+            return prepared.Jobs[reusing ? tracedJobs[i] : i];
+        };
 
         std::atomic<sizet> jobsDone{ 0 };
         std::atomic<bool> sawCancel{ false };
 
-        ParallelFor(
-            "LightmapBaker::BakeTexels",
-            static_cast<i32>(prepared.Jobs.size()),
-            16, // MinBatchSize: each job is SamplesPerTexel full paths
-            [&](i32 jobIndex)
-            {
-                if (sawCancel.load(std::memory_order_relaxed))
-                    return;
-                if (IsCancelled(cancelToken))
+        const auto storeTexel = [&](const LightmapTexelJob& job, const glm::vec3& irradiance)
+        {
+            const sizet t = (static_cast<sizet>(job.AtlasY) * prepared.AtlasSize + job.AtlasX) * 4;
+            texels[t + 0] = irradiance.x;
+            texels[t + 1] = irradiance.y;
+            texels[t + 2] = irradiance.z;
+            texels[t + 3] = 1.0f;
+        };
+
+        if (settings.UseRayStreams)
+        {
+            // One ray stream per tile of consecutive jobs. The tiling is fixed
+            // by job index (not by how ParallelFor batches), and every texel's
+            // value is independent of its tile-mates anyway.
+            const i32 tileCount = static_cast<i32>((jobCount + s_RayStreamTileTexels - 1) / s_RayStreamTileTexels);
+            ParallelFor(
+                "LightmapBaker::BakeTexels",
+                tileCount,
+                1, // MinBatchSize: each tile is s_RayStreamTileTexels * SamplesPerTexel full paths
+                [&](i32 tileIndex)
                 {
-                    sawCancel.store(true, std::memory_order_relaxed);
-                    return;
-                }
+                    if (sawCancel.load(std::memory_order_relaxed))
+                        return;
+                    if (IsCancelled(cancelToken))
+                    {
+                        sawCancel.store(true, std::memory_order_relaxed);
+                        return;
+                    }
 
-                const LightmapTexelJob& job = prepared.Jobs[static_cast<sizet>(jobIndex)];
-                const u32 texelSeed = PathTracing::MakePixelSeed(job.AtlasX, job.AtlasY, settings.Seed);
-                const glm::vec3 irradiance = PathTracing::PathTracer::EstimateIrradiance(
-                    world, job.WorldPos, job.WorldNormal, tracerSettings, texelSeed);
+                    const sizet first = static_cast<sizet>(tileIndex) * s_RayStreamTileTexels;
+                    const sizet count = std::min<sizet>(s_RayStreamTileTexels, jobCount - first);
+
+                    PathTracing::IrradianceQuery queries[s_RayStreamTileTexels];
+                    glm::vec3 irradiance[s_RayStreamTileTexels];
+                    for (sizet i = 0; i < count; ++i)
+                    {
+                        const LightmapTexelJob& job = jobAt(first + i);
+                        queries[i].Position = job.WorldPos;
+                        queries[i].Normal = job.WorldNormal;
+                        queries[i].Seed = PathTracing::MakePixelSeed(job.AtlasX, job.AtlasY, settings.Seed);
+                    }
+                    PathTracing::PathTracer::EstimateIrradianceBatch(world, std::span(queries, count), tracerSettings,
+                                                                     std::span(irradiance, count));
+                    for (sizet i = 0; i < count; ++i)
+                        storeTexel(jobAt(first + i), irradiance[i]);
+
+                    const sizet before = jobsDone.fetch_add(count, std::memory_order_relaxed);
+                    if (progress && (before / 256 != (before + count) / 256))
+                        ReportProgress(progress, 0.95f * static_cast<f32>(before + count) / static_cast<f32>(jobCount));
+                });
+        }
+        else
+        {
+            ParallelFor(
+                "LightmapBaker::BakeTexels",
+                static_cast<i32>(jobCount),
+                16, // MinBatchSize: each job is SamplesPerTexel full paths
+                [&](i32 jobIndex)
+                {
+                    if (sawCancel.load(std::memory_order_relaxed))
+                        return;
+                    if (IsCancelled(cancelToken))
+                    {
+                        sawCancel.store(true, std::memory_order_relaxed);
+                        return;
+                    }
 
-                const sizet t = (static_cast<sizet>(job.AtlasY) * prepared.AtlasSize + job.AtlasX) * 4;
-                texels[t + 0] = irradiance.x;
-                texels[t + 1] = irradiance.y;
-                texels[t + 2] = irradiance.z;
-                texels[t + 3] = 1.0f;
+                    const LightmapTexelJob& job = jobAt(static_cast<sizet>(jobIndex));
+                    const u32 texelSeed = PathTracing::MakePixelSeed(job.AtlasX, job.AtlasY, settings.Seed);
+                    storeTexel(job, PathTracing::PathTracer::EstimateIrradiance(world, job.WorldPos, job.WorldNormal,
+                                                                                tracerSettings, texelSeed));
 
-                const sizet done = jobsDone.fetch_add(1, std::memory_order_relaxed) + 1;
-                if (progress && (done % 256 == 0))
-                    ReportProgress(progress, 0.95f * static_cast<f32>(done) / static_cast<f32>(prepared.Jobs.size()));
-            });
+                    const sizet done = jobsDone.fetch_add(1, std::memory_order_relaxed) + 1;
+                    if (progress && (done % 256 == 0))
+                        ReportProgress(progress, 0.95f * static_cast<f32>(done) / static_cast<f32>(jobCount));
+                });
+        }
 
         if (sawCancel.load(std::memory_order_relaxed) || IsCancelled(cancelToken))
         {
@@ -530,8 +748,30 @@ namespace OloEngine
         }
         ReportProgress(progress, 0.95f);
 
+        // ── Reused charts: the previous bake's region, already dilated ──
+        std::vector<LightmapAtlasRegion> dilatedRegions;
+        if (reusing)
+        {
+            const std::vector<f32>& previous = prepared.ReuseAsset->GetTexelData();
+            for (sizet c = 0; c < prepared.Regions.size(); ++c)
+            {
+                const LightmapAtlasRegion& region = prepared.Regions[c];
+                if (prepared.ReusedCharts[c] == 0)
+                {
+                    dilatedRegions.push_back(region);
+                    continue;
+                }
+                for (u32 y = 0; y < region.Size; ++y)
+                {
+                    const sizet offset = (static_cast<sizet>(region.Y + y) * prepared.AtlasSize + region.X) * 4;
+                    std::copy_n(previous.data() + offset, static_cast<sizet>(region.Size) * 4, texels.data() + offset);
+                }
+            }
+        }
+
         // ── Dilation + asset assembly ──
-        DilateAtlas(texels, prepared.AtlasSize, settings.DilationPasses, prepared.Regions);
+        DilateAtlas(texels, prepared.AtlasSize, settings.DilationPasses,
+                    reusing ? std::span<const LightmapAtlasRegion>(dilatedRegions) : std::span<const LightmapAtlasRegion>(prepared.Regions));
 
         auto asset = Ref<LightmapAsset>::Create();
         asset->SetDimensions(prepared.AtlasSize, prepared.AtlasSize, 1);
@@ -540,6 +780,7 @@ namespace OloEngine
         asset->SetEntries(std::vector<LightmapEntityEntry>(prepared.Entries));
 
         result.Asset = asset;
+        result.Record = prepared.Record;
         result.Success = true;
         ReportProgress(progress, 1.0f);
         return result;
@@ -2,6 +2,7 @@
 
 #include "OloEngine/Core/Base.h"
 #include "OloEngine/Core/Ref.h"
+#include "OloEngine/Renderer/BoundingVolume.h"
 #include "OloEngine/Renderer/LightmapAsset.h"
 #include "OloEngine/Renderer/MeshSource.h"
 #include "OloEngine/Renderer/PathTracing/ReferenceScene.h"
@@ -28,6 +29,20 @@ namespace OloEngine
         f32 TexelsPerMeter = 8.0f; // world-space texel density target
         u32 DilationPasses = 4;    // chart-edge dilation iterations after the bake
         u32 Seed = 0x439u;         // global bake seed (texel seeds derive from it)
+        // Trace each tile of texels as one ray stream (PathTracerSettings::
+        // UseRayStreams). Bit-identical to the per-texel path, so it is not
+        // part of the bake key.
+        bool UseRayStreams = true;
+        // Incremental re-bakes (PlanDependencies): how far from a chart's
+        // world bounds an instance or light can be and still count as one of
+        // its dependencies. <= 0 (the default) is unbounded — every source is
+        // a dependency of every chart, so a reused chart always matches a
+        // full bake. A finite radius is an opt-in trade: contributions from
+        // farther out (a distant occluder shadowing the sun, say) are treated
+        // as below the bake's noise floor, and a change out there keeps the
+        // chart's previous texels. Only decides what is re-traced, so it is
+        // not part of the bake key either.
+        f32 DependencyRadius = 0.0f;
         // NOTE: the per-mesh unwrap parameters are deliberately NOT settings.
         // Prepare() always unwraps with the shared constants
         // (kLightmapUnwrap{Resolution,Padding} in LightmapUnwrap.h) because the
@@ -53,13 +68,52 @@ namespace OloEngine
         glm::mat4 WorldTransform = glm::mat4(1.0f);
     };
 
+    // Something a chart's lighting can depend on: a lightmap-static instance,
+    // a light, the environment. Supplied by the caller (the baker never
+    // touches the ECS); see SceneLightmapRuntime::GatherBakeDependencies.
+    struct LightmapBakeDependency
+    {
+        u64 Id = 0;           // entity UUID (any stable id for non-entities)
+        BoundingBox Bounds{}; // world-space reach; a point light's Range box, +-FLT_MAX for a sun or sky
+        u64 Fingerprint = 0;  // hash of everything about it the bake consumes
+    };
+
+    // What one baked chart (an entity's atlas region) depended on.
+    struct LightmapChartRecord
+    {
+        u64 EntityUUID = 0;
+        u32 X = 0;
+        u32 Y = 0;
+        u32 Size = 0;
+        std::vector<u64> Dependencies; // LightmapBakeDependency::Id, ascending
+    };
+
+    // Everything the next bake needs to decide which charts it may reuse.
+    // Produced by PlanDependencies, carried through BakeTexels onto the
+    // result; the caller keeps it alongside the asset it describes. Not
+    // serialized — a .olmap is a derived artifact, so after a reload the
+    // first bake is a full one.
+    struct LightmapBakeRecord
+    {
+        u64 SettingsHash = 0;                        // the settings that shape texel values
+        std::vector<LightmapBakeDependency> Sources; // ascending Id
+        std::vector<LightmapChartRecord> Charts;     // parallel to the asset's entries
+
+        [[nodiscard]] bool IsEmpty() const
+        {
+            return Charts.empty();
+        }
+    };
+
     struct LightmapBakeResult
     {
         bool Success = false;
         std::string Error;        // set when Success == false ("cancelled" included)
         Ref<LightmapAsset> Asset; // set when Success == true
+        LightmapBakeRecord Record; // dependency record for the next incremental bake (empty if none was planned)
         u32 BakedEntityCount = 0;
         u32 SkippedEntityCount = 0; // atlas exhaustion / unwrap failure — listed in the log
+        u32 ReusedChartCount = 0;   // charts copied from the previous bake instead of traced
     };
 
     // One texel awaiting an irradiance estimate: its atlas coordinates (the
@@ -83,6 +137,15 @@ namespace OloEngine
         u32 Size = 0;
     };
 
+    // One entity's run of texel jobs (the rasterizer emits an entity's jobs
+    // contiguously) and the world bounds its charts cover.
+    struct LightmapChartJobs
+    {
+        u32 FirstJob = 0;
+        u32 JobCount = 0;
+        BoundingBox WorldBounds{};
+    };
+
     // The game-thread product of Prepare(): everything the background texel
     // bake needs, with no reference back to any MeshSource. Immutable once
     // handed to BakeTexels — that is what makes the split thread-safe (the
@@ -93,9 +156,16 @@ namespace OloEngine
         std::vector<LightmapTexelJob> Jobs;
         std::vector<LightmapEntityEntry> Entries;
         std::vector<LightmapAtlasRegion> Regions; // parallel to Entries (same order)
+        std::vector<LightmapChartJobs> Charts;    // parallel to Entries (same order)
         u32 AtlasSize = 0;
         u32 BakedEntityCount = 0;
         u32 SkippedEntityCount = 0;
+
+        // Filled by PlanDependencies. ReusedCharts[i] != 0 means chart i is
+        // copied from ReuseAsset rather than traced.
+        LightmapBakeRecord Record;
+        std::vector<u8> ReusedCharts;
+        Ref<LightmapAsset> ReuseAsset;
     };
 
     // CPU lightmap baker (issue #439). The bake kernel is the reference path
@@ -128,11 +198,29 @@ namespace OloEngine
                                           LightmapBakePrepared& outPrepared,
                                           std::string& outError);
 
+        // Stage 1b — GAME THREAD, optional. Records which of `sources` every
+        // prepared chart depends on (every source, or with a finite
+        // settings.DependencyRadius a source within it of the chart's bounds,
+        // plus the chart's own entity) into
+        // `prepared.Record`. When `previousRecord`/`previousAsset` describe an
+        // earlier bake with the same settings, a chart keeps its previous
+        // texels if it sits in the same atlas region and no source it depended
+        // on then or depends on now was added, removed or changed. Returns the
+        // number of charts BakeTexels still has to trace.
+        static u32 PlanDependencies(LightmapBakePrepared& prepared,
+                                    std::span<const LightmapBakeDependency> sources,
+                                    const LightmapBakeSettings& settings,
+                                    const LightmapBakeRecord* previousRecord = nullptr,
+                                    const Ref<LightmapAsset>& previousAsset = nullptr);
+
         // Stage 2 — ANY THREAD. Reads only `prepared` and `world` (whose const
-        // queries are thread-safe once built); one EstimateIrradiance per texel,
-        // then dilation and asset assembly. `world` must already be Build()t and
-        // should contain the same static geometry/lights the inputs described
-        // (use ReferenceSceneBuilder). `progress` (0..1) and `cancelToken`
+        // queries are thread-safe once built); one EstimateIrradiance per texel
+        // (per tile of s_RayStreamTileTexels jobs with UseRayStreams), then
+        // dilation and asset assembly. Charts PlanDependencies marked reusable
+        // skip both: their region is copied from the previous asset, dilation
+        // included. `world` must already be Build()t and should contain the
+        // same static geometry/lights the inputs described (use
+        // ReferenceSceneBuilder). `progress` (0..1) and `cancelToken`
         // follow the AssetPackBuilder convention; both may be null.
         [[nodiscard]] static LightmapBakeResult BakeTexels(const LightmapBakePrepared& prepared,
                                                            const PathTracing::ReferenceScene& world,
@@ -147,5 +235,10 @@ namespace OloEngine
                                                      const LightmapBakeSettings& settings,
                                                      std::atomic<f32>* progress = nullptr,
                                                      const std::atomic<bool>* cancelToken = nullptr);
+
+        // Texel jobs per ray stream. Jobs come out of the rasterizer in scanline
+        // order per triangle, so a run of them is a compact patch of surface
+        // whose hemisphere rays are coherent.
+        static constexpr u32 s_RayStreamTileTexels = 32;
     };
 } // namespace OloEngine
@@ -4,31 +4,143 @@
 #include "OloEngine/Renderer/MeshSource.h"
 #include "OloEngine/Math/Math.h"
 #include "OloEngine/Debug/Instrumentor.h"
+#include "OloEngine/Task/ParallelFor.h"
+#include "OloEngine/Task/Task.h"
 
 #include <algorithm>
+#include <atomic>
+#include <bit>
 #include <limits>
 #include <vector>
 
+#if defined(_M_X64) || defined(__SSE__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define OLO_BVH_HAS_SSE 1
+#include <xmmintrin.h>
+#else
+#define OLO_BVH_HAS_SSE 0
+#endif
+
 namespace OloEngine
 {
     namespace
     {
         constexpr f32 s_FloatMax = std::numeric_limits<f32>::max();
+        // Centroid extent below which an axis is treated as flat (no split).
+        constexpr f32 s_FlatExtent = 1e-8f;
+        // Triangles per ParallelFor chunk when binning a large node. Fixed, so
+        // chunk boundaries depend only on the node, never on the thread count.
+        constexpr u32 s_BinChunkTriangles = 16384;
 
         OLO_FINLINE void ExpandToInclude(glm::vec3& boxMin, glm::vec3& boxMax, const glm::vec3& point)
         {
             boxMin = glm::min(boxMin, point);
             boxMax = glm::max(boxMax, point);
         }
+
+        OLO_FINLINE f32 HalfSurfaceArea(const glm::vec3& boxMin, const glm::vec3& boxMax)
+        {
+            const glm::vec3 extent = glm::max(boxMax - boxMin, glm::vec3(0.0f));
+            return extent.x * extent.y + extent.y * extent.z + extent.z * extent.x;
+        }
+
+        // One SAH bin: the bounds and count of the triangles whose centroid
+        // falls in it.
+        struct SAHBin
+        {
+            glm::vec3 BoxMin{ s_FloatMax };
+            glm::vec3 BoxMax{ -s_FloatMax };
+            u32 Count = 0;
+
+            void Merge(const SAHBin& other)
+            {
+                BoxMin = glm::min(BoxMin, other.BoxMin);
+                BoxMax = glm::max(BoxMax, other.BoxMax);
+                Count += other.Count;
+            }
+        };
+
+        // The per-ray constants of a wide traversal: the slab planes to load for
+        // each axis (near/far chosen by direction sign, so no per-lane min/max),
+        // and which axes the ray runs parallel to.
+        struct WideRay
+        {
+            f32 Origin[3];
+            f32 InvDir[3];
+            u32 NearPlane[3];
+            u32 FarPlane[3];
+            bool Parallel[3];
+
+            explicit WideRay(const Ray& ray)
+            {
+                for (u32 axis = 0; axis < 3; ++axis)
+                {
+                    const auto component = static_cast<glm::length_t>(axis);
+                    Origin[axis] = ray.Origin[component];
+                    // +/-inf for a zero component, exactly as RayIntersect::RayAABB
+                    // sees it; such an axis is tested as an interval instead.
+                    InvDir[axis] = 1.0f / ray.Direction[component];
+                    Parallel[axis] = std::isinf(InvDir[axis]);
+                    NearPlane[axis] = InvDir[axis] >= 0.0f ? axis : axis + 3;
+                    FarPlane[axis] = InvDir[axis] >= 0.0f ? axis + 3 : axis;
+                }
+            }
+        };
+
+        // Deliberately without member initializers: the traversal stack is a
+        // few hundred of these, and zeroing it per ray is measurable.
+        struct TraversalEntry
+        {
+            u32 Child;
+            u32 Count; // > 0: leaf triangle range
+            f32 TNear;
+        };
     } // namespace
 
+    struct BoundingVolumeHierarchy::BuildRef
+    {
+        glm::vec3 Min;
+        u32 Triangle;
+        glm::vec3 Max;
+        f32 Padding;
+
+        [[nodiscard]] glm::vec3 Centroid() const
+        {
+            return (Min + Max) * 0.5f;
+        }
+    };
+
+    struct BoundingVolumeHierarchy::BuildContext
+    {
+        BVHBuildSettings Settings;
+
+        // Accepted input triangles, in input order.
+        TArray<BVHTriangle> Triangles;
+
+        // One per triangle, partitioned in place as nodes split; a node owns the
+        // range [First, First + Count). The bounds travel with the index so
+        // binning and partitioning stream through memory instead of chasing
+        // indices into per-triangle arrays.
+        std::vector<BuildRef> Refs;
+
+        // Sized for the worst case (2N - 1) up front; subtree tasks claim slots
+        // with NodeCount. Slot numbers vary with scheduling, but nothing reads
+        // them except through Left/Right, and the collapse walks the tree from
+        // the root, so the output does not.
+        std::vector<BuildNode> Nodes;
+        std::vector<glm::vec3> NodeCentroidMin;
+        std::vector<glm::vec3> NodeCentroidMax;
+        std::atomic<u32> NodeCount{ 0 };
+    };
+
     void BoundingVolumeHierarchy::Clear()
     {
         m_Nodes.Empty();
         m_Triangles.Empty();
+        m_Bounds = BoundingBox{};
     }
 
-    void BoundingVolumeHierarchy::Build(const Vertex* vertices, sizet vertexCount, const u32* indices, sizet indexCount)
+    void BoundingVolumeHierarchy::Build(const Vertex* vertices, sizet vertexCount, const u32* indices, sizet indexCount,
+                                        const BVHBuildSettings& settings)
     {
         OLO_PROFILE_FUNCTION();
 
@@ -38,7 +150,11 @@ namespace OloEngine
             return;
 
         const sizet triangleCount = indexCount / 3;
-        m_Triangles.Reserve(static_cast<i32>(triangleCount));
+
+        BuildContext context;
+        context.Settings = settings;
+        context.Triangles.Reserve(static_cast<i32>(triangleCount));
+        context.Refs.reserve(triangleCount);
 
         sizet skipped = 0;
         for (sizet tri = 0; tri < triangleCount; ++tri)
@@ -69,11 +185,19 @@ namespace OloEngine
 
             BVHTriangle triangle;
             triangle.V0 = p0;
-            triangle.V1 = p1;
-            triangle.V2 = p2;
-            triangle.Centroid = (p0 + p1 + p2) * (1.0f / 3.0f);
+            triangle.Edge1 = p1 - p0;
+            triangle.Edge2 = p2 - p0;
             triangle.SourceIndex = static_cast<u32>(tri);
-            m_Triangles.Add(triangle);
+
+            // Bounds from the vertices themselves, not V0 + edge: the rounded sum
+            // can land a hair inside the true corner.
+            BuildRef ref;
+            ref.Min = glm::min(p0, glm::min(p1, p2));
+            ref.Max = glm::max(p0, glm::max(p1, p2));
+            ref.Triangle = static_cast<u32>(context.Triangles.Num());
+            ref.Padding = 0.0f;
+            context.Refs.push_back(ref);
+            context.Triangles.Add(triangle);
         }
 
         if (skipped > 0)
@@ -83,60 +207,55 @@ namespace OloEngine
                           skipped, triangleCount);
         }
 
-        BuildFromTriangles();
+        BuildFromContext(context);
     }
 
-    void BoundingVolumeHierarchy::Build(const MeshSource& meshSource)
+    void BoundingVolumeHierarchy::Build(const MeshSource& meshSource, const BVHBuildSettings& settings)
     {
         const TArray<Vertex>& vertices = meshSource.GetVertices();
         const TArray<u32>& indices = meshSource.GetIndices();
         Build(vertices.GetData(), static_cast<sizet>(vertices.Num()),
-              indices.GetData(), static_cast<sizet>(indices.Num()));
+              indices.GetData(), static_cast<sizet>(indices.Num()), settings);
     }
 
-    void BoundingVolumeHierarchy::BuildFromTriangles()
+    void BoundingVolumeHierarchy::BuildFromContext(BuildContext& context)
     {
-        m_Nodes.Empty();
-
-        const u32 triangleCount = static_cast<u32>(m_Triangles.Num());
+        const u32 triangleCount = static_cast<u32>(context.Triangles.Num());
         if (triangleCount == 0)
             return;
 
         // A binary tree with N leaves of >=1 triangle each has at most 2N-1 nodes.
-        // Reserving the upper bound keeps the node array's storage stable, so the
-        // contiguous left/right child indices computed during Subdivide stay valid.
-        m_Nodes.Reserve(static_cast<i32>(2 * triangleCount));
-
-        BVHNode root;
-        root.LeftFirst = 0;
-        root.TriCount = triangleCount;
-        m_Nodes.Add(root);
-
-        UpdateNodeBounds(0);
-        Subdivide(0, 0);
-    }
-
-    void BoundingVolumeHierarchy::UpdateNodeBounds(u32 nodeIndex)
-    {
-        BVHNode& node = m_Nodes[nodeIndex];
-
+        const sizet maxNodes = 2 * static_cast<sizet>(triangleCount);
+        context.Nodes.resize(maxNodes);
+        context.NodeCentroidMin.resize(maxNodes);
+        context.NodeCentroidMax.resize(maxNodes);
+
+        BuildNode& root = context.Nodes[0];
+        root.First = 0;
+        root.Count = triangleCount;
         glm::vec3 boxMin(s_FloatMax);
         glm::vec3 boxMax(-s_FloatMax);
-
-        const BVHTriangle* triangles = m_Triangles.GetData();
-        for (u32 k = 0; k < node.TriCount; ++k)
+        glm::vec3 centroidMin(s_FloatMax);
+        glm::vec3 centroidMax(-s_FloatMax);
+        for (u32 i = 0; i < triangleCount; ++i)
         {
-            const BVHTriangle& tri = triangles[node.LeftFirst + k];
-            ExpandToInclude(boxMin, boxMax, tri.V0);
-            ExpandToInclude(boxMin, boxMax, tri.V1);
-            ExpandToInclude(boxMin, boxMax, tri.V2);
+            const BuildRef& ref = context.Refs[i];
+            boxMin = glm::min(boxMin, ref.Min);
+            boxMax = glm::max(boxMax, ref.Max);
+            ExpandToInclude(centroidMin, centroidMax, ref.Centroid());
         }
+        root.Bounds = BoundingBox(boxMin, boxMax);
+        context.NodeCentroidMin[0] = centroidMin;
+        context.NodeCentroidMax[0] = centroidMax;
+        context.NodeCount.store(1, std::memory_order_relaxed);
 
-        node.Bounds.Min = boxMin;
-        node.Bounds.Max = boxMax;
+        BuildSubtree(context, 0, 0);
+
+        m_Bounds = root.Bounds;
+        CollapseToWide(context, 0);
     }
 
-    void BoundingVolumeHierarchy::Subdivide(u32 nodeIndex, u32 depth)
+    void BoundingVolumeHierarchy::BuildSubtree(BuildContext& context, u32 nodeIndex, u32 depth)
     {
         struct StackEntry
         {
@@ -144,93 +263,344 @@ namespace OloEngine
             u32 Depth;
         };
 
+        const bool parallel = !context.Settings.ForceSingleThread;
+
         std::vector<StackEntry> stack;
+        std::vector<Tasks::TTask<void>> forked;
         stack.push_back({ nodeIndex, depth });
 
+        SAHBin bins[3][s_SAHBinCount];
+        std::vector<SAHBin> chunkBins;
+
         while (!stack.empty())
         {
             const StackEntry entry = stack.back();
             stack.pop_back();
 
-            const u32 first = m_Nodes[entry.Node].LeftFirst;
-            const u32 count = m_Nodes[entry.Node].TriCount;
+            BuildNode& node = context.Nodes[entry.Node];
+            const u32 first = node.First;
+            const u32 count = node.Count;
 
-            // Leaf when small enough, or when the depth cap is reached (keeps the
-            // fixed-size traversal stack from ever overflowing).
-            if (count <= s_MaxLeafTriangles || entry.Depth >= s_MaxDepth)
+            // Leaf when trivially small, or when the depth cap is reached (keeps
+            // the fixed-size traversal stack from ever overflowing).
+            if (count <= 1 || entry.Depth >= s_MaxDepth)
                 continue;
 
-            // Split on the largest axis of the centroid bounds, at the spatial midpoint.
-            glm::vec3 centroidMin(s_FloatMax);
-            glm::vec3 centroidMax(-s_FloatMax);
-            BVHTriangle* triangles = m_Triangles.GetData();
-            for (u32 k = 0; k < count; ++k)
-                ExpandToInclude(centroidMin, centroidMax, triangles[first + k].Centroid);
-
-            const glm::vec3 extent = centroidMax - centroidMin;
-            glm::length_t axis = 0;
-            if (extent.y > extent.x)
-                axis = 1;
-            if (extent.z > extent[axis])
-                axis = 2;
-
-            // All centroids coincide on the chosen axis — no useful split exists.
-            constexpr f32 epsilon = 1e-8f;
-            if (extent[axis] < epsilon)
+            const glm::vec3 centroidMin = context.NodeCentroidMin[entry.Node];
+            const glm::vec3 extent = context.NodeCentroidMax[entry.Node] - centroidMin;
+
+            // All centroids coincide — no split can separate them.
+            if (extent.x < s_FlatExtent && extent.y < s_FlatExtent && extent.z < s_FlatExtent)
                 continue;
 
-            const f32 splitPos = 0.5f * (centroidMin[axis] + centroidMax[axis]);
+            // Small nodes need no more bins than they have triangles; most nodes
+            // are small, so this is most of the build time.
+            const u32 binCount = std::clamp(count, 4u, s_SAHBinCount);
+
+            // Per-axis bin scale; 0 on a flat axis so everything lands in bin 0.
+            glm::vec3 binScale(0.0f);
+            for (glm::length_t axis = 0; axis < 3; ++axis)
+            {
+                if (extent[axis] >= s_FlatExtent)
+                    binScale[axis] = static_cast<f32>(binCount) / extent[axis];
+            }
+
+            const auto binOf = [&centroidMin, &binScale, binCount](const glm::vec3& centroid, glm::length_t axis) -> u32
+            {
+                const f32 scaled = (centroid[axis] - centroidMin[axis]) * binScale[axis];
+                return std::min(static_cast<u32>(std::min(scaled, static_cast<f32>(binCount - 1))), binCount - 1);
+            };
 
-            // In-place partition: triangles with centroid below splitPos move left.
+            const auto binRange = [&context, &binOf, binCount](u32 begin, u32 end, SAHBin(&outBins)[3][s_SAHBinCount])
+            {
+                for (auto& axisBins : outBins)
+                    std::fill(axisBins, axisBins + binCount, SAHBin{});
+
+                for (u32 k = begin; k < end; ++k)
+                {
+                    const BuildRef& ref = context.Refs[k];
+                    const glm::vec3 centroid = ref.Centroid();
+                    for (glm::length_t axis = 0; axis < 3; ++axis)
+                    {
+                        SAHBin& bin = outBins[axis][binOf(centroid, axis)];
+                        bin.BoxMin = glm::min(bin.BoxMin, ref.Min);
+                        bin.BoxMax = glm::max(bin.BoxMax, ref.Max);
+                        ++bin.Count;
+                    }
+                }
+            };
+
+            if (count >= s_ParallelBinTriangles && parallel)
+            {
+                // Bin fixed-size chunks in parallel, then merge. Bins merge with
+                // min/max/add only, so the result is exact whatever ran where.
+                const u32 chunkCount = (count + s_BinChunkTriangles - 1) / s_BinChunkTriangles;
+                constexpr u32 binsPerChunk = 3 * s_SAHBinCount;
+                chunkBins.assign(static_cast<sizet>(chunkCount) * binsPerChunk, SAHBin{});
+                ParallelFor(
+                    "BoundingVolumeHierarchy::Bin",
+                    static_cast<i32>(chunkCount),
+                    1,
+                    [&](i32 chunk)
+                    {
+                        const u32 begin = first + static_cast<u32>(chunk) * s_BinChunkTriangles;
+                        const u32 end = std::min(begin + s_BinChunkTriangles, first + count);
+                        SAHBin local[3][s_SAHBinCount];
+                        binRange(begin, end, local);
+                        std::copy(&local[0][0], &local[0][0] + binsPerChunk,
+                                  chunkBins.begin() + static_cast<sizet>(chunk) * binsPerChunk);
+                    });
+
+                for (auto& axisBins : bins)
+                    std::fill(std::begin(axisBins), std::end(axisBins), SAHBin{});
+                for (u32 chunk = 0; chunk < chunkCount; ++chunk)
+                {
+                    const SAHBin* source = chunkBins.data() + static_cast<sizet>(chunk) * binsPerChunk;
+                    for (u32 i = 0; i < binsPerChunk; ++i)
+                        (&bins[0][0])[i].Merge(source[i]);
+                }
+            }
+            else
+            {
+                binRange(first, first + count, bins);
+            }
+
+            // SAH sweep: the cost of splitting after bin `i` is
+            //   areaLeft * countLeft + areaRight * countRight
+            // (intersection cost 1, areas relative to the parent's). Ties keep
+            // the first candidate, so the choice is a pure function of the input.
+            f32 bestCost = s_FloatMax;
+            glm::length_t bestAxis = -1;
+            u32 bestSplit = 0;
+            for (glm::length_t axis = 0; axis < 3; ++axis)
+            {
+                if (extent[axis] < s_FlatExtent)
+                    continue;
+
+                const SAHBin* axisBins = bins[axis];
+                f32 rightCost[s_SAHBinCount];
+                SAHBin accumulated;
+                for (u32 i = binCount - 1; i > 0; --i)
+                {
+                    accumulated.Merge(axisBins[i]);
+                    rightCost[i] = accumulated.Count > 0
+                                       ? HalfSurfaceArea(accumulated.BoxMin, accumulated.BoxMax) * static_cast<f32>(accumulated.Count)
+                                       : -1.0f;
+                }
+
+                accumulated = SAHBin{};
+                for (u32 i = 0; i + 1 < binCount; ++i)
+                {
+                    accumulated.Merge(axisBins[i]);
+                    if (accumulated.Count == 0 || rightCost[i + 1] < 0.0f)
+                        continue;
+
+                    const f32 cost = HalfSurfaceArea(accumulated.BoxMin, accumulated.BoxMax) * static_cast<f32>(accumulated.Count) + rightCost[i + 1];
+                    if (cost < bestCost)
+                    {
+                        bestCost = cost;
+                        bestAxis = axis;
+                        bestSplit = i;
+                    }
+                }
+            }
+
+            if (bestAxis < 0)
+                continue;
+
+            // Keep a small node as a leaf when no split beats intersecting all of
+            // its triangles (traversal cost 1, same units).
+            const f32 parentArea = HalfSurfaceArea(node.Bounds.Min, node.Bounds.Max);
+            const f32 leafCost = parentArea * static_cast<f32>(count);
+            if (count <= s_MaxLeafTriangles && leafCost <= parentArea + bestCost)
+                continue;
+
+            SAHBin left;
+            SAHBin right;
+            for (u32 i = 0; i < binCount; ++i)
+                (i <= bestSplit ? left : right).Merge(bins[bestAxis][i]);
+
+            // Partition the node's refs in place, collecting each side's centroid
+            // bounds on the way. binOf is the same function that filled the bins,
+            // so the counts agree exactly. Every ref is classified exactly once.
+            glm::vec3 leftCentroidMin(s_FloatMax);
+            glm::vec3 leftCentroidMax(-s_FloatMax);
+            glm::vec3 rightCentroidMin(s_FloatMax);
+            glm::vec3 rightCentroidMax(-s_FloatMax);
+            BuildRef* refs = context.Refs.data();
             u32 i = first;
             u32 j = first + count;
             while (i < j)
             {
-                if (triangles[i].Centroid[axis] < splitPos)
+                const glm::vec3 centroid = refs[i].Centroid();
+                if (binOf(centroid, bestAxis) <= bestSplit)
                 {
+                    ExpandToInclude(leftCentroidMin, leftCentroidMax, centroid);
                     ++i;
                 }
                 else
                 {
-                    --j;
-                    std::swap(triangles[i], triangles[j]);
+                    ExpandToInclude(rightCentroidMin, rightCentroidMax, centroid);
+                    std::swap(refs[i], refs[--j]);
                 }
             }
+            OLO_CORE_ASSERT(i - first == left.Count, "BVH partition disagrees with its bins");
 
-            u32 leftCount = i - first;
+            const u32 leftIndex = context.NodeCount.fetch_add(2, std::memory_order_relaxed);
+            const u32 rightIndex = leftIndex + 1;
+            OLO_CORE_ASSERT(rightIndex < context.Nodes.size(), "BVH build node pool exhausted");
+
+            BuildNode& leftNode = context.Nodes[leftIndex];
+            leftNode.First = first;
+            leftNode.Count = left.Count;
+            leftNode.Bounds = BoundingBox(left.BoxMin, left.BoxMax);
+            context.NodeCentroidMin[leftIndex] = leftCentroidMin;
+            context.NodeCentroidMax[leftIndex] = leftCentroidMax;
+
+            BuildNode& rightNode = context.Nodes[rightIndex];
+            rightNode.First = first + left.Count;
+            rightNode.Count = right.Count;
+            rightNode.Bounds = BoundingBox(right.BoxMin, right.BoxMax);
+            context.NodeCentroidMin[rightIndex] = rightCentroidMin;
+            context.NodeCentroidMax[rightIndex] = rightCentroidMax;
+
+            // Convert the current node into an internal node referencing its children.
+            node.Count = 0;
+            node.Left = leftIndex;
+            node.Right = rightIndex;
 
-            // Spatial midpoint left one side empty (clustered centroids). Fall back
-            // to an object-median split so the tree keeps making progress.
-            if (leftCount == 0 || leftCount == count)
+            stack.push_back({ leftIndex, entry.Depth + 1 });
+            if (parallel && right.Count >= s_ParallelSubtreeTriangles)
             {
-                const u32 mid = count / 2;
-                std::nth_element(triangles + first, triangles + first + mid, triangles + first + count,
-                                 [axis](const BVHTriangle& a, const BVHTriangle& b)
-                                 { return a.Centroid[axis] < b.Centroid[axis]; });
-                leftCount = mid;
+                // Disjoint ref range and disjoint node slots: the subtree can be
+                // built anywhere without affecting the result.
+                forked.push_back(Tasks::Launch(
+                    "BoundingVolumeHierarchy::BuildSubtree",
+                    [&context, rightIndex, childDepth = entry.Depth + 1]()
+                    { BuildSubtree(context, rightIndex, childDepth); }));
             }
+            else
+            {
+                stack.push_back({ rightIndex, entry.Depth + 1 });
+            }
+        }
 
-            const u32 leftChild = static_cast<u32>(m_Nodes.Num());
+        for (Tasks::TTask<void>& task : forked)
+            task.Wait();
+    }
 
-            BVHNode left;
-            left.LeftFirst = first;
-            left.TriCount = leftCount;
-            m_Nodes.Add(left);
+    void BoundingVolumeHierarchy::CollapseToWide(const BuildContext& context, u32 root)
+    {
+        OLO_PROFILE_FUNCTION();
 
-            BVHNode right;
-            right.LeftFirst = first + leftCount;
-            right.TriCount = count - leftCount;
-            m_Nodes.Add(right);
+        const auto isLeaf = [&context](u32 index)
+        {
+            return context.Nodes[index].Count > 0;
+        };
 
-            // Convert the current node into an internal node referencing its children.
-            m_Nodes[entry.Node].LeftFirst = leftChild;
-            m_Nodes[entry.Node].TriCount = 0;
+        m_Triangles.Reserve(context.Triangles.Num());
+        m_Nodes.Reserve(static_cast<i32>(context.NodeCount.load(std::memory_order_relaxed) / 2 + 1));
+        m_Nodes.AddDefaulted();
 
-            UpdateNodeBounds(leftChild);
-            UpdateNodeBounds(leftChild + 1);
+        struct StackEntry
+        {
+            u32 BinaryNode;
+            u32 WideNode;
+        };
+        std::vector<StackEntry> stack;
+        stack.push_back({ root, 0 });
 
-            stack.push_back({ leftChild, entry.Depth + 1 });
-            stack.push_back({ leftChild + 1, entry.Depth + 1 });
+        while (!stack.empty())
+        {
+            const StackEntry entry = stack.back();
+            stack.pop_back();
+
+            // Gather up to four children: open the internal child with the
+            // largest surface area until the node is full or only leaves remain.
+            u32 children[4];
+            u32 childCount = 0;
+            if (isLeaf(entry.BinaryNode))
+            {
+                children[childCount++] = entry.BinaryNode;
+            }
+            else
+            {
+                children[childCount++] = context.Nodes[entry.BinaryNode].Left;
+                children[childCount++] = context.Nodes[entry.BinaryNode].Right;
+                while (childCount < 4)
+                {
+                    i32 widest = -1;
+                    f32 widestArea = -1.0f;
+                    for (u32 i = 0; i < childCount; ++i)
+                    {
+                        if (isLeaf(children[i]))
+                            continue;
+                        const BoundingBox& bounds = context.Nodes[children[i]].Bounds;
+                        if (const f32 area = HalfSurfaceArea(bounds.Min, bounds.Max); area > widestArea)
+                        {
+                            widestArea = area;
+                            widest = static_cast<i32>(i);
+                        }
+                    }
+                    if (widest < 0)
+                        break;
+
+                    // Replace in place (right half shifts up) to keep siblings in
+                    // spatial order.
+                    const BuildNode& opened = context.Nodes[children[widest]];
+                    for (u32 i = childCount; i > static_cast<u32>(widest) + 1; --i)
+                        children[i] = children[i - 1];
+                    children[widest] = opened.Left;
+                    children[widest + 1] = opened.Right;
+                    ++childCount;
+                }
+            }
+
+            BVHWideNode wide;
+            for (u32 slot = 0; slot < 4; ++slot)
+            {
+                if (slot >= childCount)
+                {
+                    for (u32 axis = 0; axis < 3; ++axis)
+                    {
+                        wide.BoundsLanes[axis][slot] = s_FloatMax;
+                        wide.BoundsLanes[axis + 3][slot] = -s_FloatMax;
+                    }
+                    wide.Child[slot] = s_EmptySlot;
+                    wide.Count[slot] = 0;
+                    continue;
+                }
+
+                const BuildNode& child = context.Nodes[children[slot]];
+                for (u32 axis = 0; axis < 3; ++axis)
+                {
+                    wide.BoundsLanes[axis][slot] = child.Bounds.Min[static_cast<glm::length_t>(axis)];
+                    wide.BoundsLanes[axis + 3][slot] = child.Bounds.Max[static_cast<glm::length_t>(axis)];
+                }
+
+                if (isLeaf(children[slot]))
+                {
+                    wide.Child[slot] = static_cast<u32>(m_Triangles.Num());
+                    wide.Count[slot] = child.Count;
+                    for (u32 k = 0; k < child.Count; ++k)
+                        m_Triangles.Add(context.Triangles[static_cast<i32>(context.Refs[child.First + k].Triangle)]);
+                }
+                else
+                {
+                    wide.Child[slot] = static_cast<u32>(m_Nodes.Num());
+                    wide.Count[slot] = 0;
+                    m_Nodes.AddDefaulted();
+                }
+            }
+
+            // Depth-first, first child first: pushed in reverse.
+            for (u32 slot = childCount; slot-- > 0;)
+            {
+                if (wide.Count[slot] == 0)
+                    stack.push_back({ children[slot], wide.Child[slot] });
+            }
+
+            m_Nodes[entry.WideNode] = wide;
         }
     }
 
@@ -238,9 +608,67 @@ namespace OloEngine
     {
         if (m_Nodes.IsEmpty())
             return BoundingBox{};
-        return m_Nodes[0].Bounds;
+        return m_Bounds;
     }
 
+    namespace
+    {
+        // Slab-test one ray against the four child boxes of a wide node. Returns
+        // a 4-bit mask of the children overlapping [tMin, tMax] and writes each
+        // lane's entry distance to `outTNear`. Same interval arithmetic as
+        // RayIntersect::RayAABB, lane for lane.
+        template<typename NodeType>
+        OLO_FINLINE u32 IntersectChildren(const NodeType& node, const WideRay& ray, f32 tMin, f32 tMax, f32 (&outTNear)[4])
+        {
+#if OLO_BVH_HAS_SSE
+            __m128 tEnter = _mm_set1_ps(tMin);
+            __m128 tExit = _mm_set1_ps(tMax);
+            __m128 inside = _mm_cmpeq_ps(tEnter, tEnter);
+            for (u32 axis = 0; axis < 3; ++axis)
+            {
+                const __m128 origin = _mm_set1_ps(ray.Origin[axis]);
+                if (ray.Parallel[axis])
+                {
+                    // Parallel to this axis: inside the slab or no hit at all.
+                    const __m128 lo = _mm_loadu_ps(node.BoundsLanes[axis]);
+                    const __m128 hi = _mm_loadu_ps(node.BoundsLanes[axis + 3]);
+                    inside = _mm_and_ps(inside, _mm_and_ps(_mm_cmple_ps(lo, origin), _mm_cmple_ps(origin, hi)));
+                    continue;
+                }
+                const __m128 invDir = _mm_set1_ps(ray.InvDir[axis]);
+                const __m128 tNear = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(node.BoundsLanes[ray.NearPlane[axis]]), origin), invDir);
+                const __m128 tFar = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(node.BoundsLanes[ray.FarPlane[axis]]), origin), invDir);
+                tEnter = _mm_max_ps(tEnter, tNear);
+                tExit = _mm_min_ps(tExit, tFar);
+            }
+            _mm_storeu_ps(outTNear, tEnter);
+            return static_cast<u32>(_mm_movemask_ps(_mm_and_ps(inside, _mm_cmple_ps(tEnter, tExit))));
+#else
+            u32 mask = 0;
+            for (u32 lane = 0; lane < 4; ++lane)
+            {
+                f32 tEnter = tMin;
+                f32 tExit = tMax;
+                bool inside = true;
+                for (u32 axis = 0; axis < 3; ++axis)
+                {
+                    if (ray.Parallel[axis])
+                    {
+                        inside = inside && node.BoundsLanes[axis][lane] <= ray.Origin[axis] && ray.Origin[axis] <= node.BoundsLanes[axis + 3][lane];
+                        continue;
+                    }
+                    tEnter = std::max(tEnter, (node.BoundsLanes[ray.NearPlane[axis]][lane] - ray.Origin[axis]) * ray.InvDir[axis]);
+                    tExit = std::min(tExit, (node.BoundsLanes[ray.FarPlane[axis]][lane] - ray.Origin[axis]) * ray.InvDir[axis]);
+                }
+                outTNear[lane] = tEnter;
+                if (inside && tEnter <= tExit)
+                    mask |= 1u << lane;
+            }
+            return mask;
+#endif
+        }
+    } // namespace
+
     bool BoundingVolumeHierarchy::CastRay(const Ray& ray, RayHit& outHit) const
     {
         OLO_PROFILE_FUNCTION();
@@ -250,32 +678,32 @@ namespace OloEngine
         if (m_Nodes.IsEmpty())
             return false;
 
-        // Component-wise reciprocal; +/-inf for axis-parallel components is expected
-        // and handled by the slab test's min/max ordering.
-        const glm::vec3 invDir = 1.0f / ray.Direction;
+        const WideRay wideRay(ray);
 
         f32 closest = ray.TMax;
-        RayHit best;
-        bool found = false;
+        const BVHTriangle* bestTriangle = nullptr;
+        f32 bestU = 0.0f;
+        f32 bestV = 0.0f;
+        bool bestFrontFace = false;
 
-        u32 stack[s_TraversalStackSize];
+        TraversalEntry stack[s_TraversalStackSize];
         u32 stackPtr = 0;
-        stack[stackPtr++] = 0;
+        stack[stackPtr++] = { 0, 0, ray.TMin };
 
         while (stackPtr > 0)
         {
-            const BVHNode& node = m_Nodes[stack[--stackPtr]];
+            const TraversalEntry entry = stack[--stackPtr];
 
-            // Authoritative prune: closest tightens as nearer hits are found, so a
-            // node enqueued earlier may now be fully behind the best hit.
-            if (f32 tNear; !RayIntersect::RayAABB(ray.Origin, invDir, node.Bounds.Min, node.Bounds.Max, ray.TMin, closest, tNear))
+            // Authoritative prune: closest tightens as nearer hits are found, so an
+            // entry pushed earlier may now lie entirely behind the best hit.
+            if (entry.TNear > closest)
                 continue;
 
-            if (node.IsLeaf())
+            if (entry.Count > 0)
             {
-                for (u32 k = 0; k < node.TriCount; ++k)
+                for (u32 k = 0; k < entry.Count; ++k)
                 {
-                    const BVHTriangle& tri = m_Triangles[node.LeftFirst + k];
+                    const BVHTriangle& tri = m_Triangles[entry.Child + k];
 
                     Ray clipped = ray;
                     clipped.TMax = closest;
@@ -284,72 +712,67 @@ namespace OloEngine
                     f32 u = 0.0f;
                     f32 v = 0.0f;
                     bool frontFace = false;
-                    if (!RayIntersect::RayTriangle(clipped, tri.V0, tri.V1, tri.V2, t, u, v, frontFace))
+                    if (!RayIntersect::RayTriangleEdges(clipped, tri.V0, tri.Edge1, tri.Edge2, t, u, v, frontFace))
                         continue;
 
                     closest = t;
-                    found = true;
-
-                    best.Hit = true;
-                    best.Distance = t;
-                    best.U = u;
-                    best.V = v;
-                    best.FrontFace = frontFace;
-                    best.TriangleIndex = tri.SourceIndex;
-                    best.Point = ray.At(t);
-
-                    // Geometric face normal from the winding, flipped to oppose the
-                    // ray so it points back toward the origin.
-                    glm::vec3 normal = glm::normalize(glm::cross(tri.V1 - tri.V0, tri.V2 - tri.V0));
-                    if (glm::dot(normal, ray.Direction) > 0.0f)
-                        normal = -normal;
-                    best.Normal = normal;
+                    bestTriangle = &tri;
+                    bestU = u;
+                    bestV = v;
+                    bestFrontFace = frontFace;
                 }
 
                 continue;
             }
 
-            // Internal node: descend nearer child first so `closest` tightens early
-            // and prunes the farther subtree more often.
-            const u32 leftIndex = node.LeftFirst;
-            const u32 rightIndex = leftIndex + 1;
-            const BVHNode& leftNode = m_Nodes[leftIndex];
-            const BVHNode& rightNode = m_Nodes[rightIndex];
-
-            f32 tLeft = 0.0f;
-            f32 tRight = 0.0f;
-            const bool hitLeft = RayIntersect::RayAABB(ray.Origin, invDir, leftNode.Bounds.Min, leftNode.Bounds.Max, ray.TMin, closest, tLeft);
-            const bool hitRight = RayIntersect::RayAABB(ray.Origin, invDir, rightNode.Bounds.Min, rightNode.Bounds.Max, ray.TMin, closest, tRight);
-
-            OLO_CORE_ASSERT(stackPtr + 2 <= s_TraversalStackSize, "BVH traversal stack overflow");
+            const BVHWideNode& node = m_Nodes[entry.Child];
+            f32 tNear[4];
+            u32 mask = IntersectChildren(node, wideRay, ray.TMin, closest, tNear);
+            if (mask == 0)
+                continue;
 
-            if (hitLeft && hitRight)
+            // Sort the hit children far-to-near (insertion sort, <= 4 entries) so
+            // the nearest is popped next and `closest` tightens early.
+            TraversalEntry hits[4];
+            u32 hitCount = 0;
+            while (mask != 0)
             {
-                // Push the farther child first so the nearer one is popped next.
-                if (tLeft <= tRight)
-                {
-                    stack[stackPtr++] = rightIndex;
-                    stack[stackPtr++] = leftIndex;
-                }
-                else
+                const u32 lane = static_cast<u32>(std::countr_zero(mask));
+                mask &= mask - 1;
+
+                const TraversalEntry candidate{ node.Child[lane], node.Count[lane], tNear[lane] };
+                u32 insert = hitCount++;
+                while (insert > 0 && hits[insert - 1].TNear < candidate.TNear)
                 {
-                    stack[stackPtr++] = leftIndex;
-                    stack[stackPtr++] = rightIndex;
+                    hits[insert] = hits[insert - 1];
+                    --insert;
                 }
+                hits[insert] = candidate;
             }
-            else if (hitLeft)
-            {
-                stack[stackPtr++] = leftIndex;
-            }
-            else if (hitRight)
-            {
-                stack[stackPtr++] = rightIndex;
-            }
+
+            OLO_CORE_ASSERT(stackPtr + hitCount <= s_TraversalStackSize, "BVH traversal stack overflow");
+            for (u32 i = 0; i < hitCount; ++i)
+                stack[stackPtr++] = hits[i];
         }
 
-        if (found)
-            outHit = best;
-        return found;
+        if (bestTriangle == nullptr)
+            return false;
+
+        outHit.Hit = true;
+        outHit.Distance = closest;
+        outHit.U = bestU;
+        outHit.V = bestV;
+        outHit.FrontFace = bestFrontFace;
+        outHit.TriangleIndex = bestTriangle->SourceIndex;
+        outHit.Point = ray.At(closest);
+
+        // Geometric face normal from the winding, flipped to oppose the ray so it
+        // points back toward the origin.
+        glm::vec3 normal = glm::normalize(glm::cross(bestTriangle->Edge1, bestTriangle->Edge2));
+        if (glm::dot(normal, ray.Direction) > 0.0f)
+            normal = -normal;
+        outHit.Normal = normal;
+        return true;
     }
 
     bool BoundingVolumeHierarchy::CastRayAny(const Ray& ray) const
@@ -359,40 +782,162 @@ namespace OloEngine
         if (m_Nodes.IsEmpty())
             return false;
 
-        const glm::vec3 invDir = 1.0f / ray.Direction;
+        const WideRay wideRay(ray);
 
-        u32 stack[s_TraversalStackSize];
+        TraversalEntry stack[s_TraversalStackSize];
         u32 stackPtr = 0;
-        stack[stackPtr++] = 0;
+        stack[stackPtr++] = { 0, 0, ray.TMin };
 
         while (stackPtr > 0)
         {
-            const BVHNode& node = m_Nodes[stack[--stackPtr]];
-
-            if (f32 tNear; !RayIntersect::RayAABB(ray.Origin, invDir, node.Bounds.Min, node.Bounds.Max, ray.TMin, ray.TMax, tNear))
-                continue;
+            const TraversalEntry entry = stack[--stackPtr];
 
-            if (node.IsLeaf())
+            if (entry.Count > 0)
             {
-                for (u32 k = 0; k < node.TriCount; ++k)
+                for (u32 k = 0; k < entry.Count; ++k)
                 {
-                    const BVHTriangle& tri = m_Triangles[node.LeftFirst + k];
+                    const BVHTriangle& tri = m_Triangles[entry.Child + k];
                     f32 t = 0.0f;
                     f32 u = 0.0f;
                     f32 v = 0.0f;
                     bool frontFace = false;
-                    if (RayIntersect::RayTriangle(ray, tri.V0, tri.V1, tri.V2, t, u, v, frontFace))
+                    if (RayIntersect::RayTriangleEdges(ray, tri.V0, tri.Edge1, tri.Edge2, t, u, v, frontFace))
                         return true;
                 }
 
                 continue;
             }
 
-            OLO_CORE_ASSERT(stackPtr + 2 <= s_TraversalStackSize, "BVH traversal stack overflow");
-            stack[stackPtr++] = node.LeftFirst;
-            stack[stackPtr++] = node.LeftFirst + 1;
+            // Any hit will do, so no ordering: push in lane order.
+            const BVHWideNode& node = m_Nodes[entry.Child];
+            f32 tNear[4];
+            u32 mask = IntersectChildren(node, wideRay, ray.TMin, ray.TMax, tNear);
+
+            OLO_CORE_ASSERT(stackPtr + std::popcount(mask) <= s_TraversalStackSize, "BVH traversal stack overflow");
+            while (mask != 0)
+            {
+                const u32 lane = static_cast<u32>(std::countr_zero(mask));
+                mask &= mask - 1;
+                stack[stackPtr++] = { node.Child[lane], node.Count[lane], tNear[lane] };
+            }
         }
 
         return false;
     }
+
+    void BoundingVolumeHierarchy::CastRaysAny(std::span<const Ray> rays, std::span<u8> inOutOccluded) const
+    {
+        OLO_PROFILE_FUNCTION();
+
+        OLO_CORE_ASSERT(inOutOccluded.size() >= rays.size(), "BVH::CastRaysAny: flag span shorter than the ray batch");
+        if (m_Nodes.IsEmpty() || rays.empty())
+            return;
+
+        std::vector<WideRay> wideRays;
+        wideRays.reserve(rays.size());
+        for (const Ray& ray : rays)
+            wideRays.emplace_back(ray);
+
+        // Every stack entry owns a run of ray indices in `pool`. Runs are
+        // appended in push order and popped in reverse, so the pool is itself
+        // a stack and never holds more than depth x batch indices.
+        struct StreamEntry
+        {
+            u32 Node;
+            u32 Begin;
+            u32 End;
+        };
+
+        std::vector<u32> pool;
+        pool.reserve(rays.size() * 4);
+        for (u32 i = 0; i < static_cast<u32>(rays.size()); ++i)
+        {
+            if (inOutOccluded[i] == 0)
+                pool.push_back(i);
+        }
+        if (pool.empty())
+            return;
+
+        std::vector<u8> masks(pool.size());
+        StreamEntry stack[s_TraversalStackSize];
+        u32 stackPtr = 0;
+        stack[stackPtr++] = { 0, 0, static_cast<u32>(pool.size()) };
+
+        while (stackPtr > 0)
+        {
+            const StreamEntry entry = stack[--stackPtr];
+            const BVHWideNode& node = m_Nodes[entry.Node];
+
+            // Children test against every ray still open. The masks are what
+            // CastRayAny would compute for the same ray, so each ray reaches
+            // exactly the leaves it would have reached on its own.
+            u32 laneCounts[4] = { 0, 0, 0, 0 };
+            u32 live = 0;
+            for (u32 k = entry.Begin; k < entry.End; ++k)
+            {
+                const u32 rayIndex = pool[k];
+                if (inOutOccluded[rayIndex] != 0)
+                    continue;
+
+                f32 tNear[4];
+                const u32 mask = IntersectChildren(node, wideRays[rayIndex], rays[rayIndex].TMin, rays[rayIndex].TMax, tNear);
+                if (mask == 0)
+                    continue;
+
+                pool[entry.Begin + live] = rayIndex;
+                masks[live] = static_cast<u8>(mask);
+                ++live;
+                for (u32 lane = 0; lane < 4; ++lane)
+                    laneCounts[lane] += (mask >> lane) & 1u;
+            }
+
+            // Everything above this entry's run is free again. A ray blocked in
+            // a leaf lane below may also be queued for an internal sibling; it
+            // is dropped when that sibling pops.
+            pool.resize(entry.Begin + live);
+
+            for (u32 lane = 0; lane < 4; ++lane)
+            {
+                if (laneCounts[lane] == 0)
+                    continue;
+
+                if (node.Count[lane] > 0)
+                {
+                    const u32 first = node.Child[lane];
+                    const u32 count = node.Count[lane];
+                    for (u32 k = 0; k < live; ++k)
+                    {
+                        const u32 rayIndex = pool[entry.Begin + k];
+                        if ((masks[k] & (1u << lane)) == 0 || inOutOccluded[rayIndex] != 0)
+                            continue;
+
+                        for (u32 t = 0; t < count; ++t)
+                        {
+                            const BVHTriangle& tri = m_Triangles[first + t];
+                            f32 hitT = 0.0f;
+                            f32 u = 0.0f;
+                            f32 v = 0.0f;
+                            bool frontFace = false;
+                            if (RayIntersect::RayTriangleEdges(rays[rayIndex], tri.V0, tri.Edge1, tri.Edge2, hitT, u, v, frontFace))
+                            {
+                                inOutOccluded[rayIndex] = 1;
+                                break;
+                            }
+                        }
+                    }
+                    continue;
+                }
+
+                const u32 begin = static_cast<u32>(pool.size());
+                for (u32 k = 0; k < live; ++k)
+                {
+                    if ((masks[k] & (1u << lane)) != 0)
+                        pool.push_back(pool[entry.Begin + k]);
+                }
+
+                OLO_CORE_ASSERT(stackPtr < s_TraversalStackSize, "BVH traversal stack overflow");
+                stack[stackPtr++] = { node.Child[lane], begin, static_cast<u32>(pool.size()) };
+            }
+        }
+    }
 } // namespace OloEngine
@@ -8,10 +8,22 @@
 
 #include <glm/glm.hpp>
 
+#include <span>
+
 namespace OloEngine
 {
     class MeshSource;
 
+    // @brief Build options for BoundingVolumeHierarchy.
+    struct BVHBuildSettings
+    {
+        // Build on the calling thread only. The tree is identical either way
+        // (see the determinism note on BoundingVolumeHierarchy); this exists so
+        // tests can prove that, and for callers already inside a parallel loop
+        // that would rather not fan out further.
+        bool ForceSingleThread = false;
+    };
+
     // @brief CPU bounding-volume hierarchy over a mesh's triangle soup, for
     // ray-vs-mesh queries (closest hit + any hit).
     //
@@ -19,18 +31,35 @@ namespace OloEngine
     // (see docs/design/GPU_INSTANCING_FUTURE_IMPROVEMENTS.md §1.2). It is pure CPU/glm —
     // no GL context, no Jolt — so it can back editor tools that need world
     // raycasts: the scatter brush's mesh-surface placement, gizmo snapping,
-    // click-to-select on mesh backings, debug raycast viz.
+    // click-to-select on mesh backings, debug raycast viz. It is also the bottom
+    // level of the offline reference path tracer and lightmap baker, which is
+    // where its speed matters.
     //
     // Build it once from a MeshSource (or raw vertex/index arrays); the tree caches
     // the triangle geometry, so the source mesh need not outlive the BVH. Queries
     // are const and read-only, so a built BVH may be shared across threads.
     //
-    // The build is a binary median/midpoint split over triangle centroids: each
-    // node is split on the largest axis of its centroid bounds at the spatial
-    // midpoint, with an object-median fallback (nth_element) when the midpoint
-    // leaves one side empty. Nodes are stored in a flat array with children
-    // allocated contiguously (right child == left child + 1). This is intentionally
-    // simple; a SAH build can replace SplitNode later if profiling wants it.
+    // BUILD. A binary tree is built top-down with binned SAH (surface area
+    // heuristic, s_SAHBinCount bins per axis over the centroid bounds), then
+    // collapsed into a 4-wide tree: each wide node absorbs the binary children
+    // with the largest surface area until it has four. Large subtrees are built
+    // as parallel tasks and large nodes bin their triangles with ParallelFor.
+    //
+    // DETERMINISM. The built tree — node layout, triangle order, and therefore
+    // every query result — is bit-identical whatever the thread count. Each
+    // subtree task owns a disjoint triangle range, per-chunk bin results are
+    // merged with min/max/add (order-independent), chunk boundaries depend only
+    // on the triangle count, and the collapse into the wide array is a single
+    // sequential depth-first pass. The path tracer's bit-identity contract
+    // (PathTracer.h) leans on this.
+    //
+    // TRAVERSAL. A wide node stores its four child boxes as SoA lanes, so one ray
+    // is slab-tested against all four at once (SSE where available, a scalar loop
+    // otherwise — same arithmetic, same results). Closest-hit traversal visits
+    // the hit children nearest first and skips stacked entries whose entry
+    // distance is already beyond the closest hit. Triangles store an origin and
+    // two precomputed edges, so the leaf test is Möller–Trumbore without the
+    // per-ray edge subtraction.
     class BoundingVolumeHierarchy
     {
       public:
@@ -41,12 +70,13 @@ namespace OloEngine
         // list (every 3 indices = 1 triangle). Triangles referencing out-of-range
         // indices or non-finite positions are skipped. Re-building clears prior
         // state. Safe to call with null/zero inputs (produces an empty BVH).
-        void Build(const Vertex* vertices, sizet vertexCount, const u32* indices, sizet indexCount);
+        void Build(const Vertex* vertices, sizet vertexCount, const u32* indices, sizet indexCount,
+                   const BVHBuildSettings& settings = {});
 
         // Convenience overload: build from a MeshSource's full geometry
         // (GetVertices()/GetIndices()). The MeshSource is the authoritative geometry
         // and need not be GPU-built (Build() is not required).
-        void Build(const MeshSource& meshSource);
+        void Build(const MeshSource& meshSource, const BVHBuildSettings& settings = {});
 
         // Drop all nodes and triangle data; IsBuilt() becomes false.
         void Clear();
@@ -69,7 +99,16 @@ namespace OloEngine
         // matters.
         [[nodiscard]] bool CastRayAny(const Ray& ray) const;
 
-        // Number of nodes in the flat tree (internal + leaf).
+        // Any-hit query for a batch of rays. The batch walks the tree together,
+        // each node's bounds are read once for every ray still inside it, and
+        // a ray drops out as soon as it is blocked. Entries of `inOutOccluded`
+        // that are already non-zero are skipped; the rest are set to 1 exactly
+        // where CastRayAny would return true and left alone otherwise.
+        void CastRaysAny(std::span<const Ray> rays, std::span<u8> inOutOccluded) const;
+
+        // Number of wide nodes in the flat tree. Leaves live in their parent's
+        // child slots, so a mesh small enough for a single leaf still has one
+        // (root) node.
         [[nodiscard]] u32 GetNodeCount() const
         {
             return static_cast<u32>(m_Nodes.Num());
@@ -87,51 +126,73 @@ namespace OloEngine
         [[nodiscard]] BoundingBox GetBounds() const;
 
       private:
-        // A flat-array BVH node. A leaf has TriCount > 0 and indexes
-        // m_Triangles[LeftFirst .. LeftFirst + TriCount). An internal node has
-        // TriCount == 0 and LeftFirst is the index of its left child in m_Nodes;
-        // the right child is LeftFirst + 1.
-        struct BVHNode
+        // A 4-wide node. Child boxes are stored as SoA lanes — BoundsLanes[0..2]
+        // are the min x/y/z of the four children, BoundsLanes[3..5] the max — so
+        // the traversal loads one register per plane. For a child slot `i`:
+        //   * Count[i] > 0  — leaf over m_Triangles[Child[i] .. Child[i] + Count[i]);
+        //   * Count[i] == 0 — internal, Child[i] indexes m_Nodes;
+        //   * Child[i] == s_EmptySlot — unused; its box is inverted (+max/-max)
+        //     so the slab test never reports it.
+        struct alignas(16) BVHWideNode
         {
-            BoundingBox Bounds;
-            u32 LeftFirst = 0;
-            u32 TriCount = 0;
-
-            [[nodiscard]] bool IsLeaf() const
-            {
-                return TriCount > 0;
-            }
+            f32 BoundsLanes[6][4];
+            u32 Child[4];
+            u32 Count[4];
         };
 
-        // Precomputed triangle: the three vertex positions, its centroid (split
-        // key), and the original triangle ordinal so hits can map back to the
-        // source index buffer.
+        // Precomputed triangle: the first vertex and the two edges leaving it
+        // (what Möller–Trumbore consumes), and the original triangle ordinal so
+        // hits can map back to the source index buffer.
         struct BVHTriangle
         {
             glm::vec3 V0{ 0.0f };
-            glm::vec3 V1{ 0.0f };
-            glm::vec3 V2{ 0.0f };
-            glm::vec3 Centroid{ 0.0f };
+            glm::vec3 Edge1{ 0.0f };
+            glm::vec3 Edge2{ 0.0f };
             u32 SourceIndex = 0;
         };
 
-        void BuildFromTriangles();
-        void UpdateNodeBounds(u32 nodeIndex);
-        // Recursively (iteratively) split node ranges into children; `nodeIndex`/
-        // `depth` seed the work stack.
-        void Subdivide(u32 nodeIndex, u32 depth);
+        // Build-time binary node. Only lives for the duration of Build().
+        struct BuildNode
+        {
+            BoundingBox Bounds;
+            u32 First = 0;  // leaf: first entry in the build's triangle order
+            u32 Count = 0;  // leaf: triangle count; 0 == internal
+            u32 Left = 0;   // internal: child indices into the build node array
+            u32 Right = 0;
+        };
+
+        struct BuildRef;
+        struct BuildContext;
+
+        void BuildFromContext(BuildContext& context);
+        // Split `nodeIndex` (and its descendants) until every leaf satisfies the
+        // SAH termination test or the depth cap. Forks large children as tasks.
+        static void BuildSubtree(BuildContext& context, u32 nodeIndex, u32 depth);
+        // Collapse the binary tree under `root` into m_Nodes, reordering the
+        // triangles into leaf (depth-first) order as it goes.
+        void CollapseToWide(const BuildContext& context, u32 root);
 
-        TArray<BVHNode> m_Nodes;
+        TArray<BVHWideNode> m_Nodes;
         TArray<BVHTriangle> m_Triangles;
+        BoundingBox m_Bounds{};
 
-        // Leaf when a node holds at most this many triangles.
+        // Leaf when a node holds at most this many triangles and SAH finds no
+        // split that beats intersecting them all.
         static constexpr u32 s_MaxLeafTriangles = 4;
-        // Hard cap on tree depth so the fixed-size traversal stack can never
-        // overflow, even on adversarial (exponentially-clustered) geometry. A node
-        // reaching this depth becomes a leaf regardless of triangle count.
+        // Bins per axis for the SAH sweep.
+        static constexpr u32 s_SAHBinCount = 16;
+        // Subtrees at least this large are built as their own task, and nodes at
+        // least this large bin their triangles with ParallelFor.
+        static constexpr u32 s_ParallelSubtreeTriangles = 4096;
+        static constexpr u32 s_ParallelBinTriangles = 65536;
+        // Hard cap on binary tree depth so the fixed-size traversal stack can
+        // never overflow, even on adversarial (exponentially-clustered)
+        // geometry. A node reaching this depth becomes a leaf regardless of
+        // triangle count. The wide tree is never deeper than the binary one.
         static constexpr u32 s_MaxDepth = 60;
-        // Traversal stack size — must exceed s_MaxDepth (one slot per nesting level
-        // plus the sibling pushed alongside the descent).
-        static constexpr u32 s_TraversalStackSize = 64;
+        // A wide traversal pops one entry and pushes up to four, so peak stack
+        // occupancy is 3 * depth + 4.
+        static constexpr u32 s_TraversalStackSize = 3 * s_MaxDepth + 4;
+        static constexpr u32 s_EmptySlot = 0xFFFFFFFFu;
     };
 } // namespace OloEngine
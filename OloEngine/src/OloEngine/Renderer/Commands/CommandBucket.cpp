@@ -10,6 +10,8 @@
 #include <algorithm>
 #include <array>
 #include <chrono>
+#include <cstring>
+#include <new>
 #include <unordered_set>
 
 namespace OloEngine
@@ -208,6 +210,64 @@ namespace OloEngine
             }
         }
 
+        // ====================================================================
+        // Retained-draw helpers
+        // ====================================================================
+
+        u8* AllocateRetainedStorage(sizet size)
+        {
+            return static_cast<u8*>(::operator new(size, std::align_val_t{ CommandAllocator::COMMAND_ALIGNMENT }));
+        }
+
+        void FreeRetainedStorage(u8* storage)
+        {
+            if (storage)
+                ::operator delete(storage, std::align_val_t{ CommandAllocator::COMMAND_ALIGNMENT });
+        }
+
+        // Everything but the sort key, which the caller compares separately
+        bool SameRetainedMetadata(const PacketMetadata& a, const PacketMetadata& b)
+        {
+            return a.m_DependsOnPrevious == b.m_DependsOnPrevious && a.m_GroupID == b.m_GroupID &&
+                   a.m_ExecutionOrder == b.m_ExecutionOrder && a.m_IsStatic == b.m_IsStatic &&
+                   a.m_DebugName == b.m_DebugName;
+        }
+
+        // The instance group a packet would join under BatchCommands' rules,
+        // or nothing when it must draw on its own
+        std::optional<InstanceGroupKey> InstanceGroupOf(const CommandPacket& packet)
+        {
+            if (packet.GetCommandType() != CommandType::DrawMesh || packet.GetMetadata().m_DependsOnPrevious)
+                return std::nullopt;
+
+            auto const* cmd = packet.GetCommandData<DrawMeshCommand>();
+            if (cmd->isAnimatedMesh)
+                return std::nullopt;
+            return InstanceGroupKey{ cmd->vertexArrayID, cmd->indexCount, cmd->baseIndex,
+                                     cmd->materialDataIndex, cmd->renderStateIndex };
+        }
+
+        // Per-draw fields of an instanced command built from its first DrawMesh;
+        // the per-instance stream offsets and counts are the caller's.
+        void FillInstancedFromMesh(DrawMeshInstancedCommand& icmd, const DrawMeshCommand& first)
+        {
+            icmd.header.type = CommandType::DrawMeshInstanced;
+            icmd.header.dispatchFn = nullptr;
+            icmd.meshHandle = first.meshHandle;
+            icmd.vertexArrayID = first.vertexArrayID;
+            icmd.indexCount = first.indexCount;
+            // baseIndex was never copied here, so a batched submesh with a
+            // non-zero base drew the wrong index range. Safe now that the
+            // group key includes it (all group members share the same value).
+            icmd.baseIndex = first.baseIndex;
+            icmd.shaderHandle = first.shaderHandle;
+            icmd.materialDataIndex = first.materialDataIndex;
+            icmd.renderStateIndex = first.renderStateIndex;
+            icmd.isAnimatedMesh = first.isAnimatedMesh;
+            icmd.boneBufferOffset = first.boneBufferOffset;
+            icmd.boneCountPerInstance = first.boneCount;
+        }
+
     } // anonymous namespace
 
     void CommandBucket::SetViewStateCallbacks(ViewStateReadFn readFn, ViewStateWriteFn writeFn)
@@ -236,6 +296,9 @@ namespace OloEngine
         // The actual command memory is managed by CommandAllocator
         // We just need to clear our references
         Clear();
+
+        // Retained packets are the exception: the bucket owns their storage
+        ClearRetained();
     }
 
     CommandBucket::CommandBucket(CommandBucket&& other) noexcept
@@ -251,6 +314,8 @@ namespace OloEngine
         other.m_IsSorted = false;
         other.m_IsBatched = false;
         other.m_Stats = Statistics();
+
+        MoveRetainedFrom(other);
     }
 
     CommandBucket& CommandBucket::operator=(CommandBucket&& other) noexcept
@@ -269,6 +334,9 @@ namespace OloEngine
             other.m_IsSorted = false;
             other.m_IsBatched = false;
             other.m_Stats = Statistics();
+
+            ClearRetained();
+            MoveRetainedFrom(other);
         }
         return *this;
     }
@@ -775,15 +843,7 @@ namespace OloEngine
                 continue;
 
             auto* icmd = instancedPacket->GetCommandData<DrawMeshInstancedCommand>();
-            icmd->header.type = CommandType::DrawMeshInstanced;
-            icmd->header.dispatchFn = nullptr;
-            icmd->meshHandle = firstCmd->meshHandle;
-            icmd->vertexArrayID = firstCmd->vertexArrayID;
-            icmd->indexCount = firstCmd->indexCount;
-            // baseIndex was never copied here, so a batched submesh with a
-            // non-zero base drew the wrong index range. Safe now that the
-            // group key includes it (all group members share the same value).
-            icmd->baseIndex = firstCmd->baseIndex;
+            FillInstancedFromMesh(*icmd, *firstCmd);
             icmd->instanceCount = totalInstances;
             icmd->transformBufferOffset = transformOffset;
             icmd->transformCount = totalInstances;
@@ -792,12 +852,6 @@ namespace OloEngine
             icmd->colorBufferOffset = colorOffset;                   // UINT32_MAX when all sources had identity tint
             icmd->customBufferOffset = customOffset;                 // UINT32_MAX when all sources had Custom == 0
             icmd->lightmapRegionBufferOffset = lightmapRegionOffset; // UINT32_MAX when no source carried a lightmap region
-            icmd->shaderHandle = firstCmd->shaderHandle;
-            icmd->materialDataIndex = firstCmd->materialDataIndex;
-            icmd->renderStateIndex = firstCmd->renderStateIndex;
-            icmd->isAnimatedMesh = firstCmd->isAnimatedMesh;
-            icmd->boneBufferOffset = firstCmd->boneBufferOffset;
-            icmd->boneCountPerInstance = firstCmd->boneCount;
 
             instancedPacket->SetCommandType(icmd->header.type);
 
@@ -848,6 +902,9 @@ namespace OloEngine
 
         auto execStart = std::chrono::high_resolution_clock::now();
 
+        // Retained draws join the walk below; a no-op once this frame is staged
+        FlushRetained();
+
         // No lock needed — Execute runs exclusively on the main thread
         // during EndScene, after all submission is complete.
         m_Stats.DrawCalls = 0;
@@ -863,11 +920,11 @@ namespace OloEngine
             s_ViewStateWriter(*m_ViewState);
         }
 
-        // Execute all commands in order from the flat array
-        for (const auto* packet : m_Packets)
+        // Execute all commands in order: the flat array merged with the retained list
+        ForEachExecutionPacket([this, &rendererAPI](const CommandPacket* packet)
         {
             if (!packet)
-                continue;
+                return;
 
             if (CommandType type = packet->GetCommandType();
                 type == CommandType::DrawMesh ||
@@ -896,7 +953,7 @@ namespace OloEngine
             }
 
             packet->Execute(rendererAPI);
-        }
+        });
 
         // Restore previous view state if we changed it
         if (restoreState)
@@ -919,6 +976,9 @@ namespace OloEngine
 
         gpuTimer.BeginFrame();
 
+        // Retained draws join the walk below
+        FlushRetained();
+
         auto execStart = std::chrono::high_resolution_clock::now();
 
         // No lock needed — ExecuteWithGPUTiming runs exclusively on the main thread
@@ -936,10 +996,10 @@ namespace OloEngine
         }
 
         u32 cmdIndex = 0;
-        for (const auto* packet : m_Packets)
+        ForEachExecutionPacket([this, &rendererAPI, &gpuTimer, &cmdIndex](const CommandPacket* packet)
         {
             if (!packet)
-                continue;
+                return;
 
             if (CommandType type = packet->GetCommandType();
                 type == CommandType::DrawMesh ||
@@ -979,7 +1039,7 @@ namespace OloEngine
             }
 
             ++cmdIndex;
-        }
+        });
 
         // Restore previous view state if we changed it
         if (restoreState)
@@ -1014,6 +1074,12 @@ namespace OloEngine
 
         m_IsSorted = false;
         m_IsBatched = false;
+
+        // Retained draws survive; only this frame's instance staging and
+        // counters start over (FrameDataBuffer is reset alongside us).
+        m_RetainedFramePrepared = false;
+        m_RetainedStats = RetainedStatistics();
+        ++m_RetainedFrame;
     }
 
     // ========================================================================
@@ -1197,6 +1263,573 @@ namespace OloEngine
         }
     }
 
+    // ========================================================================
+    // Retained (cross-frame) draws
+    // ========================================================================
+
+    CommandPacket* CommandBucket::StoreRetained(const RetainedDrawID& id, const void* data, sizet size, CommandType type,
+                                                const PacketMetadata& metadata)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        const u64 key = metadata.m_SortKey.GetKey();
+
+        u32 slot = 0;
+        bool inserted = false;
+        if (auto it = m_RetainedLookup.find(id); it != m_RetainedLookup.end())
+        {
+            slot = it->second;
+            RetainedEntry& entry = m_RetainedEntries[slot];
+            entry.SubmitFrame = m_RetainedFrame;
+            CommandPacket* packet = entry.Packet;
+            if (entry.Key == key && packet->GetCommandType() == type && packet->GetCommandSize() == size &&
+                SameRetainedMetadata(packet->GetMetadata(), metadata) &&
+                std::memcmp(packet->GetRawCommandData(), data, size) == 0)
+            {
+                ++m_RetainedStats.Unchanged;
+                return packet;
+            }
+        }
+        else
+        {
+            if (!m_RetainedFreeSlots.empty())
+            {
+                slot = m_RetainedFreeSlots.back();
+                m_RetainedFreeSlots.pop_back();
+            }
+            else
+            {
+                slot = static_cast<u32>(m_RetainedEntries.size());
+                m_RetainedEntries.emplace_back();
+            }
+            m_RetainedLookup.emplace(id, slot);
+            inserted = true;
+        }
+
+        RetainedEntry& entry = m_RetainedEntries[slot];
+        if (const sizet required = sizeof(CommandPacket) + size; entry.Capacity < required)
+        {
+            FreeRetainedStorage(entry.Storage);
+            entry.Storage = AllocateRetainedStorage(required);
+            entry.Capacity = required;
+            entry.Packet = new (entry.Storage) CommandPacket();
+            // The execution list still points at the old storage
+            m_RetainedExecDirty = true;
+        }
+
+        // Same layout CommandAllocator::CreateCommandPacket produces: header, then inline data
+        CommandPacket* packet = entry.Packet;
+        std::memcpy(packet->GetRawCommandData(), data, size);
+        packet->SetCommandSize(size);
+        packet->SetCommandType(type);
+        packet->SetDispatchFunction(nullptr);
+        packet->SetMetadata(metadata);
+
+        entry.ID = id;
+        entry.SubmitFrame = m_RetainedFrame;
+        entry.Live = true;
+        if (inserted)
+        {
+            entry.Key = key;
+            entry.Batch = NO_RETAINED_BATCH;
+            QueueRetained(slot);
+            ++m_RetainedStats.Inserted;
+        }
+        else if (entry.Key != key)
+        {
+            entry.Key = key;
+            QueueRetained(slot);
+            ++m_RetainedStats.Rekeyed;
+        }
+        else
+        {
+            ++m_RetainedStats.Updated;
+        }
+
+        // Batch membership follows the new command
+        std::optional<InstanceGroupKey> group;
+        if (m_Config.EnableBatching)
+            group = InstanceGroupOf(*packet);
+
+        if (entry.Batch != NO_RETAINED_BATCH && (!group || m_RetainedBatches[entry.Batch].Key != *group))
+            LeaveRetainedBatch(slot);
+
+        if (entry.Batch != NO_RETAINED_BATCH)
+            m_RetainedBatches[entry.Batch].Dirty = true;
+        else if (group)
+            JoinRetainedBatch(slot, *group);
+
+        return packet;
+    }
+
+    bool CommandBucket::RemoveRetained(const RetainedDrawID& id)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        TUniqueLock<FMutex> lock(m_Mutex);
+
+        auto it = m_RetainedLookup.find(id);
+        if (it == m_RetainedLookup.end())
+            return false;
+
+        const u32 slot = it->second;
+        LeaveRetainedBatch(slot);
+        m_RetainedEntries[slot].Live = false;
+        m_RetainedLookup.erase(it);
+        m_RetainedFreeSlots.push_back(slot);
+
+        // The slot keeps its storage for the next insert; the merge drops it from the order
+        m_RetainedOrderDirty = true;
+        ++m_RetainedStats.Removed;
+        return true;
+    }
+
+    u32 CommandBucket::RemoveStaleRetained()
+    {
+        OLO_PROFILE_FUNCTION();
+
+        TUniqueLock<FMutex> lock(m_Mutex);
+
+        u32 removed = 0;
+        for (auto it = m_RetainedLookup.begin(); it != m_RetainedLookup.end();)
+        {
+            const u32 slot = it->second;
+            if (m_RetainedEntries[slot].SubmitFrame == m_RetainedFrame)
+            {
+                ++it;
+                continue;
+            }
+
+            LeaveRetainedBatch(slot);
+            m_RetainedEntries[slot].Live = false;
+            m_RetainedFreeSlots.push_back(slot);
+            it = m_RetainedLookup.erase(it);
+            ++removed;
+        }
+
+        if (removed > 0)
+        {
+            m_RetainedOrderDirty = true;
+            m_RetainedStats.Removed += removed;
+        }
+        return removed;
+    }
+
+    bool CommandBucket::IsRetained(const RetainedDrawID& id) const
+    {
+        TUniqueLock<FMutex> lock(m_Mutex);
+        return m_RetainedLookup.contains(id);
+    }
+
+    void CommandBucket::ClearRetained()
+    {
+        OLO_PROFILE_FUNCTION();
+
+        TUniqueLock<FMutex> lock(m_Mutex);
+
+        for (RetainedEntry& entry : m_RetainedEntries)
+            FreeRetainedStorage(entry.Storage);
+        for (RetainedBatch& batch : m_RetainedBatches)
+            FreeRetainedStorage(batch.Storage);
+
+        m_RetainedEntries.clear();
+        m_RetainedFreeSlots.clear();
+        m_RetainedLookup.clear();
+        m_RetainedOrder.clear();
+        m_RetainedPending.clear();
+        m_RetainedBatches.clear();
+        m_RetainedFreeBatches.clear();
+        m_RetainedBatchLookup.clear();
+        m_RetainedExecKeys.clear();
+        m_RetainedExecPackets.clear();
+        m_RetainedOrderDirty = false;
+        m_RetainedExecDirty = false;
+    }
+
+    void CommandBucket::MoveRetainedFrom(CommandBucket& other)
+    {
+        m_RetainedEntries = std::move(other.m_RetainedEntries);
+        m_RetainedFreeSlots = std::move(other.m_RetainedFreeSlots);
+        m_RetainedLookup = std::move(other.m_RetainedLookup);
+        m_RetainedOrder = std::move(other.m_RetainedOrder);
+        m_RetainedPending = std::move(other.m_RetainedPending);
+        m_RetainedBatches = std::move(other.m_RetainedBatches);
+        m_RetainedFreeBatches = std::move(other.m_RetainedFreeBatches);
+        m_RetainedBatchLookup = std::move(other.m_RetainedBatchLookup);
+        m_RetainedExecKeys = std::move(other.m_RetainedExecKeys);
+        m_RetainedExecPackets = std::move(other.m_RetainedExecPackets);
+        m_RetainedEpoch = other.m_RetainedEpoch;
+        m_RetainedFrame = other.m_RetainedFrame;
+        m_RetainedOrderDirty = other.m_RetainedOrderDirty;
+        m_RetainedExecDirty = other.m_RetainedExecDirty;
+        m_RetainedFramePrepared = other.m_RetainedFramePrepared;
+        m_RetainedStats = other.m_RetainedStats;
+
+        // Moved-from vectors are unspecified; make sure `other` owns no storage
+        other.m_RetainedEntries.clear();
+        other.m_RetainedBatches.clear();
+        other.m_RetainedLookup.clear();
+        other.m_RetainedBatchLookup.clear();
+        other.m_RetainedExecKeys.clear();
+        other.m_RetainedExecPackets.clear();
+        other.m_RetainedOrder.clear();
+        other.m_RetainedPending.clear();
+        other.m_RetainedFreeSlots.clear();
+        other.m_RetainedFreeBatches.clear();
+        other.m_RetainedOrderDirty = false;
+        other.m_RetainedExecDirty = false;
+        other.m_RetainedStats = RetainedStatistics();
+    }
+
+    void CommandBucket::QueueRetained(u32 slot)
+    {
+        RetainedEntry& entry = m_RetainedEntries[slot];
+        if (!entry.Queued)
+        {
+            entry.Queued = true;
+            m_RetainedPending.push_back(slot);
+        }
+        m_RetainedOrderDirty = true;
+    }
+
+    void CommandBucket::JoinRetainedBatch(u32 slot, const InstanceGroupKey& group)
+    {
+        u32 index = 0;
+        if (auto it = m_RetainedBatchLookup.find(group); it != m_RetainedBatchLookup.end())
+        {
+            index = it->second;
+        }
+        else
+        {
+            if (!m_RetainedFreeBatches.empty())
+            {
+                index = m_RetainedFreeBatches.back();
+                m_RetainedFreeBatches.pop_back();
+            }
+            else
+            {
+                index = static_cast<u32>(m_RetainedBatches.size());
+                m_RetainedBatches.emplace_back();
+            }
+
+            RetainedBatch& fresh = m_RetainedBatches[index];
+            fresh.Key = group;
+            fresh.Leader = UINT32_MAX;
+            if (!fresh.Storage)
+            {
+                // As CommandAllocator::AllocatePacketWithCommand<DrawMeshInstancedCommand>, but bucket-owned
+                fresh.Storage = AllocateRetainedStorage(sizeof(CommandPacket) + sizeof(DrawMeshInstancedCommand));
+                fresh.Packet = new (fresh.Storage) CommandPacket();
+                new (fresh.Storage + sizeof(CommandPacket)) DrawMeshInstancedCommand();
+                fresh.Packet->SetCommandSize(sizeof(DrawMeshInstancedCommand));
+                fresh.Packet->SetCommandType(CommandType::DrawMeshInstanced);
+            }
+            m_RetainedBatchLookup.emplace(group, index);
+        }
+
+        RetainedBatch& batch = m_RetainedBatches[index];
+        RetainedEntry& entry = m_RetainedEntries[slot];
+        entry.Batch = index;
+        entry.BatchSlot = static_cast<u32>(batch.Members.size());
+        batch.Members.push_back(slot);
+        batch.Dirty = true;
+        m_RetainedExecDirty = true;
+    }
+
+    void CommandBucket::LeaveRetainedBatch(u32 slot)
+    {
+        RetainedEntry& entry = m_RetainedEntries[slot];
+        if (entry.Batch == NO_RETAINED_BATCH)
+            return;
+
+        const u32 index = entry.Batch;
+        RetainedBatch& batch = m_RetainedBatches[index];
+
+        // Swap-remove; instance order within a batch carries no meaning
+        const u32 moved = batch.Members.back();
+        batch.Members[entry.BatchSlot] = moved;
+        m_RetainedEntries[moved].BatchSlot = entry.BatchSlot;
+        batch.Members.pop_back();
+
+        entry.Batch = NO_RETAINED_BATCH;
+        batch.Dirty = true;
+        m_RetainedExecDirty = true;
+
+        if (batch.Members.empty())
+        {
+            m_RetainedBatchLookup.erase(batch.Key);
+            m_RetainedFreeBatches.push_back(index);
+        }
+    }
+
+    u32 CommandBucket::ActiveInstanceCount(const RetainedBatch& batch) const
+    {
+        // A lone member draws as itself; members past the cap draw on their own, as in BatchCommands
+        if (batch.Members.size() <= 1)
+            return 0;
+        return static_cast<u32>(std::min(batch.Members.size(), static_cast<sizet>(m_Config.MaxMeshInstances)));
+    }
+
+    void CommandBucket::MergeRetainedOrder()
+    {
+        OLO_PROFILE_FUNCTION();
+
+        // What remains after dropping removed and re-keyed draws is still sorted
+        std::erase_if(m_RetainedOrder, [this](u32 slot)
+                      {
+                          const RetainedEntry& entry = m_RetainedEntries[slot];
+                          return !entry.Live || entry.Queued;
+                      });
+
+        for (u32 slot : m_RetainedPending)
+            m_RetainedEntries[slot].Queued = false;
+        std::erase_if(m_RetainedPending, [this](u32 slot)
+                      {
+                          return !m_RetainedEntries[slot].Live;
+                      });
+
+        m_RetainedStats.MergedDraws += static_cast<u32>(m_RetainedPending.size());
+
+        if (!m_Config.EnableSorting)
+        {
+            m_RetainedOrder.insert(m_RetainedOrder.end(), m_RetainedPending.begin(), m_RetainedPending.end());
+        }
+        else
+        {
+            // Only the dirty draws are sorted; one linear merge places them.
+            // Stable both ways, so equal keys keep submission order and
+            // settled draws precede newcomers — as a stable full re-sort would.
+            auto keyOf = [this](u32 slot)
+            {
+                return m_RetainedEntries[slot].Key;
+            };
+            std::ranges::stable_sort(m_RetainedPending, {}, keyOf);
+
+            m_RetainedScratch.resize(m_RetainedOrder.size() + m_RetainedPending.size());
+            std::ranges::merge(m_RetainedOrder, m_RetainedPending, m_RetainedScratch.begin(), {}, keyOf, keyOf);
+            std::swap(m_RetainedOrder, m_RetainedScratch);
+        }
+
+        m_RetainedPending.clear();
+        m_RetainedOrderDirty = false;
+        m_RetainedExecDirty = true;
+    }
+
+    void CommandBucket::RebuildRetainedExecution()
+    {
+        OLO_PROFILE_FUNCTION();
+
+        m_RetainedExecKeys.clear();
+        m_RetainedExecPackets.clear();
+        m_RetainedExecKeys.reserve(m_RetainedOrder.size());
+        m_RetainedExecPackets.reserve(m_RetainedOrder.size());
+
+        // An active batch stands in for all its members at its first member's place.
+        // An unstaged one still tracks its leader, but its members draw on their own.
+        const u32 epoch = ++m_RetainedEpoch;
+        for (u32 slot : m_RetainedOrder)
+        {
+            const RetainedEntry& entry = m_RetainedEntries[slot];
+            if (entry.Batch != NO_RETAINED_BATCH)
+            {
+                if (RetainedBatch& batch = m_RetainedBatches[entry.Batch]; entry.BatchSlot < ActiveInstanceCount(batch))
+                {
+                    if (batch.EmitEpoch != epoch)
+                    {
+                        batch.EmitEpoch = epoch;
+                        if (batch.Leader != slot)
+                        {
+                            batch.Leader = slot;
+                            batch.Dirty = true;
+                        }
+                        if (!batch.Unstaged)
+                        {
+                            m_RetainedExecKeys.push_back(entry.Key);
+                            m_RetainedExecPackets.push_back(batch.Packet);
+                            continue;
+                        }
+                    }
+                    else if (!batch.Unstaged)
+                    {
+                        continue;
+                    }
+                }
+            }
+
+            m_RetainedExecKeys.push_back(entry.Key);
+            m_RetainedExecPackets.push_back(entry.Packet);
+        }
+
+        m_RetainedExecDirty = false;
+    }
+
+    void CommandBucket::GatherRetainedBatch(RetainedBatch& batch)
+    {
+        batch.Dirty = false;
+
+        const u32 count = ActiveInstanceCount(batch);
+        if (count == 0)
+            return;
+
+        batch.Transforms.resize(count);
+        batch.PrevTransforms.resize(count);
+        batch.EntityIDs.resize(count);
+        batch.Colors.resize(count);
+        batch.Customs.resize(count);
+        batch.LightmapRegions.resize(count);
+        batch.AnyColor = false;
+        batch.AnyCustom = false;
+        batch.AnyLightmapRegion = false;
+
+        constexpr glm::vec4 defaultColor{ 1.0f };
+        constexpr f32 defaultCustom = 0.0f;
+        constexpr glm::vec4 defaultLightmapRegion{ 0.0f };
+        for (u32 t = 0; t < count; ++t)
+        {
+            auto const* cmd = m_RetainedEntries[batch.Members[t]].Packet->GetCommandData<DrawMeshCommand>();
+            batch.Transforms[t] = cmd->transform;
+            batch.PrevTransforms[t] = cmd->prevTransform;
+            batch.EntityIDs[t] = cmd->entityID;
+            batch.Colors[t] = cmd->color;
+            batch.Customs[t] = cmd->custom;
+            batch.LightmapRegions[t] = cmd->lightmapScaleOffset;
+            batch.AnyColor = batch.AnyColor || !Math::BitwiseEqual(cmd->color, defaultColor);
+            batch.AnyCustom = batch.AnyCustom || !Math::BitwiseEqual(cmd->custom, defaultCustom);
+            batch.AnyLightmapRegion = batch.AnyLightmapRegion || !Math::BitwiseEqual(cmd->lightmapScaleOffset, defaultLightmapRegion);
+        }
+
+        // The leader's key places the packet; its fields stand for the run, as in BatchCommands
+        const u32 leaderSlot = batch.Leader != UINT32_MAX ? batch.Leader : batch.Members.front();
+        const CommandPacket* leader = m_RetainedEntries[leaderSlot].Packet;
+        auto* icmd = batch.Packet->GetCommandData<DrawMeshInstancedCommand>();
+        *icmd = DrawMeshInstancedCommand{};
+        FillInstancedFromMesh(*icmd, *leader->GetCommandData<DrawMeshCommand>());
+        icmd->instanceCount = count;
+        icmd->transformCount = count;
+        batch.Packet->SetMetadata(leader->GetMetadata());
+
+        ++m_RetainedStats.RebuiltBatches;
+    }
+
+    void CommandBucket::StageRetainedBatches()
+    {
+        OLO_PROFILE_FUNCTION();
+
+        // FrameDataBuffer is per frame, so the cached streams are copied in
+        // once per frame — a bulk write per batch instead of a re-grouping.
+        FrameDataBuffer* frameBuffer = nullptr;
+        bool overflowLogged = false;
+        for (RetainedBatch& batch : m_RetainedBatches)
+        {
+            const u32 count = ActiveInstanceCount(batch);
+            if (count == 0)
+                continue;
+
+            if (!frameBuffer)
+                frameBuffer = &FrameDataBufferManager::Get();
+
+            auto* icmd = batch.Packet->GetCommandData<DrawMeshInstancedCommand>();
+            const u32 transformOffset = frameBuffer->AllocateTransforms(count);
+            // As in BatchCommands, a run that cannot be staged is left to draw as its
+            // individual members; the execution list swaps them in for the batch.
+            const bool unstaged = transformOffset == UINT32_MAX;
+            if (unstaged != batch.Unstaged)
+            {
+                batch.Unstaged = unstaged;
+                m_RetainedExecDirty = true;
+            }
+            if (unstaged)
+            {
+                if (!overflowLogged)
+                {
+                    OLO_CORE_ERROR("CommandBucket::FlushRetained: Failed to allocate {} transforms in FrameDataBuffer; "
+                                   "the retained batch draws its members individually this frame. Subsequent failures this frame will be silent.",
+                                   count);
+                    overflowLogged = true;
+                }
+                continue;
+            }
+            frameBuffer->WriteTransforms(transformOffset, batch.Transforms.data(), count);
+
+            // Optional streams degrade exactly as in BatchCommands
+            u32 prevTransformOffset = frameBuffer->AllocateTransforms(count);
+            if (prevTransformOffset != UINT32_MAX)
+                frameBuffer->WriteTransforms(prevTransformOffset, batch.PrevTransforms.data(), count);
+
+            u32 entityIDOffset = frameBuffer->AllocateEntityIDs(count);
+            if (entityIDOffset != UINT32_MAX)
+                frameBuffer->WriteEntityIDs(entityIDOffset, batch.EntityIDs.data(), count);
+
+            u32 colorOffset = batch.AnyColor ? frameBuffer->AllocateColors(count) : UINT32_MAX;
+            if (colorOffset != UINT32_MAX)
+                frameBuffer->WriteColors(colorOffset, batch.Colors.data(), count);
+
+            u32 customOffset = batch.AnyCustom ? frameBuffer->AllocateCustoms(count) : UINT32_MAX;
+            if (customOffset != UINT32_MAX)
+                frameBuffer->WriteCustoms(customOffset, batch.Customs.data(), count);
+
+            u32 lightmapRegionOffset = batch.AnyLightmapRegion ? frameBuffer->AllocateColors(count) : UINT32_MAX;
+            if (lightmapRegionOffset != UINT32_MAX)
+                frameBuffer->WriteColors(lightmapRegionOffset, batch.LightmapRegions.data(), count);
+
+            icmd->instanceCount = count;
+            icmd->transformCount = count;
+            icmd->transformBufferOffset = transformOffset;
+            icmd->prevTransformBufferOffset = prevTransformOffset;
+            icmd->entityIDBufferOffset = entityIDOffset;
+            icmd->colorBufferOffset = colorOffset;
+            icmd->customBufferOffset = customOffset;
+            icmd->lightmapRegionBufferOffset = lightmapRegionOffset;
+        }
+    }
+
+    void CommandBucket::FlushRetained()
+    {
+        OLO_PROFILE_FUNCTION();
+
+        TUniqueLock<FMutex> lock(m_Mutex);
+
+        if (m_RetainedLookup.empty() && m_RetainedExecPackets.empty() && !m_RetainedOrderDirty)
+        {
+            m_RetainedFramePrepared = true;
+            return;
+        }
+
+        auto flushStart = std::chrono::high_resolution_clock::now();
+
+        if (m_RetainedOrderDirty)
+            MergeRetainedOrder();
+        if (m_RetainedExecDirty)
+            RebuildRetainedExecution();
+
+        // Only batches a change touched are re-gathered; the rest reuse their streams
+        bool regathered = false;
+        u32 cachedBatches = 0;
+        for (RetainedBatch& batch : m_RetainedBatches)
+        {
+            if (batch.Dirty)
+            {
+                GatherRetainedBatch(batch);
+                regathered = true;
+            }
+            if (ActiveInstanceCount(batch) > 0)
+                ++cachedBatches;
+        }
+
+        if (!m_RetainedFramePrepared || regathered)
+        {
+            StageRetainedBatches();
+            m_RetainedFramePrepared = true;
+        }
+        // Staging swaps a batch for its members (or back) when FrameDataBuffer room changes
+        if (m_RetainedExecDirty)
+            RebuildRetainedExecution();
+
+        m_RetainedStats.CachedBatches = cachedBatches;
+        auto flushEnd = std::chrono::high_resolution_clock::now();
+        m_RetainedStats.FlushTimeMs += std::chrono::duration<f64, std::milli>(flushEnd - flushStart).count();
+    }
+
     void CommandBucket::Reset(CommandAllocator& allocator)
     {
         OLO_PROFILE_FUNCTION();
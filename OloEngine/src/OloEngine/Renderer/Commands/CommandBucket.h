@@ -66,6 +66,26 @@ namespace OloEngine
         }
     };
 
+    // Identity of a retained draw across frames: the owning entity and the
+    // submesh it draws. One entity with several submeshes owns several draws.
+    struct RetainedDrawID
+    {
+        u64 Entity = 0;
+        u32 Submesh = 0;
+
+        bool operator==(const RetainedDrawID& other) const = default;
+    };
+
+    struct RetainedDrawIDHash
+    {
+        sizet operator()(const RetainedDrawID& id) const
+        {
+            sizet h = std::hash<u64>{}(id.Entity);
+            h ^= std::hash<u32>{}(id.Submesh) + 0x9e3779b9 + (h << 6) + (h >> 2);
+            return h;
+        }
+    };
+
     // Maximum number of worker threads for parallel command generation
     // This should match the maximum expected worker thread count
     static constexpr u32 MAX_RENDER_WORKERS = 16;
@@ -187,7 +207,7 @@ namespace OloEngine
         // Execute with per-command GPU timing (used during capture)
         void ExecuteWithGPUTiming(RendererAPI& rendererAPI);
 
-        // Clear the bucket (doesn't free memory, just resets)
+        // Clear the bucket (doesn't free memory, just resets). Retained draws survive.
         void Clear();
 
         // Reset the bucket and free all memory
@@ -232,6 +252,119 @@ namespace OloEngine
             return m_IsBatched;
         }
 
+        // ——— Retained (cross-frame) draws ———
+        // Static draws are kept between frames instead of being resubmitted,
+        // re-sorted and re-batched every frame. Only what changed is touched:
+        // a new or re-keyed draw is sorted on its own and merged into the
+        // already-sorted retained list, and runs of batchable DrawMesh draws
+        // keep their DrawMeshInstanced packet, re-gathered only when a member
+        // changes. Execute() walks the transient packets and the retained list
+        // merged by sort key.
+        //
+        // Retained commands are replayed verbatim, so everything they index
+        // must outlive the frame: a per-frame FrameDataBuffer table index
+        // (materialDataIndex / renderStateIndex) is only valid while the caller
+        // interns the same tables in the same order, or resubmits on change.
+        // Animated meshes (per-frame bone offsets) belong in the transient path.
+        // With RendererSettings::RetainedStaticDraws on,
+        // Renderer3D::SubmitStaticPacket resubmits every visible static mesh
+        // draw each frame keyed by entity UUID (unchanged ones are no-ops) and
+        // EndScene sweeps the ones that were culled or removed with
+        // RemoveStaleRetained(). The sort key carries view depth, so a moving
+        // camera re-keys, and re-merges, every retained draw.
+
+        // Insert or update the draw `id`. Resubmitting identical data is a
+        // no-op, so callers may resubmit every frame or only on change.
+        template<typename T>
+        CommandPacket* SubmitRetained(const RetainedDrawID& id, const T& commandData, const PacketMetadata& metadata = {})
+        {
+            static_assert(sizeof(T) <= CommandAllocator::MAX_COMMAND_SIZE, "Command exceeds maximum size");
+            static_assert(std::is_trivially_copyable_v<T>,
+                          "SubmitRetained() copies the command bytes and requires trivially copyable types.");
+
+            TUniqueLock<FMutex> lock(m_Mutex);
+            return StoreRetained(id, &commandData, sizeof(T), commandData.header.type, metadata);
+        }
+
+        // Drop the draw `id`. Returns false when it was not retained.
+        bool RemoveRetained(const RetainedDrawID& id);
+
+        bool IsRetained(const RetainedDrawID& id) const;
+
+        // Drop every retained draw not submitted since the last Clear()/Reset(),
+        // for callers that resubmit their whole retained set each frame.
+        // Returns the number removed.
+        u32 RemoveStaleRetained();
+
+        // Drop every retained draw and cached batch, freeing their storage
+        void ClearRetained();
+
+        sizet GetRetainedCount() const
+        {
+            return m_RetainedLookup.size();
+        }
+
+        // Fold pending retained changes into the sorted list and stage this
+        // frame's instance data for the cached batches. Execute() does this on
+        // first use each frame (a frame ends at Clear()/Reset()); call it
+        // earlier to keep the cost out of the execute timing.
+        void FlushRetained();
+
+        // The retained execution list (sorted; static runs batched), valid
+        // after FlushRetained()
+        const std::vector<CommandPacket*>& GetRetainedPackets() const
+        {
+            return m_RetainedExecPackets;
+        }
+
+        struct RetainedStatistics
+        {
+            u32 Inserted = 0;       // New draws this frame
+            u32 Updated = 0;        // Draws whose command changed in place this frame
+            u32 Rekeyed = 0;        // Draws whose sort key changed this frame
+            u32 Removed = 0;        // Draws dropped this frame
+            u32 Unchanged = 0;      // Resubmissions that matched the retained copy
+            u32 CachedBatches = 0;  // Instanced packets standing in for static runs
+            u32 RebuiltBatches = 0; // Of those, re-gathered this frame
+            u32 MergedDraws = 0;    // Draws merge-sorted into the list this frame
+            f64 FlushTimeMs = 0.0;
+        };
+
+        RetainedStatistics GetRetainedStatistics() const
+        {
+            return m_RetainedStats;
+        }
+
+        // Visit the frame's packets in execution order: the transient packets
+        // merged by sort key with the retained list (each list keeps its own
+        // order on ties and when unsorted, so dependency chains stay intact).
+        template<typename Fn>
+        void ForEachExecutionPacket(Fn&& fn) const
+        {
+            if (m_RetainedExecPackets.empty())
+            {
+                for (const CommandPacket* packet : m_Packets)
+                    fn(packet);
+                return;
+            }
+
+            sizet transient = 0;
+            sizet retained = 0;
+            while (transient < m_Packets.size() || retained < m_RetainedExecPackets.size())
+            {
+                // Retained first on equal keys: they were there before this frame's submissions
+                if (retained < m_RetainedExecPackets.size() &&
+                    (transient == m_Packets.size() || m_RetainedExecKeys[retained] <= m_Keys[transient]))
+                {
+                    fn(m_RetainedExecPackets[retained++]);
+                }
+                else
+                {
+                    fn(m_Packets[transient++]);
+                }
+            }
+        }
+
         template<typename T>
         CommandPacket* CreateDrawCall()
         {
@@ -404,6 +537,59 @@ namespace OloEngine
         // Internal sort implementation — caller must hold m_Mutex
         void SortCommandsInternal();
 
+        // ——— Retained store internals (caller holds m_Mutex) ———
+        static constexpr u32 NO_RETAINED_BATCH = UINT32_MAX;
+
+        struct RetainedEntry
+        {
+            RetainedDrawID ID;
+            CommandPacket* Packet = nullptr; // Lives at the start of Storage
+            u8* Storage = nullptr;           // Bucket-owned; survives Clear()/Reset()
+            sizet Capacity = 0;
+            u64 Key = 0;
+            u32 Batch = NO_RETAINED_BATCH;
+            u32 BatchSlot = 0;   // Position in the batch's Members
+            u32 SubmitFrame = 0; // m_RetainedFrame of the last submission
+            bool Live = false;
+            bool Queued = false; // Awaiting merge into m_RetainedOrder
+        };
+
+        // A run of batchable retained DrawMesh draws sharing an InstanceGroupKey.
+        // The instanced packet and the gathered per-instance streams persist;
+        // only the FrameDataBuffer copy is redone each frame.
+        struct RetainedBatch
+        {
+            InstanceGroupKey Key;
+            std::vector<u32> Members; // Entry slots, in instance order
+            u32 Leader = UINT32_MAX;  // First member in sort order; its key and fields stand for the run
+            CommandPacket* Packet = nullptr;
+            u8* Storage = nullptr;
+            std::vector<glm::mat4> Transforms;
+            std::vector<glm::mat4> PrevTransforms;
+            std::vector<i32> EntityIDs;
+            std::vector<glm::vec4> Colors;
+            std::vector<f32> Customs;
+            std::vector<glm::vec4> LightmapRegions;
+            u32 EmitEpoch = 0;
+            bool AnyColor = false;
+            bool AnyCustom = false;
+            bool AnyLightmapRegion = false;
+            bool Dirty = true;
+            bool Unstaged = false; // No FrameDataBuffer room this frame; members draw individually
+        };
+
+        CommandPacket* StoreRetained(const RetainedDrawID& id, const void* data, sizet size, CommandType type,
+                                     const PacketMetadata& metadata);
+        void MoveRetainedFrom(CommandBucket& other);
+        void QueueRetained(u32 slot);
+        void JoinRetainedBatch(u32 slot, const InstanceGroupKey& group);
+        void LeaveRetainedBatch(u32 slot);
+        void MergeRetainedOrder();
+        void RebuildRetainedExecution();
+        void GatherRetainedBatch(RetainedBatch& batch);
+        void StageRetainedBatches();
+        u32 ActiveInstanceCount(const RetainedBatch& batch) const;
+
         // ——— Flat array storage (replaces linked list) ———
         // Keys and packets are stored in 1:1 correspondence.
         // Keys are pre-extracted once during AddCommand for cache-friendly sorting.
@@ -436,6 +622,25 @@ namespace OloEngine
 
         mutable FMutex m_Mutex;
 
+        // Retained store
+        std::vector<RetainedEntry> m_RetainedEntries;
+        std::vector<u32> m_RetainedFreeSlots;
+        std::unordered_map<RetainedDrawID, u32, RetainedDrawIDHash> m_RetainedLookup;
+        std::vector<u32> m_RetainedOrder;   // Live, settled slots sorted by key
+        std::vector<u32> m_RetainedPending; // Inserted / re-keyed slots awaiting merge
+        std::vector<u32> m_RetainedScratch;
+        std::vector<RetainedBatch> m_RetainedBatches;
+        std::vector<u32> m_RetainedFreeBatches;
+        std::unordered_map<InstanceGroupKey, u32, InstanceGroupKeyHash> m_RetainedBatchLookup;
+        std::vector<u64> m_RetainedExecKeys;
+        std::vector<CommandPacket*> m_RetainedExecPackets;
+        u32 m_RetainedEpoch = 0;
+        u32 m_RetainedFrame = 0; // Advanced by Clear(); stamps submissions for RemoveStaleRetained()
+        bool m_RetainedOrderDirty = false;
+        bool m_RetainedExecDirty = false;
+        bool m_RetainedFramePrepared = false;
+        RetainedStatistics m_RetainedStats;
+
         // ====================================================================
         // Thread-Local Storage for Parallel Command Generation
         // Following Molecular Matters Version 7 pattern
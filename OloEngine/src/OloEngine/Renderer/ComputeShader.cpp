@@ -5,6 +5,7 @@
 #include "OloEngine/Core/FileSystem.h"
 #include "OloEngine/Async/Async.h"
 #include "Platform/OpenGL/OpenGLComputeShader.h"
+#include "Platform/Null/NullShader.h"
 
 #if OLO_WITH_VULKAN
 // Sanctioned factory-include pattern (rhi-abstraction-boundary.md).
@@ -24,6 +25,10 @@ namespace OloEngine
                 OLO_CORE_ASSERT(false, "RendererAPI::None is currently not supported!");
                 return nullptr;
             }
+            case RendererAPI::API::Null:
+            {
+                return Ref<ComputeShader>(new NullComputeShader(filepath));
+            }
             case RendererAPI::API::Vulkan:
             {
 #if OLO_WITH_VULKAN
@@ -57,6 +62,10 @@ namespace OloEngine
                 OLO_CORE_ASSERT(false, "RendererAPI::None is currently not supported!");
                 return nullptr;
             }
+            case RendererAPI::API::Null:
+            {
+                return Ref<ComputeShader>(new NullComputeShader(name, source));
+            }
             case RendererAPI::API::Vulkan:
             {
 #if OLO_WITH_VULKAN
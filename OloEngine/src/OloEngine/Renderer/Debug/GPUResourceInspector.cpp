@@ -63,6 +63,8 @@ namespace OloEngine
                     return "OpenGL";
                 case RendererAPI::API::Vulkan:
                     return "Vulkan";
+                case RendererAPI::API::Null:
+                    return "Null";
             }
             return "Unknown";
         }
@@ -77,6 +79,8 @@ namespace OloEngine
                     return "OpenGL";
                 case RHI::Backend::Vulkan:
                     return "Vulkan";
+                case RHI::Backend::Null:
+                    return "null";
             }
             return "unknown";
         }
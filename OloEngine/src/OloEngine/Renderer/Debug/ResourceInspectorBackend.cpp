@@ -17,6 +17,7 @@ namespace OloEngine
         switch (Renderer::GetAPI())
         {
             case RendererAPI::API::None:
+            case RendererAPI::API::Null:
             {
                 // Headless / no renderer: the inspector is an optional
                 // instrument, so no backend and no assert — every entry point
@@ -18,6 +18,11 @@ namespace OloEngine
                 OLO_CORE_ASSERT(false, "RendererAPI::None is currently not supported!");
                 return nullptr;
             }
+            case RendererAPI::API::Null:
+            {
+                OLO_CORE_ASSERT(false, "RendererAPI::Null has no graphics context — the Null backend runs without a window surface or device!");
+                return nullptr;
+            }
             case RendererAPI::API::OpenGL:
             {
                 return CreateScope<OpenGLContext>(static_cast<GLFWwindow*>(window));
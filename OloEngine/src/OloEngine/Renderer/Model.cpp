@@ -2242,7 +2242,7 @@ namespace OloEngine
         // is otherwise invisible — timing it here is what makes a builder change's cost (or win)
         // measurable from a plain editor run instead of a profiler session (issue #685).
         auto const cookStart = std::chrono::steady_clock::now();
-        VirtualMeshSet const built = VirtualMeshBuilder::BuildSet(combined);
+        VirtualMeshSet const built = VirtualMeshBuilder::BuildSetCached(combined);
         auto const cookMs = std::chrono::duration<f64, std::milli>(std::chrono::steady_clock::now() - cookStart).count();
 
         if (!built.IsValid())
@@ -132,13 +132,18 @@ namespace OloEngine::PathTracing
         // its own shadow ray — deterministic and low-variance for the small
         // scenes this instrument targets) plus ONE MIS-weighted sample of the
         // emissive geometry.
-        [[nodiscard]] glm::vec3 SampleDirectLighting(const ReferenceScene& scene, const glm::vec3& position,
-                                                     const glm::vec3& geometricNormal, const glm::vec3& n,
-                                                     const glm::vec3& v, const ReferenceMaterial& material,
-                                                     const PathTracerSettings& settings, PathSampler& sampler)
+        //
+        // The shadow test is the caller's: each sample goes to `addShadowed`
+        // as its shadow segment plus the contribution it makes if that segment
+        // is clear, in a fixed order. TracePath tests them on the spot; the
+        // ray-stream path defers them into one batch. Either way the caller
+        // sums the clear ones in the order given, starting from zero.
+        template <typename ShadowFn>
+        void SampleDirectLighting(const ReferenceScene& scene, const glm::vec3& position,
+                                  const glm::vec3& geometricNormal, const glm::vec3& n,
+                                  const glm::vec3& v, const ReferenceMaterial& material,
+                                  const PathTracerSettings& settings, PathSampler& sampler, ShadowFn&& addShadowed)
         {
-            glm::vec3 direct(0.0f);
-
             for (const ReferenceLight& light : scene.GetLights())
             {
                 glm::vec3 l(0.0f);
@@ -193,12 +198,9 @@ namespace OloEngine::PathTracing
                     continue;
 
                 const glm::vec3 shadowOrigin = OffsetOrigin(position, geometricNormal, l, settings.RayEpsilon);
-                if (scene.IsOccluded(shadowOrigin, shadowTarget, settings.RayEpsilon))
-                    continue;
-
                 const glm::vec3 radiance = light.Color * light.Intensity * attenuation;
                 const glm::vec3 brdf = EvaluateBRDF(material, n, v, l);
-                direct += brdf * radiance * nDotL;
+                addShadowed(ShadowSegment{ shadowOrigin, shadowTarget }, brdf * radiance * nDotL);
             }
 
             // ---- emissive geometry, area-sampled, MIS-weighted --------------
@@ -232,20 +234,313 @@ namespace OloEngine::PathTracing
                             {
                                 const glm::vec3 shadowOrigin =
                                     OffsetOrigin(position, geometricNormal, l, settings.RayEpsilon);
-                                if (!scene.IsOccluded(shadowOrigin, lightSample.Position, settings.RayEpsilon))
-                                {
-                                    const glm::vec3 brdf = EvaluateBRDF(material, n, v, l);
-                                    const f32 pdfBsdf = BsdfPdf(n, v, l, material);
-                                    const f32 misWeight = PowerHeuristic(pdfSolidAngle, pdfBsdf);
-                                    direct += brdf * nDotL * lightSample.Radiance * (misWeight / pdfSolidAngle);
-                                }
+                                const glm::vec3 brdf = EvaluateBRDF(material, n, v, l);
+                                const f32 pdfBsdf = BsdfPdf(n, v, l, material);
+                                const f32 misWeight = PowerHeuristic(pdfSolidAngle, pdfBsdf);
+                                addShadowed(ShadowSegment{ shadowOrigin, lightSample.Position },
+                                            brdf * nDotL * lightSample.Radiance * (misWeight / pdfSolidAngle));
                             }
                         }
                     }
                 }
             }
+        }
+
+        // One path in flight. TracePath runs one to completion; the ray-stream
+        // integrator keeps a wavefront of them and advances every live path by
+        // one vertex per pass. Both step it with AdvancePath, which is what
+        // keeps the two bit-identical.
+        struct PathState
+        {
+            PathState(const Ray& primaryRay, const PathSampler& sampler)
+                : CurrentRay(primaryRay), Sampler(sampler)
+            {
+            }
+
+            Ray CurrentRay;
+            PathSampler Sampler;
+            glm::vec3 Radiance{ 0.0f };
+            glm::vec3 Throughput{ 1.0f };
+            // Throughput at the vertex whose NEE samples are awaiting their
+            // shadow rays.
+            glm::vec3 DirectThroughput{ 0.0f };
+            f32 PreviousBsdfPdf = 0.0f;
+            u32 Bounce = 0;
+            // The camera ray is treated as a "delta" scatter: an emitter seen
+            // directly is added at full weight because NEE never had a chance
+            // to sample it for this vertex.
+            bool PreviousScatterWasDelta = true;
+            bool Active = true;
+        };
+
+        // Advance a path across the result of tracing its current ray: collect
+        // the environment on a miss, or emission, NEE (through `addShadowed`,
+        // see SampleDirectLighting), a BSDF sample and Russian roulette on a
+        // hit. Returns false once the path has ended. NEE samples handed out on
+        // the final vertex still count — the caller adds them as
+        // `DirectThroughput * direct` once their shadow rays are resolved.
+        template <typename ShadowFn>
+        [[nodiscard]] bool AdvancePath(const ReferenceScene& scene, const PathTracerSettings& settings, PathState& path,
+                                       const SurfaceInteraction& hit, ShadowFn&& addShadowed)
+        {
+            if (!hit.Hit)
+            {
+                // The environment is uniform and is never NEE-sampled, so it
+                // always arrives at full weight.
+                path.Radiance += path.Throughput * scene.GetEnvironment().Radiance;
+                return false;
+            }
+
+            const bool neeSamplesEmitters = settings.EnableNextEventEstimation && !scene.GetEmissiveTriangles().empty();
+            const ReferenceMaterial& material = scene.GetMaterial(hit.MaterialIndex);
+            const glm::vec3 v = -path.CurrentRay.Direction;
+
+            // ---- emitted radiance --------------------------------------------
+            const f32 cosEmitter = glm::dot(hit.GeometricNormal, v);
+            const bool emitterFaceVisible = material.TwoSidedEmission ? (std::abs(cosEmitter) > 0.0f)
+                                                                      : (cosEmitter > 0.0f);
+            if (emitterFaceVisible && std::max({ material.Emissive.x, material.Emissive.y, material.Emissive.z }) > 0.0f)
+            {
+                f32 misWeight = 1.0f;
+                if (!path.PreviousScatterWasDelta && neeSamplesEmitters)
+                {
+                    // This vertex could also have been reached by the NEE
+                    // sample taken at the PREVIOUS vertex; weight the two
+                    // strategies with the same densities NEE used.
+                    const f32 effectiveCos = material.TwoSidedEmission ? std::abs(cosEmitter) : cosEmitter;
+                    if (effectiveCos > 0.0f)
+                    {
+                        const f32 pdfLightSolidAngle =
+                            scene.EmissivePdfArea() * (hit.Distance * hit.Distance) / effectiveCos;
+                        misWeight = PowerHeuristic(path.PreviousBsdfPdf, pdfLightSolidAngle);
+                    }
+                }
+                path.Radiance += path.Throughput * material.Emissive * misWeight;
+            }
+
+            // ---- shading frame ------------------------------------------------
+            // Two-sided shading: flip the normal to the side the viewer is on,
+            // exactly like a two-sided raster material. Both normals flip
+            // together so the ray-offset side stays consistent with shading.
+            glm::vec3 shadingNormal = hit.ShadingNormal;
+            glm::vec3 geometricNormal = hit.GeometricNormal;
+            if (glm::dot(geometricNormal, v) < 0.0f)
+            {
+                shadingNormal = -shadingNormal;
+                geometricNormal = -geometricNormal;
+            }
+
+            // ---- next-event estimation ---------------------------------------
+            if (settings.EnableNextEventEstimation)
+            {
+                path.DirectThroughput = path.Throughput;
+                SampleDirectLighting(scene, hit.Position, geometricNormal, shadingNormal, v, material, settings,
+                                     path.Sampler, addShadowed);
+            }
+
+            // Last allowed vertex: stop before scattering. (MaxBounces == 1 is
+            // therefore "direct lighting only".)
+            if (path.Bounce + 1 >= settings.MaxBounces)
+                return false;
+
+            // ---- BSDF sample --------------------------------------------------
+            BsdfSample bsdf;
+            if (!SampleBsdf(shadingNormal, v, material, path.Sampler, bsdf))
+                return false;
+
+            const f32 nDotL = glm::dot(shadingNormal, bsdf.Direction);
+            path.Throughput *= bsdf.Value * nDotL / bsdf.Pdf;
+            path.PreviousBsdfPdf = bsdf.Pdf;
+            path.PreviousScatterWasDelta = false;
+
+            if (!(std::max({ path.Throughput.x, path.Throughput.y, path.Throughput.z }) > 0.0f))
+                return false;
+
+            // ---- Russian roulette ---------------------------------------------
+            if (settings.RussianRouletteStartBounce > 0 && path.Bounce + 1 >= settings.RussianRouletteStartBounce)
+            {
+                const f32 survival = std::clamp(std::max({ path.Throughput.x, path.Throughput.y, path.Throughput.z }), 0.05f, 0.95f);
+                if (path.Sampler.Get1D() >= survival)
+                    return false;
+                path.Throughput /= survival;
+            }
+
+            path.CurrentRay = Ray(OffsetOrigin(hit.Position, geometricNormal, bsdf.Direction, settings.RayEpsilon),
+                                  bsdf.Direction, 0.0f, std::numeric_limits<f32>::max());
+            ++path.Bounce;
+            return true;
+        }
+
+        // A finished path's radiance estimate, clamped if the settings ask.
+        [[nodiscard]] glm::vec3 FinishPath(const PathTracerSettings& settings, const PathState& path)
+        {
+            glm::vec3 radiance = path.Radiance;
+            if (settings.MaxRadianceClamp > 0.0f)
+                radiance = glm::min(radiance, glm::vec3(settings.MaxRadianceClamp));
+
+            // A NaN here would propagate through the whole accumulation buffer
+            // and silently poison every region mean computed from it. Drop the
+            // sample instead — and note it is a *drop*, so a scene that
+            // produces them will read as too dark rather than as garbage.
+            if (!std::isfinite(radiance.x) || !std::isfinite(radiance.y) || !std::isfinite(radiance.z))
+                return glm::vec3(0.0f);
+
+            return radiance;
+        }
+
+        // Spreads the low 9 bits of `v` to every third bit.
+        [[nodiscard]] u32 SpreadBits3(u32 v)
+        {
+            v &= 0x1FFu;
+            v = (v | (v << 16)) & 0x030000FFu;
+            v = (v | (v << 8)) & 0x0300F00Fu;
+            v = (v | (v << 4)) & 0x030C30C3u;
+            v = (v | (v << 2)) & 0x09249249u;
+            return v;
+        }
+
+        // Ray-stream sort key: the direction octant in the top bits, then a
+        // 27-bit Morton code of the origin within the scene bounds. Rays that
+        // share a key prefix leave from nearby points in the same general
+        // direction, so they visit mostly the same nodes.
+        class RayStreamKeyer
+        {
+          public:
+            explicit RayStreamKeyer(const BoundingBox& bounds)
+                : m_Min(bounds.Min)
+            {
+                const glm::vec3 extent = bounds.Max - bounds.Min;
+                for (glm::length_t axis = 0; axis < 3; ++axis)
+                    m_Scale[axis] = extent[axis] > 0.0f ? 511.0f / extent[axis] : 0.0f;
+            }
+
+            [[nodiscard]] u32 operator()(const glm::vec3& origin, const glm::vec3& direction) const
+            {
+                u32 cell[3];
+                for (glm::length_t axis = 0; axis < 3; ++axis)
+                {
+                    // Origins can sit a ray-epsilon outside the bounds; NaN and
+                    // out-of-range values clamp rather than wrap.
+                    const f32 scaled = (origin[axis] - m_Min[axis]) * m_Scale[axis];
+                    cell[axis] = scaled > 0.0f ? static_cast<u32>(std::min(scaled, 511.0f)) : 0u;
+                }
+                const u32 octant = (direction.x < 0.0f ? 1u : 0u) | (direction.y < 0.0f ? 2u : 0u) | (direction.z < 0.0f ? 4u : 0u);
+                return (octant << 27) | (SpreadBits3(cell[0]) << 2) | (SpreadBits3(cell[1]) << 1) | SpreadBits3(cell[2]);
+            }
+
+          private:
+            glm::vec3 m_Min;
+            glm::vec3 m_Scale{ 0.0f };
+        };
+
+        // Sort entry: the key in the high word, the stream index in the low
+        // word as the tie-break, so the order is a pure function of the stream.
+        [[nodiscard]] u64 MakeSortEntry(u32 key, u32 index)
+        {
+            return (static_cast<u64>(key) << 32) | index;
+        }
+
+        [[nodiscard]] u32 SortEntryIndex(u64 entry)
+        {
+            return static_cast<u32>(entry & 0xFFFFFFFFu);
+        }
+
+        // Run every path in `paths` to completion as a ray stream. Each pass
+        // traces one sorted wavefront of extension rays, advances every path
+        // that was live, then traces the wavefront's shadow rays, also sorted,
+        // and credits each path's clear NEE samples in the order it produced
+        // them.
+        void TracePathStream(const ReferenceScene& scene, const PathTracerSettings& settings, std::vector<PathState>& paths)
+        {
+            const RayStreamKeyer keyer(scene.GetWorldBounds());
+
+            std::vector<u64> order;
+            std::vector<Ray> rays;
+            std::vector<SurfaceInteraction> hits;
+
+            std::vector<ShadowSegment> segments;      // in the order NEE produced them
+            std::vector<glm::vec3> contributions;     // parallel to segments
+            std::vector<u32> owners;                  // parallel to segments
+            std::vector<u64> shadowOrder;
+            std::vector<ShadowSegment> sortedSegments;
+            std::vector<u8> sortedOccluded;
+            std::vector<u8> occluded;                 // parallel to segments
+
+            std::vector<u32> shadedPaths;
+            std::vector<glm::vec3> direct(paths.size(), glm::vec3(0.0f));
+
+            for (PathState& path : paths)
+                path.Active = path.Active && settings.MaxBounces > 0;
+
+            for (;;)
+            {
+                order.clear();
+                for (u32 i = 0; i < static_cast<u32>(paths.size()); ++i)
+                {
+                    if (paths[i].Active)
+                        order.push_back(MakeSortEntry(keyer(paths[i].CurrentRay.Origin, paths[i].CurrentRay.Direction), i));
+                }
+                if (order.empty())
+                    break;
+                std::sort(order.begin(), order.end());
+
+                rays.resize(order.size());
+                hits.resize(order.size());
+                for (sizet k = 0; k < order.size(); ++k)
+                    rays[k] = paths[SortEntryIndex(order[k])].CurrentRay;
+                scene.IntersectStream(rays, hits);
+
+                segments.clear();
+                contributions.clear();
+                owners.clear();
+                shadedPaths.clear();
+                for (sizet k = 0; k < order.size(); ++k)
+                {
+                    const u32 index = SortEntryIndex(order[k]);
+                    PathState& path = paths[index];
+                    if (hits[k].Hit && settings.EnableNextEventEstimation)
+                    {
+                        shadedPaths.push_back(index);
+                        direct[index] = glm::vec3(0.0f);
+                    }
+                    path.Active = AdvancePath(scene, settings, path, hits[k],
+                                              [&](const ShadowSegment& segment, const glm::vec3& contribution)
+                                              {
+                                                  segments.push_back(segment);
+                                                  contributions.push_back(contribution);
+                                                  owners.push_back(index);
+                                              });
+                }
+
+                if (!segments.empty())
+                {
+                    shadowOrder.resize(segments.size());
+                    for (u32 s = 0; s < static_cast<u32>(segments.size()); ++s)
+                        shadowOrder[s] = MakeSortEntry(keyer(segments[s].From, segments[s].To - segments[s].From), s);
+                    std::sort(shadowOrder.begin(), shadowOrder.end());
+
+                    sortedSegments.resize(segments.size());
+                    sortedOccluded.resize(segments.size());
+                    for (sizet k = 0; k < shadowOrder.size(); ++k)
+                        sortedSegments[k] = segments[SortEntryIndex(shadowOrder[k])];
+                    scene.OccludedStream(sortedSegments, settings.RayEpsilon, sortedOccluded);
+
+                    occluded.resize(segments.size());
+                    for (sizet k = 0; k < shadowOrder.size(); ++k)
+                        occluded[SortEntryIndex(shadowOrder[k])] = sortedOccluded[k];
+
+                    // Back in production order, so each path's samples are
+                    // summed exactly as TracePath sums them.
+                    for (sizet s = 0; s < segments.size(); ++s)
+                    {
+                        if (occluded[s] == 0)
+                            direct[owners[s]] += contributions[s];
+                    }
+                }
 
-            return direct;
+                for (const u32 index : shadedPaths)
+                    paths[index].Radiance += paths[index].DirectThroughput * direct[index];
+            }
         }
     } // namespace
 
@@ -405,117 +700,27 @@ namespace OloEngine::PathTracing
     glm::vec3 PathTracer::TracePath(const ReferenceScene& scene, const Ray& primaryRay,
                                     const PathTracerSettings& settings, PathSampler& sampler)
     {
-        glm::vec3 radiance(0.0f);
-        glm::vec3 throughput(1.0f);
-        Ray ray = primaryRay;
-
-        // The camera ray is treated as a "delta" scatter: an emitter seen
-        // directly is added at full weight because NEE never had a chance to
-        // sample it for this vertex.
-        bool previousScatterWasDelta = true;
-        f32 previousBsdfPdf = 0.0f;
-
-        const bool hasEmissiveGeometry = !scene.GetEmissiveTriangles().empty();
-        const bool neeSamplesEmitters = settings.EnableNextEventEstimation && hasEmissiveGeometry;
+        PathState path(primaryRay, sampler);
+        path.Active = settings.MaxBounces > 0;
 
-        for (u32 bounce = 0; bounce < settings.MaxBounces; ++bounce)
+        while (path.Active)
         {
             SurfaceInteraction hit;
-            if (!scene.Intersect(ray, hit))
-            {
-                // The environment is uniform and is never NEE-sampled, so it
-                // always arrives at full weight.
-                radiance += throughput * scene.GetEnvironment().Radiance;
-                break;
-            }
+            (void)scene.Intersect(path.CurrentRay, hit);
 
-            const ReferenceMaterial& material = scene.GetMaterial(hit.MaterialIndex);
-            const glm::vec3 v = -ray.Direction;
-
-            // ---- emitted radiance --------------------------------------------
-            const f32 cosEmitter = glm::dot(hit.GeometricNormal, v);
-            const bool emitterFaceVisible = material.TwoSidedEmission ? (std::abs(cosEmitter) > 0.0f)
-                                                                      : (cosEmitter > 0.0f);
-            if (emitterFaceVisible && std::max({ material.Emissive.x, material.Emissive.y, material.Emissive.z }) > 0.0f)
-            {
-                f32 misWeight = 1.0f;
-                if (!previousScatterWasDelta && neeSamplesEmitters)
-                {
-                    // This vertex could also have been reached by the NEE
-                    // sample taken at the PREVIOUS vertex; weight the two
-                    // strategies with the same densities NEE used.
-                    const f32 effectiveCos = material.TwoSidedEmission ? std::abs(cosEmitter) : cosEmitter;
-                    if (effectiveCos > 0.0f)
-                    {
-                        const f32 pdfLightSolidAngle =
-                            scene.EmissivePdfArea() * (hit.Distance * hit.Distance) / effectiveCos;
-                        misWeight = PowerHeuristic(previousBsdfPdf, pdfLightSolidAngle);
-                    }
-                }
-                radiance += throughput * material.Emissive * misWeight;
-            }
-
-            // ---- shading frame ------------------------------------------------
-            // Two-sided shading: flip the normal to the side the viewer is on,
-            // exactly like a two-sided raster material. Both normals flip
-            // together so the ray-offset side stays consistent with shading.
-            glm::vec3 shadingNormal = hit.ShadingNormal;
-            glm::vec3 geometricNormal = hit.GeometricNormal;
-            if (glm::dot(geometricNormal, v) < 0.0f)
-            {
-                shadingNormal = -shadingNormal;
-                geometricNormal = -geometricNormal;
-            }
-
-            // ---- next-event estimation ---------------------------------------
-            if (settings.EnableNextEventEstimation)
-            {
-                radiance += throughput * SampleDirectLighting(scene, hit.Position, geometricNormal, shadingNormal,
-                                                              v, material, settings, sampler);
-            }
-
-            // Last allowed vertex: stop before scattering. (MaxBounces == 1 is
-            // therefore "direct lighting only".)
-            if (bounce + 1 >= settings.MaxBounces)
-                break;
-
-            // ---- BSDF sample --------------------------------------------------
-            BsdfSample bsdf;
-            if (!SampleBsdf(shadingNormal, v, material, sampler, bsdf))
-                break;
-
-            const f32 nDotL = glm::dot(shadingNormal, bsdf.Direction);
-            throughput *= bsdf.Value * nDotL / bsdf.Pdf;
-            previousBsdfPdf = bsdf.Pdf;
-            previousScatterWasDelta = false;
-
-            if (!(std::max({ throughput.x, throughput.y, throughput.z }) > 0.0f))
-                break;
-
-            // ---- Russian roulette ---------------------------------------------
-            if (settings.RussianRouletteStartBounce > 0 && bounce + 1 >= settings.RussianRouletteStartBounce)
-            {
-                const f32 survival = std::clamp(std::max({ throughput.x, throughput.y, throughput.z }), 0.05f, 0.95f);
-                if (sampler.Get1D() >= survival)
-                    break;
-                throughput /= survival;
-            }
-
-            ray = Ray(OffsetOrigin(hit.Position, geometricNormal, bsdf.Direction, settings.RayEpsilon),
-                      bsdf.Direction, 0.0f, std::numeric_limits<f32>::max());
+            glm::vec3 direct(0.0f);
+            path.Active = AdvancePath(scene, settings, path, hit,
+                                      [&](const ShadowSegment& segment, const glm::vec3& contribution)
+                                      {
+                                          if (!scene.IsOccluded(segment.From, segment.To, settings.RayEpsilon))
+                                              direct += contribution;
+                                      });
+            if (hit.Hit && settings.EnableNextEventEstimation)
+                path.Radiance += path.DirectThroughput * direct;
         }
 
-        if (settings.MaxRadianceClamp > 0.0f)
-            radiance = glm::min(radiance, glm::vec3(settings.MaxRadianceClamp));
-
-        // A NaN here would propagate through the whole accumulation buffer and
-        // silently poison every region mean computed from it. Drop the sample
-        // instead — and note it is a *drop*, so a scene that produces them will
-        // read as too dark rather than as garbage.
-        if (!std::isfinite(radiance.x) || !std::isfinite(radiance.y) || !std::isfinite(radiance.z))
-            return glm::vec3(0.0f);
-
-        return radiance;
+        sampler = path.Sampler;
+        return FinishPath(settings, path);
     }
 
     void PathTracer::Render(const ReferenceScene& scene, const ReferenceCamera& camera,
@@ -562,6 +767,39 @@ namespace OloEngine::PathTracing
             [&](i32 rowIndex)
             {
                 const auto y = static_cast<u32>(rowIndex);
+                if (settings.UseRayStreams)
+                {
+                    // The whole row's paths as one stream: width * spp paths,
+                    // pixel-major and sample-ascending, so the sum below walks
+                    // each pixel's samples in the same order as the loop in
+                    // the scalar branch.
+                    std::vector<PathState> paths;
+                    paths.reserve(static_cast<sizet>(width) * settings.SamplesPerPixel);
+                    for (u32 x = 0; x < width; ++x)
+                    {
+                        const u32 pixelSeed = MakePixelSeed(x, y, settings.Seed);
+                        for (u32 sample = 0; sample < settings.SamplesPerPixel; ++sample)
+                        {
+                            PathSampler sampler(pixelSeed, sample);
+                            const glm::vec2 jitter = sampler.Get2D();
+                            const glm::vec2 screenUV((static_cast<f32>(x) + jitter.x) * invWidth,
+                                                     (static_cast<f32>(y) + jitter.y) * invHeight);
+                            paths.emplace_back(camera.GenerateRay(screenUV), sampler);
+                        }
+                    }
+
+                    TracePathStream(scene, settings, paths);
+
+                    for (u32 x = 0; x < width; ++x)
+                    {
+                        glm::vec3 accumulated(0.0f);
+                        for (u32 sample = 0; sample < settings.SamplesPerPixel; ++sample)
+                            accumulated += FinishPath(settings, paths[static_cast<sizet>(x) * settings.SamplesPerPixel + sample]);
+                        pixels[static_cast<sizet>(y) * width + x] = accumulated * invSamples;
+                    }
+                    return;
+                }
+
                 for (u32 x = 0; x < width; ++x)
                 {
                     const u32 pixelSeed = MakePixelSeed(x, y, settings.Seed);
@@ -613,4 +851,58 @@ namespace OloEngine::PathTracing
 
         return glm::vec3(sum / static_cast<f64>(settings.SamplesPerPixel));
     }
+
+    void PathTracer::EstimateIrradianceBatch(const ReferenceScene& scene, std::span<const IrradianceQuery> queries,
+                                             const PathTracerSettings& settings, std::span<glm::vec3> outIrradiance)
+    {
+        OLO_CORE_ASSERT(outIrradiance.size() >= queries.size(), "PathTracer::EstimateIrradianceBatch: output shorter than the query list");
+
+        if (!settings.UseRayStreams)
+        {
+            for (sizet q = 0; q < queries.size(); ++q)
+                outIrradiance[q] = EstimateIrradiance(scene, queries[q].Position, queries[q].Normal, settings, queries[q].Seed);
+            return;
+        }
+
+        if (!scene.IsBuilt() || settings.SamplesPerPixel == 0)
+        {
+            std::fill_n(outIrradiance.begin(), queries.size(), glm::vec3(0.0f));
+            return;
+        }
+
+        // Same sample setup as EstimateIrradiance, recording which query each
+        // path belongs to. Paths are query-major and sample-ascending, so the
+        // per-query sum below runs in the scalar loop's order.
+        std::vector<PathState> paths;
+        std::vector<u32> pathQuery;
+        paths.reserve(queries.size() * settings.SamplesPerPixel);
+        pathQuery.reserve(queries.size() * settings.SamplesPerPixel);
+        for (u32 q = 0; q < static_cast<u32>(queries.size()); ++q)
+        {
+            const f32 normalLengthSq = glm::dot(queries[q].Normal, queries[q].Normal);
+            if (!(normalLengthSq > 0.0f))
+                continue;
+            const glm::vec3 n = queries[q].Normal * glm::inversesqrt(normalLengthSq);
+
+            for (u32 sample = 0; sample < settings.SamplesPerPixel; ++sample)
+            {
+                PathSampler sampler(queries[q].Seed, sample);
+                const glm::vec3 direction = CosineSampleHemisphere(sampler.Get2D(), n);
+                if (glm::dot(direction, n) <= 0.0f)
+                    continue;
+
+                paths.emplace_back(Ray(queries[q].Position + n * settings.RayEpsilon, direction, 0.0f, std::numeric_limits<f32>::max()),
+                                   sampler);
+                pathQuery.push_back(q);
+            }
+        }
+
+        TracePathStream(scene, settings, paths);
+
+        std::vector<glm::dvec3> sums(queries.size(), glm::dvec3(0.0));
+        for (sizet p = 0; p < paths.size(); ++p)
+            sums[pathQuery[p]] += glm::dvec3(FinishPath(settings, paths[p])) * static_cast<f64>(kPi);
+        for (sizet q = 0; q < queries.size(); ++q)
+            outIrradiance[q] = glm::vec3(sums[q] / static_cast<f64>(settings.SamplesPerPixel));
+    }
 } // namespace OloEngine::PathTracing
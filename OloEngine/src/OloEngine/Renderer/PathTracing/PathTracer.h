@@ -37,6 +37,18 @@
 // pixel's samples are always summed by ONE thread in ascending sample order, so
 // the floating-point accumulation order is fixed. Parallelism is over pixels
 // only. Do not "optimise" this by splitting a pixel's samples across threads.
+//
+// RAY STREAMS
+// -----------
+// `PathTracerSettings::UseRayStreams` swaps the per-path loop for a wavefront:
+// every path of a row (Render) or of a batch of irradiance queries is created
+// up front, and each pass traces one ray per live path — sorted by direction
+// octant and origin so neighbouring rays walk the same BVH nodes while they
+// are hot — then shades them all, then traces the NEE shadow rays the same
+// way. It changes WHEN a path's rays are traced, never what they are: each
+// path still draws its own sampler dimensions in its own order and is still
+// summed into its pixel in ascending sample order, so a streamed render is
+// bit-identical to a scalar one.
 // =============================================================================
 
 #include "OloEngine/Core/Base.h"
@@ -45,6 +57,7 @@
 
 #include <glm/glm.hpp>
 
+#include <span>
 #include <vector>
 
 namespace OloEngine::PathTracing
@@ -103,6 +116,18 @@ namespace OloEngine::PathTracing
         // Force single-threaded evaluation (diagnostics: proving the parallel
         // and sequential renders agree bit-for-bit).
         bool ForceSingleThread = false;
+        // Trace in ray streams (see RAY STREAMS above). Same result bit for
+        // bit; faster once the scene's BVHs stop fitting in cache.
+        bool UseRayStreams = false;
+    };
+
+    // One point/normal for PathTracer::EstimateIrradianceBatch, with the seed
+    // EstimateIrradiance would be given for it.
+    struct IrradianceQuery
+    {
+        glm::vec3 Position{ 0.0f };
+        glm::vec3 Normal{ 0.0f, 1.0f, 0.0f };
+        u32 Seed = 0;
     };
 
     // -------------------------------------------------------------------------
@@ -190,5 +215,14 @@ namespace OloEngine::PathTracing
         [[nodiscard]] static glm::vec3 EstimateIrradiance(const ReferenceScene& scene, const glm::vec3& position,
                                                           const glm::vec3& normal, const PathTracerSettings& settings,
                                                           u32 pixelSeed);
+
+        // EstimateIrradiance for every query, written to the matching slot of
+        // `outIrradiance` (which must be at least as long). Each value is
+        // bit-identical to the single-query call; with UseRayStreams the whole
+        // batch's paths are traced as one stream, so callers should batch
+        // spatially coherent queries (a tile of lightmap texels, say). Runs on
+        // the calling thread.
+        static void EstimateIrradianceBatch(const ReferenceScene& scene, std::span<const IrradianceQuery> queries,
+                                            const PathTracerSettings& settings, std::span<glm::vec3> outIrradiance);
     };
 } // namespace OloEngine::PathTracing
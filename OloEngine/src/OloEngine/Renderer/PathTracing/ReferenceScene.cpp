@@ -247,7 +247,7 @@ namespace OloEngine::PathTracing
     void ReferenceScene::SubdivideTLAS(u32 nodeIndex, u32 depth)
     {
         // Iterative to keep the recursion depth off the C stack, mirroring
-        // BoundingVolumeHierarchy::Subdivide.
+        // BoundingVolumeHierarchy::BuildSubtree.
         struct Work
         {
             u32 NodeIndex;
@@ -267,7 +267,8 @@ namespace OloEngine::PathTracing
 
             // Split on the largest axis of the CENTROID bounds at the spatial
             // midpoint, with an object-median fallback when the midpoint leaves
-            // one side empty (identical policy to the bottom-level BVH).
+            // one side empty. The bottom-level BVH uses SAH; the instance count
+            // here is small enough that the cheaper split is fine.
             glm::vec3 centroidMin(std::numeric_limits<f32>::max());
             glm::vec3 centroidMax(std::numeric_limits<f32>::lowest());
             for (u32 i = 0; i < node.Count; ++i)
@@ -579,6 +580,131 @@ namespace OloEngine::PathTracing
         return false;
     }
 
+    void ReferenceScene::IntersectStream(std::span<const Ray> rays, std::span<SurfaceInteraction> outHits) const
+    {
+        OLO_CORE_ASSERT(outHits.size() >= rays.size(), "ReferenceScene::IntersectStream: output shorter than the ray stream");
+        for (sizet i = 0; i < rays.size(); ++i)
+            (void)Intersect(rays[i], outHits[i]);
+    }
+
+    void ReferenceScene::OccludedStream(std::span<const ShadowSegment> segments, f32 epsilon, std::span<u8> outOccluded) const
+    {
+        OLO_CORE_ASSERT(m_Built, "ReferenceScene::OccludedStream on an unbuilt or stale scene — call Build() after the last Add*()");
+        OLO_CORE_ASSERT(outOccluded.size() >= segments.size(), "ReferenceScene::OccludedStream: output shorter than the segment stream");
+        std::fill_n(outOccluded.begin(), segments.size(), u8{ 0 });
+        if (m_TLASNodes.empty() || segments.empty())
+            return;
+
+        // The same world rays IsOccluded builds, one per segment.
+        std::vector<Ray> rays(segments.size());
+        std::vector<glm::vec3> invDirs(segments.size());
+        std::vector<u32> pool;
+        pool.reserve(segments.size() * 2);
+        for (u32 i = 0; i < static_cast<u32>(segments.size()); ++i)
+        {
+            const glm::vec3 delta = segments[i].To - segments[i].From;
+            const f32 distance = glm::length(delta);
+            if (!(distance > 2.0f * epsilon))
+                continue;
+
+            Ray& ray = rays[i];
+            ray.Origin = segments[i].From;
+            ray.Direction = delta / distance;
+            ray.TMin = epsilon;
+            ray.TMax = distance - epsilon;
+            invDirs[i] = glm::vec3(1.0f / ray.Direction.x, 1.0f / ray.Direction.y, 1.0f / ray.Direction.z);
+            pool.push_back(i);
+        }
+
+        // Walk the TLAS once for the whole batch. Each stack entry owns a run
+        // of segment indices in `pool`; runs are pushed and popped in stack
+        // order, so the pool shrinks back as subtrees finish.
+        struct StreamEntry
+        {
+            u32 Node;
+            u32 Begin;
+            u32 End;
+        };
+
+        StreamEntry stack[s_TraversalStackSize];
+        u32 stackSize = 0;
+        stack[stackSize++] = { 0, 0, static_cast<u32>(pool.size()) };
+
+        std::vector<Ray> localRays;
+        std::vector<u32> localOwners;
+        std::vector<u8> localOccluded;
+
+        while (stackSize > 0)
+        {
+            const StreamEntry entry = stack[--stackSize];
+            const TLASNode& node = m_TLASNodes[entry.Node];
+
+            u32 live = 0;
+            for (u32 k = entry.Begin; k < entry.End; ++k)
+            {
+                const u32 index = pool[k];
+                if (outOccluded[index] != 0)
+                    continue;
+
+                f32 tNear = 0.0f;
+                if (!RayIntersect::RayAABB(rays[index].Origin, invDirs[index], node.Bounds.Min, node.Bounds.Max,
+                                           rays[index].TMin, rays[index].TMax, tNear))
+                    continue;
+                pool[entry.Begin + live++] = index;
+            }
+            pool.resize(entry.Begin + live);
+            if (live == 0)
+                continue;
+
+            if (node.IsLeaf())
+            {
+                for (u32 i = 0; i < node.Count; ++i)
+                {
+                    // Local rays built exactly as OccludedInstance builds them,
+                    // then handed to the instance's BVH as one batch.
+                    const ReferenceInstance& instance = m_Instances[m_TLASInstanceRefs[node.LeftFirst + i]];
+                    localRays.clear();
+                    localOwners.clear();
+                    for (u32 k = entry.Begin; k < entry.Begin + live; ++k)
+                    {
+                        const u32 index = pool[k];
+                        if (outOccluded[index] != 0)
+                            continue;
+
+                        const Ray& ray = rays[index];
+                        const glm::vec3 localDirRaw = glm::vec3(instance.InverseTransform * glm::vec4(ray.Direction, 0.0f));
+                        const f32 localDirLength = glm::length(localDirRaw);
+                        if (!(localDirLength > 0.0f))
+                            continue;
+
+                        Ray& localRay = localRays.emplace_back();
+                        localRay.Origin = glm::vec3(instance.InverseTransform * glm::vec4(ray.Origin, 1.0f));
+                        localRay.Direction = localDirRaw / localDirLength;
+                        localRay.TMin = ray.TMin * localDirLength;
+                        localRay.TMax = ray.TMax * localDirLength;
+                        localOwners.push_back(index);
+                    }
+                    if (localRays.empty())
+                        continue;
+
+                    localOccluded.assign(localRays.size(), 0);
+                    m_Geometries[instance.GeometryIndex]->GetBVH().CastRaysAny(localRays, localOccluded);
+                    for (sizet k = 0; k < localOwners.size(); ++k)
+                        outOccluded[localOwners[k]] |= localOccluded[k];
+                }
+                continue;
+            }
+
+            // Each child filters its own copy of the run.
+            OLO_CORE_ASSERT(stackSize + 2 <= s_TraversalStackSize, "TLAS traversal stack overflow");
+            const u32 copyBegin = entry.Begin + live;
+            pool.resize(copyBegin + live);
+            std::copy_n(pool.begin() + entry.Begin, live, pool.begin() + copyBegin);
+            stack[stackSize++] = { node.LeftFirst, entry.Begin, copyBegin };
+            stack[stackSize++] = { node.LeftFirst + 1, copyBegin, copyBegin + live };
+        }
+    }
+
     // =========================================================================
     // Emissive sampling
     // =========================================================================
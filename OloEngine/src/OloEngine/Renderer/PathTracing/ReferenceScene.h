@@ -40,6 +40,7 @@
 #include <glm/glm.hpp>
 
 #include <memory>
+#include <span>
 #include <vector>
 
 namespace OloEngine::PathTracing
@@ -217,6 +218,16 @@ namespace OloEngine::PathTracing
         u32 TriangleIndex = 0;
     };
 
+    // -------------------------------------------------------------------------
+    // One shadow query for ReferenceScene::OccludedStream — the segment
+    // IsOccluded(From, To) would test.
+    // -------------------------------------------------------------------------
+    struct ShadowSegment
+    {
+        glm::vec3 From{ 0.0f };
+        glm::vec3 To{ 0.0f };
+    };
+
     // -------------------------------------------------------------------------
     // One sampleable emissive triangle, in WORLD space. Built by `Build()` from
     // every instance whose material emits.
@@ -288,6 +299,16 @@ namespace OloEngine::PathTracing
         // sample cannot self-shadow.
         [[nodiscard]] bool IsOccluded(const glm::vec3& from, const glm::vec3& to, f32 epsilon = 1e-3f) const;
 
+        // Batched forms for the path tracer's ray streams. Element i of the
+        // output is exactly what the single query returns for element i of the
+        // input: every ray still walks the trees on its own, so ties between
+        // equal-distance hits resolve the same way and a streamed render stays
+        // bit-identical to a scalar one. What the batch buys is locality — the
+        // caller sorts the stream so consecutive rays touch the same nodes.
+        // `outHits` / `outOccluded` must be at least as long as the input.
+        void IntersectStream(std::span<const Ray> rays, std::span<SurfaceInteraction> outHits) const;
+        void OccludedStream(std::span<const ShadowSegment> segments, f32 epsilon, std::span<u8> outOccluded) const;
+
         // ---- accessors ------------------------------------------------------
 
         [[nodiscard]] const std::vector<ReferenceMaterial>& GetMaterials() const
@@ -184,6 +184,9 @@ namespace OloEngine::RHI
         None = 0,
         OpenGL,
         Vulkan,
+        // The recording backend (Platform/Null). Its "native" value is an
+        // ordinal, never a driver object.
+        Null,
     };
 
     struct NativeHandle
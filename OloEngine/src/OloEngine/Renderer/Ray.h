@@ -90,14 +90,16 @@ namespace OloEngine
         // [ray.TMin, ray.TMax]. Rays parallel to the triangle plane (|det| below
         // epsilon) miss. No floating-point `==`; an epsilon guards the determinant
         // (cpp-coding-quality §2).
-        [[nodiscard]] inline bool RayTriangle(const Ray& ray,
-                                              const glm::vec3& v0, const glm::vec3& v1, const glm::vec3& v2,
-                                              f32& outT, f32& outU, f32& outV, bool& outFrontFace)
+        //
+        // This form takes the edges (v1 - v0, v2 - v0) precomputed, which is how
+        // BoundingVolumeHierarchy stores its triangles; RayTriangle below is the
+        // same test from the three vertices, and the two agree bit for bit.
+        [[nodiscard]] inline bool RayTriangleEdges(const Ray& ray,
+                                                   const glm::vec3& v0, const glm::vec3& edge1, const glm::vec3& edge2,
+                                                   f32& outT, f32& outU, f32& outV, bool& outFrontFace)
         {
             constexpr f32 epsilon = 1e-8f;
 
-            const glm::vec3 edge1 = v1 - v0;
-            const glm::vec3 edge2 = v2 - v0;
             const glm::vec3 pvec = glm::cross(ray.Direction, edge2);
             const f32 det = glm::dot(edge1, pvec);
 
@@ -130,6 +132,13 @@ namespace OloEngine
             return true;
         }
 
+        [[nodiscard]] inline bool RayTriangle(const Ray& ray,
+                                              const glm::vec3& v0, const glm::vec3& v1, const glm::vec3& v2,
+                                              f32& outT, f32& outU, f32& outV, bool& outFrontFace)
+        {
+            return RayTriangleEdges(ray, v0, v1 - v0, v2 - v0, outT, outU, outV, outFrontFace);
+        }
+
         // @brief Ray-vs-AABB slab test used for BVH node pruning.
         //
         // Reference: Kay & Kajiya slab method; the `invDir` form is the one
@@ -1457,6 +1457,14 @@ namespace OloEngine
             SubmitRenderStreamPacket(RenderStreamType::Geometry, packet);
         }
 
+        // Submit a static DrawMesh packet as the retained geometry draw `id`,
+        // so an unchanged draw skips this frame's sort and batching. Call it
+        // every frame the draw is visible; EndScene drops the ones that were
+        // not. `id` must be stable across frames (the entity UUID, not its
+        // registry handle). With RendererSettings::RetainedStaticDraws off,
+        // and for anything else, this is SubmitPacket.
+        static void SubmitStaticPacket(const RetainedDrawID& id, CommandPacket* packet);
+
         template<typename T>
         static CommandPacket* CreateDecalDrawCall()
         {
@@ -215,6 +215,11 @@ namespace OloEngine
             return;
         }
 
+        // Static draws not resubmitted this frame were culled, hidden or
+        // destroyed; drop them before any pass replays the retained list.
+        if (auto* geometryNode = pipeline.GetRenderStreamNode(RenderStreamType::Geometry))
+            geometryNode->GetCommandBucket().RemoveStaleRetained();
+
         {
             OLO_PERF_SCOPE_AUTO("Renderer3D::ConfigurePassesForFrame");
             pipeline.ConfigurePassesForFrame(s_Data);
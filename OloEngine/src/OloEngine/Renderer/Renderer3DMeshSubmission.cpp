@@ -129,9 +129,16 @@ namespace OloEngine
         }
 
         auto& registry = VirtualMeshRegistry::Get();
-        if (!registry.IsRegistered(meshHandle) && !registry.RegisterMeshSource(meshHandle, *meshSource))
+        if (!registry.IsRegistered(meshHandle))
         {
-            return false; // unsupported source — warned once at registration
+            if (s_Data.Settings.VirtualGeometryStreamingBuild)
+            {
+                registry.RegisterMeshSourceStreaming(meshHandle, meshSource);
+            }
+            else if (!registry.RegisterMeshSource(meshHandle, *meshSource))
+            {
+                return false; // unsupported source — warned once at registration
+            }
         }
 
         VirtualMeshRegistry::MeshParts const parts = registry.FindParts(meshHandle);
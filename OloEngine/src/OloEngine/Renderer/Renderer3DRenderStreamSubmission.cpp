@@ -3,6 +3,7 @@
 #include "OloEngine/Renderer/Renderer3DInternal.h"
 #include "OloEngine/Renderer/Commands/FrameDataBuffer.h"
 #include "OloEngine/Renderer/Commands/FrameResourceManager.h"
+#include "OloEngine/Renderer/Debug/FrameCaptureManager.h"
 
 namespace OloEngine
 {
@@ -115,6 +116,32 @@ namespace OloEngine
         OLO_CORE_WARN("Renderer3D::SubmitRenderStreamPacket: Requested render stream is unavailable!");
     }
 
+    void Renderer3D::SubmitStaticPacket(const RetainedDrawID& id, CommandPacket* packet)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        if (!packet)
+        {
+            OLO_CORE_WARN("Renderer3D::SubmitStaticPacket: Attempted to submit a null CommandPacket pointer!");
+            return;
+        }
+
+        // Transient unless RendererSettings::RetainedStaticDraws is on.
+        // Animated meshes carry per-frame bone offsets and stay transient, as
+        // does everything while a frame capture records the transient packets
+        auto* geometryNode = s_Data.Pipeline->GetRenderStreamNode(RenderStreamType::Geometry);
+        if (!s_Data.Settings.RetainedStaticDraws || !geometryNode || packet->GetCommandType() != CommandType::DrawMesh ||
+            packet->GetCommandData<DrawMeshCommand>()->isAnimatedMesh ||
+            FrameCaptureManager::GetInstance().IsCapturing())
+        {
+            SubmitRenderStreamPacket(RenderStreamType::Geometry, packet);
+            return;
+        }
+
+        // The retained store keeps its own copy; the frame-allocated packet is dropped with the frame
+        geometryNode->GetCommandBucket().SubmitRetained(id, *packet->GetCommandData<DrawMeshCommand>(), packet->GetMetadata());
+    }
+
     void Renderer3D::SubmitPacketParallel(WorkerSubmitContext& ctx, CommandPacket* packet)
     {
         OLO_PROFILE_FUNCTION();
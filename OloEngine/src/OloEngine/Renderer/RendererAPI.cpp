@@ -1,5 +1,6 @@
 #include "OloEnginePCH.h"
 #include "OloEngine/Renderer/RendererAPI.h"
+#include "Platform/Null/NullRendererAPI.h"
 #include "Platform/OpenGL/OpenGLRendererAPI.h"
 #if OLO_WITH_VULKAN
 #include "Platform/Vulkan/VulkanRendererAPI.h"
@@ -46,6 +47,10 @@ namespace OloEngine
             {
                 return CreateScope<OpenGLRendererAPI>();
             }
+            case RendererAPI::API::Null:
+            {
+                return CreateScope<NullRendererAPI>();
+            }
         }
 
         OLO_CORE_ASSERT(false, "Unknown RendererAPI!");
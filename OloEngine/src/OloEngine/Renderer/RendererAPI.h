@@ -39,7 +39,11 @@ namespace OloEngine
             // "unsupported backend" assert, and Application skips Renderer::Init.
             // The member exists even when OLO_WITH_VULKAN=0 so selection code can parse
             // the flag and report "not compiled in" instead of "unknown backend".
-            Vulkan = 2
+            Vulkan = 2,
+            // Recording backend with no device (Platform/Null). Drives the CPU
+            // side of rendering — command buckets, dispatch, the RHI registry —
+            // for GPU-less benchmarks; the resource factories have no arm for it.
+            Null = 3
         };
 
         enum class RendererType
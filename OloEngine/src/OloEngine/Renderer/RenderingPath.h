@@ -84,6 +84,16 @@ namespace OloEngine
         // --- Depth pre-pass ---
         bool DepthPrepassEnabled = false;
 
+        // --- Retained static draws ---
+        // Keep the scene's static mesh draws in the geometry bucket across
+        // frames (CommandBucket::SubmitRetained, keyed by entity UUID) so an
+        // unchanged draw skips the per-frame sort and batching. Off by
+        // default: the sort key carries view depth, so a moving camera
+        // re-keys every retained draw and the store only pays off while the
+        // view holds still. Animated meshes and frame captures always take
+        // the transient path.
+        bool RetainedStaticDraws = false;
+
         // --- Forward+ tuning (when Path == ForwardPlus or Auto) ---
         bool ForwardPlusAutoSwitch = true; // Auto-switch from Forward to Forward+ at threshold
         u32 ForwardPlusLightThreshold = 8;
@@ -184,6 +194,14 @@ namespace OloEngine
         // source density, so this is a correctness/diagnostic switch, not a performance one.
         bool VirtualGeometryEnabled = true;
 
+        // Build a mesh's cluster DAG on the task pool instead of inside the submission that
+        // first sees it (VirtualMeshRegistry::RegisterMeshSourceStreaming). The mesh is absent
+        // until its first level lands, then refines as further levels arrive; cooked meshes
+        // register at once either way. Off by default so a single rendered frame (captures,
+        // the visual tests) still sees every mesh; the editor turns it on to avoid the
+        // multi-minute stall a film-quality import otherwise causes.
+        bool VirtualGeometryStreamingBuild = false;
+
         // Composite the active virtual-geometry debug view (cluster id / LOD / overdraw,
         // selected by VirtualMeshRegistry::SetDebugMode) over the lit viewport image.
         //
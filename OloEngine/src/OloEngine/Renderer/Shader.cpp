@@ -3,6 +3,7 @@
 
 #include "OloEngine/Renderer/Renderer.h"
 #include "Platform/OpenGL/OpenGLShader.h"
+#include "Platform/Null/NullShader.h"
 
 #if OLO_WITH_VULKAN
 // Sanctioned factory-include pattern (rhi-abstraction-boundary.md): this
@@ -136,6 +137,10 @@ namespace OloEngine
                 OLO_CORE_ASSERT(false, "RendererAPI::None is currently not supported!");
                 return nullptr;
             }
+            case RendererAPI::API::Null:
+            {
+                return Ref<Shader>(new NullShader(filepath));
+            }
             case RendererAPI::API::Vulkan:
             {
 #if OLO_WITH_VULKAN
@@ -174,6 +179,10 @@ namespace OloEngine
                 OLO_CORE_ASSERT(false, "RendererAPI::None is currently not supported!");
                 return nullptr;
             }
+            case RendererAPI::API::Null:
+            {
+                return Ref<Shader>(new NullShader(name, vertexSrc, fragmentSrc));
+            }
             case RendererAPI::API::Vulkan:
             {
 #if OLO_WITH_VULKAN
@@ -315,6 +315,13 @@ void main()
             return nullptr;
         }
 
+        // Pack entries become OpenGLShaders; any other backend goes through
+        // its own Shader::Create arm.
+        if (Renderer::GetAPI() != RendererAPI::API::OpenGL)
+        {
+            return nullptr;
+        }
+
         if (!m_ShaderPack->Contains(filepath))
         {
             return nullptr;
@@ -2,6 +2,7 @@
 #include "OloEngine/Renderer/StorageBuffer.h"
 #include "OloEngine/Renderer/Renderer.h"
 #include "Platform/OpenGL/OpenGLStorageBuffer.h"
+#include "Platform/Null/NullBufferResources.h"
 
 #if OLO_WITH_VULKAN
 // Sanctioned factory-include pattern (rhi-abstraction-boundary.md): this
@@ -20,6 +21,10 @@ namespace OloEngine
                 OLO_CORE_ASSERT(false, "RendererAPI::None is currently not supported!");
                 return nullptr;
             }
+            case RendererAPI::API::Null:
+            {
+                return Ref<StorageBuffer>(new NullStorageBuffer(size, binding, usage));
+            }
             case RendererAPI::API::Vulkan:
             {
 #if OLO_WITH_VULKAN
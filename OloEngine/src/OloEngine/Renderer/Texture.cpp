@@ -3,6 +3,7 @@
 
 #include "OloEngine/Renderer/Renderer.h"
 #include "Platform/OpenGL/OpenGLTexture.h"
+#include "Platform/Null/NullTexture.h"
 
 #if OLO_WITH_VULKAN
 // Sanctioned factory-include pattern (rhi-abstraction-boundary.md): this
@@ -21,6 +22,10 @@ namespace OloEngine
                 OLO_CORE_ASSERT(false, "RendererAPI::None is currently not supported!");
                 return nullptr;
             }
+            case RendererAPI::API::Null:
+            {
+                return Ref<NullTexture2D>::Create(specification);
+            }
             case RendererAPI::API::Vulkan:
             {
 #if OLO_WITH_VULKAN
@@ -54,6 +59,10 @@ namespace OloEngine
                 OLO_CORE_ASSERT(false, "RendererAPI::None is currently not supported!");
                 return nullptr;
             }
+            case RendererAPI::API::Null:
+            {
+                return Ref<NullTexture2D>::Create(compressedImage);
+            }
             case RendererAPI::API::Vulkan:
             {
                 // Block-compressed upload (the BCn staging path) is #691
@@ -89,6 +98,10 @@ namespace OloEngine
                 OLO_CORE_ASSERT(false, "RendererAPI::None is currently not supported!");
                 return nullptr;
             }
+            case RendererAPI::API::Null:
+            {
+                return Ref<NullTexture2D>::Create(path, srgb);
+            }
             case RendererAPI::API::Vulkan:
             {
 #if OLO_WITH_VULKAN
@@ -3,6 +3,7 @@
 
 #include "OloEngine/Renderer/Renderer.h"
 #include "Platform/OpenGL/OpenGLTexture3D.h"
+#include "Platform/Null/NullTexture.h"
 
 #if OLO_WITH_VULKAN
 // OLO_WITH_VULKAN-guarded factory TU may see Platform/Vulkan/ headers.
@@ -22,6 +23,10 @@ namespace OloEngine
                 OLO_CORE_ASSERT(false, "RendererAPI::None is currently not supported!");
                 return nullptr;
             }
+            case RendererAPI::API::Null:
+            {
+                return Ref<NullTexture3D>::Create(spec);
+            }
             case RendererAPI::API::Vulkan:
             {
 #if OLO_WITH_VULKAN
@@ -1,8 +1,12 @@
 #include "OloEnginePCH.h"
 #include "OloEngine/Renderer/TextureCompression.h"
 
+#include "OloEngine/Asset/DerivedDataCache.h"
 #include "OloEngine/Core/Log.h"
 #include "OloEngine/Debug/Instrumentor.h"
+#include "OloEngine/Task/ParallelFor.h"
+#include "OloEngine/Task/Scheduler.h"
+#include "OloEngine/Task/Task.h"
 
 // Vendored encoders/decoders (bc7enc_rdo, MIT / public domain). Only this TU pulls
 // them in, keeping the header renderer-agnostic. bc7enc: BC7 encode; rgbcx: BC5
@@ -26,6 +30,7 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cctype>
 #include <cmath>
 #include <cstdlib>
@@ -145,26 +150,62 @@ namespace OloEngine
             }
         }
 
+        // Side length, in 4x4 blocks, of the square tiles a mip level is split into
+        // for ParallelFor. Every block is encoded independently and written to its
+        // own fixed slot, so the tiling only affects scheduling, never the bytes.
+        constexpr u32 s_EncodeTileBlocks = 4;
+
+        // Levels at or above this many texels downsample the next mip on a task
+        // while the current one encodes; below it the task launch costs more than
+        // the overlap buys.
+        constexpr sizet s_PipelinedMipMinTexels = 64 * 64;
+
+        // Derived-data cache key version for CompressImageFile. Bump when any encoder,
+        // the mip filter or the container layout changes its output.
+        constexpr u32 s_DerivedDataVersion = 1;
+
+        // Encode the bx * by blocks of one mip level, tile by tile across ParallelFor.
+        // `encodeBlock(dst16, blockX, blockY)` gathers and encodes a single block.
+        // `minBatchTiles` keeps cheap encoders (BC5) from paying a task per tile.
+        template<typename EncodeBlockAtFn>
+        std::vector<u8> EncodeBlocksTiled(u32 bx, u32 by, i32 minBatchTiles, EncodeBlockAtFn&& encodeBlock)
+        {
+            std::vector<u8> out(static_cast<sizet>(bx) * by * 16);
+
+            const u32 tilesX = (bx + s_EncodeTileBlocks - 1) / s_EncodeTileBlocks;
+            const u32 tilesY = (by + s_EncodeTileBlocks - 1) / s_EncodeTileBlocks;
+            ParallelFor(
+                "TextureCompression::EncodeLevel",
+                static_cast<i32>(tilesX * tilesY),
+                minBatchTiles,
+                [&](i32 tileIndex)
+                {
+                    const u32 x0 = (static_cast<u32>(tileIndex) % tilesX) * s_EncodeTileBlocks;
+                    const u32 y0 = (static_cast<u32>(tileIndex) / tilesX) * s_EncodeTileBlocks;
+                    const u32 x1 = std::min(x0 + s_EncodeTileBlocks, bx);
+                    const u32 y1 = std::min(y0 + s_EncodeTileBlocks, by);
+                    for (u32 y = y0; y < y1; ++y)
+                    {
+                        for (u32 x = x0; x < x1; ++x)
+                            encodeBlock(out.data() + (static_cast<sizet>(y) * bx + x) * 16, x, y);
+                    }
+                });
+            return out;
+        }
+
         // Encode a single RGBA8 mip level's blocks with the given per-block encoder.
         // `encodeBlock(dst16, block64)` fills 16 output bytes from a 64-byte RGBA block.
         template<typename EncodeBlockFn>
-        std::vector<u8> EncodeLevel(const std::vector<u8>& rgba, u32 width, u32 height, EncodeBlockFn&& encodeBlock)
+        std::vector<u8> EncodeLevel(const std::vector<u8>& rgba, u32 width, u32 height, i32 minBatchTiles, EncodeBlockFn&& encodeBlock)
         {
-            const u32 bx = TextureCompression::BlockCount(width);
-            const u32 by = TextureCompression::BlockCount(height);
-            std::vector<u8> out(static_cast<sizet>(bx) * by * 16);
-
-            std::array<u8, 64> block{};
-            for (u32 y = 0; y < by; ++y)
-            {
-                for (u32 x = 0; x < bx; ++x)
+            return EncodeBlocksTiled(
+                TextureCompression::BlockCount(width), TextureCompression::BlockCount(height), minBatchTiles,
+                [&](u8* dst, u32 x, u32 y)
                 {
+                    std::array<u8, 64> block{};
                     GatherBlockRGBA(rgba, width, height, x, y, block);
-                    u8* dst = out.data() + (static_cast<sizet>(y) * bx + x) * 16;
                     encodeBlock(dst, block.data());
-                }
-            }
-            return out;
+                });
         }
 
         // Build a compressed mip chain from a level-0 pixel buffer. `encodeLevel(level, w, h)`
@@ -172,6 +213,10 @@ namespace OloEngine
         // it. Shared by all three encoders (BC7/BC5 over RGBA8, BC6H over RGB float): the
         // loop, the !generateMips / 1x1 termination, and the dimension bookkeeping are
         // identical — only the pixel type and the two callables differ.
+        //
+        // The downsample of level N+1 runs on a task while level N encodes. Both only
+        // read `level`, and each level is still derived from the previous one exactly
+        // as before, so the chain is byte-identical to building it in sequence.
         template<typename Pixel, typename EncodeLevelFn, typename DownsampleFn>
         std::vector<std::vector<u8>> BuildMipChain(std::vector<Pixel> level, u32 width, u32 height, bool generateMips,
                                                    EncodeLevelFn&& encodeLevel, DownsampleFn&& downsample)
@@ -181,12 +226,27 @@ namespace OloEngine
             u32 mh = height;
             while (true)
             {
-                mips.push_back(encodeLevel(level, mw, mh));
                 if (!generateMips || (mw == 1 && mh == 1))
+                {
+                    mips.push_back(encodeLevel(level, mw, mh));
                     break;
+                }
                 u32 nw = 0;
                 u32 nh = 0;
-                level = downsample(level, mw, mh, nw, nh);
+                if (static_cast<sizet>(mw) * mh >= s_PipelinedMipMinTexels)
+                {
+                    Tasks::TTask<std::vector<Pixel>> next = Tasks::Launch(
+                        "TextureCompression::Downsample",
+                        [&level, &downsample, mw, mh, &nw, &nh]()
+                        { return downsample(level, mw, mh, nw, nh); });
+                    mips.push_back(encodeLevel(level, mw, mh));
+                    level = std::move(next.GetResult());
+                }
+                else
+                {
+                    mips.push_back(encodeLevel(level, mw, mh));
+                    level = downsample(level, mw, mh, nw, nh);
+                }
                 mw = nw;
                 mh = nh;
             }
@@ -679,7 +739,7 @@ namespace OloEngine
             image.Mips = BuildMipChain<u8>(
                 ExpandToRGBA8(pixels, width, height, channels), width, height, generateMips,
                 [&encodeBlock](const std::vector<u8>& lvl, u32 w, u32 h)
-                { return EncodeLevel(lvl, w, h, encodeBlock); },
+                { return EncodeLevel(lvl, w, h, 1 /* bc7enc: ~16 slow blocks per tile */, encodeBlock); },
                 [](const std::vector<u8>& s, u32 w, u32 h, u32& ow, u32& oh)
                 { return DownsampleRGBA8(s, w, h, ow, oh); });
             return image;
@@ -714,7 +774,7 @@ namespace OloEngine
             image.Mips = BuildMipChain<u8>(
                 ExpandToRGBA8(pixels, width, height, channels), width, height, generateMips,
                 [&encodeBlock](const std::vector<u8>& lvl, u32 w, u32 h)
-                { return EncodeLevel(lvl, w, h, encodeBlock); },
+                { return EncodeLevel(lvl, w, h, 16 /* BC5 blocks are cheap */, encodeBlock); },
                 [](const std::vector<u8>& s, u32 w, u32 h, u32& ow, u32& oh)
                 { return DownsampleRGBA8(s, w, h, ow, oh); });
             return image;
@@ -740,19 +800,13 @@ namespace OloEngine
 
             const auto encodeLevel = [](const std::vector<f32>& rgb, u32 w, u32 h)
             {
-                const u32 bx = BlockCount(w);
-                const u32 by = BlockCount(h);
-                std::vector<u8> out(static_cast<sizet>(bx) * by * 16);
-                std::array<f32, 48> block{};
-                for (u32 y = 0; y < by; ++y)
-                {
-                    for (u32 x = 0; x < bx; ++x)
-                    {
-                        GatherBlockRGBFloat(rgb, w, h, x, y, block);
-                        EncodeBC6HBlockUnsigned(out.data() + (static_cast<sizet>(y) * bx + x) * 16, block.data());
-                    }
-                }
-                return out;
+                return EncodeBlocksTiled(BlockCount(w), BlockCount(h), 4 /* mode-11 blocks are mid-cost */,
+                                         [&rgb, w, h](u8* dst, u32 x, u32 y)
+                                         {
+                                             std::array<f32, 48> block{};
+                                             GatherBlockRGBFloat(rgb, w, h, x, y, block);
+                                             EncodeBC6HBlockUnsigned(dst, block.data());
+                                         });
             };
 
             image.Mips = BuildMipChain<f32>(
@@ -1095,13 +1149,34 @@ namespace OloEngine
         {
             OLO_PROFILE_FUNCTION();
 
+            // Read the source once: its bytes both key the derived-data cache and feed
+            // the decoder.
+            std::vector<u8> source;
+            {
+                std::ifstream file(srcImagePath, std::ios::binary | std::ios::ate);
+                const std::streamoff size = file ? static_cast<std::streamoff>(file.tellg()) : -1;
+                if (size > 0 && size <= std::numeric_limits<int>::max())
+                {
+                    source.resize(static_cast<sizet>(size));
+                    file.seekg(0);
+                    if (!file.read(reinterpret_cast<char*>(source.data()), size))
+                        source.clear();
+                }
+            }
+            if (source.empty())
+            {
+                OLO_CORE_ERROR("TextureCompression::CompressImageFile - failed to read '{}'", srcImagePath);
+                return false;
+            }
+            const int sourceSize = static_cast<int>(source.size());
+
             TextureCompressionFormat format = options.Format;
             if (format == TextureCompressionFormat::None)
             {
                 // An HDR source (.hdr / .exr with float data) auto-selects BC6H; everything
                 // else defaults to BC7. BC5 is never auto-chosen (deliberate normal-map opt-in).
-                format = ::stbi_is_hdr(srcImagePath.c_str()) ? TextureCompressionFormat::BC6H
-                                                             : TextureCompressionFormat::BC7;
+                format = ::stbi_is_hdr_from_memory(source.data(), sourceSize) ? TextureCompressionFormat::BC6H
+                                                                                : TextureCompressionFormat::BC7;
             }
 
             bool srgb = options.SRGB;
@@ -1111,6 +1186,24 @@ namespace OloEngine
                 srgb = IsLikelyColorTexture(filename);
             }
 
+            // Keyed on the resolved settings rather than the options, so a filename that
+            // only decided the sRGB flag does not split otherwise identical entries.
+            DerivedDataKey cacheKey;
+            DerivedDataCache& cache = DerivedDataCache::Get();
+            const bool useCache = options.UseDerivedDataCache && cache.IsEnabled();
+            if (useCache)
+            {
+                cacheKey = DerivedDataKeyBuilder("TextureCompression", s_DerivedDataVersion)
+                               .Append(source)
+                               .AppendValue(static_cast<u8>(format))
+                               .AppendValue(format == TextureCompressionFormat::BC7 && srgb)
+                               .AppendValue(options.GenerateMips)
+                               .Build();
+                std::vector<u8> blob;
+                if (cache.Load(cacheKey, blob) && DeserializeFromBlob(blob, out))
+                    return true;
+            }
+
             // Match the runtime texture loader's vertical flip so the stored blocks
             // upload without re-flipping (see OpenGLTexture2D path-load ctor).
             ::stbi_set_flip_vertically_on_load_thread(1);
@@ -1123,7 +1216,7 @@ namespace OloEngine
             {
                 // Load HDR as float, forcing 3 components (RGB) so a 1/4-channel HDR source
                 // still feeds EncodeBC6H a well-defined RGB buffer.
-                f32* data = ::stbi_loadf(srcImagePath.c_str(), &width, &height, &channels, 3);
+                f32* data = ::stbi_loadf_from_memory(source.data(), sourceSize, &width, &height, &channels, 3);
                 ::stbi_set_flip_vertically_on_load_thread(0);
                 if (!data)
                 {
@@ -1135,7 +1228,7 @@ namespace OloEngine
             }
             else
             {
-                stbi_uc* data = ::stbi_load(srcImagePath.c_str(), &width, &height, &channels, 0);
+                stbi_uc* data = ::stbi_load_from_memory(source.data(), sourceSize, &width, &height, &channels, 0);
                 ::stbi_set_flip_vertically_on_load_thread(0);
                 if (!data)
                 {
@@ -1155,6 +1248,9 @@ namespace OloEngine
                 return false;
             }
 
+            if (useCache)
+                cache.Store(cacheKey, SerializeToBlob(image));
+
             out = std::move(image);
             return true;
         }
@@ -1170,5 +1266,99 @@ namespace OloEngine
 
             return WriteFile(dstOlotexPath, image);
         }
+
+        BatchCompressResult CompressTextureFiles(std::span<const CompressFileJob> jobs, const CompressOptions& options,
+                                                 u32 maxConcurrentFiles)
+        {
+            OLO_PROFILE_FUNCTION();
+
+            BatchCompressResult result;
+            if (jobs.empty())
+                return result;
+
+            if (maxConcurrentFiles == 0)
+                maxConcurrentFiles = std::max(1u, LowLevelTasks::FScheduler::Get().GetNumWorkers());
+            const u32 fileWorkers = std::min(maxConcurrentFiles, static_cast<u32>(jobs.size()));
+
+            // A fixed pool of file workers pulling the next job index, rather than one
+            // task per file, so no more than `fileWorkers` sources are decoded at once.
+            std::atomic<sizet> nextJob{ 0 };
+            std::vector<u8> succeeded(jobs.size(), 0);
+            const auto drain = [&]()
+            {
+                for (sizet i = nextJob.fetch_add(1, std::memory_order_relaxed); i < jobs.size();
+                     i = nextJob.fetch_add(1, std::memory_order_relaxed))
+                {
+                    succeeded[i] = CompressTextureFile(jobs[i].SrcImagePath, jobs[i].DstOlotexPath, options) ? 1 : 0;
+                }
+            };
+
+            std::vector<Tasks::TTask<void>> workers;
+            workers.reserve(fileWorkers - 1);
+            for (u32 w = 1; w < fileWorkers; ++w)
+                workers.push_back(Tasks::Launch("TextureCompression::CompressTextureFiles", [&drain]()
+                                                { drain(); }));
+            drain();
+            for (Tasks::TTask<void>& worker : workers)
+                worker.Wait();
+
+            for (sizet i = 0; i < jobs.size(); ++i)
+            {
+                if (succeeded[i])
+                    ++result.Compressed;
+                else
+                    result.FailedPaths.push_back(jobs[i].SrcImagePath);
+            }
+            return result;
+        }
+
+        BatchCompressResult CompressDirectory(const std::string& srcDirectory, const std::string& dstDirectory,
+                                              const CompressOptions& options, u32 maxConcurrentFiles)
+        {
+            OLO_PROFILE_FUNCTION();
+
+            namespace fs = std::filesystem;
+
+            BatchCompressResult result;
+            std::error_code ec;
+            if (!fs::is_directory(srcDirectory, ec))
+            {
+                OLO_CORE_ERROR("TextureCompression::CompressDirectory - '{}' is not a directory", srcDirectory);
+                result.FailedPaths.push_back(srcDirectory);
+                return result;
+            }
+
+            // The formats stb_image decodes (see CompressImageFile).
+            constexpr std::string_view imageExtensions[] = {
+                ".png", ".jpg", ".jpeg", ".tga", ".bmp", ".psd", ".gif", ".hdr", ".pic", ".ppm", ".pgm"
+            };
+
+            std::vector<CompressFileJob> jobs;
+            for (const fs::directory_entry& entry : fs::recursive_directory_iterator(srcDirectory, ec))
+            {
+                if (!entry.is_regular_file())
+                    continue;
+                std::string extension = entry.path().extension().string();
+                std::ranges::transform(extension, extension.begin(), [](unsigned char c)
+                                       { return static_cast<char>(std::tolower(c)); });
+                if (std::ranges::find(imageExtensions, std::string_view(extension)) == std::end(imageExtensions))
+                    continue;
+
+                fs::path dst = fs::path(dstDirectory) / entry.path().lexically_relative(srcDirectory);
+                dst.replace_extension(".olotex");
+                jobs.push_back({ entry.path().string(), dst.string() });
+            }
+            if (ec)
+                OLO_CORE_WARN("TextureCompression::CompressDirectory - error walking '{}': {}", srcDirectory, ec.message());
+
+            // Directory order is filesystem-dependent; sort so the job (and failure) order is stable.
+            std::ranges::sort(jobs, {}, &CompressFileJob::SrcImagePath);
+
+            // Create the output tree up front rather than racing on it from the workers.
+            for (const CompressFileJob& job : jobs)
+                fs::create_directories(fs::path(job.DstOlotexPath).parent_path(), ec);
+
+            return CompressTextureFiles(jobs, options, maxConcurrentFiles);
+        }
     } // namespace TextureCompression
 } // namespace OloEngine
@@ -84,6 +84,8 @@ namespace OloEngine
         // ---- Encode -----------------------------------------------------------
         // Source pixels are tightly packed, `channels` bytes/texel, row-major.
         // `generateMips` builds the full box-filtered chain; otherwise mip 0 only.
+        // Blocks are encoded in tiles across ParallelFor, and each mip is downsampled
+        // while the previous one encodes; the bytes never depend on the thread count.
         //
         // EncodeBC7 expands the source to RGBA (missing channels: G/B copy R for 1-ch,
         // A defaults to 255) before encoding all four channels.
@@ -132,6 +134,10 @@ namespace OloEngine
             bool SRGB = false;            // color-space hint for BC7 (ignored for BC5)
             bool AutoSRGBFromName = true; // when true, override SRGB using the filename heuristic
             bool GenerateMips = true;
+            // Reuse (and publish) the result through DerivedDataCache::Get(), keyed on the
+            // source bytes and the resolved settings. Off only where a caller must time or
+            // compare the encoders themselves.
+            bool UseDerivedDataCache = true;
         };
 
         // Load `srcImagePath` (any stb-supported image) and encode per `options`, returning
@@ -139,6 +145,8 @@ namespace OloEngine
         // cook; the asset-pack builder uses it to auto-compress source textures and embed
         // the resulting container directly. Returns false on load/encode failure (logged).
         // Pixels are loaded with the same vertical flip the runtime texture loader uses.
+        // A source whose content was cooked before with the same settings comes straight
+        // from the derived-data cache, wherever the file lives now.
         [[nodiscard]] bool CompressImageFile(const std::string& srcImagePath, const CompressOptions& options,
                                              CompressedTextureImage& out);
 
@@ -147,5 +155,37 @@ namespace OloEngine
         // WriteFile. Returns false on load/encode/write failure (details logged).
         [[nodiscard]] bool CompressTextureFile(const std::string& srcImagePath, const std::string& dstOlotexPath,
                                                const CompressOptions& options);
+
+        // ---- Batch cook -------------------------------------------------------
+        // One source image and the .olotex it cooks to.
+        struct CompressFileJob
+        {
+            std::string SrcImagePath;
+            std::string DstOlotexPath;
+        };
+
+        struct BatchCompressResult
+        {
+            u32 Compressed = 0;
+            std::vector<std::string> FailedPaths; // source paths, in job order
+
+            [[nodiscard]] bool Succeeded() const
+            {
+                return FailedPaths.empty();
+            }
+        };
+
+        // CompressTextureFile over every job, at most `maxConcurrentFiles` at a time
+        // (0 = one per worker thread). The bound caps how many decoded sources are held
+        // in memory at once; each file's blocks are still encoded across ParallelFor.
+        // Every output is byte-identical to cooking the files one by one.
+        [[nodiscard]] BatchCompressResult CompressTextureFiles(std::span<const CompressFileJob> jobs,
+                                                               const CompressOptions& options, u32 maxConcurrentFiles = 0);
+
+        // Cook every stb-loadable image under `srcDirectory` (recursively) to an .olotex
+        // at the same relative path under `dstDirectory`, via CompressTextureFiles.
+        // Missing output directories are created; a missing source directory is an error.
+        [[nodiscard]] BatchCompressResult CompressDirectory(const std::string& srcDirectory, const std::string& dstDirectory,
+                                                            const CompressOptions& options, u32 maxConcurrentFiles = 0);
     } // namespace TextureCompression
 } // namespace OloEngine
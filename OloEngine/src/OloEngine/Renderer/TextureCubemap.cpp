@@ -3,6 +3,7 @@
 
 #include "OloEngine/Renderer/Renderer.h"
 #include "Platform/OpenGL/OpenGLTextureCubemap.h"
+#include "Platform/Null/NullTexture.h"
 #if OLO_WITH_VULKAN
 #include "Platform/Vulkan/VulkanTransientResources.h"
 
@@ -97,6 +98,10 @@ namespace OloEngine
                 OLO_CORE_ASSERT(false, "RendererAPI::None is currently not supported!");
                 return nullptr;
             }
+            case RendererAPI::API::Null:
+            {
+                return Ref<NullTextureCubemap>::Create(facePaths);
+            }
             case RendererAPI::API::Vulkan:
             {
 #if OLO_WITH_VULKAN
@@ -127,6 +132,10 @@ namespace OloEngine
                 OLO_CORE_ASSERT(false, "RendererAPI::None is currently not supported!");
                 return nullptr;
             }
+            case RendererAPI::API::Null:
+            {
+                return Ref<NullTextureCubemap>::Create(specification);
+            }
             case RendererAPI::API::Vulkan:
             {
 #if OLO_WITH_VULKAN
@@ -3,6 +3,7 @@
 
 #include "OloEngine/Renderer/Renderer.h"
 #include "Platform/OpenGL/OpenGLTextureCubemapArray.h"
+#include "Platform/Null/NullTexture.h"
 #if OLO_WITH_VULKAN
 #include "Platform/Vulkan/VulkanDevice.h"
 #include "Platform/Vulkan/VulkanTransientResources.h"
@@ -19,6 +20,10 @@ namespace OloEngine
                 OLO_CORE_ASSERT(false, "RendererAPI::None is currently not supported!");
                 return nullptr;
             }
+            case RendererAPI::API::Null:
+            {
+                return Ref<NullTextureCubemapArray>::Create(specification);
+            }
             case RendererAPI::API::Vulkan:
             {
                 // #691: the amendment (64) leftover — this assert
@@ -2,6 +2,7 @@
 #include "OloEngine/Renderer/VertexBuffer.h"
 #include "OloEngine/Renderer/Renderer.h"
 #include "Platform/OpenGL/OpenGLVertexBuffer.h"
+#include "Platform/Null/NullBufferResources.h"
 
 #if OLO_WITH_VULKAN
 // Sanctioned factory-include pattern (rhi-abstraction-boundary.md): this
@@ -21,6 +22,10 @@ namespace OloEngine
                 OLO_CORE_ASSERT(false, "RendererAPI::None is currently not supported!");
                 return nullptr;
             }
+            case RendererAPI::API::Null:
+            {
+                return Ref<VertexBuffer>(new NullVertexBuffer(size));
+            }
             case RendererAPI::API::Vulkan:
             {
 #if OLO_WITH_VULKAN
@@ -54,6 +59,10 @@ namespace OloEngine
                 OLO_CORE_ASSERT(false, "RendererAPI::None is currently not supported!");
                 return nullptr;
             }
+            case RendererAPI::API::Null:
+            {
+                return Ref<VertexBuffer>(new NullVertexBuffer(size));
+            }
             case RendererAPI::API::Vulkan:
             {
 #if OLO_WITH_VULKAN
@@ -87,6 +96,10 @@ namespace OloEngine
                 OLO_CORE_ASSERT(false, "RendererAPI::None is currently not supported!");
                 return nullptr;
             }
+            case RendererAPI::API::Null:
+            {
+                return Ref<VertexBuffer>(new NullVertexBuffer(size));
+            }
             case RendererAPI::API::Vulkan:
             {
 #if OLO_WITH_VULKAN
@@ -125,6 +138,10 @@ namespace OloEngine
                 OLO_CORE_ASSERT(false, "RendererAPI::None is currently not supported!");
                 return nullptr;
             }
+            case RendererAPI::API::Null:
+            {
+                return Ref<VertexBuffer>(new NullVertexBuffer(size));
+            }
             case RendererAPI::API::Vulkan:
             {
 #if OLO_WITH_VULKAN
@@ -1,8 +1,10 @@
 #include "OloEnginePCH.h"
 #include "OloEngine/Renderer/VirtualGeometry/VirtualMeshBuilder.h"
 
+#include "OloEngine/Asset/DerivedDataCache.h"
 #include "OloEngine/Renderer/MeshSource.h"
 #include "OloEngine/Renderer/Vertex.h"
+#include "OloEngine/Task/ParallelFor.h"
 
 #include <meshoptimizer.h>
 
@@ -41,6 +43,11 @@ namespace OloEngine::VirtualMeshBuilder
         constexpr i32 kOwnerUnset = -2;
         constexpr i32 kOwnerShared = -1;
 
+        [[nodiscard]] bool IsCancelled(const VirtualMeshBuildConfig& config)
+        {
+            return config.CancelToken && config.CancelToken->load(std::memory_order_relaxed);
+        }
+
         [[nodiscard]] VirtualMeshBuildConfig Sanitize(const VirtualMeshBuildConfig& config)
         {
             VirtualMeshBuildConfig out = config;
@@ -707,9 +714,108 @@ namespace OloEngine::VirtualMeshBuilder
 
             return groupIndex;
         }
+
+        // What one group of a level turns into. The groups of a level are simplified in
+        // parallel; the results are emitted afterwards in partition order.
+        struct GroupResult
+        {
+            VirtualLODBounds Bounds;
+            SimplifyPath Path = SimplifyPath::Stuck;
+            std::vector<BuildCluster> Split; // the re-clustered simplified geometry; empty when stuck
+        };
+
+        // Merge + simplify + re-cluster for one group. Reads `ctx` and the members and writes
+        // nothing shared: the level's locks are fixed before any group runs, and freezing a
+        // stuck group's boundary (the only mid-level context change) is left to the emit pass.
+        [[nodiscard]] GroupResult SimplifyGroup(const BuildContext& ctx, const std::vector<BuildCluster>& clusters,
+                                                const std::vector<u32>& members, const std::vector<u8>& locks)
+        {
+            GroupResult group;
+
+            std::vector<u32> merged;
+            {
+                sizet totalIndexCount = 0;
+                for (u32 const member : members)
+                {
+                    totalIndexCount += clusters[member].Indices.size();
+                }
+                merged.reserve(totalIndexCount);
+            }
+            for (u32 const member : members)
+            {
+                merged.insert(merged.end(), clusters[member].Indices.begin(), clusters[member].Indices.end());
+            }
+
+            group.Bounds = MergeLODBounds(clusters, members);
+
+            auto targetIndexCount = static_cast<sizet>(static_cast<f64>(merged.size() / 3) * ctx.Config.SimplifyRatio) * 3;
+
+            SimplifyOutcome const outcome = Simplify(ctx, merged, locks, targetIndexCount);
+            group.Path = outcome.Path;
+
+            if (outcome.Path == SimplifyPath::Stuck)
+            {
+                // Simplification is stuck (or annihilated the geometry, which must not leave a
+                // hole in coarse cuts) — the group goes terminal: FLT_MAX error keeps it
+                // selected at any threshold, so it is never refined away.
+                group.Bounds.Error = std::numeric_limits<f32>::max();
+                return group;
+            }
+
+            // Monotone error: parent error can never be below any child's error. This is the
+            // reference's error merge at its default parameters —
+            // max(previous * simplify_error_merge_previous, current) + current *
+            // simplify_error_merge_additive with merge_previous = 1 and additive = 0.
+            group.Bounds.Error = std::max(group.Bounds.Error, outcome.AbsoluteError);
+
+            group.Split = Clusterize(ctx, outcome.Indices.data(), outcome.Indices.size());
+            for (BuildCluster& cluster : group.Split)
+            {
+                // Conservative propagation: the new cluster inherits the group bounds,
+                // so the next level's merged sphere contains this group's sphere.
+                cluster.LODBounds = group.Bounds;
+            }
+            return group;
+        }
+
+        [[nodiscard]] u32 CountLevels(const VirtualMesh& mesh)
+        {
+            u32 maxDepth = 0;
+            for (const VirtualClusterGroup& group : mesh.Groups)
+            {
+                maxDepth = std::max(maxDepth, group.Depth);
+            }
+            return maxDepth + 1;
+        }
+
+        // The DAG built so far made loadable: the emitted levels plus one terminal cap group
+        // over copies of the pending clusters — the shape the MaxLevels cap produces, so it
+        // keeps every builder invariant. Used for streaming; leaves the build state untouched.
+        [[nodiscard]] VirtualMesh SnapshotWithCap(const VirtualMesh& built, const BuildContext& ctx,
+                                                  const std::vector<BuildCluster>& clusters,
+                                                  const std::vector<u32>& pending, u32 depth)
+        {
+            VirtualMesh snapshot = built;
+
+            std::vector<BuildCluster> capClusters;
+            capClusters.reserve(pending.size());
+            std::vector<u32> capMembers(pending.size());
+            for (sizet i = 0; i < pending.size(); ++i)
+            {
+                capClusters.push_back(clusters[pending[i]]);
+                capMembers[i] = static_cast<u32>(i);
+            }
+
+            VirtualLODBounds capBounds = MergeLODBounds(capClusters, capMembers);
+            capBounds.Error = std::numeric_limits<f32>::max();
+            EmitGroup(snapshot, ctx, capClusters, capMembers, depth, capBounds);
+            snapshot.LevelCount = CountLevels(snapshot);
+            return snapshot;
+        }
     } // namespace
 
-    VirtualMesh BuildSubmesh(const MeshSource& meshSource, u32 submeshIndex, const VirtualMeshBuildConfig& config)
+    VirtualMesh BuildSubmesh(const MeshSource& meshSource, u32 submeshIndex, const VirtualMeshBuildConfig& config,
+                             const LevelSink& onLevel)
     {
         OLO_PROFILE_FUNCTION();
 
@@ -825,10 +931,12 @@ namespace OloEngine::VirtualMeshBuilder
             result = VirtualMesh{};
             return result;
         }
-        for (BuildCluster& cluster : clusters)
-        {
-            cluster.LODBounds = TightLODBounds(ctx, cluster.Indices, 0.0f);
-        }
+        ParallelFor("VirtualMeshBuilder::LeafBounds", static_cast<i32>(clusters.size()), 64,
+                    [&](i32 clusterIndex)
+                    {
+                        BuildCluster& cluster = clusters[static_cast<sizet>(clusterIndex)];
+                        cluster.LODBounds = TightLODBounds(ctx, cluster.Indices, 0.0f);
+                    });
 
         std::vector<u32> pending(clusters.size());
         for (sizet i = 0; i < clusters.size(); ++i)
@@ -843,65 +951,55 @@ namespace OloEngine::VirtualMeshBuilder
         // Merge + simplify until a single cluster (or nothing but stuck groups) remains.
         while (pending.size() > 1 && depth < ctx.Config.MaxLevels)
         {
+            if (IsCancelled(ctx.Config))
+            {
+                return VirtualMesh{};
+            }
+
             std::vector<std::vector<u32>> const partitions = Partition(ctx, clusters, pending);
             LockGroupBoundaries(ctx, clusters, partitions, locks);
 
-            std::vector<u32> nextPending;
-            for (const std::vector<u32>& members : partitions)
+            // The groups are independent once the locks are set; simplify them across the task
+            // pool (group cost varies a lot, hence Unbalanced) and emit in partition order.
+            std::vector<GroupResult> groups(partitions.size());
+            ParallelFor("VirtualMeshBuilder::SimplifyGroups", static_cast<i32>(partitions.size()), 1,
+                        [&](i32 partitionIndex)
+                        {
+                            if (IsCancelled(ctx.Config))
+                            {
+                                return;
+                            }
+                            auto const index = static_cast<sizet>(partitionIndex);
+                            groups[index] = SimplifyGroup(ctx, clusters, partitions[index], locks);
+                        },
+                        EParallelForFlags::Unbalanced);
+            // Skipped groups left default results behind; none of them may be emitted
+            if (IsCancelled(ctx.Config))
             {
-                std::vector<u32> merged;
-                {
-                    sizet totalIndexCount = 0;
-                    for (u32 const member : members)
-                    {
-                        totalIndexCount += clusters[member].Indices.size();
-                    }
-                    merged.reserve(totalIndexCount);
-                }
-                for (u32 const member : members)
-                {
-                    merged.insert(merged.end(), clusters[member].Indices.begin(), clusters[member].Indices.end());
-                }
-
-                VirtualLODBounds groupBounds = MergeLODBounds(clusters, members);
-
-                auto targetIndexCount = static_cast<sizet>(static_cast<f64>(merged.size() / 3) * ctx.Config.SimplifyRatio) * 3;
+                return VirtualMesh{};
+            }
 
-                SimplifyOutcome const outcome = Simplify(ctx, merged, locks, targetIndexCount);
-                ++pathCounts[static_cast<sizet>(outcome.Path)];
+            std::vector<u32> nextPending;
+            for (sizet g = 0; g < partitions.size(); ++g)
+            {
+                const std::vector<u32>& members = partitions[g];
+                GroupResult& group = groups[g];
+                ++pathCounts[static_cast<sizet>(group.Path)];
 
-                if (outcome.Path == SimplifyPath::Stuck)
+                if (group.Path == SimplifyPath::Stuck)
                 {
-                    // Simplification is stuck (or annihilated the geometry, which must not
-                    // leave a hole in coarse cuts) — emit as a terminal group that is never
-                    // refined away (FLT_MAX error keeps it selected at any threshold).
-                    //
                     // Freeze BEFORE emitting: EmitGroup consumes (clears) the members' indices,
                     // and the boundary this group shares with its still-live neighbours has to
                     // stay locked for every remaining level or the coarse cuts crack along it.
-                    groupBounds.Error = std::numeric_limits<f32>::max();
                     FreezeTerminalGroupBoundary(ctx, clusters, members);
-                    EmitGroup(result, ctx, clusters, members, depth, groupBounds);
+                    EmitGroup(result, ctx, clusters, members, depth, group.Bounds);
                     continue;
                 }
 
-                const std::vector<u32>& simplified = outcome.Indices;
-
-                // Monotone error: parent error can never be below any child's error. This is the
-                // reference's error merge at its default parameters —
-                // max(previous * simplify_error_merge_previous, current) + current *
-                // simplify_error_merge_additive with merge_previous = 1 and additive = 0.
-                groupBounds.Error = std::max(groupBounds.Error, outcome.AbsoluteError);
-
-                i32 const refinedGroup = EmitGroup(result, ctx, clusters, members, depth, groupBounds);
-
-                std::vector<BuildCluster> split = Clusterize(ctx, simplified.data(), simplified.size());
-                for (BuildCluster& cluster : split)
+                i32 const refinedGroup = EmitGroup(result, ctx, clusters, members, depth, group.Bounds);
+                for (BuildCluster& cluster : group.Split)
                 {
                     cluster.RefinedGroup = refinedGroup;
-                    // Conservative propagation: the new cluster inherits the group bounds,
-                    // so the next level's merged sphere contains this group's sphere.
-                    cluster.LODBounds = groupBounds;
                     clusters.push_back(std::move(cluster));
                     nextPending.push_back(static_cast<u32>(clusters.size()) - 1);
                 }
@@ -909,6 +1007,11 @@ namespace OloEngine::VirtualMeshBuilder
 
             pending = std::move(nextPending);
             ++depth;
+
+            if (onLevel && pending.size() > 1 && depth < ctx.Config.MaxLevels)
+            {
+                onLevel(submeshIndex, SnapshotWithCap(result, ctx, clusters, pending, depth));
+            }
         }
 
         if (pending.size() == 1)
@@ -928,12 +1031,7 @@ namespace OloEngine::VirtualMeshBuilder
             EmitGroup(result, ctx, clusters, pending, depth, capBounds);
         }
 
-        u32 maxDepth = 0;
-        for (const VirtualClusterGroup& group : result.Groups)
-        {
-            maxDepth = std::max(maxDepth, group.Depth);
-        }
-        result.LevelCount = maxDepth + 1;
+        result.LevelCount = CountLevels(result);
 
         OLO_CORE_TRACE("VirtualMeshBuilder: submesh {} -> {} clusters in {} groups across {} levels from {} triangles "
                        "(simplify path: {} permissive, {} welded, {} sloppy, {} stuck)",
@@ -969,6 +1067,14 @@ namespace OloEngine::VirtualMeshBuilder
 
         ReportUvDegenerates(result, submeshIndex);
 
+        if (IsCancelled(ctx.Config))
+        {
+            return VirtualMesh{};
+        }
+        if (onLevel)
+        {
+            onLevel(submeshIndex, result);
+        }
         return result;
     }
 
@@ -977,7 +1083,7 @@ namespace OloEngine::VirtualMeshBuilder
         return BuildSubmesh(meshSource, 0, config);
     }
 
-    VirtualMeshSet BuildSet(const MeshSource& meshSource, const VirtualMeshBuildConfig& config)
+    VirtualMeshSet BuildSet(const MeshSource& meshSource, const VirtualMeshBuildConfig& config, const LevelSink& onLevel)
     {
         OLO_PROFILE_FUNCTION();
 
@@ -993,10 +1099,31 @@ namespace OloEngine::VirtualMeshBuilder
         // No submesh records => one implicit submesh over the whole index buffer.
         u32 const submeshCount = submeshes.IsEmpty() ? 1u : static_cast<u32>(submeshes.Num());
 
+        // Submeshes share nothing but the read-only source, so they build concurrently; the
+        // parts are collected in submesh order afterwards.
+        std::vector<VirtualMesh> dags(submeshCount);
+        ParallelFor("VirtualMeshBuilder::BuildSet", static_cast<i32>(submeshCount), 1,
+                    [&](i32 submeshIndex)
+                    {
+                        if (IsCancelled(config))
+                        {
+                            return;
+                        }
+                        auto const index = static_cast<u32>(submeshIndex);
+                        dags[index] = BuildSubmesh(meshSource, index, config, onLevel);
+                    },
+                    EParallelForFlags::Unbalanced);
+
+        // A partial set must not pass for a finished one (BuildSetCached would store it)
+        if (IsCancelled(config))
+        {
+            return set;
+        }
+
         set.Parts.reserve(submeshCount);
         for (u32 i = 0; i < submeshCount; ++i)
         {
-            VirtualMesh dag = BuildSubmesh(meshSource, i, config);
+            VirtualMesh& dag = dags[i];
             if (!dag.IsValid())
             {
                 // A submesh the builder can't handle (degenerate, sub-triangle) is skipped
@@ -1021,4 +1148,45 @@ namespace OloEngine::VirtualMeshBuilder
                        set.Parts.size(), submeshCount, set.TotalClusters(), set.TotalSourceTriangles());
         return set;
     }
+
+    VirtualMeshSet BuildSetCached(const MeshSource& meshSource, const LevelSink& onLevel,
+                                  const std::atomic<bool>* cancelToken)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        VirtualMeshBuildConfig config;
+        config.CancelToken = cancelToken;
+
+        DerivedDataCache& cache = DerivedDataCache::Get();
+        if (!cache.IsEnabled())
+        {
+            return BuildSet(meshSource, config, onLevel);
+        }
+
+        // The fingerprint already covers the builder version and every config default, so
+        // it doubles as the cooker version here.
+        const DerivedDataKey key = DerivedDataKeyBuilder("VirtualMeshSet", VirtualMeshSerializer::CurrentCookFingerprint())
+                                       .AppendMeshGeometry(meshSource)
+                                       .Build();
+
+        VirtualMeshSet set;
+        if (std::vector<u8> blob; cache.Load(key, blob) && VirtualMeshSerializer::DeserializeSetFromBlob(blob, set))
+        {
+            if (onLevel)
+            {
+                for (const VirtualMeshPart& part : set.Parts)
+                {
+                    onLevel(part.SubmeshIndex, part.Dag);
+                }
+            }
+            return set;
+        }
+
+        set = BuildSet(meshSource, config, onLevel);
+        if (set.IsValid())
+        {
+            cache.Store(key, VirtualMeshSerializer::SerializeSetToBlob(set));
+        }
+        return set;
+    }
 } // namespace OloEngine::VirtualMeshBuilder
@@ -3,6 +3,9 @@
 #include "OloEngine/Core/Base.h"
 #include "OloEngine/Renderer/VirtualGeometry/VirtualMesh.h"
 
+#include <atomic>
+#include <functional>
+
 namespace OloEngine
 {
     class MeshSource;
@@ -44,6 +47,11 @@ namespace OloEngine
         // Error multiplier applied to a sloppy result (clodConfig::simplify_error_factor_sloppy),
         // accounting for appearance degradation the quadric error does not capture.
         f32 SimplifyErrorFactorSloppy = 2.0f;
+
+        // Cooperative cancellation, tested before every level and every group. A cancelled
+        // build stops there and returns an empty mesh / set without calling the LevelSink
+        // again. Not part of the cook: the fingerprint ignores it.
+        const std::atomic<bool>* CancelToken = nullptr;
     };
 
     // Offline builder for the Nanite-style cluster LOD DAG (issue #629).
@@ -88,13 +96,25 @@ namespace OloEngine
     //    boundaries — breaking both the source-fidelity guarantee and watertight cuts. Using it
     //    would require per-level vertex copies and a new blob format; clusterlod.h does not use
     //    it either.
+    //
+    // Threading: the groups of one level are independent simplification jobs and run across
+    // the task pool, and BuildSet builds its submeshes concurrently. Every level's boundary
+    // locks are computed before its groups fan out and the results are emitted in partition
+    // order, so the output is bit-identical to a single-threaded build.
     namespace VirtualMeshBuilder
     {
+        // Receives a loadable snapshot of a submesh's DAG while it is still being built: after
+        // every level that does not finish the DAG, the levels so far closed by one terminal cap
+        // group over the clusters still pending (the MaxLevels cap shape), then the finished
+        // DAG itself. Snapshots of one submesh arrive in order with growing LevelCount; BuildSet
+        // calls the sink from task workers, concurrently for different submeshes.
+        using LevelSink = std::function<void(u32 submeshIndex, const VirtualMesh& snapshot)>;
+
         // Builds the DAG for ONE submesh's triangle range. Returns an empty mesh
         // (IsValid() == false) for unsupported input: no geometry, a degenerate range, or a
-        // skinned/morph-target source.
+        // skinned/morph-target source; `onLevel` is never called for those.
         [[nodiscard]] VirtualMesh BuildSubmesh(const MeshSource& meshSource, u32 submeshIndex,
-                                               const VirtualMeshBuildConfig& config = {});
+                                               const VirtualMeshBuildConfig& config = {}, const LevelSink& onLevel = {});
 
         // Builds one DAG per submesh. This is the entry point for real assets: a cluster
         // must not span a material boundary (a group is simplified as a unit, so a straddling
@@ -104,7 +124,18 @@ namespace OloEngine
         // Submeshes the builder cannot handle are skipped, not fatal — the set is valid as
         // long as at least one part built. Still rejects skinned / morph-target sources
         // outright: those deform at runtime, so a static cluster DAG would be wrong.
-        [[nodiscard]] VirtualMeshSet BuildSet(const MeshSource& meshSource, const VirtualMeshBuildConfig& config = {});
+        [[nodiscard]] VirtualMeshSet BuildSet(const MeshSource& meshSource, const VirtualMeshBuildConfig& config = {},
+                                              const LevelSink& onLevel = {});
+
+        // BuildSet with the default config, through the shared DerivedDataCache: keyed on
+        // the source geometry and CurrentCookFingerprint(), so a mesh whose geometry was
+        // cooked before (another model, project or checkout) skips the build. A hit is
+        // parsed with the same hostile-input reader as any other cooked blob; one that
+        // fails it is rebuilt. On a hit `onLevel` receives each cached part once, as final.
+        // `cancelToken` becomes the build's VirtualMeshBuildConfig::CancelToken; a cancelled
+        // build stores nothing.
+        [[nodiscard]] VirtualMeshSet BuildSetCached(const MeshSource& meshSource, const LevelSink& onLevel = {},
+                                                    const std::atomic<bool>* cancelToken = nullptr);
 
         // Single-DAG convenience for a single-submesh source (and the CPU unit tests).
         // Equivalent to BuildSubmesh(meshSource, 0, config).
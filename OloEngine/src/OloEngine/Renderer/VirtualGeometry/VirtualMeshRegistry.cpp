@@ -8,6 +8,8 @@
 #include "OloEngine/Renderer/ShaderBindingLayout.h"
 #include "OloEngine/Renderer/StorageBuffer.h"
 #include "OloEngine/Renderer/VirtualGeometry/VirtualMeshBuilder.h"
+#include "OloEngine/Task/Task.h"
+#include "OloEngine/Threading/UniqueLock.h"
 
 #include <glm/geometric.hpp>
 #include <glm/matrix.hpp>
@@ -59,7 +61,7 @@ namespace OloEngine
         }
         if (!haveBuilt)
         {
-            built = VirtualMeshBuilder::BuildSet(source);
+            built = VirtualMeshBuilder::BuildSetCached(source);
         }
 
         // One MeshEntry per part, pushed contiguously so MeshParts is just a range. The pool
@@ -70,20 +72,7 @@ namespace OloEngine
         {
             MeshEntry entry;
             entry.SubmeshIndex = part.SubmeshIndex;
-            if (part.Dag.IsValid())
-            {
-                entry.Packed = PackVirtualMeshForGpu(part.Dag);
-                entry.LevelCount = part.Dag.LevelCount;
-                entry.SourceTriangleCount = part.Dag.SourceTriangleCount;
-                entry.Valid = entry.Packed.IsValid();
-                // Mesh-shader path eligibility (#813): one mesh workgroup
-                // renders one cluster, so EVERY cluster must fit the declared
-                // output limits. Decided per part at registration — the draw
-                // loop routes per instance, never per cluster. (Invalid/empty
-                // packed data is incompatible by IsMeshletCompatible's own
-                // IsValid() guard — no external pre-check needed.)
-                entry.MeshletCompatible = IsMeshletCompatible(entry.Packed);
-            }
+            PackEntry(entry, part.Dag);
             parts.Valid = parts.Valid || entry.Valid;
             m_PoolsDirty = m_PoolsDirty || entry.Valid;
             m_Entries.push_back(std::move(entry));
@@ -106,6 +95,150 @@ namespace OloEngine
         return parts.Valid;
     }
 
+    bool VirtualMeshRegistry::PackEntry(MeshEntry& entry, const VirtualMesh& dag)
+    {
+        entry.Packed = {};
+        entry.LevelCount = 0;
+        entry.SourceTriangleCount = 0;
+        entry.Valid = false;
+        entry.MeshletCompatible = false;
+        if (!dag.IsValid())
+        {
+            return false;
+        }
+
+        entry.Packed = PackVirtualMeshForGpu(dag);
+        entry.LevelCount = dag.LevelCount;
+        entry.SourceTriangleCount = dag.SourceTriangleCount;
+        entry.Valid = entry.Packed.IsValid();
+        // Mesh-shader path eligibility (#813): one mesh workgroup
+        // renders one cluster, so EVERY cluster must fit the declared
+        // output limits. Decided per part at registration — the draw
+        // loop routes per instance, never per cluster. (Invalid/empty
+        // packed data is incompatible by IsMeshletCompatible's own
+        // IsValid() guard — no external pre-check needed.)
+        entry.MeshletCompatible = IsMeshletCompatible(entry.Packed);
+        return entry.Valid;
+    }
+
+    void VirtualMeshRegistry::RegisterMeshSourceStreaming(AssetHandle handle, const Ref<MeshSource>& source)
+    {
+        if (!source || m_EntryLookup.contains(handle))
+        {
+            return;
+        }
+        if (source->HasVirtualMeshBlob())
+        {
+            // Nothing to stream: the cooked set only has to be unpacked.
+            RegisterMeshSource(handle, *source);
+            return;
+        }
+
+        const auto& submeshes = source->GetSubmeshes();
+        u32 const slotCount = submeshes.IsEmpty() ? 1u : static_cast<u32>(submeshes.Num());
+
+        // One slot per submesh, reserved now so the run is contiguous and its position in
+        // m_Entries never moves. Slots start invalid; PublishPendingBuilds fills them. A
+        // submesh the builder skips simply stays an invalid slot, which every consumer of
+        // m_Entries already tolerates.
+        MeshParts parts;
+        parts.FirstEntry = static_cast<u32>(m_Entries.size());
+        parts.Count = slotCount;
+        for (u32 i = 0; i < slotCount; ++i)
+        {
+            MeshEntry entry;
+            entry.SubmeshIndex = i;
+            m_Entries.push_back(std::move(entry));
+        }
+        m_EntryLookup.emplace(handle, parts);
+
+        Ref<PendingBuild> pending = Ref<PendingBuild>::Create();
+        pending->Latest.resize(slotCount);
+        m_PendingBuilds[handle] = pending;
+
+        // The task holds its own references to the source and the mailbox. Invalidate and
+        // Shutdown cancel it through the mailbox; the builder then stops at its next level or
+        // group and stores nothing. Shutdown waits on the handle kept here.
+        std::erase_if(m_BuildTasks, [](const Tasks::TTask<void>& task)
+                      {
+                          return task.IsCompleted();
+                      });
+        m_BuildTasks.push_back(Tasks::Launch(
+            "VirtualMeshRegistry::StreamingBuild",
+            [pending, source, handle]() mutable
+            {
+                const VirtualMeshBuilder::LevelSink sink = [&pending](u32 submeshIndex, const VirtualMesh& snapshot)
+                {
+                    TUniqueLock<FMutex> lock(pending->Mutex);
+                    if (!pending->Cancelled && submeshIndex < pending->Latest.size())
+                    {
+                        pending->Latest[submeshIndex] = snapshot;
+                    }
+                };
+
+                VirtualMeshSet const built = VirtualMeshBuilder::BuildSetCached(*source, sink, &pending->Cancelled);
+
+                TUniqueLock<FMutex> lock(pending->Mutex);
+                pending->Finished = true;
+                if (!built.IsValid() && !pending->Cancelled)
+                {
+                    OLO_CORE_WARN("VirtualMeshRegistry: Building the cluster DAG failed for mesh asset {} — "
+                                  "the VirtualMeshComponent will not render",
+                                  static_cast<u64>(handle));
+                }
+            },
+            Tasks::ETaskPriority::BackgroundNormal));
+
+        OLO_CORE_TRACE("VirtualMeshRegistry: mesh asset {} queued for a streaming build ({} part slot(s))",
+                       static_cast<u64>(handle), slotCount);
+    }
+
+    bool VirtualMeshRegistry::IsBuildPending(AssetHandle handle) const
+    {
+        return m_PendingBuilds.contains(handle);
+    }
+
+    void VirtualMeshRegistry::PublishPendingBuilds()
+    {
+        for (auto it = m_PendingBuilds.begin(); it != m_PendingBuilds.end();)
+        {
+            PendingBuild& pending = *it->second;
+            std::vector<std::optional<VirtualMesh>> latest;
+            bool finished = false;
+            {
+                TUniqueLock<FMutex> lock(pending.Mutex);
+                latest.swap(pending.Latest);
+                pending.Latest.resize(latest.size());
+                finished = pending.Finished;
+            }
+
+            if (auto const lookup = m_EntryLookup.find(it->first); lookup != m_EntryLookup.end())
+            {
+                MeshParts& parts = lookup->second;
+                for (u32 i = 0; i < parts.Count && i < latest.size(); ++i)
+                {
+                    if (!latest[i])
+                    {
+                        continue;
+                    }
+                    // Repacked in place: the slot keeps its index, so no other mesh rebases.
+                    MeshEntry& entry = m_Entries[parts.FirstEntry + i];
+                    parts.Valid = PackEntry(entry, *latest[i]) || parts.Valid;
+                    m_PoolsDirty = true;
+                }
+            }
+
+            if (finished)
+            {
+                it = m_PendingBuilds.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
     bool VirtualMeshRegistry::IsRegistered(AssetHandle handle) const
     {
         return m_EntryLookup.contains(handle);
@@ -139,6 +272,11 @@ namespace OloEngine
         }
         m_EntryLookup.erase(it);
         m_BlendRejectionWarned.erase(static_cast<u64>(handle));
+        if (auto pending = m_PendingBuilds.find(handle); pending != m_PendingBuilds.end())
+        {
+            pending->second->Cancelled = true;
+            m_PendingBuilds.erase(pending);
+        }
         m_PoolsDirty = true;
 
         OLO_CORE_TRACE("VirtualMeshRegistry: invalidated cluster DAG for mesh asset {} (source reloaded)",
@@ -156,6 +294,11 @@ namespace OloEngine
 
     void VirtualMeshRegistry::BeginFrame()
     {
+        if (!m_PendingBuilds.empty())
+        {
+            PublishPendingBuilds();
+        }
+
         m_Submissions.clear();
         m_FrameInstances.clear();
         m_TotalFrameClusterCount = 0;
@@ -956,6 +1099,17 @@ namespace OloEngine
         }
         m_DebugWidth = 0;
         m_DebugHeight = 0;
+        for (auto& [handle, pending] : m_PendingBuilds)
+        {
+            pending->Cancelled = true;
+        }
+        m_PendingBuilds.clear();
+        // The builds still touch their sources and the DerivedDataCache; let them stop
+        for (const Tasks::TTask<void>& task : m_BuildTasks)
+        {
+            task.Wait();
+        }
+        m_BuildTasks.clear();
         m_Entries.clear();
         m_EntryLookup.clear();
         m_BlendRejectionWarned.clear();
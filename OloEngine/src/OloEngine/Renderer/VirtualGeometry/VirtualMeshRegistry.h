@@ -8,13 +8,17 @@
 #include "OloEngine/Renderer/GPUCache/GPUPagedCache.h"
 #include "OloEngine/Renderer/VirtualGeometry/VirtualMesh.h"
 #include "OloEngine/Renderer/VirtualGeometry/VirtualMeshGpuData.h"
+#include "OloEngine/Task/Task.h"
+#include "OloEngine/Threading/Mutex.h"
 
 #include <glm/mat4x4.hpp>
 #include <glm/vec3.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <functional>
+#include <optional>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -237,6 +241,10 @@ namespace OloEngine
             // ...of which the asset resolved but the cluster DAG would not
             // build, so the entity was dropped inside SubmitVirtualMesh.
             u32 RegistrationFailures = 0;
+            // ...of which the cluster DAG is still building on the task pool
+            // (streaming registration). Not a fault: the mesh draws as soon as
+            // the build publishes its first finished level.
+            u32 PendingBuilds = 0;
             // ...of which actually reached VirtualMeshRegistry::Submit.
             u32 Submitted = 0;
             // Set when the master switch is off: the components were drawn
@@ -249,7 +257,7 @@ namespace OloEngine
             // no VirtualMeshComponent at all, and for the classic-fallback A/B.
             [[nodiscard]] bool SilentlyDrewNothing() const
             {
-                return EnabledComponents > 0 && Submitted == 0 && !FellBackToClassic;
+                return EnabledComponents > 0 && Submitted == 0 && PendingBuilds == 0 && !FellBackToClassic;
             }
         };
 
@@ -271,11 +279,23 @@ namespace OloEngine
         bool RegisterMeshSource(AssetHandle handle, const MeshSource& source);
         [[nodiscard]] bool IsRegistered(AssetHandle handle) const;
 
+        // RegisterMeshSource without the stall: returns at once and builds the DAG on the
+        // task pool. One entry is reserved per submesh; each is filled in by BeginFrame as
+        // the builder streams snapshots (VirtualMeshBuilder::LevelSink), first drawable after
+        // the first finished level and replaced by every more complete one. FindParts().Valid
+        // stays false until the first snapshot lands. A cooked blob registers synchronously,
+        // exactly as in RegisterMeshSource. Render thread only, like every other mutator.
+        void RegisterMeshSourceStreaming(AssetHandle handle, const Ref<MeshSource>& source);
+        // A streaming build for this mesh is still running.
+        [[nodiscard]] bool IsBuildPending(AssetHandle handle) const;
+
         // Drops the cached DAG for a mesh asset so the next submission rebuilds it from the
         // (reloaded) source. RegisterMeshSource caches by AssetHandle and its callers take an
         // IsRegistered() fast path, so WITHOUT this a MeshSource hot-reload left the old DAG
         // live for the process lifetime — the virtual path kept drawing the pre-edit geometry
         // while the classic path drew the new. Called from Renderer3D::OnAssetReloaded.
+        // A streaming build still running for the mesh is cancelled and stops at its next
+        // level or group, so a re-registration does not race a stale full build.
         void Invalidate(AssetHandle handle);
 
         // The parts (one per submesh) registered for this mesh. Count == 0 when the mesh is
@@ -287,6 +307,7 @@ namespace OloEngine
         }
 
         // Frame lifecycle -----------------------------------------------------
+        // Also publishes whatever the streaming builds produced since the last call.
         void BeginFrame();
         void Submit(const VirtualMeshSubmission& submission);
         [[nodiscard]] const std::vector<VirtualMeshSubmission>& GetSubmissions() const
@@ -514,7 +535,8 @@ namespace OloEngine
             return m_VisbufferHeight;
         }
 
-        // Releases every GL object (called from Renderer3D::Shutdown).
+        // Cancels and waits for any streaming build, then releases every GL object (called
+        // from Renderer3D::Shutdown).
         void Shutdown();
 
       private:
@@ -541,6 +563,21 @@ namespace OloEngine
             bool Resident = false;
         };
 
+        // Mailbox between a streaming build's task and the render thread. The task only
+        // ever overwrites Latest (a newer snapshot supersedes an unpublished one); BeginFrame
+        // takes it. Cancelled is the build's VirtualMeshBuildConfig::CancelToken: Invalidate
+        // and Shutdown set it and the builder stops at its next level or group.
+        struct PendingBuild : public RefCounted
+        {
+            FMutex Mutex;
+            std::vector<std::optional<VirtualMesh>> Latest; // per submesh slot
+            bool Finished = false;
+            std::atomic<bool> Cancelled = false;
+        };
+
+        void PublishPendingBuilds();
+        // Fills (or refills) a part's entry from a built DAG; returns the entry's validity.
+        bool PackEntry(MeshEntry& entry, const VirtualMesh& dag);
         void RebuildPools();
         void EnsureFrameBuffers();
         bool LoadPage(u32 pageIndex);
@@ -560,6 +597,10 @@ namespace OloEngine
 
         std::unordered_map<AssetHandle, MeshParts> m_EntryLookup;
         std::vector<MeshEntry> m_Entries; // stable order => deterministic pool layout
+        std::unordered_map<AssetHandle, Ref<PendingBuild>> m_PendingBuilds;
+        // Every streaming build task not yet seen complete, cancelled ones included, so
+        // Shutdown can wait for them
+        std::vector<Tasks::TTask<void>> m_BuildTasks;
         bool m_PoolsDirty = false;
         // Meshes whose AlphaMode::Blend parts have already been reported as skipped —
         // PrepareFrame runs every frame, the warning must not.
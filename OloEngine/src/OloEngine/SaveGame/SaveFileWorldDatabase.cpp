@@ -276,6 +276,47 @@ namespace OloEngine
         return true;
     }
 
+    // ========================================================================
+    // Batches
+    // ========================================================================
+
+    bool SaveFileWorldDatabase::ApplyBatch(const WorldDatabaseBatch& batch)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        TUniqueLock<FMutex> lock(m_Mutex);
+        if (!m_Initialized)
+        {
+            return false;
+        }
+        for (auto const& write : batch.EntityWrites)
+        {
+            m_EntityStates[write.UUID] = { write.Zone, write.Data };
+        }
+        for (u64 const uuid : batch.EntityDeletes)
+        {
+            m_EntityStates.erase(uuid);
+        }
+        for (auto const& [accountID, state] : batch.PlayerWrites)
+        {
+            m_PlayerStates[accountID] = state;
+        }
+        for (auto const& [key, value] : batch.WorldStateWrites)
+        {
+            m_WorldState[key] = value;
+        }
+        if (!batch.IsEmpty())
+        {
+            m_Dirty = true;
+        }
+        return true;
+    }
+
+    bool SaveFileWorldDatabase::Flush()
+    {
+        return FlushToDisk();
+    }
+
     // ========================================================================
     // Disk Flush
     // ========================================================================
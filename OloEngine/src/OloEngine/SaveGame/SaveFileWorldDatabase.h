@@ -34,6 +34,11 @@ namespace OloEngine
         bool SetWorldState(const std::string& key, const std::string& value) override;
         bool GetWorldState(const std::string& key, std::string& outValue) override;
 
+        // Applied under a single lock, so a flush never captures half a batch.
+        bool ApplyBatch(const WorldDatabaseBatch& batch) override;
+        // FlushToDisk()
+        bool Flush() override;
+
         bool Initialize(const std::string& connectionString) override;
         void Shutdown() override;
         [[nodiscard]] bool IsInitialized() const override;
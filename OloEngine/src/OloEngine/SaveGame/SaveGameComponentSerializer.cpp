@@ -2113,7 +2113,7 @@ namespace OloEngine
             sanitize(c.m_HeightShaping.TerraceSharpness, 0.0f, 0.999f, 0.6f);
             sanitize(c.m_HeightShaping.HeightExponent, 0.05f, 16.0f, 1.0f);
             c.m_HeightShaping.TerraceSteps = std::min(c.m_HeightShaping.TerraceSteps, 256u);
-            c.m_SplatmapGenResolution = std::clamp(c.m_SplatmapGenResolution, 16u, 4096u);
+            c.m_SplatmapGenResolution = std::clamp(c.m_SplatmapGenResolution, 16u, kMaxTerrainResolution);
             c.m_ProceduralErosionIterations = std::clamp(c.m_ProceduralErosionIterations, 0, 64);
             // Discriminated mode: an out-of-range value falls back to the
             // default mesher rather than saturating to the other valid one —
@@ -2911,6 +2911,10 @@ namespace OloEngine
         ar << c.m_MaxSpeed << c.m_Acceleration << c.m_StoppingDistance;
         ar << c.m_AvoidancePriority;
         ar << c.m_LockYAxis;
+        if (HasFieldsSince(ar, 21))
+        {
+            ar << c.m_FlowFieldGroup; // v21+ flow-field navigation group
+        }
         // Runtime path state intentionally excluded — recomputed by the nav system.
     }
 
@@ -3989,7 +3993,12 @@ namespace OloEngine
     {
         ar << c.BehaviorTreeAssetHandle;
         SerializeBlackboard(ar, c.Blackboard);
-        // RuntimeTree + IsRunning are runtime state; the tick loop rebuilds them.
+        if (HasFieldsSince(ar, 23))
+        {
+            ar << c.TickInterval; // v23+ staggered tree ticks
+        }
+        // RuntimeTree, CompiledTree, node state and IsRunning are runtime state;
+        // the tick loop rebuilds them.
     }
 
     void SaveGameComponentSerializer::Serialize(FArchive& ar, StateMachineComponent& c)
@@ -4024,6 +4033,10 @@ namespace OloEngine
         ar << c.RequireLineOfSight;
         ar << c.PerceiverTeam;
         ar << c.DetectSameTeam;
+        if (HasFieldsSince(ar, 22))
+        {
+            ar << c.SenseInterval; // v22+ staggered sight updates
+        }
     }
 
     void SaveGameComponentSerializer::Serialize(FArchive& ar, InventoryComponent& c)
@@ -1,6 +1,8 @@
 #include "OloEnginePCH.h"
 #include "SaveGameManager.h"
 
+#include "OloEngine/Core/Timer.h"
+#include "OloEngine/Core/UUID.h"
 #include "OloEngine/SaveGame/SaveGameFile.h"
 #include "OloEngine/SaveGame/SaveGameSerializer.h"
 #include "OloEngine/Project/Project.h"
@@ -8,14 +10,19 @@
 #include "OloEngine/Scene/Components.h"
 #include "OloEngine/Task/Task.h"
 #include "OloEngine/Task/NamedThreads.h"
+#include "OloEngine/Threading/Mutex.h"
+#include "OloEngine/Threading/UniqueLock.h"
 #include "Platform/Steam/SteamManager.h"
 
 #include <cctype>
+#include <charconv>
 #include <chrono>
 #include <fstream>
 #include <mutex>
+#include <optional>
 #include <span>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace OloEngine
 {
@@ -27,6 +34,8 @@ namespace OloEngine
     std::atomic<u32> SaveGameManager::s_AutoSaveSlotIndex{ 0 };
     std::array<std::atomic<bool>, SaveGameManager::kMaxQuickSaveSlots> SaveGameManager::s_QuickSaveInFlight{};
     std::array<std::atomic<bool>, SaveGameManager::kMaxAutoSaveSlots> SaveGameManager::s_AutoSaveInFlight{};
+    std::atomic<bool> SaveGameManager::s_LoadInFlight{ false };
+    std::atomic<bool> SaveGameManager::s_LoadWorkerInFlight{ false };
 
     // --- Steam Cloud mirror (#644) --------------------------------------------------------
     //
@@ -260,6 +269,103 @@ namespace OloEngine
             OLO_CORE_INFO("[SaveGameManager] Restored '{}' from Steam Cloud ({} bytes).", slotName, bytes.size());
             return true;
         }
+
+        // Zlib the payload when that actually makes it smaller, recording the choice in the header.
+        void CompressPayload(std::vector<u8>& payload, SaveGameHeader& header)
+        {
+            std::vector<u8> compressedPayload;
+            if (SaveGameFile::Compress(payload, compressedPayload) && compressedPayload.size() < payload.size())
+            {
+                header.SetCompression(SaveGameCompression::Zlib);
+                header.PayloadUncompressedSize = payload.size();
+                payload = std::move(compressedPayload);
+            }
+        }
+
+        // Log a completed local write and queue its Steam Cloud mirror (#644). Worker thread.
+        void OnSaveWritten(const std::filesystem::path& path, const std::string& slotName, u32 entityCount)
+        {
+            std::error_code ec;
+            auto fileSize = std::filesystem::file_size(path, ec);
+            if (ec)
+            {
+                OLO_CORE_WARN("[SaveGameManager] Could not read file size for '{}': {}", path.string(), ec.message());
+            }
+            OLO_CORE_INFO("[SaveGameManager] Saved '{}' ({} entities, {:.1f} KB)",
+                          slotName, entityCount,
+                          ec ? 0.0f : static_cast<f32>(fileSize) / 1024.0f);
+
+            // Steam Cloud mirror (#644). We are on a WORKER thread here and SteamManager
+            // is game-thread-only, so hop rather than calling it inline — this is the one
+            // place the cloud integration could have introduced a data race.
+            //
+            // Read the bytes HERE, on the worker, and move them into the task. The game
+            // thread then only makes the Steam call, never touches the disk: re-reading a
+            // save-sized file on the frame thread would be a hitch for no benefit, since
+            // this thread just finished writing it and is not frame-critical.
+            //
+            // Enqueued without checking Steam availability first — querying it from this
+            // thread would itself violate the game-thread contract — so the task re-checks
+            // and no-ops when Steam is absent. The read is skipped in that case only by
+            // the emptiness guard inside, which is the price of not being able to ask.
+            //
+            // Deliberately AFTER the local write succeeded, and it cannot affect the result:
+            // a cloud failure must never turn a good local save into a reported error.
+            std::vector<u8> cloudBytes;
+            u64 generation = 0;
+            if (ReadSaveAndTakeCloudTicket(path, slotName, cloudBytes, generation))
+            {
+                Tasks::EnqueueGameThreadTask(
+                    [bytes = std::move(cloudBytes), slotName, generation]() mutable
+                    {
+                        MirrorSaveToCloud(std::move(bytes), slotName, generation);
+                    },
+                    "SteamCloudMirror");
+            }
+            else
+            {
+                OLO_CORE_WARN("[SaveGameManager] Could not re-read '{}' to mirror it to Steam Cloud; "
+                              "the local save is intact.",
+                              path.string());
+            }
+        }
+
+        // --- Incremental auto-save chain ------------------------------------------------------
+        //
+        // The fingerprints of the current base save. Deciding what is dirty then costs one
+        // serialization pass of the snapshot on the worker and no game-thread time at all —
+        // and unlike registry on_update signals it cannot miss a component mutated in place
+        // through a reference, which is how nearly all gameplay code writes components.
+        //
+        // Only auto-save workers touch it, one at a time: the mutex is held across the writes,
+        // so a new base and the checkpoints diffed against the old one never interleave.
+        FMutex s_AutoSaveChainMutex;
+        SaveGameCheckpoint s_AutoSaveBase;
+
+        [[nodiscard]] std::string AutoSaveBaseSlotName(u64 checkpointId)
+        {
+            return std::string(SaveGameManager::kAutoSaveBasePrefix) + std::to_string(checkpointId);
+        }
+
+        [[nodiscard]] bool IsAutoSaveBaseSlot(std::string_view slotName)
+        {
+            return slotName.starts_with(SaveGameManager::kAutoSaveBasePrefix);
+        }
+
+        // --- LoadAsync ------------------------------------------------------------------------
+        //
+        // Game thread only. Holds a reference to the target scene so it cannot die mid-load.
+        struct PendingLoad
+        {
+            Ref<Scene> TargetScene;
+            std::string SlotName;
+            SaveLoadCompletionCallback Callback;
+            Scope<SaveGameRestoreJob> Job; // null until the worker has read the payload
+        };
+        std::optional<PendingLoad> s_PendingLoad;
+
+        // Entities rebuilt between budget checks
+        constexpr u32 kAsyncLoadBatchEntities = 32;
     } // namespace
 
     // Reject slot names containing path separators, "..", reserved Windows names, or other dangerous patterns
@@ -368,7 +474,7 @@ namespace OloEngine
                     return false;
                 }
             }
-            return true;
+            return !s_LoadWorkerInFlight.load(std::memory_order_acquire);
         };
 
         while (!allDrained())
@@ -376,6 +482,14 @@ namespace OloEngine
             std::this_thread::yield();
         }
 
+        // An unfinished LoadAsync is abandoned; its scene was never touched.
+        if (s_PendingLoad)
+        {
+            OLO_CORE_WARN("[SaveGameManager] Abandoning the in-progress load of '{}'", s_PendingLoad->SlotName);
+            s_PendingLoad.reset();
+            s_LoadInFlight.store(false, std::memory_order_release);
+        }
+
         OLO_CORE_INFO("[SaveGameManager] Shutdown");
     }
 
@@ -515,6 +629,206 @@ namespace OloEngine
             return SaveLoadResult::InvalidInput;
         }
 
+        if (auto result = PrepareLocalSave(slotName); result != SaveLoadResult::Success)
+        {
+            return result;
+        }
+
+        u32 formatVersion = 0;
+        std::vector<u8> payload;
+        if (auto result = ReadSavePayload(slotName, formatVersion, payload); result != SaveLoadResult::Success)
+        {
+            return result;
+        }
+
+        // Restore scene state
+        if (!SaveGameSerializer::RestoreSceneState(scene, payload, formatVersion))
+        {
+            OLO_CORE_ERROR("[SaveGameManager] Failed to restore scene state from: {}", GetSaveFilePath(slotName).string());
+            return SaveLoadResult::SerializationFailed;
+        }
+
+        OLO_CORE_INFO("[SaveGameManager] Loaded save: {}", slotName);
+        return SaveLoadResult::Success;
+    }
+
+    SaveLoadResult SaveGameManager::QuickLoad(Scene& scene)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        // Find the most recent quick-save
+        std::string bestSlot;
+        i64 bestTimestamp = 0;
+
+        for (u32 i = 0; i < kMaxQuickSaveSlots; ++i)
+        {
+            std::string slotName = "quicksave_" + std::to_string(i);
+            SaveFileInfo info;
+            if (GetSaveInfo(slotName, info) && info.Metadata.TimestampUTC > bestTimestamp)
+            {
+                if (!ValidateSave(slotName))
+                {
+                    OLO_CORE_WARN("[SaveGameManager] Skipping corrupt quick-save: {}", slotName);
+                    continue;
+                }
+                bestTimestamp = info.Metadata.TimestampUTC;
+                bestSlot = slotName;
+            }
+        }
+
+        if (bestSlot.empty())
+        {
+            OLO_CORE_WARN("[SaveGameManager] No quick-save found");
+            return SaveLoadResult::FileNotFound;
+        }
+
+        return Load(scene, bestSlot);
+    }
+
+    SaveLoadResult SaveGameManager::LoadAsync(const Ref<Scene>& scene,
+                                              const std::string& slotName,
+                                              SaveLoadCompletionCallback callback)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        auto fail = [&callback, &slotName](SaveLoadResult result)
+        {
+            if (callback)
+            {
+                Tasks::EnqueueGameThreadTask(
+                    [callback, result, slotName]()
+                    { callback(result, slotName); },
+                    "LoadAsyncFailed");
+            }
+            return result;
+        };
+
+        if (!scene || !IsValidSlotName(slotName))
+        {
+            OLO_CORE_ERROR("[SaveGameManager] LoadAsync called with {}", scene ? "an invalid slot name" : "no scene");
+            return fail(SaveLoadResult::InvalidInput);
+        }
+
+        if (s_LoadInFlight.exchange(true, std::memory_order_acq_rel))
+        {
+            OLO_CORE_WARN("[SaveGameManager] A load is already in progress, not loading '{}'", slotName);
+            return fail(SaveLoadResult::IOError);
+        }
+
+        // Steam Cloud is game-thread-only, so any cloud fallback happens here, before the
+        // worker — which then only ever reads local files.
+        if (auto result = PrepareLocalSave(slotName); result != SaveLoadResult::Success)
+        {
+            s_LoadInFlight.store(false, std::memory_order_release);
+            return fail(result);
+        }
+
+        s_PendingLoad.emplace(PendingLoad{ scene, slotName, std::move(callback), nullptr });
+        s_LoadWorkerInFlight.store(true, std::memory_order_release);
+
+        Tasks::Launch(
+            "LoadGameFromDisk",
+            [slotName]()
+            {
+                OLO_PROFILE_SCOPE("LoadGameFromDisk");
+
+                u32 formatVersion = 0;
+                auto payload = std::make_shared<std::vector<u8>>();
+                SaveLoadResult result = ReadSavePayload(slotName, formatVersion, *payload);
+
+                Tasks::EnqueueGameThreadTask(
+                    [result, formatVersion, payload]()
+                    {
+                        BeginAsyncRestore(result, formatVersion, std::move(*payload));
+                    },
+                    "LoadGameRestore");
+
+                s_LoadWorkerInFlight.store(false, std::memory_order_release);
+            });
+
+        return SaveLoadResult::Pending;
+    }
+
+    bool SaveGameManager::IsLoadInProgress()
+    {
+        return s_LoadInFlight.load(std::memory_order_acquire);
+    }
+
+    void SaveGameManager::BeginAsyncRestore(SaveLoadResult readResult, u32 formatVersion, std::vector<u8>&& payload)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        if (!s_PendingLoad)
+        {
+            return; // abandoned by Shutdown
+        }
+
+        if (readResult != SaveLoadResult::Success)
+        {
+            FinishAsyncLoad(readResult);
+            return;
+        }
+
+        s_PendingLoad->Job = CreateScope<SaveGameRestoreJob>(*s_PendingLoad->TargetScene, std::move(payload), formatVersion);
+        if (s_PendingLoad->Job->GetStatus() == SaveGameRestoreJob::EStatus::Failed)
+        {
+            FinishAsyncLoad(SaveLoadResult::SerializationFailed);
+        }
+    }
+
+    void SaveGameManager::AdvanceAsyncLoad()
+    {
+        OLO_PROFILE_FUNCTION();
+
+        if (!s_PendingLoad || !s_PendingLoad->Job)
+        {
+            return;
+        }
+
+        SaveGameRestoreJob& job = *s_PendingLoad->Job;
+        Timer budget;
+        auto status = job.GetStatus();
+        while (status == SaveGameRestoreJob::EStatus::InProgress && budget.ElapsedMillis() < kAsyncLoadBudgetMs)
+        {
+            status = job.Step(kAsyncLoadBatchEntities);
+        }
+
+        if (status == SaveGameRestoreJob::EStatus::ReadyToCommit)
+        {
+            FinishAsyncLoad(job.Commit(*s_PendingLoad->TargetScene) ? SaveLoadResult::Success
+                                                                    : SaveLoadResult::SerializationFailed);
+        }
+        else if (status == SaveGameRestoreJob::EStatus::Failed)
+        {
+            FinishAsyncLoad(SaveLoadResult::SerializationFailed);
+        }
+    }
+
+    void SaveGameManager::FinishAsyncLoad(SaveLoadResult result)
+    {
+        PendingLoad load = std::move(*s_PendingLoad);
+        s_PendingLoad.reset();
+        s_LoadInFlight.store(false, std::memory_order_release);
+
+        if (result == SaveLoadResult::Success)
+        {
+            OLO_CORE_INFO("[SaveGameManager] Loaded save: {}", load.SlotName);
+        }
+        else
+        {
+            OLO_CORE_ERROR("[SaveGameManager] Failed to load '{}' (result: {})", load.SlotName, static_cast<int>(result));
+        }
+
+        if (load.Callback)
+        {
+            load.Callback(result, load.SlotName);
+        }
+    }
+
+    SaveLoadResult SaveGameManager::PrepareLocalSave(const std::string& slotName)
+    {
+        OLO_PROFILE_FUNCTION();
+
         auto path = GetSaveFilePath(slotName);
         if (!std::filesystem::exists(path))
         {
@@ -525,7 +839,7 @@ namespace OloEngine
             //
             // Restores to disk and then falls through to the normal load path rather than
             // deserializing from memory, so checksum validation, header/version gating and every
-            // other guard below apply to a cloud save exactly as they do to a local one.
+            // other guard in ReadSavePayload apply to a cloud save exactly as they do to a local one.
             if (!RestoreSaveFromCloud(path, slotName))
             {
                 OLO_CORE_ERROR("[SaveGameManager] Save file not found: {}", path.string());
@@ -533,6 +847,28 @@ namespace OloEngine
             }
         }
 
+        // An incremental auto-save is only half a save: its base has to be here too.
+        SaveGameHeader header;
+        if (SaveGameFile::ReadHeader(path, header) && header.IsIncremental())
+        {
+            const std::string baseSlot = AutoSaveBaseSlotName(header.BaseCheckpointId);
+            if (!std::filesystem::exists(GetSaveFilePath(baseSlot)) && !RestoreSaveFromCloud(GetSaveFilePath(baseSlot), baseSlot))
+            {
+                OLO_CORE_ERROR("[SaveGameManager] '{}' is an incremental auto-save and its base '{}' is missing",
+                               slotName, baseSlot);
+                return SaveLoadResult::FileNotFound;
+            }
+        }
+
+        return SaveLoadResult::Success;
+    }
+
+    SaveLoadResult SaveGameManager::ReadSavePayload(const std::string& slotName, u32& outFormatVersion, std::vector<u8>& outPayload)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        auto path = GetSaveFilePath(slotName);
+
         // Validate checksum first
         if (!SaveGameFile::ValidateChecksum(path))
         {
@@ -557,55 +893,49 @@ namespace OloEngine
         }
 
         // Read payload
-        std::vector<u8> payload;
-        if (!SaveGameFile::ReadPayload(path, payload))
+        if (!SaveGameFile::ReadPayload(path, outPayload))
         {
             OLO_CORE_ERROR("[SaveGameManager] Failed to read/decompress payload: {}", path.string());
             return SaveLoadResult::IOError;
         }
+        outFormatVersion = header.FormatVersion;
 
-        // Restore scene state
-        if (!SaveGameSerializer::RestoreSceneState(scene, payload, header.FormatVersion))
+        if (!header.IsIncremental())
         {
-            OLO_CORE_ERROR("[SaveGameManager] Failed to restore scene state from: {}", path.string());
-            return SaveLoadResult::SerializationFailed;
+            return SaveLoadResult::Success;
         }
 
-        OLO_CORE_INFO("[SaveGameManager] Loaded save: {}", slotName);
-        return SaveLoadResult::Success;
-    }
-
-    SaveLoadResult SaveGameManager::QuickLoad(Scene& scene)
-    {
-        OLO_PROFILE_FUNCTION();
-
-        // Find the most recent quick-save
-        std::string bestSlot;
-        i64 bestTimestamp = 0;
+        // Incremental auto-save: merge it onto the exact base it was diffed against.
+        const std::string baseSlot = AutoSaveBaseSlotName(header.BaseCheckpointId);
+        const auto basePath = GetSaveFilePath(baseSlot);
+        SaveGameHeader baseHeader;
+        if (!SaveGameFile::ValidateChecksum(basePath) || !SaveGameFile::ReadHeader(basePath, baseHeader))
+        {
+            OLO_CORE_ERROR("[SaveGameManager] Base '{}' of incremental save '{}' is unreadable", baseSlot, slotName);
+            return SaveLoadResult::ChecksumMismatch;
+        }
+        if (baseHeader.IsIncremental() || baseHeader.CheckpointId != header.BaseCheckpointId ||
+            baseHeader.FormatVersion != header.FormatVersion)
+        {
+            OLO_CORE_ERROR("[SaveGameManager] '{}' is not the base incremental save '{}' was written against", baseSlot, slotName);
+            return SaveLoadResult::CorruptedFile;
+        }
 
-        for (u32 i = 0; i < kMaxQuickSaveSlots; ++i)
+        std::vector<u8> basePayload;
+        if (!SaveGameFile::ReadPayload(basePath, basePayload))
         {
-            std::string slotName = "quicksave_" + std::to_string(i);
-            SaveFileInfo info;
-            if (GetSaveInfo(slotName, info) && info.Metadata.TimestampUTC > bestTimestamp)
-            {
-                if (!ValidateSave(slotName))
-                {
-                    OLO_CORE_WARN("[SaveGameManager] Skipping corrupt quick-save: {}", slotName);
-                    continue;
-                }
-                bestTimestamp = info.Metadata.TimestampUTC;
-                bestSlot = slotName;
-            }
+            OLO_CORE_ERROR("[SaveGameManager] Failed to read/decompress payload: {}", basePath.string());
+            return SaveLoadResult::IOError;
         }
 
-        if (bestSlot.empty())
+        std::vector<u8> incrementalPayload = std::move(outPayload);
+        if (!SaveGameSerializer::MergeIncrementalPayload(basePayload, incrementalPayload, outPayload, header.FormatVersion))
         {
-            OLO_CORE_WARN("[SaveGameManager] No quick-save found");
-            return SaveLoadResult::FileNotFound;
+            OLO_CORE_ERROR("[SaveGameManager] Failed to apply incremental save '{}' to its base", slotName);
+            return SaveLoadResult::CorruptedFile;
         }
 
-        return Load(scene, bestSlot);
+        return SaveLoadResult::Success;
     }
 
     // ========================================================================
@@ -634,6 +964,12 @@ namespace OloEngine
                     continue;
                 }
 
+                // Incremental auto-save bases are internal; their auto-save slots are what is listed.
+                if (IsAutoSaveBaseSlot(entry.path().stem().string()))
+                {
+                    continue;
+                }
+
                 SaveGameHeader header;
                 SaveGameMetadata metadata;
                 if (SaveGameFile::ReadMetadata(entry.path(), header, metadata))
@@ -669,7 +1005,7 @@ namespace OloEngine
             for (const std::string& cloudName : SteamManager::CloudEnumerate())
             {
                 const std::string slotName = SlotForCloudName(cloudName);
-                if (slotName.empty() || !IsValidSlotName(slotName))
+                if (slotName.empty() || !IsValidSlotName(slotName) || IsAutoSaveBaseSlot(slotName))
                 {
                     continue;
                 }
@@ -898,12 +1234,20 @@ namespace OloEngine
     {
         OLO_PROFILE_FUNCTION();
 
+        AdvanceAsyncLoad();
+
         const f32 interval = s_AutoSaveInterval.load(std::memory_order_relaxed);
         if (interval <= 0.0f)
         {
             return;
         }
 
+        // Saving a scene that is about to be replaced would only waste an auto-save slot.
+        if (IsLoadInProgress())
+        {
+            return;
+        }
+
         f32 timer = s_AutoSaveTimer.load(std::memory_order_relaxed) + deltaTime;
         if (timer >= interval)
         {
@@ -982,9 +1326,9 @@ namespace OloEngine
 
         EnsureSaveDirectory();
 
-        // --- Main-thread work: capture scene state to binary ---
-        std::vector<u8> payload = SaveGameSerializer::CaptureSceneState(scene);
-        if (payload.empty())
+        // --- Main-thread work: copy the save-relevant state out of the scene ---
+        Scope<SaveGameSceneSnapshot> snapshot = SaveGameSerializer::SnapshotSceneState(scene);
+        if (!snapshot)
         {
             OLO_CORE_ERROR("[SaveGameManager] Failed to capture scene state");
             if (callback)
@@ -1007,98 +1351,55 @@ namespace OloEngine
         metadata.SlotType = slotType;
         metadata.ThumbnailAvailable = !thumbnailPNG.empty();
 
-        auto view = scene.GetAllEntitiesWith<IDComponent>();
-        u32 entityCount = static_cast<u32>(view.size());
+        u32 entityCount = snapshot->GetEntityCount();
         metadata.EntityCount = entityCount;
 
         auto path = GetSaveFilePath(slotName);
 
-        // --- Dispatch compression + I/O to background thread ---
+        // --- Dispatch serialization + compression + I/O to background thread ---
         Tasks::Launch(
             "SaveGameToDisk",
-            [payload = std::move(payload),
+            [snapshot = std::move(snapshot),
              thumbnailPNG = std::move(thumbnailPNG),
              metadata,
              entityCount,
              path,
              slotName,
+             slotType,
              callback,
              onWorkerComplete = std::move(onWorkerComplete)]() mutable
             {
                 OLO_PROFILE_SCOPE("SaveGameToDisk");
 
-                // Compress payload
-                std::vector<u8> compressedPayload;
-                bool compressed = SaveGameFile::Compress(payload, compressedPayload);
-                if (compressed && compressedPayload.size() >= payload.size())
-                {
-                    compressed = false;
-                }
-
-                // Build header
-                SaveGameHeader header;
-                header.EntityCount = entityCount;
-                if (compressed)
-                {
-                    header.SetCompression(SaveGameCompression::Zlib);
-                    header.PayloadUncompressedSize = payload.size();
-                }
-
-                // Write to disk
-                const auto& writePayload = compressed ? compressedPayload : payload;
                 SaveLoadResult result = SaveLoadResult::Success;
-                if (!SaveGameFile::Write(path, header, metadata, thumbnailPNG, writePayload))
+                if (slotType == SaveSlotType::AutoSave)
                 {
-                    OLO_CORE_ERROR("[SaveGameManager] Failed to write save file: {}", path.string());
-                    result = SaveLoadResult::IOError;
+                    result = WriteAutoSave(*snapshot, path, slotName, metadata, thumbnailPNG);
                 }
                 else
                 {
-                    std::error_code ec;
-                    auto fileSize = std::filesystem::file_size(path, ec);
-                    if (ec)
-                    {
-                        OLO_CORE_WARN("[SaveGameManager] Could not read file size for '{}': {}", path.string(), ec.message());
-                    }
-                    OLO_CORE_INFO("[SaveGameManager] Saved '{}' ({} entities, {:.1f} KB)",
-                                  slotName, entityCount,
-                                  ec ? 0.0f : static_cast<f32>(fileSize) / 1024.0f);
+                    std::vector<u8> payload = SaveGameSerializer::SerializeSnapshot(*snapshot);
 
-                    // Steam Cloud mirror (#644). We are on a WORKER thread here and SteamManager
-                    // is game-thread-only, so hop rather than calling it inline — this is the one
-                    // place the cloud integration could have introduced a data race.
-                    //
-                    // Read the bytes HERE, on the worker, and move them into the task. The game
-                    // thread then only makes the Steam call, never touches the disk: re-reading a
-                    // save-sized file on the frame thread would be a hitch for no benefit, since
-                    // this thread just finished writing it and is not frame-critical.
-                    //
-                    // Enqueued without checking Steam availability first — querying it from this
-                    // thread would itself violate the game-thread contract — so the task re-checks
-                    // and no-ops when Steam is absent. The read is skipped in that case only by
-                    // the emptiness guard inside, which is the price of not being able to ask.
-                    //
-                    // Deliberately AFTER the local write succeeded, and it cannot affect `result`:
-                    // a cloud failure must never turn a good local save into a reported error.
-                    std::vector<u8> cloudBytes;
-                    u64 generation = 0;
-                    if (ReadSaveAndTakeCloudTicket(path, slotName, cloudBytes, generation))
+                    SaveGameHeader header;
+                    header.EntityCount = entityCount;
+                    CompressPayload(payload, header);
+
+                    // Write to disk
+                    if (!SaveGameFile::Write(path, header, metadata, thumbnailPNG, payload))
                     {
-                        Tasks::EnqueueGameThreadTask(
-                            [bytes = std::move(cloudBytes), slotName, generation]() mutable
-                            {
-                                MirrorSaveToCloud(std::move(bytes), slotName, generation);
-                            },
-                            "SteamCloudMirror");
+                        OLO_CORE_ERROR("[SaveGameManager] Failed to write save file: {}", path.string());
+                        result = SaveLoadResult::IOError;
                     }
                     else
                     {
-                        OLO_CORE_WARN("[SaveGameManager] Could not re-read '{}' to mirror it to Steam Cloud; "
-                                      "the local save is intact.",
-                                      path.string());
+                        OnSaveWritten(path, slotName, entityCount);
                     }
                 }
 
+                // The snapshot owns a full copy of the save-relevant pools; release it before
+                // anything waits on this worker.
+                snapshot.reset();
+
                 // Worker-thread completion hook (e.g., release in-flight slot)
                 if (onWorkerComplete)
                 {
@@ -1120,6 +1421,160 @@ namespace OloEngine
         return SaveLoadResult::Pending;
     }
 
+    SaveLoadResult SaveGameManager::WriteAutoSave(SaveGameSceneSnapshot& snapshot,
+                                                  const std::filesystem::path& path,
+                                                  const std::string& slotName,
+                                                  const SaveGameMetadata& metadata,
+                                                  const std::vector<u8>& thumbnailPNG)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        TUniqueLock<FMutex> lock(s_AutoSaveChainMutex);
+
+        const u32 entityCount = snapshot.GetEntityCount();
+
+        // Diff against the current base, but only while that base is still the file on disk:
+        // anything that deleted or replaced it would leave the checkpoint unloadable.
+        bool rebase = s_AutoSaveBase.CheckpointId == 0;
+        if (!rebase)
+        {
+            SaveGameHeader baseHeader;
+            rebase = !SaveGameFile::ReadHeader(GetSaveFilePath(AutoSaveBaseSlotName(s_AutoSaveBase.CheckpointId)), baseHeader) ||
+                     baseHeader.CheckpointId != s_AutoSaveBase.CheckpointId;
+        }
+
+        if (!rebase)
+        {
+            u32 dirtyCount = 0;
+            std::vector<u8> payload = SaveGameSerializer::SerializeSnapshotIncremental(snapshot, s_AutoSaveBase, dirtyCount);
+
+            // Past the threshold a checkpoint is nearly a full save anyway, and every later one
+            // would carry the same changes again — start a new base instead.
+            if (static_cast<u64>(dirtyCount) * 100 <= static_cast<u64>(entityCount) * kAutoSaveRebaseDirtyPercent)
+            {
+                SaveGameHeader header;
+                header.EntityCount = entityCount;
+                header.Flags |= kSaveGameFlagIncremental;
+                header.BaseCheckpointId = s_AutoSaveBase.CheckpointId;
+                CompressPayload(payload, header);
+
+                if (!SaveGameFile::Write(path, header, metadata, thumbnailPNG, payload))
+                {
+                    OLO_CORE_ERROR("[SaveGameManager] Failed to write save file: {}", path.string());
+                    return SaveLoadResult::IOError;
+                }
+
+                OLO_CORE_TRACE("[SaveGameManager] Auto-save '{}' is incremental: {} of {} entities dirty",
+                               slotName, dirtyCount, entityCount);
+                OnSaveWritten(path, slotName, entityCount);
+                PruneAutoSaveBases();
+                return SaveLoadResult::Success;
+            }
+        }
+
+        // Full save: the slot itself, plus the same bytes as the hidden base later checkpoints
+        // are diffed against. Serialized and compressed once, written twice.
+        SaveGameCheckpoint checkpoint;
+        std::vector<u8> payload = SaveGameSerializer::SerializeSnapshot(snapshot, &checkpoint);
+        do
+        {
+            checkpoint.CheckpointId = static_cast<u64>(UUID());
+        } while (checkpoint.CheckpointId == 0);
+
+        SaveGameHeader header;
+        header.EntityCount = entityCount;
+        header.CheckpointId = checkpoint.CheckpointId;
+        CompressPayload(payload, header);
+
+        if (!SaveGameFile::Write(path, header, metadata, thumbnailPNG, payload))
+        {
+            OLO_CORE_ERROR("[SaveGameManager] Failed to write save file: {}", path.string());
+            return SaveLoadResult::IOError;
+        }
+        OnSaveWritten(path, slotName, entityCount);
+
+        const std::string baseSlot = AutoSaveBaseSlotName(checkpoint.CheckpointId);
+        SaveGameMetadata baseMetadata = metadata;
+        baseMetadata.ThumbnailAvailable = false;
+        if (SaveGameFile::Write(GetSaveFilePath(baseSlot), header, baseMetadata, {}, payload))
+        {
+            OnSaveWritten(GetSaveFilePath(baseSlot), baseSlot, entityCount);
+            s_AutoSaveBase = std::move(checkpoint);
+        }
+        else
+        {
+            // The slot itself is a complete save, so this auto-save still succeeded; the next
+            // one just has no base to diff against and writes in full again.
+            OLO_CORE_WARN("[SaveGameManager] Failed to write auto-save base '{}'; the next auto-save will be a full save",
+                          baseSlot);
+            s_AutoSaveBase = {};
+        }
+
+        PruneAutoSaveBases();
+        return SaveLoadResult::Success;
+    }
+
+    void SaveGameManager::PruneAutoSaveBases()
+    {
+        OLO_PROFILE_FUNCTION();
+
+        // Every base an auto-save slot still points at, plus the live one
+        std::unordered_set<u64> referenced;
+        if (s_AutoSaveBase.CheckpointId != 0)
+        {
+            referenced.insert(s_AutoSaveBase.CheckpointId);
+        }
+        for (u32 i = 0; i < kMaxAutoSaveSlots; ++i)
+        {
+            SaveGameHeader header;
+            if (SaveGameFile::ReadHeader(GetSaveFilePath("autosave_" + std::to_string(i)), header) && header.IsIncremental())
+            {
+                referenced.insert(header.BaseCheckpointId);
+            }
+        }
+
+        std::vector<std::string> stale;
+        std::error_code ec;
+        for (const auto& entry : std::filesystem::directory_iterator(GetSaveDirectory(), ec))
+        {
+            if (entry.path().extension() != kSaveFileExtension)
+            {
+                continue;
+            }
+
+            const std::string stem = entry.path().stem().string();
+            if (!IsAutoSaveBaseSlot(stem))
+            {
+                continue;
+            }
+
+            u64 checkpointId = 0;
+            const char* first = stem.data() + kAutoSaveBasePrefix.size();
+            const char* last = stem.data() + stem.size();
+            if (auto [ptr, parseError] = std::from_chars(first, last, checkpointId);
+                parseError == std::errc{} && ptr == last && !referenced.contains(checkpointId))
+            {
+                stale.push_back(stem);
+            }
+        }
+
+        if (stale.empty())
+        {
+            return;
+        }
+
+        // DeleteSave also removes the Steam Cloud copy, which is game-thread-only
+        Tasks::EnqueueGameThreadTask(
+            [stale = std::move(stale)]()
+            {
+                for (const auto& slotName : stale)
+                {
+                    DeleteSave(slotName);
+                }
+            },
+            "PruneAutoSaveBases");
+    }
+
     void SaveGameManager::EnsureSaveDirectory()
     {
         OLO_PROFILE_FUNCTION();
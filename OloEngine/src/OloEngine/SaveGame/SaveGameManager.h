@@ -1,6 +1,7 @@
 #pragma once
 
 #include "OloEngine/Core/Base.h"
+#include "OloEngine/Core/Ref.h"
 #include "OloEngine/SaveGame/SaveGameTypes.h"
 
 #include <array>
@@ -14,6 +15,7 @@
 namespace OloEngine
 {
     class Scene;
+    class SaveGameSceneSnapshot;
 
     // Describes a save file on disk (from enumeration)
     struct SaveFileInfo
@@ -47,12 +49,19 @@ namespace OloEngine
     // thumbnail capture, and async I/O via the Task system.
     //
     // Save operations (Save, QuickSave, AutoSave) are asynchronous:
-    // - Scene capture/serialization happens on the calling thread (must be game thread)
-    // - Compression and disk I/O are dispatched to a background worker thread
+    // - The calling thread (must be game thread) only copies the save-relevant
+    //   component pools into a SaveGameSceneSnapshot
+    // - Serialization, compression and disk I/O are dispatched to a background worker thread
     // - The completion callback is invoked on the game thread on the next frame
     // - Returns SaveLoadResult::Pending on successful dispatch
     //
-    // Load operations (Load, QuickLoad) are synchronous and return immediately.
+    // Auto-saves are incremental. The first one of a session (and any one where more than
+    // kAutoSaveRebaseDirtyPercent of the entities changed) writes a full save and keeps a copy
+    // of it as a hidden "autosave_base_<id>" slot; the ones after it store only the entities
+    // whose serialized state differs from that base. Loading such a slot merges the two.
+    //
+    // Load and QuickLoad are synchronous. LoadAsync reads, validates and decompresses on a
+    // worker, then rebuilds the scene a time slice per Tick() before swapping it in.
     class SaveGameManager
     {
       public:
@@ -89,6 +98,17 @@ namespace OloEngine
         // Load from the most recent quick-save
         static SaveLoadResult QuickLoad(Scene& scene);
 
+        // Load from a named slot without stalling the frame. File I/O, checksum, decompression
+        // and incremental-checkpoint merging happen on a worker; the entities are then rebuilt
+        // into a staging scene within kAsyncLoadBudgetMs per Tick() and swapped into `scene` in
+        // one step when complete. The callback runs on the game thread. One load at a time.
+        static SaveLoadResult LoadAsync(const Ref<Scene>& scene,
+                                        const std::string& slotName,
+                                        SaveLoadCompletionCallback callback = nullptr);
+
+        // True from a successful LoadAsync dispatch until its callback has run
+        static bool IsLoadInProgress();
+
         // --- Enumeration ---
 
         // Enumerate all save files in the save directory.
@@ -123,7 +143,7 @@ namespace OloEngine
         // Get current auto-save interval
         static f32 GetAutoSaveInterval();
 
-        // Call every frame during play mode to handle auto-save timing
+        // Call every frame during play mode to handle auto-save timing and advance LoadAsync
         static void Tick(f32 deltaTime, Scene& scene);
 
         // --- Utility ---
@@ -144,9 +164,19 @@ namespace OloEngine
         // fact that must not drift.
         static constexpr std::string_view kSaveFileExtension = ".olosave";
 
+        // Hidden slots holding the base save of an incremental auto-save chain
+        static constexpr std::string_view kAutoSaveBasePrefix = "autosave_base_";
+
+        // An auto-save with more dirty entities than this (percent of all entities) starts a new base
+        static constexpr u32 kAutoSaveRebaseDirtyPercent = 50;
+
+        // Game-thread time LoadAsync may spend rebuilding entities per Tick()
+        static constexpr f32 kAsyncLoadBudgetMs = 4.0f;
+
       private:
-        // Capture scene state on the calling thread, then dispatch compression + I/O to background.
-        // onWorkerComplete runs on the worker thread after I/O finishes (before game-thread callback).
+        // Snapshot scene state on the calling thread, then dispatch serialization + compression +
+        // I/O to background. onWorkerComplete runs on the worker thread after I/O finishes (before
+        // game-thread callback).
         static SaveLoadResult SaveAsync(Scene& scene,
                                         const std::string& slotName,
                                         const std::string& displayName,
@@ -155,6 +185,33 @@ namespace OloEngine
                                         SaveLoadCompletionCallback callback,
                                         std::function<void()> onWorkerComplete = nullptr);
 
+        // Worker side of an auto-save: an incremental checkpoint against the current base, or a
+        // full save that becomes the new base.
+        static SaveLoadResult WriteAutoSave(SaveGameSceneSnapshot& snapshot,
+                                            const std::filesystem::path& path,
+                                            const std::string& slotName,
+                                            const SaveGameMetadata& metadata,
+                                            const std::vector<u8>& thumbnailPNG);
+
+        // Delete the base saves no auto-save slot references any more
+        static void PruneAutoSaveBases();
+
+        // Game thread: make sure the slot, and the base it depends on if it is incremental, exist
+        // locally, pulling them from Steam Cloud if not.
+        static SaveLoadResult PrepareLocalSave(const std::string& slotName);
+
+        // Any thread: validate and read a local slot's payload, merging an incremental slot with
+        // its base so the result is always a full payload.
+        static SaveLoadResult ReadSavePayload(const std::string& slotName, u32& outFormatVersion, std::vector<u8>& outPayload);
+
+        // Game thread: LoadAsync's continuation once the worker has read the payload
+        static void BeginAsyncRestore(SaveLoadResult readResult, u32 formatVersion, std::vector<u8>&& payload);
+
+        // Game thread: rebuild entities for up to kAsyncLoadBudgetMs, committing when done
+        static void AdvanceAsyncLoad();
+
+        static void FinishAsyncLoad(SaveLoadResult result);
+
         // Ensure save directory exists
         static void EnsureSaveDirectory();
 
@@ -169,6 +226,10 @@ namespace OloEngine
 
         static std::array<std::atomic<bool>, kMaxQuickSaveSlots> s_QuickSaveInFlight;
         static std::array<std::atomic<bool>, kMaxAutoSaveSlots> s_AutoSaveInFlight;
+
+        // LoadAsync: the whole operation, and just its worker read (for Shutdown to drain)
+        static std::atomic<bool> s_LoadInFlight;
+        static std::atomic<bool> s_LoadWorkerInFlight;
     };
 
 } // namespace OloEngine
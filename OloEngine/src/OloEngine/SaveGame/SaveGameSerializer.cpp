@@ -8,6 +8,7 @@
 #include "OloEngine/Animation/MorphTargets/MorphTargetComponents.h"
 #include "OloEngine/Cinematic/CinematicComponent.h"
 #include "OloEngine/Core/Hash.h"
+#include "OloEngine/Debug/DiagnosticsEventLog.h"
 #include "OloEngine/Gameplay/Abilities/AbilityComponents.h"
 #include "OloEngine/Gameplay/Inventory/InventoryComponents.h"
 #include "OloEngine/Gameplay/Quest/QuestComponents.h"
@@ -23,9 +24,19 @@
 #include "OloEngine/Scene/Streaming/StreamingVolumeComponent.h"
 #include "OloEngine/Serialization/Archive.h"
 #include "OloEngine/Serialization/ArchiveExtensions.h"
+#include "OloEngine/Task/ParallelFor.h"
 
 #include <box2d/box2d.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <span>
+#include <unordered_map>
+#include <unordered_set>
+
 namespace OloEngine
 {
     // ========================================================================
@@ -38,6 +49,16 @@ namespace OloEngine
     // Reserved typeHash for ISaveable custom state blob
     static constexpr u32 kSaveableTypeHash = 0x53415645; // "SAVE"
 
+    // Section markers
+    static constexpr u32 kSettingsMarker = 0x53455453;    // "SETS"
+    static constexpr u32 kEntitiesMarker = 0x454E5453;    // "ENTS"
+    static constexpr u32 kIncrementalMarker = 0x444C5441; // "DLTA"
+    static constexpr u32 kSectionsMarker = 0x54434553;    // "SECT"
+
+    // Sanity limits for untrusted payloads
+    static constexpr u32 kMaxEntityCount = 1'000'000;
+    static constexpr u32 kMaxComponentBlockSize = 1024 * 1024 * 100;
+
 // Save: serialize a component with typeHash + dataSize for skip-ability
 #define SAVE_COMPONENT(ComponentType, entity, writer)                       \
     if ((entity).HasComponent<ComponentType>())                             \
@@ -225,409 +246,2031 @@ namespace OloEngine
     }
 
     // ========================================================================
-    // CaptureSceneState
+    // Scene settings section
     // ========================================================================
 
-    std::vector<u8> SaveGameSerializer::CaptureSceneState(Scene& scene)
+    // The eight settings structs, in stream order. The section is a flat stream
+    // with no length prefix, so capture, snapshot, restore and merge all go
+    // through SerializeSceneSettings instead of each spelling out the order.
+    struct SceneSettingsBlock
     {
-        OLO_PROFILE_FUNCTION();
+        PostProcessSettings PostProcess;
+        SnowSettings Snow;
+        FogSettings Fog;
+        WindSettings Wind;
+        SnowAccumulationSettings SnowAccumulation;
+        SnowEjectaSettings SnowEjecta;
+        PrecipitationSettings Precipitation;
+        StreamingSettings Streaming;
+
+        static SceneSettingsBlock From(const Scene& scene)
+        {
+            return { scene.GetPostProcessSettings(),
+                     scene.GetSnowSettings(),
+                     scene.GetFogSettings(),
+                     scene.GetWindSettings(),
+                     scene.GetSnowAccumulationSettings(),
+                     scene.GetSnowEjectaSettings(),
+                     scene.GetPrecipitationSettings(),
+                     scene.GetStreamingSettings() };
+        }
+    };
 
-        std::vector<u8> buffer;
-        FMemoryWriter writer(buffer);
-        writer.ArIsSaveGame = true;
+    static void SerializeSceneSettings(FArchive& ar, SceneSettingsBlock& s)
+    {
+        OLO_PROFILE_FUNCTION();
+        SerializePostProcessSettings(ar, s.PostProcess);
+        SerializeSnowSettings(ar, s.Snow);
+        SerializeFogSettings(ar, s.Fog);
+        SerializeWindSettings(ar, s.Wind);
+        SerializeSnowAccumulationSettings(ar, s.SnowAccumulation);
+        SerializeSnowEjectaSettings(ar, s.SnowEjecta);
+        SerializePrecipitationSettings(ar, s.Precipitation);
+        SerializeStreamingSettings(ar, s.Streaming);
+    }
 
-        // --- Scene settings ---
-        u32 settingsMarker = 0x53455453; // "SETS"
-        writer << settingsMarker;
+    // Read the "SETS" marker and the settings section. `settings` is overwritten
+    // field by field, so whatever it held beforehand survives for any field the
+    // archive does not carry.
+    static bool ReadSettingsSection(FMemoryReader& reader, SceneSettingsBlock& settings)
+    {
+        u32 settingsMarker = 0;
+        reader << settingsMarker;
+        if (settingsMarker != kSettingsMarker)
+        {
+            OLO_CORE_ERROR("[SaveGameSerializer] Invalid settings marker");
+            return false;
+        }
 
-        SerializePostProcessSettings(writer, scene.m_PostProcessSettings);
-        SerializeSnowSettings(writer, scene.m_SnowSettings);
-        SerializeFogSettings(writer, scene.m_FogSettings);
-        SerializeWindSettings(writer, scene.m_WindSettings);
-        SerializeSnowAccumulationSettings(writer, scene.m_SnowAccumulationSettings);
-        SerializeSnowEjectaSettings(writer, scene.m_SnowEjectaSettings);
-        SerializePrecipitationSettings(writer, scene.m_PrecipitationSettings);
-        SerializeStreamingSettings(writer, scene.m_StreamingSettings);
+        SerializeSceneSettings(reader, settings);
+        if (reader.IsError())
+        {
+            OLO_CORE_ERROR("[SaveGameSerializer] Failed to parse scene settings");
+            return false;
+        }
+        return true;
+    }
 
-        // --- Entities ---
-        u32 entitiesMarker = 0x454E5453; // "ENTS"
-        writer << entitiesMarker;
+    // ========================================================================
+    // Entity records
+    // ========================================================================
 
-        // Snapshot runtime physics velocities into component fields before serialization
-        // 2D: read from Box2D runtime bodies
-        if (b2World_IsValid(scene.m_PhysicsWorld))
+    // The slice of Entity's interface the SAVE_COMPONENT capture list uses, over
+    // any registry — the live scene's or a snapshot's.
+    class RegistryEntity
+    {
+      public:
+        RegistryEntity(entt::entity handle, entt::registry& registry)
+            : m_Handle(handle), m_Registry(&registry)
         {
-            auto rb2dView = scene.m_Registry.view<Rigidbody2DComponent>();
-            for (auto e : rb2dView)
-            {
-                auto& rb2d = rb2dView.get<Rigidbody2DComponent>(e);
-                if (b2Body_IsValid(rb2d.RuntimeBody))
-                {
-                    b2Vec2 linVel = b2Body_GetLinearVelocity(rb2d.RuntimeBody);
-                    rb2d.LinearVelocity = { linVel.x, linVel.y };
-                    rb2d.AngularVelocity = b2Body_GetAngularVelocity(rb2d.RuntimeBody);
-                }
-            }
         }
-        // 3D: read from Jolt runtime bodies into temporaries, then write to component,
-        // serialize, and restore the original "initial" values afterwards.
-        struct Rigidbody3DVelocityBackup
+
+        template<typename T>
+        [[nodiscard]] bool HasComponent() const
         {
-            entt::entity Entity;
-            glm::vec3 LinearVelocity;
-            glm::vec3 AngularVelocity;
-        };
-        std::vector<Rigidbody3DVelocityBackup> rb3dBackups;
-        if (auto* joltScene = scene.GetPhysicsScene(); joltScene && joltScene->IsInitialized())
+            return m_Registry->all_of<T>(m_Handle);
+        }
+
+        template<typename T>
+        T& GetComponent() const
         {
-            auto rb3dView = scene.m_Registry.view<Rigidbody3DComponent>();
-            for (auto e : rb3dView)
-            {
-                auto& rb3d = rb3dView.get<Rigidbody3DComponent>(e);
-                Entity ent = { e, &scene };
-                if (auto body = joltScene->GetBody(ent))
-                {
-                    rb3dBackups.push_back({ e, rb3d.m_InitialLinearVelocity, rb3d.m_InitialAngularVelocity });
-                    rb3d.m_InitialLinearVelocity = body->GetLinearVelocity();
-                    rb3d.m_InitialAngularVelocity = body->GetAngularVelocity();
-                }
-            }
+            return m_Registry->get<T>(m_Handle);
         }
 
-        // Count entities with IDComponent (all real entities)
-        auto view = scene.GetAllEntitiesWith<IDComponent>();
-        u32 entityCount = static_cast<u32>(view.size());
-        writer << entityCount;
+      private:
+        entt::entity m_Handle;
+        entt::registry* m_Registry;
+    };
 
-        // Serialize each entity
-        for (auto entityHandle : view)
+    // Serialize all present components. The SAVE_COMPONENT(...) enumeration
+    // is generated by OloHeaderTool from every `struct *Component` with a
+    // save serializer (see SaveGameComponentSerializer.cpp) — DO NOT hand-
+    // edit. Add a Serialize() overload + REGISTER_SAVE_COMPONENT and the
+    // next GenerateBindings run adds the component here automatically.
+    // Guarded by SaveGameComponentSerializerCoverageTest.
+    static void WriteComponentBlocks(RegistryEntity entity, FArchive& writer)
+    {
+        // SAVE_COMPONENT bails out with `break` on a serializer error.
+        do
         {
-            Entity entity = { entityHandle, &scene };
+#include "OloEngine/SaveGame/Generated/SaveGameComponentCapture.Generated.inl"
+        } while (false);
+    }
 
-            // Write UUID first (always present via IDComponent)
-            const auto& id = entity.GetComponent<IDComponent>();
-            UUID uuid = id.ID;
-            writer << uuid;
+#undef SAVE_COMPONENT
 
-            // Serialize all present components. The SAVE_COMPONENT(...) enumeration
-            // is generated by OloHeaderTool from every `struct *Component` with a
-            // save serializer (see SaveGameComponentSerializer.cpp) — DO NOT hand-
-            // edit. Add a Serialize() overload + REGISTER_SAVE_COMPONENT and the
-            // next GenerateBindings run adds the component here automatically.
-            // Guarded by SaveGameComponentSerializerCoverageTest.
-#include "OloEngine/SaveGame/Generated/SaveGameComponentCapture.Generated.inl"
+    // One entity record: UUID, a block per captured component, the ISaveable
+    // blob if there is one, then the end-of-entity sentinel.
+    static void WriteEntityRecord(RegistryEntity entity, UUID uuid, std::vector<u8>* saveableBlob, FArchive& writer)
+    {
+        writer << uuid;
 
-            // ISaveable blob for ScriptComponent custom state
-            if (entity.HasComponent<ScriptComponent>())
+        WriteComponentBlocks(entity, writer);
+
+        if (saveableBlob && !saveableBlob->empty())
+        {
+            u32 saveableHash = kSaveableTypeHash;
+            u32 dataSize = static_cast<u32>(saveableBlob->size());
+            writer << saveableHash << dataSize;
+            writer.Serialize(saveableBlob->data(), static_cast<i64>(dataSize));
+        }
+
+        u32 endMarker = kEndOfEntityMarker;
+        writer << endMarker;
+    }
+
+    // Walk one entity record without deserializing anything. False on a malformed
+    // record; on success the reader sits just past its end marker.
+    static bool SkipEntityRecord(FMemoryReader& reader, UUID& outUUID)
+    {
+        reader << outUUID;
+        while (!reader.IsError() && !reader.AtEnd())
+        {
+            u32 typeHash = 0;
+            reader << typeHash;
+            if (typeHash == kEndOfEntityMarker)
             {
-                const auto& sc = entity.GetComponent<ScriptComponent>();
-                std::vector<u8> saveableBlob;
-                if (!CollectSaveableData(uuid, sc.ClassName, saveableBlob))
-                {
-                    OLO_CORE_ERROR("[SaveGameSerializer] CollectSaveableData failed for entity {}", static_cast<u64>(uuid));
-                    writer.SetError();
-                    break;
-                }
-                if (!saveableBlob.empty())
-                {
-                    u32 saveableHash = kSaveableTypeHash;
-                    u32 dataSize = static_cast<u32>(saveableBlob.size());
-                    writer << saveableHash << dataSize;
-                    writer.Serialize(saveableBlob.data(), static_cast<i64>(dataSize));
-                }
+                return !reader.IsError();
             }
 
-            // End-of-entity sentinel
-            u32 endMarker = kEndOfEntityMarker;
-            writer << endMarker;
+            u32 dataSize = 0;
+            reader << dataSize;
+            if (reader.IsError() || dataSize > kMaxComponentBlockSize || reader.Tell() + dataSize > reader.TotalSize())
+            {
+                return false;
+            }
+            reader.Seek(reader.Tell() + dataSize);
         }
+        return false;
+    }
 
-        // Restore original initial velocities for 3D rigidbodies
-        for (auto const& backup : rb3dBackups)
+    // Write back the live 2D body velocities, which only exist in Box2D. Capture
+    // has always done this in place — the component fields are the authoring-side
+    // copy of exactly this state.
+    static void SyncRigidbody2DVelocities(b2WorldId world, entt::registry& registry)
+    {
+        if (!b2World_IsValid(world))
         {
-            auto& rb3d = scene.m_Registry.get<Rigidbody3DComponent>(backup.Entity);
-            rb3d.m_InitialLinearVelocity = backup.LinearVelocity;
-            rb3d.m_InitialAngularVelocity = backup.AngularVelocity;
+            return;
         }
 
-        // If serialization failed, return empty buffer so callers detect the error
-        if (writer.IsError())
+        auto rb2dView = registry.view<Rigidbody2DComponent>();
+        for (auto e : rb2dView)
         {
-            return {};
+            auto& rb2d = rb2dView.get<Rigidbody2DComponent>(e);
+            if (b2Body_IsValid(rb2d.RuntimeBody))
+            {
+                b2Vec2 linVel = b2Body_GetLinearVelocity(rb2d.RuntimeBody);
+                rb2d.LinearVelocity = { linVel.x, linVel.y };
+                rb2d.AngularVelocity = b2Body_GetAngularVelocity(rb2d.RuntimeBody);
+            }
         }
-
-        return buffer;
     }
 
     // ========================================================================
-    // RestoreSceneState
+    // Entity fingerprints
     // ========================================================================
 
-    // Deserialize entities into a staging scene. Returns whether parsing succeeded.
-    // Deferred ISaveable restore entry — collected during staging, applied post-commit.
-    struct DeferredSaveableEntry
+    // What a SaveGameCheckpoint holds per entity: FNV-1a 64 over the UUID and
+    // then, block by block in record order, each block's type hash and the
+    // FNV-1a 64 of its bytes. Defined per block rather than over the raw record
+    // so the sectioned writer can hash a block on the task that serialized it
+    // and fold the hashes together afterwards.
+    static u64 FingerprintSeed(UUID uuid)
     {
-        UUID EntityID;
-        std::string ClassName;
-        std::vector<u8> Data;
-    };
+        u64 const value = static_cast<u64>(uuid);
+        return Hash::FNV1a64(&value, sizeof(value));
+    }
 
-    static bool DeserializeEntitiesInto(Scene& staging, FMemoryReader& reader,
-                                        std::vector<DeferredSaveableEntry>& outDeferredSaveables)
+    static u64 FingerprintBlock(u64 fingerprint, u32 typeHash, u64 blockHash)
     {
-        OLO_PROFILE_FUNCTION();
+        fingerprint = Hash::FNV1a64(&typeHash, sizeof(typeHash), fingerprint);
+        return Hash::FNV1a64(&blockHash, sizeof(blockHash), fingerprint);
+    }
 
-        u32 entityCount = 0;
-        reader << entityCount;
-        if (reader.IsError())
+    // Visit the blocks of an entity record this build wrote (or SkipEntityRecord
+    // already validated): fn(typeHash, data, size).
+    template<typename Fn>
+    static void ForEachRecordBlock(const u8* record, sizet size, Fn&& fn)
+    {
+        sizet offset = sizeof(u64); // UUID
+        while (offset + sizeof(u32) <= size)
         {
-            OLO_CORE_ERROR("[SaveGameSerializer] Failed to read entity count");
-            return false;
+            u32 typeHash = 0;
+            std::memcpy(&typeHash, record + offset, sizeof(u32));
+            if (typeHash == kEndOfEntityMarker)
+            {
+                return;
+            }
+
+            u32 dataSize = 0;
+            std::memcpy(&dataSize, record + offset + sizeof(u32), sizeof(u32));
+            offset += 2 * sizeof(u32);
+            fn(typeHash, record + offset, dataSize);
+            offset += dataSize;
         }
+    }
+
+    static u64 FingerprintRecord(const u8* record, sizet size)
+    {
+        u64 uuid = 0;
+        std::memcpy(&uuid, record, sizeof(uuid));
+        u64 fingerprint = FingerprintSeed(UUID(uuid));
+        ForEachRecordBlock(record, size,
+                           [&fingerprint](u32 typeHash, const u8* data, u32 dataSize)
+                           {
+                               fingerprint = FingerprintBlock(fingerprint, typeHash, Hash::FNV1a64(data, dataSize));
+                           });
+        return fingerprint;
+    }
 
-        if (static constexpr u32 kMaxEntityCount = 1'000'000; entityCount > kMaxEntityCount)
+    static void AppendBytes(std::vector<u8>& buffer, const void* data, sizet size)
+    {
+        const auto* bytes = static_cast<const u8*>(data);
+        buffer.insert(buffer.end(), bytes, bytes + size);
+    }
+
+    // ========================================================================
+    // Sectioned payload (format v20+)
+    // ========================================================================
+    //
+    //   "SETS" settings | "SECT" | u32 entityCount | entityCount x UUID
+    //   | u32 sectionCount | sectionCount x { u32 TypeHash, u32 RecordCount, u64 Offset, u64 Size }
+    //   | section bytes
+    //
+    // One section per component type, plus one for ISaveable blobs under
+    // kSaveableTypeHash. A section is a run of { u32 entityIndex, u32 dataSize,
+    // data } records in ascending entity order. Offsets are relative to the first
+    // section byte, and the sections tile the rest of the payload exactly. No
+    // section depends on another, so they are written and decoded in parallel.
+    // Payloads up to v19 use per-entity records ("ENTS"), which still load.
+
+    static constexpr u32 kNoOrdinal = std::numeric_limits<u32>::max();
+    static constexpr u32 kSectionRecordHeaderSize = 2 * sizeof(u32);
+    static constexpr u32 kMaxSectionCount = 4096;
+
+    // ISaveable state of one entity, keyed by its position in the entity table.
+    struct SaveableEntry
+    {
+        u32 Ordinal = 0;
+        std::vector<u8> Data;
+    };
+
+    // What the sectioned writer reads from: the live scene's registry for
+    // CaptureSceneState, a snapshot's for SerializeSnapshot.
+    struct PayloadSource
+    {
+        entt::registry* Registry = nullptr;
+        std::span<const entt::entity> Order;
+        std::span<const UUID> UUIDs;
+        std::span<const SaveableEntry> Saveables; // ascending Ordinal
+        // Registry entity index -> position in Order; kNoOrdinal for unsaved entities
+        std::vector<u32> OrdinalOf;
+    };
+
+    struct SectionBuffer
+    {
+        u32 TypeHash = 0;
+        u32 RecordCount = 0;
+        std::vector<u8> Bytes;
+        // (entity ordinal, FNV-1a 64 of the block) per record, when fingerprinting
+        std::vector<std::pair<u32, u64>> BlockHashes;
+        bool Failed = false;
+    };
+
+    static void AppendSectionRecord(SectionBuffer& section, u32 entityIndex, const u8* data, u32 size)
+    {
+        AppendBytes(section.Bytes, &entityIndex, sizeof(entityIndex));
+        AppendBytes(section.Bytes, &size, sizeof(size));
+        AppendBytes(section.Bytes, data, size);
+        ++section.RecordCount;
+    }
+
+    // A section's TOC entry, resolved against the payload it was read from.
+    struct SectionView
+    {
+        u32 TypeHash = 0;
+        u32 RecordCount = 0;
+        const u8* Data = nullptr;
+        u64 Size = 0;
+    };
+
+    // Walks one section's records, checking each header against the section
+    // bounds and the entity table.
+    class SectionRecordReader
+    {
+      public:
+        SectionRecordReader(const SectionView& section, u32 entityCount)
+            : m_Section(&section), m_EntityCount(entityCount)
         {
-            OLO_CORE_ERROR("[SaveGameSerializer] Entity count {} exceeds maximum {}", entityCount, kMaxEntityCount);
-            return false;
         }
 
-        for (u32 i = 0; i < entityCount; ++i)
+        // False at the end of the section or on a malformed record
+        bool Next(u32& outEntityIndex, const u8*& outData, u32& outSize)
         {
-            UUID uuid;
-            reader << uuid;
-            if (reader.IsError())
+            if (m_Malformed || m_Offset >= m_Section->Size)
             {
-                OLO_CORE_ERROR("[SaveGameSerializer] Failed to read UUID for entity {}", i);
                 return false;
             }
-
-            // Create entity with the saved UUID
-            Entity entity = staging.CreateEntityWithUUID(uuid, "");
-
-            bool loadFailed = false;
-
-            // Read component blocks until end-of-entity sentinel (typeHash == 0)
-            while (true)
+            if (m_Section->Size - m_Offset < kSectionRecordHeaderSize)
             {
-                if (reader.AtEnd() || reader.IsError())
-                {
-                    OLO_CORE_ERROR("[SaveGameSerializer] Unexpected end of data at entity {} (missing end marker)", i);
-                    return false;
-                }
-
-                u32 typeHash = 0;
-                reader << typeHash;
-
-                // End-of-entity sentinel
-                if (typeHash == kEndOfEntityMarker)
-                {
-                    break;
-                }
+                m_Malformed = true;
+                return false;
+            }
 
-                u32 dataSize = 0;
-                reader << dataSize;
+            std::memcpy(&outEntityIndex, m_Section->Data + m_Offset, sizeof(u32));
+            std::memcpy(&outSize, m_Section->Data + m_Offset + sizeof(u32), sizeof(u32));
+            m_Offset += kSectionRecordHeaderSize;
+            if (outEntityIndex >= m_EntityCount || outSize > kMaxComponentBlockSize || outSize > m_Section->Size - m_Offset)
+            {
+                m_Malformed = true;
+                return false;
+            }
 
-                // Sanity limit
-                if (reader.IsError() || dataSize > 1024 * 1024 * 100)
-                {
-                    OLO_CORE_ERROR("[SaveGameSerializer] Corrupt component block at entity {}", i);
-                    return false;
-                }
+            outData = m_Section->Data + m_Offset;
+            m_Offset += outSize;
+            ++m_Records;
+            return true;
+        }
 
-                // Read component data blob
-                std::vector<u8> compData(dataSize);
-                if (dataSize > 0)
-                {
-                    reader.Serialize(compData.data(), static_cast<i64>(dataSize));
-                }
+        [[nodiscard]] bool AtEnd() const
+        {
+            return m_Offset >= m_Section->Size;
+        }
+        [[nodiscard]] bool IsMalformed() const
+        {
+            return m_Malformed;
+        }
+        // The whole section was read and held exactly the records its TOC entry claims
+        [[nodiscard]] bool IsComplete() const
+        {
+            return !m_Malformed && AtEnd() && m_Records == m_Section->RecordCount;
+        }
+        [[nodiscard]] u64 GetOffset() const
+        {
+            return m_Offset;
+        }
+        [[nodiscard]] u32 GetRecordsRead() const
+        {
+            return m_Records;
+        }
 
-                if (reader.IsError())
-                {
-                    OLO_CORE_ERROR("[SaveGameSerializer] Read error at entity {}", i);
-                    return false;
-                }
+      private:
+        const SectionView* m_Section;
+        u32 m_EntityCount;
+        u64 m_Offset = 0;
+        u32 m_Records = 0;
+        bool m_Malformed = false;
+    };
 
-                // Match typeHash to component and deserialize
-                bool matched = false;
+    // --- Writing ---
 
-#define TRY_LOAD_COMPONENT(ComponentType) \
-    if (!matched)                         \
-    LOAD_COMPONENT(ComponentType, entity, typeHash, compData)
+    struct ComponentSectionWriter
+    {
+        u32 TypeHash;
+        void (*CreatePool)(entt::registry&);
+        void (*Write)(const PayloadSource&, bool, SectionBuffer&);
+    };
 
-                // The TRY_LOAD_COMPONENT(...) restore matcher is generated by
-                // OloHeaderTool — the exact complement of the SAVE_COMPONENT capture
-                // list above, so a captured component is always restorable. DO NOT
-                // hand-edit; see SaveGameComponentSerializer.cpp. Order is irrelevant
-                // (each stream block is matched by typeHash), so unlike the former
-                // hand list IDComponent is just another TRY_LOAD_COMPONENT entry.
-#include "OloEngine/SaveGame/Generated/SaveGameComponentRestore.Generated.inl"
+    template<typename TComponent>
+    static void CreateComponentPool(entt::registry& registry)
+    {
+        (void)registry.storage<TComponent>();
+    }
 
-#undef TRY_LOAD_COMPONENT
+    template<typename TComponent>
+    static void WriteComponentSection(const PayloadSource& source, bool fingerprint, SectionBuffer& out)
+    {
+        auto& storage = source.Registry->storage<TComponent>();
 
-                // ISaveable blob: defer restore until after staging is committed
-                if (!matched && typeHash == kSaveableTypeHash)
+        std::vector<u32> ordinals;
+        ordinals.reserve(storage.size());
+        for (entt::entity const e : storage)
+        {
+            auto const index = static_cast<sizet>(entt::to_entity(e));
+            if (index < source.OrdinalOf.size())
+            {
+                u32 const ordinal = source.OrdinalOf[index];
+                if (ordinal != kNoOrdinal && source.Order[ordinal] == e)
                 {
-                    if (entity.HasComponent<ScriptComponent>())
-                    {
-                        outDeferredSaveables.push_back({ uuid, entity.GetComponent<ScriptComponent>().ClassName, compData });
-                    }
-                    matched = true;
+                    ordinals.push_back(ordinal);
                 }
+            }
+        }
+        // Pool order depends on insertion history, entity order does not — and a
+        // snapshot's pools are filled in a different order than the scene's.
+        std::ranges::sort(ordinals);
 
-                // Unknown component types are silently skipped (forward compatible)
+        FMemoryWriter writer(out.Bytes);
+        writer.ArIsSaveGame = true;
+        for (u32 ordinal : ordinals)
+        {
+            u32 dataSize = 0;
+            writer << ordinal << dataSize;
+            i64 const start = writer.Tell();
+            SaveGameComponentSerializer::Serialize(writer, storage.get(source.Order[ordinal]));
+            if (writer.IsError())
+            {
+                out.Failed = true;
+                return;
             }
 
-            if (loadFailed)
+            dataSize = static_cast<u32>(writer.Tell() - start);
+            std::memcpy(out.Bytes.data() + start - sizeof(u32), &dataSize, sizeof(u32));
+            if (fingerprint)
             {
-                OLO_CORE_ERROR("[SaveGameSerializer] Component deserialization failed for entity {} (UUID {})", i, static_cast<u64>(uuid));
-                return false;
+                out.BlockHashes.emplace_back(ordinal, Hash::FNV1a64(out.Bytes.data() + start, dataSize));
             }
         }
-
-        return !reader.IsError();
+        out.RecordCount = static_cast<u32>(ordinals.size());
     }
 
-    bool SaveGameSerializer::RestoreSceneState(Scene& scene, const std::vector<u8>& data, u32 formatVersion)
+    static void WriteSaveableSection(const PayloadSource& source, bool fingerprint, SectionBuffer& out)
     {
-        OLO_PROFILE_FUNCTION();
-
-        if (data.empty())
+        for (auto const& entry : source.Saveables)
         {
-            return false;
+            if (entry.Data.empty())
+            {
+                continue;
+            }
+            if (fingerprint)
+            {
+                out.BlockHashes.emplace_back(entry.Ordinal, Hash::FNV1a64(entry.Data.data(), entry.Data.size()));
+            }
+            AppendSectionRecord(out, entry.Ordinal, entry.Data.data(), static_cast<u32>(entry.Data.size()));
         }
+    }
 
-        FMemoryReader reader(data);
-        reader.ArIsSaveGame = true;
-        reader.SetArchiveVersion(formatVersion);
-
-        // --- Parse settings into local temporaries ---
-        u32 settingsMarker = 0;
-        reader << settingsMarker;
-        if (settingsMarker != 0x53455453)
+    // The capture list once more, as one section writer per component type.
+    static const std::vector<ComponentSectionWriter>& GetComponentSectionWriters()
+    {
+        static const std::vector<ComponentSectionWriter> s_Writers = []()
         {
-            OLO_CORE_ERROR("[SaveGameSerializer] Invalid settings marker");
-            return false;
-        }
-
-        // SEEDED FROM THE LIVE SCENE, not default-constructed. Every one of
-        // these is overwritten field by field by the reads below — except any
-        // field this archive predates or deliberately does not carry, which
-        // then retains the value the scene was loaded with. Default-
-        // constructing instead would silently reset such a field to a global
-        // default that has nothing to do with the scene the player is in.
-        PostProcessSettings postProcess = scene.m_PostProcessSettings;
-        SnowSettings snow = scene.m_SnowSettings;
-        FogSettings fog = scene.m_FogSettings;
-        WindSettings wind = scene.m_WindSettings;
-        SnowAccumulationSettings snowAccum = scene.m_SnowAccumulationSettings;
-        SnowEjectaSettings snowEjecta = scene.m_SnowEjectaSettings;
-        PrecipitationSettings precipitation = scene.m_PrecipitationSettings;
-        StreamingSettings streaming = scene.m_StreamingSettings;
-
-        SerializePostProcessSettings(reader, postProcess);
-        SerializeSnowSettings(reader, snow);
-        SerializeFogSettings(reader, fog);
-        SerializeWindSettings(reader, wind);
-        SerializeSnowAccumulationSettings(reader, snowAccum);
-        SerializeSnowEjectaSettings(reader, snowEjecta);
-        SerializePrecipitationSettings(reader, precipitation);
-        SerializeStreamingSettings(reader, streaming);
+            std::vector<ComponentSectionWriter> writers;
+#define SAVE_COMPONENT(ComponentType, entity, writer) \
+    writers.push_back({ Hash::GenerateFNVHash(#ComponentType), &CreateComponentPool<ComponentType>, &WriteComponentSection<ComponentType> })
+#include "OloEngine/SaveGame/Generated/SaveGameComponentCapture.Generated.inl"
+#undef SAVE_COMPONENT
+            return writers;
+        }();
+        return s_Writers;
+    }
 
-        if (reader.IsError())
+    // view<T>()/storage<T>() create a missing pool, which must not happen on a
+    // worker while another worker reads the registry.
+    static void CreateComponentPools(entt::registry& registry)
+    {
+        for (auto const& writer : GetComponentSectionWriters())
         {
-            OLO_CORE_ERROR("[SaveGameSerializer] Failed to parse scene settings");
-            return false;
+            writer.CreatePool(registry);
         }
+    }
 
-        // --- Entities marker ---
-        u32 entitiesMarker = 0;
-        reader << entitiesMarker;
-        if (entitiesMarker != 0x454E5453)
+    // "SECT", the entity table, the table of contents, then the sections.
+    // Empty sections are left out.
+    static void AppendSections(std::vector<u8>& buffer, std::span<const UUID> uuids, std::span<const SectionBuffer> sections)
+    {
+        u32 const marker = kSectionsMarker;
+        AppendBytes(buffer, &marker, sizeof(marker));
+        u32 const entityCount = static_cast<u32>(uuids.size());
+        AppendBytes(buffer, &entityCount, sizeof(entityCount));
+        for (UUID const uuid : uuids)
         {
-            OLO_CORE_ERROR("[SaveGameSerializer] Invalid entities marker");
-            return false;
+            u64 const value = static_cast<u64>(uuid);
+            AppendBytes(buffer, &value, sizeof(value));
         }
 
-        // --- Deserialize entities into a staging scene ---
-        // If deserialization fails, the real scene is untouched.
-        Ref<Scene> staging = Ref<Scene>::Create();
-        staging->m_ViewportWidth = scene.m_ViewportWidth;
-        staging->m_ViewportHeight = scene.m_ViewportHeight;
+        u32 const sectionCount = static_cast<u32>(std::ranges::count_if(sections, [](const SectionBuffer& s)
+                                                                        { return s.RecordCount > 0; }));
+        AppendBytes(buffer, &sectionCount, sizeof(sectionCount));
 
-        std::vector<DeferredSaveableEntry> deferredSaveables;
-        if (!DeserializeEntitiesInto(*staging, reader, deferredSaveables))
+        u64 offset = 0;
+        sizet totalSize = 0;
+        for (auto const& section : sections)
         {
-            OLO_CORE_ERROR("[SaveGameSerializer] Entity deserialization failed, scene is unchanged");
-            return false;
+            if (section.RecordCount == 0)
+            {
+                continue;
+            }
+            u64 const size = section.Bytes.size();
+            AppendBytes(buffer, &section.TypeHash, sizeof(section.TypeHash));
+            AppendBytes(buffer, &section.RecordCount, sizeof(section.RecordCount));
+            AppendBytes(buffer, &offset, sizeof(offset));
+            AppendBytes(buffer, &size, sizeof(size));
+            offset += size;
+            totalSize += section.Bytes.size();
         }
 
-        if (!reader.AtEnd())
+        buffer.reserve(buffer.size() + totalSize);
+        for (auto const& section : sections)
         {
-            OLO_CORE_ERROR("[SaveGameSerializer] {} trailing bytes after entity data — rejecting payload",
-                           reader.TotalSize() - reader.Tell());
-            return false;
+            if (section.RecordCount > 0)
+            {
+                AppendBytes(buffer, section.Bytes.data(), section.Bytes.size());
+            }
+        }
+    }
+
+    static std::vector<u8> WriteSectionedPayload(PayloadSource& source, SceneSettingsBlock& settings,
+                                                 SaveGameCheckpoint* outCheckpoint)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        auto const& writers = GetComponentSectionWriters();
+        CreateComponentPools(*source.Registry);
+
+        u32 maxIndex = 0;
+        for (entt::entity const e : source.Order)
+        {
+            maxIndex = std::max(maxIndex, static_cast<u32>(entt::to_entity(e)));
+        }
+        source.OrdinalOf.assign(source.Order.empty() ? 0 : static_cast<sizet>(maxIndex) + 1, kNoOrdinal);
+        for (sizet i = 0; i < source.Order.size(); ++i)
+        {
+            source.OrdinalOf[static_cast<sizet>(entt::to_entity(source.Order[i]))] = static_cast<u32>(i);
+        }
+
+        // One task per component type; the ISaveable section goes last, as the
+        // blob does in an entity record.
+        bool const fingerprint = outCheckpoint != nullptr;
+        std::vector<SectionBuffer> sections(writers.size() + 1);
+        ParallelFor("SaveGameWriteSections", static_cast<i32>(sections.size()),
+                    [&source, &writers, &sections, fingerprint](i32 index)
+                    {
+                        SectionBuffer& section = sections[static_cast<sizet>(index)];
+                        if (static_cast<sizet>(index) < writers.size())
+                        {
+                            section.TypeHash = writers[static_cast<sizet>(index)].TypeHash;
+                            writers[static_cast<sizet>(index)].Write(source, fingerprint, section);
+                        }
+                        else
+                        {
+                            section.TypeHash = kSaveableTypeHash;
+                            WriteSaveableSection(source, fingerprint, section);
+                        }
+                    });
+
+        if (std::ranges::any_of(sections, &SectionBuffer::Failed))
+        {
+            OLO_CORE_ERROR("[SaveGameSerializer] A component section failed to serialize");
+            return {};
+        }
+
+        std::vector<u8> buffer;
+        {
+            FMemoryWriter writer(buffer);
+            writer.ArIsSaveGame = true;
+            u32 settingsMarker = kSettingsMarker;
+            writer << settingsMarker;
+            SerializeSceneSettings(writer, settings);
+            if (writer.IsError())
+            {
+                return {};
+            }
+        }
+        AppendSections(buffer, source.UUIDs, sections);
+
+        if (outCheckpoint)
+        {
+            std::vector<u64> fingerprints(source.UUIDs.size());
+            for (sizet i = 0; i < fingerprints.size(); ++i)
+            {
+                fingerprints[i] = FingerprintSeed(source.UUIDs[i]);
+            }
+            for (auto const& section : sections)
+            {
+                for (auto const& [ordinal, blockHash] : section.BlockHashes)
+                {
+                    fingerprints[ordinal] = FingerprintBlock(fingerprints[ordinal], section.TypeHash, blockHash);
+                }
+            }
+
+            outCheckpoint->RecordHashes.clear();
+            outCheckpoint->RecordHashes.reserve(fingerprints.size());
+            for (sizet i = 0; i < fingerprints.size(); ++i)
+            {
+                outCheckpoint->RecordHashes[static_cast<u64>(source.UUIDs[i])] = fingerprints[i];
+            }
+        }
+
+        return buffer;
+    }
+
+    // --- Reading ---
+
+    // The entity table and table of contents after a "SECT" marker. On success
+    // every section lies inside the payload, they tile its remainder exactly,
+    // and the reader sits at the end.
+    static bool ReadSectionTable(FMemoryReader& reader, const u8* payload,
+                                 std::vector<UUID>& outUUIDs, std::vector<SectionView>& outSections)
+    {
+        u32 entityCount = 0;
+        reader << entityCount;
+        if (reader.IsError() || entityCount > kMaxEntityCount)
+        {
+            OLO_CORE_ERROR("[SaveGameSerializer] Entity count {} exceeds maximum {}", entityCount, kMaxEntityCount);
+            return false;
+        }
+        if (reader.TotalSize() - reader.Tell() < static_cast<i64>(entityCount) * static_cast<i64>(sizeof(u64)))
+        {
+            OLO_CORE_ERROR("[SaveGameSerializer] Entity table runs past the end of the payload");
+            return false;
+        }
+
+        outUUIDs.resize(entityCount);
+        for (UUID& uuid : outUUIDs)
+        {
+            reader << uuid;
+        }
+
+        u32 sectionCount = 0;
+        reader << sectionCount;
+        if (reader.IsError() || sectionCount > kMaxSectionCount)
+        {
+            OLO_CORE_ERROR("[SaveGameSerializer] Corrupt section count");
+            return false;
+        }
+
+        outSections.resize(sectionCount);
+        std::vector<u64> offsets(sectionCount);
+        for (u32 i = 0; i < sectionCount; ++i)
+        {
+            reader << outSections[i].TypeHash << outSections[i].RecordCount << offsets[i] << outSections[i].Size;
+        }
+        if (reader.IsError())
+        {
+            OLO_CORE_ERROR("[SaveGameSerializer] Truncated section table");
+            return false;
+        }
+
+        i64 const dataStart = reader.Tell();
+        u64 const available = static_cast<u64>(reader.TotalSize() - dataStart);
+        u64 expected = 0;
+        for (u32 i = 0; i < sectionCount; ++i)
+        {
+            SectionView& section = outSections[i];
+            if (offsets[i] != expected || section.Size > available - expected ||
+                section.RecordCount > entityCount || section.Size < static_cast<u64>(section.RecordCount) * kSectionRecordHeaderSize)
+            {
+                OLO_CORE_ERROR("[SaveGameSerializer] Corrupt table of contents entry {} (type 0x{:08X})", i, section.TypeHash);
+                return false;
+            }
+            section.Data = payload + dataStart + offsets[i];
+            expected += section.Size;
+        }
+        if (expected != available)
+        {
+            OLO_CORE_ERROR("[SaveGameSerializer] {} trailing bytes after the last section — rejecting payload", available - expected);
+            return false;
+        }
+
+        reader.Seek(reader.TotalSize());
+        return true;
+    }
+
+    // Restore side of one component type. Attach runs on the game thread (it
+    // fires OnComponentAdded); Decode only touches the component it is given,
+    // so decodes of different components run concurrently.
+    struct SectionLoader
+    {
+        void (*Reserve)(entt::registry&, sizet);
+        void (*Attach)(Entity);
+        bool (*Decode)(entt::registry&, entt::entity, FMemoryReader&);
+        const char* Name;
+    };
+
+    template<typename TComponent>
+    static void ReserveComponentPool(entt::registry& registry, sizet count)
+    {
+        registry.storage<TComponent>().reserve(count);
+    }
+
+    // Add the component default-constructed, as LOAD_COMPONENT does before it
+    // deserializes, so the hook sees the same state either way.
+    template<typename TComponent>
+    static void AttachComponent(Entity entity)
+    {
+        if (!entity.HasComponent<TComponent>())
+        {
+            entity.AddComponent<TComponent>();
+        }
+    }
+
+    template<typename TComponent>
+    static bool DecodeComponent(entt::registry& registry, entt::entity entity, FMemoryReader& reader)
+    {
+        SaveGameComponentSerializer::Serialize(reader, registry.get<TComponent>(entity));
+        return !reader.IsError() && reader.AtEnd();
+    }
+
+    // The restore list, keyed by type hash.
+    static const std::unordered_map<u32, SectionLoader>& GetComponentSectionLoaders()
+    {
+        static const std::unordered_map<u32, SectionLoader> s_Loaders = []()
+        {
+            std::unordered_map<u32, SectionLoader> loaders;
+#define TRY_LOAD_COMPONENT(ComponentType)                                                                    \
+    loaders.emplace(Hash::GenerateFNVHash(#ComponentType),                                                   \
+                    SectionLoader{ &ReserveComponentPool<ComponentType>, &AttachComponent<ComponentType>, \
+                                   &DecodeComponent<ComponentType>, #ComponentType })
+#include "OloEngine/SaveGame/Generated/SaveGameComponentRestore.Generated.inl"
+#undef TRY_LOAD_COMPONENT
+            return loaders;
+        }();
+        return s_Loaders;
+    }
+
+    // ========================================================================
+    // CaptureSceneState
+    // ========================================================================
+
+    std::vector<u8> SaveGameSerializer::CaptureSceneState(Scene& scene)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        SceneSettingsBlock settings = SceneSettingsBlock::From(scene);
+
+        // Snapshot runtime physics velocities into component fields before serialization
+        SyncRigidbody2DVelocities(scene.m_PhysicsWorld, scene.m_Registry);
+
+        // 3D: read from Jolt runtime bodies into temporaries, then write to component,
+        // serialize, and restore the original "initial" values afterwards.
+        struct Rigidbody3DVelocityBackup
+        {
+            entt::entity Entity;
+            glm::vec3 LinearVelocity;
+            glm::vec3 AngularVelocity;
+        };
+        std::vector<Rigidbody3DVelocityBackup> rb3dBackups;
+        if (auto* joltScene = scene.GetPhysicsScene(); joltScene && joltScene->IsInitialized())
+        {
+            auto rb3dView = scene.m_Registry.view<Rigidbody3DComponent>();
+            for (auto e : rb3dView)
+            {
+                auto& rb3d = rb3dView.get<Rigidbody3DComponent>(e);
+                Entity ent = { e, &scene };
+                if (auto body = joltScene->GetBody(ent))
+                {
+                    rb3dBackups.push_back({ e, rb3d.m_InitialLinearVelocity, rb3d.m_InitialAngularVelocity });
+                    rb3d.m_InitialLinearVelocity = body->GetLinearVelocity();
+                    rb3d.m_InitialAngularVelocity = body->GetAngularVelocity();
+                }
+            }
+        }
+
+        // Every entity with an IDComponent (all real entities), and the ISaveable
+        // state of the scripted ones
+        auto view = scene.GetAllEntitiesWith<IDComponent>();
+        std::vector<entt::entity> order;
+        std::vector<UUID> uuids;
+        std::vector<SaveableEntry> saveables;
+        order.reserve(view.size());
+        uuids.reserve(view.size());
+        bool saveablesCollected = true;
+        for (auto entityHandle : view)
+        {
+            u32 const ordinal = static_cast<u32>(order.size());
+            UUID const uuid = view.get<IDComponent>(entityHandle).ID;
+            order.push_back(entityHandle);
+            uuids.push_back(uuid);
+
+            if (auto const* sc = scene.m_Registry.try_get<ScriptComponent>(entityHandle))
+            {
+                std::vector<u8> saveableBlob;
+                if (!CollectSaveableData(uuid, sc->ClassName, saveableBlob))
+                {
+                    OLO_CORE_ERROR("[SaveGameSerializer] CollectSaveableData failed for entity {}", static_cast<u64>(uuid));
+                    saveablesCollected = false;
+                    break;
+                }
+                if (!saveableBlob.empty())
+                {
+                    saveables.push_back({ ordinal, std::move(saveableBlob) });
+                }
+            }
+        }
+
+        std::vector<u8> buffer;
+        if (saveablesCollected)
+        {
+            PayloadSource source{ &scene.m_Registry, order, uuids, saveables, {} };
+            buffer = WriteSectionedPayload(source, settings, nullptr);
+        }
+
+        // Restore original initial velocities for 3D rigidbodies
+        for (auto const& backup : rb3dBackups)
+        {
+            auto& rb3d = scene.m_Registry.get<Rigidbody3DComponent>(backup.Entity);
+            rb3d.m_InitialLinearVelocity = backup.LinearVelocity;
+            rb3d.m_InitialAngularVelocity = backup.AngularVelocity;
+        }
+
+        return buffer;
+    }
+
+    // ========================================================================
+    // Snapshots
+    // ========================================================================
+
+    struct SaveGameSceneSnapshot::Data
+    {
+        SceneSettingsBlock Settings;
+        // Same entity handles as the source scene.
+        entt::registry Registry;
+        // The source scene's IDComponent iteration order, so a snapshot serializes
+        // byte-for-byte like CaptureSceneState would have at the same moment.
+        std::vector<entt::entity> Order;
+        std::vector<UUID> UUIDs;
+        // ISaveable state, collected on the game thread at snapshot time.
+        std::vector<SaveableEntry> Saveables;
+    };
+
+    SaveGameSceneSnapshot::SaveGameSceneSnapshot(Scope<Data> data)
+        : m_Data(std::move(data))
+    {
+    }
+
+    SaveGameSceneSnapshot::~SaveGameSceneSnapshot() = default;
+
+    u32 SaveGameSceneSnapshot::GetEntityCount() const
+    {
+        return static_cast<u32>(m_Data->Order.size());
+    }
+
+    template<typename TComponent>
+    static void CopyComponentPool(entt::registry& src, entt::registry& dst)
+    {
+        auto view = src.view<TComponent>();
+        dst.storage<TComponent>().reserve(view.size());
+        for (auto e : view)
+        {
+            // Entities without an IDComponent are not saved, so they have no copy.
+            if (dst.valid(e))
+            {
+                dst.emplace<TComponent>(e, src.get<TComponent>(e));
+            }
+        }
+    }
+
+    // The capture list again, with SAVE_COMPONENT as a whole-pool copy: one pass
+    // per component type instead of a HasComponent probe per type per entity.
+    static void CopyComponentPools(entt::registry& src, entt::registry& dst)
+    {
+#define SAVE_COMPONENT(ComponentType, entity, writer) CopyComponentPool<ComponentType>(src, dst)
+#include "OloEngine/SaveGame/Generated/SaveGameComponentCapture.Generated.inl"
+#undef SAVE_COMPONENT
+    }
+
+    Scope<SaveGameSceneSnapshot> SaveGameSerializer::SnapshotSceneState(Scene& scene)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        auto data = CreateScope<SaveGameSceneSnapshot::Data>();
+        data->Settings = SceneSettingsBlock::From(scene);
+
+        SyncRigidbody2DVelocities(scene.m_PhysicsWorld, scene.m_Registry);
+
+        auto view = scene.GetAllEntitiesWith<IDComponent>();
+        data->Order.reserve(view.size());
+        data->UUIDs.reserve(view.size());
+        for (auto e : view)
+        {
+            [[maybe_unused]] entt::entity const copy = data->Registry.create(e);
+            OLO_CORE_ASSERT(copy == e, "Snapshot registry must mirror the scene's entity handles");
+            data->Order.push_back(e);
+            data->UUIDs.push_back(view.get<IDComponent>(e).ID);
+        }
+
+        CopyComponentPools(scene.m_Registry, data->Registry);
+
+        // Live 3D velocities go into the copy only, so unlike CaptureSceneState
+        // there is nothing to put back on the scene afterwards.
+        if (auto* joltScene = scene.GetPhysicsScene(); joltScene && joltScene->IsInitialized())
+        {
+            auto rb3dView = data->Registry.view<Rigidbody3DComponent>();
+            for (auto e : rb3dView)
+            {
+                if (auto body = joltScene->GetBody(Entity{ e, &scene }))
+                {
+                    auto& rb3d = rb3dView.get<Rigidbody3DComponent>(e);
+                    rb3d.m_InitialLinearVelocity = body->GetLinearVelocity();
+                    rb3d.m_InitialAngularVelocity = body->GetAngularVelocity();
+                }
+            }
+        }
+
+        // ISaveable state lives in script instances, so it has to be collected here.
+        for (sizet i = 0; i < data->Order.size(); ++i)
+        {
+            auto const* sc = scene.m_Registry.try_get<ScriptComponent>(data->Order[i]);
+            if (!sc)
+            {
+                continue;
+            }
+
+            std::vector<u8> blob;
+            if (!CollectSaveableData(data->UUIDs[i], sc->ClassName, blob))
+            {
+                OLO_CORE_ERROR("[SaveGameSerializer] CollectSaveableData failed for entity {}", static_cast<u64>(data->UUIDs[i]));
+                return nullptr;
+            }
+            if (!blob.empty())
+            {
+                data->Saveables.push_back({ static_cast<u32>(i), std::move(blob) });
+            }
+        }
+
+        // Serialization may run on a worker, where creating a pool would race.
+        CreateComponentPools(data->Registry);
+
+        return CreateScope<SaveGameSceneSnapshot>(std::move(data));
+    }
+
+    std::vector<u8> SaveGameSerializer::SerializeSnapshot(SaveGameSceneSnapshot& snapshot, SaveGameCheckpoint* outCheckpoint)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        auto& data = snapshot.GetData();
+        PayloadSource source{ &data.Registry, data.Order, data.UUIDs, data.Saveables, {} };
+        return WriteSectionedPayload(source, data.Settings, outCheckpoint);
+    }
+
+    // ========================================================================
+    // Incremental checkpoints
+    // ========================================================================
+    //
+    // Layout: "SETS" + the full settings section (small, and unversioned, so it
+    // is never diffed) | "DLTA" | u32 count + that many entity records, each in
+    // the entity-record format | u32 count + that many removed UUIDs.
+
+    // Entities per diff task
+    static constexpr sizet kIncrementalChunkEntities = 1024;
+
+    std::vector<u8> SaveGameSerializer::SerializeSnapshotIncremental(SaveGameSceneSnapshot& snapshot,
+                                                                     const SaveGameCheckpoint& base,
+                                                                     u32& outDirtyCount)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        auto& data = snapshot.GetData();
+        outDirtyCount = 0;
+
+        // Every record is serialized to be fingerprinted; only the dirty ones are
+        // kept. Runs of entities are diffed in parallel and concatenated in order.
+        struct RecordChunk
+        {
+            std::vector<u8> Records;
+            u32 Changed = 0;
+            u32 BaseEntitiesSeen = 0;
+            bool Failed = false;
+        };
+        sizet const entityCount = data.Order.size();
+        std::vector<RecordChunk> chunks((entityCount + kIncrementalChunkEntities - 1) / kIncrementalChunkEntities);
+        ParallelFor(
+            "SaveGameDiffRecords", static_cast<i32>(chunks.size()),
+            [&data, &base, &chunks, entityCount](i32 chunkIndex)
+            {
+                RecordChunk& chunk = chunks[static_cast<sizet>(chunkIndex)];
+                sizet const begin = static_cast<sizet>(chunkIndex) * kIncrementalChunkEntities;
+                sizet const end = std::min(begin + kIncrementalChunkEntities, entityCount);
+
+                auto saveable = std::ranges::lower_bound(data.Saveables, static_cast<u32>(begin), std::ranges::less{}, &SaveableEntry::Ordinal);
+
+                FMemoryWriter writer(chunk.Records);
+                writer.ArIsSaveGame = true;
+                for (sizet i = begin; i < end; ++i)
+                {
+                    std::vector<u8>* blob = nullptr;
+                    if (saveable != data.Saveables.end() && saveable->Ordinal == i)
+                    {
+                        blob = &saveable->Data;
+                        ++saveable;
+                    }
+
+                    i64 const recordStart = writer.Tell();
+                    WriteEntityRecord({ data.Order[i], data.Registry }, data.UUIDs[i], blob, writer);
+                    if (writer.IsError())
+                    {
+                        chunk.Failed = true;
+                        return;
+                    }
+
+                    u64 const fingerprint = FingerprintRecord(chunk.Records.data() + recordStart,
+                                                              static_cast<sizet>(writer.Tell() - recordStart));
+                    auto const found = base.RecordHashes.find(static_cast<u64>(data.UUIDs[i]));
+                    if (found != base.RecordHashes.end())
+                    {
+                        ++chunk.BaseEntitiesSeen;
+                        if (found->second == fingerprint)
+                        {
+                            chunk.Records.resize(static_cast<sizet>(recordStart));
+                            writer.Seek(recordStart);
+                            continue;
+                        }
+                    }
+                    ++chunk.Changed;
+                }
+            });
+
+        u32 changedCount = 0;
+        sizet baseEntitiesSeen = 0;
+        sizet recordBytes = 0;
+        for (auto const& chunk : chunks)
+        {
+            if (chunk.Failed)
+            {
+                return {};
+            }
+            changedCount += chunk.Changed;
+            baseEntitiesSeen += chunk.BaseEntitiesSeen;
+            recordBytes += chunk.Records.size();
+        }
+
+        std::vector<UUID> removed;
+        if (baseEntitiesSeen != base.RecordHashes.size())
+        {
+            std::unordered_set<u64> present;
+            present.reserve(data.UUIDs.size());
+            for (UUID const uuid : data.UUIDs)
+            {
+                present.insert(static_cast<u64>(uuid));
+            }
+            for (auto const& [uuid, hash] : base.RecordHashes)
+            {
+                if (!present.contains(uuid))
+                {
+                    removed.emplace_back(uuid);
+                }
+            }
+        }
+
+        std::vector<u8> buffer;
+        FMemoryWriter writer(buffer);
+        writer.ArIsSaveGame = true;
+
+        u32 settingsMarker = kSettingsMarker;
+        writer << settingsMarker;
+        SerializeSceneSettings(writer, data.Settings);
+
+        u32 incrementalMarker = kIncrementalMarker;
+        writer << incrementalMarker;
+
+        writer << changedCount;
+        buffer.reserve(buffer.size() + recordBytes + sizeof(u32) + removed.size() * sizeof(u64));
+        for (auto& chunk : chunks)
+        {
+            if (!chunk.Records.empty())
+            {
+                writer.Serialize(chunk.Records.data(), static_cast<i64>(chunk.Records.size()));
+            }
+        }
+
+        u32 removedCount = static_cast<u32>(removed.size());
+        writer << removedCount;
+        for (UUID uuid : removed)
+        {
+            writer << uuid;
+        }
+
+        if (writer.IsError())
+        {
+            return {};
+        }
+
+        outDirtyCount = changedCount + removedCount;
+        return buffer;
+    }
+
+    // A record of the incremental payload, located by MergeIncrementalPayload.
+    struct IncrementalRecordSpan
+    {
+        i64 Offset = 0;
+        i64 Size = 0;
+        bool Consumed = false;
+    };
+
+    // Merge onto a v19-and-older base: the output keeps the entity-record layout.
+    static bool MergeIntoEntityRecords(FMemoryReader& baseReader, const std::vector<u8>& basePayload,
+                                       const std::vector<u8>& incrementalPayload,
+                                       std::unordered_map<u64, IncrementalRecordSpan>& changed,
+                                       const std::vector<u64>& changedOrder, const std::unordered_set<u64>& removed,
+                                       std::vector<u8>& outPayload)
+    {
+        u32 baseCount = 0;
+        baseReader << baseCount;
+        if (baseReader.IsError() || baseCount > kMaxEntityCount)
+        {
+            OLO_CORE_ERROR("[SaveGameSerializer] Base payload is not a full save");
+            return false;
+        }
+
+        std::vector<u8> records;
+        records.reserve(basePayload.size());
+        u32 mergedCount = 0;
+        for (u32 i = 0; i < baseCount; ++i)
+        {
+            i64 const start = baseReader.Tell();
+            UUID uuid;
+            if (!SkipEntityRecord(baseReader, uuid))
+            {
+                OLO_CORE_ERROR("[SaveGameSerializer] Corrupt record {} in base payload", i);
+                return false;
+            }
+
+            u64 const key = static_cast<u64>(uuid);
+            if (removed.contains(key))
+            {
+                continue;
+            }
+
+            const u8* begin = basePayload.data() + start;
+            i64 size = baseReader.Tell() - start;
+            if (auto const found = changed.find(key); found != changed.end())
+            {
+                begin = incrementalPayload.data() + found->second.Offset;
+                size = found->second.Size;
+                found->second.Consumed = true;
+            }
+            records.insert(records.end(), begin, begin + size);
+            ++mergedCount;
+        }
+        if (!baseReader.AtEnd())
+        {
+            OLO_CORE_ERROR("[SaveGameSerializer] Trailing bytes after base payload records");
+            return false;
+        }
+
+        // Entities created since the base.
+        for (u64 const key : changedOrder)
+        {
+            auto const& span = changed[key];
+            if (!span.Consumed)
+            {
+                const u8* begin = incrementalPayload.data() + span.Offset;
+                records.insert(records.end(), begin, begin + span.Size);
+                ++mergedCount;
+            }
+        }
+
+        outPayload.reserve(outPayload.size() + 2 * sizeof(u32) + records.size());
+        u32 const entitiesMarker = kEntitiesMarker;
+        AppendBytes(outPayload, &entitiesMarker, sizeof(entitiesMarker));
+        AppendBytes(outPayload, &mergedCount, sizeof(mergedCount));
+        AppendBytes(outPayload, records.data(), records.size());
+        return true;
+    }
+
+    // Merge onto a sectioned base: surviving base records are copied section by
+    // section with their entity indices remapped, then the changed records are
+    // split into their component blocks and appended to the matching sections.
+    static bool MergeIntoSections(FMemoryReader& baseReader, const std::vector<u8>& basePayload,
+                                  const std::vector<u8>& incrementalPayload,
+                                  std::unordered_map<u64, IncrementalRecordSpan>& changed,
+                                  const std::vector<u64>& changedOrder, const std::unordered_set<u64>& removed,
+                                  std::vector<u8>& outPayload)
+    {
+        std::vector<UUID> baseUUIDs;
+        std::vector<SectionView> baseSections;
+        if (!ReadSectionTable(baseReader, basePayload.data(), baseUUIDs, baseSections))
+        {
+            return false;
+        }
+
+        // New entity table: surviving base entities in base order, then the ones
+        // created since the base.
+        u32 const baseCount = static_cast<u32>(baseUUIDs.size());
+        std::vector<u32> remap(baseCount, kNoOrdinal);
+        std::vector<bool> replaced(baseCount, false);
+        std::vector<UUID> uuids;
+        uuids.reserve(baseCount + changed.size());
+        std::vector<std::pair<u32, const IncrementalRecordSpan*>> changedEntities;
+        changedEntities.reserve(changed.size());
+        for (u32 i = 0; i < baseCount; ++i)
+        {
+            u64 const key = static_cast<u64>(baseUUIDs[i]);
+            if (removed.contains(key))
+            {
+                continue;
+            }
+
+            remap[i] = static_cast<u32>(uuids.size());
+            if (auto const found = changed.find(key); found != changed.end())
+            {
+                replaced[i] = true;
+                found->second.Consumed = true;
+                changedEntities.emplace_back(remap[i], &found->second);
+            }
+            uuids.push_back(baseUUIDs[i]);
+        }
+        for (u64 const key : changedOrder)
+        {
+            auto const& span = changed[key];
+            if (!span.Consumed)
+            {
+                changedEntities.emplace_back(static_cast<u32>(uuids.size()), &span);
+                uuids.emplace_back(key);
+            }
+        }
+        if (uuids.size() > kMaxEntityCount)
+        {
+            OLO_CORE_ERROR("[SaveGameSerializer] Merged entity count {} exceeds maximum {}", uuids.size(), kMaxEntityCount);
+            return false;
+        }
+
+        std::vector<SectionBuffer> sections(baseSections.size());
+        std::unordered_map<u32, sizet> sectionOf;
+        for (sizet s = 0; s < baseSections.size(); ++s)
+        {
+            SectionView const& baseSection = baseSections[s];
+            SectionBuffer& section = sections[s];
+            section.TypeHash = baseSection.TypeHash;
+            section.Bytes.reserve(static_cast<sizet>(baseSection.Size));
+            sectionOf.try_emplace(baseSection.TypeHash, s);
+
+            SectionRecordReader records(baseSection, baseCount);
+            u32 entityIndex = 0;
+            const u8* data = nullptr;
+            u32 size = 0;
+            while (records.Next(entityIndex, data, size))
+            {
+                if (remap[entityIndex] != kNoOrdinal && !replaced[entityIndex])
+                {
+                    AppendSectionRecord(section, remap[entityIndex], data, size);
+                }
+            }
+            if (!records.IsComplete())
+            {
+                OLO_CORE_ERROR("[SaveGameSerializer] Corrupt section 0x{:08X} in base payload", baseSection.TypeHash);
+                return false;
+            }
+        }
+
+        for (auto const& [entityIndex, span] : changedEntities)
+        {
+            ForEachRecordBlock(incrementalPayload.data() + span->Offset, static_cast<sizet>(span->Size),
+                               [&sections, &sectionOf, entityIndex](u32 typeHash, const u8* data, u32 size)
+                               {
+                                   auto const [found, inserted] = sectionOf.try_emplace(typeHash, sections.size());
+                                   if (inserted)
+                                   {
+                                       sections.emplace_back().TypeHash = typeHash;
+                                   }
+                                   AppendSectionRecord(sections[found->second], entityIndex, data, size);
+                               });
+        }
+
+        AppendSections(outPayload, uuids, sections);
+        return true;
+    }
+
+    bool SaveGameSerializer::MergeIncrementalPayload(const std::vector<u8>& basePayload,
+                                                     const std::vector<u8>& incrementalPayload,
+                                                     std::vector<u8>& outPayload,
+                                                     u32 formatVersion)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        // --- Incremental: settings bytes, dirty records, removed UUIDs ---
+        FMemoryReader incReader(incrementalPayload);
+        incReader.ArIsSaveGame = true;
+        incReader.SetArchiveVersion(formatVersion);
+
+        SceneSettingsBlock scratchSettings;
+        if (!ReadSettingsSection(incReader, scratchSettings))
+        {
+            return false;
+        }
+        i64 const settingsEnd = incReader.Tell();
+
+        u32 marker = 0;
+        incReader << marker;
+        if (marker != kIncrementalMarker)
+        {
+            OLO_CORE_ERROR("[SaveGameSerializer] Invalid incremental checkpoint marker");
+            return false;
+        }
+
+        u32 changedCount = 0;
+        incReader << changedCount;
+        if (incReader.IsError() || changedCount > kMaxEntityCount)
+        {
+            OLO_CORE_ERROR("[SaveGameSerializer] Corrupt incremental checkpoint entity count");
+            return false;
+        }
+
+        std::vector<u64> changedOrder;
+        std::unordered_map<u64, IncrementalRecordSpan> changed;
+        changedOrder.reserve(changedCount);
+        changed.reserve(changedCount);
+        for (u32 i = 0; i < changedCount; ++i)
+        {
+            i64 const start = incReader.Tell();
+            UUID uuid;
+            if (!SkipEntityRecord(incReader, uuid))
+            {
+                OLO_CORE_ERROR("[SaveGameSerializer] Corrupt record {} in incremental checkpoint", i);
+                return false;
+            }
+            changedOrder.push_back(static_cast<u64>(uuid));
+            changed[static_cast<u64>(uuid)] = { start, incReader.Tell() - start };
+        }
+
+        u32 removedCount = 0;
+        incReader << removedCount;
+        if (incReader.IsError() || removedCount > kMaxEntityCount)
+        {
+            OLO_CORE_ERROR("[SaveGameSerializer] Corrupt incremental checkpoint removal count");
+            return false;
+        }
+        std::unordered_set<u64> removed;
+        removed.reserve(removedCount);
+        for (u32 i = 0; i < removedCount; ++i)
+        {
+            UUID uuid;
+            incReader << uuid;
+            removed.insert(static_cast<u64>(uuid));
+        }
+        if (incReader.IsError() || !incReader.AtEnd())
+        {
+            OLO_CORE_ERROR("[SaveGameSerializer] Malformed incremental checkpoint tail");
+            return false;
+        }
+
+        // --- Base: either layout ---
+        FMemoryReader baseReader(basePayload);
+        baseReader.ArIsSaveGame = true;
+        baseReader.SetArchiveVersion(formatVersion);
+        if (!ReadSettingsSection(baseReader, scratchSettings))
+        {
+            return false;
+        }
+        baseReader << marker;
+
+        outPayload.assign(incrementalPayload.begin(), incrementalPayload.begin() + settingsEnd);
+        bool merged = false;
+        if (marker == kSectionsMarker)
+        {
+            merged = MergeIntoSections(baseReader, basePayload, incrementalPayload, changed, changedOrder, removed, outPayload);
+        }
+        else if (marker == kEntitiesMarker)
+        {
+            merged = MergeIntoEntityRecords(baseReader, basePayload, incrementalPayload, changed, changedOrder, removed, outPayload);
+        }
+        else
+        {
+            OLO_CORE_ERROR("[SaveGameSerializer] Base payload is not a full save");
+        }
+
+        if (!merged)
+        {
+            outPayload.clear();
+        }
+        return merged;
+    }
+
+    bool SaveGameSerializer::ConvertToEntityRecordLayout(const std::vector<u8>& payload, std::vector<u8>& outPayload,
+                                                         u32 formatVersion)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        FMemoryReader reader(payload);
+        reader.ArIsSaveGame = true;
+        reader.SetArchiveVersion(formatVersion);
+
+        SceneSettingsBlock scratchSettings;
+        if (!ReadSettingsSection(reader, scratchSettings))
+        {
+            return false;
+        }
+        i64 const settingsEnd = reader.Tell();
+
+        u32 marker = 0;
+        reader << marker;
+        if (marker == kEntitiesMarker)
+        {
+            outPayload = payload;
+            return true;
+        }
+        if (marker != kSectionsMarker)
+        {
+            OLO_CORE_ERROR("[SaveGameSerializer] Invalid entities marker");
+            return false;
+        }
+
+        std::vector<UUID> uuids;
+        std::vector<SectionView> sections;
+        if (!ReadSectionTable(reader, payload.data(), uuids, sections))
+        {
+            return false;
+        }
+
+        // Each entity's blocks in section order — the order WriteEntityRecord
+        // writes them in, with the ISaveable blob last.
+        struct BlockRef
+        {
+            u32 TypeHash;
+            const u8* Data;
+            u32 Size;
+        };
+        std::vector<std::vector<BlockRef>> blocks(uuids.size());
+        for (auto const& section : sections)
+        {
+            SectionRecordReader records(section, static_cast<u32>(uuids.size()));
+            u32 entityIndex = 0;
+            const u8* data = nullptr;
+            u32 size = 0;
+            while (records.Next(entityIndex, data, size))
+            {
+                blocks[entityIndex].push_back({ section.TypeHash, data, size });
+            }
+            if (!records.IsComplete())
+            {
+                OLO_CORE_ERROR("[SaveGameSerializer] Corrupt section 0x{:08X}", section.TypeHash);
+                return false;
+            }
         }
 
-        // --- All parsing succeeded — commit to real scene ---
+        outPayload.assign(payload.begin(), payload.begin() + settingsEnd);
+        u32 const entitiesMarker = kEntitiesMarker;
+        u32 const entityCount = static_cast<u32>(uuids.size());
+        AppendBytes(outPayload, &entitiesMarker, sizeof(entitiesMarker));
+        AppendBytes(outPayload, &entityCount, sizeof(entityCount));
+        for (sizet i = 0; i < uuids.size(); ++i)
+        {
+            u64 const uuid = static_cast<u64>(uuids[i]);
+            AppendBytes(outPayload, &uuid, sizeof(uuid));
+            for (auto const& block : blocks[i])
+            {
+                AppendBytes(outPayload, &block.TypeHash, sizeof(block.TypeHash));
+                AppendBytes(outPayload, &block.Size, sizeof(block.Size));
+                AppendBytes(outPayload, block.Data, block.Size);
+            }
+            u32 const endMarker = kEndOfEntityMarker;
+            AppendBytes(outPayload, &endMarker, sizeof(endMarker));
+        }
+        return true;
+    }
 
-        // Apply settings
-        scene.m_PostProcessSettings = std::move(postProcess);
-        scene.m_SnowSettings = std::move(snow);
-        scene.m_FogSettings = std::move(fog);
-        scene.m_WindSettings = std::move(wind);
-        scene.m_SnowAccumulationSettings = std::move(snowAccum);
-        scene.m_SnowEjectaSettings = std::move(snowEjecta);
-        scene.m_PrecipitationSettings = std::move(precipitation);
-        scene.m_StreamingSettings = std::move(streaming);
+    // ========================================================================
+    // RestoreSceneState
+    // ========================================================================
+
+    // Deferred ISaveable restore entry — collected during staging, applied post-commit.
+    struct DeferredSaveableEntry
+    {
+        UUID EntityID;
+        std::string ClassName;
+        std::vector<u8> Data;
+    };
+
+    // Deserialize the next entity record into the staging scene. Returns whether parsing succeeded.
+    static bool DeserializeEntityRecord(Scene& staging, FMemoryReader& reader, u32 index,
+                                        std::vector<DeferredSaveableEntry>& outDeferredSaveables)
+    {
+        UUID uuid;
+        reader << uuid;
+        if (reader.IsError())
+        {
+            OLO_CORE_ERROR("[SaveGameSerializer] Failed to read UUID for entity {}", index);
+            return false;
+        }
+
+        // Create entity with the saved UUID
+        Entity entity = staging.CreateEntityWithUUID(uuid, "");
+
+        bool loadFailed = false;
+
+        // Read component blocks until end-of-entity sentinel (typeHash == 0)
+        while (true)
+        {
+            if (reader.AtEnd() || reader.IsError())
+            {
+                OLO_CORE_ERROR("[SaveGameSerializer] Unexpected end of data at entity {} (missing end marker)", index);
+                return false;
+            }
+
+            u32 typeHash = 0;
+            reader << typeHash;
+
+            // End-of-entity sentinel
+            if (typeHash == kEndOfEntityMarker)
+            {
+                break;
+            }
+
+            u32 dataSize = 0;
+            reader << dataSize;
+
+            // Sanity limit
+            if (reader.IsError() || dataSize > kMaxComponentBlockSize)
+            {
+                OLO_CORE_ERROR("[SaveGameSerializer] Corrupt component block at entity {}", index);
+                return false;
+            }
+
+            // Read component data blob
+            std::vector<u8> compData(dataSize);
+            if (dataSize > 0)
+            {
+                reader.Serialize(compData.data(), static_cast<i64>(dataSize));
+            }
+
+            if (reader.IsError())
+            {
+                OLO_CORE_ERROR("[SaveGameSerializer] Read error at entity {}", index);
+                return false;
+            }
+
+            // Match typeHash to component and deserialize
+            bool matched = false;
+
+#define TRY_LOAD_COMPONENT(ComponentType) \
+    if (!matched)                         \
+    LOAD_COMPONENT(ComponentType, entity, typeHash, compData)
+
+            // The TRY_LOAD_COMPONENT(...) restore matcher is generated by
+            // OloHeaderTool — the exact complement of the SAVE_COMPONENT capture
+            // list above, so a captured component is always restorable. DO NOT
+            // hand-edit; see SaveGameComponentSerializer.cpp. Order is irrelevant
+            // (each stream block is matched by typeHash), so unlike the former
+            // hand list IDComponent is just another TRY_LOAD_COMPONENT entry.
+#include "OloEngine/SaveGame/Generated/SaveGameComponentRestore.Generated.inl"
+
+#undef TRY_LOAD_COMPONENT
+
+            // ISaveable blob: defer restore until after staging is committed
+            if (!matched && typeHash == kSaveableTypeHash)
+            {
+                if (entity.HasComponent<ScriptComponent>())
+                {
+                    outDeferredSaveables.push_back({ uuid, entity.GetComponent<ScriptComponent>().ClassName, compData });
+                }
+                matched = true;
+            }
+
+            // Unknown component types are silently skipped (forward compatible)
+        }
+
+        if (loadFailed)
+        {
+            OLO_CORE_ERROR("[SaveGameSerializer] Component deserialization failed for entity {} (UUID {})", index, static_cast<u64>(uuid));
+            return false;
+        }
+
+        return !reader.IsError();
+    }
+
+    // Destroy every entity in `scene`, children before parents.
+    static void DestroyAllEntities(Scene& scene)
+    {
+        auto allEntities = scene.GetAllEntitiesWith<IDComponent>();
+        std::vector<Entity> toDestroy;
+        for (auto e : allEntities)
+        {
+            toDestroy.emplace_back(e, &scene);
+        }
+
+        auto getDepth = [](Entity& ent) -> u32
+        {
+            u32 depth = 0;
+            Entity current = ent;
+            while (current.GetParentUUID() != UUID(0))
+            {
+                ++depth;
+                current = current.GetParent();
+                if (!current)
+                {
+                    break;
+                }
+            }
+            return depth;
+        };
+
+        std::ranges::sort(toDestroy,
+                          [&getDepth](Entity& a, Entity& b)
+                          {
+                              return getDepth(a) > getDepth(b);
+                          });
+
+        for (const auto& entity : toDestroy)
+        {
+            scene.DestroyEntity(entity);
+        }
+    }
+
+    // A sectioned restore runs in phases: create every entity, attach every
+    // component default-constructed (game thread — OnComponentAdded), then
+    // decode all sections at once in parallel.
+    enum class ESectionRestorePhase : u8
+    {
+        CreateEntities = 0,
+        AttachComponents,
+        Decode
+    };
+
+    // Components attached per decode task
+    static constexpr u32 kDecodeChunkRecords = 2048;
+
+    // A run of records of one section, decoded by one task.
+    struct DecodeChunk
+    {
+        const SectionLoader* Loader = nullptr;
+        SectionView Records;
+    };
+
+    struct SaveGameRestoreJob::State
+    {
+        std::vector<u8> OwnedPayload;
+        const u8* PayloadData = nullptr;
+        FMemoryReader Reader;
+        SceneSettingsBlock Settings;
+        Ref<Scene> Staging;
+        std::vector<DeferredSaveableEntry> DeferredSaveables;
+
+        // Sectioned payloads only
+        bool Sectioned = false;
+        ESectionRestorePhase Phase = ESectionRestorePhase::CreateEntities;
+        std::vector<UUID> UUIDs;
+        std::vector<entt::entity> Entities;
+        std::vector<SectionView> Sections;
+        sizet SaveableSection = std::numeric_limits<sizet>::max();
+        sizet AttachSection = 0;
+        std::optional<SectionRecordReader> AttachRecords;
+        // Per entity, the last section it had a record in: a second record in
+        // the same section would be decoded by two tasks at once.
+        std::vector<u32> LastSectionOf;
+        u64 ChunkStart = 0;
+        u32 ChunkRecords = 0;
+        std::vector<DecodeChunk> DecodeChunks;
+
+        explicit State(std::vector<u8>&& payload)
+            : OwnedPayload(std::move(payload)), PayloadData(OwnedPayload.data()), Reader(OwnedPayload)
+        {
+        }
+
+        explicit State(const std::vector<u8>& payload)
+            : PayloadData(payload.data()), Reader(payload)
+        {
+        }
+    };
+
+    SaveGameRestoreJob::SaveGameRestoreJob(Scene& scene, std::vector<u8>&& payload, u32 formatVersion)
+        : m_State(CreateScope<State>(std::move(payload)))
+    {
+        Begin(scene, formatVersion);
+    }
+
+    SaveGameRestoreJob::SaveGameRestoreJob(Scene& scene, const std::vector<u8>& payload, u32 formatVersion)
+        : m_State(CreateScope<State>(payload))
+    {
+        Begin(scene, formatVersion);
+    }
+
+    SaveGameRestoreJob::~SaveGameRestoreJob() = default;
+
+    void SaveGameRestoreJob::Begin(Scene& scene, u32 formatVersion)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        State& state = *m_State;
+        FMemoryReader& reader = state.Reader;
+        if (reader.TotalSize() == 0)
+        {
+            return;
+        }
+
+        reader.ArIsSaveGame = true;
+        reader.SetArchiveVersion(formatVersion);
+
+        // --- Parse settings into local temporaries ---
+        // SEEDED FROM THE LIVE SCENE, not default-constructed. Every one of
+        // these is overwritten field by field by the reads below — except any
+        // field this archive predates or deliberately does not carry, which
+        // then retains the value the scene was loaded with. Default-
+        // constructing instead would silently reset such a field to a global
+        // default that has nothing to do with the scene the player is in.
+        state.Settings = SceneSettingsBlock::From(scene);
+        if (!ReadSettingsSection(reader, state.Settings))
+        {
+            return;
+        }
+
+        // --- Entities: sectioned (v20+) or per-entity records ---
+        u32 entitiesMarker = 0;
+        reader << entitiesMarker;
+        if (entitiesMarker == kSectionsMarker)
+        {
+            if (!ReadSectionTable(reader, state.PayloadData, state.UUIDs, state.Sections))
+            {
+                return;
+            }
+
+            state.Sectioned = true;
+            m_EntityCount = static_cast<u32>(state.UUIDs.size());
+            state.Entities.resize(m_EntityCount, entt::null);
+            state.LastSectionOf.assign(m_EntityCount, kNoOrdinal);
+            for (sizet i = 0; i < state.Sections.size(); ++i)
+            {
+                if (state.Sections[i].TypeHash == kSaveableTypeHash)
+                {
+                    state.SaveableSection = i;
+                }
+            }
+        }
+        else if (entitiesMarker == kEntitiesMarker)
+        {
+            reader << m_EntityCount;
+            if (reader.IsError())
+            {
+                OLO_CORE_ERROR("[SaveGameSerializer] Failed to read entity count");
+                return;
+            }
+
+            if (m_EntityCount > kMaxEntityCount)
+            {
+                OLO_CORE_ERROR("[SaveGameSerializer] Entity count {} exceeds maximum {}", m_EntityCount, kMaxEntityCount);
+                return;
+            }
+        }
+        else
+        {
+            OLO_CORE_ERROR("[SaveGameSerializer] Invalid entities marker");
+            return;
+        }
+
+        // --- Entities are deserialized into a staging scene ---
+        // If deserialization fails, the real scene is untouched.
+        state.Staging = Ref<Scene>::Create();
+        state.Staging->m_ViewportWidth = scene.m_ViewportWidth;
+        state.Staging->m_ViewportHeight = scene.m_ViewportHeight;
+
+        if (state.Sectioned)
+        {
+            // The entity count is known up front, so size everything
+            // CreateEntityWithUUID grows one entity at a time.
+            entt::registry& registry = state.Staging->m_Registry;
+            registry.storage<entt::entity>().reserve(m_EntityCount);
+            registry.storage<IDComponent>().reserve(m_EntityCount);
+            registry.storage<TransformComponent>().reserve(m_EntityCount);
+            registry.storage<TagComponent>().reserve(m_EntityCount);
+            state.Staging->m_EntityMap.Reserve(static_cast<i32>(m_EntityCount));
+            state.Staging->m_EntityNameMap.reserve(m_EntityCount);
+        }
+
+        m_Status = EStatus::InProgress;
+        Step(0);
+    }
+
+    SaveGameRestoreJob::EStatus SaveGameRestoreJob::Step(u32 maxEntities)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        if (m_Status != EStatus::InProgress)
+        {
+            return m_Status;
+        }
+
+        if (m_State->Sectioned)
+        {
+            return StepSections(maxEntities);
+        }
+
+        FMemoryReader& reader = m_State->Reader;
+        u32 const end = m_NextEntity + std::min(maxEntities, m_EntityCount - m_NextEntity);
+        for (; m_NextEntity < end; ++m_NextEntity)
+        {
+            if (!DeserializeEntityRecord(*m_State->Staging, reader, m_NextEntity, m_State->DeferredSaveables))
+            {
+                OLO_CORE_ERROR("[SaveGameSerializer] Entity deserialization failed, scene is unchanged");
+                m_Status = EStatus::Failed;
+                return m_Status;
+            }
+        }
+
+        if (m_NextEntity == m_EntityCount)
+        {
+            if (!reader.AtEnd())
+            {
+                OLO_CORE_ERROR("[SaveGameSerializer] {} trailing bytes after entity data — rejecting payload",
+                               reader.TotalSize() - reader.Tell());
+                m_Status = EStatus::Failed;
+            }
+            else
+            {
+                m_Status = EStatus::ReadyToCommit;
+            }
+        }
+
+        return m_Status;
+    }
+
+    SaveGameRestoreJob::EStatus SaveGameRestoreJob::StepSections(u32 budget)
+    {
+        State& state = *m_State;
+        Scene& staging = *state.Staging;
+
+        auto fail = [this](std::string_view what)
+        {
+            OLO_CORE_ERROR("[SaveGameSerializer] {}, scene is unchanged", what);
+            m_Status = EStatus::Failed;
+            return m_Status;
+        };
+
+        // --- Entities, in table order ---
+        if (state.Phase == ESectionRestorePhase::CreateEntities)
+        {
+            DiagnosticsEventLog::SuppressScope suppressSpawnFlood;
+            u32 const end = m_NextEntity + std::min(budget, m_EntityCount - m_NextEntity);
+            budget -= end - m_NextEntity;
+            for (; m_NextEntity < end; ++m_NextEntity)
+            {
+                state.Entities[m_NextEntity] = staging.CreateEntityWithUUID(state.UUIDs[m_NextEntity], "");
+            }
+            if (m_NextEntity < m_EntityCount)
+            {
+                return m_Status;
+            }
+            state.Phase = ESectionRestorePhase::AttachComponents;
+        }
 
-        // Destroy all existing entities in the real scene (children before parents)
+        // --- Components, default-constructed, section by section ---
+        if (state.Phase == ESectionRestorePhase::AttachComponents)
         {
-            auto allEntities = scene.GetAllEntitiesWith<IDComponent>();
-            std::vector<Entity> toDestroy;
-            for (auto e : allEntities)
+            auto const& loaders = GetComponentSectionLoaders();
+            while (state.AttachSection < state.Sections.size())
             {
-                toDestroy.emplace_back(e, &scene);
+                SectionView const& section = state.Sections[state.AttachSection];
+                auto const loader = loaders.find(section.TypeHash);
+                if (loader == loaders.end())
+                {
+                    // ISaveable blobs (handled after decoding), or a component this
+                    // build does not know — skipped, as in the entity-record layout.
+                    ++state.AttachSection;
+                    continue;
+                }
+
+                if (!state.AttachRecords)
+                {
+                    loader->second.Reserve(staging.m_Registry, section.RecordCount);
+                    state.AttachRecords.emplace(section, m_EntityCount);
+                    state.ChunkStart = 0;
+                    state.ChunkRecords = 0;
+                }
+
+                SectionRecordReader& records = *state.AttachRecords;
+                u32 const sectionIndex = static_cast<u32>(state.AttachSection);
+                u32 entityIndex = 0;
+                const u8* data = nullptr;
+                u32 size = 0;
+                while (budget > 0 && records.Next(entityIndex, data, size))
+                {
+                    if (state.LastSectionOf[entityIndex] == sectionIndex)
+                    {
+                        return fail(std::string("Entity listed twice in section ") + loader->second.Name);
+                    }
+                    state.LastSectionOf[entityIndex] = sectionIndex;
+
+                    loader->second.Attach(Entity{ state.Entities[entityIndex], &staging });
+                    --budget;
+
+                    if (++state.ChunkRecords == kDecodeChunkRecords)
+                    {
+                        state.DecodeChunks.push_back({ &loader->second,
+                                                       { section.TypeHash, state.ChunkRecords, section.Data + state.ChunkStart,
+                                                         records.GetOffset() - state.ChunkStart } });
+                        state.ChunkStart = records.GetOffset();
+                        state.ChunkRecords = 0;
+                    }
+                }
+
+                if (records.IsMalformed())
+                {
+                    return fail(std::string("Corrupt section ") + loader->second.Name);
+                }
+                if (!records.AtEnd())
+                {
+                    return m_Status; // out of budget
+                }
+                if (!records.IsComplete())
+                {
+                    return fail(std::string("Record count mismatch in section ") + loader->second.Name);
+                }
+
+                if (state.ChunkRecords > 0)
+                {
+                    state.DecodeChunks.push_back({ &loader->second,
+                                                   { section.TypeHash, state.ChunkRecords, section.Data + state.ChunkStart,
+                                                     records.GetOffset() - state.ChunkStart } });
+                }
+                state.AttachRecords.reset();
+                ++state.AttachSection;
             }
+            state.Phase = ESectionRestorePhase::Decode;
+        }
 
-            auto getDepth = [](Entity& ent) -> u32
+        // --- Decode: one parallel pass, whatever the budget ---
+        // Every pool exists by now and each task writes only the components of
+        // its own records, so nothing here mutates the registry's structure.
+        std::atomic<bool> decodeFailed{ false };
+        entt::registry& registry = staging.m_Registry;
+        u32 const formatVersion = state.Reader.GetArchiveVersion();
+        u32 const entityCount = m_EntityCount;
+        ParallelFor(
+            "SaveGameDecodeSections", static_cast<i32>(state.DecodeChunks.size()),
+            [&state, &registry, &decodeFailed, formatVersion, entityCount](i32 index)
             {
-                u32 depth = 0;
-                Entity current = ent;
-                while (current.GetParentUUID() != UUID(0))
+                if (decodeFailed.load(std::memory_order_relaxed))
+                {
+                    return;
+                }
+
+                DecodeChunk const& chunk = state.DecodeChunks[static_cast<sizet>(index)];
+                SectionRecordReader records(chunk.Records, entityCount);
+                u32 entityIndex = 0;
+                const u8* data = nullptr;
+                u32 size = 0;
+                while (records.Next(entityIndex, data, size))
                 {
-                    ++depth;
-                    current = current.GetParent();
-                    if (!current)
+                    FMemoryReader reader(data, static_cast<i64>(size));
+                    reader.ArIsSaveGame = true;
+                    reader.SetArchiveVersion(formatVersion);
+                    if (!chunk.Loader->Decode(registry, state.Entities[entityIndex], reader))
                     {
-                        break;
+                        OLO_CORE_WARN("[SaveGameSerializer] Incomplete deserialization of {} ({}/{} bytes)",
+                                      chunk.Loader->Name, reader.Tell(), size);
+                        decodeFailed.store(true, std::memory_order_relaxed);
+                        return;
                     }
                 }
-                return depth;
-            };
+            });
 
-            std::ranges::sort(toDestroy,
-                              [&getDepth](Entity& a, Entity& b)
-                              {
-                                  return getDepth(a) > getDepth(b);
-                              });
+        if (decodeFailed.load(std::memory_order_relaxed))
+        {
+            return fail("Component deserialization failed");
+        }
 
-            for (const auto& entity : toDestroy)
+        // ISaveable blobs need the decoded ScriptComponent's class name.
+        if (state.SaveableSection < state.Sections.size())
+        {
+            SectionRecordReader records(state.Sections[state.SaveableSection], m_EntityCount);
+            u32 entityIndex = 0;
+            const u8* data = nullptr;
+            u32 size = 0;
+            while (records.Next(entityIndex, data, size))
+            {
+                if (auto const* sc = registry.try_get<ScriptComponent>(state.Entities[entityIndex]))
+                {
+                    state.DeferredSaveables.push_back({ state.UUIDs[entityIndex], sc->ClassName, std::vector<u8>(data, data + size) });
+                }
+            }
+            if (!records.IsComplete())
             {
-                scene.DestroyEntity(entity);
+                return fail("Corrupt ISaveable section");
             }
         }
 
+        m_Status = EStatus::ReadyToCommit;
+        return m_Status;
+    }
+
+    bool SaveGameRestoreJob::Commit(Scene& scene)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        if (m_Status != EStatus::ReadyToCommit)
+        {
+            OLO_CORE_ERROR("[SaveGameSerializer] Restore committed before it finished parsing");
+            return false;
+        }
+        m_Status = EStatus::Committed;
+
+        // --- All parsing succeeded — commit to real scene ---
+
+        // Apply settings
+        SceneSettingsBlock& settings = m_State->Settings;
+        scene.m_PostProcessSettings = std::move(settings.PostProcess);
+        scene.m_SnowSettings = std::move(settings.Snow);
+        scene.m_FogSettings = std::move(settings.Fog);
+        scene.m_WindSettings = std::move(settings.Wind);
+        scene.m_SnowAccumulationSettings = std::move(settings.SnowAccumulation);
+        scene.m_SnowEjectaSettings = std::move(settings.SnowEjecta);
+        scene.m_PrecipitationSettings = std::move(settings.Precipitation);
+        scene.m_StreamingSettings = std::move(settings.Streaming);
+
+        DestroyAllEntities(scene);
+
         // Swap ECS registry and entity map from staging into the real scene.
         // After this swap the registries are owned by the correct Scene objects.
-        // NOTE: Any Entity wrappers created during DeserializeEntitiesInto pointed
+        // NOTE: Any Entity wrappers created during DeserializeEntityRecord pointed
         // at the staging Scene, but those are temporaries local to that call and
         // are not cached.  Callers must NOT hold Entity objects across a
         // RestoreSceneState call — the swap invalidates them.
+        Ref<Scene> staging = std::move(m_State->Staging);
         std::swap(scene.m_Registry, staging->m_Registry);
         std::swap(scene.m_EntityMap, staging->m_EntityMap);
 
         // Apply deferred ISaveable restores now that entities live in the committed scene
-        for (auto& entry : deferredSaveables)
+        for (auto& entry : m_State->DeferredSaveables)
         {
             if (!RestoreSaveableData(entry.EntityID, entry.ClassName, entry.Data))
             {
@@ -639,7 +2282,19 @@ namespace OloEngine
         return true;
     }
 
-#undef SAVE_COMPONENT
+    bool SaveGameSerializer::RestoreSceneState(Scene& scene, const std::vector<u8>& data, u32 formatVersion)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        SaveGameRestoreJob job(scene, data, formatVersion);
+        if (job.Step(std::numeric_limits<u32>::max()) != SaveGameRestoreJob::EStatus::ReadyToCommit)
+        {
+            return false;
+        }
+
+        return job.Commit(scene);
+    }
+
 #undef LOAD_COMPONENT
 
 } // namespace OloEngine
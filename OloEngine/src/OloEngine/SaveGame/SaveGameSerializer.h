@@ -3,28 +3,165 @@
 #include "OloEngine/Core/Base.h"
 #include "OloEngine/SaveGame/SaveGameTypes.h"
 
+#include <unordered_map>
 #include <vector>
 
 namespace OloEngine
 {
     class Scene;
 
+    // A detached copy of everything CaptureSceneState reads from a scene: the
+    // scene settings, every save-relevant component pool (copied pool by pool,
+    // entity handles preserved), live physics velocities baked into the copied
+    // rigidbodies, and the ISaveable blobs, which can only be collected on the
+    // game thread. Taking one is the only game-thread cost of an async save;
+    // serializing it touches nothing the game thread owns, so it may happen on
+    // any thread, once.
+    class SaveGameSceneSnapshot
+    {
+      public:
+        struct Data; // defined in SaveGameSerializer.cpp
+
+        explicit SaveGameSceneSnapshot(Scope<Data> data);
+        ~SaveGameSceneSnapshot();
+
+        SaveGameSceneSnapshot(const SaveGameSceneSnapshot&) = delete;
+        SaveGameSceneSnapshot& operator=(const SaveGameSceneSnapshot&) = delete;
+
+        [[nodiscard]] u32 GetEntityCount() const;
+
+        [[nodiscard]] Data& GetData()
+        {
+            return *m_Data;
+        }
+
+      private:
+        Scope<Data> m_Data;
+    };
+
+    // Per-entity content fingerprints of one full payload — what an incremental
+    // checkpoint is diffed against. An entity is "dirty" when the bytes of its
+    // serialized components differ from the base's, which catches every mutation,
+    // including the ones made through a GetComponent<T>() reference that no
+    // registry signal ever sees.
+    struct SaveGameCheckpoint
+    {
+        u64 CheckpointId = 0;                       // 0 = no checkpoint
+        std::unordered_map<u64, u64> RecordHashes; // entity UUID -> fingerprint of its components
+    };
+
     // Captures and restores full scene state (components + settings) to/from binary.
     // Used by SaveGameManager for saving/loading game states.
     class SaveGameSerializer
     {
       public:
-        // Capture all entity components + scene settings to binary blob
+        // Capture all entity components + scene settings to binary blob. Components
+        // are written one section per type, each section on its own task.
         static std::vector<u8> CaptureSceneState(Scene& scene);
 
+        // Copy the save-relevant state of `scene` (game thread). Returns null if an
+        // ISaveable refused to serialize.
+        static Scope<SaveGameSceneSnapshot> SnapshotSceneState(Scene& scene);
+
+        // Serialize a snapshot to the same payload CaptureSceneState would have
+        // produced at snapshot time. Any thread. When `outCheckpoint` is given it
+        // receives the per-entity fingerprints of the payload (CheckpointId is
+        // left for the caller to assign).
+        static std::vector<u8> SerializeSnapshot(SaveGameSceneSnapshot& snapshot,
+                                                 SaveGameCheckpoint* outCheckpoint = nullptr);
+
+        // Serialize only what differs from `base`: the full scene settings, the
+        // records of changed and new entities, and the UUIDs of removed ones. Any
+        // thread. `outDirtyCount` receives changed + new + removed.
+        static std::vector<u8> SerializeSnapshotIncremental(SaveGameSceneSnapshot& snapshot,
+                                                            const SaveGameCheckpoint& base,
+                                                            u32& outDirtyCount);
+
+        // Apply an incremental payload to its base payload, producing a full payload
+        // RestoreSceneState accepts. Pure byte work — no scene access — so loads can
+        // do it on a worker. Both payloads must share `formatVersion`.
+        static bool MergeIncrementalPayload(const std::vector<u8>& basePayload,
+                                            const std::vector<u8>& incrementalPayload,
+                                            std::vector<u8>& outPayload,
+                                            u32 formatVersion = kSaveGameFormatVersion);
+
+        // Rewrite a full payload in the per-entity record layout of format v19 and
+        // older, for tools that patch or inspect single entities. A payload
+        // already in that layout is copied unchanged.
+        static bool ConvertToEntityRecordLayout(const std::vector<u8>& payload, std::vector<u8>& outPayload,
+                                                u32 formatVersion = kSaveGameFormatVersion);
+
         // Clear scene and restore entities + settings from binary blob.
         // formatVersion is the FormatVersion recorded in the save's header (defaults to
         // the current version, i.e. "no gating" -- every field is assumed present, which
         // matches data produced by CaptureSceneState in this build). A caller loading an
         // on-disk .olosave should pass the header's actual FormatVersion so per-component
         // Serialize() overloads can skip fields that didn't exist yet at that version.
+        // Both the sectioned layout and the older per-entity record layout are accepted.
         static bool RestoreSceneState(Scene& scene, const std::vector<u8>& data,
                                       u32 formatVersion = kSaveGameFormatVersion);
     };
 
+    // RestoreSceneState spread over several frames. Entities are rebuilt into a
+    // staging scene a batch at a time while the live scene keeps running, and the
+    // result is swapped in by Commit() — so the live scene is either untouched or
+    // fully restored, exactly as with the one-shot call. Game thread only: the
+    // staging scene runs the usual OnComponentAdded hooks.
+    class SaveGameRestoreJob
+    {
+      public:
+        enum class EStatus : u8
+        {
+            InProgress = 0,
+            ReadyToCommit,
+            Committed,
+            Failed
+        };
+
+        // Parses the settings section. `scene` seeds the settings fields the payload
+        // does not carry and the staging viewport size; it is not modified here.
+        // The rvalue overload takes the payload over; the lvalue one only borrows
+        // it, so it must outlive the job.
+        SaveGameRestoreJob(Scene& scene, std::vector<u8>&& payload, u32 formatVersion = kSaveGameFormatVersion);
+        SaveGameRestoreJob(Scene& scene, const std::vector<u8>& payload, u32 formatVersion = kSaveGameFormatVersion);
+        ~SaveGameRestoreJob();
+
+        SaveGameRestoreJob(const SaveGameRestoreJob&) = delete;
+        SaveGameRestoreJob& operator=(const SaveGameRestoreJob&) = delete;
+
+        // Rebuild up to `maxEntities` more entities into the staging scene. For a
+        // sectioned payload the budget covers entity creation and then component
+        // attachment (one unit each); the final step decodes every component in a
+        // single parallel pass.
+        EStatus Step(u32 maxEntities);
+
+        // Swap the staged state into `scene` and apply the deferred ISaveable
+        // restores. Only valid once Step() has returned ReadyToCommit.
+        bool Commit(Scene& scene);
+
+        [[nodiscard]] EStatus GetStatus() const
+        {
+            return m_Status;
+        }
+        [[nodiscard]] u32 GetEntityCount() const
+        {
+            return m_EntityCount;
+        }
+        [[nodiscard]] u32 GetEntitiesRestored() const
+        {
+            return m_NextEntity;
+        }
+
+      private:
+        struct State;
+
+        void Begin(Scene& scene, u32 formatVersion);
+        EStatus StepSections(u32 budget);
+
+        Scope<State> m_State;
+        EStatus m_Status = EStatus::Failed;
+        u32 m_EntityCount = 0;
+        u32 m_NextEntity = 0;
+    };
+
 } // namespace OloEngine
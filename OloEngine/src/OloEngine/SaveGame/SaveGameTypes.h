@@ -73,7 +73,17 @@ namespace OloEngine
     //      m_VTSectorsWide, m_VTMaxImagePagesWide, m_VTTrilinearEnabled, m_VTCompressedCache —
     //      issue #715; v18 and older saves omit them and keep the constructor
     //      defaults, which have the adaptive path ON — the upgraded look, same as a fresh scene)
-    static constexpr u32 kSaveGameFormatVersion = 19;
+    // v20: full payloads use the sectioned layout — one section per component type
+    //      behind an entity table and a table of contents, written and decoded in
+    //      parallel. v19 and older payloads use per-entity records, which still load;
+    //      no component field changed
+    // v21: NavAgentComponent gained m_FlowFieldGroup (v20 and older saves load with
+    //      0, i.e. the agent stays on DetourCrowd)
+    // v22: PerceptionComponent gained SenseInterval (v21 and older saves load with
+    //      0, i.e. sight refreshes every tick)
+    // v23: BehaviorTreeComponent gained TickInterval (v22 and older saves load with
+    //      0, i.e. the tree ticks every frame)
+    static constexpr u32 kSaveGameFormatVersion = 23;
     static constexpr u32 kSaveGameHeaderSize = 128;
 
     // Oldest FormatVersion this build will still load. Every version from here up to
@@ -94,6 +104,12 @@ namespace OloEngine
         Zlib = 1
     };
 
+    // Header.Flags bit: the payload is an incremental checkpoint — only the entities that
+    // changed since the base save named by Header.BaseCheckpointId, plus the UUIDs removed
+    // since. It is loadable only together with that base (see SaveGameSerializer::
+    // MergeIncrementalPayload). The low byte of Flags stays the compression mode.
+    static constexpr u32 kSaveGameFlagIncremental = 1u << 8;
+
 #pragma pack(push, 1)
     struct SaveGameHeader
     {
@@ -105,7 +121,7 @@ namespace OloEngine
         u32 ChecksumCRC32 = 0; // CRC32 over everything after the header
         u32 EntityCount = 0;
 
-        // u64 block (56 bytes)
+        // u64 block (72 bytes)
         u64 MetadataOffset = 0;
         u64 MetadataSize = 0;
         u64 ThumbnailOffset = 0;
@@ -114,7 +130,14 @@ namespace OloEngine
         u64 PayloadSize = 0;             // Compressed size on disk
         u64 PayloadUncompressedSize = 0; // Original size before compression
 
-        u8 Reserved[128 - 80] = {}; // Padding to exactly 128 bytes
+        // Incremental auto-save chain. A full save that serves as a base carries its own
+        // non-zero CheckpointId; an incremental save carries the BaseCheckpointId it was
+        // diffed against. Both are zero in every other save (and in saves predating them,
+        // which wrote this range as reserved zeros).
+        u64 CheckpointId = 0;
+        u64 BaseCheckpointId = 0;
+
+        u8 Reserved[128 - 96] = {}; // Padding to exactly 128 bytes
 
         // A save is structurally valid if it carries the right magic and its FormatVersion
         // falls within the range this build knows how to read. A version below the
@@ -143,6 +166,11 @@ namespace OloEngine
         {
             Flags = (Flags & ~0xFFu) | std::to_underlying(compression);
         }
+
+        [[nodiscard]] bool IsIncremental() const
+        {
+            return (Flags & kSaveGameFlagIncremental) != 0;
+        }
     };
 #pragma pack(pop)
 
@@ -35,7 +35,7 @@
 #include "OloEngine/Terrain/TerrainStreamer.h"
 #include "OloEngine/Terrain/VirtualTexture/TerrainVirtualTexture.h"
 #include "OloEngine/Terrain/Voxel/VoxelOverride.h"
-#include "OloEngine/Terrain/Voxel/MarchingCubes.h"
+#include "OloEngine/Terrain/Voxel/MarchingCubesMeshBuilder.h"
 #include "OloEngine/Terrain/Voxel/VoxelGreedyMeshBuilder.h"
 #include "OloEngine/Terrain/Foliage/FoliageLayer.h"
 #include "OloEngine/Terrain/Foliage/FoliageRenderer.h"
@@ -4096,8 +4096,10 @@ namespace OloEngine
         // page cache. Created lazily on the first frame VT is enabled.
         OLO_SERIALIZE(Skip)
         Ref<TerrainVirtualTexture> m_VirtualTexture;
+        // Marching-cubes meshes + their in-flight task state. Only created
+        // when m_VoxelMesher == MarchingCubes.
         OLO_SERIALIZE(Skip)
-        std::unordered_map<VoxelCoord, VoxelMesh, VoxelCoordHash> m_VoxelMeshes;
+        Ref<MarchingCubesMeshBuilder> m_VoxelMeshes;
         // Packed-quad greedy meshes + their in-flight task state (issue #727).
         // Only created when m_VoxelMesher == GreedyCubic.
         OLO_SERIALIZE(Skip)
@@ -4177,7 +4179,7 @@ namespace OloEngine
                 m_Streamer = nullptr;
                 m_VoxelOverride = nullptr;
                 m_VirtualTexture = nullptr;
-                m_VoxelMeshes.clear();
+                m_VoxelMeshes = nullptr;
                 m_VoxelQuadMeshes = nullptr;
                 m_VoxelAutoSeeded = false;
                 m_NeedsRebuild = true;
@@ -4220,7 +4222,7 @@ namespace OloEngine
             {
                 m_VoxelOverride = nullptr;
                 m_VoxelQuadMeshes = nullptr;
-                m_VoxelMeshes.clear();
+                m_VoxelMeshes = nullptr;
                 m_VoxelAutoSeeded = false;
             }
         }
@@ -5233,6 +5235,10 @@ namespace OloEngine
         i32 m_AvoidancePriority = 50;
         OLO_PROPERTY()
         bool m_LockYAxis = false; // When true, navigation only moves on XZ plane
+        // 0 = DetourCrowd / path follower. Non-zero = steer by the shared flow
+        // field of that group (FlowFieldManager); for hordes heading to one goal.
+        OLO_PROPERTY()
+        u32 m_FlowFieldGroup = 0;
 
         // Runtime state (not serialized)
         OLO_PROPERTY(Name = "TargetPosition", Type = "vec3", Set = "comp.m_TargetPosition = {v}; comp.m_HasTarget = true; comp.m_HasPath = false; comp.m_TargetUnreachable = false")
@@ -5248,6 +5254,9 @@ namespace OloEngine
         u32 m_CurrentCornerIndex = 0;
         OLO_SERIALIZE(Skip)
         i32 m_CrowdAgentId = -1;
+        // Outstanding PathRequestService ticket (manual follower only); 0 = none.
+        OLO_SERIALIZE(Skip)
+        u32 m_PathRequest = 0;
         // Set by NavigationSystem when the current target can only be reached partially
         // (unreachable / off-navmesh / disconnected). Terminal signal for consumers so
         // they stop re-issuing an impossible target — see BTMoveTo and NavAgentComponent_IsTargetUnreachable.
@@ -5258,7 +5267,8 @@ namespace OloEngine
         NavAgentComponent(const NavAgentComponent& other)
             : m_Radius(other.m_Radius), m_Height(other.m_Height), m_MaxSpeed(other.m_MaxSpeed),
               m_Acceleration(other.m_Acceleration), m_StoppingDistance(other.m_StoppingDistance),
-              m_AvoidancePriority(other.m_AvoidancePriority), m_LockYAxis(other.m_LockYAxis)
+              m_AvoidancePriority(other.m_AvoidancePriority), m_LockYAxis(other.m_LockYAxis),
+              m_FlowFieldGroup(other.m_FlowFieldGroup)
         {
         }
         NavAgentComponent& operator=(const NavAgentComponent& other)
@@ -5272,12 +5282,14 @@ namespace OloEngine
                 m_StoppingDistance = other.m_StoppingDistance;
                 m_AvoidancePriority = other.m_AvoidancePriority;
                 m_LockYAxis = other.m_LockYAxis;
+                m_FlowFieldGroup = other.m_FlowFieldGroup;
                 m_TargetPosition = {};
                 m_HasTarget = false;
                 m_HasPath = false;
                 m_PathCorners.clear();
                 m_CurrentCornerIndex = 0;
                 m_CrowdAgentId = -1;
+                m_PathRequest = 0;
                 m_TargetUnreachable = false;
             }
             return *this;
@@ -5285,7 +5297,8 @@ namespace OloEngine
         NavAgentComponent(NavAgentComponent&& other) noexcept
             : m_Radius(other.m_Radius), m_Height(other.m_Height), m_MaxSpeed(other.m_MaxSpeed),
               m_Acceleration(other.m_Acceleration), m_StoppingDistance(other.m_StoppingDistance),
-              m_AvoidancePriority(other.m_AvoidancePriority), m_LockYAxis(other.m_LockYAxis)
+              m_AvoidancePriority(other.m_AvoidancePriority), m_LockYAxis(other.m_LockYAxis),
+              m_FlowFieldGroup(other.m_FlowFieldGroup)
         {
         }
         NavAgentComponent& operator=(NavAgentComponent&& other) noexcept
@@ -5299,12 +5312,14 @@ namespace OloEngine
                 m_StoppingDistance = other.m_StoppingDistance;
                 m_AvoidancePriority = other.m_AvoidancePriority;
                 m_LockYAxis = other.m_LockYAxis;
+                m_FlowFieldGroup = other.m_FlowFieldGroup;
                 m_TargetPosition = {};
                 m_HasTarget = false;
                 m_HasPath = false;
                 m_PathCorners.clear();
                 m_CurrentCornerIndex = 0;
                 m_CrowdAgentId = -1;
+                m_PathRequest = 0;
                 m_TargetUnreachable = false;
             }
             return *this;
@@ -5314,7 +5329,7 @@ namespace OloEngine
         // intentionally excluded (it's path-finder-managed, not authoring-visible).
         auto operator==(const NavAgentComponent& other) const -> bool
         {
-            return Math::BitwiseEqual(m_Radius, other.m_Radius) && Math::BitwiseEqual(m_Height, other.m_Height) && Math::BitwiseEqual(m_MaxSpeed, other.m_MaxSpeed) && Math::BitwiseEqual(m_Acceleration, other.m_Acceleration) && Math::BitwiseEqual(m_StoppingDistance, other.m_StoppingDistance) && m_AvoidancePriority == other.m_AvoidancePriority && m_LockYAxis == other.m_LockYAxis;
+            return Math::BitwiseEqual(m_Radius, other.m_Radius) && Math::BitwiseEqual(m_Height, other.m_Height) && Math::BitwiseEqual(m_MaxSpeed, other.m_MaxSpeed) && Math::BitwiseEqual(m_Acceleration, other.m_Acceleration) && Math::BitwiseEqual(m_StoppingDistance, other.m_StoppingDistance) && m_AvoidancePriority == other.m_AvoidancePriority && m_LockYAxis == other.m_LockYAxis && m_FlowFieldGroup == other.m_FlowFieldGroup;
         }
     };
 
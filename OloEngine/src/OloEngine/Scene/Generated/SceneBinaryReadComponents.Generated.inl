@@ -520,6 +520,7 @@ case 558863490u: // NavAgentComponent
     comp.m_StoppingDistance = std::clamp(comp.m_StoppingDistance, static_cast<f32>(0.0f), static_cast<f32>(100.0f));
     if (!SceneBinIO::Read(reader, comp.m_AvoidancePriority)) return false;
     if (!SceneBinIO::Read(reader, comp.m_LockYAxis)) return false;
+    if (!SceneBinIO::Read(reader, comp.m_FlowFieldGroup)) return false;
     break;
 }
 case 2269942102u: // NetworkIdentityComponent
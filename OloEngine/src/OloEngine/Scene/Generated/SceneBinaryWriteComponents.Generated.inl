@@ -407,6 +407,7 @@ if (entity.HasComponent<NavAgentComponent>())
     SceneBinIO::Write(out, comp.m_StoppingDistance);
     SceneBinIO::Write(out, comp.m_AvoidancePriority);
     SceneBinIO::Write(out, comp.m_LockYAxis);
+    SceneBinIO::Write(out, comp.m_FlowFieldGroup);
 }
 
 if (entity.HasComponent<NetworkIdentityComponent>())
@@ -549,6 +549,7 @@ if (auto node = entity["NavAgentComponent"]; node)
         comp.m_StoppingDistance = std::clamp(v, static_cast<f32>(0.0f), static_cast<f32>(100.0f));
     comp.m_AvoidancePriority = node["AvoidancePriority"].as<i32>(comp.m_AvoidancePriority);
     comp.m_LockYAxis = node["LockYAxis"].as<bool>(comp.m_LockYAxis);
+    comp.m_FlowFieldGroup = node["FlowFieldGroup"].as<u32>(comp.m_FlowFieldGroup);
 }
 
 if (auto node = entity["NetworkIdentityComponent"]; node)
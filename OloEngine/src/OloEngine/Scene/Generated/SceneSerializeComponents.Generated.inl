@@ -474,6 +474,7 @@ if (entity.HasComponent<NavAgentComponent>())
     out << YAML::Key << "StoppingDistance" << YAML::Value << comp.m_StoppingDistance;
     out << YAML::Key << "AvoidancePriority" << YAML::Value << comp.m_AvoidancePriority;
     out << YAML::Key << "LockYAxis" << YAML::Value << comp.m_LockYAxis;
+    out << YAML::Key << "FlowFieldGroup" << YAML::Value << comp.m_FlowFieldGroup;
     out << YAML::EndMap; // NavAgentComponent
 }
 
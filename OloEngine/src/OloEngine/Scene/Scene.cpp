@@ -102,7 +102,7 @@
 #include "OloEngine/Scene/Streaming/SceneStreamer.h"
 #include "OloEngine/Scene/Streaming/StreamingVolumeComponent.h"
 #include "OloEngine/Terrain/Voxel/VoxelOverride.h"
-#include "OloEngine/Terrain/Voxel/MarchingCubes.h"
+#include "OloEngine/Terrain/Voxel/MarchingCubesMeshBuilder.h"
 #include "OloEngine/Terrain/Voxel/VoxelGreedyMeshBuilder.h"
 #include "OloEngine/Core/Input.h"
 #include "OloEngine/Core/MouseCodes.h"
@@ -332,7 +332,8 @@ namespace OloEngine
     Scene::Scene()
         : m_JoltScene(std::make_unique<JoltScene>(this)), m_GameplayEventBus(std::make_unique<GameplayEventBus>()),
           m_UINavigation(std::make_unique<UINavigation>()),
-          m_FlockingWorkspace(std::make_unique<FlockingWorkspace>())
+          m_FlockingWorkspace(std::make_unique<FlockingWorkspace>()),
+          m_PerceptionWorkspace(std::make_unique<PerceptionWorkspace>())
     {
         // Pre-create every EnTT storage/group the Parallelizable gameplay systems
         // (issue #453: Abilities, Audio) touch, on the constructing thread. EnTT's
@@ -834,6 +835,8 @@ namespace OloEngine
                 navAgent.m_CrowdAgentId = -1;
             }
         }
+        if (m_PathRequestService && entity.HasComponent<NavAgentComponent>())
+            m_PathRequestService->Cancel(entity.GetComponent<NavAgentComponent>().m_PathRequest);
 
         m_Registry.destroy(entity);
         m_EntityMap.Remove(entityUUID);
@@ -1636,8 +1639,7 @@ namespace OloEngine
             links.insert(links.end(), bounds.m_Links.begin(), bounds.m_Links.end());
         }
 
-        NavMeshSettings settings;
-        auto navMesh = NavMeshGenerator::Generate(this, settings, boundsMin, boundsMax, links);
+        auto navMesh = NavMeshGenerator::Generate(this, m_NavMeshBakeSettings, boundsMin, boundsMax, links);
         if (!navMesh)
             return false;
 
@@ -1922,11 +1924,15 @@ namespace OloEngine
             m_NavMeshQuery = std::make_unique<NavMeshQuery>(navMesh);
             m_CrowdManager = std::make_unique<CrowdManager>();
             m_CrowdManager->Initialize(navMesh);
+            m_PathRequestService = std::make_unique<PathRequestService>(navMesh);
+            m_FlowFieldManager = std::make_unique<FlowFieldManager>(navMesh);
         }
         else
         {
             m_NavMeshQuery.reset();
             m_CrowdManager.reset();
+            m_PathRequestService.reset();
+            m_FlowFieldManager.reset();
         }
 
         // Reset per-agent runtime state so no entity keeps stale IDs or paths
@@ -1935,6 +1941,7 @@ namespace OloEngine
         {
             auto& agent = m_Registry.get<NavAgentComponent>(e);
             agent.m_CrowdAgentId = -1;
+            agent.m_PathRequest = 0;
             agent.m_HasTarget = false;
             agent.m_HasPath = false;
             agent.m_PathCorners.clear();
@@ -1942,6 +1949,30 @@ namespace OloEngine
         }
     }
 
+    void Scene::MarkNavMeshDirty(const glm::vec3& boundsMin, const glm::vec3& boundsMax)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        if (m_NavMesh && m_NavMesh->GetTileBuilder())
+            m_NavMesh->GetTileBuilder()->MarkDirty(boundsMin, boundsMax);
+    }
+
+    u32 Scene::AddNavMeshObstacle(const glm::vec3& position, f32 radius, f32 height)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        if (!m_NavMesh || !m_NavMesh->GetTileBuilder())
+            return 0;
+        return m_NavMesh->GetTileBuilder()->AddObstacle({ position, radius, height });
+    }
+
+    bool Scene::RemoveNavMeshObstacle(u32 obstacle)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        return m_NavMesh && m_NavMesh->GetTileBuilder() && m_NavMesh->GetTileBuilder()->RemoveObstacle(obstacle);
+    }
+
     // Process sub-emitter triggers that reference child systems.
     // For triggers with a valid ChildSystemIndex, emit into the corresponding child system's pool.
     static void ProcessChildSubEmitters(ParticleSystemComponent& psc, f32 dt, const glm::vec3& emitterPos)
@@ -3241,12 +3272,15 @@ namespace OloEngine
                 .Reads(kLocalTransforms)
                 .Writes(kSpatialIndex);
 
-            // Perception queries the spatial index and publishes sight results.
-            // (Its line-of-sight raycasts also require the world step complete —
-            // guaranteed transitively: SpatialIndex reads transforms written by
-            // the fence.)
+            // Perception packs its own grid over the perceptibles from the
+            // same transforms and publishes sight results. It keeps its edge on
+            // SpatialIndex so it still runs after the index every other query
+            // consumer sees. (Its batched line-of-sight raycasts also require
+            // the world step complete — guaranteed transitively: the transforms
+            // it reads were written after the fence.)
             sched.AddSystem("Perception", [](Scene& s, Timestep ts)
                             { s.UpdatePerception(ts); })
+                .Reads(kLocalTransforms)
                 .Reads(kSpatialIndex)
                 .Writes(kPerception);
 
@@ -3866,10 +3900,10 @@ namespace OloEngine
     void Scene::UpdatePerception(Timestep ts)
     {
         // Refresh AI sight perception before AI decisions so behavior trees /
-        // FSMs / GOAP see fresh sensor data the same frame. Uses the spatial
-        // index above for an O(local) proximity query instead of an O(n)
-        // scan over every perceptible entity.
-        PerceptionSystem::OnUpdate(this, ts.GetSeconds());
+        // FSMs / GOAP see fresh sensor data the same frame. Candidates come
+        // from the workspace's own grid over the packed perceptibles rather
+        // than the general spatial index, so no per-candidate UUID lookup.
+        PerceptionSystem::OnUpdate(this, *m_PerceptionWorkspace, ts.GetSeconds());
     }
 
     void Scene::UpdateAI(Timestep ts)
@@ -4825,6 +4859,47 @@ namespace OloEngine
     {
     }
 
+    // A static body coming or going changes the walkable geometry under it;
+    // mark the tiles its colliders can reach (a rotation-proof sphere around
+    // the entity). Dynamic bodies move every frame — those are obstacles, not
+    // navmesh geometry worth rebuilding for.
+    static void MarkNavMeshDirtyForStaticBody(Scene& scene, Entity entity, const Rigidbody3DComponent& body)
+    {
+        if (body.m_Type != BodyType3D::Static || !entity.HasComponent<TransformComponent>())
+            return;
+
+        f32 reach = 0.0f;
+        if (entity.HasComponent<BoxCollider3DComponent>())
+        {
+            const auto& box = entity.GetComponent<BoxCollider3DComponent>();
+            reach = std::max(reach, glm::length(box.m_HalfExtents) + glm::length(box.m_Offset));
+        }
+        if (entity.HasComponent<SphereCollider3DComponent>())
+        {
+            const auto& sphere = entity.GetComponent<SphereCollider3DComponent>();
+            reach = std::max(reach, sphere.m_Radius + glm::length(sphere.m_Offset));
+        }
+        if (entity.HasComponent<CapsuleCollider3DComponent>())
+        {
+            const auto& capsule = entity.GetComponent<CapsuleCollider3DComponent>();
+            reach = std::max(reach, capsule.m_Radius + capsule.m_HalfHeight + glm::length(capsule.m_Offset));
+        }
+        if (entity.HasComponent<MeshCollider3DComponent>())
+        {
+            // Cooked bounds aren't at hand here; the collider scale is the best
+            // cheap proxy for a unit-sized source mesh.
+            const auto& mesh = entity.GetComponent<MeshCollider3DComponent>();
+            reach = std::max(reach, glm::length(mesh.m_Scale) + glm::length(mesh.m_Offset));
+        }
+        if (reach <= 0.0f)
+            return;
+
+        const auto& tc = entity.GetComponent<TransformComponent>();
+        const glm::vec3 scale = glm::abs(tc.Scale);
+        const glm::vec3 extent(reach * std::max({ scale.x, scale.y, scale.z }));
+        scene.MarkNavMeshDirty(tc.Translation - extent, tc.Translation + extent);
+    }
+
     template<>
     void Scene::OnComponentAdded<Rigidbody3DComponent>(Entity entity, Rigidbody3DComponent& component)
     {
@@ -4843,6 +4918,8 @@ namespace OloEngine
                 component.m_RuntimeBodyToken = static_cast<u64>(body->GetBodyID().GetIndexAndSequenceNumber());
             }
         }
+
+        MarkNavMeshDirtyForStaticBody(*this, entity, component);
     }
 
     // Specialisation: when a Rigidbody3DComponent is removed at runtime, the
@@ -4871,6 +4948,8 @@ namespace OloEngine
             m_JoltScene->DestroyBody(entity);
             component.m_RuntimeBodyToken = 0;
         }
+
+        MarkNavMeshDirtyForStaticBody(*this, entity, component);
     }
 
     // Specialisation: when a TerrainComponent is detached at runtime, release the
@@ -4906,6 +4985,11 @@ namespace OloEngine
             m_CrowdManager->RemoveAgent(component.m_CrowdAgentId);
             component.m_CrowdAgentId = -1;
         }
+        if (m_PathRequestService && component.m_PathRequest != 0)
+        {
+            m_PathRequestService->Cancel(component.m_PathRequest);
+            component.m_PathRequest = 0;
+        }
     }
 
     template<>
@@ -6834,7 +6918,7 @@ namespace OloEngine
     // subsystem has produced came from two paths that were supposed to agree and quietly did
     // not (issue #629); this one is not going to be the next.
     static void SubmitMeshSourceClassic(const Ref<MeshSource>& meshSource, const glm::mat4& worldTransform,
-                                        const Material* overrideMaterial, i32 entityID,
+                                        const Material* overrideMaterial, i32 entityID, u64 entityUUID,
                                         const LODGroup* lodGroup, bool meshHasActiveShadows,
                                         const glm::vec4& lightmapScaleOffset = glm::vec4(0.0f))
     {
@@ -6858,7 +6942,19 @@ namespace OloEngine
                 {
                     packet->GetCommandData<DrawMeshCommand>()->lightmapScaleOffset = lightmapScaleOffset;
                 }
-                Renderer3D::SubmitPacket(packet);
+
+                // Entity draws may be retained across frames
+                // (RendererSettings::RetainedStaticDraws). They are keyed by
+                // UUID: the registry handle is recycled when an entity is
+                // destroyed and another created.
+                if (entityUUID != 0)
+                {
+                    Renderer3D::SubmitStaticPacket({ entityUUID, static_cast<u32>(i) }, packet);
+                }
+                else
+                {
+                    Renderer3D::SubmitPacket(packet);
+                }
             }
 
             // Shadow caster for this submesh. Alpha-masked / blended materials are excluded
@@ -6886,6 +6982,7 @@ namespace OloEngine
                                           f32 cameraNearClip, f32 cameraFarClip)
     {
         OLO_PROFILE_FUNCTION();
+        OLO_PERF_SCOPE_AUTO("Scene::ProcessScene3DSharedLogic");
 
         glm::mat4 viewProjection = projectionMatrix * viewMatrix;
 
@@ -8085,7 +8182,7 @@ namespace OloEngine
                         terrain.m_VoxelQuadMeshes->Update(*terrain.m_VoxelOverride);
                         // Marching-cubes meshes from a previous selection would
                         // otherwise keep drawing underneath the cubic ones.
-                        terrain.m_VoxelMeshes.clear();
+                        terrain.m_VoxelMeshes = nullptr;
                     }
                     else
                     {
@@ -8101,11 +8198,25 @@ namespace OloEngine
                         {
                             terrain.m_VoxelOverride->GetChunks().clear();
                             terrain.m_VoxelAutoSeeded = false;
-                            terrain.m_VoxelMeshes.clear();
+                            terrain.m_VoxelMeshes = nullptr;
                         }
 
-                        // Rebuild dirty voxel meshes on main thread
-                        MarchingCubes::RebuildDirtyMeshes(*terrain.m_VoxelOverride, terrain.m_VoxelMeshes);
+                        // Same contract as the cubic path: chunks are snapshotted
+                        // here and polygonized on workers, nearest the (culling)
+                        // camera first, so a dig remeshes where the player looks.
+                        if (!terrain.m_VoxelMeshes)
+                        {
+                            terrain.m_VoxelMeshes = Ref<MarchingCubesMeshBuilder>::Create();
+                            // A fresh builder owns no meshes, and chunks the cubic
+                            // path already meshed are no longer flagged dirty.
+                            for (auto& [coord, chunk] : terrain.m_VoxelOverride->GetChunks())
+                            {
+                                chunk.Dirty = true;
+                            }
+                        }
+                        const glm::vec3 voxelCameraPos = MakeObjectLocalCameraPos(
+                            cullCameraPosition, terrainView.get<TransformComponent>(entity).GetTransform(), glm::vec3(0.0f));
+                        terrain.m_VoxelMeshes->Update(*terrain.m_VoxelOverride, voxelCameraPos);
                         terrain.m_VoxelQuadMeshes = nullptr;
                     }
                 }
@@ -8523,9 +8634,9 @@ namespace OloEngine
                     } // if (terrainShader)
 
                     // Submit voxel mesh command packets
-                    if (terrain.m_VoxelEnabled && !terrain.m_VoxelMeshes.empty() && voxelShader)
+                    if (terrain.m_VoxelEnabled && terrain.m_VoxelMeshes && voxelShader)
                     {
-                        for (const auto& [coord, mesh] : terrain.m_VoxelMeshes)
+                        for (const auto& [coord, mesh] : terrain.m_VoxelMeshes->GetMeshes())
                         {
                             if (mesh.VAO && mesh.IndexCount > 0)
                             {
@@ -9457,8 +9568,11 @@ namespace OloEngine
 
                 // Draw each submesh with entity ID. Shared with the VirtualMeshComponent
                 // fallback path — see SubmitMeshSourceClassic.
-                SubmitMeshSourceClassic(mesh.m_MeshSource, worldTransform, overrideMaterial, entityID, lodGroup,
-                                        meshHasActiveShadows, lightmapScaleOffset);
+                const u64 entityUUID = m_Registry.all_of<IDComponent>(entity)
+                                           ? static_cast<u64>(m_Registry.get<IDComponent>(entity).ID)
+                                           : 0;
+                SubmitMeshSourceClassic(mesh.m_MeshSource, worldTransform, overrideMaterial, entityID, entityUUID,
+                                        lodGroup, meshHasActiveShadows, lightmapScaleOffset);
             }
         }
 
@@ -9541,7 +9655,10 @@ namespace OloEngine
                 // difference is the renderer. That is what makes the toggle a usable A/B.
                 if (!virtualGeometryEnabled)
                 {
-                    SubmitMeshSourceClassic(meshSource, worldTransform, overrideMaterial, entityID,
+                    const u64 entityUUID = m_Registry.all_of<IDComponent>(entity)
+                                               ? static_cast<u64>(m_Registry.get<IDComponent>(entity).ID)
+                                               : 0;
+                    SubmitMeshSourceClassic(meshSource, worldTransform, overrideMaterial, entityID, entityUUID,
                                             /*lodGroup*/ nullptr,
                                             meshHasActiveShadows && virtualMesh.m_CastShadows);
                     continue;
@@ -9562,6 +9679,10 @@ namespace OloEngine
                 {
                     ++vgDiagnostics.Submitted;
                 }
+                else if (VirtualMeshRegistry::Get().IsBuildPending(virtualMesh.m_MeshSource))
+                {
+                    ++vgDiagnostics.PendingBuilds;
+                }
                 else
                 {
                     ++vgDiagnostics.RegistrationFailures;
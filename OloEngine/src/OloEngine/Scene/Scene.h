@@ -16,6 +16,8 @@
 #include "OloEngine/Navigation/NavMesh.h"
 #include "OloEngine/Navigation/NavMeshQuery.h"
 #include "OloEngine/Navigation/CrowdManager.h"
+#include "OloEngine/Navigation/FlowFieldManager.h"
+#include "OloEngine/Navigation/PathRequestService.h"
 
 #include <limits>
 #include <mutex>
@@ -57,6 +59,7 @@ namespace OloEngine
     class UINavigation;
     class SystemScheduler;
     struct FlockingWorkspace;
+    struct PerceptionWorkspace;
 
     namespace VisualScript
     {
@@ -807,6 +810,28 @@ namespace OloEngine
         // the OnRuntimeStart auto-bake and the floating-origin rebake path.
         bool BakeNavMesh();
 
+        // Settings BakeNavMesh bakes with. TileSize > 0 makes the bake tiled,
+        // which is what the runtime rebuild/obstacle calls below need.
+        void SetNavMeshBakeSettings(const NavMeshSettings& settings)
+        {
+            m_NavMeshBakeSettings = settings;
+        }
+        [[nodiscard]] const NavMeshSettings& GetNavMeshBakeSettings() const
+        {
+            return m_NavMeshBakeSettings;
+        }
+
+        // Runtime changes to a tiled navmesh. Only the touched tiles rebuild, off
+        // the game thread; NavigationSystem swaps them in before the crowd
+        // update. No-ops (0 / false) on a solo mesh or with no navmesh.
+        //   MarkNavMeshDirty: walkable geometry in the box changed (destructible
+        //     broke, static body added/removed) — re-rasterise those tiles.
+        //   Add/RemoveNavMeshObstacle: a temporary upright cylinder standing on
+        //     `position`, carved without re-rasterising.
+        void MarkNavMeshDirty(const glm::vec3& boundsMin, const glm::vec3& boundsMax);
+        u32 AddNavMeshObstacle(const glm::vec3& position, f32 radius, f32 height);
+        bool RemoveNavMeshObstacle(u32 obstacle);
+
         // Floating-origin rebase (issue #613): keep a live navmesh + crowd
         // consistent across an origin shift. Detour cannot be translated in place,
         // so this shifts the bake inputs (NavMeshBoundsComponent boxes / links) and
@@ -827,6 +852,16 @@ namespace OloEngine
         {
             return m_CrowdManager.get();
         }
+        // Time-sliced FindPath for agents outside the crowd (NavigationSystem).
+        [[nodiscard]] PathRequestService* GetPathRequestService()
+        {
+            return m_PathRequestService.get();
+        }
+        // Shared flow fields for agents with a non-zero m_FlowFieldGroup.
+        [[nodiscard]] FlowFieldManager* GetFlowFieldManager()
+        {
+            return m_FlowFieldManager.get();
+        }
 
         // Spatial acceleration — a uniform grid over every entity's
         // TransformComponent position, rebuilt once per runtime tick (inside
@@ -1258,8 +1293,11 @@ namespace OloEngine
 
         // Navigation
         Ref<NavMesh> m_NavMesh;
+        NavMeshSettings m_NavMeshBakeSettings;
         std::unique_ptr<NavMeshQuery> m_NavMeshQuery;
         std::unique_ptr<CrowdManager> m_CrowdManager;
+        std::unique_ptr<PathRequestService> m_PathRequestService;
+        std::unique_ptr<FlowFieldManager> m_FlowFieldManager;
 
         // Spatial acceleration (runtime-only; rebuilt each OnUpdateRuntime tick,
         // never serialized/copied). See GetSpatialIndex / UpdateSpatialIndex.
@@ -1274,6 +1312,11 @@ namespace OloEngine
         // Scene.cpp where the type is complete.
         std::unique_ptr<FlockingWorkspace> m_FlockingWorkspace;
 
+        // Perception scratch — the packed perceptible cache, per-worker
+        // candidate buffers and the line-of-sight ray batch. Runtime-only and
+        // behind a pointer for the same reasons as m_FlockingWorkspace.
+        std::unique_ptr<PerceptionWorkspace> m_PerceptionWorkspace;
+
         // Scratch buffers for PropagateWorldTransforms (issue #499) — persistent
         // across ticks and .clear()ed at the top of each call instead of being
         // reconstructed/reserved from scratch, so the flat BFS sweep doesn't
@@ -1377,5 +1420,6 @@ namespace OloEngine
         friend class LightProbeBaker;
         friend class ReflectionProbeBaker;
         friend class SaveGameSerializer;
+        friend class SaveGameRestoreJob;
     };
 } // namespace OloEngine
@@ -68,13 +68,14 @@ namespace OloEngine
         // subsequent read in that entity would slide. The bounds and finiteness
         // checks would probably catch it, and "probably" is the wrong bar for a
         // cache that is invisible when it works.
+        // v3: NavAgentComponent gained m_FlowFieldGroup, same story.
         //
         // MinSupportedVersion moves WITH CurrentVersion, on purpose and unlike a
         // save game: a sidecar is a derived cache, so rejecting the old one
         // costs one YAML load and a rewrite, where migrating it would mean
         // keeping every past component layout compilable forever.
-        constexpr u32 CurrentVersion = 2;
-        constexpr u32 MinSupportedVersion = 2;
+        constexpr u32 CurrentVersion = 3;
+        constexpr u32 MinSupportedVersion = 3;
 
         // Per-entity storage kind (the u8 that prefixes each EntityRecord).
         enum EntityKind : u8
@@ -4,6 +4,7 @@
 #include "OloEngine/Animation/AnimatedMeshComponents.h"
 #include "OloEngine/Asset/AssetManager.h"
 #include "OloEngine/Core/Hash.h"
+#include "OloEngine/Renderer/Baking/LightmapBaker.h"
 #include "OloEngine/Renderer/Baking/LightmapUnwrap.h"
 #include "OloEngine/Renderer/LightmapAsset.h"
 #include "OloEngine/Renderer/MeshSource.h"
@@ -14,6 +15,8 @@
 #include "OloEngine/Scene/Scene.h"
 
 #include <algorithm>
+#include <cmath>
+#include <limits>
 #include <vector>
 
 namespace OloEngine
@@ -53,6 +56,140 @@ namespace OloEngine
             hasher.Mix(material.GetMetallicFactor());
             hasher.Mix(material.GetRoughnessFactor());
         }
+
+        struct KeyedEntity
+        {
+            u64 Uuid;
+            entt::entity Handle;
+        };
+
+        // Every lightmap-static entity with a mesh, in UUID order — registry
+        // iteration order is not a contract, the key must be.
+        std::vector<KeyedEntity> GatherStaticEntities(Scene& scene)
+        {
+            std::vector<KeyedEntity> staticEntities;
+            auto meshView = scene.GetAllEntitiesWith<IDComponent, MeshComponent>();
+            for (auto entity : meshView)
+            {
+                const auto& mesh = meshView.get<MeshComponent>(entity);
+                if (!mesh.m_LightmapStatic || !mesh.m_MeshSource)
+                    continue;
+                staticEntities.push_back({ static_cast<u64>(meshView.get<IDComponent>(entity).ID), entity });
+            }
+            std::sort(staticEntities.begin(), staticEntities.end(),
+                      [](const KeyedEntity& a, const KeyedEntity& b)
+                      { return a.Uuid < b.Uuid; });
+            return staticEntities;
+        }
+
+        void MixStaticEntity(BakeKeyHasher& hasher, Scene& scene, const KeyedEntity& keyed, const Material& defaultMaterial)
+        {
+            Entity entity{ keyed.Handle, &scene };
+            const Ref<MeshSource>& source = entity.GetComponent<MeshComponent>().m_MeshSource;
+
+            hasher.Mix(keyed.Uuid);
+            hasher.Mix(static_cast<u64>(source->GetHandle()));
+
+            // Geometry proxy: counts + bounds. A vertex-level edit that keeps
+            // both identical slips through — accepted; a full position hash per
+            // scene load is not worth that marginal coverage.
+            hasher.Mix(source->GetVertices().Num());
+            hasher.Mix(source->GetIndices().Num());
+            const auto& bounds = source->GetBoundingBox();
+            hasher.Mix(bounds.Min);
+            hasher.Mix(bounds.Max);
+
+            hasher.Mix(scene.GetWorldTransform(keyed.Handle));
+
+            const Material* overrideMaterial = nullptr;
+            if (entity.HasComponent<MaterialComponent>())
+                overrideMaterial = &entity.GetComponent<MaterialComponent>().m_Material;
+            const auto& submeshes = source->GetSubmeshes();
+            for (i32 s = 0; s < submeshes.Num(); ++s)
+            {
+                MixMaterial(hasher, ResolveSubmeshMaterial(overrideMaterial, source.get(),
+                                                           static_cast<u32>(s), defaultMaterial));
+            }
+        }
+
+        // Visits every light of one type in UUID order.
+        template<typename View, typename Visitor>
+        void ForEachLightOfType(View view, Visitor&& visit)
+        {
+            std::vector<KeyedEntity> lights;
+            for (auto entity : view)
+                lights.push_back({ static_cast<u64>(view.template get<IDComponent>(entity).ID), entity });
+            std::sort(lights.begin(), lights.end(),
+                      [](const KeyedEntity& a, const KeyedEntity& b)
+                      { return a.Uuid < b.Uuid; });
+            for (const auto& keyed : lights)
+                visit(view, keyed);
+        }
+
+        // Lights: hash EXACTLY what the bake consumes, per type, in the order
+        // ReferenceSceneBuilder::AddScene gathers them. Two deliberate parity
+        // choices, both mirrored from the builder:
+        //  - positions are the RAW TransformComponent::Translation (the value
+        //    the raster light collection packs — NOT the parent-composed world
+        //    transform), so re-parenting a light under a moved parent neither
+        //    stales nor un-stales a bake the light never changed in;
+        //  - a light the builder rejects (`!(intensity > 0)` — zero, negative
+        //    or NaN) contributes nothing to the bake, so it contributes
+        //    nothing to the key either.
+        // A per-type tag keeps e.g. a point light and a spot light with
+        // coincidentally-equal field bytes from colliding. Each returns false
+        // for a light the bake ignores.
+        bool MixDirectionalLight(BakeKeyHasher& hasher, u64 uuid, const DirectionalLightComponent& l)
+        {
+            if (!(l.m_Intensity > 0.0f))
+                return false; // invisible to the bake ⇒ invisible to the key
+            hasher.Mix(1u);
+            hasher.Mix(uuid);
+            hasher.Mix(l.m_Direction);
+            hasher.Mix(l.m_Color);
+            hasher.Mix(l.m_Intensity);
+            return true;
+        }
+
+        bool MixPointLight(BakeKeyHasher& hasher, u64 uuid, const glm::vec3& translation, const PointLightComponent& l)
+        {
+            if (!(l.m_Intensity > 0.0f))
+                return false;
+            hasher.Mix(2u);
+            hasher.Mix(uuid);
+            hasher.Mix(translation);
+            hasher.Mix(l.m_Color);
+            hasher.Mix(l.m_Intensity);
+            hasher.Mix(l.m_Range);
+            hasher.Mix(l.m_Attenuation);
+            return true;
+        }
+
+        bool MixSpotLight(BakeKeyHasher& hasher, u64 uuid, const glm::vec3& translation, const SpotLightComponent& l)
+        {
+            if (!(l.m_Intensity > 0.0f))
+                return false;
+            hasher.Mix(3u);
+            hasher.Mix(uuid);
+            hasher.Mix(translation);
+            hasher.Mix(l.m_Direction);
+            hasher.Mix(l.m_Color);
+            hasher.Mix(l.m_Intensity);
+            hasher.Mix(l.m_Range);
+            hasher.Mix(l.m_InnerCutoff);
+            hasher.Mix(l.m_OuterCutoff);
+            hasher.Mix(l.m_Attenuation);
+            return true;
+        }
+
+        // A light's reach for incremental re-bakes: the box around its range
+        // (CalculateAttenuation is zero beyond it), or everywhere.
+        BoundingBox LightReach(const glm::vec3& translation, f32 range)
+        {
+            if (!(range > 0.0f) || !std::isfinite(range))
+                return BoundingBox(glm::vec3(-std::numeric_limits<f32>::max()), glm::vec3(std::numeric_limits<f32>::max()));
+            return BoundingBox(translation - glm::vec3(range), translation + glm::vec3(range));
+        }
     } // namespace
 
     void SceneLightmapRuntime::Invalidate()
@@ -259,126 +396,68 @@ namespace OloEngine
         hasher.Mix(settings.MaxBounces);
         hasher.Mix(settings.TexelsPerMeter);
 
-        // Deterministic visit order: gather then sort by UUID — registry
-        // iteration order is not a contract, the key must be.
-        struct KeyedEntity
-        {
-            u64 Uuid;
-            entt::entity Handle;
-        };
-        std::vector<KeyedEntity> staticEntities;
-
-        auto meshView = scene.GetAllEntitiesWith<IDComponent, MeshComponent>();
-        for (auto entity : meshView)
-        {
-            const auto& mesh = meshView.get<MeshComponent>(entity);
-            if (!mesh.m_LightmapStatic || !mesh.m_MeshSource)
-                continue;
-            staticEntities.push_back({ static_cast<u64>(meshView.get<IDComponent>(entity).ID), entity });
-        }
-        std::sort(staticEntities.begin(), staticEntities.end(),
-                  [](const KeyedEntity& a, const KeyedEntity& b)
-                  { return a.Uuid < b.Uuid; });
-
         const Material defaultMaterial{};
-        for (const auto& keyed : staticEntities)
-        {
-            const auto& mesh = meshView.get<MeshComponent>(keyed.Handle);
-            const Ref<MeshSource>& source = mesh.m_MeshSource;
+        for (const auto& keyed : GatherStaticEntities(scene))
+            MixStaticEntity(hasher, scene, keyed, defaultMaterial);
+
+        ForEachLightOfType(scene.GetAllEntitiesWith<IDComponent, TransformComponent, DirectionalLightComponent>(),
+                           [&](auto& view, const KeyedEntity& keyed)
+                           { (void)MixDirectionalLight(hasher, keyed.Uuid, view.template get<DirectionalLightComponent>(keyed.Handle)); });
+        ForEachLightOfType(scene.GetAllEntitiesWith<IDComponent, TransformComponent, PointLightComponent>(),
+                           [&](auto& view, const KeyedEntity& keyed)
+                           { (void)MixPointLight(hasher, keyed.Uuid, view.template get<TransformComponent>(keyed.Handle).Translation,
+                                                 view.template get<PointLightComponent>(keyed.Handle)); });
+        ForEachLightOfType(scene.GetAllEntitiesWith<IDComponent, TransformComponent, SpotLightComponent>(),
+                           [&](auto& view, const KeyedEntity& keyed)
+                           { (void)MixSpotLight(hasher, keyed.Uuid, view.template get<TransformComponent>(keyed.Handle).Translation,
+                                                view.template get<SpotLightComponent>(keyed.Handle)); });
 
-            hasher.Mix(keyed.Uuid);
-            hasher.Mix(static_cast<u64>(source->GetHandle()));
-
-            // Geometry proxy: counts + bounds. A vertex-level edit that keeps
-            // both identical slips through — accepted; a full position hash per
-            // scene load is not worth that marginal coverage.
-            hasher.Mix(source->GetVertices().Num());
-            hasher.Mix(source->GetIndices().Num());
-            const auto& bounds = source->GetBoundingBox();
-            hasher.Mix(bounds.Min);
-            hasher.Mix(bounds.Max);
-
-            hasher.Mix(scene.GetWorldTransform(keyed.Handle));
+        return hasher.Value;
+    }
 
-            const Material* overrideMaterial = nullptr;
-            if (Entity e{ keyed.Handle, &scene }; e.HasComponent<MaterialComponent>())
-                overrideMaterial = &e.GetComponent<MaterialComponent>().m_Material;
-            const auto& submeshes = source->GetSubmeshes();
-            for (i32 s = 0; s < submeshes.Num(); ++s)
-            {
-                MixMaterial(hasher, ResolveSubmeshMaterial(overrideMaterial, source.get(),
-                                                           static_cast<u32>(s), defaultMaterial));
-            }
-        }
+    std::vector<LightmapBakeDependency> SceneLightmapRuntime::GatherBakeDependencies(Scene& scene)
+    {
+        // Each fingerprint hashes exactly the bytes ComputeBakeKey mixes for
+        // the same entity, so "the key changed" and "some fingerprint
+        // changed" always agree.
+        std::vector<LightmapBakeDependency> dependencies;
 
-        // Lights: hash EXACTLY what the bake consumes, per type, in the order
-        // ReferenceSceneBuilder::AddScene gathers them. Two deliberate parity
-        // choices, both mirrored from the builder:
-        //  - positions are the RAW TransformComponent::Translation (the value
-        //    the raster light collection packs — NOT the parent-composed world
-        //    transform), so re-parenting a light under a moved parent neither
-        //    stales nor un-stales a bake the light never changed in;
-        //  - a light the builder rejects (`!(intensity > 0)` — zero, negative
-        //    or NaN) contributes nothing to the bake, so it contributes
-        //    nothing to the key either.
-        // A per-type tag keeps e.g. a point light and a spot light with
-        // coincidentally-equal field bytes from colliding.
-        const auto hashLightsOfType = [&](auto view, auto&& mixEntity)
+        const Material defaultMaterial{};
+        for (const auto& keyed : GatherStaticEntities(scene))
         {
-            std::vector<KeyedEntity> lights;
-            for (auto entity : view)
-                lights.push_back({ static_cast<u64>(view.template get<IDComponent>(entity).ID), entity });
-            std::sort(lights.begin(), lights.end(),
-                      [](const KeyedEntity& a, const KeyedEntity& b)
-                      { return a.Uuid < b.Uuid; });
-            for (const auto& keyed : lights)
-                mixEntity(view, keyed);
-        };
-
-        hashLightsOfType(scene.GetAllEntitiesWith<IDComponent, TransformComponent, DirectionalLightComponent>(),
-                         [&](auto& view, const KeyedEntity& keyed)
-                         {
-                             const auto& l = view.template get<DirectionalLightComponent>(keyed.Handle);
-                             if (!(l.m_Intensity > 0.0f))
-                                 return; // invisible to the bake ⇒ invisible to the key
-                             hasher.Mix(1u);
-                             hasher.Mix(keyed.Uuid);
-                             hasher.Mix(l.m_Direction);
-                             hasher.Mix(l.m_Color);
-                             hasher.Mix(l.m_Intensity);
-                         });
-        hashLightsOfType(scene.GetAllEntitiesWith<IDComponent, TransformComponent, PointLightComponent>(),
-                         [&](auto& view, const KeyedEntity& keyed)
-                         {
-                             const auto& l = view.template get<PointLightComponent>(keyed.Handle);
-                             if (!(l.m_Intensity > 0.0f))
-                                 return;
-                             hasher.Mix(2u);
-                             hasher.Mix(keyed.Uuid);
-                             hasher.Mix(view.template get<TransformComponent>(keyed.Handle).Translation);
-                             hasher.Mix(l.m_Color);
-                             hasher.Mix(l.m_Intensity);
-                             hasher.Mix(l.m_Range);
-                             hasher.Mix(l.m_Attenuation);
-                         });
-        hashLightsOfType(scene.GetAllEntitiesWith<IDComponent, TransformComponent, SpotLightComponent>(),
-                         [&](auto& view, const KeyedEntity& keyed)
-                         {
-                             const auto& l = view.template get<SpotLightComponent>(keyed.Handle);
-                             if (!(l.m_Intensity > 0.0f))
-                                 return;
-                             hasher.Mix(3u);
-                             hasher.Mix(keyed.Uuid);
-                             hasher.Mix(view.template get<TransformComponent>(keyed.Handle).Translation);
-                             hasher.Mix(l.m_Direction);
-                             hasher.Mix(l.m_Color);
-                             hasher.Mix(l.m_Intensity);
-                             hasher.Mix(l.m_Range);
-                             hasher.Mix(l.m_InnerCutoff);
-                             hasher.Mix(l.m_OuterCutoff);
-                             hasher.Mix(l.m_Attenuation);
-                         });
+            BakeKeyHasher hasher;
+            MixStaticEntity(hasher, scene, keyed, defaultMaterial);
+            const Ref<MeshSource>& source = Entity{ keyed.Handle, &scene }.GetComponent<MeshComponent>().m_MeshSource;
+            dependencies.push_back({ keyed.Uuid, source->GetBoundingBox().Transform(scene.GetWorldTransform(keyed.Handle)),
+                                     hasher.Value });
+        }
 
-        return hasher.Value;
+        ForEachLightOfType(scene.GetAllEntitiesWith<IDComponent, TransformComponent, DirectionalLightComponent>(),
+                           [&](auto& view, const KeyedEntity& keyed)
+                           {
+                               BakeKeyHasher hasher;
+                               if (MixDirectionalLight(hasher, keyed.Uuid, view.template get<DirectionalLightComponent>(keyed.Handle)))
+                                   dependencies.push_back({ keyed.Uuid, LightReach(glm::vec3(0.0f), 0.0f), hasher.Value });
+                           });
+        ForEachLightOfType(scene.GetAllEntitiesWith<IDComponent, TransformComponent, PointLightComponent>(),
+                           [&](auto& view, const KeyedEntity& keyed)
+                           {
+                               BakeKeyHasher hasher;
+                               const glm::vec3& translation = view.template get<TransformComponent>(keyed.Handle).Translation;
+                               const auto& light = view.template get<PointLightComponent>(keyed.Handle);
+                               if (MixPointLight(hasher, keyed.Uuid, translation, light))
+                                   dependencies.push_back({ keyed.Uuid, LightReach(translation, light.m_Range), hasher.Value });
+                           });
+        ForEachLightOfType(scene.GetAllEntitiesWith<IDComponent, TransformComponent, SpotLightComponent>(),
+                           [&](auto& view, const KeyedEntity& keyed)
+                           {
+                               BakeKeyHasher hasher;
+                               const glm::vec3& translation = view.template get<TransformComponent>(keyed.Handle).Translation;
+                               const auto& light = view.template get<SpotLightComponent>(keyed.Handle);
+                               if (MixSpotLight(hasher, keyed.Uuid, translation, light))
+                                   dependencies.push_back({ keyed.Uuid, LightReach(translation, light.m_Range), hasher.Value });
+                           });
+
+        return dependencies;
     }
 } // namespace OloEngine
@@ -10,10 +10,12 @@
 
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace OloEngine
 {
     class Scene;
+    struct LightmapBakeDependency;
 
     // Scene-level baked-lightmap settings (issue #439). Serialized with the
     // scene and copied by Scene::Copy() — see
@@ -116,6 +118,13 @@ namespace OloEngine
         // the marginal coverage).
         [[nodiscard]] static u64 ComputeBakeKey(Scene& scene, const SceneLightmapSettings& settings);
 
+        // The same inputs as ComputeBakeKey, one LightmapBakeDependency per
+        // lightmap-static entity and per light the bake consumes, for
+        // LightmapBaker::PlanDependencies. A mesh's reach is its world
+        // bounds, a point or spot light's the box around its range, a
+        // directional light's everything.
+        [[nodiscard]] static std::vector<LightmapBakeDependency> GatherBakeDependencies(Scene& scene);
+
       private:
         // Drops the resolved asset state only — keeps the failed-unwrap memo
         // and the warn-once latch, unlike the public Invalidate(). Used by the
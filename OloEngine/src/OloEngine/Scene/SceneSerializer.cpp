@@ -1271,7 +1271,7 @@ namespace OloEngine
             sanitize(terrain.m_HeightShaping.TerraceSharpness, 0.0f, 0.999f, 0.6f);
             sanitize(terrain.m_HeightShaping.HeightExponent, 0.05f, 16.0f, 1.0f);
             terrain.m_HeightShaping.TerraceSteps = std::min(terrain.m_HeightShaping.TerraceSteps, 256u);
-            terrain.m_SplatmapGenResolution = std::clamp(terrain.m_SplatmapGenResolution, 16u, 4096u);
+            terrain.m_SplatmapGenResolution = std::clamp(terrain.m_SplatmapGenResolution, 16u, kMaxTerrainResolution);
             terrain.m_ProceduralErosionIterations = std::clamp(terrain.m_ProceduralErosionIterations, 0, 64);
             for (TerrainLayerRule& r : terrain.m_LayerRules)
             {
@@ -3299,6 +3299,8 @@ namespace OloEngine
         {
             auto& btc = deserializedEntity.AddComponent<BehaviorTreeComponent>();
             TrySet(btc.BehaviorTreeAssetHandle, behaviorTreeComponent["BehaviorTreeAsset"]);
+            TrySet(btc.TickInterval, behaviorTreeComponent["TickInterval"]);
+            SanitizeFloat(btc.TickInterval, 0.0f, 3600.0f, 0.0f);
         }
 
         if (auto stateMachineComponent = entity["StateMachineComponent"]; stateMachineComponent)
@@ -3325,6 +3327,8 @@ namespace OloEngine
             TrySet(pcp.RequireLineOfSight, perceptionComponent["RequireLineOfSight"]);
             TrySet(pcp.PerceiverTeam, perceptionComponent["PerceiverTeam"]);
             TrySet(pcp.DetectSameTeam, perceptionComponent["DetectSameTeam"]);
+            TrySet(pcp.SenseInterval, perceptionComponent["SenseInterval"]);
+            SanitizeFloat(pcp.SenseInterval, 0.0f, 3600.0f, 0.0f);
         }
 
         if (auto inventoryComponent = entity["InventoryComponent"]; inventoryComponent)
@@ -5484,6 +5488,7 @@ namespace OloEngine
 
             auto const& btc = entity.GetComponent<BehaviorTreeComponent>();
             out << YAML::Key << "BehaviorTreeAsset" << YAML::Value << btc.BehaviorTreeAssetHandle;
+            out << YAML::Key << "TickInterval" << YAML::Value << btc.TickInterval;
 
             out << YAML::EndMap; // BehaviorTreeComponent
         }
@@ -5522,6 +5527,7 @@ namespace OloEngine
             out << YAML::Key << "RequireLineOfSight" << YAML::Value << pcp.RequireLineOfSight;
             out << YAML::Key << "PerceiverTeam" << YAML::Value << pcp.PerceiverTeam;
             out << YAML::Key << "DetectSameTeam" << YAML::Value << pcp.DetectSameTeam;
+            out << YAML::Key << "SenseInterval" << YAML::Value << pcp.SenseInterval;
 
             out << YAML::EndMap; // PerceptionComponent
         }
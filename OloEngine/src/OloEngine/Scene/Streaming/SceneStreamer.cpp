@@ -2,6 +2,7 @@
 #include "SceneStreamer.h"
 #include "StreamingRegionSerializer.h"
 #include "StreamingVolumeComponent.h"
+#include "OloEngine/Core/FileSystem.h"
 #include "OloEngine/Scene/Scene.h"
 #include "OloEngine/Scene/Entity.h"
 #include "OloEngine/Scene/Components.h"
@@ -55,13 +56,15 @@ namespace OloEngine
     {
         OLO_PROFILE_FUNCTION();
 
-        // Wait for pending loads to complete
+        // Loads no worker has started yet are dropped; wait out the rest, they
+        // write into regions we are about to clear
         for (const auto& pending : m_PendingLoads)
         {
-            if (pending.Task.IsValid())
-            {
-                pending.Task.Wait();
-            }
+            pending.Load.Cancel();
+        }
+        for (const auto& pending : m_PendingLoads)
+        {
+            pending.Load.Wait();
         }
         m_PendingLoads.clear();
 
@@ -193,6 +196,11 @@ namespace OloEngine
                 UnloadRegion(regionId);
                 vol.IsLoaded = false;
             }
+            else if (distSq > vol.UnloadRadius * vol.UnloadRadius && region->m_State == StreamingRegion::State::Loading)
+            {
+                // Left the radius before the load finished
+                CancelRegionLoad(regionId);
+            }
             else if (region->m_State == StreamingRegion::State::Ready)
             {
                 region->m_LastUsedFrame = frameNumber;
@@ -324,28 +332,48 @@ namespace OloEngine
 
         auto& region = it->second;
         region->m_State = StreamingRegion::State::Loading;
-        auto path = region->m_SourcePath;
 
-        auto task = Tasks::Launch(
-            "SceneRegionLoad",
-            [region, path, &mutex = m_RegionMutex]() mutable -> bool
+        auto load = LoadRegionAsync(region, region->m_SourcePath, m_ReadPipe, m_RegionMutex, Tasks::ETaskPriority::BackgroundNormal);
+        m_PendingLoads.push_back({ id, std::move(load), region });
+
+        OLO_CORE_TRACE("SceneStreamer: Requested load for region '{0}'", region->m_Name);
+    }
+
+    void SceneStreamer::CancelRegionLoad(RegionID id)
+    {
+        // Only requests it; ProcessCompletedLoads() returns the region to Unloaded
+        // once the load has stopped, whether or not a worker had already parsed it
+        for (const auto& pending : m_PendingLoads)
+        {
+            if (pending.RegionId == id)
             {
-                OLO_PROFILE_SCOPE("StreamingRegion::Parse");
-                auto data = StreamingRegionSerializer::ParseRegionFile(path);
-                if (!data || !data["Region"])
-                {
-                    return false;
-                }
-                TUniqueLock<FMutex> lock(mutex);
-                region->m_RawData = std::move(data);
-                region->m_State = StreamingRegion::State::Loaded;
-                return true;
-            },
-            Tasks::ETaskPriority::BackgroundNormal);
+                pending.Load.Cancel();
+            }
+        }
+    }
 
-        m_PendingLoads.push_back({ id, std::move(task), region });
+    Tasks::TCoTask<bool> SceneStreamer::LoadRegionAsync(Ref<StreamingRegion> region, std::filesystem::path path,
+                                                         Tasks::FPipe& readPipe, FMutex& mutex, Tasks::ETaskPriority priority)
+    {
+        // Starts on a worker at `priority`; the read is queued behind the other
+        // regions' reads and the coroutine resumes once it is done
+        std::string text = co_await readPipe.Launch(
+            "StreamingRegion::Read", [path] { return FileSystem::ReadFileText(path); }, priority);
+        if (text.empty() || co_await Tasks::IsCancelRequested())
+        {
+            co_return false;
+        }
 
-        OLO_CORE_TRACE("SceneStreamer: Requested load for region '{0}'", region->m_Name);
+        auto data = StreamingRegionSerializer::ParseRegionText(text, path);
+        if (!data || !data["Region"] || co_await Tasks::IsCancelRequested())
+        {
+            co_return false;
+        }
+
+        TUniqueLock<FMutex> lock(mutex);
+        region->m_RawData = std::move(data);
+        region->m_State = StreamingRegion::State::Loaded;
+        co_return true;
     }
 
     void SceneStreamer::ProcessCompletedLoads()
@@ -359,14 +387,23 @@ namespace OloEngine
 
         for (auto it = m_PendingLoads.begin(); it != m_PendingLoads.end();)
         {
-            if (!it->Task.IsCompleted())
+            if (!it->Load.IsCompleted())
             {
                 ++it;
                 continue;
             }
 
-            bool success = it->Task.GetResult();
             auto& region = it->Region;
+            if (it->Load.IsCancelRequested())
+            {
+                TUniqueLock<FMutex> lock(m_RegionMutex);
+                region->m_RawData.reset();
+                region->m_State = StreamingRegion::State::Unloaded;
+                it = m_PendingLoads.erase(it);
+                continue;
+            }
+
+            bool success = !it->Load.IsCanceled() && it->Load.GetResult();
 
             // Read state and move raw data under mutex (written by worker thread under same lock)
             StreamingRegion::State regionState;
@@ -3,12 +3,13 @@
 #include "OloEngine/Core/Base.h"
 #include "OloEngine/Core/Ref.h"
 #include "OloEngine/Core/UUID.h"
-#include "OloEngine/Task/Task.h"
+#include "OloEngine/Task/Coroutine.h"
 #include "OloEngine/Threading/Mutex.h"
 #include "OloEngine/Threading/UniqueLock.h"
 #include "StreamingRegion.h"
 
 #include <glm/glm.hpp>
+#include <filesystem>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -66,10 +67,18 @@ namespace OloEngine
       private:
         void DiscoverRegions();
         void RequestRegionLoad(RegionID id);
+        void CancelRegionLoad(RegionID id);
         void ProcessCompletedLoads();
         void EvictOverBudget();
         void InitializeStreamedEntities(const std::vector<UUID>& entityUUIDs) const;
 
+        // Worker-side half of a region load: reads the file in `readPipe`, then
+        // parses it into region->m_RawData on a worker. Cancellation is checked
+        // between the stages; a load canceled before its read ran never touches the
+        // file. ProcessCompletedLoads() is the game-thread half.
+        static Tasks::TCoTask<bool> LoadRegionAsync(Ref<StreamingRegion> region, std::filesystem::path path,
+                                                    Tasks::FPipe& readPipe, FMutex& mutex, Tasks::ETaskPriority priority);
+
         Scene* m_Scene = nullptr;
         SceneStreamerConfig m_Config;
 
@@ -80,10 +89,13 @@ namespace OloEngine
         struct PendingLoad
         {
             RegionID RegionId;
-            Tasks::TTask<bool> Task;
+            Tasks::TCoTask<bool> Load;
             Ref<StreamingRegion> Region;
         };
         std::vector<PendingLoad> m_PendingLoads;
+        // Region file reads, one at a time so streaming never competes with itself
+        // for the disk
+        Tasks::FPipe m_ReadPipe{ "SceneStreamer.RegionRead" };
 
         mutable FMutex m_RegionMutex; // Protects m_Regions
         u64 m_CurrentFrame = 0;
@@ -77,6 +77,21 @@ namespace OloEngine
         }
     }
 
+    YAML::Node StreamingRegionSerializer::ParseRegionText(const std::string& text, const std::filesystem::path& path)
+    {
+        OLO_PROFILE_SCOPE("StreamingRegion::Parse");
+
+        try
+        {
+            return YAML::Load(text);
+        }
+        catch (const YAML::ParserException& e)
+        {
+            OLO_CORE_ERROR("Failed to parse .oloregion file '{0}'\n     {1}", path.string(), e.what());
+            return {};
+        }
+    }
+
     StreamingRegionSerializer::RegionMetadata StreamingRegionSerializer::ReadMetadata(const YAML::Node& data)
     {
         RegionMetadata meta;
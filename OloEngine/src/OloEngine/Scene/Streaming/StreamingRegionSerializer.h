@@ -29,6 +29,8 @@ namespace OloEngine
         // Background-thread safe: file I/O + YAML parse only.
         // Does NOT touch Scene/ECS.
         static YAML::Node ParseRegionFile(const std::filesystem::path& path);
+        // Same, for a file already read into memory; `path` only names it in errors.
+        static YAML::Node ParseRegionText(const std::string& text, const std::filesystem::path& path);
 
         // Extract metadata from parsed node without full deserialize
         struct RegionMetadata
@@ -4841,6 +4841,26 @@ static void NavAgentComponent_SetLockYAxis(UUID entityID, bool value)
     comp.m_LockYAxis = value;
 }
 
+static unsigned int NavAgentComponent_GetFlowFieldGroup(UUID entityID)
+{
+    Scene* scene = ScriptEngine::GetSceneContext();
+    OLO_CORE_ASSERT(scene);
+    Entity entity = scene->GetEntityByUUID(entityID);
+    OLO_CORE_ASSERT(entity);
+    auto& comp = entity.GetComponent<NavAgentComponent>();
+    return comp.m_FlowFieldGroup;
+}
+
+static void NavAgentComponent_SetFlowFieldGroup(UUID entityID, unsigned int value)
+{
+    Scene* scene = ScriptEngine::GetSceneContext();
+    OLO_CORE_ASSERT(scene);
+    Entity entity = scene->GetEntityByUUID(entityID);
+    OLO_CORE_ASSERT(entity);
+    auto& comp = entity.GetComponent<NavAgentComponent>();
+    comp.m_FlowFieldGroup = value;
+}
+
 static void NavAgentComponent_GetTargetPosition(UUID entityID, glm::vec3* outValue)
 {
     Scene* scene = ScriptEngine::GetSceneContext();
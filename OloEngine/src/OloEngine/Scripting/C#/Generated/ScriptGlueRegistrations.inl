@@ -493,6 +493,8 @@ OLO_ADD_INTERNAL_CALL(NavAgentComponent_GetStoppingDistance);
 OLO_ADD_INTERNAL_CALL(NavAgentComponent_SetStoppingDistance);
 OLO_ADD_INTERNAL_CALL(NavAgentComponent_GetLockYAxis);
 OLO_ADD_INTERNAL_CALL(NavAgentComponent_SetLockYAxis);
+OLO_ADD_INTERNAL_CALL(NavAgentComponent_GetFlowFieldGroup);
+OLO_ADD_INTERNAL_CALL(NavAgentComponent_SetFlowFieldGroup);
 OLO_ADD_INTERNAL_CALL(NavAgentComponent_GetTargetPosition);
 OLO_ADD_INTERNAL_CALL(NavAgentComponent_SetTargetPosition);
 
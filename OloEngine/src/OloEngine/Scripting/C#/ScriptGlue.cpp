@@ -2650,154 +2650,141 @@ namespace OloEngine
     }
 
     ///////////////////////////////////////////////////////////////////////////////////////////
-    // BehaviorTreeComponent //////////////////////////////////////////////////////////////////
+    // BlackboardKey //////////////////////////////////////////////////////////////////////////
     ///////////////////////////////////////////////////////////////////////////////////////////
 
-    static void BehaviorTreeComponent_SetBlackboardBool(UUID entityID, MonoString* key, bool value)
+    // Managed BlackboardKeys carry the interned id, so the component accessors
+    // below take it directly and never resolve a name.
+    static u32 BlackboardKey_Intern(MonoString* name)
     {
         OLO_PROFILE_FUNCTION();
-        if (!key)
+        if (!name)
         {
-            return;
+            return BlackboardKey::kInvalidId;
         }
-        auto entity = GetEntity(entityID);
-        OLO_CORE_ASSERT(entity.HasComponent<BehaviorTreeComponent>());
-        entity.GetComponent<BehaviorTreeComponent>().Blackboard.Set(Utils::MonoStringToString(key), value);
+        return BlackboardKey(Utils::MonoStringToString(name)).Id;
     }
 
-    static bool BehaviorTreeComponent_GetBlackboardBool(UUID entityID, MonoString* key)
+    static u32 BlackboardKey_Find(MonoString* name)
     {
         OLO_PROFILE_FUNCTION();
-        if (!key)
+        if (!name)
         {
-            return false;
+            return BlackboardKey::kInvalidId;
         }
+        return BlackboardKey::Find(Utils::MonoStringToString(name)).Id;
+    }
+
+    static MonoString* BlackboardKey_GetName(u32 keyID)
+    {
+        OLO_PROFILE_FUNCTION();
+        return ScriptEngine::CreateString(BlackboardKey::FromId(keyID).GetName().c_str());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////
+    // BehaviorTreeComponent //////////////////////////////////////////////////////////////////
+    ///////////////////////////////////////////////////////////////////////////////////////////
+
+    static void BehaviorTreeComponent_SetBlackboardBool(UUID entityID, u32 keyID, bool value)
+    {
+        OLO_PROFILE_FUNCTION();
         auto entity = GetEntity(entityID);
         OLO_CORE_ASSERT(entity.HasComponent<BehaviorTreeComponent>());
-        return entity.GetComponent<BehaviorTreeComponent>().Blackboard.Get<bool>(Utils::MonoStringToString(key));
+        entity.GetComponent<BehaviorTreeComponent>().Blackboard.Set(BlackboardKey::FromId(keyID), value);
     }
 
-    static void BehaviorTreeComponent_SetBlackboardInt(UUID entityID, MonoString* key, i32 value)
+    static bool BehaviorTreeComponent_GetBlackboardBool(UUID entityID, u32 keyID)
     {
         OLO_PROFILE_FUNCTION();
-        if (!key)
-        {
-            return;
-        }
         auto entity = GetEntity(entityID);
         OLO_CORE_ASSERT(entity.HasComponent<BehaviorTreeComponent>());
-        entity.GetComponent<BehaviorTreeComponent>().Blackboard.Set(Utils::MonoStringToString(key), value);
+        return entity.GetComponent<BehaviorTreeComponent>().Blackboard.Get<bool>(BlackboardKey::FromId(keyID));
     }
 
-    static i32 BehaviorTreeComponent_GetBlackboardInt(UUID entityID, MonoString* key)
+    static void BehaviorTreeComponent_SetBlackboardInt(UUID entityID, u32 keyID, i32 value)
     {
         OLO_PROFILE_FUNCTION();
-        if (!key)
-        {
-            return 0;
-        }
         auto entity = GetEntity(entityID);
         OLO_CORE_ASSERT(entity.HasComponent<BehaviorTreeComponent>());
-        return entity.GetComponent<BehaviorTreeComponent>().Blackboard.Get<i32>(Utils::MonoStringToString(key));
+        entity.GetComponent<BehaviorTreeComponent>().Blackboard.Set(BlackboardKey::FromId(keyID), value);
     }
 
-    static void BehaviorTreeComponent_SetBlackboardFloat(UUID entityID, MonoString* key, f32 value)
+    static i32 BehaviorTreeComponent_GetBlackboardInt(UUID entityID, u32 keyID)
     {
         OLO_PROFILE_FUNCTION();
-        if (!key)
-        {
-            return;
-        }
         auto entity = GetEntity(entityID);
         OLO_CORE_ASSERT(entity.HasComponent<BehaviorTreeComponent>());
-        entity.GetComponent<BehaviorTreeComponent>().Blackboard.Set(Utils::MonoStringToString(key), value);
+        return entity.GetComponent<BehaviorTreeComponent>().Blackboard.Get<i32>(BlackboardKey::FromId(keyID));
     }
 
-    static f32 BehaviorTreeComponent_GetBlackboardFloat(UUID entityID, MonoString* key)
+    static void BehaviorTreeComponent_SetBlackboardFloat(UUID entityID, u32 keyID, f32 value)
     {
         OLO_PROFILE_FUNCTION();
-        if (!key)
-        {
-            return 0.0f;
-        }
         auto entity = GetEntity(entityID);
         OLO_CORE_ASSERT(entity.HasComponent<BehaviorTreeComponent>());
-        return entity.GetComponent<BehaviorTreeComponent>().Blackboard.Get<f32>(Utils::MonoStringToString(key));
+        entity.GetComponent<BehaviorTreeComponent>().Blackboard.Set(BlackboardKey::FromId(keyID), value);
     }
 
-    static void BehaviorTreeComponent_SetBlackboardString(UUID entityID, MonoString* key, MonoString* value)
+    static f32 BehaviorTreeComponent_GetBlackboardFloat(UUID entityID, u32 keyID)
     {
         OLO_PROFILE_FUNCTION();
-        if (!key || !value)
+        auto entity = GetEntity(entityID);
+        OLO_CORE_ASSERT(entity.HasComponent<BehaviorTreeComponent>());
+        return entity.GetComponent<BehaviorTreeComponent>().Blackboard.Get<f32>(BlackboardKey::FromId(keyID));
+    }
+
+    static void BehaviorTreeComponent_SetBlackboardString(UUID entityID, u32 keyID, MonoString* value)
+    {
+        OLO_PROFILE_FUNCTION();
+        if (!value)
         {
             return;
         }
         auto entity = GetEntity(entityID);
         OLO_CORE_ASSERT(entity.HasComponent<BehaviorTreeComponent>());
         entity.GetComponent<BehaviorTreeComponent>().Blackboard.Set(
-            Utils::MonoStringToString(key), Utils::MonoStringToString(value));
+            BlackboardKey::FromId(keyID), Utils::MonoStringToString(value));
     }
 
-    static MonoString* BehaviorTreeComponent_GetBlackboardString(UUID entityID, MonoString* key)
+    static MonoString* BehaviorTreeComponent_GetBlackboardString(UUID entityID, u32 keyID)
     {
         OLO_PROFILE_FUNCTION();
-        if (!key)
-        {
-            return ScriptEngine::CreateString("");
-        }
         auto entity = GetEntity(entityID);
         OLO_CORE_ASSERT(entity.HasComponent<BehaviorTreeComponent>());
-        auto val = entity.GetComponent<BehaviorTreeComponent>().Blackboard.Get<std::string>(Utils::MonoStringToString(key));
+        auto val = entity.GetComponent<BehaviorTreeComponent>().Blackboard.Get<std::string>(BlackboardKey::FromId(keyID));
         return ScriptEngine::CreateString(val.c_str());
     }
 
-    static void BehaviorTreeComponent_SetBlackboardVec3(UUID entityID, MonoString* key, glm::vec3 const* value)
+    static void BehaviorTreeComponent_SetBlackboardVec3(UUID entityID, u32 keyID, glm::vec3 const* value)
     {
         OLO_PROFILE_FUNCTION();
-        if (!key)
-        {
-            return;
-        }
         auto entity = GetEntity(entityID);
         OLO_CORE_ASSERT(entity.HasComponent<BehaviorTreeComponent>());
-        entity.GetComponent<BehaviorTreeComponent>().Blackboard.Set(Utils::MonoStringToString(key), *value);
+        entity.GetComponent<BehaviorTreeComponent>().Blackboard.Set(BlackboardKey::FromId(keyID), *value);
     }
 
-    static void BehaviorTreeComponent_GetBlackboardVec3(UUID entityID, MonoString* key, glm::vec3* outResult)
+    static void BehaviorTreeComponent_GetBlackboardVec3(UUID entityID, u32 keyID, glm::vec3* outResult)
     {
         OLO_PROFILE_FUNCTION();
-        if (!key)
-        {
-            *outResult = {};
-            return;
-        }
         auto entity = GetEntity(entityID);
         OLO_CORE_ASSERT(entity.HasComponent<BehaviorTreeComponent>());
-        *outResult = entity.GetComponent<BehaviorTreeComponent>().Blackboard.Get<glm::vec3>(Utils::MonoStringToString(key));
+        *outResult = entity.GetComponent<BehaviorTreeComponent>().Blackboard.Get<glm::vec3>(BlackboardKey::FromId(keyID));
     }
 
-    static void BehaviorTreeComponent_RemoveBlackboardKey(UUID entityID, MonoString* key)
+    static void BehaviorTreeComponent_RemoveBlackboardKey(UUID entityID, u32 keyID)
     {
         OLO_PROFILE_FUNCTION();
-        if (!key)
-        {
-            return;
-        }
         auto entity = GetEntity(entityID);
         OLO_CORE_ASSERT(entity.HasComponent<BehaviorTreeComponent>());
-        entity.GetComponent<BehaviorTreeComponent>().Blackboard.Remove(Utils::MonoStringToString(key));
+        entity.GetComponent<BehaviorTreeComponent>().Blackboard.Remove(BlackboardKey::FromId(keyID));
     }
 
-    static bool BehaviorTreeComponent_HasBlackboardKey(UUID entityID, MonoString* key)
+    static bool BehaviorTreeComponent_HasBlackboardKey(UUID entityID, u32 keyID)
     {
         OLO_PROFILE_FUNCTION();
-        if (!key)
-        {
-            return false;
-        }
         auto entity = GetEntity(entityID);
         OLO_CORE_ASSERT(entity.HasComponent<BehaviorTreeComponent>());
-        return entity.GetComponent<BehaviorTreeComponent>().Blackboard.Has(Utils::MonoStringToString(key));
+        return entity.GetComponent<BehaviorTreeComponent>().Blackboard.Has(BlackboardKey::FromId(keyID));
     }
 
     static bool BehaviorTreeComponent_IsRunning(UUID entityID)
@@ -2812,151 +2799,106 @@ namespace OloEngine
     // StateMachineComponent //////////////////////////////////////////////////////////////////
     ///////////////////////////////////////////////////////////////////////////////////////////
 
-    static void StateMachineComponent_SetBlackboardBool(UUID entityID, MonoString* key, bool value)
+    static void StateMachineComponent_SetBlackboardBool(UUID entityID, u32 keyID, bool value)
     {
         OLO_PROFILE_FUNCTION();
-        if (!key)
-        {
-            return;
-        }
         auto entity = GetEntity(entityID);
         OLO_CORE_ASSERT(entity.HasComponent<StateMachineComponent>());
-        entity.GetComponent<StateMachineComponent>().Blackboard.Set(Utils::MonoStringToString(key), value);
+        entity.GetComponent<StateMachineComponent>().Blackboard.Set(BlackboardKey::FromId(keyID), value);
     }
 
-    static bool StateMachineComponent_GetBlackboardBool(UUID entityID, MonoString* key)
+    static bool StateMachineComponent_GetBlackboardBool(UUID entityID, u32 keyID)
     {
         OLO_PROFILE_FUNCTION();
-        if (!key)
-        {
-            return false;
-        }
         auto entity = GetEntity(entityID);
         OLO_CORE_ASSERT(entity.HasComponent<StateMachineComponent>());
-        return entity.GetComponent<StateMachineComponent>().Blackboard.Get<bool>(Utils::MonoStringToString(key));
+        return entity.GetComponent<StateMachineComponent>().Blackboard.Get<bool>(BlackboardKey::FromId(keyID));
     }
 
-    static void StateMachineComponent_SetBlackboardInt(UUID entityID, MonoString* key, i32 value)
+    static void StateMachineComponent_SetBlackboardInt(UUID entityID, u32 keyID, i32 value)
     {
         OLO_PROFILE_FUNCTION();
-        if (!key)
-        {
-            return;
-        }
         auto entity = GetEntity(entityID);
         OLO_CORE_ASSERT(entity.HasComponent<StateMachineComponent>());
-        entity.GetComponent<StateMachineComponent>().Blackboard.Set(Utils::MonoStringToString(key), value);
+        entity.GetComponent<StateMachineComponent>().Blackboard.Set(BlackboardKey::FromId(keyID), value);
     }
 
-    static i32 StateMachineComponent_GetBlackboardInt(UUID entityID, MonoString* key)
+    static i32 StateMachineComponent_GetBlackboardInt(UUID entityID, u32 keyID)
     {
         OLO_PROFILE_FUNCTION();
-        if (!key)
-        {
-            return 0;
-        }
         auto entity = GetEntity(entityID);
         OLO_CORE_ASSERT(entity.HasComponent<StateMachineComponent>());
-        return entity.GetComponent<StateMachineComponent>().Blackboard.Get<i32>(Utils::MonoStringToString(key));
+        return entity.GetComponent<StateMachineComponent>().Blackboard.Get<i32>(BlackboardKey::FromId(keyID));
     }
 
-    static void StateMachineComponent_SetBlackboardFloat(UUID entityID, MonoString* key, f32 value)
+    static void StateMachineComponent_SetBlackboardFloat(UUID entityID, u32 keyID, f32 value)
     {
         OLO_PROFILE_FUNCTION();
-        if (!key)
-        {
-            return;
-        }
         auto entity = GetEntity(entityID);
         OLO_CORE_ASSERT(entity.HasComponent<StateMachineComponent>());
-        entity.GetComponent<StateMachineComponent>().Blackboard.Set(Utils::MonoStringToString(key), value);
+        entity.GetComponent<StateMachineComponent>().Blackboard.Set(BlackboardKey::FromId(keyID), value);
     }
 
-    static f32 StateMachineComponent_GetBlackboardFloat(UUID entityID, MonoString* key)
+    static f32 StateMachineComponent_GetBlackboardFloat(UUID entityID, u32 keyID)
     {
         OLO_PROFILE_FUNCTION();
-        if (!key)
-        {
-            return 0.0f;
-        }
         auto entity = GetEntity(entityID);
         OLO_CORE_ASSERT(entity.HasComponent<StateMachineComponent>());
-        return entity.GetComponent<StateMachineComponent>().Blackboard.Get<f32>(Utils::MonoStringToString(key));
+        return entity.GetComponent<StateMachineComponent>().Blackboard.Get<f32>(BlackboardKey::FromId(keyID));
     }
 
-    static void StateMachineComponent_SetBlackboardString(UUID entityID, MonoString* key, MonoString* value)
+    static void StateMachineComponent_SetBlackboardString(UUID entityID, u32 keyID, MonoString* value)
     {
         OLO_PROFILE_FUNCTION();
-        if (!key || !value)
+        if (!value)
         {
             return;
         }
         auto entity = GetEntity(entityID);
         OLO_CORE_ASSERT(entity.HasComponent<StateMachineComponent>());
         entity.GetComponent<StateMachineComponent>().Blackboard.Set(
-            Utils::MonoStringToString(key), Utils::MonoStringToString(value));
+            BlackboardKey::FromId(keyID), Utils::MonoStringToString(value));
     }
 
-    static MonoString* StateMachineComponent_GetBlackboardString(UUID entityID, MonoString* key)
+    static MonoString* StateMachineComponent_GetBlackboardString(UUID entityID, u32 keyID)
     {
         OLO_PROFILE_FUNCTION();
-        if (!key)
-        {
-            return ScriptEngine::CreateString("");
-        }
         auto entity = GetEntity(entityID);
         OLO_CORE_ASSERT(entity.HasComponent<StateMachineComponent>());
-        auto val = entity.GetComponent<StateMachineComponent>().Blackboard.Get<std::string>(Utils::MonoStringToString(key));
+        auto val = entity.GetComponent<StateMachineComponent>().Blackboard.Get<std::string>(BlackboardKey::FromId(keyID));
         return ScriptEngine::CreateString(val.c_str());
     }
 
-    static void StateMachineComponent_SetBlackboardVec3(UUID entityID, MonoString* key, glm::vec3 const* value)
+    static void StateMachineComponent_SetBlackboardVec3(UUID entityID, u32 keyID, glm::vec3 const* value)
     {
         OLO_PROFILE_FUNCTION();
-        if (!key)
-        {
-            return;
-        }
         auto entity = GetEntity(entityID);
         OLO_CORE_ASSERT(entity.HasComponent<StateMachineComponent>());
-        entity.GetComponent<StateMachineComponent>().Blackboard.Set(Utils::MonoStringToString(key), *value);
+        entity.GetComponent<StateMachineComponent>().Blackboard.Set(BlackboardKey::FromId(keyID), *value);
     }
 
-    static void StateMachineComponent_GetBlackboardVec3(UUID entityID, MonoString* key, glm::vec3* outResult)
+    static void StateMachineComponent_GetBlackboardVec3(UUID entityID, u32 keyID, glm::vec3* outResult)
     {
         OLO_PROFILE_FUNCTION();
-        if (!key)
-        {
-            *outResult = {};
-            return;
-        }
         auto entity = GetEntity(entityID);
         OLO_CORE_ASSERT(entity.HasComponent<StateMachineComponent>());
-        *outResult = entity.GetComponent<StateMachineComponent>().Blackboard.Get<glm::vec3>(Utils::MonoStringToString(key));
+        *outResult = entity.GetComponent<StateMachineComponent>().Blackboard.Get<glm::vec3>(BlackboardKey::FromId(keyID));
     }
 
-    static void StateMachineComponent_RemoveBlackboardKey(UUID entityID, MonoString* key)
+    static void StateMachineComponent_RemoveBlackboardKey(UUID entityID, u32 keyID)
     {
         OLO_PROFILE_FUNCTION();
-        if (!key)
-        {
-            return;
-        }
         auto entity = GetEntity(entityID);
         OLO_CORE_ASSERT(entity.HasComponent<StateMachineComponent>());
-        entity.GetComponent<StateMachineComponent>().Blackboard.Remove(Utils::MonoStringToString(key));
+        entity.GetComponent<StateMachineComponent>().Blackboard.Remove(BlackboardKey::FromId(keyID));
     }
 
-    static bool StateMachineComponent_HasBlackboardKey(UUID entityID, MonoString* key)
+    static bool StateMachineComponent_HasBlackboardKey(UUID entityID, u32 keyID)
     {
         OLO_PROFILE_FUNCTION();
-        if (!key)
-        {
-            return false;
-        }
         auto entity = GetEntity(entityID);
         OLO_CORE_ASSERT(entity.HasComponent<StateMachineComponent>());
-        return entity.GetComponent<StateMachineComponent>().Blackboard.Has(Utils::MonoStringToString(key));
+        return entity.GetComponent<StateMachineComponent>().Blackboard.Has(BlackboardKey::FromId(keyID));
     }
 
     static MonoString* StateMachineComponent_GetCurrentState(UUID entityID)
@@ -4275,6 +4217,11 @@ namespace OloEngine
         OLO_ADD_INTERNAL_CALL(SaveGame_DeleteSave);
         OLO_ADD_INTERNAL_CALL(SaveGame_ValidateSave);
 
+        // BlackboardKey
+        OLO_ADD_INTERNAL_CALL(BlackboardKey_Intern);
+        OLO_ADD_INTERNAL_CALL(BlackboardKey_Find);
+        OLO_ADD_INTERNAL_CALL(BlackboardKey_GetName);
+
         // BehaviorTreeComponent
         OLO_ADD_INTERNAL_CALL(BehaviorTreeComponent_SetBlackboardBool);
         OLO_ADD_INTERNAL_CALL(BehaviorTreeComponent_GetBlackboardBool);
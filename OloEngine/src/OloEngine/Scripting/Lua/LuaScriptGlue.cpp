@@ -606,6 +606,61 @@ namespace OloEngine
             }
             comp.RuntimeAgent->AddGoal(std::move(goal));
         }
+
+        // A blackboard key argument from Lua: a BlackboardKey the script
+        // resolved once, or a key name. Writes intern a new name; reads only
+        // look it up, so probing for a key never grows the key table.
+        BlackboardKey LuaToBlackboardKey(const sol::object& key, bool intern)
+        {
+            if (key.is<BlackboardKey>())
+                return key.as<BlackboardKey>();
+            if (key.get_type() != sol::type::string)
+                return {};
+            const auto name = key.as<std::string_view>();
+            return intern ? BlackboardKey(name) : BlackboardKey::Find(name);
+        }
+
+        // Bool/int/float blackboard accessors of an AI component usertype.
+        // Each resolves its key argument once and uses the key overloads.
+        template<typename Component>
+        void BindLuaBlackboardScalars(sol::usertype<Component>& type)
+        {
+            type["SetBlackboardBool"] = [](Component& comp, const sol::object& key, bool value)
+            { comp.Blackboard.Set(LuaToBlackboardKey(key, true), value); };
+            type["GetBlackboardBool"] = [](const Component& comp, const sol::object& key) -> bool
+            { return comp.Blackboard.template Get<bool>(LuaToBlackboardKey(key, false)); };
+            type["SetBlackboardInt"] = [](Component& comp, const sol::object& key, i32 value)
+            { comp.Blackboard.Set(LuaToBlackboardKey(key, true), value); };
+            type["GetBlackboardInt"] = [](const Component& comp, const sol::object& key) -> i32
+            { return comp.Blackboard.template Get<i32>(LuaToBlackboardKey(key, false)); };
+            type["SetBlackboardFloat"] = [](Component& comp, const sol::object& key, f32 value)
+            { comp.Blackboard.Set(LuaToBlackboardKey(key, true), value); };
+            type["GetBlackboardFloat"] = [](const Component& comp, const sol::object& key) -> f32
+            { return comp.Blackboard.template Get<f32>(LuaToBlackboardKey(key, false)); };
+        }
+
+        // String/vec3/UUID accessors plus Remove/Has, for the BT and FSM
+        // components.
+        template<typename Component>
+        void BindLuaBlackboardObjects(sol::usertype<Component>& type)
+        {
+            type["SetBlackboardString"] = [](Component& comp, const sol::object& key, const std::string& value)
+            { comp.Blackboard.Set(LuaToBlackboardKey(key, true), value); };
+            type["GetBlackboardString"] = [](const Component& comp, const sol::object& key) -> std::string
+            { return comp.Blackboard.template Get<std::string>(LuaToBlackboardKey(key, false)); };
+            type["SetBlackboardVec3"] = [](Component& comp, const sol::object& key, const glm::vec3& value)
+            { comp.Blackboard.Set(LuaToBlackboardKey(key, true), value); };
+            type["GetBlackboardVec3"] = [](const Component& comp, const sol::object& key) -> glm::vec3
+            { return comp.Blackboard.template Get<glm::vec3>(LuaToBlackboardKey(key, false)); };
+            type["SetBlackboardUUID"] = [](Component& comp, const sol::object& key, u64 value)
+            { comp.Blackboard.Set(LuaToBlackboardKey(key, true), UUID(value)); };
+            type["GetBlackboardUUID"] = [](const Component& comp, const sol::object& key) -> u64
+            { return static_cast<u64>(comp.Blackboard.template Get<UUID>(LuaToBlackboardKey(key, false))); };
+            type["RemoveBlackboardKey"] = [](Component& comp, const sol::object& key)
+            { comp.Blackboard.Remove(LuaToBlackboardKey(key, false)); };
+            type["HasBlackboardKey"] = [](const Component& comp, const sol::object& key) -> bool
+            { return comp.Blackboard.Has(LuaToBlackboardKey(key, false)); };
+        }
     } // namespace
 
     void LuaScriptGlue::RegisterAllTypes()
@@ -1205,7 +1260,7 @@ namespace OloEngine
                                            "seed", &TerrainComponent::m_ProceduralSeed,
                                            "resolution", sol::property([](const TerrainComponent& t)
                                                                        { return t.m_ProceduralResolution; }, [](TerrainComponent& t, u32 v)
-                                                                       { if (v >= 2u && v <= 8192u) t.m_ProceduralResolution = v; }),
+                                                                       { if (v >= 2u && v <= kMaxTerrainResolution) t.m_ProceduralResolution = v; }),
                                            "octaves", sol::property([](const TerrainComponent& t)
                                                                     { return t.m_ProceduralOctaves; }, [](TerrainComponent& t, u32 v)
                                                                     { if (v >= 1u && v <= 20u) t.m_ProceduralOctaves = v; }),
@@ -1230,7 +1285,7 @@ namespace OloEngine
                                            "autoMaterial", &TerrainComponent::m_AutoMaterial,
                                            "splatmapGenResolution", sol::property([](const TerrainComponent& t)
                                                                                   { return t.m_SplatmapGenResolution; }, [](TerrainComponent& t, u32 v)
-                                                                                  { if (v >= 2u && v <= 8192u) t.m_SplatmapGenResolution = v; }),
+                                                                                  { if (v >= 2u && v <= kMaxTerrainResolution) t.m_SplatmapGenResolution = v; }),
                                            "ridgeBlend", sol::property([](const TerrainComponent& t)
                                                                        { return t.m_HeightShaping.RidgeBlend; }, [](TerrainComponent& t, f32 v)
                                                                        { if (std::isfinite(v)) t.m_HeightShaping.RidgeBlend = glm::clamp(v, 0.0f, 1.0f); }),
@@ -4260,65 +4315,46 @@ namespace OloEngine
 
         // --- BehaviorTreeComponent ---
         OLO_PROFILE_SCOPE("Lua::RegisterAITypes");
-        lua.new_usertype<BehaviorTreeComponent>("BehaviorTreeComponent", "SetBlackboardBool", [](BehaviorTreeComponent& comp, const std::string& key, bool value)
-                                                { comp.Blackboard.Set(key, value); }, "GetBlackboardBool", [](const BehaviorTreeComponent& comp, const std::string& key) -> bool
-                                                { return comp.Blackboard.Get<bool>(key); }, "SetBlackboardInt", [](BehaviorTreeComponent& comp, const std::string& key, i32 value)
-                                                { comp.Blackboard.Set(key, value); }, "GetBlackboardInt", [](const BehaviorTreeComponent& comp, const std::string& key) -> i32
-                                                { return comp.Blackboard.Get<i32>(key); }, "SetBlackboardFloat", [](BehaviorTreeComponent& comp, const std::string& key, f32 value)
-                                                { comp.Blackboard.Set(key, value); }, "GetBlackboardFloat", [](const BehaviorTreeComponent& comp, const std::string& key) -> f32
-                                                { return comp.Blackboard.Get<f32>(key); }, "SetBlackboardString", [](BehaviorTreeComponent& comp, const std::string& key, const std::string& value)
-                                                { comp.Blackboard.Set(key, value); }, "GetBlackboardString", [](const BehaviorTreeComponent& comp, const std::string& key) -> std::string
-                                                { return comp.Blackboard.Get<std::string>(key); }, "SetBlackboardVec3", [](BehaviorTreeComponent& comp, const std::string& key, const glm::vec3& value)
-                                                { comp.Blackboard.Set(key, value); }, "GetBlackboardVec3", [](const BehaviorTreeComponent& comp, const std::string& key) -> glm::vec3
-                                                { return comp.Blackboard.Get<glm::vec3>(key); }, "SetBlackboardUUID", [](BehaviorTreeComponent& comp, const std::string& key, u64 value)
-                                                { comp.Blackboard.Set(key, UUID(value)); }, "GetBlackboardUUID", [](const BehaviorTreeComponent& comp, const std::string& key) -> u64
-                                                { return static_cast<u64>(comp.Blackboard.Get<UUID>(key)); }, "RemoveBlackboardKey", [](BehaviorTreeComponent& comp, const std::string& key)
-                                                { comp.Blackboard.Remove(key); }, "HasBlackboardKey", [](const BehaviorTreeComponent& comp, const std::string& key) -> bool
-                                                { return comp.Blackboard.Has(key); }, "IsRunning", sol::readonly(&BehaviorTreeComponent::IsRunning));
+        // A key resolved once by the script and passed to any blackboard
+        // accessor in place of its name: local kHealth = BlackboardKey.new("health")
+        lua.new_usertype<BlackboardKey>("BlackboardKey",
+                                        sol::constructors<BlackboardKey(std::string_view)>(),
+                                        "name", sol::readonly_property([](const BlackboardKey& key) -> std::string
+                                                                       { return key.GetName(); }),
+                                        "IsValid", &BlackboardKey::IsValid);
+
+        auto behaviorTreeType = lua.new_usertype<BehaviorTreeComponent>("BehaviorTreeComponent", "IsRunning", sol::readonly(&BehaviorTreeComponent::IsRunning), "tickInterval", sol::property([](const BehaviorTreeComponent& c)
+                                                                                                                                                                                           { return c.TickInterval; }, [](BehaviorTreeComponent& c, f32 v)
+                                                                                                                                                                                           { if (std::isfinite(v) && v >= 0.0f) c.TickInterval = v; }));
+        BindLuaBlackboardScalars(behaviorTreeType);
+        BindLuaBlackboardObjects(behaviorTreeType);
 
         // --- StateMachineComponent ---
-        lua.new_usertype<StateMachineComponent>("StateMachineComponent", "SetBlackboardBool", [](StateMachineComponent& comp, const std::string& key, bool value)
-                                                { comp.Blackboard.Set(key, value); }, "GetBlackboardBool", [](const StateMachineComponent& comp, const std::string& key) -> bool
-                                                { return comp.Blackboard.Get<bool>(key); }, "SetBlackboardInt", [](StateMachineComponent& comp, const std::string& key, i32 value)
-                                                { comp.Blackboard.Set(key, value); }, "GetBlackboardInt", [](const StateMachineComponent& comp, const std::string& key) -> i32
-                                                { return comp.Blackboard.Get<i32>(key); }, "SetBlackboardFloat", [](StateMachineComponent& comp, const std::string& key, f32 value)
-                                                { comp.Blackboard.Set(key, value); }, "GetBlackboardFloat", [](const StateMachineComponent& comp, const std::string& key) -> f32
-                                                { return comp.Blackboard.Get<f32>(key); }, "SetBlackboardString", [](StateMachineComponent& comp, const std::string& key, const std::string& value)
-                                                { comp.Blackboard.Set(key, value); }, "GetBlackboardString", [](const StateMachineComponent& comp, const std::string& key) -> std::string
-                                                { return comp.Blackboard.Get<std::string>(key); }, "SetBlackboardVec3", [](StateMachineComponent& comp, const std::string& key, const glm::vec3& value)
-                                                { comp.Blackboard.Set(key, value); }, "GetBlackboardVec3", [](const StateMachineComponent& comp, const std::string& key) -> glm::vec3
-                                                { return comp.Blackboard.Get<glm::vec3>(key); }, "SetBlackboardUUID", [](StateMachineComponent& comp, const std::string& key, u64 value)
-                                                { comp.Blackboard.Set(key, UUID(value)); }, "GetBlackboardUUID", [](const StateMachineComponent& comp, const std::string& key) -> u64
-                                                { return static_cast<u64>(comp.Blackboard.Get<UUID>(key)); }, "RemoveBlackboardKey", [](StateMachineComponent& comp, const std::string& key)
-                                                { comp.Blackboard.Remove(key); }, "HasBlackboardKey", [](const StateMachineComponent& comp, const std::string& key) -> bool
-                                                { return comp.Blackboard.Has(key); }, "GetCurrentState", [](const StateMachineComponent& comp) -> std::string
-                                                {
+        auto stateMachineType = lua.new_usertype<StateMachineComponent>("StateMachineComponent", "GetCurrentState", [](const StateMachineComponent& comp) -> std::string
+                                                                        {
                 if (comp.RuntimeFSM && comp.RuntimeFSM->IsStarted())
                     return comp.RuntimeFSM->GetCurrentStateID();
                 return ""; }, "ForceTransition", [](StateMachineComponent& comp, Entity entity, const std::string& stateId)
-                                                {
+                                                                        {
                 if (comp.RuntimeFSM)
                     comp.RuntimeFSM->ForceTransition(stateId, entity, comp.Blackboard); });
+        BindLuaBlackboardScalars(stateMachineType);
+        BindLuaBlackboardObjects(stateMachineType);
 
         // --- GoapAgentComponent ---
         // Scripts steer the GOAP brain by pushing observations into its world
         // state (SetWorldFact*) and reading back which goal/plan it committed to.
-        lua.new_usertype<GoapAgentComponent>("GoapAgentComponent", "enabled", &GoapAgentComponent::Enabled, "SetBlackboardBool", [](GoapAgentComponent& comp, const std::string& key, bool value)
-                                             { comp.Blackboard.Set(key, value); }, "GetBlackboardBool", [](const GoapAgentComponent& comp, const std::string& key) -> bool
-                                             { return comp.Blackboard.Get<bool>(key); }, "SetBlackboardInt", [](GoapAgentComponent& comp, const std::string& key, i32 value)
-                                             { comp.Blackboard.Set(key, value); }, "GetBlackboardInt", [](const GoapAgentComponent& comp, const std::string& key) -> i32
-                                             { return comp.Blackboard.Get<i32>(key); }, "SetBlackboardFloat", [](GoapAgentComponent& comp, const std::string& key, f32 value)
-                                             { comp.Blackboard.Set(key, value); }, "GetBlackboardFloat", [](const GoapAgentComponent& comp, const std::string& key) -> f32
-                                             { return comp.Blackboard.Get<f32>(key); }, "SetWorldFactBool", [](GoapAgentComponent& comp, const std::string& key, bool value)
-                                             { if (!comp.RuntimeAgent) comp.RuntimeAgent = Ref<GoapAgent>::Create(); comp.RuntimeAgent->SetFact(key, value); }, "SetWorldFactInt", [](GoapAgentComponent& comp, const std::string& key, i32 value)
-                                             { if (!comp.RuntimeAgent) comp.RuntimeAgent = Ref<GoapAgent>::Create(); comp.RuntimeAgent->SetFact(key, value); }, "Invalidate", [](GoapAgentComponent& comp)
-                                             { if (comp.RuntimeAgent) comp.RuntimeAgent->Invalidate(); }, "CurrentGoal", [](const GoapAgentComponent& comp) -> std::string
-                                             { return comp.RuntimeAgent ? comp.RuntimeAgent->CurrentGoalName() : std::string{}; }, "HasPlan", [](const GoapAgentComponent& comp) -> bool
-                                             { return comp.RuntimeAgent && comp.RuntimeAgent->HasPlan(); }, "GoalsAchieved", [](const GoapAgentComponent& comp) -> u32
-                                             { return comp.RuntimeAgent ? comp.RuntimeAgent->GoalsAchieved() : 0u; },
-                                             // Authoring: build the agent's brain from Lua tables.
-                                             "AddAction", &LuaGoapAddAction, "AddGoal", &LuaGoapAddGoal, "ClearAgent", [](GoapAgentComponent& comp)
-                                             { comp.RuntimeAgent = nullptr; });
+        auto goapAgentType = lua.new_usertype<GoapAgentComponent>("GoapAgentComponent", "enabled", &GoapAgentComponent::Enabled, "SetWorldFactBool", [](GoapAgentComponent& comp, const std::string& key, bool value)
+                                                                  { if (!comp.RuntimeAgent) comp.RuntimeAgent = Ref<GoapAgent>::Create(); comp.RuntimeAgent->SetFact(key, value); }, "SetWorldFactInt", [](GoapAgentComponent& comp, const std::string& key, i32 value)
+                                                                  { if (!comp.RuntimeAgent) comp.RuntimeAgent = Ref<GoapAgent>::Create(); comp.RuntimeAgent->SetFact(key, value); }, "Invalidate", [](GoapAgentComponent& comp)
+                                                                  { if (comp.RuntimeAgent) comp.RuntimeAgent->Invalidate(); }, "CurrentGoal", [](const GoapAgentComponent& comp) -> std::string
+                                                                  { return comp.RuntimeAgent ? comp.RuntimeAgent->CurrentGoalName() : std::string{}; }, "HasPlan", [](const GoapAgentComponent& comp) -> bool
+                                                                  { return comp.RuntimeAgent && comp.RuntimeAgent->HasPlan(); }, "GoalsAchieved", [](const GoapAgentComponent& comp) -> u32
+                                                                  { return comp.RuntimeAgent ? comp.RuntimeAgent->GoalsAchieved() : 0u; },
+                                                                  // Authoring: build the agent's brain from Lua tables.
+                                                                  "AddAction", &LuaGoapAddAction, "AddGoal", &LuaGoapAddGoal, "ClearAgent", [](GoapAgentComponent& comp)
+                                                                  { comp.RuntimeAgent = nullptr; });
+        BindLuaBlackboardScalars(goapAgentType);
 
         // Status codes a GOAP action's `perform` callback returns.
         lua["GoapStatus"] = lua.create_table_with(
@@ -4350,6 +4386,9 @@ namespace OloEngine
                                               "requireLineOfSight", &PerceptionComponent::RequireLineOfSight,
                                               "perceiverTeam", &PerceptionComponent::PerceiverTeam,
                                               "detectSameTeam", &PerceptionComponent::DetectSameTeam,
+                                              "senseInterval", sol::property([](const PerceptionComponent& c)
+                                                                             { return c.SenseInterval; }, [](PerceptionComponent& c, f32 v)
+                                                                             { if (std::isfinite(v) && v >= 0.0f) c.SenseInterval = v; }),
                                               "hasVisibleTarget", sol::readonly(&PerceptionComponent::HasVisibleTarget),
                                               "visibleTarget", sol::property([](const PerceptionComponent& c)
                                                                              { return static_cast<u64>(c.VisibleTarget); }),
@@ -85,9 +85,6 @@ namespace OloEngine
         IndexTable Index;
         std::vector<AssetInfo> AssetInfos;
         std::vector<SceneInfo> SceneInfos;
-
-        // Temporary data used during asset pack building, not to be serialized
-        std::vector<std::pair<AssetHandle, std::filesystem::path>> TempAssetFiles;
     };
 
 } // namespace OloEngine
@@ -25,5 +25,13 @@ namespace OloEngine
         std::string Password;
         std::string LogLevel = "Info";
         u32 AutoSaveInterval = 300; // seconds
+
+        // Headless load test (command line only). With LoadTestBots > 0 the server
+        // connects that many in-process bot clients to its own port, runs for
+        // LoadTestDuration seconds, reports, and exits. See LoadTestHarness.
+        u32 LoadTestBots = 0;
+        f32 LoadTestInputRate = 30.0f; // movement commands per bot per second
+        f32 LoadTestDuration = 30.0f;  // seconds
+        std::string LoadTestReportPath; // empty = log the report only
     };
 } // namespace OloEngine
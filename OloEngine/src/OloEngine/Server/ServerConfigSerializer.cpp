@@ -4,6 +4,7 @@
 #include "OloEngine/Core/Log.h"
 
 #include <charconv>
+#include <cmath>
 #include <filesystem>
 #include <yaml-cpp/yaml.h>
 
@@ -288,12 +289,66 @@ namespace OloEngine
                 }
                 config.ProjectPath = argv[++i];
             }
+            else if (arg == "--bots" && i + 1 < argc)
+            {
+                if (isOptionToken(argv[i + 1]))
+                {
+                    OLO_CORE_ERROR("[ServerConfig] Missing value for --bots");
+                    continue;
+                }
+                const char* val = argv[++i];
+                const char* end = val + std::strlen(val);
+                u32 parsed = 0;
+                auto [ptr, ec] = std::from_chars(val, end, parsed);
+                if (ec != std::errc{} || ptr != end)
+                {
+                    OLO_CORE_ERROR("[ServerConfig] Invalid --bots value '{}': must be a non-negative integer", val);
+                }
+                else
+                {
+                    config.LoadTestBots = parsed;
+                }
+            }
+            else if ((arg == "--bot-input-rate" || arg == "--bot-duration") && i + 1 < argc)
+            {
+                if (isOptionToken(argv[i + 1]))
+                {
+                    OLO_CORE_ERROR("[ServerConfig] Missing value for {}", arg);
+                    continue;
+                }
+                const char* val = argv[++i];
+                const char* end = val + std::strlen(val);
+                f32 parsed = 0.0f;
+                auto [ptr, ec] = std::from_chars(val, end, parsed);
+                if (ec != std::errc{} || ptr != end || !std::isfinite(parsed) || parsed <= 0.0f)
+                {
+                    OLO_CORE_ERROR("[ServerConfig] Invalid {} value '{}': must be a positive number", arg, val);
+                }
+                else if (arg == "--bot-input-rate")
+                {
+                    config.LoadTestInputRate = parsed;
+                }
+                else
+                {
+                    config.LoadTestDuration = parsed;
+                }
+            }
+            else if (arg == "--bot-report" && i + 1 < argc)
+            {
+                if (isOptionToken(argv[i + 1]))
+                {
+                    OLO_CORE_ERROR("[ServerConfig] Missing value for --bot-report");
+                    continue;
+                }
+                config.LoadTestReportPath = argv[++i];
+            }
             else if (arg == "--config" && i + 1 < argc)
             {
                 ++i; // Already handled in first pass
             }
             else if (arg == "--port" || arg == "--max-players" || arg == "--tick-rate" ||
-                     arg == "--snapshot-rate" || arg == "--scene" || arg == "--project" || arg == "--config")
+                     arg == "--snapshot-rate" || arg == "--scene" || arg == "--project" || arg == "--config" ||
+                     arg == "--bots" || arg == "--bot-input-rate" || arg == "--bot-duration" || arg == "--bot-report")
             {
                 // Reached only when the option is the LAST token, so the `i + 1 < argc`
                 // guard on its own branch failed. Without this the flag is silently
@@ -0,0 +1,565 @@
+#include "OloEnginePCH.h"
+#include "ServerLoadTest.h"
+
+#include "OloEngine/Core/FastRandom.h"
+#include "OloEngine/Core/Log.h"
+#include "OloEngine/Core/Timer.h"
+#include "OloEngine/Networking/Core/ClientReplicationDriver.h"
+#include "OloEngine/Networking/Core/NetworkManager.h"
+#include "OloEngine/Networking/Core/NetworkMessage.h"
+#include "OloEngine/Networking/Prediction/NetworkMovementInput.h"
+#include "OloEngine/Networking/Transport/NetworkClient.h"
+#include "OloEngine/Networking/Transport/NetworkServer.h"
+#include "OloEngine/Scene/Scene.h"
+#include "OloEngine/Threading/Mutex.h"
+#include "OloEngine/Threading/UniqueLock.h"
+
+#include <steam/isteamnetworkingutils.h>
+#include <steam/steamnetworkingsockets.h>
+
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <format>
+#include <numbers>
+
+namespace OloEngine
+{
+    namespace
+    {
+        // Server-side clamp on one movement command. Bots step well inside it.
+        constexpr f32 kMaxStepDistance = 1.0f;
+
+        // After a hitch a bot sends at most this many catch-up commands in one
+        // frame and drops the rest, as a real client's input sampling would.
+        constexpr u32 kMaxInputsPerTick = 4;
+
+        // Only one harness can own the GNS callback at a time. The callback runs
+        // on the network thread in a real host, so the pointer is guarded.
+        FMutex s_ActiveMutex;
+        LoadTestHarness* s_Active = nullptr;
+        std::atomic<bool> s_ForwardToNetworkManager{ false };
+
+        void ForwardToNetworkManager(SteamNetConnectionStatusChangedCallback_t* info)
+        {
+            NetworkManager::OnConnectionStatusChanged(info);
+        }
+
+        [[nodiscard]] f32 NearestRank(const std::vector<f32>& sorted, f32 percentile)
+        {
+            if (sorted.empty())
+            {
+                return 0.0f;
+            }
+            auto const rank = static_cast<sizet>(std::ceil(percentile * static_cast<f32>(sorted.size())));
+            return sorted[std::clamp<sizet>(rank, 1, sorted.size()) - 1];
+        }
+
+        [[nodiscard]] const char* BehaviorName(ELoadTestBotBehavior behavior)
+        {
+            switch (behavior)
+            {
+                case ELoadTestBotBehavior::RandomWalk:
+                    return "RandomWalk";
+                case ELoadTestBotBehavior::Circle:
+                    return "Circle";
+                case ELoadTestBotBehavior::Idle:
+                    return "Idle";
+            }
+            return "Unknown";
+        }
+    } // namespace
+
+    struct LoadTestHarness::Bot
+    {
+        explicit Bot(u64 seed)
+            : Rng(seed)
+        {
+        }
+
+        Scope<NetworkClient> Client = CreateScope<NetworkClient>();
+        Scope<Scene> World = CreateScope<Scene>();
+        ClientReplicationDriver Driver;
+        FastRandomPCG Rng;
+
+        u64 Pawn = 0;
+        f32 InputAccumulator = 0.0f;
+        f32 Heading = 0.0f;      // radians in the XZ plane
+        f32 TurnPerUnit = 0.0f;  // Circle: radians per unit travelled
+        f32 HeadingTimer = 0.0f; // RandomWalk: seconds until the next turn
+        u64 InputsSent = 0;
+        f32 ConnectIssuedAt = -1.0f;
+    };
+
+    // ─────────────────────────────────────────────────────────────────────────
+    // LoadTestReport
+    // ─────────────────────────────────────────────────────────────────────────
+
+    std::string LoadTestReport::ToString() const
+    {
+        std::string out;
+        out += std::format("bots_requested: {}\n", BotsRequested);
+        out += std::format("bots_connected: {}\n", BotsConnected);
+        out += std::format("elapsed_s: {:.2f}\n", ElapsedSeconds);
+        out += std::format("server_ticks: {}\n", ServerTicks);
+        out += std::format("server_tick_mean_ms: {:.3f}\n", ServerTickMeanMs);
+        out += std::format("server_tick_p50_ms: {:.3f}\n", ServerTickP50Ms);
+        out += std::format("server_tick_p95_ms: {:.3f}\n", ServerTickP95Ms);
+        out += std::format("server_tick_p99_ms: {:.3f}\n", ServerTickP99Ms);
+        out += std::format("server_tick_max_ms: {:.3f}\n", ServerTickMaxMs);
+        out += std::format("client_down_bytes_per_s_mean: {:.1f}\n", ClientDownBytesPerSecMean);
+        out += std::format("client_down_bytes_per_s_max: {:.1f}\n", ClientDownBytesPerSecMax);
+        out += std::format("client_up_bytes_per_s_mean: {:.1f}\n", ClientUpBytesPerSecMean);
+        out += std::format("client_up_bytes_per_s_max: {:.1f}\n", ClientUpBytesPerSecMax);
+        out += std::format("snapshots: {}\n", Snapshots);
+        out += std::format("snapshot_mean_bytes: {:.1f}\n", SnapshotMeanBytes);
+        out += std::format("snapshot_max_bytes: {}\n", SnapshotMaxBytes);
+        out += std::format("inputs_sent: {}\n", InputsSent);
+        out += std::format("interpolation_frames: {}\n", InterpolationFrames);
+        out += std::format("interpolation_starved_frames: {}\n", StarvedFrames);
+        out += std::format("interpolation_stalls: {}\n", Stalls);
+        out += std::format("bots_with_stalls: {}\n", BotsWithStalls);
+        out += std::format("interpolation_stalled_s: {:.3f}\n", StalledSeconds);
+        out += std::format("interpolation_longest_stall_s: {:.3f}\n", LongestStallSeconds);
+        return out;
+    }
+
+    void LoadTestReport::Log() const
+    {
+        OLO_CORE_INFO("=== Load Test Report ===");
+        OLO_CORE_INFO("  Bots: {}/{} connected over {:.1f} s", BotsConnected, BotsRequested, ElapsedSeconds);
+        OLO_CORE_INFO("  Server tick ({} samples): mean {:.3f} ms | p50 {:.3f} | p95 {:.3f} | p99 {:.3f} | max {:.3f}",
+                      ServerTicks, ServerTickMeanMs, ServerTickP50Ms, ServerTickP95Ms, ServerTickP99Ms, ServerTickMaxMs);
+        OLO_CORE_INFO("  Per client down: {:.1f} KB/s mean, {:.1f} KB/s max | up: {:.1f} KB/s mean, {:.1f} KB/s max",
+                      ClientDownBytesPerSecMean / 1024.0f, ClientDownBytesPerSecMax / 1024.0f,
+                      ClientUpBytesPerSecMean / 1024.0f, ClientUpBytesPerSecMax / 1024.0f);
+        OLO_CORE_INFO("  Snapshots: {} received | mean {:.1f} B | max {} B", Snapshots, SnapshotMeanBytes,
+                      SnapshotMaxBytes);
+        OLO_CORE_INFO("  Inputs sent: {}", InputsSent);
+        OLO_CORE_INFO("  Interpolation: {} starved of {} frames | {} stalls on {} bots | {:.2f} s stalled, longest {:.3f} s",
+                      StarvedFrames, InterpolationFrames, Stalls, BotsWithStalls, StalledSeconds, LongestStallSeconds);
+        OLO_CORE_INFO("========================");
+    }
+
+    // ─────────────────────────────────────────────────────────────────────────
+    // LoadTestHarness
+    // ─────────────────────────────────────────────────────────────────────────
+
+    LoadTestHarness::LoadTestHarness(const LoadTestConfig& config)
+        : m_Config(config)
+    {
+        if (!std::isfinite(m_Config.InputRateHz) || m_Config.InputRateHz < 0.0f)
+        {
+            OLO_CORE_WARN("[LoadTest] Invalid input rate {}; bots will idle", m_Config.InputRateHz);
+            m_Config.InputRateHz = 0.0f;
+        }
+        if (m_Config.ConnectsPerTick == 0)
+        {
+            m_Config.ConnectsPerTick = 1;
+        }
+        if (m_Config.SnapshotRate == 0)
+        {
+            m_Config.SnapshotRate = 20;
+        }
+    }
+
+    LoadTestHarness::~LoadTestHarness()
+    {
+        Stop();
+    }
+
+    void LoadTestHarness::OnConnectionStatusChanged(SteamNetConnectionStatusChangedCallback_t* info)
+    {
+        {
+            TUniqueLock<FMutex> lock(s_ActiveMutex);
+            if (s_Active != nullptr)
+            {
+                s_Active->RouteStatusChange(info);
+            }
+        }
+
+        // Every transport filters by its own handles, so the engine's server and
+        // client can see the same event without mistaking a bot's for their own.
+        if (s_ForwardToNetworkManager.load(std::memory_order_acquire))
+        {
+            NetworkManager::OnConnectionStatusChanged(info);
+        }
+    }
+
+    void LoadTestHarness::RouteStatusChange(SteamNetConnectionStatusChangedCallback_t* info)
+    {
+        if (m_HostedServer)
+        {
+            m_HostedServer->OnConnectionStatusChanged(info);
+        }
+        for (auto const& bot : m_Bots)
+        {
+            bot->Client->OnConnectionStatusChanged(info);
+        }
+    }
+
+    bool LoadTestHarness::StartHostedServer(u16 preferredPort, i32 probes)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        OLO_CORE_ASSERT(!m_HostedServer, "LoadTestHarness: hosted server already started");
+
+        InstallCallback();
+
+        m_HostedScene = CreateScope<Scene>();
+        m_HostedServer = CreateScope<NetworkServer>();
+        // 0 = unlimited; the bot count is the load, not something to refuse.
+        m_HostedServer->SetMaxConnections(0);
+
+        bool started = false;
+        for (i32 probe = 0; probe < probes && !started; ++probe)
+        {
+            u32 const port = static_cast<u32>(preferredPort) + static_cast<u32>(probe);
+            if (port > 65535)
+            {
+                break;
+            }
+            if (m_HostedServer->Start(static_cast<u16>(port)))
+            {
+                m_HostedPort = static_cast<u16>(port);
+                started = true;
+            }
+        }
+        if (!started)
+        {
+            OLO_CORE_ERROR("[LoadTest] No free port in [{}, {})", preferredPort, static_cast<u32>(preferredPort) + probes);
+            m_HostedServer.reset();
+            m_HostedScene.reset();
+            return false;
+        }
+
+        // The same routing a real host installs, running synchronously from
+        // PollMessages inside Tick() — on this thread.
+        auto& dispatcher = m_HostedServer->GetDispatcher();
+        dispatcher.RegisterHandler(ENetworkMessageType::InputCommand, [this](u32 sender, const u8* data, u32 size)
+                                   { m_HostedDriver.HandleInputCommand(*m_HostedScene, sender, data, size); });
+        dispatcher.RegisterHandler(ENetworkMessageType::RPC, [this](u32 sender, const u8* data, u32 size)
+                                   { m_HostedDriver.HandleRpc(*m_HostedScene, sender, data, size); });
+        dispatcher.RegisterHandler(ENetworkMessageType::SnapshotAck, [this](u32 sender, const u8* data, u32 size)
+                                   { m_HostedDriver.HandleSnapshotAck(sender, data, size); });
+
+        m_HostedDriver.SetSnapshotRate(m_Config.SnapshotRate);
+        m_HostedDriver.GetInputHandler().SetInputApplyCallback(MakeMovementApplyCallback(kMaxStepDistance));
+
+        OLO_CORE_INFO("[LoadTest] Hosted server listening on port {} ({} Hz snapshots)", m_HostedPort,
+                      m_Config.SnapshotRate);
+        return true;
+    }
+
+    void LoadTestHarness::Start(const std::string& address, u16 port)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        OLO_CORE_ASSERT(!m_Running, "LoadTestHarness: already started");
+
+        InstallCallback();
+
+        m_Address = address;
+        m_Port = port;
+        m_Elapsed = 0.0f;
+        m_NextBotToConnect = 0;
+        m_ServerTickSamples.clear();
+
+        auto applyMovement = MakeMovementApplyCallback(kMaxStepDistance);
+        f32 const twoPi = 2.0f * std::numbers::pi_v<f32>;
+
+        // Build every bot before the first connect so the vector the status
+        // callback walks is never resized under it.
+        std::vector<Scope<Bot>> bots;
+        bots.reserve(m_Config.BotCount);
+        for (u32 i = 0; i < m_Config.BotCount; ++i)
+        {
+            auto bot = CreateScope<Bot>(m_Config.Seed + i);
+            bot->Driver.SetInputApplyCallback(applyMovement);
+            bot->Driver.GetInterpolator().SetServerTickRate(m_Config.SnapshotRate);
+            bot->Heading = bot->Rng.GetFloat32InRange(0.0f, twoPi);
+            bot->TurnPerUnit = 1.0f / bot->Rng.GetFloat32InRange(2.0f, 8.0f);
+            bots.push_back(std::move(bot));
+        }
+        {
+            TUniqueLock<FMutex> lock(s_ActiveMutex);
+            m_Bots = std::move(bots);
+        }
+
+        m_Running = true;
+        OLO_CORE_INFO("[LoadTest] {} bots ({}, {:.0f} inputs/s) -> {}:{} for {:.1f} s", m_Config.BotCount,
+                      BehaviorName(m_Config.Behavior), m_Config.InputRateHz, m_Address, m_Port,
+                      m_Config.DurationSeconds);
+    }
+
+    void LoadTestHarness::Tick(f32 dt)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        if (!m_Running)
+        {
+            return;
+        }
+
+        if (m_PumpCallbacks)
+        {
+            if (ISteamNetworkingSockets* sockets = SteamNetworkingSockets(); sockets != nullptr)
+            {
+                sockets->RunCallbacks();
+            }
+        }
+
+        ConnectPendingBots();
+
+        if (m_HostedServer)
+        {
+            TickHostedServer(dt);
+        }
+
+        for (auto const& bot : m_Bots)
+        {
+            if (bot->ConnectIssuedAt < 0.0f)
+            {
+                continue;
+            }
+            DriveBotInput(*bot, dt);
+            bot->Driver.Tick(*bot->World, *bot->Client, dt);
+        }
+
+        m_Elapsed += dt;
+    }
+
+    void LoadTestHarness::Stop()
+    {
+        OLO_PROFILE_FUNCTION();
+
+        for (auto const& bot : m_Bots)
+        {
+            bot->Client->Disconnect();
+        }
+        if (m_HostedServer)
+        {
+            m_HostedServer->Stop();
+        }
+
+        // Detach from the callback BEFORE destroying anything it could reach: once
+        // the lock is released no callback can be inside RouteStatusChange.
+        {
+            TUniqueLock<FMutex> lock(s_ActiveMutex);
+            if (s_Active == this)
+            {
+                s_Active = nullptr;
+                bool const forward = s_ForwardToNetworkManager.exchange(false, std::memory_order_acq_rel);
+                if (ISteamNetworkingUtils* utils = SteamNetworkingUtils(); utils != nullptr)
+                {
+                    utils->SetGlobalCallback_SteamNetConnectionStatusChanged(forward ? &ForwardToNetworkManager : nullptr);
+                }
+            }
+        }
+
+        m_Bots.clear();
+        m_HostedServer.reset();
+        m_HostedScene.reset();
+        m_Running = false;
+    }
+
+    void LoadTestHarness::RecordServerTick(f32 seconds)
+    {
+        if (m_Running && std::isfinite(seconds) && seconds >= 0.0f)
+        {
+            m_ServerTickSamples.push_back(seconds);
+        }
+    }
+
+    bool LoadTestHarness::IsFinished() const
+    {
+        return m_Running && m_Elapsed >= m_Config.DurationSeconds;
+    }
+
+    u32 LoadTestHarness::GetConnectedBotCount() const
+    {
+        u32 connected = 0;
+        for (auto const& bot : m_Bots)
+        {
+            if (bot->Driver.GetLocalClientID() != 0 && bot->Client->IsConnected())
+            {
+                ++connected;
+            }
+        }
+        return connected;
+    }
+
+    LoadTestReport LoadTestHarness::BuildReport() const
+    {
+        OLO_PROFILE_FUNCTION();
+
+        LoadTestReport report;
+        report.BotsRequested = m_Config.BotCount;
+        report.BotsConnected = GetConnectedBotCount();
+        report.ElapsedSeconds = m_Elapsed;
+
+        if (!m_ServerTickSamples.empty())
+        {
+            std::vector<f32> sorted = m_ServerTickSamples;
+            std::ranges::sort(sorted);
+            f64 total = 0.0;
+            for (f32 const sample : sorted)
+            {
+                total += sample;
+            }
+            report.ServerTicks = sorted.size();
+            report.ServerTickMeanMs = static_cast<f32>(total / static_cast<f64>(sorted.size())) * 1000.0f;
+            report.ServerTickP50Ms = NearestRank(sorted, 0.50f) * 1000.0f;
+            report.ServerTickP95Ms = NearestRank(sorted, 0.95f) * 1000.0f;
+            report.ServerTickP99Ms = NearestRank(sorted, 0.99f) * 1000.0f;
+            report.ServerTickMaxMs = sorted.back() * 1000.0f;
+        }
+
+        u64 snapshotBytes = 0;
+        u32 measuredClients = 0;
+        f64 downTotal = 0.0;
+        f64 upTotal = 0.0;
+        for (auto const& bot : m_Bots)
+        {
+            report.InputsSent += bot->InputsSent;
+
+            auto const& snapshots = bot->Driver.GetSnapshotStats();
+            report.Snapshots += snapshots.Count;
+            snapshotBytes += snapshots.TotalBytes;
+            report.SnapshotMaxBytes = std::max(report.SnapshotMaxBytes, snapshots.MaxBytes);
+
+            auto const& interp = bot->Driver.GetInterpolator().GetStats();
+            report.InterpolationFrames += interp.Frames;
+            report.StarvedFrames += interp.StarvedFrames;
+            report.Stalls += interp.Stalls;
+            report.BotsWithStalls += interp.Stalls != 0 ? 1 : 0;
+            report.StalledSeconds += interp.StalledSeconds;
+            report.LongestStallSeconds = std::max(report.LongestStallSeconds, interp.LongestStallSeconds);
+
+            f32 const window = m_Elapsed - bot->ConnectIssuedAt;
+            if (bot->ConnectIssuedAt < 0.0f || window <= 0.0f || bot->Driver.GetLocalClientID() == 0)
+            {
+                continue;
+            }
+            NetworkStats const stats = bot->Client->GetStats();
+            f32 const down = static_cast<f32>(stats.TotalBytesReceived) / window;
+            f32 const up = static_cast<f32>(stats.TotalBytesSent) / window;
+            downTotal += down;
+            upTotal += up;
+            report.ClientDownBytesPerSecMax = std::max(report.ClientDownBytesPerSecMax, down);
+            report.ClientUpBytesPerSecMax = std::max(report.ClientUpBytesPerSecMax, up);
+            ++measuredClients;
+        }
+
+        if (measuredClients > 0)
+        {
+            report.ClientDownBytesPerSecMean = static_cast<f32>(downTotal / measuredClients);
+            report.ClientUpBytesPerSecMean = static_cast<f32>(upTotal / measuredClients);
+        }
+        if (report.Snapshots > 0)
+        {
+            report.SnapshotMeanBytes = static_cast<f32>(static_cast<f64>(snapshotBytes) / static_cast<f64>(report.Snapshots));
+        }
+        return report;
+    }
+
+    void LoadTestHarness::InstallCallback()
+    {
+        TUniqueLock<FMutex> lock(s_ActiveMutex);
+        if (s_Active == this)
+        {
+            return;
+        }
+        OLO_CORE_ASSERT(s_Active == nullptr, "LoadTestHarness: another harness owns the GNS status callback");
+
+        // With NetworkManager up, its network thread already runs the GNS
+        // callbacks and its transports still need their events. Without it, nobody
+        // runs them unless Tick() does.
+        bool const engineNetworking = NetworkManager::IsInitialized();
+        m_PumpCallbacks = !engineNetworking;
+        s_ForwardToNetworkManager.store(engineNetworking, std::memory_order_release);
+        s_Active = this;
+
+        if (ISteamNetworkingUtils* utils = SteamNetworkingUtils(); utils != nullptr)
+        {
+            utils->SetGlobalCallback_SteamNetConnectionStatusChanged(&LoadTestHarness::OnConnectionStatusChanged);
+        }
+    }
+
+    void LoadTestHarness::ConnectPendingBots()
+    {
+        u32 issued = 0;
+        while (m_NextBotToConnect < m_Bots.size() && issued < m_Config.ConnectsPerTick)
+        {
+            Bot& bot = *m_Bots[m_NextBotToConnect++];
+            if (!bot.Client->Connect(m_Address, m_Port))
+            {
+                OLO_CORE_WARN("[LoadTest] Bot {} failed to start connecting", m_NextBotToConnect - 1);
+                continue;
+            }
+            bot.Driver.AttachTo(*bot.Client, *bot.World);
+            bot.ConnectIssuedAt = m_Elapsed;
+            ++issued;
+        }
+    }
+
+    void LoadTestHarness::TickHostedServer(f32 dt)
+    {
+        Timer timer;
+        m_HostedServer->PollMessages();
+        m_HostedDriver.Tick(*m_HostedScene, *m_HostedServer, dt);
+        RecordServerTick(timer.Elapsed());
+    }
+
+    void LoadTestHarness::DriveBotInput(Bot& bot, f32 dt)
+    {
+        if (m_Config.Behavior == ELoadTestBotBehavior::Idle || m_Config.InputRateHz <= 0.0f)
+        {
+            return;
+        }
+
+        if (bot.Pawn == 0)
+        {
+            // Resolved once: the pawn arrives a few snapshots after the connect.
+            bot.Pawn = bot.Driver.FindLocalPlayerEntity(*bot.World);
+            if (bot.Pawn == 0)
+            {
+                return;
+            }
+        }
+
+        f32 const interval = 1.0f / m_Config.InputRateHz;
+        f32 const step = std::min(m_Config.MoveSpeed * interval, kMaxStepDistance);
+        f32 const twoPi = 2.0f * std::numbers::pi_v<f32>;
+
+        bot.InputAccumulator += dt;
+        u32 budget = kMaxInputsPerTick;
+        while (bot.InputAccumulator >= interval && budget > 0)
+        {
+            bot.InputAccumulator -= interval;
+            --budget;
+
+            if (m_Config.Behavior == ELoadTestBotBehavior::Circle)
+            {
+                bot.Heading = std::fmod(bot.Heading + step * bot.TurnPerUnit, twoPi);
+            }
+            else
+            {
+                bot.HeadingTimer -= interval;
+                if (bot.HeadingTimer <= 0.0f)
+                {
+                    bot.Heading = bot.Rng.GetFloat32InRange(0.0f, twoPi);
+                    bot.HeadingTimer = bot.Rng.GetFloat32InRange(0.5f, 2.0f);
+                }
+            }
+
+            NetworkMovementInput input;
+            input.Delta = glm::vec3(std::cos(bot.Heading), 0.0f, std::sin(bot.Heading)) * step;
+            bot.Driver.SendInput(*bot.World, *bot.Client, bot.Pawn, input.Encode());
+            ++bot.InputsSent;
+        }
+        bot.InputAccumulator = std::min(bot.InputAccumulator, interval);
+    }
+} // namespace OloEngine
@@ -0,0 +1,189 @@
+#pragma once
+
+#include "OloEngine/Core/Base.h"
+#include "OloEngine/Networking/Core/ServerReplicationDriver.h"
+
+#include <string>
+#include <vector>
+
+struct SteamNetConnectionStatusChangedCallback_t;
+
+namespace OloEngine
+{
+    class NetworkServer;
+    class Scene;
+
+    // How scripted bots move. Idle bots still connect, receive and acknowledge
+    // snapshots — the pure replication cost with no input traffic.
+    enum class ELoadTestBotBehavior : u8
+    {
+        RandomWalk = 0,
+        Circle,
+        Idle
+    };
+
+    struct LoadTestConfig
+    {
+        u32 BotCount = 32;
+        // Movement commands each bot sends per second.
+        f32 InputRateHz = 30.0f;
+        // Units per second; each command carries MoveSpeed / InputRateHz, which
+        // must stay under the server's per-command clamp to measure anything real.
+        f32 MoveSpeed = 4.0f;
+        ELoadTestBotBehavior Behavior = ELoadTestBotBehavior::RandomWalk;
+        // Measured run length, counted from Start().
+        f32 DurationSeconds = 10.0f;
+        // Connects issued per Tick(). Hundreds of simultaneous handshakes measure
+        // the connect storm, not steady-state play.
+        u32 ConnectsPerTick = 16;
+        // Bot RNG seed; bot i uses Seed + i, so a run is reproducible.
+        u64 Seed = 1;
+        // The server's snapshot rate. A hosted server sends at it; the bots'
+        // interpolators assume it either way, so an attached host passes its own.
+        u32 SnapshotRate = 20;
+    };
+
+    // Everything a regression benchmark wants to compare between two builds.
+    // Percentiles are nearest-rank over every recorded server tick.
+    struct LoadTestReport
+    {
+        u32 BotsRequested = 0;
+        u32 BotsConnected = 0; // have a server-assigned client id
+        f32 ElapsedSeconds = 0.0f;
+
+        u64 ServerTicks = 0;
+        f32 ServerTickMeanMs = 0.0f;
+        f32 ServerTickP50Ms = 0.0f;
+        f32 ServerTickP95Ms = 0.0f;
+        f32 ServerTickP99Ms = 0.0f;
+        f32 ServerTickMaxMs = 0.0f;
+
+        // Per connected bot, over the whole run.
+        f32 ClientDownBytesPerSecMean = 0.0f;
+        f32 ClientDownBytesPerSecMax = 0.0f;
+        f32 ClientUpBytesPerSecMean = 0.0f;
+        f32 ClientUpBytesPerSecMax = 0.0f;
+
+        u64 Snapshots = 0;
+        f32 SnapshotMeanBytes = 0.0f;
+        u32 SnapshotMaxBytes = 0;
+
+        u64 InputsSent = 0;
+
+        // Summed over bots (SnapshotInterpolator::Stats).
+        u64 InterpolationFrames = 0;
+        u64 StarvedFrames = 0;
+        u32 Stalls = 0;
+        u32 BotsWithStalls = 0;
+        f32 StalledSeconds = 0.0f;
+        f32 LongestStallSeconds = 0.0f;
+
+        // `key: value` lines — valid YAML, and trivially diffable between runs.
+        [[nodiscard]] std::string ToString() const;
+        void Log() const;
+    };
+
+    // Headless load generator: hundreds of scripted players in one process,
+    // each a real NetworkClient + ClientReplicationDriver talking to the server
+    // over localhost. Nothing is mocked — bots connect, get a pawn, send
+    // NetworkMovementInput through the same SendInput path a player does, and
+    // consume snapshots through the same delta reassembly and interpolation.
+    //
+    // Two ways to use it:
+    //   * Hosted: StartHostedServer() brings up a NetworkServer +
+    //     ServerReplicationDriver on its own Scene, and Tick() times every server
+    //     tick itself. This is what the benchmark test runs.
+    //   * Attached: point Start() at a server someone else ticks (OloServer with
+    //     --bots) and feed that host's tick durations to RecordServerTick().
+    //
+    // GNS delivers connection status through one process-wide callback. While a
+    // harness is started it owns that callback and fans it out to its own
+    // transports, then on to NetworkManager if that is initialised, so it can run
+    // inside a normal engine host. When NetworkManager is not initialised there is
+    // no network thread either, and Tick() runs the GNS callbacks itself.
+    //
+    // Game thread only, like the replication drivers it wraps. The registries the
+    // drivers use (ComponentReplicator, ComponentInterpolationRegistry,
+    // NetworkSpawnRegistry) must already be populated — NetworkManager::Init does
+    // it in a real host.
+    class LoadTestHarness
+    {
+      public:
+        explicit LoadTestHarness(const LoadTestConfig& config);
+        ~LoadTestHarness();
+
+        LoadTestHarness(const LoadTestHarness&) = delete;
+        LoadTestHarness& operator=(const LoadTestHarness&) = delete;
+
+        // Listen on the first free port in [preferredPort, preferredPort + probes).
+        bool StartHostedServer(u16 preferredPort, i32 probes = 64);
+
+        // Create the bots and begin connecting them to `address:port`. With a
+        // hosted server, pass GetHostedPort(). Starts the run clock.
+        void Start(const std::string& address, u16 port);
+
+        // One frame: transport callbacks (when nobody else runs them), the hosted
+        // server tick, then every bot's input and client tick. `dt` is real frame
+        // time in seconds.
+        void Tick(f32 dt);
+
+        // Disconnect every bot and stop the hosted server. Idempotent.
+        void Stop();
+
+        // Server tick duration sample for the report, in seconds. Hosted mode
+        // records its own; an attached host calls this once per tick.
+        void RecordServerTick(f32 seconds);
+
+        [[nodiscard]] bool IsRunning() const
+        {
+            return m_Running;
+        }
+        [[nodiscard]] bool IsFinished() const;
+        [[nodiscard]] f32 GetElapsedSeconds() const
+        {
+            return m_Elapsed;
+        }
+
+        [[nodiscard]] u32 GetConnectedBotCount() const;
+        [[nodiscard]] u16 GetHostedPort() const
+        {
+            return m_HostedPort;
+        }
+        [[nodiscard]] const LoadTestConfig& GetConfig() const
+        {
+            return m_Config;
+        }
+
+        [[nodiscard]] LoadTestReport BuildReport() const;
+
+        // The process-wide GNS status callback while a harness is started.
+        static void OnConnectionStatusChanged(SteamNetConnectionStatusChangedCallback_t* info);
+
+      private:
+        struct Bot;
+
+        void InstallCallback();
+        void ConnectPendingBots();
+        void TickHostedServer(f32 dt);
+        void DriveBotInput(Bot& bot, f32 dt);
+        void RouteStatusChange(SteamNetConnectionStatusChangedCallback_t* info);
+
+        LoadTestConfig m_Config;
+        bool m_Running = false;
+        bool m_PumpCallbacks = false;
+        f32 m_Elapsed = 0.0f;
+
+        std::string m_Address;
+        u16 m_Port = 0;
+        u32 m_NextBotToConnect = 0;
+        // Sized once in Start() and never resized: the status callback walks it.
+        std::vector<Scope<Bot>> m_Bots;
+
+        Scope<Scene> m_HostedScene;
+        Scope<NetworkServer> m_HostedServer;
+        ServerReplicationDriver m_HostedDriver;
+        u16 m_HostedPort = 0;
+
+        std::vector<f32> m_ServerTickSamples;
+    };
+} // namespace OloEngine
@@ -0,0 +1,826 @@
+// Coroutine.h - C++20 coroutines on top of the task system
+// OloEngine addition; UE5.7 has no coroutine layer over Tasks
+
+#pragma once
+
+#include "OloEngine/Core/Base.h"
+#include "OloEngine/Core/Log.h"
+#include "OloEngine/Task/CancellationToken.h"
+#include "OloEngine/Task/NamedThreads.h"
+#include "OloEngine/Task/Pipe.h"
+#include "OloEngine/Task/Task.h"
+#include "OloEngine/Threading/Mutex.h"
+#include "OloEngine/Threading/UniqueLock.h"
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <type_traits>
+
+// @brief Task-returning coroutines that suspend instead of blocking a worker
+//
+// A function returning TCoTask<T> is a coroutine whose body runs on the task
+// scheduler. Every co_await on something that is not ready yet suspends the
+// frame and hands the rest of the body back to the scheduler as a new task, so
+// a load waiting on I/O, another task or the game thread never parks a worker.
+//
+// Usage:
+// @code
+// TCoTask<Ref<Mesh>> LoadMesh(AssetHandle Handle, const FCancellationToken& Token, ETaskPriority Priority)
+// {
+//     // Starts on a worker at Priority
+//     std::vector<u8> Bytes = co_await Launch("ReadMesh", [Handle] { return ReadBytes(Handle); });
+//     Ref<Mesh> Mesh = Decode(Bytes);     // still on a worker
+//     co_await ResumeOnGameThread();      // next game-thread pump
+//     Mesh->Upload();
+//     co_return Mesh;
+// }
+//
+// TCoTask<Ref<Mesh>> Load = LoadMesh(Handle, Token, ETaskPriority::BackgroundNormal);
+// ...
+// if (Load.IsCompleted() && !Load.IsCanceled()) { Use(Load.GetResult()); }
+// @endcode
+//
+// Awaitables:
+// - TTask<T>, FTask, FTaskEvent: resumes on a worker once the task completes; yields the result
+// - TCoTask<T>: same, for another coroutine
+// - ResumeOn(Pipe): continues inside the pipe, serialized with its other tasks
+// - ResumeOnGameThread(): continues on the game thread at its next ProcessTasks()
+// - ResumeOnScheduler([Priority]): continues on a worker; also a plain yield
+// - IsCancelRequested(): bool, never suspends
+//
+// Scheduling and cancellation are taken from the coroutine's own parameters: an
+// ETaskPriority parameter sets the priority of the start and of every worker
+// resume (Normal otherwise), and an FCancellationToken parameter is observed in
+// addition to the task's own token (TCoTask::Cancel). The token parameter must be
+// a reference (enforced at compile time) to a token that outlives the body; it
+// is observed only until the coroutine finishes. Cancellation is checked at
+// every co_await and again when a suspended coroutine is resumed: a canceled
+// coroutine is destroyed there instead of continuing, so its locals unwind
+// normally, and it completes without a result. Awaiting a coroutine that was
+// canceled cancels the awaiter too.
+//
+// Notes:
+// - Bodies resume on whatever worker picks them up; don't hold thread-affine
+//   state (locks, FCancellationTokenScope) across a co_await
+// - TCoTask handles may be dropped; the body still runs to completion
+// - Wait() from the game thread on a coroutine that is suspended in
+//   ResumeOnGameThread() deadlocks, as waiting on any game-thread task does
+// - A body that throws finishes as canceled; the exception is logged
+namespace OloEngine::Tasks
+{
+    template<typename ResultType>
+    class TCoTask;
+
+    namespace Private
+    {
+        // State shared by a coroutine frame and the TCoTask handles that refer to
+        // it. Outlives the frame, which destroys itself when the body finishes or is
+        // canceled.
+        class FCoroutineState
+        {
+          public:
+            FCoroutineState()
+                : Completion("CoroutineCompletion")
+            {
+            }
+
+            bool IsCancelRequested() const
+            {
+                if (Token.IsCanceled())
+                {
+                    return true;
+                }
+                TUniqueLock<FMutex> Lock(m_ExternalTokenMutex);
+                return m_ExternalToken && m_ExternalToken->IsCanceled();
+            }
+
+            // Observe the coroutine's FCancellationToken parameter, a reference into
+            // the caller that may end its lifetime once the coroutine has finished
+            void BindExternalToken(const FCancellationToken& External)
+            {
+                TUniqueLock<FMutex> Lock(m_ExternalTokenMutex);
+                m_ExternalToken = &External;
+            }
+
+            // The frame is going away: keep a cancellation the external token already
+            // requested, in Token, and stop observing the external token. Handles
+            // outlive the frame and must not read it afterwards.
+            void ReleaseExternalToken()
+            {
+                TUniqueLock<FMutex> Lock(m_ExternalTokenMutex);
+                if (m_ExternalToken && m_ExternalToken->IsCanceled())
+                {
+                    Token.Cancel();
+                }
+                m_ExternalToken = nullptr;
+            }
+
+            // A resume is about to be scheduled. Only the thread that suspended the
+            // frame calls this, so the count needs no synchronization of its own.
+            u64 BeginStep()
+            {
+                return ++m_StepsBegun;
+            }
+
+            // Record the task that will run step `Step`, for Wait() to retract. The
+            // step may already have run and published its successor, so an older
+            // step never overwrites a newer one.
+            void PublishStep(u64 Step, FTask StepTask)
+            {
+                TUniqueLock<FMutex> Lock(m_StepMutex);
+                if (Step > m_PublishedStep)
+                {
+                    m_PublishedStep = Step;
+                    m_StepTask = MoveTemp(StepTask);
+                }
+            }
+
+            FTask GetStepTask() const
+            {
+                TUniqueLock<FMutex> Lock(m_StepMutex);
+                return m_StepTask;
+            }
+
+            // Destroys the suspended frame instead of resuming it. The promise
+            // destructor triggers Completion.
+            void CancelFrame(std::coroutine_handle<> Frame)
+            {
+                bCanceled.store(true, std::memory_order_release);
+                Frame.destroy();
+            }
+
+            FTaskEvent Completion;
+            FCancellationToken Token;
+            ETaskPriority Priority = ETaskPriority::Normal;
+            // Finished without a result (canceled, or the body threw)
+            std::atomic<bool> bCanceled{ false };
+
+          private:
+            u64 m_StepsBegun = 0;
+            mutable FMutex m_StepMutex;
+            u64 m_PublishedStep = 0;
+            FTask m_StepTask;
+            mutable FMutex m_ExternalTokenMutex;
+            const FCancellationToken* m_ExternalToken = nullptr;
+        };
+
+        template<typename ResultType>
+        class TCoroutineState : public FCoroutineState
+        {
+          public:
+            std::optional<ResultType> Result;
+        };
+
+        template<>
+        class TCoroutineState<void> : public FCoroutineState
+        {
+        };
+
+        class FCoTaskPromiseBase;
+
+        // Body of a scheduled resume: resumes the frame, or destroys it if it was
+        // canceled while suspended. Copyable, as game-thread tasks require.
+        struct FResumeBody
+        {
+            std::coroutine_handle<> Frame;
+            std::shared_ptr<FCoroutineState> State;   // null for coroutine types other than TCoTask
+            std::shared_ptr<FCoroutineState> Awaited; // the TCoTask being awaited, if any
+
+            void operator()() const
+            {
+                if (State && (State->IsCancelRequested() || (Awaited && Awaited->bCanceled.load(std::memory_order_acquire))))
+                {
+                    State->CancelFrame(Frame);
+                    return;
+                }
+                Frame.resume();
+            }
+        };
+
+        template<typename PromiseType>
+        FResumeBody MakeResumeBody(std::coroutine_handle<PromiseType> Frame, std::shared_ptr<FCoroutineState> Awaited = {});
+
+        // Schedules Body on a worker once Prerequisite (if valid) has completed
+        inline void ScheduleResume(FResumeBody Body, FTask Prerequisite, std::optional<ETaskPriority> Priority = {})
+        {
+            // Body may run, and destroy the frame, before Launch returns; keep what
+            // is needed afterwards in locals.
+            std::shared_ptr<FCoroutineState> State = Body.State;
+            u64 const Step = State ? State->BeginStep() : 0;
+            ETaskPriority const ResumePriority = Priority.value_or(State ? State->Priority : ETaskPriority::Normal);
+
+            FTask StepTask = Prerequisite.IsValid()
+                                 ? FTask(Tasks::Launch("CoroutineResume", MoveTemp(Body), Tasks::Prerequisites(Prerequisite), ResumePriority))
+                                 : FTask(Tasks::Launch("CoroutineResume", MoveTemp(Body), ResumePriority));
+            if (State)
+            {
+                State->PublishStep(Step, MoveTemp(StepTask));
+            }
+        }
+
+        // The awaiter a plain co_await would use for Awaitable
+        template<typename AwaitableType>
+        decltype(auto) GetAwaiter(AwaitableType&& Awaitable)
+        {
+            if constexpr (requires { Forward<AwaitableType>(Awaitable).operator co_await(); })
+            {
+                return Forward<AwaitableType>(Awaitable).operator co_await();
+            }
+            else if constexpr (requires { operator co_await(Forward<AwaitableType>(Awaitable)); })
+            {
+                return operator co_await(Forward<AwaitableType>(Awaitable));
+            }
+            else
+            {
+                return Forward<AwaitableType>(Awaitable);
+            }
+        }
+
+        // Makes every co_await in a TCoTask body a cancellation point, ready or
+        // not: once cancellation is requested the frame is destroyed there instead
+        // of continuing.
+        template<typename AwaiterType>
+        class TCancelableAwaiter
+        {
+          public:
+            TCancelableAwaiter(AwaiterType&& InAwaiter, const FCoroutineState& InState)
+                : m_Awaiter(Forward<AwaiterType>(InAwaiter)), m_State(InState)
+            {
+            }
+
+            bool await_ready()
+            {
+                return !m_State.IsCancelRequested() && m_Awaiter.await_ready();
+            }
+
+            template<typename PromiseType>
+            auto await_suspend(std::coroutine_handle<PromiseType> Frame) -> decltype(std::declval<AwaiterType&>().await_suspend(Frame))
+            {
+                using FResult = decltype(m_Awaiter.await_suspend(Frame));
+                if (m_State.IsCancelRequested())
+                {
+                    // Destroys this awaiter along with the frame; touch nothing after
+                    std::shared_ptr<FCoroutineState> State = Frame.promise().GetState();
+                    State->CancelFrame(Frame);
+                    if constexpr (std::is_same_v<FResult, bool>)
+                    {
+                        return true;
+                    }
+                    else if constexpr (!std::is_void_v<FResult>)
+                    {
+                        return std::noop_coroutine();
+                    }
+                    else
+                    {
+                        return;
+                    }
+                }
+                return m_Awaiter.await_suspend(Frame);
+            }
+
+            decltype(auto) await_resume()
+            {
+                return m_Awaiter.await_resume();
+            }
+
+          private:
+            AwaiterType m_Awaiter; // a reference when the awaitable is its own awaiter
+            const FCoroutineState& m_State;
+        };
+
+        // Shared base of every TCoTask promise
+        class FCoTaskPromiseBase
+        {
+          public:
+            struct FInitialAwaiter
+            {
+                bool await_ready() const noexcept
+                {
+                    return false;
+                }
+
+                template<typename PromiseType>
+                void await_suspend(std::coroutine_handle<PromiseType> Frame) const
+                {
+                    // Also a cancellation point: a task canceled before a worker
+                    // picked it up never runs its body.
+                    ScheduleResume(MakeResumeBody(Frame), FTask());
+                }
+
+                void await_resume() const noexcept {}
+            };
+
+            struct FCancellationQuery
+            {
+            };
+
+            struct FCancellationQueryAwaiter
+            {
+                bool bCanceled;
+
+                bool await_ready() const noexcept
+                {
+                    return true;
+                }
+                void await_suspend(std::coroutine_handle<>) const noexcept {}
+                bool await_resume() const noexcept
+                {
+                    return bCanceled;
+                }
+            };
+
+            template<typename... ArgTypes>
+            FCoTaskPromiseBase(std::shared_ptr<FCoroutineState> State, ArgTypes&... Args)
+                : m_State(MoveTemp(State))
+            {
+                (BindArgument(Args), ...);
+            }
+
+            ~FCoTaskPromiseBase()
+            {
+                // The body has finished or the frame was canceled; either way nothing
+                // of the frame is left for waiters to depend on.
+                m_State->ReleaseExternalToken();
+                m_State->Completion.Trigger();
+            }
+
+            FCoTaskPromiseBase(const FCoTaskPromiseBase&) = delete;
+            FCoTaskPromiseBase& operator=(const FCoTaskPromiseBase&) = delete;
+
+            FInitialAwaiter initial_suspend() const noexcept
+            {
+                return {};
+            }
+
+            std::suspend_never final_suspend() const noexcept
+            {
+                return {};
+            }
+
+            void unhandled_exception()
+            {
+                try
+                {
+                    throw;
+                }
+                catch (const std::exception& e)
+                {
+                    OLO_CORE_ERROR("[Tasks] Unhandled exception in coroutine: {}", e.what());
+                }
+                catch (...)
+                {
+                    OLO_CORE_ERROR("[Tasks] Unknown exception in coroutine");
+                }
+                m_State->bCanceled.store(true, std::memory_order_release);
+            }
+
+            FCancellationQueryAwaiter await_transform(FCancellationQuery) const
+            {
+                return { m_State->IsCancelRequested() };
+            }
+
+            template<typename AwaitableType>
+            auto await_transform(AwaitableType&& Awaitable) const
+            {
+                using FAwaiter = decltype(GetAwaiter(Forward<AwaitableType>(Awaitable)));
+                return TCancelableAwaiter<FAwaiter>(GetAwaiter(Forward<AwaitableType>(Awaitable)), *m_State);
+            }
+
+            const std::shared_ptr<FCoroutineState>& GetState() const
+            {
+                return m_State;
+            }
+
+          private:
+            void BindArgument(const FCancellationToken& Token)
+            {
+                m_State->BindExternalToken(Token);
+            }
+
+            void BindArgument(ETaskPriority Priority)
+            {
+                m_State->Priority = Priority;
+            }
+
+            template<typename ArgType>
+            void BindArgument(const ArgType&)
+            {
+            }
+
+          protected:
+            std::shared_ptr<FCoroutineState> m_State;
+        };
+
+        template<typename ResultType>
+        class TCoTaskPromise : public FCoTaskPromiseBase
+        {
+          public:
+            template<typename... ArgTypes>
+            explicit TCoTaskPromise(ArgTypes&... Args)
+                : FCoTaskPromiseBase(std::make_shared<TCoroutineState<ResultType>>(), Args...)
+            {
+            }
+
+            TCoTask<ResultType> get_return_object();
+
+            template<typename ValueType>
+            void return_value(ValueType&& Value)
+            {
+                static_cast<TCoroutineState<ResultType>&>(*m_State).Result.emplace(Forward<ValueType>(Value));
+            }
+        };
+
+        template<>
+        class TCoTaskPromise<void> : public FCoTaskPromiseBase
+        {
+          public:
+            template<typename... ArgTypes>
+            explicit TCoTaskPromise(ArgTypes&... Args)
+                : FCoTaskPromiseBase(std::make_shared<TCoroutineState<void>>(), Args...)
+            {
+            }
+
+            TCoTask<void> get_return_object();
+
+            void return_void() const noexcept {}
+        };
+
+        template<typename PromiseType>
+        FResumeBody MakeResumeBody(std::coroutine_handle<PromiseType> Frame, std::shared_ptr<FCoroutineState> Awaited)
+        {
+            FResumeBody Body{ Frame, nullptr, MoveTemp(Awaited) };
+            if constexpr (std::is_base_of_v<FCoTaskPromiseBase, PromiseType>)
+            {
+                Body.State = Frame.promise().GetState();
+            }
+            return Body;
+        }
+
+        // co_await on a plain task or event
+        class FTaskAwaiter
+        {
+          public:
+            explicit FTaskAwaiter(FTask InTask)
+                : m_Task(MoveTemp(InTask))
+            {
+            }
+
+            bool await_ready() const
+            {
+                return m_Task.IsCompleted();
+            }
+
+            template<typename PromiseType>
+            void await_suspend(std::coroutine_handle<PromiseType> Frame)
+            {
+                ScheduleResume(MakeResumeBody(Frame), m_Task);
+            }
+
+            void await_resume() const noexcept {}
+
+          private:
+            FTask m_Task;
+        };
+
+        inline FTaskAwaiter operator co_await(FTaskHandle Task)
+        {
+            return FTaskAwaiter(MoveTemp(Task));
+        }
+
+        // co_await on another TCoTask
+        template<typename ResultType>
+        class TCoTaskAwaiter
+        {
+          public:
+            explicit TCoTaskAwaiter(std::shared_ptr<TCoroutineState<ResultType>> InState)
+                : m_State(MoveTemp(InState))
+            {
+            }
+
+            bool await_ready() const
+            {
+                // A canceled coroutine suspends, so the resume can cancel the awaiter
+                return m_State->Completion.IsCompleted() && !m_State->bCanceled.load(std::memory_order_acquire);
+            }
+
+            template<typename PromiseType>
+            void await_suspend(std::coroutine_handle<PromiseType> Frame)
+            {
+                ScheduleResume(MakeResumeBody(Frame, m_State), m_State->Completion);
+            }
+
+            decltype(auto) await_resume() const
+            {
+                OLO_CORE_ASSERT(!m_State->bCanceled.load(std::memory_order_acquire), "Awaited coroutine was canceled");
+                if constexpr (!std::is_void_v<ResultType>)
+                {
+                    return static_cast<ResultType&>(*m_State->Result);
+                }
+            }
+
+          private:
+            std::shared_ptr<TCoroutineState<ResultType>> m_State;
+        };
+    } // namespace Private
+
+    // @class TCoTask
+    // @brief Handle to a coroutine running on the task scheduler
+    //
+    // Copyable; all copies refer to the same coroutine. Can be co_awaited from
+    // another TCoTask, waited on, or used as a prerequisite via GetCompletionTask().
+    template<typename ResultType>
+    class TCoTask
+    {
+      public:
+        using promise_type = Private::TCoTaskPromise<ResultType>;
+
+        TCoTask() = default;
+
+        bool IsValid() const
+        {
+            return m_State != nullptr;
+        }
+
+        bool IsCompleted() const
+        {
+            return !IsValid() || m_State->Completion.IsCompleted();
+        }
+
+        // @brief Completed without a result: canceled, or the body threw
+        bool IsCanceled() const
+        {
+            return IsValid() && IsCompleted() && m_State->bCanceled.load(std::memory_order_acquire);
+        }
+
+        // @brief Cancel() was called, or the bound FCancellationToken was canceled
+        // before the coroutine finished
+        bool IsCancelRequested() const
+        {
+            return IsValid() && m_State->IsCancelRequested();
+        }
+
+        // @brief Request cancellation; the coroutine stops at its next resume
+        void Cancel() const
+        {
+            if (IsValid())
+            {
+                m_State->Token.Cancel();
+            }
+        }
+
+        // @brief Block until the coroutine finishes
+        //
+        // If the next step has not been picked up by a worker yet it is retracted
+        // and run on this thread, as TTask::Wait does, so waiting makes progress
+        // even with no workers running.
+        void Wait() const
+        {
+            if (!IsValid())
+            {
+                return;
+            }
+            while (!m_State->Completion.IsCompleted())
+            {
+                FTask Step = m_State->GetStepTask();
+                if (!Step.IsValid() || Step.IsCompleted())
+                {
+                    // Suspended on something that isn't a worker task (the game
+                    // thread, a foreign awaitable) or between two steps
+                    m_State->Completion.Wait();
+                    return;
+                }
+                Step.Wait();
+            }
+        }
+
+        bool Wait(FMonotonicTimeSpan Timeout) const
+        {
+            return !IsValid() || m_State->Completion.Wait(Timeout);
+        }
+
+        // @brief Wait for and return the result. Must not be canceled.
+        template<typename T = ResultType>
+            requires(!std::is_void_v<T>)
+        T& GetResult() const
+        {
+            OLO_CORE_ASSERT(IsValid(), "Cannot get result from invalid coroutine");
+            Wait();
+            OLO_CORE_ASSERT(!m_State->bCanceled.load(std::memory_order_acquire), "Coroutine was canceled and has no result");
+            return *GetTypedState().Result;
+        }
+
+        // @brief Completes with the coroutine; usable as a task prerequisite
+        FTask GetCompletionTask() const
+        {
+            return IsValid() ? FTask(m_State->Completion) : FTask();
+        }
+
+        Private::TCoTaskAwaiter<ResultType> operator co_await() const
+        {
+            OLO_CORE_ASSERT(IsValid(), "Cannot await an invalid coroutine");
+            return Private::TCoTaskAwaiter<ResultType>(std::static_pointer_cast<Private::TCoroutineState<ResultType>>(m_State));
+        }
+
+      private:
+        friend class Private::TCoTaskPromise<ResultType>;
+
+        explicit TCoTask(std::shared_ptr<Private::FCoroutineState> State)
+            : m_State(MoveTemp(State))
+        {
+        }
+
+        Private::TCoroutineState<ResultType>& GetTypedState() const
+        {
+            return static_cast<Private::TCoroutineState<ResultType>&>(*m_State);
+        }
+
+        std::shared_ptr<Private::FCoroutineState> m_State;
+    };
+
+    namespace Private
+    {
+        template<typename ResultType>
+        TCoTask<ResultType> TCoTaskPromise<ResultType>::get_return_object()
+        {
+            return TCoTask<ResultType>(m_State);
+        }
+
+        inline TCoTask<void> TCoTaskPromise<void>::get_return_object()
+        {
+            return TCoTask<void>(m_State);
+        }
+
+        // co_await on a task with a result; yields a reference to the result,
+        // valid until the end of the full expression
+        template<typename ResultType>
+        class TTaskAwaiter
+        {
+          public:
+            explicit TTaskAwaiter(TTask<ResultType> InTask)
+                : m_Task(MoveTemp(InTask))
+            {
+            }
+
+            bool await_ready() const
+            {
+                return m_Task.IsCompleted();
+            }
+
+            template<typename PromiseType>
+            void await_suspend(std::coroutine_handle<PromiseType> Frame)
+            {
+                ScheduleResume(MakeResumeBody(Frame), m_Task);
+            }
+
+            decltype(auto) await_resume()
+            {
+                return m_Task.GetResult();
+            }
+
+          private:
+            TTask<ResultType> m_Task;
+        };
+
+        class FPipeAwaiter
+        {
+          public:
+            explicit FPipeAwaiter(FPipe& InPipe)
+                : m_Pipe(InPipe)
+            {
+            }
+
+            bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            template<typename PromiseType>
+            void await_suspend(std::coroutine_handle<PromiseType> Frame)
+            {
+                FResumeBody Body = MakeResumeBody(Frame);
+                std::shared_ptr<FCoroutineState> State = Body.State;
+                u64 const Step = State ? State->BeginStep() : 0;
+                ETaskPriority const Priority = State ? State->Priority : ETaskPriority::Default;
+                FTask StepTask = m_Pipe.Launch("CoroutineResume", MoveTemp(Body), Priority);
+                if (State)
+                {
+                    State->PublishStep(Step, MoveTemp(StepTask));
+                }
+            }
+
+            void await_resume() const noexcept {}
+
+          private:
+            FPipe& m_Pipe;
+        };
+
+        class FGameThreadAwaiter
+        {
+          public:
+            bool await_ready() const
+            {
+                return FNamedThreadManager::Get().GetCurrentThreadIfKnown() == ENamedThread::GameThread;
+            }
+
+            template<typename PromiseType>
+            void await_suspend(std::coroutine_handle<PromiseType> Frame)
+            {
+                FResumeBody Body = MakeResumeBody(Frame);
+                if (Body.State)
+                {
+                    // No worker task to retract for this step
+                    Body.State->PublishStep(Body.State->BeginStep(), FTask());
+                }
+                Tasks::EnqueueGameThreadTask(MoveTemp(Body), "CoroutineResume");
+            }
+
+            void await_resume() const noexcept {}
+        };
+
+        class FSchedulerAwaiter
+        {
+          public:
+            explicit FSchedulerAwaiter(std::optional<ETaskPriority> InPriority)
+                : m_Priority(InPriority)
+            {
+            }
+
+            bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            template<typename PromiseType>
+            void await_suspend(std::coroutine_handle<PromiseType> Frame)
+            {
+                FResumeBody Body = MakeResumeBody(Frame);
+                if (Body.State && m_Priority)
+                {
+                    Body.State->Priority = *m_Priority;
+                }
+                ScheduleResume(MoveTemp(Body), FTask(), m_Priority);
+            }
+
+            void await_resume() const noexcept {}
+
+          private:
+            std::optional<ETaskPriority> m_Priority;
+        };
+    } // namespace Private
+
+    template<typename ResultType>
+    Private::TTaskAwaiter<ResultType> operator co_await(TTask<ResultType> Task)
+    {
+        return Private::TTaskAwaiter<ResultType>(MoveTemp(Task));
+    }
+
+    // @brief Continue the coroutine inside Pipe, serialized with its other tasks,
+    // until the next suspension
+    inline Private::FPipeAwaiter ResumeOn(FPipe& Pipe)
+    {
+        return Private::FPipeAwaiter(Pipe);
+    }
+
+    // @brief Continue the coroutine on the game thread at its next ProcessTasks().
+    // Doesn't suspend if already there.
+    inline Private::FGameThreadAwaiter ResumeOnGameThread()
+    {
+        return {};
+    }
+
+    // @brief Continue the coroutine on a worker at its own priority
+    inline Private::FSchedulerAwaiter ResumeOnScheduler()
+    {
+        return Private::FSchedulerAwaiter(std::nullopt);
+    }
+
+    // @brief Continue the coroutine on a worker at Priority, which also becomes the
+    // priority of its later resumes
+    inline Private::FSchedulerAwaiter ResumeOnScheduler(ETaskPriority Priority)
+    {
+        return Private::FSchedulerAwaiter(Priority);
+    }
+
+    // @brief co_await in a TCoTask body: true once cancellation was requested.
+    // For long stretches between suspension points.
+    inline Private::FCoTaskPromiseBase::FCancellationQuery IsCancelRequested()
+    {
+        return {};
+    }
+} // namespace OloEngine::Tasks
+
+// Every TCoTask coroutine gets its promise through here rather than from
+// TCoTask::promise_type, so its parameter list can be checked: the promise
+// observes an FCancellationToken parameter by address, and a token taken by
+// value would live in the frame the handles outlive.
+template<typename ResultType, typename... ArgTypes>
+struct std::coroutine_traits<OloEngine::Tasks::TCoTask<ResultType>, ArgTypes...>
+{
+    static_assert(((!std::is_same_v<std::remove_cvref_t<ArgTypes>, OloEngine::Tasks::FCancellationToken> || std::is_lvalue_reference_v<ArgTypes>) && ...),
+                  "Take a TCoTask coroutine's FCancellationToken parameter by reference");
+
+    using promise_type = OloEngine::Tasks::Private::TCoTaskPromise<ResultType>;
+};
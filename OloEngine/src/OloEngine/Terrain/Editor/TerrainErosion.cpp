@@ -6,6 +6,7 @@
 #include "OloEngine/Renderer/HeapBindingSeam.h"
 #include "OloEngine/Renderer/RenderCommand.h"
 #include "OloEngine/Renderer/MemoryBarrierFlags.h"
+#include "OloEngine/Terrain/HydraulicErosion.h"
 #include "OloEngine/Terrain/TerrainData.h"
 #include "OloEngine/Core/FastRandom.h"
 
@@ -134,6 +135,56 @@ namespace OloEngine
         ++m_IterationSeed;
     }
 
+    void TerrainErosion::ApplyCPU(std::vector<f32>& heights, u32 resolution, const ErosionSettings& settings, u32 seed)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        if (settings.DropletCount == 0)
+        {
+            return;
+        }
+
+        // ErosionParams mirrors ErosionSettings field for field; DropletCount
+        // is non-zero here, so the generator's "0 → auto" never applies.
+        ErosionParams params;
+        params.DropletCount = settings.DropletCount;
+        params.MaxDropletSteps = settings.MaxDropletSteps;
+        params.Inertia = settings.Inertia;
+        params.SedimentCapacity = settings.SedimentCapacity;
+        params.MinSedimentCapacity = settings.MinSedimentCapacity;
+        params.DepositSpeed = settings.DepositSpeed;
+        params.ErodeSpeed = settings.ErodeSpeed;
+        params.EvaporateSpeed = settings.EvaporateSpeed;
+        params.Gravity = settings.Gravity;
+        params.InitialWater = settings.InitialWater;
+        params.InitialSpeed = settings.InitialSpeed;
+        params.ErosionRadius = settings.ErosionRadius;
+        HydraulicErosion::ErodeParallel(heights, resolution, params, seed);
+    }
+
+    void TerrainErosion::ApplyCPU(TerrainData& terrainData, const ErosionSettings& settings, u32 iterations, u32 seed)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        const u32 resolution = terrainData.GetResolution();
+        if (resolution == 0 || iterations == 0)
+        {
+            return;
+        }
+
+        for (u32 i = 0; i < iterations; ++i)
+        {
+            ApplyCPU(terrainData.GetHeightData(), resolution, settings, seed + i);
+        }
+
+        // Headless terrain has no GPU heightmap to keep in sync. Update the
+        // existing texture in place — chunks and materials hold on to it.
+        if (terrainData.GetGPUHeightmap())
+        {
+            terrainData.UploadRegionToGPU(0, 0, resolution, resolution);
+        }
+    }
+
     void TerrainErosion::ApplyIterations(TerrainData& terrainData, const ErosionSettings& settings, u32 iterations)
     {
         OLO_PROFILE_FUNCTION();
@@ -3,6 +3,8 @@
 #include "OloEngine/Core/Base.h"
 #include "OloEngine/Core/Ref.h"
 
+#include <vector>
+
 namespace OloEngine
 {
     class ComputeShader;
@@ -27,6 +29,8 @@ namespace OloEngine
 
     // GPU-accelerated hydraulic erosion for terrain heightmaps.
     // Uses a compute shader where each thread simulates one water droplet.
+    // ApplyCPU runs the same droplet model on the task workers instead
+    // (HydraulicErosion) for headless bakes with no GPU.
     class TerrainErosion
     {
       public:
@@ -41,6 +45,30 @@ namespace OloEngine
 
         [[nodiscard]] bool IsReady() const;
 
+        // The seed the next Apply passes to the shader as u_Seed. Random per
+        // instance; set it to reproduce a pass, e.g. with ApplyCPU.
+        [[nodiscard]] u32 GetIterationSeed() const
+        {
+            return m_IterationSeed;
+        }
+        void SetIterationSeed(u32 seed)
+        {
+            m_IterationSeed = seed;
+        }
+
+        // One erosion pass on the CPU, across the task workers. Needs no GL
+        // context and no instance: `heights` is row-major, resolution ×
+        // resolution, and `seed` plays u_Seed's part, so droplet i starts where
+        // the shader's thread i would. Deterministic for given inputs; since the
+        // GPU's concurrent droplets race and these don't, the two agree closely
+        // rather than exactly. Like Apply, the result is not clamped.
+        static void ApplyCPU(std::vector<f32>& heights, u32 resolution, const ErosionSettings& settings, u32 seed);
+
+        // `iterations` CPU passes on a TerrainData's heights, seeded seed,
+        // seed + 1, ... as successive Apply calls would be, then re-uploads the
+        // GPU heightmap if the terrain has one.
+        static void ApplyCPU(TerrainData& terrainData, const ErosionSettings& settings, u32 iterations, u32 seed);
+
       private:
         Ref<ComputeShader> m_ErosionShader;
         // Terrain_Erosion.comp's former bare uniforms (issue #691), at
@@ -0,0 +1,360 @@
+#include "OloEnginePCH.h"
+#include "OloEngine/Terrain/HydraulicErosion.h"
+
+#include "OloEngine/Task/ParallelFor.h"
+
+#include <glm/glm.hpp>
+#include <glm/gtc/constants.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace OloEngine
+{
+    namespace
+    {
+        // Uniform [0,1) float, byte-for-byte the shader's randomFloat.
+        [[nodiscard]] f32 RandomFloat(u32 seed)
+        {
+            return static_cast<f32>(HydraulicErosion::PcgHash(seed)) * (1.0f / 4294967296.0f);
+        }
+
+        // One texel offset in the radial erosion brush plus its normalized weight.
+        struct ErosionBrushPoint
+        {
+            i32 Dx;
+            i32 Dy;
+            f32 Weight;
+        };
+
+        struct HeightGrad
+        {
+            f32 Height;
+            f32 GradX;
+            f32 GradY;
+        };
+
+        // The limits every pass applies, so a corrupt param can't spin a bake.
+        // Droplets: 0 → one per cell (resolution²), at most four per cell.
+        [[nodiscard]] u32 ClampedDropletCount(const ErosionParams& params, u32 resolution)
+        {
+            const u64 cells = static_cast<u64>(resolution) * resolution;
+            const u64 count = (params.DropletCount == 0) ? cells : params.DropletCount;
+            return static_cast<u32>(std::min<u64>(count, 4u * cells));
+        }
+
+        [[nodiscard]] u32 ClampedMaxSteps(const ErosionParams& params)
+        {
+            return std::min(params.MaxDropletSteps, 256u);
+        }
+
+        [[nodiscard]] i32 ClampedRadius(const ErosionParams& params)
+        {
+            return std::clamp(static_cast<i32>(params.ErosionRadius), 1, 16);
+        }
+
+        [[nodiscard]] bool IsErodible(const std::vector<f32>& heights, u32 resolution)
+        {
+            if (resolution < 2)
+                return false;
+            if (heights.size() != static_cast<sizet>(resolution) * resolution)
+            {
+                OLO_CORE_ERROR("HydraulicErosion - height buffer ({}) does not match resolution {}x{}",
+                               heights.size(), resolution, resolution);
+                return false;
+            }
+            return true;
+        }
+
+        // Where droplet `droplet` of a pass seeded `seed` starts, and the RNG
+        // state it carries on with — thread `droplet` of the shader's main().
+        struct DropletStart
+        {
+            f32 X;
+            f32 Y;
+            u32 Rng;
+        };
+
+        [[nodiscard]] DropletStart StartOf(u32 droplet, u32 seed, f32 fMaxIdx)
+        {
+            DropletStart start{};
+            start.Rng = HydraulicErosion::PcgHash(droplet + seed);
+            start.X = RandomFloat(start.Rng) * fMaxIdx;
+            start.Rng = HydraulicErosion::PcgHash(start.Rng);
+            start.Y = RandomFloat(start.Rng) * fMaxIdx;
+            return start;
+        }
+
+        // The shader's per-droplet loop over one height field. Stateless
+        // between droplets apart from the field, so any two droplets whose
+        // halos don't overlap can run on different threads.
+        class DropletSimulator
+        {
+          public:
+            DropletSimulator(std::vector<f32>& heights, u32 resolution, const ErosionParams& params)
+                : m_Heights(heights.data()), m_Resolution(resolution), m_MaxIdx(static_cast<i32>(resolution) - 1),
+                  m_FMaxIdx(static_cast<f32>(resolution - 1)), m_MaxSteps(ClampedMaxSteps(params)), m_Params(params)
+            {
+                // Weight falls off linearly to 0 at the radius, normalized to sum to 1.
+                const i32 radius = ClampedRadius(params);
+                f32 weightSum = 0.0f;
+                for (i32 dy = -radius; dy <= radius; ++dy)
+                {
+                    for (i32 dx = -radius; dx <= radius; ++dx)
+                    {
+                        const f32 dist = std::sqrt(static_cast<f32>(dx * dx + dy * dy));
+                        if (dist > static_cast<f32>(radius))
+                            continue;
+                        const f32 w = std::max(0.0f, static_cast<f32>(radius) - dist);
+                        weightSum += w;
+                        m_Brush.push_back({ dx, dy, w });
+                    }
+                }
+                if (weightSum > 1e-6f)
+                {
+                    const f32 invSum = 1.0f / weightSum;
+                    for (ErosionBrushPoint& bp : m_Brush)
+                        bp.Weight *= invSum;
+                }
+                else
+                {
+                    m_Brush.assign(1, { 0, 0, 1.0f });
+                }
+            }
+
+            [[nodiscard]] f32 GetMaxIndex() const
+            {
+                return m_FMaxIdx;
+            }
+
+            void Simulate(u32 droplet, u32 seed) const
+            {
+                const DropletStart start = StartOf(droplet, seed, m_FMaxIdx);
+                f32 px = start.X;
+                f32 py = start.Y;
+                u32 rng = start.Rng;
+
+                f32 dirX = 0.0f;
+                f32 dirY = 0.0f;
+                f32 speed = m_Params.InitialSpeed;
+                f32 water = m_Params.InitialWater;
+                f32 sediment = 0.0f;
+
+                for (u32 step = 0; step < m_MaxSteps; ++step)
+                {
+                    if (px < 0.0f || px >= m_FMaxIdx || py < 0.0f || py >= m_FMaxIdx)
+                        break;
+
+                    const HeightGrad hg = SampleHeightGrad(px, py);
+
+                    // Update direction with inertia.
+                    dirX = dirX * m_Params.Inertia - hg.GradX * (1.0f - m_Params.Inertia);
+                    dirY = dirY * m_Params.Inertia - hg.GradY * (1.0f - m_Params.Inertia);
+
+                    const f32 dirLen = std::sqrt(dirX * dirX + dirY * dirY);
+                    if (dirLen < 1e-6f)
+                    {
+                        rng = HydraulicErosion::PcgHash(rng);
+                        const f32 angle = RandomFloat(rng) * glm::two_pi<f32>();
+                        dirX = std::cos(angle);
+                        dirY = std::sin(angle);
+                    }
+                    else
+                    {
+                        dirX /= dirLen;
+                        dirY /= dirLen;
+                    }
+
+                    const f32 newX = std::clamp(px + dirX, 0.0f, m_FMaxIdx - 0.001f);
+                    const f32 newY = std::clamp(py + dirY, 0.0f, m_FMaxIdx - 0.001f);
+
+                    const f32 heightNew = SampleHeightGrad(newX, newY).Height;
+                    const f32 heightDiff = heightNew - hg.Height;
+
+                    // Sediment carrying capacity for the current slope/speed/water.
+                    const f32 capacity =
+                        std::max(-heightDiff * speed * water * m_Params.SedimentCapacity, m_Params.MinSedimentCapacity);
+
+                    if (sediment > capacity || heightDiff > 0.0f)
+                    {
+                        // Deposit: fill an uphill pit up to the rise, else shed the
+                        // over-capacity fraction.
+                        const f32 depositAmount = (heightDiff > 0.0f) ? std::min(sediment, heightDiff)
+                                                                      : (sediment - capacity) * m_Params.DepositSpeed;
+                        sediment -= depositAmount;
+                        DepositAt(px, py, depositAmount);
+                    }
+                    else
+                    {
+                        // Erode: take up to the free capacity, never more than the drop.
+                        const f32 erodeAmount = std::min((capacity - sediment) * m_Params.ErodeSpeed, -heightDiff);
+                        sediment += erodeAmount;
+                        ErodeAt(px, py, erodeAmount);
+                    }
+
+                    speed = std::sqrt(std::max(0.0f, speed * speed - heightDiff * m_Params.Gravity));
+                    water *= (1.0f - m_Params.EvaporateSpeed);
+                    if (water < 0.001f)
+                        break;
+
+                    px = newX;
+                    py = newY;
+                }
+            }
+
+          private:
+            // Read/write a single texel with edge clamping (matches the shader's
+            // clamp(coord, 0, res-1) on every image access).
+            [[nodiscard]] f32& At(i32 cx, i32 cy) const
+            {
+                cx = std::clamp(cx, 0, m_MaxIdx);
+                cy = std::clamp(cy, 0, m_MaxIdx);
+                return m_Heights[static_cast<sizet>(cy) * m_Resolution + cx];
+            }
+
+            // Bilinear height + analytic gradient from the four enclosing texels —
+            // the same four corners the shader's sampleHeight / calcGradient read,
+            // so computing both together is identical, just cheaper.
+            [[nodiscard]] HeightGrad SampleHeightGrad(f32 px, f32 py) const
+            {
+                const i32 x0 = static_cast<i32>(std::floor(px));
+                const i32 y0 = static_cast<i32>(std::floor(py));
+                const f32 fx = px - static_cast<f32>(x0);
+                const f32 fy = py - static_cast<f32>(y0);
+                const f32 h00 = At(x0, y0);
+                const f32 h10 = At(x0 + 1, y0);
+                const f32 h01 = At(x0, y0 + 1);
+                const f32 h11 = At(x0 + 1, y0 + 1);
+                const f32 height = glm::mix(glm::mix(h00, h10, fx), glm::mix(h01, h11, fx), fy);
+                const f32 gx = (h10 - h00) * (1.0f - fy) + (h11 - h01) * fy;
+                const f32 gy = (h01 - h00) * (1.0f - fx) + (h11 - h10) * fx;
+                return { height, gx, gy };
+            }
+
+            void ErodeAt(f32 px, f32 py, f32 amount) const
+            {
+                const i32 cx = static_cast<i32>(std::floor(px));
+                const i32 cy = static_cast<i32>(std::floor(py));
+                for (const ErosionBrushPoint& bp : m_Brush)
+                    At(cx + bp.Dx, cy + bp.Dy) -= amount * bp.Weight;
+            }
+
+            void DepositAt(f32 px, f32 py, f32 amount) const
+            {
+                const i32 x0 = static_cast<i32>(std::floor(px));
+                const i32 y0 = static_cast<i32>(std::floor(py));
+                const f32 fx = px - static_cast<f32>(x0);
+                const f32 fy = py - static_cast<f32>(y0);
+                At(x0, y0) += amount * (1.0f - fx) * (1.0f - fy);
+                At(x0 + 1, y0) += amount * fx * (1.0f - fy);
+                At(x0, y0 + 1) += amount * (1.0f - fx) * fy;
+                At(x0 + 1, y0 + 1) += amount * fx * fy;
+            }
+
+            f32* m_Heights;
+            u32 m_Resolution;
+            i32 m_MaxIdx;
+            f32 m_FMaxIdx;
+            u32 m_MaxSteps;
+            ErosionParams m_Params;
+            std::vector<ErosionBrushPoint> m_Brush;
+        };
+    } // namespace
+
+    u32 HydraulicErosion::PcgHash(u32 v)
+    {
+        u32 state = v * 747796405u + 2891336453u;
+        u32 word = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
+        return (word >> 22u) ^ word;
+    }
+
+    u32 HydraulicErosion::GetHaloWidth(const ErosionParams& params)
+    {
+        return ClampedMaxSteps(params) + static_cast<u32>(ClampedRadius(params)) + 2u;
+    }
+
+    void HydraulicErosion::ErodeSequential(std::vector<f32>& heights, u32 resolution, const ErosionParams& params, u32 seed)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        if (!IsErodible(heights, resolution))
+            return;
+
+        const DropletSimulator simulator(heights, resolution, params);
+        const u32 dropletCount = ClampedDropletCount(params, resolution);
+        for (u32 d = 0; d < dropletCount; ++d)
+            simulator.Simulate(d, seed);
+    }
+
+    void HydraulicErosion::ErodeParallel(std::vector<f32>& heights, u32 resolution, const ErosionParams& params, u32 seed)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        if (!IsErodible(heights, resolution))
+            return;
+
+        const DropletSimulator simulator(heights, resolution, params);
+        const u32 dropletCount = ClampedDropletCount(params, resolution);
+
+        // Two tiles of one phase are `stride` tiles apart on at least one axis,
+        // which leaves (stride - 1) tiles between them — room for both halos:
+        // (stride - 1) * kTileSize >= 2 * halo.
+        const u32 tilesPerAxis = (resolution + kTileSize - 1) / kTileSize;
+        const u32 halo = GetHaloWidth(params);
+        const u32 stride = std::min(tilesPerAxis, 1u + (2u * halo + kTileSize - 1) / kTileSize);
+        const u32 tileCount = tilesPerAxis * tilesPerAxis;
+
+        std::vector<u32> tileBegin(tileCount + 1);
+        std::vector<u32> tileOf(std::min(dropletCount, kBatchDroplets));
+        std::vector<u32> binned(tileOf.size());
+        std::vector<u32> phaseTiles;
+        phaseTiles.reserve(tileCount);
+
+        for (u32 batchBegin = 0; batchBegin < dropletCount; batchBegin += kBatchDroplets)
+        {
+            const u32 batchSize = std::min(kBatchDroplets, dropletCount - batchBegin);
+
+            // Counting sort by starting tile. Stable, so each tile keeps its
+            // droplets in droplet order.
+            std::ranges::fill(tileBegin, 0u);
+            for (u32 i = 0; i < batchSize; ++i)
+            {
+                const DropletStart start = StartOf(batchBegin + i, seed, simulator.GetMaxIndex());
+                const u32 tx = static_cast<u32>(start.X) / kTileSize;
+                const u32 ty = static_cast<u32>(start.Y) / kTileSize;
+                tileOf[i] = ty * tilesPerAxis + tx;
+                ++tileBegin[tileOf[i] + 1];
+            }
+            for (u32 t = 0; t < tileCount; ++t)
+                tileBegin[t + 1] += tileBegin[t];
+            {
+                std::vector<u32> cursor(tileBegin.begin(), tileBegin.end() - 1);
+                for (u32 i = 0; i < batchSize; ++i)
+                    binned[cursor[tileOf[i]]++] = batchBegin + i;
+            }
+
+            for (u32 phaseY = 0; phaseY < stride; ++phaseY)
+            {
+                for (u32 phaseX = 0; phaseX < stride; ++phaseX)
+                {
+                    phaseTiles.clear();
+                    for (u32 ty = phaseY; ty < tilesPerAxis; ty += stride)
+                    {
+                        for (u32 tx = phaseX; tx < tilesPerAxis; tx += stride)
+                        {
+                            const u32 tile = ty * tilesPerAxis + tx;
+                            if (tileBegin[tile] != tileBegin[tile + 1])
+                                phaseTiles.push_back(tile);
+                        }
+                    }
+
+                    ParallelFor("HydraulicErosion::ErodeParallel", static_cast<i32>(phaseTiles.size()), 1, [&](i32 index)
+                                {
+                                    const u32 tile = phaseTiles[static_cast<sizet>(index)];
+                                    for (u32 i = tileBegin[tile]; i < tileBegin[tile + 1]; ++i)
+                                        simulator.Simulate(binned[i], seed); });
+                }
+            }
+        }
+    }
+} // namespace OloEngine
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "OloEngine/Core/Base.h"
+#include "OloEngine/Terrain/TerrainGenerator.h"
+
+#include <vector>
+
+namespace OloEngine
+{
+    // CPU implementation of the droplet hydraulic-erosion model in
+    // Terrain_Erosion.comp: same PCG droplet seeding, bilinear height/gradient,
+    // radial erosion brush and bilinear deposit, so a pass here and a GPU pass
+    // with the same seed start every droplet in the same place. Pure CPU and
+    // safe headless; both the generator's erosion post-pass and the headless
+    // TerrainErosion::ApplyCPU run on it.
+    //
+    // One pass erodes `heights` (row-major, resolution × resolution) in place
+    // with params.DropletCount droplets (0 → resolution²), capped the way
+    // TerrainGenerator::ApplyErosion always capped them. Heights are not
+    // re-clamped — callers with a [0,1] contract clamp afterwards. A no-op if
+    // resolution < 2 or `heights` isn't resolution² long.
+    class HydraulicErosion
+    {
+      public:
+        // Edge length, in texels, of the tiles ErodeParallel bins droplets into.
+        static constexpr u32 kTileSize = 64;
+
+        // Droplets ErodeParallel bins and simulates at a time; bounds the
+        // binning buffer on 8k fields, where a pass is 64M droplets.
+        static constexpr u32 kBatchDroplets = 1u << 20;
+
+        // Every droplet in order, on the calling thread — the reference.
+        static void ErodeSequential(std::vector<f32>& heights, u32 resolution, const ErosionParams& params, u32 seed);
+
+        // The same pass across the task workers. Droplets are binned by the
+        // tile they start in and tiles run in phases: tiles of one phase lie
+        // far enough apart that their halos (GetHaloWidth) never overlap, so
+        // they run concurrently without sharing a texel, and each tile's
+        // droplets run in droplet order. The result is therefore fixed by the
+        // inputs alone — the worker count and scheduling never change a bit
+        // of it — and on a field of one tile it equals ErodeSequential.
+        // Across tiles the droplet order differs, so a larger field carves
+        // the same way but not bit-identically to the sequential pass.
+        static void ErodeParallel(std::vector<f32>& heights, u32 resolution, const ErosionParams& params, u32 seed);
+
+        // How far from its starting texel a droplet can read or write: one
+        // texel per step, plus the brush radius, plus the bilinear footprint.
+        [[nodiscard]] static u32 GetHaloWidth(const ErosionParams& params);
+
+        // The shader's pcgHash, bit for bit.
+        [[nodiscard]] static u32 PcgHash(u32 v);
+    };
+} // namespace OloEngine
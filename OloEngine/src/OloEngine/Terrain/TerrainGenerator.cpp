@@ -3,11 +3,12 @@
 
 #include "OloEngine/Math/Math.h"
 #include "OloEngine/Particle/SimplexNoise.h"
+#include "OloEngine/Task/ParallelFor.h"
+#include "OloEngine/Terrain/HydraulicErosion.h"
 #include "OloEngine/Terrain/TerrainData.h"
 #include "OloEngine/Terrain/TerrainMaterial.h"
 
 #include <glm/glm.hpp>
-#include <glm/gtc/constants.hpp>
 
 #include <algorithm>
 #include <cmath>
@@ -15,10 +16,6 @@
 
 namespace OloEngine
 {
-    // Upper bound on heightmap / splatmap edge length — guards against a
-    // corrupt resolution from a save file or scene triggering a huge allocation.
-    static constexpr u32 kMaxTerrainResolution = 4096u;
-
     namespace
     {
         // Clamped Hermite smoothstep (matches glm::smoothstep but guards the
@@ -43,29 +40,187 @@ namespace OloEngine
             return std::clamp(rising * falling, 0.0f, 1.0f);
         }
 
-        // ── Erosion helpers ─────────────────────────────────────────────────
-        // PCG hash + uniform [0,1) float, byte-for-byte identical to the GPU
-        // editor brush (Terrain_Erosion.comp) so the CPU post-pass and the brush
-        // share the same droplet RNG — only the dispatch order differs.
-        [[nodiscard]] u32 PcgHash(u32 v)
+        // ── Height-field sampling ───────────────────────────────────────────
+        // Rows per ParallelFor task in the height-field and splatmap passes.
+        constexpr u32 kRowsPerTile = 16;
+
+        // The constants GenerateHeightField derives from its params before
+        // sampling. RegenerateHeightFieldRegion builds the same sampler, so a
+        // region is sampled exactly as the full pass sampled it.
+        struct HeightFieldSampler
+        {
+            const TerrainGenerator::HeightParams* Params = nullptr;
+            u32 Resolution = 0;
+            f32 SeedOffset = 0.0f;
+            f32 WarpOffsetX = 0.0f;
+            f32 WarpOffsetZ = 0.0f;
+            f32 RidgeBlend = 0.0f;
+        };
+
+        [[nodiscard]] HeightFieldSampler MakeHeightFieldSampler(const TerrainGenerator::HeightParams& params)
         {
-            u32 state = v * 747796405u + 2891336453u;
-            u32 word = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
-            return (word >> 22u) ^ word;
+            // Derive bounded noise offsets from the seed. A naive `seed * k` offset
+            // explodes for large seeds (the editor's "Randomize Seed" picks any i32):
+            // adding the small per-sample coordinate to a ~1e8 offset loses all f32
+            // precision, so every sample collapses to one simplex lattice cell and the
+            // whole field goes flat. Hash the seed into a small [0, 256) range instead.
+            const auto seedOffsetFor = [seed = params.Seed](u32 salt) -> f32
+            {
+                u32 h = static_cast<u32>(seed) * 374761393u + salt * 668265263u;
+                h = (h ^ (h >> 13)) * 1274126177u;
+                h ^= h >> 16;
+                return static_cast<f32>(h % 256000u) * (1.0f / 1000.0f); // [0, 256)
+            };
+
+            HeightFieldSampler sampler;
+            sampler.Params = &params;
+            // Cap the resolution so a corrupt/huge value (from a save file or scene)
+            // can't trigger a multi-GB allocation.
+            sampler.Resolution = std::clamp(params.Resolution, 2u, kMaxTerrainResolution);
+            sampler.SeedOffset = seedOffsetFor(0u);
+            // Distinct offsets so the two domain-warp axes decorrelate from each other
+            // and from the main field.
+            sampler.WarpOffsetX = seedOffsetFor(1u);
+            sampler.WarpOffsetZ = seedOffsetFor(2u);
+            sampler.RidgeBlend = std::clamp(params.Shaping.RidgeBlend, 0.0f, 1.0f);
+            return sampler;
         }
 
-        [[nodiscard]] f32 RandomFloat(u32 seed)
+        // Raw (pre-normalization) fBm/ridged values of texels [x0, x0 + width)
+        // in row z. Noise is evaluated kSimplexNoiseLanes texels at a time
+        // through the batched SimplexNoise3D.
+        void SampleHeightRow(const HeightFieldSampler& sampler, u32 z, u32 x0, u32 width, f32* out)
         {
-            return static_cast<f32>(PcgHash(seed)) * (1.0f / 4294967296.0f);
+            constexpr u32 kLanes = kSimplexNoiseLanes;
+            const TerrainGenerator::HeightParams& params = *sampler.Params;
+            const TerrainHeightShaping& sh = params.Shaping;
+            const bool warp = sh.WarpStrength > 1e-6f;
+            const f32 zeros[kLanes] = {};
+
+            for (u32 begin = 0; begin < width; begin += kLanes)
+            {
+                const u32 lanes = std::min(kLanes, width - begin);
+                f32 nx[kLanes];
+                f32 nz[kLanes];
+                f32 px[kLanes];
+                f32 pz[kLanes];
+                f32 noise[kLanes];
+                f32 fbm[kLanes] = {};
+                f32 ridged[kLanes] = {};
+
+                for (u32 l = 0; l < lanes; ++l)
+                {
+                    nx[l] = static_cast<f32>(x0 + begin + l) / static_cast<f32>(sampler.Resolution);
+                    nz[l] = static_cast<f32>(z) / static_cast<f32>(sampler.Resolution);
+                }
+
+                // Domain warp: offset the sample position by a low-frequency noise
+                // field so ridges meander instead of following the lattice.
+                if (warp)
+                {
+                    f32 wx[kLanes];
+                    f32 wz[kLanes];
+                    for (u32 l = 0; l < lanes; ++l)
+                    {
+                        px[l] = nx[l] * sh.WarpFrequency + sampler.WarpOffsetX;
+                        pz[l] = nz[l] * sh.WarpFrequency + sampler.WarpOffsetX;
+                    }
+                    SimplexNoise3D(px, zeros, pz, wx, lanes);
+                    for (u32 l = 0; l < lanes; ++l)
+                    {
+                        px[l] = nx[l] * sh.WarpFrequency + sampler.WarpOffsetZ;
+                        pz[l] = nz[l] * sh.WarpFrequency + sampler.WarpOffsetZ;
+                    }
+                    SimplexNoise3D(px, zeros, pz, wz, lanes);
+                    for (u32 l = 0; l < lanes; ++l)
+                    {
+                        nx[l] += wx[l] * sh.WarpStrength;
+                        nz[l] += wz[l] * sh.WarpStrength;
+                    }
+                }
+
+                f32 freq = params.Frequency;
+                f32 amp = 1.0f;
+                for (u32 o = 0; o < params.Octaves; ++o)
+                {
+                    for (u32 l = 0; l < lanes; ++l)
+                    {
+                        px[l] = nx[l] * freq + sampler.SeedOffset;
+                        pz[l] = nz[l] * freq + sampler.SeedOffset;
+                    }
+                    SimplexNoise3D(px, zeros, pz, noise, lanes);
+                    for (u32 l = 0; l < lanes; ++l)
+                    {
+                        fbm[l] += noise[l] * amp;
+                        // Ridged multifractal octave: fold the noise about 0 and square
+                        // it so the zero-crossings become sharp ridge lines.
+                        const f32 r = 1.0f - std::fabs(noise[l]);
+                        ridged[l] += r * r * amp;
+                    }
+                    freq *= params.Lacunarity;
+                    amp *= params.Persistence;
+                }
+
+                for (u32 l = 0; l < lanes; ++l)
+                    out[begin + l] = glm::mix(fbm[l], ridged[l], sampler.RidgeBlend);
+            }
         }
 
-        // One texel offset in the radial erosion brush plus its normalized weight.
-        struct ErosionBrushPoint
+        // Normalize raw values to [0, 1] against `range`, then apply the
+        // post-normalization shaping (exponent, terrace).
+        void NormalizeAndShapeHeights(f32* heights, sizet count, const TerrainGenerator::HeightFieldRange& range,
+                                      const TerrainHeightShaping& sh)
         {
-            i32 Dx;
-            i32 Dy;
-            f32 Weight;
-        };
+            const f32 span = range.RawMax - range.RawMin;
+            const bool flat = !(span > 1e-6f);
+            const f32 invRange = flat ? 0.0f : 1.0f / span;
+            const bool applyExponent = !Math::BitwiseEqual(sh.HeightExponent, 1.0f) && sh.HeightExponent > 1e-4f;
+            const bool applyTerrace = sh.TerraceSteps > 0;
+
+            for (sizet i = 0; i < count; ++i)
+            {
+                // Clamped: a region regenerated with new params can sample
+                // outside the range the full field was normalized with.
+                f32 h = flat ? 0.0f : std::clamp((heights[i] - range.RawMin) * invRange, 0.0f, 1.0f);
+                if (applyExponent)
+                    h = std::pow(h, sh.HeightExponent);
+                if (applyTerrace)
+                    h = TerrainGenerator::Terrace(h, sh.TerraceSteps, sh.TerraceSharpness);
+                heights[i] = h;
+            }
+        }
+
+        // Auto-material weights for splat texels [x0, x0 + width) × [z0, z0 + height)
+        // of a res × res splatmap, rows tiled across the task workers.
+        void FillSplatmapRegion(std::vector<u8>& splat0, std::vector<u8>& splat1, u32 res, u32 x0, u32 z0, u32 width,
+                                u32 height, const TerrainData& data, const std::vector<TerrainLayerRule>& rules,
+                                f32 worldSizeX, f32 worldSizeZ, f32 heightScale)
+        {
+            const f32 invRes = 1.0f / static_cast<f32>(res - 1);
+            const u32 tileCount = (height + kRowsPerTile - 1) / kRowsPerTile;
+            ParallelFor("TerrainGenerator::Splatmap", static_cast<i32>(tileCount), 1, [&](i32 tile)
+                        {
+                std::array<f32, MAX_TERRAIN_LAYERS> weights{};
+                const u32 zBegin = z0 + static_cast<u32>(tile) * kRowsPerTile;
+                const u32 zEnd = std::min(zBegin + kRowsPerTile, z0 + height);
+                for (u32 z = zBegin; z < zEnd; ++z)
+                {
+                    for (u32 x = x0; x < x0 + width; ++x)
+                    {
+                        const f32 nx = static_cast<f32>(x) * invRes;
+                        const f32 nz = static_cast<f32>(z) * invRes;
+
+                        const f32 h01 = data.GetHeightAt(nx, nz);
+                        const glm::vec3 normal = data.GetNormalAt(nx, nz, worldSizeX, worldSizeZ, heightScale);
+                        const f32 slopeDeg = glm::degrees(std::acos(std::clamp(normal.y, -1.0f, 1.0f)));
+
+                        TerrainGenerator::EvaluateLayerWeights(h01, slopeDeg, rules, weights);
+
+                        const sizet idx = (static_cast<sizet>(z) * res + x) * 4;
+                        TerrainGenerator::PackLayerWeights(weights, &splat0[idx], &splat1[idx]);
+                    }
+                } });
+        }
 
         // ── Foliage auto-population profiles ────────────────────────────────
         // One vegetation kind for the default sand/grass/rock/snow biome:
@@ -146,105 +301,53 @@ namespace OloEngine
         return std::clamp((base + stepped) / s, 0.0f, 1.0f);
     }
 
-    void TerrainGenerator::GenerateHeightField(std::vector<f32>& outHeights, const HeightParams& params)
+    void TerrainGenerator::GenerateHeightField(std::vector<f32>& outHeights, const HeightParams& params,
+                                               HeightFieldRange* outRange)
     {
         OLO_PROFILE_FUNCTION();
 
-        // Cap the resolution so a corrupt/huge value (from a save file or scene)
-        // can't trigger a multi-GB allocation.
-        const u32 resolution = std::clamp(params.Resolution, 2u, kMaxTerrainResolution);
+        const HeightFieldSampler sampler = MakeHeightFieldSampler(params);
+        const u32 resolution = sampler.Resolution;
         const sizet totalPixels = static_cast<sizet>(resolution) * resolution;
         outHeights.resize(totalPixels);
 
-        const TerrainHeightShaping& sh = params.Shaping;
-        // Derive bounded noise offsets from the seed. A naive `seed * k` offset
-        // explodes for large seeds (the editor's "Randomize Seed" picks any i32):
-        // adding the small per-sample coordinate to a ~1e8 offset loses all f32
-        // precision, so every sample collapses to one simplex lattice cell and the
-        // whole field goes flat. Hash the seed into a small [0, 256) range instead.
-        const auto seedOffsetFor = [seed = params.Seed](u32 salt) -> f32
-        {
-            u32 h = static_cast<u32>(seed) * 374761393u + salt * 668265263u;
-            h = (h ^ (h >> 13)) * 1274126177u;
-            h ^= h >> 16;
-            return static_cast<f32>(h % 256000u) * (1.0f / 1000.0f); // [0, 256)
-        };
-        const f32 seedOffset = seedOffsetFor(0u);
-        // Distinct offsets so the two domain-warp axes decorrelate from each other
-        // and from the main field.
-        const f32 warpOffsetX = seedOffsetFor(1u);
-        const f32 warpOffsetZ = seedOffsetFor(2u);
-        const f32 ridgeBlend = std::clamp(sh.RidgeBlend, 0.0f, 1.0f);
-
-        f32 minH = std::numeric_limits<f32>::max();
-        f32 maxH = std::numeric_limits<f32>::lowest();
-
-        for (u32 z = 0; z < resolution; ++z)
-        {
-            for (u32 x = 0; x < resolution; ++x)
+        // Sample in bands of rows across the task workers; each band keeps its
+        // own min/max for the normalization below.
+        const u32 tileCount = (resolution + kRowsPerTile - 1) / kRowsPerTile;
+        std::vector<HeightFieldRange> tileRanges(tileCount);
+        ParallelFor("TerrainGenerator::SampleHeightField", static_cast<i32>(tileCount), 1, [&](i32 tile)
+                    {
+            const u32 zBegin = static_cast<u32>(tile) * kRowsPerTile;
+            const u32 zEnd = std::min(zBegin + kRowsPerTile, resolution);
+            HeightFieldRange tileRange{ std::numeric_limits<f32>::max(), std::numeric_limits<f32>::lowest() };
+            for (u32 z = zBegin; z < zEnd; ++z)
             {
-                f32 nx = static_cast<f32>(x) / static_cast<f32>(resolution);
-                f32 nz = static_cast<f32>(z) / static_cast<f32>(resolution);
-
-                // Domain warp: offset the sample position by a low-frequency noise
-                // field so ridges meander instead of following the lattice.
-                if (sh.WarpStrength > 1e-6f)
+                f32* row = &outHeights[static_cast<sizet>(z) * resolution];
+                SampleHeightRow(sampler, z, 0, resolution, row);
+                for (u32 x = 0; x < resolution; ++x)
                 {
-                    f32 wx = SimplexNoise3D(nx * sh.WarpFrequency + warpOffsetX, 0.0f, nz * sh.WarpFrequency + warpOffsetX);
-                    f32 wz = SimplexNoise3D(nx * sh.WarpFrequency + warpOffsetZ, 0.0f, nz * sh.WarpFrequency + warpOffsetZ);
-                    nx += wx * sh.WarpStrength;
-                    nz += wz * sh.WarpStrength;
+                    tileRange.RawMin = std::min(tileRange.RawMin, row[x]);
+                    tileRange.RawMax = std::max(tileRange.RawMax, row[x]);
                 }
-
-                f32 fbm = 0.0f;
-                f32 ridged = 0.0f;
-                f32 freq = params.Frequency;
-                f32 amp = 1.0f;
-                for (u32 o = 0; o < params.Octaves; ++o)
-                {
-                    const f32 n = SimplexNoise3D(nx * freq + seedOffset, 0.0f, nz * freq + seedOffset);
-                    fbm += n * amp;
-                    // Ridged multifractal octave: fold the noise about 0 and square
-                    // it so the zero-crossings become sharp ridge lines.
-                    const f32 r = 1.0f - std::fabs(n);
-                    ridged += r * r * amp;
-                    freq *= params.Lacunarity;
-                    amp *= params.Persistence;
-                }
-
-                const f32 value = glm::mix(fbm, ridged, ridgeBlend);
-                const sizet idx = static_cast<sizet>(z) * resolution + x;
-                outHeights[idx] = value;
-                minH = std::min(minH, value);
-                maxH = std::max(maxH, value);
             }
-        }
+            tileRanges[tile] = tileRange; });
 
-        // Normalize to [0, 1].
-        if (const f32 range = maxH - minH; range > 1e-6f)
+        HeightFieldRange range{ std::numeric_limits<f32>::max(), std::numeric_limits<f32>::lowest() };
+        for (const HeightFieldRange& tileRange : tileRanges)
         {
-            const f32 invRange = 1.0f / range;
-            for (f32& h : outHeights)
-                h = (h - minH) * invRange;
-        }
-        else
-        {
-            std::fill(outHeights.begin(), outHeights.end(), 0.0f);
+            range.RawMin = std::min(range.RawMin, tileRange.RawMin);
+            range.RawMax = std::max(range.RawMax, tileRange.RawMax);
         }
+        if (outRange)
+            *outRange = range;
 
-        // Post-normalization shaping (operates in [0, 1]).
-        const bool applyExponent = !Math::BitwiseEqual(sh.HeightExponent, 1.0f) && sh.HeightExponent > 1e-4f;
-        const bool applyTerrace = sh.TerraceSteps > 0;
-        if (applyExponent || applyTerrace)
-        {
-            for (f32& h : outHeights)
-            {
-                if (applyExponent)
-                    h = std::pow(std::clamp(h, 0.0f, 1.0f), sh.HeightExponent);
-                if (applyTerrace)
-                    h = Terrace(h, sh.TerraceSteps, sh.TerraceSharpness);
-            }
-        }
+        // Normalize to [0, 1] and apply the post-normalization shaping.
+        ParallelFor("TerrainGenerator::ShapeHeightField", static_cast<i32>(tileCount), 1, [&](i32 tile)
+                    {
+            const u32 zBegin = static_cast<u32>(tile) * kRowsPerTile;
+            const u32 zEnd = std::min(zBegin + kRowsPerTile, resolution);
+            NormalizeAndShapeHeights(&outHeights[static_cast<sizet>(zBegin) * resolution],
+                                     static_cast<sizet>(zEnd - zBegin) * resolution, range, params.Shaping); });
 
         // Optional hydraulic-erosion post-pass. Carves drainage channels / talus
         // slopes into the shaped field. Deterministic in Seed (sequential droplets),
@@ -253,13 +356,47 @@ namespace OloEngine
             ApplyErosion(outHeights, resolution, static_cast<u32>(params.ErosionIterations), params.Erosion, params.Seed);
     }
 
-    void TerrainGenerator::GenerateHeightmap(TerrainData& data, const HeightParams& params)
+    bool TerrainGenerator::RegenerateHeightFieldRegion(std::vector<f32>& heights, const HeightParams& params,
+                                                       const HeightFieldRange& range, u32 x, u32 z, u32 width, u32 height)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        const HeightFieldSampler sampler = MakeHeightFieldSampler(params);
+        const u32 resolution = sampler.Resolution;
+        if (heights.size() != static_cast<sizet>(resolution) * resolution)
+        {
+            OLO_CORE_ERROR("TerrainGenerator::RegenerateHeightFieldRegion - height buffer ({}) does not match resolution {}x{}",
+                           heights.size(), resolution, resolution);
+            return false;
+        }
+
+        // Clamp the region to the field.
+        x = std::min(x, resolution);
+        z = std::min(z, resolution);
+        width = std::min(width, resolution - x);
+        height = std::min(height, resolution - z);
+
+        const u32 tileCount = (height + kRowsPerTile - 1) / kRowsPerTile;
+        ParallelFor("TerrainGenerator::RegenerateHeightFieldRegion", static_cast<i32>(tileCount), 1, [&](i32 tile)
+                    {
+            const u32 zBegin = z + static_cast<u32>(tile) * kRowsPerTile;
+            const u32 zEnd = std::min(zBegin + kRowsPerTile, z + height);
+            for (u32 row = zBegin; row < zEnd; ++row)
+            {
+                f32* span = &heights[static_cast<sizet>(row) * resolution + x];
+                SampleHeightRow(sampler, row, x, width, span);
+                NormalizeAndShapeHeights(span, width, range, params.Shaping);
+            } });
+        return true;
+    }
+
+    void TerrainGenerator::GenerateHeightmap(TerrainData& data, const HeightParams& params, HeightFieldRange* outRange)
     {
         OLO_PROFILE_FUNCTION();
 
-        const u32 resolution = std::max(params.Resolution, 2u);
+        const u32 resolution = std::clamp(params.Resolution, 2u, kMaxTerrainResolution);
         std::vector<f32> heights;
-        GenerateHeightField(heights, params);
+        GenerateHeightField(heights, params, outRange);
         const auto [minIt, maxIt] = std::minmax_element(heights.begin(), heights.end());
         const f32 hMin = heights.empty() ? 0.0f : *minIt;
         const f32 hMax = heights.empty() ? 0.0f : *maxIt;
@@ -270,6 +407,15 @@ namespace OloEngine
                       params.Shaping.WarpStrength, params.Shaping.TerraceSteps, params.ErosionIterations, hMin, hMax);
     }
 
+    void TerrainGenerator::RegenerateHeightmapRegion(TerrainData& data, const HeightParams& params,
+                                                     const HeightFieldRange& range, u32 x, u32 z, u32 width, u32 height)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        if (RegenerateHeightFieldRegion(data.GetHeightData(), params, range, x, z, width, height))
+            data.UploadRegionToGPU(x, z, width, height);
+    }
+
     void TerrainGenerator::ApplyErosion(std::vector<f32>& heights, u32 resolution, u32 iterations,
                                         const ErosionParams& params, i32 seed)
     {
@@ -284,187 +430,21 @@ namespace OloEngine
             return;
         }
 
-        // Cap the iteration count the same way dropletCount/maxSteps below are
-        // capped, so a corrupt param can't spin the generator. The editor, Lua,
+        // Cap the iteration count the same way HydraulicErosion caps droplet
+        // count and steps, so a corrupt param can't spin the generator. The editor, Lua,
         // and both serializers already clamp ErosionIterations to [0,64]; this
         // also defends the raw C# binding (generated, unclamped) and any direct
         // caller of this public API. 64 passes is well past the point of relief.
         iterations = std::min(iterations, 64u);
 
-        const i32 maxIdx = static_cast<i32>(resolution) - 1;
-        const f32 fMaxIdx = static_cast<f32>(maxIdx);
-
-        // Read/write a single texel with edge clamping (matches the shader's
-        // clamp(coord, 0, res-1) on every image access).
-        const auto at = [&](i32 cx, i32 cy) -> f32&
-        {
-            cx = std::clamp(cx, 0, maxIdx);
-            cy = std::clamp(cy, 0, maxIdx);
-            return heights[static_cast<sizet>(cy) * resolution + cx];
-        };
-
-        // Bilinear height + analytic gradient from the four enclosing texels —
-        // the same four corners the shader's sampleHeight / calcGradient read, so
-        // computing both together is identical, just cheaper.
-        struct HeightGrad
-        {
-            f32 Height;
-            f32 GradX;
-            f32 GradY;
-        };
-        const auto sampleHeightGrad = [&](f32 px, f32 py) -> HeightGrad
-        {
-            const i32 x0 = static_cast<i32>(std::floor(px));
-            const i32 y0 = static_cast<i32>(std::floor(py));
-            const f32 fx = px - static_cast<f32>(x0);
-            const f32 fy = py - static_cast<f32>(y0);
-            const f32 h00 = at(x0, y0);
-            const f32 h10 = at(x0 + 1, y0);
-            const f32 h01 = at(x0, y0 + 1);
-            const f32 h11 = at(x0 + 1, y0 + 1);
-            const f32 height = glm::mix(glm::mix(h00, h10, fx), glm::mix(h01, h11, fx), fy);
-            const f32 gx = (h10 - h00) * (1.0f - fy) + (h11 - h01) * fy;
-            const f32 gy = (h01 - h00) * (1.0f - fx) + (h11 - h10) * fx;
-            return { height, gx, gy };
-        };
-
-        // Pre-compute the radial erosion brush once (depends only on radius):
-        // weight falls off linearly to 0 at the radius, normalized to sum to 1.
-        const i32 radius = std::clamp(static_cast<i32>(params.ErosionRadius), 1, 16);
-        std::vector<ErosionBrushPoint> brush;
-        {
-            f32 weightSum = 0.0f;
-            for (i32 dy = -radius; dy <= radius; ++dy)
-            {
-                for (i32 dx = -radius; dx <= radius; ++dx)
-                {
-                    const f32 dist = std::sqrt(static_cast<f32>(dx * dx + dy * dy));
-                    if (dist > static_cast<f32>(radius))
-                        continue;
-                    const f32 w = std::max(0.0f, static_cast<f32>(radius) - dist);
-                    weightSum += w;
-                    brush.push_back({ dx, dy, w });
-                }
-            }
-            if (weightSum > 1e-6f)
-            {
-                const f32 invSum = 1.0f / weightSum;
-                for (ErosionBrushPoint& bp : brush)
-                    bp.Weight *= invSum;
-            }
-            else
-            {
-                brush.assign(1, { 0, 0, 1.0f });
-            }
-        }
-
-        const auto erodeAt = [&](f32 px, f32 py, f32 amount)
-        {
-            const i32 cx = static_cast<i32>(std::floor(px));
-            const i32 cy = static_cast<i32>(std::floor(py));
-            for (const ErosionBrushPoint& bp : brush)
-                at(cx + bp.Dx, cy + bp.Dy) -= amount * bp.Weight;
-        };
-
-        const auto depositAt = [&](f32 px, f32 py, f32 amount)
-        {
-            const i32 x0 = static_cast<i32>(std::floor(px));
-            const i32 y0 = static_cast<i32>(std::floor(py));
-            const f32 fx = px - static_cast<f32>(x0);
-            const f32 fy = py - static_cast<f32>(y0);
-            at(x0, y0) += amount * (1.0f - fx) * (1.0f - fy);
-            at(x0 + 1, y0) += amount * fx * (1.0f - fy);
-            at(x0, y0 + 1) += amount * (1.0f - fx) * fy;
-            at(x0 + 1, y0 + 1) += amount * fx * fy;
-        };
-
-        // Droplets per iteration: 0 → one per cell (resolution²). Cap so a corrupt
-        // param can't spin the generator; the per-cell density is plenty for relief.
-        const u64 cells = static_cast<u64>(resolution) * resolution;
-        const u64 autoCount = (params.DropletCount == 0) ? cells : params.DropletCount;
-        const u32 dropletCount = static_cast<u32>(std::min<u64>(autoCount, 4u * cells));
-        const u32 maxSteps = std::min(params.MaxDropletSteps, 256u);
-
         for (u32 iter = 0; iter < iterations; ++iter)
         {
             // Distinct, deterministic RNG stream per iteration so each pass drops
             // droplets at fresh positions while staying reproducible in `seed`.
-            const u32 iterSeed = PcgHash(static_cast<u32>(seed)) + iter;
-
-            for (u32 d = 0; d < dropletCount; ++d)
-            {
-                u32 rng = PcgHash(d + iterSeed);
-                f32 px = RandomFloat(rng) * fMaxIdx;
-                rng = PcgHash(rng);
-                f32 py = RandomFloat(rng) * fMaxIdx;
-
-                f32 dirX = 0.0f;
-                f32 dirY = 0.0f;
-                f32 speed = params.InitialSpeed;
-                f32 water = params.InitialWater;
-                f32 sediment = 0.0f;
-
-                for (u32 step = 0; step < maxSteps; ++step)
-                {
-                    if (px < 0.0f || px >= fMaxIdx || py < 0.0f || py >= fMaxIdx)
-                        break;
-
-                    const HeightGrad hg = sampleHeightGrad(px, py);
-
-                    // Update direction with inertia.
-                    dirX = dirX * params.Inertia - hg.GradX * (1.0f - params.Inertia);
-                    dirY = dirY * params.Inertia - hg.GradY * (1.0f - params.Inertia);
-
-                    const f32 dirLen = std::sqrt(dirX * dirX + dirY * dirY);
-                    if (dirLen < 1e-6f)
-                    {
-                        rng = PcgHash(rng);
-                        const f32 angle = RandomFloat(rng) * glm::two_pi<f32>();
-                        dirX = std::cos(angle);
-                        dirY = std::sin(angle);
-                    }
-                    else
-                    {
-                        dirX /= dirLen;
-                        dirY /= dirLen;
-                    }
-
-                    f32 newX = std::clamp(px + dirX, 0.0f, fMaxIdx - 0.001f);
-                    f32 newY = std::clamp(py + dirY, 0.0f, fMaxIdx - 0.001f);
-
-                    const f32 heightNew = sampleHeightGrad(newX, newY).Height;
-                    const f32 heightDiff = heightNew - hg.Height;
-
-                    // Sediment carrying capacity for the current slope/speed/water.
-                    const f32 capacity =
-                        std::max(-heightDiff * speed * water * params.SedimentCapacity, params.MinSedimentCapacity);
-
-                    if (sediment > capacity || heightDiff > 0.0f)
-                    {
-                        // Deposit: fill an uphill pit up to the rise, else shed the
-                        // over-capacity fraction.
-                        const f32 depositAmount =
-                            (heightDiff > 0.0f) ? std::min(sediment, heightDiff) : (sediment - capacity) * params.DepositSpeed;
-                        sediment -= depositAmount;
-                        depositAt(px, py, depositAmount);
-                    }
-                    else
-                    {
-                        // Erode: take up to the free capacity, never more than the drop.
-                        const f32 erodeAmount = std::min((capacity - sediment) * params.ErodeSpeed, -heightDiff);
-                        sediment += erodeAmount;
-                        erodeAt(px, py, erodeAmount);
-                    }
-
-                    speed = std::sqrt(std::max(0.0f, speed * speed - heightDiff * params.Gravity));
-                    water *= (1.0f - params.EvaporateSpeed);
-                    if (water < 0.001f)
-                        break;
-
-                    px = newX;
-                    py = newY;
-                }
-            }
+            // Droplets run sequentially: this pass is part of what a saved scene
+            // regenerates, so its output must not move.
+            const u32 iterSeed = HydraulicErosion::PcgHash(static_cast<u32>(seed)) + iter;
+            HydraulicErosion::ErodeSequential(heights, resolution, params, iterSeed);
         }
 
         // Erosion deposits/erodes without bound, so clamp back into the [0,1]
@@ -542,30 +522,46 @@ namespace OloEngine
             return;
         }
 
-        const f32 invRes = 1.0f / static_cast<f32>(res - 1);
-        std::array<f32, MAX_TERRAIN_LAYERS> weights{};
-        for (u32 z = 0; z < res; ++z)
-        {
-            for (u32 x = 0; x < res; ++x)
-            {
-                const f32 nx = static_cast<f32>(x) * invRes;
-                const f32 nz = static_cast<f32>(z) * invRes;
+        FillSplatmapRegion(splat0, splat1, res, 0, 0, res, res, data, rules, worldSizeX, worldSizeZ, heightScale);
 
-                const f32 h01 = data.GetHeightAt(nx, nz);
-                const glm::vec3 normal = data.GetNormalAt(nx, nz, worldSizeX, worldSizeZ, heightScale);
-                const f32 slopeDeg = glm::degrees(std::acos(std::clamp(normal.y, -1.0f, 1.0f)));
+        material.UploadSplatmapRegion(0, 0, 0, res, res);
+        material.UploadSplatmapRegion(1, 0, 0, res, res);
 
-                EvaluateLayerWeights(h01, slopeDeg, rules, weights);
+        OLO_CORE_INFO("TerrainGenerator: Auto-assigned splatmap ({}x{}, {} rules)", res, res, rules.size());
+    }
 
-                const sizet idx = (static_cast<sizet>(z) * res + x) * 4;
-                PackLayerWeights(weights, &splat0[idx], &splat1[idx]);
-            }
+    void TerrainGenerator::RegenerateSplatmapRegion(TerrainMaterial& material, const TerrainData& data,
+                                                    const std::vector<TerrainLayerRule>& rules, u32 x, u32 z, u32 width,
+                                                    u32 height, f32 worldSizeX, f32 worldSizeZ, f32 heightScale)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        if (rules.empty() || data.GetResolution() == 0 || !material.HasCPUSplatmaps())
+        {
+            OLO_CORE_WARN("TerrainGenerator::RegenerateSplatmapRegion - no rules, empty terrain or no generated splatmap; skipping");
+            return;
         }
 
-        material.UploadSplatmapRegion(0, 0, 0, res, res);
-        material.UploadSplatmapRegion(1, 0, 0, res, res);
+        const u32 res = material.GetSplatmapResolution();
+        std::vector<u8>& splat0 = material.GetSplatmapData(0);
+        std::vector<u8>& splat1 = material.GetSplatmapData(1);
+        if (res < 2 || splat0.size() != static_cast<sizet>(res) * res * 4 || splat1.size() != static_cast<sizet>(res) * res * 4)
+        {
+            OLO_CORE_ERROR("TerrainGenerator::RegenerateSplatmapRegion - splatmap buffers not allocated");
+            return;
+        }
 
-        OLO_CORE_INFO("TerrainGenerator: Auto-assigned splatmap ({}x{}, {} rules)", res, res, rules.size());
+        x = std::min(x, res);
+        z = std::min(z, res);
+        width = std::min(width, res - x);
+        height = std::min(height, res - z);
+        if (width == 0 || height == 0)
+            return;
+
+        FillSplatmapRegion(splat0, splat1, res, x, z, width, height, data, rules, worldSizeX, worldSizeZ, heightScale);
+
+        material.UploadSplatmapRegion(0, x, z, width, height);
+        material.UploadSplatmapRegion(1, x, z, width, height);
     }
 
     std::vector<TerrainLayer> TerrainGenerator::MakeDefaultLayers()
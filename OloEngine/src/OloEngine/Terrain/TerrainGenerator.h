@@ -12,6 +12,12 @@ namespace OloEngine
     class TerrainData;
     class TerrainMaterial;
 
+    // Upper bound on heightmap / splatmap edge length — guards against a
+    // corrupt resolution from a save file or scene triggering a huge allocation.
+    // 8k is the largest world map we generate (a 256 MB f32 field). Serializers
+    // and editor fields clamp to the same bound.
+    inline constexpr u32 kMaxTerrainResolution = 8192u;
+
     // Extra height-field shaping applied on top of the base fBm. Every field
     // defaults to an identity transform, so a TerrainHeightShaping{} produces
     // exactly the same field as the legacy single-fBm GenerateProcedural path.
@@ -41,11 +47,12 @@ namespace OloEngine
         auto operator==(const TerrainHeightShaping& o) const -> bool;
     };
 
-    // Hydraulic-erosion knobs for the deterministic CPU generation post-pass
-    // (TerrainGenerator::ApplyErosion). These mirror the GPU editor brush's
-    // ErosionSettings one-for-one so the physics is identical; the only
-    // difference is the CPU path runs droplets sequentially (reproducible)
-    // instead of one-thread-per-droplet (racy). Defaults match the editor brush.
+    // Hydraulic-erosion knobs for the CPU droplet model (HydraulicErosion) —
+    // the deterministic generation post-pass (TerrainGenerator::ApplyErosion)
+    // and the headless TerrainErosion::ApplyCPU. These mirror the GPU editor
+    // brush's ErosionSettings one-for-one so the physics is identical; the only
+    // difference is the CPU paths order droplets deterministically instead of
+    // one-thread-per-droplet (racy). Defaults match the editor brush.
     struct ErosionParams
     {
         // Droplets simulated per iteration. 0 → auto: resolution² (one droplet
@@ -118,16 +125,46 @@ namespace OloEngine
             ErosionParams Erosion;
         };
 
+        // The raw (pre-normalization) noise range a generated field was mapped
+        // onto [0, 1] from. Keep it to regenerate regions of that field with the
+        // same normalization.
+        struct HeightFieldRange
+        {
+            f32 RawMin = 0.0f;
+            f32 RawMax = 0.0f;
+        };
+
         // ── Height field ────────────────────────────────────────────────────
 
         // Pure CPU. Fills a normalized [0,1] height field (Resolution × Resolution,
         // row-major). No GPU access — safe to call headless / in unit tests. When
         // params.ErosionIterations > 0 the shaped field is run through the
         // deterministic erosion post-pass (ApplyErosion) before returning.
-        static void GenerateHeightField(std::vector<f32>& outHeights, const HeightParams& params);
+        // Sampling is tiled across the task workers (ParallelFor) with the noise
+        // batched through the SSE SimplexNoise3D; the result does not depend on
+        // the worker count. `outRange` receives the normalization range.
+        static void GenerateHeightField(std::vector<f32>& outHeights, const HeightParams& params,
+                                        HeightFieldRange* outRange = nullptr);
 
         // Generate the field and push it into a TerrainData (re-uploads to GPU).
-        static void GenerateHeightmap(TerrainData& data, const HeightParams& params);
+        static void GenerateHeightmap(TerrainData& data, const HeightParams& params, HeightFieldRange* outRange = nullptr);
+
+        // Incremental regenerate for editor tweaks: re-sample only texels
+        // [x, x + width) × [z, z + height) of a field GenerateHeightField
+        // produced, normalizing against the `range` it reported. With unchanged
+        // params the region comes out bit-identical to the full pass; with new
+        // params it shows the new noise blended into the old normalization
+        // (clamped to [0,1]) without touching the rest of the field. Erosion is
+        // a whole-field pass and is not re-run here. The region is clamped to
+        // the field; returns false (field untouched) if `heights` isn't
+        // Resolution² long.
+        static bool RegenerateHeightFieldRegion(std::vector<f32>& heights, const HeightParams& params,
+                                                const HeightFieldRange& range, u32 x, u32 z, u32 width, u32 height);
+
+        // RegenerateHeightFieldRegion on a TerrainData's heights, then re-upload
+        // just that region to the GPU.
+        static void RegenerateHeightmapRegion(TerrainData& data, const HeightParams& params, const HeightFieldRange& range,
+                                              u32 x, u32 z, u32 width, u32 height);
 
         // Deterministic CPU hydraulic erosion. Mutates `heights` (row-major,
         // resolution × resolution) in place: `iterations` batches of water
@@ -145,10 +182,19 @@ namespace OloEngine
         // (layers 0-3 → splatmap 0, layers 4-7 → splatmap 1), then upload. Requires
         // a GL context (allocates the splatmap textures via InitializeCPUSplatmaps).
         // Height comes from data.GetHeightAt; slope from data.GetNormalAt.
+        // Rows are evaluated across the task workers.
         static void GenerateSplatmap(TerrainMaterial& material, const TerrainData& data,
                                      const std::vector<TerrainLayerRule>& rules, u32 splatmapResolution,
                                      f32 worldSizeX, f32 worldSizeZ, f32 heightScale);
 
+        // Re-evaluate the rules over splat texels [x, x + width) × [z, z + height)
+        // of the splatmap a previous GenerateSplatmap allocated (same resolution)
+        // and upload just that region — e.g. after RegenerateHeightmapRegion.
+        // No-op if the material has no CPU splatmaps.
+        static void RegenerateSplatmapRegion(TerrainMaterial& material, const TerrainData& data,
+                                             const std::vector<TerrainLayerRule>& rules, u32 x, u32 z, u32 width,
+                                             u32 height, f32 worldSizeX, f32 worldSizeZ, f32 heightScale);
+
         // ── Pure helpers (unit-tested) ──────────────────────────────────────
 
         // Map a normalized height [0,1] onto `steps` flat plateaus. Monotonic
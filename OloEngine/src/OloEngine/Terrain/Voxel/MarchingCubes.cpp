@@ -3,11 +3,20 @@
 #include "OloEngine/Renderer/VertexBuffer.h"
 #include "OloEngine/Renderer/IndexBuffer.h"
 #include "OloEngine/Renderer/Buffer.h"
+#include "OloEngine/Task/ParallelFor.h"
 
 #include <algorithm>
+#include <bit>
 #include <cmath>
 #include <limits>
 
+#if defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define OLO_MARCHING_CUBES_HAS_SSE2 1
+#include <emmintrin.h>
+#else
+#define OLO_MARCHING_CUBES_HAS_SSE2 0
+#endif
+
 namespace OloEngine
 {
     // ── Standard Marching Cubes edge table ───────────────────────────────
@@ -292,150 +301,216 @@ namespace OloEngine
 
     // ── Implementation ───────────────────────────────────────────────────
 
-    glm::vec3 MarchingCubes::InterpolateEdge(const glm::vec3& p1, const glm::vec3& p2, f32 v1, f32 v2)
-    {
-        if (std::abs(v1) < 1e-6f)
-            return p1;
-        if (std::abs(v2) < 1e-6f)
-            return p2;
-        if (std::abs(v1 - v2) < 1e-6f)
-            return p1;
-        f32 t = -v1 / (v2 - v1);
-        return p1 + t * (p2 - p1);
-    }
-
-    glm::vec3 MarchingCubes::ComputeGradient(const VoxelChunk& chunk, u32 x, u32 y, u32 z)
+    namespace
     {
         constexpr u32 S = VoxelChunk::CHUNK_SIZE;
-        f32 gx = chunk.At(std::min(x + 1, S - 1), y, z) - chunk.At(x > 0 ? x - 1 : 0, y, z);
-        f32 gy = chunk.At(x, std::min(y + 1, S - 1), z) - chunk.At(x, y > 0 ? y - 1 : 0, z);
-        f32 gz = chunk.At(x, y, std::min(z + 1, S - 1)) - chunk.At(x, y, z > 0 ? z - 1 : 0);
-        glm::vec3 grad(gx, gy, gz);
-        f32 len = glm::length(grad);
-        return len > 1e-6f ? grad / len : glm::vec3(0.0f, 1.0f, 0.0f);
-    }
+        static_assert(S <= 32 && S % 4 == 0, "corner signs are packed one u32 per row, four lanes at a time");
 
-    bool MarchingCubes::GenerateMesh(const VoxelChunk& chunk, const VoxelCoord& coord,
-                                     f32 voxelSize, VoxelMesh& outMesh)
+        // Bit x set: cell x of a row has corners on both sides of the surface.
+        constexpr u32 kRowCellMask = (S == 32) ? 0x7FFFFFFFu : ((1u << (S - 1)) - 1u);
+        constexpr u32 kNoVertex = std::numeric_limits<u32>::max();
+
+        // Where each of the 12 cube edges sits on the voxel grid: its lower
+        // corner's offset from the cell origin and the axis it runs along. An
+        // edge is shared by up to four cells; keying the vertex cache by
+        // (lower corner, axis) is what makes them find the same vertex.
+        struct EdgeLocation
+        {
+            u8 DX, DY, DZ, Axis;
+        };
+
+        constexpr EdgeLocation kEdgeLocations[12] = {
+            { 0, 0, 0, 0 }, { 1, 0, 0, 1 }, { 0, 1, 0, 0 }, { 0, 0, 0, 1 }, { 0, 0, 1, 0 }, { 1, 0, 1, 1 },
+            { 0, 1, 1, 0 }, { 0, 0, 1, 1 }, { 0, 0, 0, 2 }, { 1, 0, 0, 2 }, { 1, 1, 0, 2 }, { 0, 1, 0, 2 }
+        };
+
+        // Bit x is set when voxel x of the row is inside (SDF < 0) — the same
+        // test as the per-corner one, so NaN reads as outside either way.
+        u32 ClassifyRow(const f32* row)
+        {
+#if OLO_MARCHING_CUBES_HAS_SSE2
+            const __m128 zero = _mm_setzero_ps();
+            u32 mask = 0;
+            for (u32 x = 0; x < S; x += 4)
+            {
+                mask |= static_cast<u32>(_mm_movemask_ps(_mm_cmplt_ps(_mm_loadu_ps(row + x), zero))) << x;
+            }
+            return mask;
+#else
+            u32 mask = 0;
+            for (u32 x = 0; x < S; ++x)
+            {
+                mask |= (row[x] < 0.0f ? 1u : 0u) << x;
+            }
+            return mask;
+#endif
+        }
+
+        // Un-normalized SDF gradient (central differences, clamped at the
+        // chunk border) at voxel (x, y, z).
+        glm::vec3 SampleGradient(const f32* sdf, u32 x, u32 y, u32 z)
+        {
+            const auto at = [sdf](u32 ix, u32 iy, u32 iz)
+            {
+                return sdf[VoxelChunk::Index(ix, iy, iz)];
+            };
+            return {
+                at(std::min(x + 1, S - 1), y, z) - at(x > 0 ? x - 1 : 0, y, z),
+                at(x, std::min(y + 1, S - 1), z) - at(x, y > 0 ? y - 1 : 0, z),
+                at(x, y, std::min(z + 1, S - 1)) - at(x, y, z > 0 ? z - 1 : 0)
+            };
+        }
+    } // namespace
+
+    bool MarchingCubes::Polygonize(const VoxelChunk& chunk, const VoxelCoord& coord,
+                                   f32 voxelSize, VoxelMeshData& outData)
     {
         OLO_PROFILE_FUNCTION();
 
-        constexpr u32 S = VoxelChunk::CHUNK_SIZE;
-
-        std::vector<VoxelVertex> vertices;
-        std::vector<u32> indices;
+        outData.Vertices.clear();
+        outData.Indices.clear();
+        if (chunk.SDFData.size() != VoxelChunk::TOTAL_VOXELS)
+        {
+            return false;
+        }
+        const f32* sdf = chunk.SDFData.data();
 
-        static const glm::ivec3 cornerOffsets[8] = {
-            { 0, 0, 0 }, { 1, 0, 0 }, { 1, 1, 0 }, { 0, 1, 0 }, { 0, 0, 1 }, { 1, 0, 1 }, { 1, 1, 1 }, { 0, 1, 1 }
-        };
+        // Inside/outside sign of every voxel, one bit per x, a row per (y, z).
+        std::vector<u32> rowSigns(static_cast<sizet>(S) * S);
+        for (u32 z = 0; z < S; ++z)
+        {
+            for (u32 y = 0; y < S; ++y)
+            {
+                rowSigns[y + z * S] = ClassifyRow(sdf + VoxelChunk::Index(0, y, z));
+            }
+        }
 
-        static const i32 edgeConnections[12][2] = {
-            { 0, 1 }, { 1, 2 }, { 2, 3 }, { 3, 0 }, { 4, 5 }, { 5, 6 }, { 6, 7 }, { 7, 4 }, { 0, 4 }, { 1, 5 }, { 2, 6 }, { 3, 7 }
-        };
+        // Vertex index per (corner, axis) for the two corner planes the current
+        // layer of cells spans; plane z lives in slab z & 1.
+        constexpr sizet kSlabSize = static_cast<sizet>(S) * S * 3;
+        std::vector<u32> edgeVertex(kSlabSize * 2, kNoVertex);
 
-        f32 chunkWorldSize = static_cast<f32>(S) * voxelSize;
-        glm::vec3 chunkOrigin(
+        const f32 chunkWorldSize = static_cast<f32>(S) * voxelSize;
+        const glm::vec3 chunkOrigin(
             static_cast<f32>(coord.X) * chunkWorldSize,
             static_cast<f32>(coord.Y) * chunkWorldSize,
             static_cast<f32>(coord.Z) * chunkWorldSize);
+        const auto voxelCentre = [&](u32 x, u32 y, u32 z)
+        {
+            return chunkOrigin + (glm::vec3(static_cast<f32>(x), static_cast<f32>(y), static_cast<f32>(z)) + 0.5f) * voxelSize;
+        };
 
         glm::vec3 boundsMin(std::numeric_limits<f32>::max());
         glm::vec3 boundsMax(std::numeric_limits<f32>::lowest());
 
-        for (u32 z = 0; z < S - 1; ++z)
+        // The vertex on edge `e` of cell (x, y, z), created on first use. It is
+        // placed and shaded from the edge's lower corner towards its upper one
+        // whichever cell asks, so every cell sharing the edge gets the same
+        // vertex; the normal blends the two corner gradients by the crossing.
+        const auto edgeVertexFor = [&](u32 x, u32 y, u32 z, i32 e) -> u32
         {
-            for (u32 y = 0; y < S - 1; ++y)
+            const EdgeLocation& loc = kEdgeLocations[e];
+            const u32 ax = x + loc.DX;
+            const u32 ay = y + loc.DY;
+            const u32 az = z + loc.DZ;
+            u32& slot = edgeVertex[(az & 1u) * kSlabSize + (static_cast<sizet>(ay) * S + ax) * 3 + loc.Axis];
+            if (slot != kNoVertex)
             {
-                for (u32 x = 0; x < S - 1; ++x)
-                {
-                    f32 cubeVals[8];
-                    glm::vec3 cubePos[8];
-
-                    for (i32 c = 0; c < 8; ++c)
-                    {
-                        u32 cx = x + static_cast<u32>(cornerOffsets[c].x);
-                        u32 cy = y + static_cast<u32>(cornerOffsets[c].y);
-                        u32 cz = z + static_cast<u32>(cornerOffsets[c].z);
-                        cubeVals[c] = chunk.At(cx, cy, cz);
-                        cubePos[c] = chunkOrigin + glm::vec3(
-                                                       (static_cast<f32>(cx) + 0.5f) * voxelSize,
-                                                       (static_cast<f32>(cy) + 0.5f) * voxelSize,
-                                                       (static_cast<f32>(cz) + 0.5f) * voxelSize);
-                    }
-
-                    i32 cubeIndex = 0;
-                    for (i32 c = 0; c < 8; ++c)
-                    {
-                        if (cubeVals[c] < 0.0f)
-                        {
-                            cubeIndex |= (1 << c);
-                        }
-                    }
-
-                    if (s_EdgeTable[cubeIndex] == 0)
-                    {
-                        continue;
-                    }
+                return slot;
+            }
 
-                    glm::vec3 edgeVerts[12];
-                    for (i32 e = 0; e < 12; ++e)
-                    {
-                        if (s_EdgeTable[cubeIndex] & (1 << e))
-                        {
-                            i32 c0 = edgeConnections[e][0];
-                            i32 c1 = edgeConnections[e][1];
-                            edgeVerts[e] = InterpolateEdge(cubePos[c0], cubePos[c1], cubeVals[c0], cubeVals[c1]);
-                        }
-                    }
+            const u32 bx = ax + (loc.Axis == 0 ? 1u : 0u);
+            const u32 by = ay + (loc.Axis == 1 ? 1u : 0u);
+            const u32 bz = az + (loc.Axis == 2 ? 1u : 0u);
+            const f32 va = sdf[VoxelChunk::Index(ax, ay, az)];
+            const f32 vb = sdf[VoxelChunk::Index(bx, by, bz)];
+
+            f32 t = 0.0f;
+            if (std::abs(va) < 1e-6f)
+                t = 0.0f;
+            else if (std::abs(vb) < 1e-6f)
+                t = 1.0f;
+            else if (std::abs(va - vb) >= 1e-6f)
+                t = -va / (vb - va);
+
+            const glm::vec3 pa = voxelCentre(ax, ay, az);
+            const glm::vec3 pb = voxelCentre(bx, by, bz);
+            const glm::vec3 position = pa + t * (pb - pa);
+
+            const glm::vec3 gradient = glm::mix(SampleGradient(sdf, ax, ay, az), SampleGradient(sdf, bx, by, bz), t);
+            const f32 length = glm::length(gradient);
+            const glm::vec3 normal = length > 1e-6f ? gradient / length : glm::vec3(0.0f, 1.0f, 0.0f);
+
+            boundsMin = glm::min(boundsMin, position);
+            boundsMax = glm::max(boundsMax, position);
+
+            slot = static_cast<u32>(outData.Vertices.size());
+            outData.Vertices.push_back({ position, normal });
+            return slot;
+        };
 
-                    for (i32 t = 0; s_TriTable[cubeIndex][t] != -1; t += 3)
-                    {
-                        u32 baseIdx = static_cast<u32>(vertices.size());
+        for (u32 z = 0; z < S - 1; ++z)
+        {
+            // Plane z + 1 reuses the slab of plane z - 1, whose edges no
+            // remaining cell touches.
+            std::fill_n(edgeVertex.begin() + static_cast<std::ptrdiff_t>(((z + 1) & 1u) * kSlabSize), kSlabSize, kNoVertex);
 
-                        for (i32 v = 0; v < 3; ++v)
-                        {
-                            i32 edgeIdx = s_TriTable[cubeIndex][t + v];
-                            glm::vec3 pos = edgeVerts[edgeIdx];
+            for (u32 y = 0; y < S - 1; ++y)
+            {
+                const u32 m0 = rowSigns[y + z * S];             // corners 0, 1
+                const u32 m1 = rowSigns[(y + 1) + z * S];       // corners 3, 2
+                const u32 m2 = rowSigns[y + (z + 1) * S];       // corners 4, 5
+                const u32 m3 = rowSigns[(y + 1) + (z + 1) * S]; // corners 7, 6
 
-                            i32 c0 = edgeConnections[edgeIdx][0];
-                            u32 nx = x + static_cast<u32>(cornerOffsets[c0].x);
-                            u32 ny = y + static_cast<u32>(cornerOffsets[c0].y);
-                            u32 nz = z + static_cast<u32>(cornerOffsets[c0].z);
-                            glm::vec3 normal = ComputeGradient(chunk, nx, ny, nz);
+                // A cell is on the surface unless all eight corners agree.
+                const u32 allInside = m0 & m1 & m2 & m3;
+                const u32 anyInside = m0 | m1 | m2 | m3;
+                u32 active = (anyInside | (anyInside >> 1)) & ~(allInside & (allInside >> 1)) & kRowCellMask;
 
-                            vertices.push_back({ pos, normal });
+                while (active != 0)
+                {
+                    const auto x = static_cast<u32>(std::countr_zero(active));
+                    active &= active - 1;
 
-                            boundsMin = glm::min(boundsMin, pos);
-                            boundsMax = glm::max(boundsMax, pos);
-                        }
+                    const i32 cubeIndex = static_cast<i32>(((m0 >> x) & 1u) | (((m0 >> (x + 1)) & 1u) << 1) |
+                                                           (((m1 >> (x + 1)) & 1u) << 2) | (((m1 >> x) & 1u) << 3) |
+                                                           (((m2 >> x) & 1u) << 4) | (((m2 >> (x + 1)) & 1u) << 5) |
+                                                           (((m3 >> (x + 1)) & 1u) << 6) | (((m3 >> x) & 1u) << 7));
 
-                        indices.push_back(baseIdx);
-                        indices.push_back(baseIdx + 1);
-                        indices.push_back(baseIdx + 2);
+                    for (i32 t = 0; s_TriTable[cubeIndex][t] != -1; ++t)
+                    {
+                        outData.Indices.push_back(edgeVertexFor(x, y, z, s_TriTable[cubeIndex][t]));
                     }
                 }
             }
         }
 
-        if (vertices.empty())
+        if (outData.Indices.empty())
         {
             return false;
         }
 
-        if (boundsMin.x >= boundsMax.x)
+        for (i32 axis = 0; axis < 3; ++axis)
         {
-            boundsMin.x -= 0.01f;
-            boundsMax.x += 0.01f;
-        }
-        if (boundsMin.y >= boundsMax.y)
-        {
-            boundsMin.y -= 0.01f;
-            boundsMax.y += 0.01f;
+            if (boundsMin[axis] >= boundsMax[axis])
+            {
+                boundsMin[axis] -= 0.01f;
+                boundsMax[axis] += 0.01f;
+            }
         }
-        if (boundsMin.z >= boundsMax.z)
+        outData.BoundsMin = boundsMin;
+        outData.BoundsMax = boundsMax;
+
+        return true;
+    }
+
+    bool MarchingCubes::UploadMesh(const VoxelMeshData& data, const VoxelCoord& coord, VoxelMesh& outMesh)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        if (data.IsEmpty())
         {
-            boundsMin.z -= 0.01f;
-            boundsMax.z += 0.01f;
+            return false;
         }
 
         auto vao = VertexArray::Create();
@@ -445,21 +520,32 @@ namespace OloEngine
             { ShaderDataType::Float3, "a_Normal" }
         };
 
-        auto vbo = VertexBuffer::Create(vertices.data(), static_cast<u32>(vertices.size() * sizeof(VoxelVertex)));
+        auto vbo = VertexBuffer::Create(data.Vertices.data(), static_cast<u32>(data.Vertices.size() * sizeof(VoxelVertex)));
         vbo->SetLayout(layout);
         vao->AddVertexBuffer(vbo);
 
-        auto ibo = IndexBuffer::Create(indices.data(), static_cast<u32>(indices.size()));
+        // IndexBuffer::Create takes a mutable pointer.
+        auto ibo = IndexBuffer::Create(const_cast<u32*>(data.Indices.data()), static_cast<u32>(data.Indices.size()));
         vao->SetIndexBuffer(ibo);
 
         outMesh.ChunkCoord = coord;
-        outMesh.Bounds = BoundingBox(boundsMin, boundsMax);
+        outMesh.Bounds = BoundingBox(data.BoundsMin, data.BoundsMax);
         outMesh.VAO = vao;
-        outMesh.IndexCount = static_cast<u32>(indices.size());
+        outMesh.IndexCount = static_cast<u32>(data.Indices.size());
+        outMesh.VertexCount = static_cast<u32>(data.Vertices.size());
 
         return true;
     }
 
+    bool MarchingCubes::GenerateMesh(const VoxelChunk& chunk, const VoxelCoord& coord,
+                                     f32 voxelSize, VoxelMesh& outMesh)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        VoxelMeshData data;
+        return Polygonize(chunk, coord, voxelSize, data) && UploadMesh(data, coord, outMesh);
+    }
+
     void MarchingCubes::RebuildDirtyMeshes(VoxelOverride& voxels,
                                            std::unordered_map<VoxelCoord, VoxelMesh, VoxelCoordHash>& meshes)
     {
@@ -467,12 +553,20 @@ namespace OloEngine
 
         std::vector<VoxelCoord> dirtyCoords;
         voxels.GetDirtyChunks(dirtyCoords);
-
-        for (const auto& coord : dirtyCoords)
+        if (dirtyCoords.empty())
         {
-            const auto& chunk = voxels.GetChunks()[coord];
+            return;
+        }
 
-            if (VoxelMesh mesh; GenerateMesh(chunk, coord, voxels.GetVoxelSize(), mesh))
+        const auto& chunks = voxels.GetChunks();
+        std::vector<VoxelMeshData> data(dirtyCoords.size());
+        ParallelFor("MarchingCubes::RebuildDirtyMeshes", static_cast<i32>(dirtyCoords.size()), 1, [&](i32 i)
+                    { Polygonize(chunks.at(dirtyCoords[i]), dirtyCoords[i], voxels.GetVoxelSize(), data[i]); });
+
+        for (sizet i = 0; i < dirtyCoords.size(); ++i)
+        {
+            const VoxelCoord& coord = dirtyCoords[i];
+            if (VoxelMesh mesh; UploadMesh(data[i], coord, mesh))
             {
                 meshes[coord] = std::move(mesh);
             }
@@ -26,20 +26,57 @@ namespace OloEngine
         BoundingBox Bounds;
         Ref<VertexArray> VAO;
         u32 IndexCount = 0;
+        u32 VertexCount = 0;
+    };
+
+    // The CPU half of a marching-cubes mesh: welded vertices and triangle
+    // indices in terrain-local space, before upload. Pure data, so it can be
+    // built on a worker.
+    struct VoxelMeshData
+    {
+        std::vector<VoxelVertex> Vertices;
+        std::vector<u32> Indices;
+        glm::vec3 BoundsMin{ 0.0f };
+        glm::vec3 BoundsMax{ 0.0f };
+
+        [[nodiscard]] bool IsEmpty() const
+        {
+            return Indices.empty();
+        }
     };
 
     // Generates meshes from voxel SDF data using the Marching Cubes algorithm.
     // Normals are computed from the SDF gradient (central differences).
+    //
+    // Vertices are welded: every cell edge crossing the surface produces one
+    // vertex, shared by all the triangles of the (up to four) cells around it,
+    // so a closed surface indexes roughly one vertex per two triangles instead
+    // of three. Corner signs are classified a whole row at a time into bit
+    // masks, which lets runs of cells that are entirely inside or outside be
+    // skipped without reading their corners.
     class MarchingCubes
     {
       public:
-        // Generate a mesh from a single voxel chunk.
+        // Pure CPU: polygonize one chunk into `outData` (cleared first). Safe to
+        // call from any thread as long as `chunk` isn't being written.
+        // Returns true if the chunk has a non-empty isosurface.
+        static bool Polygonize(const VoxelChunk& chunk, const VoxelCoord& coord,
+                               f32 voxelSize, VoxelMeshData& outData);
+
+        // Upload polygonized data into a renderable mesh. Returns false (and
+        // leaves `outMesh` alone) for empty data. Render thread only.
+        static bool UploadMesh(const VoxelMeshData& data, const VoxelCoord& coord, VoxelMesh& outMesh);
+
+        // Generate a mesh from a single voxel chunk: Polygonize + UploadMesh.
         // Returns true if the chunk has a non-empty isosurface.
         static bool GenerateMesh(const VoxelChunk& chunk, const VoxelCoord& coord,
                                  f32 voxelSize, VoxelMesh& outMesh);
 
-        // Generate meshes for all dirty chunks in a VoxelOverride.
-        // Meshes are stored in the provided map, keyed by chunk coordinate.
+        // Generate meshes for all dirty chunks in a VoxelOverride, blocking
+        // until done: chunks are polygonized across the task workers, then
+        // uploaded on the calling thread. Meshes are stored in the provided
+        // map, keyed by chunk coordinate. The frame loop uses
+        // MarchingCubesMeshBuilder instead, which never blocks.
         static void RebuildDirtyMeshes(VoxelOverride& voxels,
                                        std::unordered_map<VoxelCoord, VoxelMesh, VoxelCoordHash>& meshes);
 
@@ -47,11 +84,5 @@ namespace OloEngine
         // Edge table and triangle table for MC lookup
         static const i32 s_EdgeTable[256];
         static const i32 s_TriTable[256][16];
-
-        // Interpolate vertex position along an edge based on SDF values
-        static glm::vec3 InterpolateEdge(const glm::vec3& p1, const glm::vec3& p2, f32 v1, f32 v2);
-
-        // Compute SDF gradient (normal direction) at a given voxel position
-        static glm::vec3 ComputeGradient(const VoxelChunk& chunk, u32 x, u32 y, u32 z);
     };
 } // namespace OloEngine
@@ -0,0 +1,126 @@
+#include "OloEnginePCH.h"
+#include "OloEngine/Terrain/Voxel/MarchingCubesMeshBuilder.h"
+
+#include <algorithm>
+
+namespace OloEngine
+{
+    MarchingCubesMeshBuilder::~MarchingCubesMeshBuilder()
+    {
+        Clear();
+    }
+
+    void MarchingCubesMeshBuilder::Clear()
+    {
+        // Abandon, don't wait: a job holds only its own MeshJob, never `this`.
+        m_Pending.clear();
+        m_Meshes.clear();
+    }
+
+    u32 MarchingCubesMeshBuilder::GetTriangleCount() const
+    {
+        u32 total = 0;
+        for (const auto& [coord, mesh] : m_Meshes)
+        {
+            total += mesh.IndexCount / 3;
+        }
+        return total;
+    }
+
+    void MarchingCubesMeshBuilder::Update(VoxelOverride& voxels, const glm::vec3& cameraLocalPos)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        DispatchDirty(voxels, cameraLocalPos);
+        CollectCompleted();
+    }
+
+    void MarchingCubesMeshBuilder::FlushPending(VoxelOverride& voxels, const glm::vec3& cameraLocalPos)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        DispatchDirty(voxels, cameraLocalPos);
+        for (auto& [coord, pending] : m_Pending)
+        {
+            pending.Task.Wait();
+        }
+        CollectCompleted();
+    }
+
+    void MarchingCubesMeshBuilder::DispatchDirty(VoxelOverride& voxels, const glm::vec3& cameraLocalPos)
+    {
+        OLO_PROFILE_FUNCTION();
+
+        std::vector<VoxelCoord> dirtyCoords;
+        voxels.GetDirtyChunks(dirtyCoords);
+        if (dirtyCoords.empty())
+        {
+            return;
+        }
+
+        // Nearest first. Unlike the greedy mesher there is no neighbour ring to
+        // add: a marching-cubes chunk only reads its own voxels.
+        struct Ranked
+        {
+            VoxelCoord Coord;
+            f32 DistanceSq = 0.0f;
+        };
+        std::vector<Ranked> ranked;
+        ranked.reserve(dirtyCoords.size());
+        for (const auto& coord : dirtyCoords)
+        {
+            const glm::vec3 offset = voxels.GetChunkBounds(coord).GetCenter() - cameraLocalPos;
+            ranked.push_back({ coord, glm::dot(offset, offset) });
+        }
+        // Stable, so equidistant chunks keep GetDirtyChunks' order.
+        std::ranges::stable_sort(ranked, {}, &Ranked::DistanceSq);
+
+        const auto& chunks = voxels.GetChunks();
+        const f32 voxelSize = voxels.GetVoxelSize();
+        for (sizet i = 0; i < ranked.size(); ++i)
+        {
+            const VoxelCoord coord = ranked[i].Coord;
+
+            // A job already running for this chunk meshes a pre-edit snapshot;
+            // abandon it rather than upload stale triangles.
+            m_Pending.erase(coord);
+
+            auto job = std::make_shared<MeshJob>();
+            job->Chunk = chunks.at(coord);
+
+            const Tasks::ETaskPriority priority = i < kForegroundChunks ? Tasks::ETaskPriority::Normal
+                                                                        : Tasks::ETaskPriority::BackgroundNormal;
+            auto task = Tasks::Launch("MarchingCubesMesh", [job, coord, voxelSize]() mutable -> bool
+                                      { return MarchingCubes::Polygonize(job->Chunk, coord, voxelSize, job->Data); }, priority);
+
+            m_Pending.emplace(coord, PendingMesh{ std::move(task), std::move(job) });
+            voxels.MarkChunkClean(coord);
+        }
+    }
+
+    void MarchingCubesMeshBuilder::CollectCompleted()
+    {
+        OLO_PROFILE_FUNCTION();
+
+        auto it = m_Pending.begin();
+        while (it != m_Pending.end())
+        {
+            if (!it->second.Task.IsCompleted())
+            {
+                ++it;
+                continue;
+            }
+
+            if (VoxelMesh mesh; MarchingCubes::UploadMesh(it->second.Job->Data, it->first, mesh))
+            {
+                m_Meshes[it->first] = std::move(mesh);
+            }
+            else
+            {
+                m_Meshes.erase(it->first);
+            }
+
+            it = m_Pending.erase(it);
+        }
+    }
+} // namespace OloEngine
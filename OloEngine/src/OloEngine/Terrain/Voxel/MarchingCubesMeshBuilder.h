@@ -0,0 +1,82 @@
+#pragma once
+
+#include "OloEngine/Core/Base.h"
+#include "OloEngine/Core/Ref.h"
+#include "OloEngine/Task/Task.h"
+#include "OloEngine/Terrain/Voxel/MarchingCubes.h"
+#include "OloEngine/Terrain/Voxel/VoxelOverride.h"
+
+#include <glm/glm.hpp>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace OloEngine
+{
+    // Owns the marching-cubes meshes of one VoxelOverride and keeps them up to
+    // date — the smooth-surface counterpart of VoxelGreedyMeshBuilder, with the
+    // same threading contract: the game thread snapshots each dirty chunk and,
+    // later, uploads finished vertex buffers; MarchingCubes::Polygonize runs on
+    // a worker.
+    //
+    // Dirty chunks are dispatched nearest-first from the camera, and the
+    // nearest kForegroundChunks go out at foreground priority, so the chunk
+    // being dug into is remeshed ahead of a large edit's far side.
+    class MarchingCubesMeshBuilder : public RefCounted
+    {
+      public:
+        static constexpr u32 kForegroundChunks = 8;
+
+        MarchingCubesMeshBuilder() = default;
+        // Retires without blocking; see VoxelGreedyMeshBuilder's destructor,
+        // whose reasoning applies unchanged (jobs capture only their own
+        // shared_ptr'd snapshot).
+        ~MarchingCubesMeshBuilder() override;
+
+        // Game thread. Dispatches meshing for chunks that changed, ordered by
+        // distance from `cameraLocalPos` (terrain-local, the space chunk
+        // bounds are in), and uploads any jobs that finished since the last
+        // call. Never blocks on a worker.
+        void Update(VoxelOverride& voxels, const glm::vec3& cameraLocalPos);
+
+        // Blocks until every in-flight mesh job has been collected and uploaded.
+        // For tests and offline capture — not for the frame loop.
+        void FlushPending(VoxelOverride& voxels, const glm::vec3& cameraLocalPos = glm::vec3(0.0f));
+
+        [[nodiscard]] const std::unordered_map<VoxelCoord, VoxelMesh, VoxelCoordHash>& GetMeshes() const
+        {
+            return m_Meshes;
+        }
+
+        [[nodiscard]] bool HasPendingWork() const
+        {
+            return !m_Pending.empty();
+        }
+
+        [[nodiscard]] u32 GetTriangleCount() const;
+
+        // Drops every mesh and abandons any in-flight job. Non-blocking.
+        void Clear();
+
+      private:
+        // Owned by the worker for the duration of the job; the game thread only
+        // touches it once the task reports completion.
+        struct MeshJob
+        {
+            VoxelChunk Chunk;
+            VoxelMeshData Data;
+        };
+
+        struct PendingMesh
+        {
+            Tasks::TTask<bool> Task;
+            std::shared_ptr<MeshJob> Job;
+        };
+
+        void DispatchDirty(VoxelOverride& voxels, const glm::vec3& cameraLocalPos);
+        void CollectCompleted();
+
+        std::unordered_map<VoxelCoord, VoxelMesh, VoxelCoordHash> m_Meshes;
+        std::unordered_map<VoxelCoord, PendingMesh, VoxelCoordHash> m_Pending;
+    };
+} // namespace OloEngine
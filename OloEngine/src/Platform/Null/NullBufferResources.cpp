@@ -0,0 +1,162 @@
+#include "OloEnginePCH.h"
+#include "Platform/Null/NullBufferResources.h"
+
+#include "OloEngine/Renderer/RenderCommand.h"
+#include "Platform/Null/NullRendererAPI.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace OloEngine
+{
+    // =========================================================================
+    // NullVertexBuffer
+    // =========================================================================
+
+    NullVertexBuffer::NullVertexBuffer(u32 size)
+        : m_Size(size), m_RHIHandle(RHI::ResourceKind::Buffer, NullRendererAPI::MintObjectOrdinal(), RHI::Backend::Null)
+    {
+    }
+
+    void NullVertexBuffer::SetData(const VertexData& data)
+    {
+        // Nothing to store; keep the GL twin's overflow check so a caller that
+        // trips it there trips it here.
+        OLO_CORE_ASSERT(data.size <= m_Size, "VertexBuffer SetData overflow: data.size({}) > allocated({})", data.size, m_Size);
+    }
+
+    // =========================================================================
+    // NullIndexBuffer
+    // =========================================================================
+
+    NullIndexBuffer::NullIndexBuffer(u32 count)
+        : m_Count(count), m_RHIHandle(RHI::ResourceKind::Buffer, NullRendererAPI::MintObjectOrdinal(), RHI::Backend::Null)
+    {
+    }
+
+    // =========================================================================
+    // NullVertexArray
+    // =========================================================================
+
+    NullVertexArray::NullVertexArray()
+        : m_RHIHandle(RHI::ResourceKind::VertexArray, NullRendererAPI::MintObjectOrdinal(), RHI::Backend::Null)
+    {
+    }
+
+    void NullVertexArray::Bind() const
+    {
+        RenderCommand::BindVertexArrayRaw(m_RHIHandle.Get());
+    }
+
+    void NullVertexArray::Unbind() const
+    {
+        RenderCommand::BindVertexArrayRaw(RHI::NullResource);
+    }
+
+    void NullVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer)
+    {
+        OLO_CORE_ASSERT(vertexBuffer->GetLayout().GetElements().size(), "Vertex Buffer has no layout!");
+        m_VertexBuffers.push_back(vertexBuffer);
+    }
+
+    void NullVertexArray::AddInstanceBuffer(const Ref<VertexBuffer>& vertexBuffer)
+    {
+        AddVertexBuffer(vertexBuffer);
+    }
+
+    void NullVertexArray::AddConstantVertexBuffer(const Ref<VertexBuffer>& vertexBuffer)
+    {
+        AddVertexBuffer(vertexBuffer);
+    }
+
+    void NullVertexArray::SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer)
+    {
+        m_IndexBuffer = indexBuffer;
+    }
+
+    // =========================================================================
+    // NullUniformBuffer
+    // =========================================================================
+
+    NullUniformBuffer::NullUniformBuffer(u32 size, u32 binding)
+        : m_Binding(binding), m_RHIHandle(RHI::ResourceKind::Buffer, NullRendererAPI::MintObjectOrdinal(), RHI::Backend::Null)
+    {
+        EnsureShadow(size);
+    }
+
+    void NullUniformBuffer::EnsureShadow(u32 requiredSize)
+    {
+        if (requiredSize == 0 || requiredSize <= m_Size)
+            return;
+
+        auto* newBuf = new u8[requiredSize]{};
+        if (m_LocalData)
+        {
+            std::memcpy(newBuf, m_LocalData, m_Size);
+            delete[] static_cast<u8*>(m_LocalData);
+        }
+        m_LocalData = newBuf;
+        m_Size = requiredSize;
+    }
+
+    void NullUniformBuffer::SetData(const UniformData& data)
+    {
+        if (data.data == nullptr || data.size == 0)
+            return;
+
+        EnsureShadow(data.offset + data.size);
+        // The base convenience SetData has already written this range when it
+        // is the caller; memmove because the source may be the shadow itself.
+        std::memmove(static_cast<u8*>(m_LocalData) + data.offset, data.data, data.size);
+    }
+
+    void NullUniformBuffer::Bind() const
+    {
+        RenderCommand::BindUniformBuffer(m_Binding, m_RHIHandle.Get());
+    }
+
+    // =========================================================================
+    // NullStorageBuffer
+    // =========================================================================
+
+    NullStorageBuffer::NullStorageBuffer(u32 size, u32 binding, StorageBufferUsage usage)
+        : m_Data(size, 0), m_Binding(binding), m_Usage(usage),
+          m_RHIHandle(RHI::ResourceKind::Buffer, NullRendererAPI::MintObjectOrdinal(), RHI::Backend::Null)
+    {
+    }
+
+    void NullStorageBuffer::Bind() const
+    {
+        RenderCommand::BindStorageBuffer(m_Binding, m_RHIHandle.Get());
+    }
+
+    void NullStorageBuffer::Unbind() const
+    {
+        RenderCommand::BindStorageBuffer(m_Binding, RHI::NullResource);
+    }
+
+    void NullStorageBuffer::SetData(const void* data, u32 size, u32 offset)
+    {
+        OLO_CORE_ASSERT(offset + size <= m_Data.size(), "StorageBuffer::SetData out of range!");
+        if (data && size > 0)
+            std::memcpy(m_Data.data() + offset, data, size);
+    }
+
+    void NullStorageBuffer::GetData(void* outData, u32 size, u32 offset) const
+    {
+        OLO_CORE_ASSERT(offset + size <= m_Data.size(), "StorageBuffer::GetData out of range!");
+        if (outData && size > 0)
+            std::memcpy(outData, m_Data.data() + offset, size);
+    }
+
+    void NullStorageBuffer::ClearData()
+    {
+        std::ranges::fill(m_Data, u8{ 0 });
+    }
+
+    void NullStorageBuffer::Resize(u32 newSize)
+    {
+        // Same contract as the GL twin: the contents do not survive.
+        m_Data.assign(newSize, 0);
+    }
+} // namespace OloEngine
@@ -0,0 +1,225 @@
+#pragma once
+
+// =============================================================================
+// NullBufferResources.h — the buffer-shaped resource factories
+// (VertexBuffer / IndexBuffer / VertexArray / UniformBuffer / StorageBuffer)
+// on the Null backend.
+//
+// No device memory exists, so each object is its descriptor plus an identity:
+// sizes, layouts, counts and bindings are kept, and a Backend::Null handle
+// whose native value is NullRendererAPI::MintObjectOrdinal() stands in for
+// the GL name. Bind() goes through RenderCommand exactly where the GL twin
+// calls the driver, so a frame's binds land in the recorded stream.
+//
+// Contents are kept in host memory only where a caller can read them back:
+// the uniform buffer's base-class shadow and the storage buffer's bytes.
+// Vertex and index data is dropped after its size is noted.
+//
+// Thread-safety: render thread only, like every other backend.
+// =============================================================================
+
+#include "OloEngine/Renderer/IndexBuffer.h"
+#include "OloEngine/Renderer/RHI/RHIResourceRegistry.h"
+#include "OloEngine/Renderer/StorageBuffer.h"
+#include "OloEngine/Renderer/UniformBuffer.h"
+#include "OloEngine/Renderer/VertexArray.h"
+#include "OloEngine/Renderer/VertexBuffer.h"
+
+#include <vector>
+
+namespace OloEngine
+{
+    class NullVertexBuffer : public VertexBuffer
+    {
+      public:
+        explicit NullVertexBuffer(u32 size);
+        ~NullVertexBuffer() override = default;
+
+        void Bind() const override
+        {
+        }
+        void Unbind() const override
+        {
+        }
+
+        void SetData(const VertexData& data) override;
+
+        [[nodiscard]] const BufferLayout& GetLayout() const override
+        {
+            return m_Layout;
+        }
+        void SetLayout(const BufferLayout& layout) override
+        {
+            m_Layout = layout;
+        }
+
+        // Diagnostics-only field: a native GL name does not exist here.
+        [[nodiscard]] u32 GetBufferHandle() const override
+        {
+            return 0;
+        }
+
+        [[nodiscard]] u32 GetSize() const
+        {
+            return m_Size;
+        }
+        [[nodiscard]] RHI::ResourceHandle GetRHIHandle() const
+        {
+            return m_RHIHandle.Get();
+        }
+
+      private:
+        BufferLayout m_Layout;
+        u32 m_Size = 0;
+        RHI::ScopedResourceHandle m_RHIHandle;
+    };
+
+    class NullIndexBuffer : public IndexBuffer
+    {
+      public:
+        explicit NullIndexBuffer(u32 count);
+        ~NullIndexBuffer() override = default;
+
+        void Bind() const override
+        {
+        }
+        void Unbind() const override
+        {
+        }
+
+        [[nodiscard]] u32 GetCount() const override
+        {
+            return m_Count;
+        }
+        // Diagnostics-only field: a native GL name does not exist here.
+        [[nodiscard]] u32 GetBufferHandle() const override
+        {
+            return 0;
+        }
+
+        [[nodiscard]] RHI::ResourceHandle GetRHIHandle() const
+        {
+            return m_RHIHandle.Get();
+        }
+
+      private:
+        u32 m_Count = 0;
+        RHI::ScopedResourceHandle m_RHIHandle;
+    };
+
+    // A CPU aggregate of buffer refs, like the Vulkan twin. Draws identify it
+    // by its handle, which is what NullRendererAPI hashes.
+    class NullVertexArray : public VertexArray
+    {
+      public:
+        NullVertexArray();
+        ~NullVertexArray() override = default;
+
+        void Bind() const override;
+        void Unbind() const override;
+
+        void AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer) override;
+        void AddInstanceBuffer(const Ref<VertexBuffer>& vertexBuffer) override;
+        void AddConstantVertexBuffer(const Ref<VertexBuffer>& vertexBuffer) override;
+        void SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer) override;
+
+        [[nodiscard]] const std::vector<Ref<VertexBuffer>>& GetVertexBuffers() const override
+        {
+            return m_VertexBuffers;
+        }
+        [[nodiscard]] const Ref<IndexBuffer>& GetIndexBuffer() const override
+        {
+            return m_IndexBuffer;
+        }
+
+        // Diagnostics-only field: a native GL name does not exist here.
+        [[nodiscard]] u32 GetRendererID() const override
+        {
+            return 0;
+        }
+        [[nodiscard]] RHI::ResourceHandle GetRHIHandle() const override
+        {
+            return m_RHIHandle.Get();
+        }
+
+      private:
+        std::vector<Ref<VertexBuffer>> m_VertexBuffers;
+        Ref<IndexBuffer> m_IndexBuffer;
+        RHI::ScopedResourceHandle m_RHIHandle;
+    };
+
+    // The base class's m_LocalData shadow is the whole buffer.
+    class NullUniformBuffer : public UniformBuffer
+    {
+      public:
+        NullUniformBuffer(u32 size, u32 binding);
+        ~NullUniformBuffer() override = default;
+
+        void SetData(const UniformData& data) override;
+        void Bind() const override;
+
+        // Diagnostics-only field: a native GL name does not exist here.
+        [[nodiscard]] u32 GetRendererID() const override
+        {
+            return 0;
+        }
+        [[nodiscard]] RHI::ResourceHandle GetRHIHandle() const override
+        {
+            return m_RHIHandle.Get();
+        }
+
+        [[nodiscard]] u32 GetBinding() const
+        {
+            return m_Binding;
+        }
+
+      private:
+        void EnsureShadow(u32 requiredSize);
+
+        u32 m_Binding = 0;
+        RHI::ScopedResourceHandle m_RHIHandle;
+    };
+
+    class NullStorageBuffer : public StorageBuffer
+    {
+      public:
+        NullStorageBuffer(u32 size, u32 binding, StorageBufferUsage usage);
+        ~NullStorageBuffer() override = default;
+
+        void Bind() const override;
+        void Unbind() const override;
+
+        void SetData(const void* data, u32 size, u32 offset = 0) override;
+        void GetData(void* outData, u32 size, u32 offset = 0) const override;
+        void ClearData() override;
+        void Resize(u32 newSize) override;
+
+        // Diagnostics-only field: a native GL name does not exist here.
+        [[nodiscard]] u32 GetRendererID() const override
+        {
+            return 0;
+        }
+        [[nodiscard]] RHI::ResourceHandle GetRHIHandle() const override
+        {
+            return m_RHIHandle.Get();
+        }
+        [[nodiscard]] u32 GetSize() const override
+        {
+            return static_cast<u32>(m_Data.size());
+        }
+        [[nodiscard]] u32 GetBinding() const override
+        {
+            return m_Binding;
+        }
+        [[nodiscard]] StorageBufferUsage GetUsage() const
+        {
+            return m_Usage;
+        }
+
+      private:
+        std::vector<u8> m_Data;
+        u32 m_Binding = 0;
+        StorageBufferUsage m_Usage = StorageBufferUsage::DynamicDraw;
+        RHI::ScopedResourceHandle m_RHIHandle;
+    };
+} // namespace OloEngine
@@ -0,0 +1,177 @@
+#include "OloEnginePCH.h"
+#include "Platform/Null/NullFramebuffer.h"
+
+#include "OloEngine/Renderer/RHI/RHIDescriptorHeap.h"
+#include "OloEngine/Renderer/RenderCommand.h"
+#include "Platform/Null/NullRendererAPI.h"
+
+namespace OloEngine
+{
+    namespace
+    {
+        constexpr u32 s_MaxFramebufferSize = 8192; // same ceiling as the GL twin
+
+        [[nodiscard]] bool IsDepthFormat(const FramebufferTextureFormat format) noexcept
+        {
+            return format == FramebufferTextureFormat::DEPTH24STENCIL8 ||
+                   format == FramebufferTextureFormat::DEPTH_COMPONENT32F;
+        }
+
+        [[nodiscard]] RHI::ScopedResourceHandle Mint(const RHI::ResourceKind kind)
+        {
+            return { kind, NullRendererAPI::MintObjectOrdinal(), RHI::Backend::Null };
+        }
+    } // namespace
+
+    NullFramebuffer::NullFramebuffer(const FramebufferSpecification& spec)
+        : m_Specification(spec), m_RHIHandle(Mint(RHI::ResourceKind::Framebuffer))
+    {
+        for (const auto& attachment : m_Specification.Attachments.Attachments)
+        {
+            if (!IsDepthFormat(attachment.TextureFormat))
+            {
+                m_ColorAttachmentSpecifications.emplace_back(attachment);
+            }
+            else
+            {
+                m_DepthAttachmentSpecification = attachment;
+            }
+        }
+
+        Invalidate();
+    }
+
+    NullFramebuffer::~NullFramebuffer()
+    {
+        // A destructor is noexcept and RetireResource may throw; see
+        // ~OpenGLFramebuffer for why a leaked descriptor is the lesser evil.
+        try
+        {
+            RetireAttachmentViews();
+        }
+        catch (...)
+        {
+            OLO_CORE_ERROR("[RHI/Null] Retiring framebuffer attachment views threw during destruction; they leak.");
+        }
+    }
+
+    void NullFramebuffer::RetireAttachmentViews()
+    {
+        // Before the old identities unregister, as OpenGLFramebuffer does: a
+        // heap view must not outlive the attachment it describes.
+        for (const auto& handle : m_ColorAttachmentHandles)
+        {
+            RHI::DescriptorHeap::Get().RetireResource(handle.Get());
+        }
+        RHI::DescriptorHeap::Get().RetireResource(m_DepthAttachmentHandle.Get());
+    }
+
+    void NullFramebuffer::Invalidate()
+    {
+        RetireAttachmentViews();
+
+        m_ColorAttachmentHandles.clear();
+        m_DepthAttachmentHandle = {};
+
+        m_ColorAttachmentHandles.reserve(m_ColorAttachmentSpecifications.size());
+        for (sizet i = 0; i < m_ColorAttachmentSpecifications.size(); ++i)
+        {
+            m_ColorAttachmentHandles.emplace_back(Mint(RHI::ResourceKind::Texture));
+        }
+        if (m_DepthAttachmentSpecification.TextureFormat != FramebufferTextureFormat::None)
+        {
+            m_DepthAttachmentHandle = Mint(RHI::ResourceKind::Texture);
+        }
+
+        // Fresh attachments read back as their GL counterparts would before
+        // the first clear: zero.
+        m_IntegerClearValues.assign(m_ColorAttachmentSpecifications.size(), 0);
+    }
+
+    void NullFramebuffer::Bind()
+    {
+        RenderCommand::BindFramebuffer(m_RHIHandle.Get());
+        RenderCommand::SetViewport(0, 0, GetRenderViewportWidth(), GetRenderViewportHeight());
+    }
+
+    void NullFramebuffer::Unbind()
+    {
+        RenderCommand::BindDefaultFramebuffer();
+    }
+
+    void NullFramebuffer::Resize(u32 width, u32 height)
+    {
+        if ((0 == width) || (0 == height) || (width > s_MaxFramebufferSize) || (height > s_MaxFramebufferSize))
+        {
+            OLO_CORE_WARN("Attempted to resize framebuffer to {0}, {1}", width, height);
+            return;
+        }
+
+        m_Specification.Width = width;
+        m_Specification.Height = height;
+        m_RenderViewportWidth = 0;
+        m_RenderViewportHeight = 0;
+
+        Invalidate();
+    }
+
+    int NullFramebuffer::ReadPixel(const u32 attachmentIndex, const int /*x*/, const int /*y*/)
+    {
+        OLO_CORE_ASSERT(attachmentIndex < m_ColorAttachmentHandles.size(),
+                        "ReadPixel: attachment index {} >= count {}", attachmentIndex, m_ColorAttachmentHandles.size());
+
+        return m_IntegerClearValues[attachmentIndex];
+    }
+
+    void NullFramebuffer::ClearAttachment(const u32 attachmentIndex, const int value)
+    {
+        OLO_CORE_ASSERT(attachmentIndex < m_ColorAttachmentHandles.size(),
+                        "ClearAttachment: attachment index {} >= count {}", attachmentIndex, m_ColorAttachmentHandles.size());
+
+        m_IntegerClearValues[attachmentIndex] = value;
+        RenderCommand::ClearTextureUInt(m_ColorAttachmentHandles[attachmentIndex].Get(), 0, static_cast<u32>(value));
+    }
+
+    void NullFramebuffer::ClearAttachment(const u32 attachmentIndex, const glm::vec4& value)
+    {
+        OLO_CORE_ASSERT(attachmentIndex < m_ColorAttachmentHandles.size(),
+                        "ClearAttachment: attachment index {} >= count {}", attachmentIndex, m_ColorAttachmentHandles.size());
+
+        RenderCommand::ClearFramebufferColorAttachment(m_RHIHandle.Get(), attachmentIndex, value);
+    }
+
+    void NullFramebuffer::ClearAllAttachments(const glm::vec4& clearColor, int entityIdClear)
+    {
+        if (m_DepthAttachmentSpecification.TextureFormat != FramebufferTextureFormat::None)
+        {
+            RenderCommand::ClearFramebufferDepth(m_RHIHandle.Get(), 1.0f);
+        }
+
+        for (sizet i = 0; i < m_ColorAttachmentSpecifications.size(); ++i)
+        {
+            if (m_ColorAttachmentSpecifications[i].TextureFormat == FramebufferTextureFormat::RED_INTEGER)
+            {
+                m_IntegerClearValues[i] = entityIdClear;
+                RenderCommand::ClearTextureUInt(m_ColorAttachmentHandles[i].Get(), 0, static_cast<u32>(entityIdClear));
+            }
+            else
+            {
+                RenderCommand::ClearFramebufferColorAttachment(m_RHIHandle.Get(), static_cast<u32>(i), clearColor);
+            }
+        }
+    }
+
+    RHI::ResourceHandle NullFramebuffer::GetColorAttachmentHandle(const u32 index) const
+    {
+        OLO_CORE_ASSERT(index < m_ColorAttachmentHandles.size());
+        return m_ColorAttachmentHandles[index].Get();
+    }
+
+    void NullFramebuffer::AttachDepthTextureArrayLayer(RHI::ResourceHandle textureArray, u32 layer)
+    {
+        // The recorder has no layered attach; record the plain depth attach,
+        // so cascades differ in the stream only by what is drawn into them.
+        (void)layer;
+        RenderCommand::AttachFramebufferDepthTexture(m_RHIHandle.Get(), textureArray, 0);
+    }
+} // namespace OloEngine
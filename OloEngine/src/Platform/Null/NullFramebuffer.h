@@ -0,0 +1,103 @@
+#pragma once
+
+// =============================================================================
+// NullFramebuffer.h — Framebuffer on the Null backend.
+//
+// A framebuffer is its specification, one Backend::Null identity for itself
+// and one per attachment, all from NullRendererAPI::MintObjectOrdinal().
+// The lifetimes follow the GL twin: the framebuffer's own handle survives a
+// Resize, the attachment handles are retired and re-minted, so anything
+// holding the old ones sees them go stale exactly as it would on GL.
+//
+// Bind, Unbind and the clears record through RenderCommand. ReadPixel
+// answers with the last integer clear of the attachment, which is what a
+// frame with nothing drawn into it would read back.
+//
+// Thread-safety: render thread only, like every other backend.
+// =============================================================================
+
+#include "OloEngine/Renderer/Framebuffer.h"
+#include "OloEngine/Renderer/RHI/RHIResourceRegistry.h"
+
+#include <vector>
+
+namespace OloEngine
+{
+    class NullFramebuffer : public Framebuffer
+    {
+      public:
+        explicit NullFramebuffer(const FramebufferSpecification& spec);
+        ~NullFramebuffer() override;
+
+        void Bind() override;
+        void Unbind() override;
+
+        void Resize(u32 width, u32 height) override;
+
+        void SetRenderViewportSize(u32 width, u32 height) override
+        {
+            m_RenderViewportWidth = width;
+            m_RenderViewportHeight = height;
+        }
+        [[nodiscard]] u32 GetRenderViewportWidth() const override
+        {
+            return m_RenderViewportWidth > 0 ? m_RenderViewportWidth : m_Specification.Width;
+        }
+        [[nodiscard]] u32 GetRenderViewportHeight() const override
+        {
+            return m_RenderViewportHeight > 0 ? m_RenderViewportHeight : m_Specification.Height;
+        }
+
+        int ReadPixel(u32 attachmentIndex, int x, int y) override;
+
+        void ClearAttachment(u32 attachmentIndex, int value) override;
+        void ClearAttachment(u32 attachmentIndex, const glm::vec4& value) override;
+        void ClearAllAttachments(const glm::vec4& clearColor = glm::vec4(0.0f), int entityIdClear = -1) override;
+
+        // Diagnostics-only fields: native GL names do not exist here.
+        [[nodiscard]] u32 GetColorAttachmentRendererID(u32 /*index*/) const override
+        {
+            return 0;
+        }
+        [[nodiscard]] u32 GetDepthAttachmentRendererID() const override
+        {
+            return 0;
+        }
+
+        [[nodiscard]] RHI::ResourceHandle GetColorAttachmentHandle(u32 index) const override;
+        [[nodiscard]] RHI::ResourceHandle GetDepthAttachmentHandle() const override
+        {
+            return m_DepthAttachmentHandle.Get();
+        }
+        [[nodiscard]] const FramebufferSpecification& GetSpecification() const override
+        {
+            return m_Specification;
+        }
+        [[nodiscard]] u32 GetRendererID() const override
+        {
+            return 0;
+        }
+        [[nodiscard]] RHI::ResourceHandle GetRHIHandle() const override
+        {
+            return m_RHIHandle.Get();
+        }
+
+        void AttachDepthTextureArrayLayer(RHI::ResourceHandle textureArray, u32 layer) override;
+
+      private:
+        // Re-mints every attachment identity for the current specification.
+        void Invalidate();
+        void RetireAttachmentViews();
+
+        FramebufferSpecification m_Specification;
+        std::vector<FramebufferTextureSpecification> m_ColorAttachmentSpecifications;
+        FramebufferTextureSpecification m_DepthAttachmentSpecification;
+        u32 m_RenderViewportWidth = 0;
+        u32 m_RenderViewportHeight = 0;
+
+        RHI::ScopedResourceHandle m_RHIHandle;
+        std::vector<RHI::ScopedResourceHandle> m_ColorAttachmentHandles;
+        RHI::ScopedResourceHandle m_DepthAttachmentHandle;
+        std::vector<int> m_IntegerClearValues; ///< per color attachment, for ReadPixel
+    };
+} // namespace OloEngine
@@ -0,0 +1,1272 @@
+#include "OloEnginePCH.h"
+#include "Platform/Null/NullRendererAPI.h"
+
+#include "OloEngine/Renderer/RHI/RHIResourceRegistry.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <format>
+#include <utility>
+
+namespace OloEngine
+{
+    namespace
+    {
+        // Restarted by each NullRendererAPI; see MintObjectOrdinal.
+        u64 s_NextObjectOrdinal = 1;
+
+        constexpr u64 kHashSeed = 0xcbf29ce484222325ull;
+        constexpr u64 kHashPrime = 0x100000001b3ull;
+
+        // splitmix64's finalizer. FNV alone barely moves the high bits for a
+        // small integer word, and most argument words are small integers.
+        [[nodiscard]] constexpr u64 Mix(u64 value)
+        {
+            value ^= value >> 30;
+            value *= 0xbf58476d1ce4e5b9ull;
+            value ^= value >> 27;
+            value *= 0x94d049bb133111ebull;
+            value ^= value >> 31;
+            return value;
+        }
+
+        [[nodiscard]] constexpr u64 Fold(u64 hash, u64 word)
+        {
+            return (hash ^ Mix(word)) * kHashPrime;
+        }
+
+        [[nodiscard]] u64 Bits(f32 value)
+        {
+            return std::bit_cast<u32>(value);
+        }
+
+        template<typename E>
+        [[nodiscard]] constexpr u64 Enum(E value)
+        {
+            return static_cast<u64>(std::to_underlying(value));
+        }
+
+        [[nodiscard]] constexpr u64 Signed(i32 value)
+        {
+            return static_cast<u64>(static_cast<u32>(value));
+        }
+
+        [[nodiscard]] u64 Text(std::string_view text)
+        {
+            u64 hash = kHashSeed;
+            for (const char c : text)
+                hash = (hash ^ static_cast<u8>(c)) * kHashPrime;
+            return hash;
+        }
+
+        [[nodiscard]] u64 Color(const glm::vec4& color)
+        {
+            return (Bits(color.r) << 32 | Bits(color.g)) ^ Mix(Bits(color.b) << 32 | Bits(color.a));
+        }
+
+        constexpr std::array<std::string_view, static_cast<sizet>(NullCommand::COUNT)> kCommandNames = {
+            "SetViewport",
+            "SetClearColor",
+            "Clear",
+            "ClearDepthOnly",
+            "ClearColorAndDepth",
+            "DrawArrays",
+            "DrawIndexed",
+            "DrawIndexedInstanced",
+            "DrawLines",
+            "DrawIndexedPatches",
+            "DrawIndexedRaw",
+            "DrawIndexedInstancedRaw",
+            "DrawIndexedPatchesRaw",
+            "SetLineWidth",
+            "EnableCulling",
+            "DisableCulling",
+            "FrontCull",
+            "BackCull",
+            "SetCullFace",
+            "SetDepthMask",
+            "SetDepthTest",
+            "SetDepthFunc",
+            "SetBlendState",
+            "SetBlendFunc",
+            "SetBlendEquation",
+            "EnableStencilTest",
+            "DisableStencilTest",
+            "SetStencilFunc",
+            "SetStencilOp",
+            "SetStencilMask",
+            "ClearStencil",
+            "SetPolygonMode",
+            "EnableScissorTest",
+            "DisableScissorTest",
+            "SetScissorBox",
+            "DrawElementsIndirect",
+            "DrawArraysIndirect",
+            "DrawBoundElementsIndirect",
+            "MultiDrawElementsIndirectCountRaw",
+            "DispatchCompute",
+            "DispatchComputeIndirect",
+            "DrawMeshTasks",
+            "MemoryBarrier",
+            "IssueBarrierBatch",
+            "BindDefaultFramebuffer",
+            "BlitFramebufferToDefault",
+            "BindTexture",
+            "BindImageTexture",
+            "SetPolygonOffset",
+            "EnableMultisampling",
+            "DisableMultisampling",
+            "SetColorMask",
+            "SetColorMaskForAttachment",
+            "SetBlendStateForAttachment",
+            "SetBlendFuncForAttachment",
+            "CopyImageSubData",
+            "CopyImageSubDataFull",
+            "CopyImageSubDataRegion",
+            "CopyFramebufferToTexture",
+            "SetDrawBuffers",
+            "RestoreAllDrawBuffers",
+            "CreateDepthArrayCompareOffViewHandle",
+            "SetTextureFilter",
+            "SetTextureWrap",
+            "UploadTextureSubImage2D",
+            "BeginConditionalRender",
+            "EndConditionalRender",
+            "BindUniformBuffer",
+            "BindStorageBuffer",
+            "BindShaderProgram",
+            "BindVertexArrayRaw",
+            "BindFramebuffer",
+            "DrawBoundIndexed",
+            "DrawBoundIndexedInstanced",
+            "DrawBoundArrays",
+            "SetPatchVertexCount",
+            "SetFrontFace",
+            "SetBlendFuncSeparate",
+            "SetClearDepth",
+            "AttachFramebufferColorTexture",
+            "AttachFramebufferDepthTexture",
+            "IsFramebufferComplete",
+            "SetFramebufferDrawAttachments",
+            "RestoreAllFramebufferDrawAttachments",
+            "SetFramebufferReadAttachment",
+            "ClearFramebufferColorAttachment",
+            "ClearFramebufferDepth",
+            "BlitFramebuffer",
+            "AllocateBufferStorage",
+            "AllocatePersistentUploadStorage",
+            "UnmapBuffer",
+            "UploadBufferSubData",
+            "ReadBufferSubData",
+            "CopyBufferSubData",
+            "ClearBufferUInt",
+            "ClearBufferFloat",
+            "CreateMatchingTextureHandle",
+            "CreateTexture2DHandle",
+            "CreateTextureCubemapHandle",
+            "CreateFramebufferHandle",
+            "CreateBufferHandle",
+            "CreateVertexArrayHandle",
+            "DeleteTexture",
+            "DeleteFramebuffer",
+            "DeleteBuffer",
+            "DeleteVertexArray",
+            "SetVertexArrayIndexBuffer",
+            "ClearTextureFloat",
+            "ClearTextureUInt",
+            "UploadTextureSubImage3D",
+            "ReadTextureImage",
+            "ReadTextureSubImage",
+            "TextureBarrier",
+            "CreateQueries",
+            "DeleteQueries",
+            "BeginQuery",
+            "EndQuery",
+            "WriteTimestamp",
+            "CreateFence",
+            "DestroyFence",
+            "PushDebugGroup",
+            "PopDebugGroup",
+            "WaitForDeviceIdle",
+            "SetProgramUniformFloat",
+        };
+
+        constexpr std::array kDrawCommands = {
+            NullCommand::DrawArrays,
+            NullCommand::DrawIndexed,
+            NullCommand::DrawIndexedInstanced,
+            NullCommand::DrawLines,
+            NullCommand::DrawIndexedPatches,
+            NullCommand::DrawIndexedRaw,
+            NullCommand::DrawIndexedInstancedRaw,
+            NullCommand::DrawIndexedPatchesRaw,
+            NullCommand::DrawElementsIndirect,
+            NullCommand::DrawArraysIndirect,
+            NullCommand::DrawBoundElementsIndirect,
+            NullCommand::MultiDrawElementsIndirectCountRaw,
+            NullCommand::DrawMeshTasks,
+            NullCommand::DrawBoundIndexed,
+            NullCommand::DrawBoundIndexedInstanced,
+            NullCommand::DrawBoundArrays,
+        };
+    } // namespace
+
+    auto ToString(NullCommand command) -> std::string_view
+    {
+        const auto index = static_cast<sizet>(command);
+        return index < kCommandNames.size() ? kCommandNames[index] : std::string_view("Unknown");
+    }
+
+    // =========================================================================
+    // Recording
+    // =========================================================================
+
+    NullRendererAPI::ScopedStage::ScopedStage(NullRendererAPI& api, std::string_view name)
+        : m_API(api), m_Index(api.BeginStage(name))
+    {
+    }
+
+    NullRendererAPI::ScopedStage::~ScopedStage()
+    {
+        m_API.EndStage(m_Index);
+    }
+
+    NullRendererAPI::NullRendererAPI()
+        : m_StreamHash(kHashSeed)
+    {
+        s_NextObjectOrdinal = 1;
+    }
+
+    NullRendererAPI::~NullRendererAPI()
+    {
+        ShutdownGpuResources();
+    }
+
+    void NullRendererAPI::Record(NullCommand op, std::initializer_list<u64> arguments)
+    {
+        u64 command = Mix(Enum(op) | (static_cast<u64>(arguments.size()) << 8));
+        for (const u64 word : arguments)
+            command = Fold(command, word);
+
+        m_StreamHash = Fold(m_StreamHash, command);
+        for (OpenStage& stage : m_OpenStages)
+            stage.Hash = Fold(stage.Hash, command);
+
+        ++m_CommandCount;
+        ++m_CallCounts[static_cast<sizet>(op)];
+
+        if (m_CaptureEnabled)
+        {
+            m_Commands.push_back({ op, static_cast<u8>(arguments.size()), static_cast<u32>(m_Arguments.size()) });
+            m_Arguments.insert(m_Arguments.end(), arguments.begin(), arguments.end());
+        }
+    }
+
+    auto NullRendererAPI::HandleWord(RHI::ResourceHandle handle) const -> u64
+    {
+        if (!handle.IsValid())
+            return 0;
+
+        const RHI::NativeHandle native = RHI::ResourceRegistry::Get().ResolveTaggedForBackend(handle);
+        if (native.Owner == RHI::Backend::Null)
+            return native.Value;
+        return (static_cast<u64>(handle.Index) << 32) | handle.Generation;
+    }
+
+    auto NullRendererAPI::VertexArrayWord(const Ref<VertexArray>& vertexArray) const -> u64
+    {
+        return vertexArray ? HandleWord(vertexArray->GetRHIHandle()) : 0;
+    }
+
+    auto NullRendererAPI::GetDrawCallCount() const -> u64
+    {
+        u64 total = 0;
+        for (const NullCommand command : kDrawCommands)
+            total += GetCallCount(command);
+        return total;
+    }
+
+    auto NullRendererAPI::GetDispatchCount() const -> u64
+    {
+        return GetCallCount(NullCommand::DispatchCompute) + GetCallCount(NullCommand::DispatchComputeIndirect);
+    }
+
+    auto NullRendererAPI::DescribeCommand(sizet index) const -> std::string
+    {
+        if (index >= m_Commands.size())
+            return "<out of range>";
+
+        const RecordedCommand& command = m_Commands[index];
+        std::string text(ToString(command.Op));
+        text += '(';
+        for (u32 i = 0; i < command.ArgumentCount; ++i)
+        {
+            if (i > 0)
+                text += ", ";
+            text += std::format("{:#x}", m_Arguments[command.FirstArgument + i]);
+        }
+        text += ')';
+        return text;
+    }
+
+    void NullRendererAPI::ResetRecording()
+    {
+        m_StreamHash = kHashSeed;
+        m_CommandCount = 0;
+        m_CallCounts.fill(0);
+        m_Commands.clear();
+        m_Arguments.clear();
+        m_Stages.clear();
+        m_OpenStages.clear();
+    }
+
+    auto NullRendererAPI::BeginStage(std::string_view name) -> sizet
+    {
+        const sizet index = m_Stages.size();
+        m_Stages.push_back({ std::string(name) });
+        m_OpenStages.push_back({ index, kHashSeed, m_CommandCount, std::chrono::steady_clock::now() });
+        return index;
+    }
+
+    void NullRendererAPI::EndStage(sizet index)
+    {
+        // A ResetRecording() inside the stage dropped it; nothing to close.
+        const auto open = std::ranges::find(m_OpenStages, index, &OpenStage::Index);
+        if (open == m_OpenStages.end())
+            return;
+
+        StageRecord& stage = m_Stages[index];
+        stage.Milliseconds = std::chrono::duration<f64, std::milli>(std::chrono::steady_clock::now() - open->Start).count();
+        stage.CommandCount = m_CommandCount - open->StartCommand;
+        stage.StreamHash = open->Hash;
+        m_OpenStages.erase(open);
+    }
+
+    // =========================================================================
+    // Resources
+    // =========================================================================
+
+    auto NullRendererAPI::Mint(RHI::ResourceKind kind, u32 width, u32 height, RHI::Format format) -> RHI::ResourceHandle
+    {
+        const u64 ordinal = m_NextOrdinal++;
+        const RHI::ResourceHandle handle = RHI::ResourceRegistry::Get().Register(kind, ordinal, RHI::Backend::Null);
+        if (!handle.IsValid())
+        {
+            OLO_CORE_ERROR("NullRendererAPI: resource registry is full ({} handle)", RHI::ToString(kind));
+            return RHI::NullResource;
+        }
+
+        NullObject& object = m_Resources[ordinal];
+        object.Kind = kind;
+        object.Width = width;
+        object.Height = height;
+        object.Format = format;
+        return handle;
+    }
+
+    auto NullRendererAPI::MintObjectOrdinal() -> u64
+    {
+        constexpr u64 kObjectTag = 1ull << 63;
+        return kObjectTag | s_NextObjectOrdinal++;
+    }
+
+    void NullRendererAPI::Retire(RHI::ResourceHandle handle)
+    {
+        if (!handle.IsValid())
+            return;
+
+        const RHI::NativeHandle native = RHI::ResourceRegistry::Get().ResolveTaggedForBackend(handle);
+        if (native.Owner != RHI::Backend::Null)
+            return;
+
+        m_Resources.erase(native.Value);
+        RHI::ResourceRegistry::Get().Unregister(handle);
+    }
+
+    auto NullRendererAPI::Find(RHI::ResourceHandle handle) -> NullObject*
+    {
+        if (!handle.IsValid())
+            return nullptr;
+
+        const RHI::NativeHandle native = RHI::ResourceRegistry::Get().ResolveTaggedForBackend(handle);
+        if (native.Owner != RHI::Backend::Null)
+            return nullptr;
+
+        const auto it = m_Resources.find(native.Value);
+        return it != m_Resources.end() ? &it->second : nullptr;
+    }
+
+    // =========================================================================
+    // RendererAPI
+    // =========================================================================
+
+    void NullRendererAPI::Init()
+    {
+        OLO_CORE_INFO("NullRendererAPI: recording backend, no device");
+    }
+
+    void NullRendererAPI::ShutdownGpuResources()
+    {
+        // Retire by snapshot: the registry is the only place that still knows
+        // the handle for an ordinal.
+        if (m_Resources.empty())
+            return;
+
+        for (const RHI::ResourceRegistry::SnapshotEntry& entry : RHI::ResourceRegistry::Get().Snapshot())
+        {
+            if (entry.Owner == RHI::Backend::Null && m_Resources.contains(entry.Native))
+            {
+                m_Resources.erase(entry.Native);
+                RHI::ResourceRegistry::Get().Unregister(entry.Handle);
+            }
+        }
+    }
+
+    void NullRendererAPI::SetViewport(u32 x, u32 y, u32 width, u32 height)
+    {
+        m_Viewport = { x, y, width, height };
+        Record(NullCommand::SetViewport, { x, y, width, height });
+    }
+
+    void NullRendererAPI::SetClearColor(const glm::vec4& color)
+    {
+        Record(NullCommand::SetClearColor, { Color(color) });
+    }
+
+    void NullRendererAPI::Clear()
+    {
+        Record(NullCommand::Clear, {});
+    }
+
+    void NullRendererAPI::ClearDepthOnly()
+    {
+        Record(NullCommand::ClearDepthOnly, {});
+    }
+
+    void NullRendererAPI::ClearColorAndDepth()
+    {
+        Record(NullCommand::ClearColorAndDepth, {});
+    }
+
+    Viewport NullRendererAPI::GetViewport() const
+    {
+        return m_Viewport;
+    }
+
+    void NullRendererAPI::DrawArrays(const Ref<VertexArray>& vertexArray, u32 vertexCount)
+    {
+        Record(NullCommand::DrawArrays, { VertexArrayWord(vertexArray), vertexCount });
+    }
+
+    void NullRendererAPI::DrawIndexed(const Ref<VertexArray>& vertexArray, u32 indexCount)
+    {
+        Record(NullCommand::DrawIndexed, { VertexArrayWord(vertexArray), indexCount });
+    }
+
+    void NullRendererAPI::DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, u32 indexCount, u32 instanceCount)
+    {
+        Record(NullCommand::DrawIndexedInstanced, { VertexArrayWord(vertexArray), indexCount, instanceCount });
+    }
+
+    void NullRendererAPI::DrawLines(const Ref<VertexArray>& vertexArray, u32 vertexCount)
+    {
+        Record(NullCommand::DrawLines, { VertexArrayWord(vertexArray), vertexCount });
+    }
+
+    void NullRendererAPI::DrawIndexedPatches(const Ref<VertexArray>& vertexArray, u32 indexCount, u32 patchVertices)
+    {
+        Record(NullCommand::DrawIndexedPatches, { VertexArrayWord(vertexArray), indexCount, patchVertices });
+    }
+
+    void NullRendererAPI::DrawIndexedRaw(RHI::ResourceHandle vertexArray, u32 indexCount)
+    {
+        Record(NullCommand::DrawIndexedRaw, { HandleWord(vertexArray), indexCount });
+    }
+
+    void NullRendererAPI::DrawIndexedRaw(RHI::ResourceHandle vertexArray, u32 indexCount, u32 baseIndex)
+    {
+        Record(NullCommand::DrawIndexedRaw, { HandleWord(vertexArray), indexCount, baseIndex });
+    }
+
+    void NullRendererAPI::DrawIndexedInstancedRaw(RHI::ResourceHandle vertexArray, u32 indexCount, u32 baseIndex,
+                                                  u32 instanceCount)
+    {
+        Record(NullCommand::DrawIndexedInstancedRaw, { HandleWord(vertexArray), indexCount, baseIndex, instanceCount });
+    }
+
+    void NullRendererAPI::DrawIndexedPatchesRaw(RHI::ResourceHandle vertexArray, u32 indexCount, u32 patchVertices)
+    {
+        Record(NullCommand::DrawIndexedPatchesRaw, { HandleWord(vertexArray), indexCount, patchVertices });
+    }
+
+    void NullRendererAPI::SetLineWidth(f32 width)
+    {
+        Record(NullCommand::SetLineWidth, { Bits(width) });
+    }
+
+    void NullRendererAPI::EnableCulling()
+    {
+        Record(NullCommand::EnableCulling, {});
+    }
+
+    void NullRendererAPI::DisableCulling()
+    {
+        Record(NullCommand::DisableCulling, {});
+    }
+
+    void NullRendererAPI::FrontCull()
+    {
+        Record(NullCommand::FrontCull, {});
+    }
+
+    void NullRendererAPI::BackCull()
+    {
+        Record(NullCommand::BackCull, {});
+    }
+
+    void NullRendererAPI::SetCullFace(RHI::CullMode face)
+    {
+        Record(NullCommand::SetCullFace, { Enum(face) });
+    }
+
+    void NullRendererAPI::SetDepthMask(bool value)
+    {
+        Record(NullCommand::SetDepthMask, { value });
+    }
+
+    void NullRendererAPI::SetDepthTest(bool value)
+    {
+        Record(NullCommand::SetDepthTest, { value });
+    }
+
+    void NullRendererAPI::SetDepthFunc(RHI::CompareOp func)
+    {
+        Record(NullCommand::SetDepthFunc, { Enum(func) });
+    }
+
+    void NullRendererAPI::SetBlendState(bool value)
+    {
+        Record(NullCommand::SetBlendState, { value });
+    }
+
+    void NullRendererAPI::SetBlendFunc(RHI::BlendFactor sfactor, RHI::BlendFactor dfactor)
+    {
+        Record(NullCommand::SetBlendFunc, { Enum(sfactor), Enum(dfactor) });
+    }
+
+    void NullRendererAPI::SetBlendEquation(RHI::BlendOp mode)
+    {
+        Record(NullCommand::SetBlendEquation, { Enum(mode) });
+    }
+
+    void NullRendererAPI::EnableStencilTest()
+    {
+        m_StencilTestEnabled = true;
+        Record(NullCommand::EnableStencilTest, {});
+    }
+
+    void NullRendererAPI::DisableStencilTest()
+    {
+        m_StencilTestEnabled = false;
+        Record(NullCommand::DisableStencilTest, {});
+    }
+
+    bool NullRendererAPI::IsStencilTestEnabled() const
+    {
+        return m_StencilTestEnabled;
+    }
+
+    void NullRendererAPI::SetStencilFunc(RHI::CompareOp func, i32 ref, u32 mask)
+    {
+        Record(NullCommand::SetStencilFunc, { Enum(func), Signed(ref), mask });
+    }
+
+    void NullRendererAPI::SetStencilOp(RHI::StencilOp sfail, RHI::StencilOp dpfail, RHI::StencilOp dppass)
+    {
+        Record(NullCommand::SetStencilOp, { Enum(sfail), Enum(dpfail), Enum(dppass) });
+    }
+
+    void NullRendererAPI::SetStencilMask(u32 mask)
+    {
+        Record(NullCommand::SetStencilMask, { mask });
+    }
+
+    void NullRendererAPI::ClearStencil()
+    {
+        Record(NullCommand::ClearStencil, {});
+    }
+
+    void NullRendererAPI::SetPolygonMode(RHI::PolygonMode mode)
+    {
+        Record(NullCommand::SetPolygonMode, { Enum(mode) });
+    }
+
+    void NullRendererAPI::EnableScissorTest()
+    {
+        Record(NullCommand::EnableScissorTest, {});
+    }
+
+    void NullRendererAPI::DisableScissorTest()
+    {
+        Record(NullCommand::DisableScissorTest, {});
+    }
+
+    void NullRendererAPI::SetScissorBox(i32 x, i32 y, u32 width, u32 height)
+    {
+        Record(NullCommand::SetScissorBox, { Signed(x), Signed(y), width, height });
+    }
+
+    void NullRendererAPI::DrawElementsIndirect(const Ref<VertexArray>& vertexArray, RHI::ResourceHandle indirectBuffer)
+    {
+        Record(NullCommand::DrawElementsIndirect, { VertexArrayWord(vertexArray), HandleWord(indirectBuffer) });
+    }
+
+    void NullRendererAPI::DrawArraysIndirect(const Ref<VertexArray>& vertexArray, RHI::ResourceHandle indirectBuffer)
+    {
+        Record(NullCommand::DrawArraysIndirect, { VertexArrayWord(vertexArray), HandleWord(indirectBuffer) });
+    }
+
+    void NullRendererAPI::DrawBoundElementsIndirect(RHI::ResourceHandle indirectBuffer, RHI::PrimitiveTopology topology)
+    {
+        Record(NullCommand::DrawBoundElementsIndirect, { HandleWord(indirectBuffer), Enum(topology) });
+    }
+
+    void NullRendererAPI::MultiDrawElementsIndirectCountRaw(RHI::ResourceHandle vertexArray, RHI::ResourceHandle indirectBuffer,
+                                                            u32 indirectOffsetBytes,
+                                                            RHI::ResourceHandle parameterBuffer, u32 parameterOffsetBytes,
+                                                            u32 maxDrawCount, u32 strideBytes)
+    {
+        Record(NullCommand::MultiDrawElementsIndirectCountRaw,
+               { HandleWord(vertexArray), HandleWord(indirectBuffer), indirectOffsetBytes, HandleWord(parameterBuffer),
+                 parameterOffsetBytes, maxDrawCount, strideBytes });
+    }
+
+    void NullRendererAPI::DispatchCompute(u32 groupsX, u32 groupsY, u32 groupsZ)
+    {
+        Record(NullCommand::DispatchCompute, { groupsX, groupsY, groupsZ });
+    }
+
+    void NullRendererAPI::DispatchComputeIndirect(RHI::ResourceHandle argsBuffer, u32 offsetBytes)
+    {
+        Record(NullCommand::DispatchComputeIndirect, { HandleWord(argsBuffer), offsetBytes });
+    }
+
+    void NullRendererAPI::DrawMeshTasks(u32 groupsX, u32 groupsY, u32 groupsZ)
+    {
+        Record(NullCommand::DrawMeshTasks, { groupsX, groupsY, groupsZ });
+    }
+
+    void NullRendererAPI::MemoryBarrier(MemoryBarrierFlags flags)
+    {
+        Record(NullCommand::MemoryBarrier, { Enum(flags) });
+    }
+
+    void NullRendererAPI::IssueBarrierBatch(MemoryBarrierFlags flags, std::span<const RHI::Barrier> barriers)
+    {
+        // The batch folds to one word so the command stays fixed-size; the
+        // resource and both access states of every barrier are in it.
+        u64 batch = kHashSeed;
+        for (const RHI::Barrier& barrier : barriers)
+        {
+            batch = Fold(batch, HandleWord(barrier.Resource));
+            batch = Fold(batch, Enum(barrier.Before) << 32 | Enum(barrier.After));
+        }
+        Record(NullCommand::IssueBarrierBatch, { Enum(flags), barriers.size(), batch });
+    }
+
+    void NullRendererAPI::BindDefaultFramebuffer()
+    {
+        Record(NullCommand::BindDefaultFramebuffer, {});
+    }
+
+    void NullRendererAPI::BlitFramebufferToDefault(RHI::ResourceHandle srcFramebuffer, u32 width, u32 height)
+    {
+        Record(NullCommand::BlitFramebufferToDefault, { HandleWord(srcFramebuffer), width, height });
+    }
+
+    void NullRendererAPI::BindTexture(u32 slot, RHI::ResourceHandle texture)
+    {
+        Record(NullCommand::BindTexture, { slot, HandleWord(texture) });
+    }
+
+    void NullRendererAPI::BindTexture(u32 slot, RHI::ResourceHandle texture, const RHI::SamplerDesc& /*sampler*/)
+    {
+        // No sampler objects to key the desc by; the trailing word only marks
+        // that the explicit-sampler overload was the one called.
+        Record(NullCommand::BindTexture, { slot, HandleWord(texture), 1 });
+    }
+
+    void NullRendererAPI::BindImageTexture(u32 unit, RHI::ResourceHandle texture, u32 mipLevel, bool layered,
+                                           u32 layer, RHI::Access access, RHI::Format format)
+    {
+        Record(NullCommand::BindImageTexture,
+               { unit, HandleWord(texture), mipLevel, layered, layer, Enum(access), Enum(format) });
+    }
+
+    void NullRendererAPI::SetPolygonOffset(f32 factor, f32 units)
+    {
+        Record(NullCommand::SetPolygonOffset, { Bits(factor), Bits(units) });
+    }
+
+    void NullRendererAPI::EnableMultisampling()
+    {
+        Record(NullCommand::EnableMultisampling, {});
+    }
+
+    void NullRendererAPI::DisableMultisampling()
+    {
+        Record(NullCommand::DisableMultisampling, {});
+    }
+
+    void NullRendererAPI::SetColorMask(bool red, bool green, bool blue, bool alpha)
+    {
+        Record(NullCommand::SetColorMask, { red, green, blue, alpha });
+    }
+
+    void NullRendererAPI::SetColorMaskForAttachment(u32 attachment, bool red, bool green, bool blue, bool alpha)
+    {
+        Record(NullCommand::SetColorMaskForAttachment, { attachment, red, green, blue, alpha });
+    }
+
+    void NullRendererAPI::SetBlendStateForAttachment(u32 attachment, bool enabled)
+    {
+        Record(NullCommand::SetBlendStateForAttachment, { attachment, enabled });
+    }
+
+    void NullRendererAPI::SetBlendFuncForAttachment(u32 attachment, RHI::BlendFactor src, RHI::BlendFactor dst)
+    {
+        Record(NullCommand::SetBlendFuncForAttachment, { attachment, Enum(src), Enum(dst) });
+    }
+
+    void NullRendererAPI::CopyImageSubData(RHI::ResourceHandle src, TextureTargetType srcTarget,
+                                           RHI::ResourceHandle dst, TextureTargetType dstTarget,
+                                           u32 width, u32 height)
+    {
+        Record(NullCommand::CopyImageSubData,
+               { HandleWord(src), Enum(srcTarget), HandleWord(dst), Enum(dstTarget), width, height });
+    }
+
+    void NullRendererAPI::CopyImageSubDataFull(RHI::ResourceHandle src, TextureTargetType srcTarget, i32 srcLevel, i32 srcZ,
+                                               RHI::ResourceHandle dst, TextureTargetType dstTarget, i32 dstLevel, i32 dstZ,
+                                               u32 width, u32 height)
+    {
+        Record(NullCommand::CopyImageSubDataFull,
+               { HandleWord(src), Enum(srcTarget), Signed(srcLevel), Signed(srcZ), HandleWord(dst), Enum(dstTarget),
+                 Signed(dstLevel), Signed(dstZ), width, height });
+    }
+
+    void NullRendererAPI::CopyImageSubDataRegion(RHI::ResourceHandle src, TextureTargetType srcTarget, i32 srcLevel,
+                                                 i32 srcX, i32 srcY, i32 srcZ,
+                                                 RHI::ResourceHandle dst, TextureTargetType dstTarget, i32 dstLevel,
+                                                 i32 dstX, i32 dstY, i32 dstZ,
+                                                 u32 width, u32 height)
+    {
+        Record(NullCommand::CopyImageSubDataRegion,
+               { HandleWord(src), Enum(srcTarget), Signed(srcLevel), Signed(srcX), Signed(srcY), Signed(srcZ),
+                 HandleWord(dst), Enum(dstTarget), Signed(dstLevel), Signed(dstX), Signed(dstY), Signed(dstZ), width,
+                 height });
+    }
+
+    void NullRendererAPI::CopyFramebufferToTexture(RHI::ResourceHandle texture, u32 width, u32 height)
+    {
+        Record(NullCommand::CopyFramebufferToTexture, { HandleWord(texture), width, height });
+    }
+
+    void NullRendererAPI::SetDrawBuffers(std::span<const u32> attachments)
+    {
+        u64 mask = 0;
+        for (const u32 attachment : attachments)
+            mask = mask << 5 | (attachment & 31u);
+        Record(NullCommand::SetDrawBuffers, { attachments.size(), mask });
+    }
+
+    void NullRendererAPI::RestoreAllDrawBuffers(u32 colorAttachmentCount)
+    {
+        Record(NullCommand::RestoreAllDrawBuffers, { colorAttachmentCount });
+    }
+
+    RHI::ResourceHandle NullRendererAPI::CreateDepthArrayCompareOffViewHandle(RHI::ResourceHandle srcTexture, u32 numLayers)
+    {
+        const NullObject* source = Find(srcTexture);
+        const RHI::ResourceHandle view = source ? Mint(RHI::ResourceKind::Texture, source->Width, source->Height, source->Format)
+                                                : Mint(RHI::ResourceKind::Texture);
+        Record(NullCommand::CreateDepthArrayCompareOffViewHandle, { HandleWord(srcTexture), numLayers, HandleWord(view) });
+        return view;
+    }
+
+    void NullRendererAPI::SetTextureFilter(RHI::ResourceHandle texture, RHI::Filter minFilter, RHI::Filter magFilter)
+    {
+        Record(NullCommand::SetTextureFilter, { HandleWord(texture), Enum(minFilter), Enum(magFilter) });
+    }
+
+    void NullRendererAPI::SetTextureWrap(RHI::ResourceHandle texture, RHI::AddressMode wrap)
+    {
+        Record(NullCommand::SetTextureWrap, { HandleWord(texture), Enum(wrap) });
+    }
+
+    void NullRendererAPI::UploadTextureSubImage2D(RHI::ResourceHandle texture, u32 width, u32 height,
+                                                  RHI::Format sourceFormat, const void* /*data*/)
+    {
+        Record(NullCommand::UploadTextureSubImage2D, { HandleWord(texture), width, height, Enum(sourceFormat) });
+    }
+
+    void NullRendererAPI::BeginConditionalRender(RHI::ResourceHandle query)
+    {
+        Record(NullCommand::BeginConditionalRender, { HandleWord(query) });
+    }
+
+    void NullRendererAPI::EndConditionalRender()
+    {
+        Record(NullCommand::EndConditionalRender, {});
+    }
+
+    void NullRendererAPI::BindUniformBuffer(u32 bindingPoint, RHI::ResourceHandle buffer)
+    {
+        Record(NullCommand::BindUniformBuffer, { bindingPoint, HandleWord(buffer) });
+    }
+
+    void NullRendererAPI::BindStorageBuffer(u32 bindingPoint, RHI::ResourceHandle buffer)
+    {
+        Record(NullCommand::BindStorageBuffer, { bindingPoint, HandleWord(buffer) });
+    }
+
+    void NullRendererAPI::BindShaderProgram(RHI::ResourceHandle program)
+    {
+        Record(NullCommand::BindShaderProgram, { HandleWord(program) });
+    }
+
+    void NullRendererAPI::BindVertexArrayRaw(RHI::ResourceHandle vertexArray)
+    {
+        Record(NullCommand::BindVertexArrayRaw, { HandleWord(vertexArray) });
+    }
+
+    void NullRendererAPI::BindFramebuffer(RHI::ResourceHandle framebuffer)
+    {
+        Record(NullCommand::BindFramebuffer, { HandleWord(framebuffer) });
+    }
+
+    void NullRendererAPI::DrawBoundIndexed(RHI::PrimitiveTopology topology, u32 indexCount,
+                                           RHI::IndexType indexType, u32 baseIndex)
+    {
+        Record(NullCommand::DrawBoundIndexed, { Enum(topology), indexCount, Enum(indexType), baseIndex });
+    }
+
+    void NullRendererAPI::DrawBoundIndexedInstanced(RHI::PrimitiveTopology topology, u32 indexCount,
+                                                    RHI::IndexType indexType, u32 baseIndex,
+                                                    u32 instanceCount)
+    {
+        Record(NullCommand::DrawBoundIndexedInstanced,
+               { Enum(topology), indexCount, Enum(indexType), baseIndex, instanceCount });
+    }
+
+    void NullRendererAPI::DrawBoundArrays(RHI::PrimitiveTopology topology, u32 firstVertex, u32 vertexCount)
+    {
+        Record(NullCommand::DrawBoundArrays, { Enum(topology), firstVertex, vertexCount });
+    }
+
+    void NullRendererAPI::SetPatchVertexCount(u32 patchVertices)
+    {
+        Record(NullCommand::SetPatchVertexCount, { patchVertices });
+    }
+
+    void NullRendererAPI::SetFrontFace(RHI::FrontFace face)
+    {
+        Record(NullCommand::SetFrontFace, { Enum(face) });
+    }
+
+    void NullRendererAPI::SetBlendFuncSeparate(RHI::BlendFactor srcRGB, RHI::BlendFactor dstRGB,
+                                               RHI::BlendFactor srcAlpha, RHI::BlendFactor dstAlpha)
+    {
+        Record(NullCommand::SetBlendFuncSeparate, { Enum(srcRGB), Enum(dstRGB), Enum(srcAlpha), Enum(dstAlpha) });
+    }
+
+    void NullRendererAPI::SetClearDepth(f32 depth)
+    {
+        Record(NullCommand::SetClearDepth, { Bits(depth) });
+    }
+
+    void NullRendererAPI::AttachFramebufferColorTexture(RHI::ResourceHandle framebuffer, u32 attachmentIndex,
+                                                        RHI::ResourceHandle texture, u32 mipLevel)
+    {
+        Record(NullCommand::AttachFramebufferColorTexture,
+               { HandleWord(framebuffer), attachmentIndex, HandleWord(texture), mipLevel });
+    }
+
+    void NullRendererAPI::AttachFramebufferDepthTexture(RHI::ResourceHandle framebuffer, RHI::ResourceHandle texture,
+                                                        u32 mipLevel)
+    {
+        Record(NullCommand::AttachFramebufferDepthTexture, { HandleWord(framebuffer), HandleWord(texture), mipLevel });
+    }
+
+    bool NullRendererAPI::IsFramebufferComplete(RHI::ResourceHandle framebuffer)
+    {
+        Record(NullCommand::IsFramebufferComplete, { HandleWord(framebuffer) });
+        return true;
+    }
+
+    void NullRendererAPI::SetFramebufferDrawAttachments(RHI::ResourceHandle framebuffer,
+                                                        std::span<const u32> attachmentIndices)
+    {
+        u64 mask = 0;
+        for (const u32 attachment : attachmentIndices)
+            mask = mask << 5 | (attachment & 31u);
+        Record(NullCommand::SetFramebufferDrawAttachments, { HandleWord(framebuffer), attachmentIndices.size(), mask });
+    }
+
+    void NullRendererAPI::RestoreAllFramebufferDrawAttachments(RHI::ResourceHandle framebuffer, u32 colorAttachmentCount)
+    {
+        Record(NullCommand::RestoreAllFramebufferDrawAttachments, { HandleWord(framebuffer), colorAttachmentCount });
+    }
+
+    void NullRendererAPI::SetFramebufferReadAttachment(RHI::ResourceHandle framebuffer, u32 attachmentIndex)
+    {
+        Record(NullCommand::SetFramebufferReadAttachment, { HandleWord(framebuffer), attachmentIndex });
+    }
+
+    void NullRendererAPI::ClearFramebufferColorAttachment(RHI::ResourceHandle framebuffer, u32 attachmentIndex,
+                                                          const glm::vec4& color)
+    {
+        Record(NullCommand::ClearFramebufferColorAttachment, { HandleWord(framebuffer), attachmentIndex, Color(color) });
+    }
+
+    void NullRendererAPI::ClearFramebufferDepth(RHI::ResourceHandle framebuffer, f32 depth)
+    {
+        Record(NullCommand::ClearFramebufferDepth, { HandleWord(framebuffer), Bits(depth) });
+    }
+
+    void NullRendererAPI::BlitFramebuffer(RHI::ResourceHandle srcFramebuffer, RHI::ResourceHandle dstFramebuffer,
+                                          i32 srcX0, i32 srcY0, i32 srcX1, i32 srcY1,
+                                          i32 dstX0, i32 dstY0, i32 dstX1, i32 dstY1,
+                                          RHI::BlitAspect aspect, RHI::Filter filter)
+    {
+        Record(NullCommand::BlitFramebuffer,
+               { HandleWord(srcFramebuffer), HandleWord(dstFramebuffer), Signed(srcX0), Signed(srcY0), Signed(srcX1),
+                 Signed(srcY1), Signed(dstX0), Signed(dstY0), Signed(dstX1), Signed(dstY1), Enum(aspect), Enum(filter) });
+    }
+
+    void NullRendererAPI::AllocateBufferStorage(RHI::ResourceHandle buffer, u64 sizeBytes, RHI::MemoryResidency residency)
+    {
+        Record(NullCommand::AllocateBufferStorage, { HandleWord(buffer), sizeBytes, Enum(residency) });
+    }
+
+    void* NullRendererAPI::AllocatePersistentUploadStorage(RHI::ResourceHandle buffer, u64 sizeBytes)
+    {
+        Record(NullCommand::AllocatePersistentUploadStorage, { HandleWord(buffer), sizeBytes });
+
+        // Callers write through the returned pointer every frame, so it has to
+        // be real memory even though nothing ever reads it back.
+        NullObject* object = Find(buffer);
+        if (!object)
+            return nullptr;
+        object->Mapped.assign(static_cast<sizet>(sizeBytes), 0);
+        return object->Mapped.data();
+    }
+
+    void NullRendererAPI::UnmapBuffer(RHI::ResourceHandle buffer)
+    {
+        if (NullObject* object = Find(buffer))
+            object->Mapped = {};
+        Record(NullCommand::UnmapBuffer, { HandleWord(buffer) });
+    }
+
+    void NullRendererAPI::UploadBufferSubData(RHI::ResourceHandle buffer, u64 offsetBytes, u64 sizeBytes, const void* /*data*/)
+    {
+        Record(NullCommand::UploadBufferSubData, { HandleWord(buffer), offsetBytes, sizeBytes });
+    }
+
+    void NullRendererAPI::ReadBufferSubData(RHI::ResourceHandle buffer, u64 offsetBytes, u64 sizeBytes, void* dest)
+    {
+        Record(NullCommand::ReadBufferSubData, { HandleWord(buffer), offsetBytes, sizeBytes });
+        if (dest)
+            std::memset(dest, 0, static_cast<sizet>(sizeBytes));
+    }
+
+    void NullRendererAPI::CopyBufferSubData(RHI::ResourceHandle srcBuffer, RHI::ResourceHandle dstBuffer,
+                                            u64 srcOffsetBytes, u64 dstOffsetBytes, u64 sizeBytes)
+    {
+        Record(NullCommand::CopyBufferSubData,
+               { HandleWord(srcBuffer), HandleWord(dstBuffer), srcOffsetBytes, dstOffsetBytes, sizeBytes });
+    }
+
+    void NullRendererAPI::ClearBufferUInt(RHI::ResourceHandle buffer, u32 value)
+    {
+        Record(NullCommand::ClearBufferUInt, { HandleWord(buffer), value });
+    }
+
+    void NullRendererAPI::ClearBufferFloat(RHI::ResourceHandle buffer, f32 value)
+    {
+        Record(NullCommand::ClearBufferFloat, { HandleWord(buffer), Bits(value) });
+    }
+
+    RHI::ResourceHandle NullRendererAPI::CreateMatchingTextureHandle(RHI::ResourceHandle source)
+    {
+        const NullObject* original = Find(source);
+        const RHI::ResourceHandle texture = original ? Mint(RHI::ResourceKind::Texture, original->Width, original->Height, original->Format)
+                                                     : Mint(RHI::ResourceKind::Texture);
+        Record(NullCommand::CreateMatchingTextureHandle, { HandleWord(source), HandleWord(texture) });
+        return texture;
+    }
+
+    RHI::ResourceHandle NullRendererAPI::CreateTexture2DHandle(u32 width, u32 height, RHI::Format internalFormat)
+    {
+        const RHI::ResourceHandle texture = Mint(RHI::ResourceKind::Texture, width, height, internalFormat);
+        Record(NullCommand::CreateTexture2DHandle, { width, height, Enum(internalFormat), HandleWord(texture) });
+        return texture;
+    }
+
+    RHI::ResourceHandle NullRendererAPI::CreateTextureCubemapHandle(u32 width, u32 height, RHI::Format internalFormat)
+    {
+        const RHI::ResourceHandle texture = Mint(RHI::ResourceKind::Texture, width, height, internalFormat);
+        Record(NullCommand::CreateTextureCubemapHandle, { width, height, Enum(internalFormat), HandleWord(texture) });
+        return texture;
+    }
+
+    RHI::ResourceHandle NullRendererAPI::CreateFramebufferHandle()
+    {
+        const RHI::ResourceHandle framebuffer = Mint(RHI::ResourceKind::Framebuffer);
+        Record(NullCommand::CreateFramebufferHandle, { HandleWord(framebuffer) });
+        return framebuffer;
+    }
+
+    RHI::ResourceHandle NullRendererAPI::CreateBufferHandle()
+    {
+        const RHI::ResourceHandle buffer = Mint(RHI::ResourceKind::Buffer);
+        Record(NullCommand::CreateBufferHandle, { HandleWord(buffer) });
+        return buffer;
+    }
+
+    RHI::ResourceHandle NullRendererAPI::CreateVertexArrayHandle()
+    {
+        const RHI::ResourceHandle vertexArray = Mint(RHI::ResourceKind::VertexArray);
+        Record(NullCommand::CreateVertexArrayHandle, { HandleWord(vertexArray) });
+        return vertexArray;
+    }
+
+    void NullRendererAPI::DeleteTexture(RHI::ResourceHandle texture)
+    {
+        Record(NullCommand::DeleteTexture, { HandleWord(texture) });
+        Retire(texture);
+    }
+
+    void NullRendererAPI::DeleteFramebuffer(RHI::ResourceHandle framebuffer)
+    {
+        Record(NullCommand::DeleteFramebuffer, { HandleWord(framebuffer) });
+        Retire(framebuffer);
+    }
+
+    void NullRendererAPI::DeleteBuffer(RHI::ResourceHandle buffer)
+    {
+        Record(NullCommand::DeleteBuffer, { HandleWord(buffer) });
+        Retire(buffer);
+    }
+
+    void NullRendererAPI::DeleteVertexArray(RHI::ResourceHandle vertexArray)
+    {
+        Record(NullCommand::DeleteVertexArray, { HandleWord(vertexArray) });
+        Retire(vertexArray);
+    }
+
+    void NullRendererAPI::SetVertexArrayIndexBuffer(RHI::ResourceHandle vertexArray, RHI::ResourceHandle indexBuffer)
+    {
+        Record(NullCommand::SetVertexArrayIndexBuffer, { HandleWord(vertexArray), HandleWord(indexBuffer) });
+    }
+
+    void NullRendererAPI::ClearTextureFloat(RHI::ResourceHandle texture, u32 mipLevel, const glm::vec4& color)
+    {
+        Record(NullCommand::ClearTextureFloat, { HandleWord(texture), mipLevel, Color(color) });
+    }
+
+    void NullRendererAPI::ClearTextureUInt(RHI::ResourceHandle texture, u32 mipLevel, u32 value)
+    {
+        Record(NullCommand::ClearTextureUInt, { HandleWord(texture), mipLevel, value });
+    }
+
+    void NullRendererAPI::UploadTextureSubImage2D(RHI::ResourceHandle texture, i32 xOffset, i32 yOffset,
+                                                  u32 width, u32 height,
+                                                  RHI::Format sourceFormat, const void* /*data*/)
+    {
+        Record(NullCommand::UploadTextureSubImage2D,
+               { HandleWord(texture), Signed(xOffset), Signed(yOffset), width, height, Enum(sourceFormat) });
+    }
+
+    void NullRendererAPI::UploadTextureSubImage3D(RHI::ResourceHandle texture, i32 xOffset, i32 yOffset, i32 zOffset,
+                                                  u32 width, u32 height, u32 depth,
+                                                  RHI::Format sourceFormat, const void* /*data*/)
+    {
+        Record(NullCommand::UploadTextureSubImage3D,
+               { HandleWord(texture), Signed(xOffset), Signed(yOffset), Signed(zOffset), width, height, depth,
+                 Enum(sourceFormat) });
+    }
+
+    bool NullRendererAPI::ReadTextureImage(RHI::ResourceHandle texture, u32 mipLevel, RHI::Format destFormat,
+                                           sizet destSizeBytes, void* dest)
+    {
+        Record(NullCommand::ReadTextureImage, { HandleWord(texture), mipLevel, Enum(destFormat), destSizeBytes });
+        if (dest)
+            std::memset(dest, 0, destSizeBytes);
+        return dest != nullptr;
+    }
+
+    bool NullRendererAPI::ReadTextureSubImage(RHI::ResourceHandle texture, u32 mipLevel,
+                                              i32 x, i32 y, i32 z,
+                                              u32 width, u32 height, u32 depth,
+                                              RHI::Format destFormat,
+                                              sizet destSizeBytes, void* dest)
+    {
+        Record(NullCommand::ReadTextureSubImage,
+               { HandleWord(texture), mipLevel, Signed(x), Signed(y), Signed(z), width, height, depth, Enum(destFormat),
+                 destSizeBytes });
+        if (dest)
+            std::memset(dest, 0, destSizeBytes);
+        return dest != nullptr;
+    }
+
+    void NullRendererAPI::GetTextureDimensions(RHI::ResourceHandle texture, u32 mipLevel, u32& outWidth, u32& outHeight)
+    {
+        const NullObject* object = Find(texture);
+        outWidth = object ? std::max(1u, object->Width >> mipLevel) : 0;
+        outHeight = object ? std::max(1u, object->Height >> mipLevel) : 0;
+    }
+
+    bool NullRendererAPI::QueryTextureFormat(RHI::ResourceHandle texture, u32 /*mipLevel*/, RHI::TextureFormatInfo& out)
+    {
+        const NullObject* object = Find(texture);
+        if (!object || object->Kind != RHI::ResourceKind::Texture)
+            return false;
+
+        out = {};
+        out.Neutral = object->Format;
+        out.IsDepth = RHI::IsDepthStencil(object->Format);
+        out.Shape = RHI::TextureShape::Texture2D;
+        return true;
+    }
+
+    void NullRendererAPI::TextureBarrier()
+    {
+        Record(NullCommand::TextureBarrier, {});
+    }
+
+    void NullRendererAPI::CreateQueries(RHI::QueryType type, std::span<RHI::ResourceHandle> outQueries)
+    {
+        for (RHI::ResourceHandle& query : outQueries)
+            query = Mint(RHI::ResourceKind::Query);
+        Record(NullCommand::CreateQueries, { Enum(type), outQueries.size() });
+    }
+
+    void NullRendererAPI::DeleteQueries(std::span<const RHI::ResourceHandle> queries)
+    {
+        Record(NullCommand::DeleteQueries, { queries.size() });
+        for (const RHI::ResourceHandle query : queries)
+            Retire(query);
+    }
+
+    void NullRendererAPI::BeginQuery(RHI::QueryType type, RHI::ResourceHandle query)
+    {
+        Record(NullCommand::BeginQuery, { Enum(type), HandleWord(query) });
+    }
+
+    void NullRendererAPI::EndQuery(RHI::QueryType type)
+    {
+        Record(NullCommand::EndQuery, { Enum(type) });
+    }
+
+    void NullRendererAPI::WriteTimestamp(RHI::ResourceHandle query)
+    {
+        Record(NullCommand::WriteTimestamp, { HandleWord(query) });
+    }
+
+    bool NullRendererAPI::IsQueryResultAvailable(RHI::ResourceHandle /*query*/)
+    {
+        return true;
+    }
+
+    u32 NullRendererAPI::GetQueryResultU32(RHI::ResourceHandle /*query*/)
+    {
+        return 0;
+    }
+
+    u64 NullRendererAPI::GetQueryResultU64(RHI::ResourceHandle /*query*/)
+    {
+        return 0;
+    }
+
+    u64 NullRendererAPI::CreateFence()
+    {
+        const u64 fence = m_NextFence++;
+        Record(NullCommand::CreateFence, { fence });
+        return fence;
+    }
+
+    RHI::FenceStatus NullRendererAPI::ClientWaitFence(u64 /*fence*/, u64 /*timeoutNanoseconds*/)
+    {
+        return RHI::FenceStatus::AlreadySignaled;
+    }
+
+    bool NullRendererAPI::IsFenceSignaled(u64 /*fence*/)
+    {
+        return true;
+    }
+
+    void NullRendererAPI::DestroyFence(u64 fence)
+    {
+        Record(NullCommand::DestroyFence, { fence });
+    }
+
+    void NullRendererAPI::PushDebugGroup(u32 id, std::string_view label)
+    {
+        Record(NullCommand::PushDebugGroup, { id, Text(label) });
+    }
+
+    void NullRendererAPI::PopDebugGroup()
+    {
+        Record(NullCommand::PopDebugGroup, {});
+    }
+
+    void NullRendererAPI::WaitForDeviceIdle()
+    {
+        Record(NullCommand::WaitForDeviceIdle, {});
+    }
+
+    u32 NullRendererAPI::GetMaxFramebufferSamples() const
+    {
+        return 8;
+    }
+
+    u32 NullRendererAPI::GetMaxColorTextureSamples() const
+    {
+        return 8;
+    }
+
+    u32 NullRendererAPI::GetMaxDepthTextureSamples() const
+    {
+        return 8;
+    }
+
+    void NullRendererAPI::SetProgramUniformFloat(RHI::ResourceHandle program, std::string_view name, f32 value)
+    {
+        Record(NullCommand::SetProgramUniformFloat, { HandleWord(program), Text(name), Bits(value) });
+    }
+
+    bool NullRendererAPI::IsDeviceAvailable() const
+    {
+        return false;
+    }
+
+    u32 NullRendererAPI::GetMaxUniformBlockSize() const
+    {
+        // The GL 4.6 guaranteed minimum, so layout code sizes blocks the way it
+        // would on the weakest real device.
+        return 16384;
+    }
+
+    bool NullRendererAPI::SupportsInt64ShaderAtomics() const
+    {
+        return false;
+    }
+
+    bool NullRendererAPI::SupportsMeshShaders() const
+    {
+        return false;
+    }
+} // namespace OloEngine
@@ -0,0 +1,560 @@
+#pragma once
+
+// =============================================================================
+// NullRendererAPI — a recording RendererAPI with no device behind it.
+//
+// Exists so the CPU half of rendering — CommandBucket sort/batch/execute,
+// CommandDispatch, render-graph planning, submission — can be profiled and
+// regression-benchmarked on machines with no GPU (CI, build agents). Selected
+// with `RendererAPI::SetAPI(RendererAPI::API::Null)` followed by
+// `RenderCommand::RecreateForSelectedBackend()`, or constructed directly and
+// handed to `CommandBucket::Execute` like MockRendererAPI in the tests.
+//
+// What it does with a call:
+//   * Every facade call appends one NullCommand (opcode + argument words) to a
+//     compact stream, bumps a per-opcode counter and folds the words into a
+//     running 64-bit hash. The hash is the regression signal: the same frame
+//     must produce the same stream, bit for bit.
+//   * Create* mints real RHI::ResourceHandles through RHI::ResourceRegistry,
+//     owned by RHI::Backend::Null, whose "native" value is a per-instance
+//     ordinal. Handles therefore hash by ordinal rather than by registry slot,
+//     which is what keeps the hash stable across test orderings.
+//   * Fences and queries are always complete; readbacks zero-fill and
+//     succeed; persistent-mapped buffers are backed by host memory so callers
+//     that write through the mapping stay well-defined.
+//
+// The resource factories (Texture2D::Create, Shader::Create,
+// Framebuffer::Create, ...) have Null arms returning the objects in
+// NullBufferResources.h, NullTexture.h, NullShader.h and NullFramebuffer.h.
+// They keep their descriptors, own a Backend::Null handle whose native value
+// is an object ordinal (MintObjectOrdinal) and bind through RenderCommand,
+// so `Renderer::Init` and a whole Scene frame run on this backend.
+//
+// IsDeviceAvailable() reports false: code that gates uploads and GPU timing
+// on a device stays off, which is the honest answer.
+//
+// Threading: like the other backends, render thread only. Stage timing is a
+// convenience for the same thread.
+// =============================================================================
+
+#include "OloEngine/Renderer/RendererAPI.h"
+
+#include <array>
+#include <chrono>
+#include <initializer_list>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace OloEngine
+{
+    // One opcode per RendererAPI virtual. Overloads share an opcode and are
+    // told apart by their argument count. Append only — the hash of a recorded
+    // stream includes these values.
+    enum class NullCommand : u8
+    {
+        SetViewport = 0,
+        SetClearColor,
+        Clear,
+        ClearDepthOnly,
+        ClearColorAndDepth,
+        DrawArrays,
+        DrawIndexed,
+        DrawIndexedInstanced,
+        DrawLines,
+        DrawIndexedPatches,
+        DrawIndexedRaw,
+        DrawIndexedInstancedRaw,
+        DrawIndexedPatchesRaw,
+        SetLineWidth,
+        EnableCulling,
+        DisableCulling,
+        FrontCull,
+        BackCull,
+        SetCullFace,
+        SetDepthMask,
+        SetDepthTest,
+        SetDepthFunc,
+        SetBlendState,
+        SetBlendFunc,
+        SetBlendEquation,
+        EnableStencilTest,
+        DisableStencilTest,
+        SetStencilFunc,
+        SetStencilOp,
+        SetStencilMask,
+        ClearStencil,
+        SetPolygonMode,
+        EnableScissorTest,
+        DisableScissorTest,
+        SetScissorBox,
+        DrawElementsIndirect,
+        DrawArraysIndirect,
+        DrawBoundElementsIndirect,
+        MultiDrawElementsIndirectCountRaw,
+        DispatchCompute,
+        DispatchComputeIndirect,
+        DrawMeshTasks,
+        MemoryBarrier,
+        IssueBarrierBatch,
+        BindDefaultFramebuffer,
+        BlitFramebufferToDefault,
+        BindTexture,
+        BindImageTexture,
+        SetPolygonOffset,
+        EnableMultisampling,
+        DisableMultisampling,
+        SetColorMask,
+        SetColorMaskForAttachment,
+        SetBlendStateForAttachment,
+        SetBlendFuncForAttachment,
+        CopyImageSubData,
+        CopyImageSubDataFull,
+        CopyImageSubDataRegion,
+        CopyFramebufferToTexture,
+        SetDrawBuffers,
+        RestoreAllDrawBuffers,
+        CreateDepthArrayCompareOffViewHandle,
+        SetTextureFilter,
+        SetTextureWrap,
+        UploadTextureSubImage2D,
+        BeginConditionalRender,
+        EndConditionalRender,
+        BindUniformBuffer,
+        BindStorageBuffer,
+        BindShaderProgram,
+        BindVertexArrayRaw,
+        BindFramebuffer,
+        DrawBoundIndexed,
+        DrawBoundIndexedInstanced,
+        DrawBoundArrays,
+        SetPatchVertexCount,
+        SetFrontFace,
+        SetBlendFuncSeparate,
+        SetClearDepth,
+        AttachFramebufferColorTexture,
+        AttachFramebufferDepthTexture,
+        IsFramebufferComplete,
+        SetFramebufferDrawAttachments,
+        RestoreAllFramebufferDrawAttachments,
+        SetFramebufferReadAttachment,
+        ClearFramebufferColorAttachment,
+        ClearFramebufferDepth,
+        BlitFramebuffer,
+        AllocateBufferStorage,
+        AllocatePersistentUploadStorage,
+        UnmapBuffer,
+        UploadBufferSubData,
+        ReadBufferSubData,
+        CopyBufferSubData,
+        ClearBufferUInt,
+        ClearBufferFloat,
+        CreateMatchingTextureHandle,
+        CreateTexture2DHandle,
+        CreateTextureCubemapHandle,
+        CreateFramebufferHandle,
+        CreateBufferHandle,
+        CreateVertexArrayHandle,
+        DeleteTexture,
+        DeleteFramebuffer,
+        DeleteBuffer,
+        DeleteVertexArray,
+        SetVertexArrayIndexBuffer,
+        ClearTextureFloat,
+        ClearTextureUInt,
+        UploadTextureSubImage3D,
+        ReadTextureImage,
+        ReadTextureSubImage,
+        TextureBarrier,
+        CreateQueries,
+        DeleteQueries,
+        BeginQuery,
+        EndQuery,
+        WriteTimestamp,
+        CreateFence,
+        DestroyFence,
+        PushDebugGroup,
+        PopDebugGroup,
+        WaitForDeviceIdle,
+        SetProgramUniformFloat,
+        COUNT
+    };
+
+    [[nodiscard]] auto ToString(NullCommand command) -> std::string_view;
+
+    class NullRendererAPI final : public RendererAPI
+    {
+      public:
+        // One recorded call. Its argument words are
+        // `GetArguments()[FirstArgument, FirstArgument + ArgumentCount)`.
+        struct RecordedCommand
+        {
+            NullCommand Op = NullCommand::COUNT;
+            u8 ArgumentCount = 0;
+            u32 FirstArgument = 0;
+        };
+
+        // Wall time and stream slice of one named CPU stage (see ScopedStage).
+        struct StageRecord
+        {
+            std::string Name;
+            f64 Milliseconds = 0.0;
+            u64 CommandCount = 0; ///< commands recorded while the stage was open
+            u64 StreamHash = 0;   ///< hash of those commands alone
+        };
+
+        // Times a CPU stage and attributes the commands it records to it.
+        // Stages nest; a nested stage's commands count towards its parent too.
+        class ScopedStage
+        {
+          public:
+            ScopedStage(NullRendererAPI& api, std::string_view name);
+            ~ScopedStage();
+            ScopedStage(const ScopedStage&) = delete;
+            ScopedStage& operator=(const ScopedStage&) = delete;
+
+          private:
+            NullRendererAPI& m_API;
+            sizet m_Index;
+        };
+
+        NullRendererAPI();
+        ~NullRendererAPI() override;
+
+        // ---------------------------------------------------------------------
+        // Recording surface.
+        // ---------------------------------------------------------------------
+
+        // Hash of every command recorded since the last ResetRecording().
+        [[nodiscard]] auto GetStreamHash() const -> u64
+        {
+            return m_StreamHash;
+        }
+        [[nodiscard]] auto GetCommandCount() const -> u64
+        {
+            return m_CommandCount;
+        }
+        [[nodiscard]] auto GetCallCount(NullCommand command) const -> u64
+        {
+            return m_CallCounts[static_cast<sizet>(command)];
+        }
+        // Draw, indirect-draw and mesh-task calls — what a frame "submitted".
+        [[nodiscard]] auto GetDrawCallCount() const -> u64;
+        [[nodiscard]] auto GetDispatchCount() const -> u64;
+
+        // The stream itself is kept only while capture is on (the default).
+        // Counters and the hash are always maintained, so a benchmark can turn
+        // capture off to measure the caller rather than the recorder.
+        void SetCaptureEnabled(bool enabled)
+        {
+            m_CaptureEnabled = enabled;
+        }
+        [[nodiscard]] auto IsCaptureEnabled() const -> bool
+        {
+            return m_CaptureEnabled;
+        }
+        [[nodiscard]] auto GetCommands() const -> const std::vector<RecordedCommand>&
+        {
+            return m_Commands;
+        }
+        [[nodiscard]] auto GetArguments() const -> const std::vector<u64>&
+        {
+            return m_Arguments;
+        }
+        // "DrawBoundIndexed(0x3, 36, 1, 0)" — for printing the first divergent
+        // command when two streams' hashes differ.
+        [[nodiscard]] auto DescribeCommand(sizet index) const -> std::string;
+
+        [[nodiscard]] auto GetStages() const -> const std::vector<StageRecord>&
+        {
+            return m_Stages;
+        }
+
+        // Clears the stream, hash, counters and stages. Live resources, bound
+        // viewport and stencil state are device state and survive.
+        void ResetRecording();
+
+        [[nodiscard]] auto GetLiveResourceCount() const -> u32
+        {
+            return static_cast<u32>(m_Resources.size());
+        }
+
+        // Native value for a Null resource object's handle. Tagged with the
+        // top bit so it never meets one of Mint's ordinals, and restarted by
+        // each NullRendererAPI, so the hash of a recording does not depend on
+        // what else the process created first.
+        [[nodiscard]] static auto MintObjectOrdinal() -> u64;
+
+        // ---------------------------------------------------------------------
+        // RendererAPI.
+        // ---------------------------------------------------------------------
+        void Init() override;
+        void ShutdownGpuResources() override;
+
+        void SetViewport(u32 x, u32 y, u32 width, u32 height) override;
+        void SetClearColor(const glm::vec4& color) override;
+        void Clear() override;
+        void ClearDepthOnly() override;
+        void ClearColorAndDepth() override;
+        [[nodiscard]] Viewport GetViewport() const override;
+
+        void DrawArrays(const Ref<VertexArray>& vertexArray, u32 vertexCount) override;
+        void DrawIndexed(const Ref<VertexArray>& vertexArray, u32 indexCount) override;
+        void DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, u32 indexCount, u32 instanceCount) override;
+        void DrawLines(const Ref<VertexArray>& vertexArray, u32 vertexCount) override;
+        void DrawIndexedPatches(const Ref<VertexArray>& vertexArray, u32 indexCount, u32 patchVertices) override;
+
+        void DrawIndexedRaw(RHI::ResourceHandle vertexArray, u32 indexCount) override;
+        void DrawIndexedRaw(RHI::ResourceHandle vertexArray, u32 indexCount, u32 baseIndex) override;
+        void DrawIndexedInstancedRaw(RHI::ResourceHandle vertexArray, u32 indexCount, u32 baseIndex,
+                                     u32 instanceCount) override;
+        void DrawIndexedPatchesRaw(RHI::ResourceHandle vertexArray, u32 indexCount, u32 patchVertices) override;
+
+        void SetLineWidth(f32 width) override;
+
+        void EnableCulling() override;
+        void DisableCulling() override;
+        void FrontCull() override;
+        void BackCull() override;
+        void SetCullFace(RHI::CullMode face) override;
+        void SetDepthMask(bool value) override;
+        void SetDepthTest(bool value) override;
+        void SetDepthFunc(RHI::CompareOp func) override;
+        void SetBlendState(bool value) override;
+        void SetBlendFunc(RHI::BlendFactor sfactor, RHI::BlendFactor dfactor) override;
+        void SetBlendEquation(RHI::BlendOp mode) override;
+
+        void EnableStencilTest() override;
+        void DisableStencilTest() override;
+        [[nodiscard]] bool IsStencilTestEnabled() const override;
+        void SetStencilFunc(RHI::CompareOp func, i32 ref, u32 mask) override;
+        void SetStencilOp(RHI::StencilOp sfail, RHI::StencilOp dpfail, RHI::StencilOp dppass) override;
+        void SetStencilMask(u32 mask) override;
+        void ClearStencil() override;
+
+        void SetPolygonMode(RHI::PolygonMode mode) override;
+
+        void EnableScissorTest() override;
+        void DisableScissorTest() override;
+        void SetScissorBox(i32 x, i32 y, u32 width, u32 height) override;
+
+        void DrawElementsIndirect(const Ref<VertexArray>& vertexArray, RHI::ResourceHandle indirectBuffer) override;
+        void DrawArraysIndirect(const Ref<VertexArray>& vertexArray, RHI::ResourceHandle indirectBuffer) override;
+        void DrawBoundElementsIndirect(RHI::ResourceHandle indirectBuffer, RHI::PrimitiveTopology topology) override;
+        void MultiDrawElementsIndirectCountRaw(RHI::ResourceHandle vertexArray, RHI::ResourceHandle indirectBuffer,
+                                               u32 indirectOffsetBytes,
+                                               RHI::ResourceHandle parameterBuffer, u32 parameterOffsetBytes,
+                                               u32 maxDrawCount, u32 strideBytes) override;
+
+        void DispatchCompute(u32 groupsX, u32 groupsY, u32 groupsZ) override;
+        void DispatchComputeIndirect(RHI::ResourceHandle argsBuffer, u32 offsetBytes) override;
+        void DrawMeshTasks(u32 groupsX, u32 groupsY, u32 groupsZ) override;
+        void MemoryBarrier(MemoryBarrierFlags flags) override;
+        void IssueBarrierBatch(MemoryBarrierFlags flags, std::span<const RHI::Barrier> barriers) override;
+
+        void BindDefaultFramebuffer() override;
+        void BlitFramebufferToDefault(RHI::ResourceHandle srcFramebuffer, u32 width, u32 height) override;
+
+        void BindTexture(u32 slot, RHI::ResourceHandle texture) override;
+        void BindTexture(u32 slot, RHI::ResourceHandle texture, const RHI::SamplerDesc& sampler) override;
+        void BindImageTexture(u32 unit, RHI::ResourceHandle texture, u32 mipLevel, bool layered,
+                              u32 layer, RHI::Access access, RHI::Format format) override;
+
+        void SetPolygonOffset(f32 factor, f32 units) override;
+        void EnableMultisampling() override;
+        void DisableMultisampling() override;
+        void SetColorMask(bool red, bool green, bool blue, bool alpha) override;
+        void SetColorMaskForAttachment(u32 attachment, bool red, bool green, bool blue, bool alpha) override;
+        void SetBlendStateForAttachment(u32 attachment, bool enabled) override;
+        void SetBlendFuncForAttachment(u32 attachment, RHI::BlendFactor src, RHI::BlendFactor dst) override;
+
+        void CopyImageSubData(RHI::ResourceHandle src, TextureTargetType srcTarget,
+                              RHI::ResourceHandle dst, TextureTargetType dstTarget,
+                              u32 width, u32 height) override;
+        void CopyImageSubDataFull(RHI::ResourceHandle src, TextureTargetType srcTarget, i32 srcLevel, i32 srcZ,
+                                  RHI::ResourceHandle dst, TextureTargetType dstTarget, i32 dstLevel, i32 dstZ,
+                                  u32 width, u32 height) override;
+        void CopyImageSubDataRegion(RHI::ResourceHandle src, TextureTargetType srcTarget, i32 srcLevel,
+                                    i32 srcX, i32 srcY, i32 srcZ,
+                                    RHI::ResourceHandle dst, TextureTargetType dstTarget, i32 dstLevel,
+                                    i32 dstX, i32 dstY, i32 dstZ,
+                                    u32 width, u32 height) override;
+        void CopyFramebufferToTexture(RHI::ResourceHandle texture, u32 width, u32 height) override;
+
+        void SetDrawBuffers(std::span<const u32> attachments) override;
+        void RestoreAllDrawBuffers(u32 colorAttachmentCount) override;
+
+        [[nodiscard]] RHI::ResourceHandle CreateDepthArrayCompareOffViewHandle(RHI::ResourceHandle srcTexture,
+                                                                               u32 numLayers) override;
+        void SetTextureFilter(RHI::ResourceHandle texture, RHI::Filter minFilter, RHI::Filter magFilter) override;
+        void SetTextureWrap(RHI::ResourceHandle texture, RHI::AddressMode wrap) override;
+        void UploadTextureSubImage2D(RHI::ResourceHandle texture, u32 width, u32 height,
+                                     RHI::Format sourceFormat, const void* data) override;
+
+        void BeginConditionalRender(RHI::ResourceHandle query) override;
+        void EndConditionalRender() override;
+
+        void BindUniformBuffer(u32 bindingPoint, RHI::ResourceHandle buffer) override;
+        void BindStorageBuffer(u32 bindingPoint, RHI::ResourceHandle buffer) override;
+        void BindShaderProgram(RHI::ResourceHandle program) override;
+        void BindVertexArrayRaw(RHI::ResourceHandle vertexArray) override;
+        void BindFramebuffer(RHI::ResourceHandle framebuffer) override;
+
+        void DrawBoundIndexed(RHI::PrimitiveTopology topology, u32 indexCount,
+                              RHI::IndexType indexType, u32 baseIndex) override;
+        void DrawBoundIndexedInstanced(RHI::PrimitiveTopology topology, u32 indexCount,
+                                       RHI::IndexType indexType, u32 baseIndex,
+                                       u32 instanceCount) override;
+        void DrawBoundArrays(RHI::PrimitiveTopology topology, u32 firstVertex, u32 vertexCount) override;
+        void SetPatchVertexCount(u32 patchVertices) override;
+
+        void SetFrontFace(RHI::FrontFace face) override;
+        void SetBlendFuncSeparate(RHI::BlendFactor srcRGB, RHI::BlendFactor dstRGB,
+                                  RHI::BlendFactor srcAlpha, RHI::BlendFactor dstAlpha) override;
+        void SetClearDepth(f32 depth) override;
+
+        void AttachFramebufferColorTexture(RHI::ResourceHandle framebuffer, u32 attachmentIndex,
+                                           RHI::ResourceHandle texture, u32 mipLevel) override;
+        void AttachFramebufferDepthTexture(RHI::ResourceHandle framebuffer, RHI::ResourceHandle texture,
+                                           u32 mipLevel) override;
+        [[nodiscard]] bool IsFramebufferComplete(RHI::ResourceHandle framebuffer) override;
+        void SetFramebufferDrawAttachments(RHI::ResourceHandle framebuffer,
+                                           std::span<const u32> attachmentIndices) override;
+        void RestoreAllFramebufferDrawAttachments(RHI::ResourceHandle framebuffer,
+                                                  u32 colorAttachmentCount) override;
+        void SetFramebufferReadAttachment(RHI::ResourceHandle framebuffer, u32 attachmentIndex) override;
+        void ClearFramebufferColorAttachment(RHI::ResourceHandle framebuffer, u32 attachmentIndex,
+                                             const glm::vec4& color) override;
+        void ClearFramebufferDepth(RHI::ResourceHandle framebuffer, f32 depth) override;
+        void BlitFramebuffer(RHI::ResourceHandle srcFramebuffer, RHI::ResourceHandle dstFramebuffer,
+                             i32 srcX0, i32 srcY0, i32 srcX1, i32 srcY1,
+                             i32 dstX0, i32 dstY0, i32 dstX1, i32 dstY1,
+                             RHI::BlitAspect aspect, RHI::Filter filter) override;
+
+        void AllocateBufferStorage(RHI::ResourceHandle buffer, u64 sizeBytes, RHI::MemoryResidency residency) override;
+        void* AllocatePersistentUploadStorage(RHI::ResourceHandle buffer, u64 sizeBytes) override;
+        void UnmapBuffer(RHI::ResourceHandle buffer) override;
+        void UploadBufferSubData(RHI::ResourceHandle buffer, u64 offsetBytes, u64 sizeBytes, const void* data) override;
+        void ReadBufferSubData(RHI::ResourceHandle buffer, u64 offsetBytes, u64 sizeBytes, void* dest) override;
+        void CopyBufferSubData(RHI::ResourceHandle srcBuffer, RHI::ResourceHandle dstBuffer,
+                               u64 srcOffsetBytes, u64 dstOffsetBytes, u64 sizeBytes) override;
+        void ClearBufferUInt(RHI::ResourceHandle buffer, u32 value) override;
+        void ClearBufferFloat(RHI::ResourceHandle buffer, f32 value) override;
+
+        [[nodiscard]] RHI::ResourceHandle CreateMatchingTextureHandle(RHI::ResourceHandle source) override;
+        [[nodiscard]] RHI::ResourceHandle CreateTexture2DHandle(u32 width, u32 height, RHI::Format internalFormat) override;
+        [[nodiscard]] RHI::ResourceHandle CreateTextureCubemapHandle(u32 width, u32 height, RHI::Format internalFormat) override;
+        [[nodiscard]] RHI::ResourceHandle CreateFramebufferHandle() override;
+        [[nodiscard]] RHI::ResourceHandle CreateBufferHandle() override;
+        [[nodiscard]] RHI::ResourceHandle CreateVertexArrayHandle() override;
+        void DeleteTexture(RHI::ResourceHandle texture) override;
+        void DeleteFramebuffer(RHI::ResourceHandle framebuffer) override;
+        void DeleteBuffer(RHI::ResourceHandle buffer) override;
+        void DeleteVertexArray(RHI::ResourceHandle vertexArray) override;
+        void SetVertexArrayIndexBuffer(RHI::ResourceHandle vertexArray, RHI::ResourceHandle indexBuffer) override;
+
+        void ClearTextureFloat(RHI::ResourceHandle texture, u32 mipLevel, const glm::vec4& color) override;
+        void ClearTextureUInt(RHI::ResourceHandle texture, u32 mipLevel, u32 value) override;
+        void UploadTextureSubImage2D(RHI::ResourceHandle texture, i32 xOffset, i32 yOffset,
+                                     u32 width, u32 height,
+                                     RHI::Format sourceFormat, const void* data) override;
+        void UploadTextureSubImage3D(RHI::ResourceHandle texture, i32 xOffset, i32 yOffset, i32 zOffset,
+                                     u32 width, u32 height, u32 depth,
+                                     RHI::Format sourceFormat, const void* data) override;
+        [[nodiscard]] bool ReadTextureImage(RHI::ResourceHandle texture, u32 mipLevel, RHI::Format destFormat,
+                                            sizet destSizeBytes, void* dest) override;
+        [[nodiscard]] bool ReadTextureSubImage(RHI::ResourceHandle texture, u32 mipLevel,
+                                               i32 x, i32 y, i32 z,
+                                               u32 width, u32 height, u32 depth,
+                                               RHI::Format destFormat,
+                                               sizet destSizeBytes, void* dest) override;
+        void GetTextureDimensions(RHI::ResourceHandle texture, u32 mipLevel, u32& outWidth, u32& outHeight) override;
+        [[nodiscard]] bool QueryTextureFormat(RHI::ResourceHandle texture, u32 mipLevel,
+                                              RHI::TextureFormatInfo& out) override;
+        void TextureBarrier() override;
+
+        void CreateQueries(RHI::QueryType type, std::span<RHI::ResourceHandle> outQueries) override;
+        void DeleteQueries(std::span<const RHI::ResourceHandle> queries) override;
+        void BeginQuery(RHI::QueryType type, RHI::ResourceHandle query) override;
+        void EndQuery(RHI::QueryType type) override;
+        void WriteTimestamp(RHI::ResourceHandle query) override;
+        [[nodiscard]] bool IsQueryResultAvailable(RHI::ResourceHandle query) override;
+        [[nodiscard]] u32 GetQueryResultU32(RHI::ResourceHandle query) override;
+        [[nodiscard]] u64 GetQueryResultU64(RHI::ResourceHandle query) override;
+
+        [[nodiscard]] u64 CreateFence() override;
+        [[nodiscard]] RHI::FenceStatus ClientWaitFence(u64 fence, u64 timeoutNanoseconds) override;
+        [[nodiscard]] bool IsFenceSignaled(u64 fence) override;
+        void DestroyFence(u64 fence) override;
+
+        void PushDebugGroup(u32 id, std::string_view label) override;
+        void PopDebugGroup() override;
+
+        void WaitForDeviceIdle() override;
+
+        [[nodiscard]] u32 GetMaxFramebufferSamples() const override;
+        [[nodiscard]] u32 GetMaxColorTextureSamples() const override;
+        [[nodiscard]] u32 GetMaxDepthTextureSamples() const override;
+
+        void SetProgramUniformFloat(RHI::ResourceHandle program, std::string_view name, f32 value) override;
+
+        [[nodiscard]] bool IsDeviceAvailable() const override;
+        [[nodiscard]] u32 GetMaxUniformBlockSize() const override;
+        [[nodiscard]] bool SupportsInt64ShaderAtomics() const override;
+        [[nodiscard]] bool SupportsMeshShaders() const override;
+
+      private:
+        // What the null device remembers about an object it minted. Only what
+        // a query can ask back for — dimensions, format, mapped storage.
+        struct NullObject
+        {
+            RHI::ResourceKind Kind = RHI::ResourceKind::Unknown;
+            u32 Width = 0;
+            u32 Height = 0;
+            RHI::Format Format = RHI::Format::Unknown;
+            std::vector<u8> Mapped;
+        };
+
+        void Record(NullCommand op, std::initializer_list<u64> arguments);
+        // A handle's hash word: the null ordinal for one of ours, the raw
+        // {Index, Generation} for anything else.
+        [[nodiscard]] auto HandleWord(RHI::ResourceHandle handle) const -> u64;
+        [[nodiscard]] auto VertexArrayWord(const Ref<VertexArray>& vertexArray) const -> u64;
+
+        [[nodiscard]] auto Mint(RHI::ResourceKind kind, u32 width = 0, u32 height = 0,
+                                RHI::Format format = RHI::Format::Unknown) -> RHI::ResourceHandle;
+        void Retire(RHI::ResourceHandle handle);
+        [[nodiscard]] auto Find(RHI::ResourceHandle handle) -> NullObject*;
+
+        auto BeginStage(std::string_view name) -> sizet;
+        void EndStage(sizet index);
+
+        // Recording.
+        u64 m_StreamHash;
+        u64 m_CommandCount = 0;
+        std::array<u64, static_cast<sizet>(NullCommand::COUNT)> m_CallCounts{};
+        bool m_CaptureEnabled = true;
+        std::vector<RecordedCommand> m_Commands;
+        std::vector<u64> m_Arguments;
+
+        // Stages. Open stages keep their own running hash and start point.
+        struct OpenStage
+        {
+            sizet Index = 0;
+            u64 Hash = 0;
+            u64 StartCommand = 0;
+            std::chrono::steady_clock::time_point Start;
+        };
+        std::vector<StageRecord> m_Stages;
+        std::vector<OpenStage> m_OpenStages;
+
+        // Device state.
+        std::unordered_map<u64, NullObject> m_Resources; ///< keyed by null ordinal
+        u64 m_NextOrdinal = 1;
+        u64 m_NextFence = 1;
+        Viewport m_Viewport{};
+        bool m_StencilTestEnabled = false;
+    };
+} // namespace OloEngine
@@ -0,0 +1,104 @@
+#include "OloEnginePCH.h"
+#include "Platform/Null/NullShader.h"
+
+#include "OloEngine/Renderer/RenderCommand.h"
+#include "Platform/Null/NullRendererAPI.h"
+
+#include <filesystem>
+#include <utility>
+
+namespace OloEngine
+{
+    namespace
+    {
+        [[nodiscard]] RHI::ScopedResourceHandle MintProgram()
+        {
+            return { RHI::ResourceKind::ShaderProgram, NullRendererAPI::MintObjectOrdinal(), RHI::Backend::Null };
+        }
+    } // namespace
+
+    // =========================================================================
+    // NullShader
+    // =========================================================================
+
+    NullShader::NullShader(const std::string& filepath)
+        : m_Name(std::filesystem::path(filepath).stem().string()), m_FilePath(filepath), m_RHIHandle(MintProgram())
+    {
+    }
+
+    NullShader::NullShader(std::string name, const std::string& vertexSrc, const std::string& fragmentSrc)
+        : m_Name(std::move(name)), m_RHIHandle(MintProgram())
+    {
+        (void)vertexSrc;
+        (void)fragmentSrc;
+    }
+
+    void NullShader::Bind() const
+    {
+        RenderCommand::BindShaderProgram(m_RHIHandle.Get());
+        // Nothing here reads the descriptor heap; clear both process-wide
+        // flags so a stale value from another backend's last bind cannot
+        // steer the binding seam (see VulkanShader::Bind).
+        SetBoundProgramBindless(false);
+        SetBoundProgramMaterialOffsets(false);
+    }
+
+    void NullShader::Unbind() const
+    {
+        RenderCommand::BindShaderProgram(RHI::NullResource);
+        SetBoundProgramBindless(false);
+        SetBoundProgramMaterialOffsets(false);
+    }
+
+    // Default-block uniforms have no program to land in.
+    void NullShader::SetInt(const std::string&, int) const {}
+    void NullShader::SetIntArray(const std::string&, int*, u32) const {}
+    void NullShader::SetFloat(const std::string&, f32) const {}
+    void NullShader::SetFloat2(const std::string&, const glm::vec2&) const {}
+    void NullShader::SetFloat3(const std::string&, const glm::vec3&) const {}
+    void NullShader::SetFloat4(const std::string&, const glm::vec4&) const {}
+    void NullShader::SetMat4(const std::string&, const glm::mat4&) const {}
+
+    // =========================================================================
+    // NullComputeShader
+    // =========================================================================
+
+    NullComputeShader::NullComputeShader(const std::string& filepath)
+        : m_FilePath(filepath), m_RHIHandle(MintProgram())
+    {
+        // Same derivation as OpenGLComputeShader and LoadSourceFromFile, so a
+        // shader created either way is found under the same name.
+        auto lastSlash = filepath.find_last_of("/\\");
+        const auto lastDot = filepath.rfind('.');
+        lastSlash = lastSlash == std::string::npos ? 0 : (lastSlash + 1);
+        const auto count = lastDot == std::string::npos ? (filepath.size() - lastSlash) : (lastDot - lastSlash);
+        m_Name = filepath.substr(lastSlash, count);
+    }
+
+    NullComputeShader::NullComputeShader(std::string name, const std::string& source)
+        : m_Name(std::move(name)), m_RHIHandle(MintProgram())
+    {
+        (void)source;
+    }
+
+    void NullComputeShader::Bind() const
+    {
+        RenderCommand::BindShaderProgram(m_RHIHandle.Get());
+        Shader::SetBoundProgramBindless(false);
+    }
+
+    void NullComputeShader::Unbind() const
+    {
+        RenderCommand::BindShaderProgram(RHI::NullResource);
+        Shader::SetBoundProgramBindless(false);
+    }
+
+    void NullComputeShader::SetInt(const std::string&, int) const {}
+    void NullComputeShader::SetUint(const std::string&, u32) const {}
+    void NullComputeShader::SetIntArray(const std::string&, int*, u32) const {}
+    void NullComputeShader::SetFloat(const std::string&, f32) const {}
+    void NullComputeShader::SetFloat2(const std::string&, const glm::vec2&) const {}
+    void NullComputeShader::SetFloat3(const std::string&, const glm::vec3&) const {}
+    void NullComputeShader::SetFloat4(const std::string&, const glm::vec4&) const {}
+    void NullComputeShader::SetMat4(const std::string&, const glm::mat4&) const {}
+} // namespace OloEngine
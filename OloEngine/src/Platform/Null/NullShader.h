@@ -0,0 +1,133 @@
+#pragma once
+
+// =============================================================================
+// NullShader.h — Shader and ComputeShader on the Null backend.
+//
+// No source is read or compiled: a shader is its name, its path and a
+// Backend::Null ShaderProgram handle from NullRendererAPI::MintObjectOrdinal().
+// The name follows the GL twins (the file stem), so ShaderLibrary lookups by
+// name behave the same. Bind() records BindShaderProgram through
+// RenderCommand; the default-block uniform setters are no-ops, as on Vulkan.
+//
+// GetResourceRegistry() returns null. There is no reflection to fill one,
+// and ShaderLibrary skips shaders without a registry rather than treating
+// them as GL programs awaiting initialisation.
+//
+// Thread-safety: render thread only, like every other backend.
+// =============================================================================
+
+#include "OloEngine/Renderer/ComputeShader.h"
+#include "OloEngine/Renderer/RHI/RHIResourceRegistry.h"
+#include "OloEngine/Renderer/Shader.h"
+
+#include <string>
+
+namespace OloEngine
+{
+    class NullShader final : public Shader
+    {
+      public:
+        explicit NullShader(const std::string& filepath);
+        NullShader(std::string name, const std::string& vertexSrc, const std::string& fragmentSrc);
+        ~NullShader() override = default;
+
+        void Bind() const override;
+        void Unbind() const override;
+
+        void SetInt(const std::string& name, int value) const override;
+        void SetIntArray(const std::string& name, int* values, u32 count) const override;
+        void SetFloat(const std::string& name, f32 value) const override;
+        void SetFloat2(const std::string& name, const glm::vec2& value) const override;
+        void SetFloat3(const std::string& name, const glm::vec3& value) const override;
+        void SetFloat4(const std::string& name, const glm::vec4& value) const override;
+        void SetMat4(const std::string& name, const glm::mat4& value) const override;
+
+        // Diagnostics-only field: a native GL name does not exist here.
+        [[nodiscard]] u32 GetRendererID() const override
+        {
+            return 0;
+        }
+        [[nodiscard]] RHI::ResourceHandle GetRHIHandle() const override
+        {
+            return m_RHIHandle.Get();
+        }
+        [[nodiscard]] const std::string& GetName() const override
+        {
+            return m_Name;
+        }
+        [[nodiscard]] const std::string& GetFilePath() const override
+        {
+            return m_FilePath;
+        }
+
+        void Reload() override
+        {
+        }
+
+        ShaderResourceRegistry* GetResourceRegistry() override
+        {
+            return nullptr;
+        }
+        const ShaderResourceRegistry* GetResourceRegistry() const override
+        {
+            return nullptr;
+        }
+
+      private:
+        std::string m_Name;
+        std::string m_FilePath; // empty for source-constructed shaders
+        RHI::ScopedResourceHandle m_RHIHandle;
+    };
+
+    class NullComputeShader final : public ComputeShader
+    {
+      public:
+        explicit NullComputeShader(const std::string& filepath);
+        NullComputeShader(std::string name, const std::string& source);
+        ~NullComputeShader() override = default;
+
+        void Bind() const override;
+        void Unbind() const override;
+
+        void SetInt(const std::string& name, int value) const override;
+        void SetUint(const std::string& name, u32 value) const override;
+        void SetIntArray(const std::string& name, int* values, u32 count) const override;
+        void SetFloat(const std::string& name, f32 value) const override;
+        void SetFloat2(const std::string& name, const glm::vec2& value) const override;
+        void SetFloat3(const std::string& name, const glm::vec3& value) const override;
+        void SetFloat4(const std::string& name, const glm::vec4& value) const override;
+        void SetMat4(const std::string& name, const glm::mat4& value) const override;
+
+        // Always valid: nothing was compiled, so nothing can have failed.
+        [[nodiscard]] bool IsValid() const override
+        {
+            return true;
+        }
+        // Diagnostics-only field: a native GL name does not exist here.
+        [[nodiscard]] u32 GetRendererID() const override
+        {
+            return 0;
+        }
+        [[nodiscard]] RHI::ResourceHandle GetRHIHandle() const override
+        {
+            return m_RHIHandle.Get();
+        }
+        [[nodiscard]] const std::string& GetName() const override
+        {
+            return m_Name;
+        }
+        [[nodiscard]] const std::string& GetFilePath() const override
+        {
+            return m_FilePath;
+        }
+
+        void Reload() override
+        {
+        }
+
+      private:
+        std::string m_Name;
+        std::string m_FilePath; // empty for source-constructed shaders
+        RHI::ScopedResourceHandle m_RHIHandle;
+    };
+} // namespace OloEngine
@@ -0,0 +1,480 @@
+#include "OloEnginePCH.h"
+#include "Platform/Null/NullTexture.h"
+
+#include "OloEngine/Renderer/RHI/RHIDescriptorHeap.h"
+#include "OloEngine/Renderer/RenderCommand.h"
+#include "OloEngine/Renderer/TextureCompression.h"
+#include "Platform/Null/NullRendererAPI.h"
+
+#include <stb_image/stb_image.h>
+
+#include <algorithm>
+#include <bit>
+
+namespace OloEngine
+{
+    namespace
+    {
+        [[nodiscard]] RHI::ScopedResourceHandle MintTexture()
+        {
+            return { RHI::ResourceKind::Texture, NullRendererAPI::MintObjectOrdinal(), RHI::Backend::Null };
+        }
+
+        // The Null half of Utils::RetireTextureViews: the heap can hold views
+        // of any identity, so one must not outlive the texture it names.
+        // noexcept because every caller is a destructor.
+        void RetireTextureViews(RHI::ResourceHandle handle) noexcept
+        {
+            try
+            {
+                RHI::DescriptorHeap::Get().RetireResource(handle);
+            }
+            catch (...)
+            {
+                OLO_CORE_ERROR("[RHI/Null] Retiring texture views threw during destruction; they leak.");
+            }
+        }
+
+        [[nodiscard]] u32 FullMipChain(u32 width, u32 height)
+        {
+            return static_cast<u32>(std::bit_width(std::max({ width, height, 1u })));
+        }
+
+        // Bytes per texel of an uncompressed format; 0 for the block formats,
+        // which have no per-texel readback.
+        [[nodiscard]] u32 TexelBytes(ImageFormat format)
+        {
+            switch (format)
+            {
+                case ImageFormat::R8:
+                case ImageFormat::R8UI:
+                    return 1;
+                case ImageFormat::R16UI:
+                case ImageFormat::RG8:
+                    return 2;
+                case ImageFormat::RGB8:
+                    return 3;
+                case ImageFormat::RGBA8:
+                case ImageFormat::RG16UI:
+                case ImageFormat::RG16F:
+                case ImageFormat::R32F:
+                case ImageFormat::R32I:
+                case ImageFormat::R32UI:
+                case ImageFormat::DEPTH24STENCIL8:
+                    return 4;
+                case ImageFormat::RGBA16F:
+                case ImageFormat::RG32F:
+                    return 8;
+                case ImageFormat::RGB32F:
+                    return 12;
+                case ImageFormat::RGBA32F:
+                    return 16;
+                case ImageFormat::None:
+                case ImageFormat::BC7:
+                case ImageFormat::BC5:
+                case ImageFormat::BC6H:
+                    return 0;
+            }
+            return 0;
+        }
+
+        // What a readback of one `width` x `height` level would return.
+        [[nodiscard]] bool ZeroReadback(ImageFormat format, u32 width, u32 height, u32 mipLevel, u32 mipLevels,
+                                        std::vector<u8>& outData)
+        {
+            outData.clear();
+            const u32 texelBytes = TexelBytes(format);
+            if (texelBytes == 0 || mipLevel >= mipLevels)
+                return false;
+
+            const u32 mipWidth = std::max(width >> mipLevel, 1u);
+            const u32 mipHeight = std::max(height >> mipLevel, 1u);
+            outData.assign(static_cast<sizet>(mipWidth) * mipHeight * texelBytes, 0);
+            return true;
+        }
+    } // namespace
+
+    // =========================================================================
+    // NullTexture2D
+    // =========================================================================
+
+    NullTexture2D::NullTexture2D(const TextureSpecification& specification)
+        : m_Specification(specification), m_IsLoaded(true), m_RHIHandle(MintTexture())
+    {
+        m_HasAlpha = m_Specification.Format == ImageFormat::RGBA8 ||
+                     m_Specification.Format == ImageFormat::RGBA16F ||
+                     m_Specification.Format == ImageFormat::RGBA32F;
+        DeriveMipLevels();
+    }
+
+    NullTexture2D::NullTexture2D(const CompressedTextureImage& compressedImage)
+        : m_RHIHandle(MintTexture())
+    {
+        if (!compressedImage.IsValid())
+        {
+            OLO_CORE_ERROR("NullTexture2D: invalid CompressedTextureImage");
+            return;
+        }
+
+        m_Path = compressedImage.SourcePath;
+        m_Specification.Width = compressedImage.Width;
+        m_Specification.Height = compressedImage.Height;
+        m_Specification.SRGB = compressedImage.SRGB;
+        switch (compressedImage.Format)
+        {
+            case TextureCompressionFormat::BC5:
+                m_Specification.Format = ImageFormat::BC5;
+                break;
+            case TextureCompressionFormat::BC6H:
+                m_Specification.Format = ImageFormat::BC6H;
+                break;
+            case TextureCompressionFormat::BC7:
+            case TextureCompressionFormat::None:
+            default:
+                m_Specification.Format = ImageFormat::BC7;
+                break;
+        }
+        m_Specification.GenerateMips = false;
+        m_Specification.MipLevels = compressedImage.MipLevels();
+        m_MipLevels = compressedImage.MipLevels();
+        m_HasAlpha = compressedImage.HasAlpha;
+        m_IsLoaded = true;
+    }
+
+    NullTexture2D::NullTexture2D(const std::string& path, bool srgb)
+        : m_Path(path), m_RHIHandle(MintTexture())
+    {
+        m_Specification.SRGB = srgb;
+
+        int width = 0;
+        int height = 0;
+        int channels = 0;
+        if (!::stbi_info(path.c_str(), &width, &height, &channels))
+        {
+            OLO_CORE_ERROR("Image texture data is null! Failed to load: '{}'", path);
+            return;
+        }
+
+        Invalidate(path, static_cast<u32>(width), static_cast<u32>(height), nullptr, static_cast<u32>(channels));
+    }
+
+    NullTexture2D::~NullTexture2D()
+    {
+        RetireTextureViews(m_RHIHandle.Get());
+    }
+
+    void NullTexture2D::DeriveMipLevels()
+    {
+        const u32 fullChain = FullMipChain(m_Specification.Width, m_Specification.Height);
+        if (m_Specification.Samples > 1)
+            m_MipLevels = 1;
+        else if (m_Specification.MipLevels > 0)
+            m_MipLevels = std::min(m_Specification.MipLevels, fullChain);
+        else
+            m_MipLevels = m_Specification.GenerateMips ? fullChain : 1;
+    }
+
+    void NullTexture2D::SetData(void* data, u32 size)
+    {
+        // Nothing is uploaded; the GL twin's refusals are kept so a caller that
+        // is wrong there is wrong here too.
+        (void)data;
+        (void)size;
+        if (TexelBytes(m_Specification.Format) == 0)
+            OLO_CORE_ERROR("NullTexture2D::SetData: not supported for block-compressed textures");
+        else if (m_Specification.Samples > 1u)
+            OLO_CORE_ERROR("NullTexture2D::SetData: multisample textures do not support data uploads");
+    }
+
+    void NullTexture2D::SubImage(u32 x, u32 y, u32 width, u32 height, const void* data, u32 dataSize)
+    {
+        (void)data;
+        (void)dataSize;
+        if (TexelBytes(m_Specification.Format) == 0)
+            OLO_CORE_ERROR("NullTexture2D::SubImage: not supported for block-compressed textures");
+        else if (m_Specification.Samples > 1u)
+            OLO_CORE_ERROR("NullTexture2D::SubImage: multisample textures do not support sub-image uploads");
+        else if (x + width > m_Specification.Width || y + height > m_Specification.Height)
+            OLO_CORE_ERROR("NullTexture2D::SubImage: region exceeds texture bounds");
+    }
+
+    void NullTexture2D::Invalidate(std::string_view path, u32 width, u32 height, const void* data, u32 channels)
+    {
+        (void)data;
+        // The GL twin's channel-count mapping, so a format-dependent caller
+        // sees the same format on both backends.
+        switch (channels)
+        {
+            case 1:
+                m_Specification.Format = ImageFormat::R8;
+                break;
+            case 2:
+                m_Specification.Format = ImageFormat::RG8;
+                break;
+            case 3:
+                m_Specification.Format = ImageFormat::RGB8;
+                break;
+            case 4:
+                m_Specification.Format = ImageFormat::RGBA8;
+                break;
+            default:
+                OLO_CORE_ERROR("Texture channel count is not within (1-4) range. Channel count: {}", channels);
+                return;
+        }
+
+        m_Path = path;
+        m_Specification.Width = width;
+        m_Specification.Height = height;
+        m_HasAlpha = channels == 4;
+        m_IsLoaded = true;
+        DeriveMipLevels();
+    }
+
+    void NullTexture2D::Resize(u32 width, u32 height)
+    {
+        if (width == m_Specification.Width && height == m_Specification.Height)
+            return;
+
+        m_Specification.Width = width;
+        m_Specification.Height = height;
+        DeriveMipLevels();
+    }
+
+    void NullTexture2D::Bind(u32 slot) const
+    {
+        RenderCommand::BindTexture(slot, m_RHIHandle.Get());
+    }
+
+    bool NullTexture2D::GetData(std::vector<u8>& outData, u32 mipLevel) const
+    {
+        if (m_Specification.Samples > 1)
+        {
+            outData.clear();
+            return false;
+        }
+        return ZeroReadback(m_Specification.Format, m_Specification.Width, m_Specification.Height, mipLevel, m_MipLevels,
+                            outData);
+    }
+
+    // =========================================================================
+    // NullTextureCubemap
+    // =========================================================================
+
+    NullTextureCubemap::NullTextureCubemap(const CubemapSpecification& specification)
+        : m_CubemapSpecification(specification), m_RHIHandle(MintTexture())
+    {
+        Describe();
+    }
+
+    NullTextureCubemap::NullTextureCubemap(const std::vector<std::string>& facePaths)
+        : m_RHIHandle(MintTexture())
+    {
+        OLO_CORE_ASSERT(facePaths.size() == 6, "Cubemap requires exactly 6 face paths!");
+
+        // Every face must match; the first one's header describes them all.
+        int width = 0;
+        int height = 0;
+        int channels = 0;
+        if (!facePaths.empty() && ::stbi_info(facePaths.front().c_str(), &width, &height, &channels))
+        {
+            m_Path = facePaths.front();
+            m_CubemapSpecification.Width = static_cast<u32>(width);
+            m_CubemapSpecification.Height = static_cast<u32>(height);
+            m_CubemapSpecification.Format = channels == 4 ? ImageFormat::RGBA8 : ImageFormat::RGB8;
+        }
+        else
+        {
+            OLO_CORE_ERROR("NullTextureCubemap: failed to read cubemap face '{}'",
+                           facePaths.empty() ? std::string{} : facePaths.front());
+        }
+        Describe();
+    }
+
+    NullTextureCubemap::~NullTextureCubemap()
+    {
+        RetireTextureViews(m_RHIHandle.Get());
+    }
+
+    void NullTextureCubemap::Describe()
+    {
+        const u32 width = std::max(m_CubemapSpecification.Width, 1u);
+        const u32 height = std::max(m_CubemapSpecification.Height, 1u);
+        m_Specification.Width = width;
+        m_Specification.Height = height;
+        m_Specification.Format = m_CubemapSpecification.Format;
+
+        const u32 fullChain = FullMipChain(width, height);
+        if (m_CubemapSpecification.MipLevels > 0)
+            m_MipLevels = std::min(m_CubemapSpecification.MipLevels, fullChain);
+        else
+            m_MipLevels = m_CubemapSpecification.GenerateMips ? fullChain : 1;
+    }
+
+    void NullTextureCubemap::SetData(void* data, u32 size)
+    {
+        (void)data;
+        (void)size;
+        OLO_CORE_WARN("NullTextureCubemap::SetData: use SetFaceData for cubemap faces");
+    }
+
+    void NullTextureCubemap::Invalidate(std::string_view path, u32 width, u32 height, const void* data, u32 channels)
+    {
+        (void)data;
+        (void)channels;
+        m_Path = path;
+        m_CubemapSpecification.Width = width;
+        m_CubemapSpecification.Height = height;
+        Describe();
+    }
+
+    void NullTextureCubemap::Bind(u32 slot) const
+    {
+        RenderCommand::BindTexture(slot, m_RHIHandle.Get());
+    }
+
+    bool NullTextureCubemap::GetData(std::vector<u8>& outData, u32 mipLevel) const
+    {
+        return GetFaceData(0, outData, mipLevel);
+    }
+
+    void NullTextureCubemap::SetFaceData(u32 faceIndex, void* data, u32 size)
+    {
+        (void)data;
+        (void)size;
+        OLO_CORE_ASSERT(faceIndex < 6, "Face index out of range!");
+        (void)faceIndex;
+    }
+
+    bool NullTextureCubemap::SetFaceDataMip(u32 faceIndex, u32 mipLevel, void* data, u32 size)
+    {
+        (void)size;
+        return faceIndex < 6 && mipLevel < m_MipLevels && data != nullptr;
+    }
+
+    bool NullTextureCubemap::GetFaceData(u32 faceIndex, std::vector<u8>& outData, u32 mipLevel) const
+    {
+        if (faceIndex >= 6)
+        {
+            outData.clear();
+            return false;
+        }
+        return ZeroReadback(m_Specification.Format, m_Specification.Width, m_Specification.Height, mipLevel, m_MipLevels,
+                            outData);
+    }
+
+    // =========================================================================
+    // NullTextureCubemapArray
+    // =========================================================================
+
+    NullTextureCubemapArray::NullTextureCubemapArray(const CubemapArraySpecification& specification)
+        : m_ArraySpecification(specification), m_RHIHandle(MintTexture())
+    {
+        const u32 resolution = std::max(specification.Resolution, 1u);
+        m_Specification.Width = resolution;
+        m_Specification.Height = resolution;
+        m_Specification.Format = specification.Format;
+
+        const u32 fullChain = FullMipChain(resolution, resolution);
+        m_MipLevels = specification.MipLevels > 0 ? std::min(specification.MipLevels, fullChain) : fullChain;
+    }
+
+    NullTextureCubemapArray::~NullTextureCubemapArray()
+    {
+        RetireTextureViews(m_RHIHandle.Get());
+    }
+
+    void NullTextureCubemapArray::SetData(void* data, u32 size)
+    {
+        (void)data;
+        (void)size;
+        OLO_CORE_WARN("NullTextureCubemapArray::SetData: use SetLayerMipData for cubemap array layers");
+    }
+
+    void NullTextureCubemapArray::Invalidate(std::string_view path, u32 width, u32 height, const void* data, u32 channels)
+    {
+        (void)path;
+        (void)width;
+        (void)height;
+        (void)data;
+        (void)channels;
+        OLO_CORE_WARN("NullTextureCubemapArray::Invalidate: cubemap arrays are not loaded from files");
+    }
+
+    void NullTextureCubemapArray::Bind(u32 slot) const
+    {
+        RenderCommand::BindTexture(slot, m_RHIHandle.Get());
+    }
+
+    bool NullTextureCubemapArray::GetData(std::vector<u8>& outData, u32 mipLevel) const
+    {
+        if (!ZeroReadback(m_Specification.Format, m_Specification.Width, m_Specification.Height, mipLevel, m_MipLevels,
+                          outData))
+            return false;
+
+        // Every face of every layer.
+        outData.resize(outData.size() * 6 * m_ArraySpecification.Layers, 0);
+        return true;
+    }
+
+    bool NullTextureCubemapArray::SetLayerMipData(u32 layer, u32 mip, const void* data, sizet sizeBytes)
+    {
+        (void)sizeBytes;
+        return layer < m_ArraySpecification.Layers && mip < m_MipLevels && data != nullptr;
+    }
+
+    bool NullTextureCubemapArray::CopyLayerFromCubemap(u32 layer, const TextureCubemap& source)
+    {
+        return layer < m_ArraySpecification.Layers &&
+               source.GetWidth() == m_ArraySpecification.Resolution &&
+               source.GetHeight() == m_ArraySpecification.Resolution;
+    }
+
+    // =========================================================================
+    // NullTexture3D
+    // =========================================================================
+
+    NullTexture3D::NullTexture3D(const Texture3DSpecification& specification)
+        : m_Specification(specification), m_RHIHandle(MintTexture())
+    {
+    }
+
+    NullTexture3D::~NullTexture3D()
+    {
+        RetireTextureViews(m_RHIHandle.Get());
+    }
+
+    void NullTexture3D::Bind(u32 slot) const
+    {
+        RenderCommand::BindTexture(slot, m_RHIHandle.Get());
+    }
+
+    // =========================================================================
+    // NullTexture2DArray
+    // =========================================================================
+
+    NullTexture2DArray::NullTexture2DArray(const Texture2DArraySpecification& specification)
+        : m_Specification(specification), m_RHIHandle(MintTexture())
+    {
+    }
+
+    NullTexture2DArray::~NullTexture2DArray()
+    {
+        RetireTextureViews(m_RHIHandle.Get());
+    }
+
+    void NullTexture2DArray::Bind(u32 slot) const
+    {
+        RenderCommand::BindTexture(slot, m_RHIHandle.Get());
+    }
+
+    void NullTexture2DArray::SetLayerData(u32 layer, const void* data, u32 width, u32 height)
+    {
+        (void)data;
+        OLO_CORE_ASSERT(layer < m_Specification.Layers, "Layer index out of range!");
+        OLO_CORE_ASSERT(width == m_Specification.Width && height == m_Specification.Height,
+                        "Layer data dimensions must match the array!");
+        (void)layer;
+        (void)width;
+        (void)height;
+    }
+} // namespace OloEngine
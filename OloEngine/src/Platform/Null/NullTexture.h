@@ -0,0 +1,327 @@
+#pragma once
+
+// =============================================================================
+// NullTexture.h — the texture family on the Null backend: Texture2D,
+// TextureCubemap, TextureCubemapArray, Texture3D and Texture2DArray.
+//
+// Each keeps its specification (with the mip count the GL twin would derive)
+// and a Backend::Null handle minted from NullRendererAPI::MintObjectOrdinal().
+// Uploads only check their arguments; no texels are kept, and readbacks
+// zero-fill at the right size and succeed, the same answer NullRendererAPI
+// gives for its own textures. Bind(slot) records through RenderCommand.
+//
+// A path-loaded Texture2D reads only the image header (stbi_info), so asset
+// loads cost what the file system costs and report the real dimensions.
+//
+// Thread-safety: render thread only, like every other backend.
+// =============================================================================
+
+#include "OloEngine/Renderer/RHI/RHIResourceRegistry.h"
+#include "OloEngine/Renderer/Texture.h"
+#include "OloEngine/Renderer/Texture2DArray.h"
+#include "OloEngine/Renderer/Texture3D.h"
+#include "OloEngine/Renderer/TextureCubemap.h"
+#include "OloEngine/Renderer/TextureCubemapArray.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace OloEngine
+{
+    struct CompressedTextureImage;
+
+    class NullTexture2D : public Texture2D
+    {
+      public:
+        explicit NullTexture2D(const TextureSpecification& specification);
+        explicit NullTexture2D(const CompressedTextureImage& compressedImage);
+        NullTexture2D(const std::string& path, bool srgb);
+        ~NullTexture2D() override;
+
+        const TextureSpecification& GetSpecification() const override
+        {
+            return m_Specification;
+        }
+
+        [[nodiscard("Store this!")]] u32 GetWidth() const override
+        {
+            return m_Specification.Width;
+        }
+        [[nodiscard("Store this!")]] u32 GetHeight() const override
+        {
+            return m_Specification.Height;
+        }
+        // Diagnostics-only field: a native GL name does not exist here.
+        [[nodiscard("Store this!")]] u32 GetRendererID() const override
+        {
+            return 0;
+        }
+
+        [[nodiscard]] RHI::ResourceHandle GetRHIHandle() const override
+        {
+            return m_RHIHandle.Get();
+        }
+        [[nodiscard("Store this!")]] const std::string& GetPath() const override
+        {
+            return m_Path;
+        }
+
+        void SetData(void* data, u32 size) override;
+        void SubImage(u32 x, u32 y, u32 width, u32 height, const void* data, u32 dataSize) override;
+        void Invalidate(std::string_view path, u32 width, u32 height, const void* data, u32 channels) override;
+        void Bind(u32 slot) const override;
+        bool GetData(std::vector<u8>& outData, u32 mipLevel = 0) const override;
+
+        [[nodiscard("Store this!")]] bool IsLoaded() const override
+        {
+            return m_IsLoaded;
+        }
+
+        [[nodiscard("Use for transparency")]] bool HasAlphaChannel() const override
+        {
+            return m_HasAlpha;
+        }
+
+        [[nodiscard("Store this!")]] u32 GetMipLevelCount() const override
+        {
+            return m_MipLevels;
+        }
+
+        // Identity survives, as it does for the GL twin's recreate-in-place.
+        void Resize(u32 width, u32 height) override;
+
+      private:
+        void DeriveMipLevels();
+
+        TextureSpecification m_Specification;
+        std::string m_Path; // set by the file ctor and Invalidate
+        u32 m_MipLevels = 1;
+        bool m_IsLoaded = false;
+        bool m_HasAlpha = false;
+        RHI::ScopedResourceHandle m_RHIHandle;
+    };
+
+    class NullTextureCubemap : public TextureCubemap
+    {
+      public:
+        explicit NullTextureCubemap(const CubemapSpecification& specification);
+        explicit NullTextureCubemap(const std::vector<std::string>& facePaths);
+        ~NullTextureCubemap() override;
+
+        [[nodiscard]] const TextureSpecification& GetSpecification() const override
+        {
+            return m_Specification;
+        }
+        [[nodiscard]] u32 GetWidth() const override
+        {
+            return m_CubemapSpecification.Width;
+        }
+        [[nodiscard]] u32 GetHeight() const override
+        {
+            return m_CubemapSpecification.Height;
+        }
+        // Diagnostics-only field: a native GL name does not exist here.
+        [[nodiscard]] u32 GetRendererID() const override
+        {
+            return 0;
+        }
+        [[nodiscard]] RHI::ResourceHandle GetRHIHandle() const override
+        {
+            return m_RHIHandle.Get();
+        }
+        [[nodiscard]] const std::string& GetPath() const override
+        {
+            return m_Path;
+        }
+
+        void SetData(void* data, u32 size) override;
+        void Invalidate(std::string_view path, u32 width, u32 height, const void* data, u32 channels) override;
+        void Bind(u32 slot) const override;
+        bool GetData(std::vector<u8>& outData, u32 mipLevel = 0) const override;
+
+        [[nodiscard]] bool IsLoaded() const override
+        {
+            return true;
+        }
+        [[nodiscard]] bool HasAlphaChannel() const override
+        {
+            return m_CubemapSpecification.Format == ImageFormat::RGBA8 ||
+                   m_CubemapSpecification.Format == ImageFormat::RGBA16F ||
+                   m_CubemapSpecification.Format == ImageFormat::RGBA32F;
+        }
+
+        void SetFaceData(u32 faceIndex, void* data, u32 size) override;
+        bool SetFaceDataMip(u32 faceIndex, u32 mipLevel, void* data, u32 size) override;
+        void GenerateMipmaps() const override
+        {
+        }
+
+        [[nodiscard]] const CubemapSpecification& GetCubemapSpecification() const override
+        {
+            return m_CubemapSpecification;
+        }
+        bool GetFaceData(u32 faceIndex, std::vector<u8>& outData, u32 mipLevel = 0) const override;
+        [[nodiscard]] u32 GetMipLevelCount() const override
+        {
+            return m_MipLevels;
+        }
+
+      private:
+        void Describe();
+
+        TextureSpecification m_Specification;
+        CubemapSpecification m_CubemapSpecification;
+        std::string m_Path; // first face, for the file ctor
+        u32 m_MipLevels = 1;
+        RHI::ScopedResourceHandle m_RHIHandle;
+    };
+
+    class NullTextureCubemapArray : public TextureCubemapArray
+    {
+      public:
+        explicit NullTextureCubemapArray(const CubemapArraySpecification& specification);
+        ~NullTextureCubemapArray() override;
+
+        [[nodiscard]] const TextureSpecification& GetSpecification() const override
+        {
+            return m_Specification;
+        }
+        [[nodiscard]] u32 GetWidth() const override
+        {
+            return m_Specification.Width;
+        }
+        [[nodiscard]] u32 GetHeight() const override
+        {
+            return m_Specification.Height;
+        }
+        // Diagnostics-only field: a native GL name does not exist here.
+        [[nodiscard]] u32 GetRendererID() const override
+        {
+            return 0;
+        }
+        [[nodiscard]] RHI::ResourceHandle GetRHIHandle() const override
+        {
+            return m_RHIHandle.Get();
+        }
+        [[nodiscard]] const std::string& GetPath() const override
+        {
+            return m_Path;
+        }
+
+        void SetData(void* data, u32 size) override;
+        void Invalidate(std::string_view path, u32 width, u32 height, const void* data, u32 channels) override;
+        void Bind(u32 slot) const override;
+        bool GetData(std::vector<u8>& outData, u32 mipLevel = 0) const override;
+
+        [[nodiscard]] bool IsLoaded() const override
+        {
+            return true;
+        }
+        [[nodiscard]] bool HasAlphaChannel() const override
+        {
+            return false;
+        }
+
+        [[nodiscard]] const CubemapArraySpecification& GetArraySpecification() const override
+        {
+            return m_ArraySpecification;
+        }
+        [[nodiscard]] u32 GetMipLevelCount() const override
+        {
+            return m_MipLevels;
+        }
+
+        bool SetLayerMipData(u32 layer, u32 mip, const void* data, sizet sizeBytes) override;
+        bool CopyLayerFromCubemap(u32 layer, const TextureCubemap& source) override;
+
+      private:
+        TextureSpecification m_Specification;
+        CubemapArraySpecification m_ArraySpecification;
+        std::string m_Path; // always empty: arrays are built, not loaded
+        u32 m_MipLevels = 1;
+        RHI::ScopedResourceHandle m_RHIHandle;
+    };
+
+    class NullTexture3D : public Texture3D
+    {
+      public:
+        explicit NullTexture3D(const Texture3DSpecification& specification);
+        ~NullTexture3D() override;
+
+        [[nodiscard]] u32 GetWidth() const override
+        {
+            return m_Specification.Width;
+        }
+        [[nodiscard]] u32 GetHeight() const override
+        {
+            return m_Specification.Height;
+        }
+        [[nodiscard]] u32 GetDepth() const override
+        {
+            return m_Specification.Depth;
+        }
+        // Diagnostics-only field: a native GL name does not exist here.
+        [[nodiscard]] u32 GetRendererID() const override
+        {
+            return 0;
+        }
+        [[nodiscard]] RHI::ResourceHandle GetRHIHandle() const override
+        {
+            return m_RHIHandle.Get();
+        }
+        [[nodiscard]] const Texture3DSpecification& GetSpecification() const override
+        {
+            return m_Specification;
+        }
+
+        void Bind(u32 slot) const override;
+
+      private:
+        Texture3DSpecification m_Specification;
+        RHI::ScopedResourceHandle m_RHIHandle;
+    };
+
+    class NullTexture2DArray : public Texture2DArray
+    {
+      public:
+        explicit NullTexture2DArray(const Texture2DArraySpecification& specification);
+        ~NullTexture2DArray() override;
+
+        [[nodiscard]] u32 GetWidth() const override
+        {
+            return m_Specification.Width;
+        }
+        [[nodiscard]] u32 GetHeight() const override
+        {
+            return m_Specification.Height;
+        }
+        [[nodiscard]] u32 GetLayers() const override
+        {
+            return m_Specification.Layers;
+        }
+        // Diagnostics-only field: a native GL name does not exist here.
+        [[nodiscard]] u32 GetRendererID() const override
+        {
+            return 0;
+        }
+        [[nodiscard]] RHI::ResourceHandle GetRHIHandle() const override
+        {
+            return m_RHIHandle.Get();
+        }
+        [[nodiscard]] const Texture2DArraySpecification& GetSpecification() const override
+        {
+            return m_Specification;
+        }
+
+        void Bind(u32 slot) const override;
+        void SetLayerData(u32 layer, const void* data, u32 width, u32 height) override;
+        void GenerateMipmaps() override
+        {
+        }
+
+      private:
+        Texture2DArraySpecification m_Specification;
+        RHI::ScopedResourceHandle m_RHIHandle;
+    };
+} // namespace OloEngine
@@ -4,6 +4,7 @@
 #include "OloEngine/Renderer/Commands/FrameResourceManager.h"
 #include "OloEngine/Renderer/Debug/RendererMemoryTracker.h"
 #include "OloEngine/Renderer/RendererAPI.h"
+#include "Platform/Null/NullTexture.h"
 
 #if OLO_WITH_VULKAN
 // OLO_WITH_VULKAN-guarded factory TU may see Platform/Vulkan/ headers (the
@@ -228,6 +229,10 @@ namespace OloEngine
                 OLO_CORE_ASSERT(false, "RendererAPI::None is currently not supported!");
                 return nullptr;
             }
+            case RendererAPI::API::Null:
+            {
+                return Ref<NullTexture2DArray>::Create(spec);
+            }
             case RendererAPI::API::Vulkan:
             {
 #if OLO_WITH_VULKAN
@@ -0,0 +1,377 @@
+#include "OloEnginePCH.h"
+#include <gtest/gtest.h>
+
+#include "OloEngine/Scene/Entity.h"
+#include "OloEngine/AI/BehaviorTree/BTBlackboard.h"
+#include "OloEngine/AI/BehaviorTree/BTCompiledTree.h"
+#include "OloEngine/AI/BehaviorTree/BTComposites.h"
+#include "OloEngine/AI/BehaviorTree/BTDecorators.h"
+#include "OloEngine/AI/BehaviorTree/BTTasks.h"
+#include "OloEngine/AI/BehaviorTree/BehaviorTree.h"
+#include "OloEngine/AI/BehaviorTree/BehaviorTreeAsset.h"
+
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// ============================================================================
+// BTCompiledTreeTest — unit test for interned blackboard keys and the flat
+// behaviour-tree form AISystem ticks for asset-driven agents.
+//
+// The compiled tree must be a drop-in for the RefCounted node classes: the
+// equivalence test builds random trees both ways from the same description
+// and ticks them side by side, comparing status and blackboard every frame.
+// ============================================================================
+
+using namespace OloEngine;
+
+namespace
+{
+    // Builds one random node (and its subtree) twice: as BTNodeData in `asset`
+    // and as the equivalent BTNode object, with matching parameters.
+    class RandomTreeBuilder
+    {
+      public:
+        explicit RandomTreeBuilder(u32 seed)
+            : m_Rng(seed)
+        {
+        }
+
+        Ref<BTNode> Build(BehaviorTreeAsset& asset, u32 depth, UUID& outId)
+        {
+            BTNodeData data;
+            data.ID = UUID(m_NextId++);
+            outId = data.ID;
+
+            // Leaves only at depth 3, so trees stay small enough to run out.
+            const i32 kind = depth >= 3 ? 7 + Pick(3) : Pick(10);
+            Ref<BTNode> node;
+            switch (kind)
+            {
+                case 0:
+                    data.TypeName = "Sequence";
+                    node = Ref<BTSequence>::Create();
+                    break;
+                case 1:
+                    data.TypeName = "Selector";
+                    node = Ref<BTSelector>::Create();
+                    break;
+                case 2:
+                {
+                    data.TypeName = "Parallel";
+                    auto parallel = Ref<BTParallel>::Create();
+                    if (Pick(2) != 0)
+                    {
+                        parallel->SuccessPolicy = BTParallel::Policy::RequireOne;
+                        data.Properties["SuccessPolicy"] = "RequireOne";
+                    }
+                    if (Pick(2) != 0)
+                    {
+                        parallel->FailurePolicy = BTParallel::Policy::RequireAll;
+                        data.Properties["FailurePolicy"] = "RequireAll";
+                    }
+                    node = parallel;
+                    break;
+                }
+                case 3:
+                    data.TypeName = "Inverter";
+                    node = Ref<BTInverter>::Create();
+                    break;
+                case 4:
+                {
+                    data.TypeName = "Repeater";
+                    auto repeater = Ref<BTRepeater>::Create();
+                    repeater->RepeatCount = static_cast<u32>(Pick(4));
+                    repeater->AbortOnFailure = Pick(2) != 0;
+                    data.Properties["RepeatCount"] = std::to_string(repeater->RepeatCount);
+                    data.Properties["AbortOnFailure"] = repeater->AbortOnFailure ? "true" : "false";
+                    node = repeater;
+                    break;
+                }
+                case 5:
+                {
+                    data.TypeName = "Cooldown";
+                    auto cooldown = Ref<BTCooldown>::Create();
+                    cooldown->CooldownTime = 0.05f * static_cast<f32>(Pick(5));
+                    data.Properties["CooldownTime"] = std::to_string(cooldown->CooldownTime);
+                    node = cooldown;
+                    break;
+                }
+                case 6:
+                {
+                    data.TypeName = "ConditionalGuard";
+                    auto guard = Ref<BTConditionalGuard>::Create();
+                    guard->BlackboardKey = RandomKey();
+                    const i32 expected = Pick(3);
+                    guard->ExpectedValue = expected;
+                    data.Properties["BlackboardKey"] = guard->BlackboardKey.Name;
+                    data.Properties["ExpectedValue"] = std::to_string(expected);
+                    node = guard;
+                    break;
+                }
+                case 7:
+                {
+                    data.TypeName = "Wait";
+                    auto wait = Ref<BTWait>::Create();
+                    wait->Duration = 0.02f * static_cast<f32>(Pick(5));
+                    data.Properties["Duration"] = std::to_string(wait->Duration);
+                    node = wait;
+                    break;
+                }
+                case 8:
+                {
+                    data.TypeName = "SetBlackboardValue";
+                    auto set = Ref<BTSetBlackboardValue>::Create();
+                    set->Key = RandomKey();
+                    const i32 value = Pick(3);
+                    set->ValueToSet = value;
+                    data.Properties["Key"] = set->Key.Name;
+                    data.Properties["ValueToSet"] = std::to_string(value);
+                    node = set;
+                    break;
+                }
+                default:
+                {
+                    data.TypeName = "CheckBlackboardKey";
+                    auto check = Ref<BTCheckBlackboardKey>::Create();
+                    check->Key = RandomKey();
+                    data.Properties["Key"] = check->Key.Name;
+                    if (Pick(2) != 0)
+                    {
+                        const i32 expected = Pick(3);
+                        check->ExpectedValue = BTBlackboard::Value(expected);
+                        data.Properties["ExpectedValue"] = std::to_string(expected);
+                    }
+                    node = check;
+                    break;
+                }
+            }
+
+            if (kind <= 6)
+            {
+                // Composites take 0-3 children, decorators usually one.
+                const i32 childCount = kind >= 3 ? 1 : Pick(4);
+                for (i32 i = 0; i < childCount; ++i)
+                {
+                    UUID childId;
+                    node->Children.push_back(Build(asset, depth + 1, childId));
+                    data.ChildIDs.push_back(childId);
+                }
+            }
+
+            asset.AddNode(std::move(data));
+            return node;
+        }
+
+        i32 Pick(i32 count)
+        {
+            return std::uniform_int_distribution<i32>(0, count - 1)(m_Rng);
+        }
+
+        std::string RandomKey()
+        {
+            return "CompiledTreeTest.k" + std::to_string(Pick(4));
+        }
+
+      private:
+        std::mt19937 m_Rng;
+        u64 m_NextId = 1;
+    };
+
+    BTNodeData MakeNode(u64 id, const char* type, std::vector<UUID> children = {})
+    {
+        BTNodeData data;
+        data.ID = UUID(id);
+        data.TypeName = type;
+        data.ChildIDs = std::move(children);
+        return data;
+    }
+} // namespace
+
+TEST(BTBlackboardKeyTest, InterningIsStableAndFindDoesNotIntern)
+{
+    const BlackboardKey a("CompiledTreeTest.Interned");
+    const BlackboardKey b("CompiledTreeTest.Interned");
+    EXPECT_TRUE(a.IsValid());
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(a.GetName(), "CompiledTreeTest.Interned");
+    EXPECT_EQ(BlackboardKey::Find("CompiledTreeTest.Interned"), a);
+
+    const u32 before = BlackboardKey::GetInternedCount();
+    EXPECT_FALSE(BlackboardKey::Find("CompiledTreeTest.NeverInterned").IsValid());
+    EXPECT_EQ(BlackboardKey::GetInternedCount(), before);
+}
+
+TEST(BTBlackboardKeyTest, KeyAndNameAccessSeeTheSameEntries)
+{
+    BTBlackboard bb;
+    const BlackboardKey health("CompiledTreeTest.Health");
+
+    bb.Set(health, 75.0f);
+    EXPECT_FLOAT_EQ(bb.Get<f32>("CompiledTreeTest.Health"), 75.0f);
+
+    bb.Set("CompiledTreeTest.Health", 20.0f);
+    EXPECT_FLOAT_EQ(bb.Get<f32>(health), 20.0f);
+    EXPECT_EQ(bb.GetSize(), 1u);
+
+    bb.Set("CompiledTreeTest.Alert", true);
+    bb.Remove(health);
+    EXPECT_FALSE(bb.Has("CompiledTreeTest.Health"));
+    EXPECT_TRUE(bb.Get<bool>("CompiledTreeTest.Alert"));
+    EXPECT_EQ(bb.GetAll().size(), 1u);
+}
+
+TEST(BTBlackboardKeyTest, EntryIndexSurvivesRemoveAndClear)
+{
+    BTBlackboard bb;
+    std::vector<BlackboardKey> keys;
+    for (i32 i = 0; i < 8; ++i)
+    {
+        keys.emplace_back("CompiledTreeTest.Slot" + std::to_string(i));
+        bb.Set(keys.back(), i);
+    }
+
+    // Removing from the front swaps the last entry in; every other key must
+    // still find its own value.
+    bb.Remove(keys[0]);
+    bb.Remove(keys[3]);
+    for (i32 i = 0; i < 8; ++i)
+    {
+        EXPECT_EQ(bb.Has(keys[i]), i != 0 && i != 3) << i;
+        if (i != 0 && i != 3)
+        {
+            EXPECT_EQ(bb.Get<i32>(keys[i], -1), i) << i;
+        }
+    }
+
+    bb.Clear();
+    EXPECT_EQ(bb.GetSize(), 0u);
+    bb.Set(keys[7], 70);
+    EXPECT_FALSE(bb.Has(keys[6]));
+    EXPECT_EQ(bb.Get<i32>(keys[7]), 70);
+
+    // A key another thread interned resolves to the same id here.
+    BlackboardKey fromOtherThread;
+    std::thread([&fromOtherThread] { fromOtherThread = BlackboardKey("CompiledTreeTest.OtherThread"); }).join();
+    EXPECT_EQ(BlackboardKey::Find("CompiledTreeTest.OtherThread"), fromOtherThread);
+
+    NamedBlackboardKey named = "CompiledTreeTest.Named";
+    EXPECT_EQ(named.Key, BlackboardKey::Find("CompiledTreeTest.Named"));
+    named = "CompiledTreeTest.Renamed";
+    EXPECT_EQ(named.Key.GetName(), "CompiledTreeTest.Renamed");
+}
+
+TEST(BTCompiledTreeTest, MatchesNodeClassesOnRandomTrees)
+{
+    constexpr u32 kTrees = 500;
+    constexpr u32 kFrames = 60;
+
+    RandomTreeBuilder builder(1234u);
+    for (u32 treeIndex = 0; treeIndex < kTrees; ++treeIndex)
+    {
+        auto asset = Ref<BehaviorTreeAsset>::Create();
+        UUID rootId;
+        BehaviorTree reference;
+        reference.SetRoot(builder.Build(*asset, 0, rootId));
+        asset->SetRootNodeID(rootId);
+
+        const Ref<BTCompiledTree> compiled = asset->GetCompiledTree();
+        ASSERT_TRUE(compiled) << "tree " << treeIndex;
+        ASSERT_EQ(compiled->GetNodeCount(), std::as_const(*asset).GetNodes().size());
+
+        BTBlackboard referenceBoard;
+        BTBlackboard compiledBoard;
+        std::vector<BTNodeState> state(compiled->GetNodeCount());
+        for (u32 frame = 0; frame < kFrames; ++frame)
+        {
+            // Outside writes now and then, so guards and checks flip.
+            if (builder.Pick(10) == 0)
+            {
+                const std::string key = builder.RandomKey();
+                const i32 value = builder.Pick(3);
+                referenceBoard.Set(key, value);
+                compiledBoard.Set(key, value);
+            }
+
+            const f32 dt = 0.01f * static_cast<f32>(1 + builder.Pick(3));
+            const BTStatus expected = reference.Tick(dt, referenceBoard, Entity{});
+            const BTStatus actual = compiled->Tick(state, dt, compiledBoard, BTAgentContext{});
+            ASSERT_EQ(actual, expected) << "tree " << treeIndex << " frame " << frame;
+            ASSERT_EQ(compiledBoard.GetAll(), referenceBoard.GetAll()) << "tree " << treeIndex << " frame " << frame;
+        }
+    }
+}
+
+TEST(BTCompiledTreeTest, LayoutIsPreOrderWithContiguousSubtrees)
+{
+    BehaviorTreeAsset asset;
+    asset.AddNode(MakeNode(1, "Selector", { UUID(2), UUID(4) }));
+    asset.AddNode(MakeNode(2, "Inverter", { UUID(3) }));
+    asset.AddNode(MakeNode(3, "Wait"));
+    asset.AddNode(MakeNode(4, "Wait"));
+    asset.SetRootNodeID(UUID(1));
+
+    const auto& compiled = asset.GetCompiledTree();
+    ASSERT_TRUE(compiled);
+    const auto& nodes = compiled->GetNodes();
+    ASSERT_EQ(nodes.size(), 4u);
+    EXPECT_EQ(nodes[0].FirstChild, 1u);
+    EXPECT_EQ(nodes[1].NextSibling, 3u);
+    EXPECT_EQ(nodes[1].SubtreeEnd, 3u);
+    EXPECT_EQ(nodes[0].SubtreeEnd, 4u);
+    EXPECT_EQ(nodes[0].ChildCount, 2u);
+    EXPECT_TRUE(compiled->Uses(BTCompiledTree::NodeKind::Wait));
+    EXPECT_FALSE(compiled->Uses(BTCompiledTree::NodeKind::MoveTo));
+}
+
+TEST(BTCompiledTreeTest, ParsesValuesByTypeHintOrLiteralShape)
+{
+    BehaviorTreeAsset asset;
+    asset.AddNode(MakeNode(1, "Sequence", { UUID(2), UUID(3), UUID(4) }));
+    auto position = MakeNode(2, "SetBlackboardValue");
+    position.Properties = { { "Key", "CompiledTreeTest.Home" }, { "ValueToSet", "(1, 2.5, -3)" } };
+    auto flag = MakeNode(3, "SetBlackboardValue");
+    flag.Properties = { { "Key", "CompiledTreeTest.Flag" }, { "ValueToSet", "1" } };
+    auto count = MakeNode(4, "SetBlackboardValue");
+    count.Properties = { { "Key", "CompiledTreeTest.Count" }, { "ValueToSet", "7" } };
+    asset.AddNode(position);
+    asset.AddNode(flag);
+    asset.AddNode(count);
+    asset.BlackboardKeyDefs["CompiledTreeTest.Flag"] = "bool";
+    asset.SetRootNodeID(UUID(1));
+
+    const auto& compiled = asset.GetCompiledTree();
+    ASSERT_TRUE(compiled);
+    std::vector<BTNodeState> state(compiled->GetNodeCount());
+    BTBlackboard bb;
+    EXPECT_EQ(compiled->Tick(state, 0.016f, bb, BTAgentContext{}), BTStatus::Success);
+
+    EXPECT_EQ(bb.Get<glm::vec3>("CompiledTreeTest.Home"), glm::vec3(1.0f, 2.5f, -3.0f));
+    EXPECT_TRUE(bb.Get<bool>("CompiledTreeTest.Flag")) << "the bool type hint must win over the integer shape";
+    EXPECT_EQ(bb.Get<i32>("CompiledTreeTest.Count"), 7);
+}
+
+TEST(BTCompiledTreeTest, RejectsUnknownTypesCyclesAndMissingChildren)
+{
+    BehaviorTreeAsset custom;
+    custom.AddNode(MakeNode(1, "GameSpecificNode"));
+    custom.SetRootNodeID(UUID(1));
+    EXPECT_FALSE(custom.GetCompiledTree());
+
+    BehaviorTreeAsset cycle;
+    cycle.AddNode(MakeNode(1, "Sequence", { UUID(2) }));
+    cycle.AddNode(MakeNode(2, "Selector", { UUID(1) }));
+    cycle.SetRootNodeID(UUID(1));
+    EXPECT_FALSE(cycle.GetCompiledTree());
+
+    BehaviorTreeAsset dangling;
+    dangling.AddNode(MakeNode(1, "Sequence", { UUID(9) }));
+    dangling.SetRootNodeID(UUID(1));
+    EXPECT_FALSE(dangling.GetCompiledTree());
+
+    // Editing the asset drops the failed result and recompiles.
+    dangling.AddNode(MakeNode(9, "Wait"));
+    EXPECT_TRUE(dangling.GetCompiledTree());
+}
@@ -3,13 +3,21 @@
 
 #include "OloEngine/AI/GOAP/GoapAction.h"
 #include "OloEngine/AI/GOAP/GoapAgent.h"
+#include "OloEngine/AI/GOAP/GoapDomain.h"
 #include "OloEngine/AI/GOAP/GoapGoal.h"
 #include "OloEngine/AI/GOAP/GoapPlanner.h"
 #include "OloEngine/AI/GOAP/GoapWorldState.h"
+#include "TestTaskWorkers.h"
 
+#include <chrono>
+#include <queue>
+#include <random>
 #include <string>
+#include <thread>
+#include <unordered_map>
 
 using namespace OloEngine;
+using OloEngine::Tests::EnsureTaskWorkers;
 
 namespace
 {
@@ -40,6 +48,79 @@ namespace
         g.DesiredState = std::move(desired);
         return g;
     }
+
+    // Tick a background-planning agent until its in-flight plan is collected.
+    // Update never waits on the task, so this is what "the next tick" means
+    // for a test that only cares about the plan.
+    void UpdateUntilPlanCollected(GoapAgent& agent)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+        while (agent.IsPlanPending() && std::chrono::steady_clock::now() < deadline)
+        {
+            agent.Update(0.016f, /*planInBackground=*/true);
+            if (agent.IsPlanPending())
+                std::this_thread::yield();
+        }
+    }
+
+    // Uniform-cost search over full GoapWorldStates: the cheapest cost to
+    // reach `goal`, or -1. The reference the packed planner is checked against.
+    f32 ReferenceCheapestCost(const GoapWorldState& start, const GoapWorldState& goal, const std::vector<GoapAction>& actions)
+    {
+        struct Hash
+        {
+            sizet operator()(const GoapWorldState& s) const
+            {
+                return static_cast<sizet>(s.Hash());
+            }
+        };
+        using Entry = std::pair<f32, GoapWorldState>;
+        auto greater = [](const Entry& a, const Entry& b)
+        { return a.first > b.first; };
+        std::priority_queue<Entry, std::vector<Entry>, decltype(greater)> open(greater);
+        std::unordered_map<GoapWorldState, f32, Hash> best;
+        open.push({ 0.0f, start });
+        best[start] = 0.0f;
+        while (!open.empty())
+        {
+            auto [cost, state] = open.top();
+            open.pop();
+            if (cost > best[state])
+                continue;
+            if (state.Satisfies(goal))
+                return cost;
+            for (const auto& action : actions)
+            {
+                if (!state.Satisfies(action.Preconditions))
+                    continue;
+                GoapWorldState next = state;
+                next.ApplyEffects(action.Effects);
+                const f32 nextCost = cost + action.Cost;
+                if (auto it = best.find(next); it == best.end() || nextCost < it->second)
+                {
+                    best[next] = nextCost;
+                    open.push({ nextCost, std::move(next) });
+                }
+            }
+        }
+        return -1.0f;
+    }
+
+    // Random facts over a few bool keys and two small-integer keys.
+    GoapWorldState RandomFacts(std::mt19937& rng, i32 maxFacts, const std::string& prefix)
+    {
+        GoapWorldState s;
+        const i32 count = std::uniform_int_distribution<i32>(0, maxFacts)(rng);
+        for (i32 i = 0; i < count; ++i)
+        {
+            const i32 key = std::uniform_int_distribution<i32>(0, 7)(rng);
+            if (key < 6)
+                s.Set(prefix + "flag" + std::to_string(key), std::uniform_int_distribution<i32>(0, 1)(rng) != 0);
+            else
+                s.Set(prefix + "count" + std::to_string(key), std::uniform_int_distribution<i32>(0, 3)(rng));
+        }
+        return s;
+    }
 } // namespace
 
 // ============================================================================
@@ -478,3 +559,213 @@ TEST(GoapAgent, NoSatisfiableGoalLeavesAgentIdle)
     EXPECT_TRUE(agent->CurrentGoalName().empty());
     EXPECT_EQ(agent->GoalsAchieved(), 0u);
 }
+
+// ============================================================================
+// GoapDomain
+// ============================================================================
+
+TEST(GoapDomain, PackedSearchFindsTheCheapestPlanOnRandomDomains)
+{
+    std::mt19937 rng(77u);
+    GoapPlannerSettings settings;
+    settings.HeuristicWeight = 0.0f; // both sides optimal, so costs must agree
+    settings.MaxIterations = 100000;
+
+    for (i32 trial = 0; trial < 300; ++trial)
+    {
+        std::vector<GoapAction> actions;
+        const i32 actionCount = std::uniform_int_distribution<i32>(1, 10)(rng);
+        for (i32 a = 0; a < actionCount; ++a)
+        {
+            const f32 cost = static_cast<f32>(std::uniform_int_distribution<i32>(0, 4)(rng));
+            actions.push_back(Action("A" + std::to_string(a), cost, RandomFacts(rng, 2, "rnd."), RandomFacts(rng, 2, "rnd.")));
+        }
+        const GoapWorldState start = RandomFacts(rng, 4, "rnd.");
+        const GoapGoal goal = Goal("G", RandomFacts(rng, 3, "rnd."));
+
+        ASSERT_TRUE(GoapDomain::Compile(actions, settings)) << "trial " << trial;
+        const GoapPlan plan = GoapPlanner::Plan(start, goal, actions, settings);
+        const f32 expected = ReferenceCheapestCost(start, goal.DesiredState, actions);
+
+        ASSERT_EQ(plan.Found, expected >= 0.0f) << "trial " << trial;
+        if (!plan.Found)
+            continue;
+        EXPECT_NEAR(plan.TotalCost, expected, 1e-4f) << "trial " << trial;
+
+        GoapWorldState sim = start;
+        for (const auto& step : plan.Steps)
+        {
+            ASSERT_TRUE(sim.Satisfies(step.Preconditions)) << "trial " << trial << ": " << step.Name << " not applicable";
+            sim.ApplyEffects(step.Effects);
+        }
+        EXPECT_TRUE(sim.Satisfies(goal.DesiredState)) << "trial " << trial;
+    }
+}
+
+TEST(GoapDomain, IntegerGoalOnAValueNoActionWritesHoldsOnlyFromTheStart)
+{
+    std::vector<GoapAction> actions = {
+        Action("Reload", 1.0f, GoapWorldState{}, State({ { "ammo", 3 } })),
+        Action("GetGun", 1.0f, GoapWorldState{}, State({ { "hasGun", true } })),
+    };
+    const GoapGoal goal = Goal("ArmedWithSeven", State({ { "hasGun", true }, { "ammo", 7 } }));
+
+    GoapPlan plan = GoapPlanner::Plan(State({ { "ammo", 7 } }), goal, actions);
+    ASSERT_TRUE(plan.Found);
+    ASSERT_EQ(plan.Length(), 1u);
+    EXPECT_EQ(plan.Steps[0].Name, "GetGun");
+
+    plan = GoapPlanner::Plan(State({ { "ammo", 5 } }), goal, actions);
+    EXPECT_FALSE(plan.Found);
+}
+
+TEST(GoapDomain, KeyUsedAsBothBoolAndIntFallsBackToGenericSearch)
+{
+    std::vector<GoapAction> actions = {
+        Action("Arm", 1.0f, GoapWorldState{}, State({ { "weapon", true } })),
+        Action("Upgrade", 1.0f, State({ { "weapon", true } }), State({ { "weapon", 2 } })),
+    };
+    EXPECT_FALSE(GoapDomain::Compile(actions, {}));
+
+    const GoapPlan plan = GoapPlanner::Plan(GoapWorldState{}, Goal("Upgraded", State({ { "weapon", 2 } })), actions);
+    ASSERT_TRUE(plan.Found);
+    EXPECT_EQ(plan.Length(), 2u);
+}
+
+TEST(GoapDomain, AgentsWithTheSameActionsShareOneDomainAndItsPlanCache)
+{
+    auto makeAgent = [](bool withHook)
+    {
+        auto agent = Ref<GoapAgent>::Create();
+        GoapAction getAxe = Action("GetAxe", 1.0f, GoapWorldState{}, State({ { "share.hasAxe", true } }));
+        // Execution hooks may differ; only planning data decides sharing.
+        if (withHook)
+            getAxe.Perform = [](f32)
+            { return GoapActionStatus::Running; };
+        agent->AddAction(getAxe);
+        agent->AddAction(Action("Chop", 1.0f, State({ { "share.hasAxe", true } }), State({ { "share.hasWood", true } })));
+        agent->AddGoal(Goal("Wood", State({ { "share.hasWood", true } })));
+        return agent;
+    };
+    auto first = makeAgent(true);
+    auto second = makeAgent(false);
+
+    ASSERT_TRUE(first->Domain());
+    EXPECT_EQ(first->Domain().Raw(), second->Domain().Raw());
+
+    first->Update(0.016f);
+    const GoapDomain::CacheStats before = first->Domain()->GetCacheStats();
+    second->Update(0.016f);
+    const GoapDomain::CacheStats after = first->Domain()->GetCacheStats();
+
+    EXPECT_EQ(after.Hits, before.Hits + 1) << "the second agent should be served from the first agent's plan";
+    EXPECT_EQ(after.Misses, before.Misses);
+    ASSERT_TRUE(second->HasPlan());
+    EXPECT_EQ(second->CurrentPlan().Length(), 2u);
+}
+
+TEST(GoapAgent, BackgroundReplanIsDeliveredOnceTheTaskFinishes)
+{
+    EnsureTaskWorkers();
+
+    auto agent = Ref<GoapAgent>::Create();
+    agent->AddAction(Action("GetAxe", 1.0f, GoapWorldState{}, State({ { "bg.hasAxe", true } })));
+    agent->AddAction(Action("ChopWood", 1.0f, State({ { "bg.hasAxe", true } }), State({ { "bg.hasFirewood", true } })));
+    agent->AddGoal(Goal("MakeFirewood", State({ { "bg.hasFirewood", true } })));
+    ASSERT_TRUE(agent->Domain());
+    agent->Domain()->ClearCache();
+
+    agent->Update(0.016f, /*planInBackground=*/true);
+    EXPECT_TRUE(agent->IsPlanPending());
+    EXPECT_FALSE(agent->HasPlan());
+    EXPECT_FALSE(agent->WorldState().Has("bg.hasAxe")) << "nothing may execute while the plan is in flight";
+
+    UpdateUntilPlanCollected(*agent); // the collecting tick also runs GetAxe
+    EXPECT_FALSE(agent->IsPlanPending());
+    EXPECT_EQ(agent->CurrentGoalName(), "MakeFirewood");
+    EXPECT_TRUE(agent->WorldState().GetOr<bool>("bg.hasAxe", false));
+
+    agent->Update(0.016f, /*planInBackground=*/true); // ChopWood
+    EXPECT_TRUE(agent->WorldState().GetOr<bool>("bg.hasFirewood", false));
+    EXPECT_EQ(agent->GoalsAchieved(), 1u);
+
+    // The same situation again is answered from the cache without a task.
+    agent->WorldState().Clear();
+    agent->Update(0.016f, /*planInBackground=*/true);
+    EXPECT_FALSE(agent->IsPlanPending());
+    EXPECT_TRUE(agent->WorldState().GetOr<bool>("bg.hasAxe", false));
+}
+
+TEST(GoapAgent, AbortDiscardsAnInFlightBackgroundPlan)
+{
+    EnsureTaskWorkers();
+
+    auto agent = Ref<GoapAgent>::Create();
+    agent->AddAction(Action("Drink", 1.0f, GoapWorldState{}, State({ { "abort.hydrated", true } })));
+    agent->AddGoal(Goal("Hydrate", State({ { "abort.hydrated", true } })));
+    agent->Domain()->ClearCache();
+
+    agent->Update(0.016f, /*planInBackground=*/true);
+    ASSERT_TRUE(agent->IsPlanPending());
+
+    // A new action changes the action indices the pending plan refers to.
+    agent->AddAction(Action("Sip", 0.5f, GoapWorldState{}, State({ { "abort.hydrated", true } })));
+    EXPECT_FALSE(agent->IsPlanPending());
+
+    agent->Update(0.016f, /*planInBackground=*/true); // replans, maybe from the cache
+    UpdateUntilPlanCollected(*agent);
+    agent->Update(0.016f, /*planInBackground=*/true);
+    EXPECT_TRUE(agent->WorldState().GetOr<bool>("abort.hydrated", false));
+}
+
+TEST(GoapAgent, UpdateDoesNotWaitForASlowBackgroundPlan)
+{
+    EnsureTaskWorkers();
+
+    // Eighteen independent facts, all needed before Finish applies: with the
+    // heuristic off the search settles every subset of them, some 2^18
+    // states, which takes far longer than a tick.
+    constexpr i32 kFacts = 18;
+    auto agent = Ref<GoapAgent>::Create();
+    agent->PlannerSettings.HeuristicWeight = 0.0f;
+    agent->PlannerSettings.MaxIterations = 1u << 22;
+    GoapWorldState allFacts;
+    for (i32 i = 0; i < kFacts; ++i)
+    {
+        const std::string fact = "slow.fact" + std::to_string(i);
+        agent->AddAction(Action("Learn" + std::to_string(i), 1.0f, GoapWorldState{}, State({ { fact.c_str(), true } })));
+        allFacts.Set(fact, true);
+    }
+    agent->AddAction(Action("Finish", 1.0f, allFacts, State({ { "slow.done", true } })));
+    agent->AddGoal(Goal("Done", State({ { "slow.done", true } })));
+    ASSERT_TRUE(agent->Domain());
+    agent->Domain()->ClearCache();
+
+    agent->Update(0.016f, /*planInBackground=*/true);
+    ASSERT_TRUE(agent->IsPlanPending());
+
+    // Had this tick waited for the task it would have collected the plan
+    // and run its first step.
+    agent->Update(0.016f, /*planInBackground=*/true);
+    EXPECT_TRUE(agent->IsPlanPending()) << "Update blocked on the planning task";
+    EXPECT_FALSE(agent->HasPlan());
+    EXPECT_FALSE(agent->WorldState().Has("slow.fact0"));
+
+    // Ticks while the task runs keep the agent idle rather than replanning
+    // over it, and the plan is adopted once it lands.
+    i32 ticks = 0;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    while (agent->IsPlanPending() && std::chrono::steady_clock::now() < deadline)
+    {
+        EXPECT_EQ(agent->WorldState().Size(), 0u) << "an action ran before the plan was collected";
+        agent->Update(0.016f, /*planInBackground=*/true);
+        ++ticks;
+        std::this_thread::yield();
+    }
+    ASSERT_FALSE(agent->IsPlanPending()) << "the planning task never finished";
+    ASSERT_TRUE(agent->HasPlan());
+    EXPECT_EQ(agent->CurrentGoalName(), "Done");
+    EXPECT_EQ(agent->CurrentPlan().Length(), static_cast<sizet>(kFacts + 1));
+    EXPECT_EQ(agent->CurrentStepIndex(), 1u) << "the collecting tick runs the first step";
+    EXPECT_GT(ticks, 0);
+}
@@ -0,0 +1,86 @@
+#include "OloEnginePCH.h"
+#include <gtest/gtest.h>
+
+#include "OloEngine/AI/Perception/PerceptionSystem.h"
+
+#include <array>
+#include <vector>
+
+// ============================================================================
+// PerceptionStaggerTest — unit test for the staggered sense schedule
+// (PerceptionSystem::IsSenseDue).
+//
+// A perceiver with a SenseInterval must sense exactly once per interval, and a
+// crowd of them must spread over the ticks of the interval rather than all
+// landing on the same one — the whole point of staggering. Both are pure
+// functions of (UUID, interval, clock, dt), so they are pinned here without a
+// Scene; the sensor pass itself is covered on the Functional axis.
+// ============================================================================
+
+using namespace OloEngine;
+
+namespace
+{
+    constexpr f32 kDt = 1.0f / 60.0f;
+
+    // Ticks (out of `ticks`) on which `perceiver` is due, driving the clock the
+    // way PerceptionSystem::OnUpdate does: advanced by dt before the test.
+    u32 CountSenses(UUID perceiver, f32 interval, u32 ticks)
+    {
+        u32 senses = 0;
+        f64 clock = 0.0;
+        for (u32 tick = 0; tick < ticks; ++tick)
+        {
+            clock += static_cast<f64>(kDt);
+            senses += PerceptionSystem::IsSenseDue(perceiver, interval, clock, kDt) ? 1u : 0u;
+        }
+        return senses;
+    }
+} // namespace
+
+TEST(PerceptionStaggerTest, ZeroIntervalSensesEveryTick)
+{
+    EXPECT_EQ(CountSenses(UUID(42), 0.0f, 120), 120u);
+}
+
+TEST(PerceptionStaggerTest, IntervalShorterThanTickSensesEveryTick)
+{
+    EXPECT_EQ(CountSenses(UUID(42), kDt * 0.5f, 120), 120u);
+}
+
+TEST(PerceptionStaggerTest, SensesOncePerInterval)
+{
+    // 4 s at 60 Hz with a 0.25 s interval: 16 senses, whatever the phase.
+    for (u64 id = 1; id <= 64; ++id)
+    {
+        EXPECT_EQ(CountSenses(UUID(id * 7919u), 0.25f, 240), 16u) << "UUID " << id * 7919u;
+    }
+}
+
+TEST(PerceptionStaggerTest, ConsecutiveUuidsSpreadAcrossTheInterval)
+{
+    // 0.5 s at 60 Hz is 30 ticks. 300 perceivers sensing once each over those
+    // ticks average 10 per tick; without staggering one tick would take all
+    // 300. Allow generous slack around the average.
+    constexpr u32 kPerceivers = 300;
+    constexpr u32 kTicks = 30;
+    std::array<u32, kTicks> perTick{};
+
+    f64 clock = 0.0;
+    for (u32 tick = 0; tick < kTicks; ++tick)
+    {
+        clock += static_cast<f64>(kDt);
+        for (u64 id = 1; id <= kPerceivers; ++id)
+        {
+            perTick[tick] += PerceptionSystem::IsSenseDue(UUID(id), 0.5f, clock, kDt) ? 1u : 0u;
+        }
+    }
+
+    u32 total = 0;
+    for (const u32 count : perTick)
+    {
+        total += count;
+        EXPECT_LE(count, 25u);
+    }
+    EXPECT_EQ(total, kPerceivers) << "every perceiver senses exactly once per interval";
+}
@@ -0,0 +1,312 @@
+#include "OloEnginePCH.h"
+
+// OLO_TEST_LAYER: unit
+// =============================================================================
+// AssetPackBuilderTest — AssetPackBuilder end to end, from a registry to a pack
+// the runtime reads back.
+//
+// Pins:
+//   1. A pack serialized on the building thread alone and one serialized across
+//      the worker pool are byte-identical.
+//   2. Every payload offset the builder lays out is where AssetPack::Load and
+//      RuntimeAssetManager find the payload, with and without a script module
+//      ahead of the payloads (the offsets once used sizeof(AssetInfo), 32 bytes
+//      against 28 written, and always counted the module).
+//   3. An incremental rebuild after one source changes re-serializes that asset
+//      alone and copies every other payload byte-for-byte from the previous pack.
+//   4. A missing or mismatched `.manifest` makes an incremental build a full one.
+//
+// The assets are ScriptFile assets: file-backed, CPU-only and serialized to the
+// same bytes every time, so the whole suite runs headless.
+// =============================================================================
+
+#include <gtest/gtest.h>
+#include "TestTaskWorkers.h"
+#include "TestTempDir.h"
+
+#include "OloEngine/Asset/Asset.h"
+#include "OloEngine/Asset/AssetManager/EditorAssetManager.h"
+#include "OloEngine/Asset/AssetManager/RuntimeAssetManager.h"
+#include "OloEngine/Asset/AssetPack.h"
+#include "OloEngine/Asset/AssetPackBuilder.h"
+#include "OloEngine/Asset/AssetRegistry.h"
+#include "OloEngine/Project/Project.h"
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace OloEngine; // NOLINT(google-build-using-namespace) — test file
+using OloEngine::Tests::EnsureTaskWorkers;
+
+namespace
+{
+    namespace fs = std::filesystem;
+
+    constexpr u32 s_ScriptCount = 16;
+    constexpr u64 s_FirstHandle = 0xB1D0000ULL;
+
+    std::vector<char> ReadBytes(const fs::path& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        return { std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+    }
+
+    AssetHandle ScriptHandle(u32 index)
+    {
+        return static_cast<AssetHandle>(s_FirstHandle + index);
+    }
+
+    std::string ScriptClassName(u32 index, u32 revision)
+    {
+        return "Script" + std::to_string(index) + "Rev" + std::to_string(revision);
+    }
+} // namespace
+
+class AssetPackBuilderTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        EnsureTaskWorkers();
+
+        m_TempDir = OloEngine::Tests::TempDir();
+        std::error_code ec;
+        fs::create_directories(m_TempDir / "Assets", ec);
+        fs::create_directories(m_TempDir / "Sources", ec);
+        ASSERT_FALSE(ec) << "Failed to create temp dir: " << ec.message();
+
+        // A stand-in script module: its bytes sit between the index and the payloads.
+        m_ModulePath = m_TempDir / "Module.dll";
+        {
+            std::ofstream module(m_ModulePath, std::ios::binary);
+            module << "not-really-a-dll:37-bytes-of-module-data";
+        }
+
+        const fs::path projectFile = m_TempDir / "Test.oloproj";
+        {
+            std::ofstream proj(projectFile);
+            proj << "Project:\n"
+                    "  Name: AssetPackBuilderTest\n"
+                    "  StartScene: \"\"\n"
+                    "  AssetDirectory: \"Assets\"\n"
+                    "  ScriptModulePath: \""
+                 << m_ModulePath.generic_string() << "\"\n";
+        }
+        ASSERT_TRUE(Project::Load(projectFile))
+            << "Project::Load failed for temp project at " << m_TempDir.string();
+
+        m_AssetManager = Ref<EditorAssetManager>::Create();
+        m_AssetManager->Initialize(/*startFileWatcher=*/false);
+        Project::SetAssetManager(m_AssetManager);
+
+        // Sources live outside the asset directory so Initialize's scan never
+        // registers them a second time under other handles.
+        for (u32 i = 0; i < s_ScriptCount; ++i)
+        {
+            WriteScript(i, 0);
+            AssetMetadata metadata(ScriptHandle(i), AssetType::ScriptFile, fs::path("Sources") / ("Script" + std::to_string(i) + ".cs"));
+            m_AssetManager->SetMetadata(metadata.Handle, metadata);
+            m_Registry.AddAsset(metadata);
+        }
+    }
+
+    void TearDown() override
+    {
+        m_AssetManager.Reset();
+        std::error_code ec;
+        fs::remove_all(m_TempDir, ec);
+    }
+
+    void WriteScript(u32 index, u32 revision) const
+    {
+        std::ofstream file(m_TempDir / "Sources" / ("Script" + std::to_string(index) + ".cs"), std::ios::trunc);
+        file << "ScriptFile:\n"
+                "  ClassNamespace: PackTest\n"
+                "  ClassName: "
+             << ScriptClassName(index, revision) << "\n";
+    }
+
+    AssetPackBuilder::BuildSettings Settings(const fs::path& output) const
+    {
+        AssetPackBuilder::BuildSettings settings;
+        settings.m_OutputPath = output;
+        settings.m_IncludeLocalizationFiles = false;
+        return settings;
+    }
+
+    AssetPackBuilder::BuildResult Build(const AssetPackBuilder::BuildSettings& settings) const
+    {
+        std::atomic<f32> progress = 0.0f;
+        AssetPackBuilder::BuildResult result = AssetPackBuilder::BuildFromRegistry(m_Registry, settings, progress);
+        EXPECT_TRUE(result.m_Success) << result.m_ErrorMessage;
+        EXPECT_FLOAT_EQ(progress.load(), 1.0f);
+        return result;
+    }
+
+    // The raw payload of `handle` as the pack's index addresses it.
+    static std::vector<char> PayloadBytes(const fs::path& packPath, AssetHandle handle)
+    {
+        Ref<AssetPack> pack = AssetPack::Create();
+        const AssetPackLoadResult load = pack->Load(packPath);
+        EXPECT_TRUE(load.Success) << load.ErrorMessage;
+        const auto info = pack->GetAssetInfo(handle);
+        if (!info)
+        {
+            ADD_FAILURE() << "asset " << static_cast<u64>(handle) << " missing from " << packPath.string();
+            return {};
+        }
+
+        const std::vector<char> bytes = ReadBytes(packPath);
+        EXPECT_LE(info->PackedOffset + info->PackedSize, bytes.size());
+        if (info->PackedOffset + info->PackedSize > bytes.size())
+            return {};
+        return { bytes.begin() + static_cast<std::ptrdiff_t>(info->PackedOffset),
+                 bytes.begin() + static_cast<std::ptrdiff_t>(info->PackedOffset + info->PackedSize) };
+    }
+
+    // Every script resolves, through the runtime manager, to the class it was cooked from.
+    static void ExpectPackResolves(const fs::path& packPath, const std::vector<u32>& revisions)
+    {
+        RuntimeAssetManager runtime(/*autoLoadDefaultPack=*/false);
+        ASSERT_TRUE(runtime.LoadAssetPack(packPath));
+        for (u32 i = 0; i < s_ScriptCount; ++i)
+        {
+            Ref<Asset> asset = runtime.GetAsset(ScriptHandle(i));
+            ASSERT_TRUE(asset) << "script " << i;
+            ASSERT_EQ(asset->GetAssetType(), AssetType::ScriptFile);
+            const Ref<ScriptFileAsset> script = asset.As<ScriptFileAsset>();
+            EXPECT_EQ(script->GetClassNamespace(), "PackTest");
+            EXPECT_EQ(script->GetClassName(), ScriptClassName(i, revisions[i]));
+        }
+    }
+
+    fs::path m_TempDir;
+    fs::path m_ModulePath;
+    Ref<EditorAssetManager> m_AssetManager;
+    AssetRegistry m_Registry;
+};
+
+TEST_F(AssetPackBuilderTest, ParallelAndSingleThreadedBuildsAreByteIdentical)
+{
+    AssetPackBuilder::BuildSettings serial = Settings(m_TempDir / "Out" / "Serial.olopack");
+    serial.m_MaxConcurrentAssets = 1;
+    AssetPackBuilder::BuildSettings parallel = Settings(m_TempDir / "Out" / "Parallel.olopack");
+    parallel.m_MaxConcurrentAssets = 0;
+
+    const auto serialResult = Build(serial);
+    const auto parallelResult = Build(parallel);
+    EXPECT_EQ(serialResult.m_AssetCount, s_ScriptCount);
+    EXPECT_EQ(parallelResult.m_SerializedAssetCount, s_ScriptCount);
+
+    const std::vector<char> serialBytes = ReadBytes(serial.m_OutputPath);
+    ASSERT_FALSE(serialBytes.empty());
+    EXPECT_EQ(serialBytes, ReadBytes(parallel.m_OutputPath));
+}
+
+TEST_F(AssetPackBuilderTest, PayloadOffsetsResolveThroughTheRuntime)
+{
+    const std::vector<u32> revisions(s_ScriptCount, 0);
+    for (const bool includeModule : { true, false })
+    {
+        SCOPED_TRACE(includeModule ? "with script module" : "without script module");
+        AssetPackBuilder::BuildSettings settings = Settings(m_TempDir / "Out" / (includeModule ? "Module.olopack" : "NoModule.olopack"));
+        settings.m_IncludeScriptModule = includeModule;
+        (void)Build(settings);
+
+        // The first payload starts right after the module: header, index, 28-byte
+        // asset records, the u32 module size and the module itself.
+        Ref<AssetPack> pack = AssetPack::Create();
+        ASSERT_TRUE(pack->Load(settings.m_OutputPath).Success);
+        const u64 headerAndIndex = 24 + 24;
+        const u64 records = s_ScriptCount * (sizeof(AssetHandle) + 2 * sizeof(u64) + sizeof(AssetType) + sizeof(u16));
+        const u64 module = sizeof(u32) + (includeModule ? fs::file_size(m_ModulePath) : 0);
+        const auto first = pack->GetAssetInfo(ScriptHandle(0));
+        ASSERT_TRUE(first);
+        EXPECT_EQ(first->PackedOffset, headerAndIndex + records + module);
+        pack->Unload();
+
+        ExpectPackResolves(settings.m_OutputPath, revisions);
+    }
+}
+
+TEST_F(AssetPackBuilderTest, IncrementalRebuildReserializesOnlyTheChangedAsset)
+{
+    AssetPackBuilder::BuildSettings settings = Settings(m_TempDir / "Out" / "Game.olopack");
+    settings.m_Incremental = true;
+
+    const auto first = Build(settings);
+    EXPECT_EQ(first.m_SerializedAssetCount, s_ScriptCount);
+    EXPECT_EQ(first.m_ReusedAssetCount, 0u);
+
+    // Keep the first pack's payloads to compare against; the rebuild replaces it.
+    std::vector<std::vector<char>> previousPayloads;
+    for (u32 i = 0; i < s_ScriptCount; ++i)
+        previousPayloads.push_back(PayloadBytes(settings.m_OutputPath, ScriptHandle(i)));
+
+    constexpr u32 changed = 5;
+    WriteScript(changed, 1);
+    ASSERT_TRUE(m_AssetManager->ReloadData(ScriptHandle(changed)));
+
+    const auto second = Build(settings);
+    EXPECT_EQ(second.m_SerializedAssetCount, 1u);
+    EXPECT_EQ(second.m_ReusedAssetCount, s_ScriptCount - 1);
+
+    for (u32 i = 0; i < s_ScriptCount; ++i)
+    {
+        const std::vector<char> payload = PayloadBytes(settings.m_OutputPath, ScriptHandle(i));
+        if (i == changed)
+            EXPECT_NE(payload, previousPayloads[i]) << "the changed script kept its old payload";
+        else
+            EXPECT_EQ(payload, previousPayloads[i]) << "script " << i;
+    }
+
+    std::vector<u32> revisions(s_ScriptCount, 0);
+    revisions[changed] = 1;
+    ExpectPackResolves(settings.m_OutputPath, revisions);
+}
+
+TEST_F(AssetPackBuilderTest, IncrementalRebuildWithoutManifestIsAFullBuild)
+{
+    AssetPackBuilder::BuildSettings settings = Settings(m_TempDir / "Out" / "Game.olopack");
+    settings.m_Incremental = true;
+    (void)Build(settings);
+
+    fs::path manifest = settings.m_OutputPath;
+    manifest += ".manifest";
+    ASSERT_TRUE(fs::exists(manifest));
+    fs::remove(manifest);
+
+    const auto rebuilt = Build(settings);
+    EXPECT_EQ(rebuilt.m_SerializedAssetCount, s_ScriptCount);
+    EXPECT_EQ(rebuilt.m_ReusedAssetCount, 0u);
+    EXPECT_TRUE(fs::exists(manifest)) << "the full build must leave a manifest for the next one";
+    ExpectPackResolves(settings.m_OutputPath, std::vector<u32>(s_ScriptCount, 0));
+}
+
+TEST_F(AssetPackBuilderTest, IncrementalRebuildWithMismatchedManifestIsAFullBuild)
+{
+    AssetPackBuilder::BuildSettings settings = Settings(m_TempDir / "Out" / "Game.olopack");
+    settings.m_Incremental = true;
+    (void)Build(settings);
+
+    // The manifest records the size of the pack it describes (after a u32 magic and
+    // a u32 version); make it describe some other pack.
+    fs::path manifest = settings.m_OutputPath;
+    manifest += ".manifest";
+    {
+        std::fstream file(manifest, std::ios::binary | std::ios::in | std::ios::out);
+        ASSERT_TRUE(file.is_open());
+        const u64 otherPackSize = fs::file_size(settings.m_OutputPath) + 1;
+        file.seekp(2 * sizeof(u32));
+        file.write(reinterpret_cast<const char*>(&otherPackSize), sizeof(otherPackSize));
+    }
+
+    const auto rebuilt = Build(settings);
+    EXPECT_EQ(rebuilt.m_SerializedAssetCount, s_ScriptCount);
+    EXPECT_EQ(rebuilt.m_ReusedAssetCount, 0u);
+    ExpectPackResolves(settings.m_OutputPath, std::vector<u32>(s_ScriptCount, 0));
+}
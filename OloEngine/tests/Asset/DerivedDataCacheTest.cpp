@@ -0,0 +1,236 @@
+#include "OloEnginePCH.h"
+
+// OLO_TEST_LAYER: unit
+// =============================================================================
+// DerivedDataCacheTest — the content-addressed cache every offline cooker shares.
+//
+// Pins:
+//   1. Store -> Load returns the blob bit-exactly, from a sharded
+//      <root>/<2 hex>/<32 hex>.ddc entry, and no temp file is left beside it.
+//   2. Keys are length-delimited and cover every input: cooker name, version,
+//      content and segmentation all change the key; -0.0f and +0.0f do not.
+//   3. A damaged entry is a miss (never a wrong blob) and is deleted.
+//   4. Past the size bound the least recently USED entry goes first — a Load
+//      refreshes recency, not just a Store.
+//   5. A second cache on the same root (the next editor run) indexes what the
+//      first left behind and hits on it.
+//
+// Every case builds its own cache over its own TempDir(), so none of this
+// touches DerivedDataCache::Get().
+// =============================================================================
+
+#include <gtest/gtest.h>
+#include "TestTempDir.h"
+
+#include "OloEngine/Asset/DerivedDataCache.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+using namespace OloEngine; // NOLINT(google-build-using-namespace) — test file
+
+namespace
+{
+    std::vector<u8> MakePayload(sizet size, u8 seed)
+    {
+        std::vector<u8> bytes(size);
+        for (sizet i = 0; i < size; ++i)
+        {
+            bytes[i] = static_cast<u8>((i * 31 + seed * 7) & 0xFF);
+        }
+        return bytes;
+    }
+
+    DerivedDataKey KeyFor(u32 value)
+    {
+        return DerivedDataKeyBuilder("DerivedDataCacheTest", 1).AppendValue(value).Build();
+    }
+
+    // Recency is the file clock; keep consecutive operations on distinct ticks on
+    // platforms with a coarse one.
+    void NextTick()
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+} // namespace
+
+TEST(DerivedDataCache, StoreThenLoadRoundTrips)
+{
+    const std::filesystem::path root = OloEngine::Tests::TempDir();
+    DerivedDataCache cache(root);
+
+    const DerivedDataKey key = KeyFor(7);
+    const std::vector<u8> payload = MakePayload(4096, 3);
+    ASSERT_TRUE(cache.Store(key, payload));
+
+    std::vector<u8> loaded;
+    ASSERT_TRUE(cache.Load(key, loaded));
+    EXPECT_EQ(loaded, payload);
+
+    const std::filesystem::path entry = cache.GetEntryPath(key);
+    const std::string name = key.ToString();
+    EXPECT_EQ(entry, root / name.substr(0, 2) / (name + ".ddc"));
+    EXPECT_TRUE(std::filesystem::is_regular_file(entry));
+    for (const auto& file : std::filesystem::directory_iterator(entry.parent_path()))
+    {
+        EXPECT_EQ(file.path(), entry) << "stray file beside the entry: " << file.path().string();
+    }
+
+    std::vector<u8> missing;
+    EXPECT_FALSE(cache.Load(KeyFor(8), missing));
+
+    const DerivedDataCache::Statistics stats = cache.GetStatistics();
+    EXPECT_EQ(stats.Hits, 1u);
+    EXPECT_EQ(stats.Misses, 1u);
+    EXPECT_EQ(stats.Stores, 1u);
+    EXPECT_EQ(stats.EntryCount, 1u);
+}
+
+TEST(DerivedDataCache, KeysCoverEveryInput)
+{
+    const auto key = [](std::string_view cooker, u32 version, std::string_view a, std::string_view b)
+    {
+        return DerivedDataKeyBuilder(cooker, version).Append(a).Append(b).Build();
+    };
+
+    const DerivedDataKey base = key("Cooker", 1, "ab", "c");
+    EXPECT_EQ(base, key("Cooker", 1, "ab", "c"));
+    EXPECT_NE(base, key("Other", 1, "ab", "c"));
+    EXPECT_NE(base, key("Cooker", 2, "ab", "c"));
+    EXPECT_NE(base, key("Cooker", 1, "ab", "d"));
+    EXPECT_NE(base, key("Cooker", 1, "a", "bc"));
+    EXPECT_NE(base, key("Cooker", 1, "abc", ""));
+
+    // A change past the first 8-byte word, and in the tail word, both count.
+    const std::string longText(100, 'x');
+    std::string changedMiddle = longText;
+    changedMiddle[50] = 'y';
+    std::string changedTail = longText;
+    changedTail[99] = 'y';
+    EXPECT_NE(key("Cooker", 1, longText, ""), key("Cooker", 1, changedMiddle, ""));
+    EXPECT_NE(key("Cooker", 1, longText, ""), key("Cooker", 1, changedTail, ""));
+
+    EXPECT_EQ(DerivedDataKeyBuilder("Cooker", 1).AppendValue(0.0f).Build(),
+              DerivedDataKeyBuilder("Cooker", 1).AppendValue(-0.0f).Build());
+    EXPECT_NE(DerivedDataKeyBuilder("Cooker", 1).AppendValue(1.0f).Build(),
+              DerivedDataKeyBuilder("Cooker", 1).AppendValue(-1.0f).Build());
+    EXPECT_NE(DerivedDataKeyBuilder("Cooker", 1).AppendValue(true).Build(),
+              DerivedDataKeyBuilder("Cooker", 1).AppendValue(false).Build());
+
+    EXPECT_EQ(base.ToString().size(), 32u);
+}
+
+TEST(DerivedDataCache, DamagedEntryIsAMissAndIsRemoved)
+{
+    DerivedDataCache cache(OloEngine::Tests::TempDir());
+
+    const DerivedDataKey key = KeyFor(1);
+    ASSERT_TRUE(cache.Store(key, MakePayload(512, 9)));
+    const std::filesystem::path entry = cache.GetEntryPath(key);
+
+    {
+        std::fstream file(entry, std::ios::binary | std::ios::in | std::ios::out);
+        ASSERT_TRUE(file.is_open());
+        file.seekp(300);
+        const char flipped = '\x5A';
+        file.write(&flipped, 1);
+    }
+
+    std::vector<u8> loaded;
+    EXPECT_FALSE(cache.Load(key, loaded));
+    EXPECT_TRUE(loaded.empty());
+    EXPECT_FALSE(std::filesystem::exists(entry));
+    EXPECT_EQ(cache.GetStatistics().EntryCount, 0u);
+
+    // Truncated to less than a header is the same miss.
+    ASSERT_TRUE(cache.Store(key, MakePayload(512, 9)));
+    std::filesystem::resize_file(entry, 10);
+    EXPECT_FALSE(cache.Load(key, loaded));
+    EXPECT_FALSE(std::filesystem::exists(entry));
+}
+
+TEST(DerivedDataCache, EvictsLeastRecentlyUsedPastTheBound)
+{
+    // Four 1000-byte payloads do not fit in 3500 bytes; three do.
+    DerivedDataCache cache(OloEngine::Tests::TempDir(), 3500);
+
+    const DerivedDataKey a = KeyFor(100);
+    const DerivedDataKey b = KeyFor(101);
+    const DerivedDataKey c = KeyFor(102);
+    const DerivedDataKey d = KeyFor(103);
+
+    ASSERT_TRUE(cache.Store(a, MakePayload(1000, 1)));
+    NextTick();
+    ASSERT_TRUE(cache.Store(b, MakePayload(1000, 2)));
+    NextTick();
+    ASSERT_TRUE(cache.Store(c, MakePayload(1000, 3)));
+    NextTick();
+
+    // Reading A makes B the oldest.
+    std::vector<u8> loaded;
+    ASSERT_TRUE(cache.Load(a, loaded));
+    NextTick();
+
+    ASSERT_TRUE(cache.Store(d, MakePayload(1000, 4)));
+
+    EXPECT_TRUE(cache.Contains(a));
+    EXPECT_FALSE(cache.Contains(b));
+    EXPECT_TRUE(cache.Contains(c));
+    EXPECT_TRUE(cache.Contains(d));
+
+    const DerivedDataCache::Statistics stats = cache.GetStatistics();
+    EXPECT_EQ(stats.Evictions, 1u);
+    EXPECT_LE(stats.TotalBytes, cache.GetMaxBytes());
+
+    // Lowering the bound evicts at once, oldest first.
+    cache.SetMaxBytes(1200);
+    EXPECT_EQ(cache.GetStatistics().EntryCount, 1u);
+    EXPECT_TRUE(cache.Contains(d)) << "the most recently used entry should be the one kept";
+}
+
+TEST(DerivedDataCache, SecondCacheOnTheSameRootSeesEarlierEntries)
+{
+    const std::filesystem::path root = OloEngine::Tests::TempDir();
+    const std::vector<u8> payload = MakePayload(2048, 5);
+    {
+        DerivedDataCache first(root);
+        ASSERT_TRUE(first.Store(KeyFor(1), payload));
+        ASSERT_TRUE(first.Store(KeyFor(2), MakePayload(64, 6)));
+    }
+
+    DerivedDataCache second(root);
+    const DerivedDataCache::Statistics stats = second.GetStatistics();
+    EXPECT_EQ(stats.EntryCount, 2u);
+    EXPECT_GT(stats.TotalBytes, payload.size());
+
+    std::vector<u8> loaded;
+    ASSERT_TRUE(second.Load(KeyFor(1), loaded));
+    EXPECT_EQ(loaded, payload);
+
+    second.Clear();
+    EXPECT_FALSE(second.Contains(KeyFor(1)));
+    EXPECT_EQ(second.GetStatistics().EntryCount, 0u);
+    EXPECT_TRUE(std::filesystem::is_directory(root)) << "Clear removes the entries, not the root";
+}
+
+TEST(DerivedDataCache, DisabledCacheNeitherStoresNorLoads)
+{
+    DerivedDataCache cache(OloEngine::Tests::TempDir());
+    const DerivedDataKey key = KeyFor(1);
+    ASSERT_TRUE(cache.Store(key, MakePayload(16, 1)));
+
+    cache.SetEnabled(false);
+    EXPECT_FALSE(cache.IsEnabled());
+    std::vector<u8> loaded;
+    EXPECT_FALSE(cache.Load(key, loaded));
+    EXPECT_FALSE(cache.Store(KeyFor(2), MakePayload(16, 2)));
+
+    cache.SetEnabled(true);
+    EXPECT_TRUE(cache.Load(key, loaded));
+    EXPECT_FALSE(cache.Contains(KeyFor(2)));
+
+    EXPECT_FALSE(DerivedDataCache(std::filesystem::path{}).IsEnabled()) << "an empty root disables the cache";
+}
@@ -0,0 +1,133 @@
+// OLO_TEST_LAYER: unit
+#include "OloEnginePCH.h"
+#include "../TestTaskWorkers.h"
+#include <gtest/gtest.h>
+
+// =============================================================================
+// CPUFluidSolverBenchmarkTest
+//
+// Particle-steps per second through the CPU Position-Based Fluids solver at
+// headless-server pool sizes (100k and 500k): the parallel mode on the worker
+// pool, with the serial reference timed once at 100k for the speedup. Every
+// result is checked finite; throughput floors only under --olo-bench-assert.
+// =============================================================================
+
+#include "OloEngine/Fluid/CPUFluidSolver.h"
+#include "OloEngine/Fluid/FluidSolverTypes.h"
+#include "OloEngine/Task/NamedThreads.h"
+#include "OloEngine/Task/Scheduler.h"
+
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+using namespace OloEngine; // NOLINT(google-build-using-namespace) — test file
+using OloEngine::Tests::BenchAssertEnabled;
+using OloEngine::Tests::SecondsSince;
+using OloEngine::Tests::EnsureTaskWorkers;
+
+namespace
+{
+    using Clock = std::chrono::high_resolution_clock;
+
+    constexpr f32 kDt = 1.0f / 60.0f;
+    constexpr u32 kTimedSteps = 3;
+
+    // h = 0.1 m; the domain is sized so the 500k block (80^3 at rest spacing)
+    // fits with room to slump.
+    FluidSolverParams MakePoolParams()
+    {
+        FluidSolverParams params;
+        params.BoundsMin = { -3.0f, 0.0f, -3.0f };
+        params.BoundsMax = { 3.0f, 6.0f, 3.0f };
+        params.ParticleRadius = 0.025f;
+        params.SolverIterations = 4;
+        return params;
+    }
+
+    // A cube block at rest spacing on the floor; Emit clamps it to capacity.
+    void FillBlock(CPUFluidSolver& solver, const FluidSolverParams& params)
+    {
+        const f32 spacing = params.Spacing();
+        const auto side = static_cast<u32>(std::ceil(std::cbrt(static_cast<f64>(solver.GetMaxParticles()))));
+        const glm::vec3 origin(-0.5f * spacing * static_cast<f32>(side), 0.0f, -0.5f * spacing * static_cast<f32>(side));
+
+        std::vector<GPUFluidEmitEntry> entries;
+        entries.reserve(static_cast<sizet>(side) * side * side);
+        for (u32 y = 0; y < side; ++y)
+        {
+            for (u32 z = 0; z < side; ++z)
+            {
+                for (u32 x = 0; x < side; ++x)
+                {
+                    GPUFluidEmitEntry entry{};
+                    entry.Position = glm::vec4(origin + (glm::vec3(x, y, z) + 0.5f) * spacing, 0.0f);
+                    entry.Velocity = glm::vec4(0.0f);
+                    entries.push_back(entry);
+                }
+            }
+        }
+        solver.Emit(entries);
+    }
+
+    struct StepTiming
+    {
+        f64 SecondsPerStep = 0.0;
+        bool Finite = true;
+    };
+
+    StepTiming TimeSteps(CPUFluidSolver& solver, const FluidSolverParams& params, u32 steps)
+    {
+        const Clock::time_point start = Clock::now();
+        for (u32 step = 0; step < steps; ++step)
+            solver.Step(params, kDt);
+        StepTiming timing;
+        timing.SecondsPerStep = SecondsSince(start) / static_cast<f64>(steps);
+        for (const glm::vec3& p : solver.GetPositions())
+            timing.Finite = timing.Finite && std::isfinite(p.x) && std::isfinite(p.y) && std::isfinite(p.z);
+        return timing;
+    }
+} // namespace
+
+TEST(CPUFluidSolverBenchmark, ParallelParticleStepsPerSecond)
+{
+    EnsureTaskWorkers();
+    const FluidSolverParams params = MakePoolParams();
+
+    f64 parallelAt100k = 0.0;
+    for (const u32 particles : { 100'000u, 500'000u })
+    {
+        CPUFluidSolver solver(particles, CPUFluidSolverMode::Parallel);
+        FillBlock(solver, params);
+        ASSERT_EQ(solver.GetCount(), particles);
+
+        solver.Step(params, kDt); // warm: sizes every buffer
+        const StepTiming timing = TimeSteps(solver, params, kTimedSteps);
+        EXPECT_TRUE(timing.Finite) << particles << " particles";
+        EXPECT_EQ(solver.GetCount(), particles);
+
+        const f64 throughput = static_cast<f64>(particles) / timing.SecondsPerStep;
+        if (particles == 100'000u)
+            parallelAt100k = throughput;
+        OLO_CORE_INFO("[CPUFluidSolverBenchmark] parallel {} particles on {} workers: {:.2f} ms/step, "
+                      "{:.0f} particle-steps/s (max density error {:.3f})",
+                      particles, LowLevelTasks::FScheduler::Get().GetNumWorkers(), timing.SecondsPerStep * 1000.0,
+                      throughput, solver.GetLastMaxDensityError());
+    }
+
+    // The oracle, for the speedup figure: one step, same warm start.
+    CPUFluidSolver serial(100'000u);
+    FillBlock(serial, params);
+    serial.Step(params, kDt);
+    const StepTiming serialTiming = TimeSteps(serial, params, 1);
+    const f64 serialThroughput = 100'000.0 / serialTiming.SecondsPerStep;
+    OLO_CORE_INFO("[CPUFluidSolverBenchmark] serial 100000 particles: {:.2f} ms/step, {:.0f} particle-steps/s "
+                  "({:.2f}x parallel speedup)",
+                  serialTiming.SecondsPerStep * 1000.0, serialThroughput, parallelAt100k / serialThroughput);
+
+    if (BenchAssertEnabled())
+    {
+        EXPECT_GT(parallelAt100k, 1.0e6) << "parallel CPU fluid throughput at 100k";
+        EXPECT_GT(parallelAt100k, 2.0 * serialThroughput) << "parallel mode must beat the serial reference";
+    }
+}
@@ -0,0 +1,217 @@
+// OLO_TEST_LAYER: unit
+// =============================================================================
+// CPUFluidSolverParallelTest.cpp
+//
+// Contracts for CPUFluidSolver's parallel mode (cell-sorted SoA, CSR
+// neighbour lists, ParallelFor over fixed chunks). The serial mode is the
+// oracle: one step from the same state agrees with it to float noise. The
+// parallel mode must be bit-identical whether its chunks run on the workers or
+// inline, and it has to keep the incompressibility and in-bounds contracts
+// the serial solver is held to.
+// =============================================================================
+
+#include "OloEnginePCH.h"
+
+#include "OloEngine/Fluid/CPUFluidSolver.h"
+#include "OloEngine/Fluid/FluidSolverTypes.h"
+#include "TestTaskWorkers.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace OloEngine::Tests
+{
+    namespace
+    {
+        constexpr f32 kDt = 1.0f / 60.0f;
+
+        FluidSolverParams MakeDefaultParams()
+        {
+            FluidSolverParams params;
+            params.BoundsMin = { -0.5f, 0.0f, -0.5f };
+            params.BoundsMax = { 0.5f, 1.5f, 0.5f };
+            params.ParticleRadius = 0.05f; // d = 0.1, h = 0.2, m = 1 kg
+            params.SmoothingRadiusScale = 2.0f;
+            params.RestDensity = 1000.0f;
+            params.SolverIterations = 3;
+            return params;
+        }
+
+        void FillLattice(CPUFluidSolver& solver, const glm::vec3& origin, f32 spacing,
+                         u32 nx, u32 ny, u32 nz)
+        {
+            std::vector<GPUFluidEmitEntry> entries;
+            entries.reserve(static_cast<sizet>(nx) * ny * nz);
+            for (u32 x = 0; x < nx; ++x)
+            {
+                for (u32 y = 0; y < ny; ++y)
+                {
+                    for (u32 z = 0; z < nz; ++z)
+                    {
+                        GPUFluidEmitEntry entry{};
+                        entry.Position = glm::vec4(
+                            origin.x + (static_cast<f32>(x) + 0.5f) * spacing,
+                            origin.y + (static_cast<f32>(y) + 0.5f) * spacing,
+                            origin.z + (static_cast<f32>(z) + 0.5f) * spacing,
+                            0.0f);
+                        entry.Velocity = glm::vec4(0.0f);
+                        entries.push_back(entry);
+                    }
+                }
+            }
+            solver.Emit(entries);
+        }
+
+        FluidBodyProxy MakeSphereProxy(const glm::vec3& center, f32 radius)
+        {
+            FluidBodyProxy proxy{};
+            proxy.Position = glm::vec4(center, static_cast<f32>(FluidBodyProxyShape::Sphere));
+            proxy.Rotation = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+            proxy.HalfExtents = glm::vec4(radius, 0.0f, 0.0f, 0.0f);
+            proxy.LinearVelocity = glm::vec4(0.0f);
+            proxy.AngularVelocity = glm::vec4(0.0f);
+            return proxy;
+        }
+    } // namespace
+
+    TEST(CPUFluidSolverParallel, OneStepMatchesTheSerialOracle)
+    {
+        EnsureTaskWorkers();
+        FluidSolverParams params = MakeDefaultParams();
+
+        // 9x10x9 = 810 particles: more than one chunk, and a compressed start
+        // so every constraint term is non-trivial.
+        CPUFluidSolver serial(4096);
+        CPUFluidSolver parallel(4096, CPUFluidSolverMode::Parallel);
+        FillLattice(serial, { -0.45f, 0.0f, -0.45f }, params.Spacing() * 0.9f, 9, 10, 9);
+        FillLattice(parallel, { -0.45f, 0.0f, -0.45f }, params.Spacing() * 0.9f, 9, 10, 9);
+
+        // Resting on the top layer (y = 0.81). A proxy buried in the lattice
+        // would shove particles a cell or more inside the step, past what the
+        // frozen neighbour lists can follow, and the modes would legitimately
+        // part by millimetres.
+        const FluidBodyProxy proxy = MakeSphereProxy({ 0.0f, 1.05f, 0.0f }, 0.15f);
+        FluidBodyFeedback serialFeedback{};
+        FluidBodyFeedback parallelFeedback{};
+        serial.Step(params, kDt, std::span(&proxy, 1), std::span(&serialFeedback, 1));
+        parallel.Step(params, kDt, std::span(&proxy, 1), std::span(&parallelFeedback, 1));
+
+        // Same particle order out: the sort is internal to the step.
+        ASSERT_EQ(serial.GetCount(), parallel.GetCount());
+        for (u32 i = 0; i < serial.GetCount(); ++i)
+        {
+            EXPECT_LT(glm::length(serial.GetPositions()[i] - parallel.GetPositions()[i]), 1.0e-4f) << "particle " << i;
+            EXPECT_LT(glm::length(serial.GetVelocities()[i] - parallel.GetVelocities()[i]), 1.0e-2f) << "particle " << i;
+        }
+        EXPECT_NEAR(serial.GetLastAverageDensity(), parallel.GetLastAverageDensity(), 1.0e-3f * params.RestDensity);
+        EXPECT_NEAR(serial.GetLastMaxDensityError(), parallel.GetLastMaxDensityError(), 1.0e-3f);
+        ASSERT_GT(serialFeedback.Impulse.y, 0.0f) << "the proxy must be in contact";
+        EXPECT_NEAR(serialFeedback.Impulse.y, parallelFeedback.Impulse.y, 1.0e-3f * serialFeedback.Impulse.y);
+    }
+
+    TEST(CPUFluidSolverParallel, BitIdenticalAcrossThreadCounts)
+    {
+        EnsureTaskWorkers();
+
+        struct RunResult
+        {
+            std::vector<glm::vec3> Positions;
+            std::vector<glm::vec3> Velocities;
+            FluidBodyFeedback Feedback;
+            f32 MaxDensityError = 0.0f;
+        };
+        const auto run = [](bool runInline)
+        {
+            FluidSolverParams params = MakeDefaultParams();
+            CPUFluidSolver solver(4096, CPUFluidSolverMode::Parallel);
+            solver.SetRunInline(runInline);
+            FillLattice(solver, { -0.45f, 0.0f, -0.45f }, params.Spacing(), 9, 10, 9);
+
+            const FluidBodyProxy proxy = MakeSphereProxy({ 0.0f, 0.3f, 0.0f }, 0.15f);
+            RunResult result;
+            for (i32 step = 0; step < 30; ++step)
+            {
+                solver.Step(params, kDt, std::span(&proxy, 1), std::span(&result.Feedback, 1));
+            }
+            result.Positions.assign(solver.GetPositions().begin(), solver.GetPositions().end());
+            result.Velocities.assign(solver.GetVelocities().begin(), solver.GetVelocities().end());
+            result.MaxDensityError = solver.GetLastMaxDensityError();
+            return result;
+        };
+
+        const RunResult threaded = run(false);
+        const RunResult again = run(false);
+        const RunResult inlined = run(true);
+
+        for (const RunResult* other : { &again, &inlined })
+        {
+            ASSERT_EQ(threaded.Positions.size(), other->Positions.size());
+            EXPECT_EQ(0, std::memcmp(threaded.Positions.data(), other->Positions.data(),
+                                     threaded.Positions.size() * sizeof(glm::vec3)));
+            EXPECT_EQ(0, std::memcmp(threaded.Velocities.data(), other->Velocities.data(),
+                                     threaded.Velocities.size() * sizeof(glm::vec3)));
+            EXPECT_EQ(0, std::memcmp(&threaded.Feedback, &other->Feedback, sizeof(FluidBodyFeedback)));
+            EXPECT_EQ(threaded.MaxDensityError, other->MaxDensityError);
+        }
+    }
+
+    TEST(CPUFluidSolverParallel, DamSettlesIncompressibleAndInBounds)
+    {
+        // The serial contract's bounds (CPUFluidSolverContractTest), held by the
+        // parallel mode over the same 90 steps.
+        EnsureTaskWorkers();
+        FluidSolverParams params = MakeDefaultParams();
+        CPUFluidSolver solver(4096, CPUFluidSolverMode::Parallel);
+        FillLattice(solver, { -0.3f, 0.0f, -0.3f }, params.Spacing(), 6, 6, 6);
+
+        for (i32 step = 0; step < 90; ++step)
+        {
+            solver.Step(params, kDt);
+        }
+
+        ASSERT_EQ(solver.GetCount(), 216u);
+        f32 speedSum = 0.0f;
+        for (u32 i = 0; i < solver.GetCount(); ++i)
+        {
+            const glm::vec3 p = solver.GetPositions()[i];
+            ASSERT_TRUE(std::isfinite(p.x) && std::isfinite(p.y) && std::isfinite(p.z));
+            EXPECT_GE(p.x, params.BoundsMin.x - 1.0e-4f);
+            EXPECT_LE(p.x, params.BoundsMax.x + 1.0e-4f);
+            EXPECT_GE(p.y, params.BoundsMin.y - 1.0e-4f);
+            EXPECT_LE(p.y, params.BoundsMax.y + 1.0e-4f);
+            EXPECT_GE(p.z, params.BoundsMin.z - 1.0e-4f);
+            EXPECT_LE(p.z, params.BoundsMax.z + 1.0e-4f);
+            speedSum += glm::length(solver.GetVelocities()[i]);
+        }
+        EXPECT_LT(speedSum / static_cast<f32>(solver.GetCount()), 0.25f);
+        EXPECT_LT(solver.GetLastMaxDensityError(), 0.15f);
+        EXPECT_GT(solver.GetLastAverageDensity(), 0.55f * params.RestDensity);
+        EXPECT_LT(solver.GetLastAverageDensity(), 1.10f * params.RestDensity);
+    }
+
+    TEST(CPUFluidSolverParallel, KillBoxAndEmitKeepOriginalOrder)
+    {
+        // Kill boxes run before the sort, so the surviving particles keep the
+        // serial path's swap-with-last order.
+        EnsureTaskWorkers();
+        FluidSolverParams params = MakeDefaultParams();
+        CPUFluidSolver serial(4096);
+        CPUFluidSolver parallel(4096, CPUFluidSolverMode::Parallel);
+        FillLattice(serial, { -0.3f, 0.0f, -0.3f }, params.Spacing(), 6, 4, 6);
+        FillLattice(parallel, { -0.3f, 0.0f, -0.3f }, params.Spacing(), 6, 4, 6);
+
+        const FluidKillBox box{ { -1.0f, -1.0f, -1.0f }, { 1.0f, 0.2f, 1.0f } };
+        serial.Step(params, kDt, {}, {}, std::span(&box, 1));
+        parallel.Step(params, kDt, {}, {}, std::span(&box, 1));
+
+        ASSERT_EQ(serial.GetCount(), parallel.GetCount());
+        ASSERT_GT(parallel.GetCount(), 0u);
+        for (u32 i = 0; i < serial.GetCount(); ++i)
+        {
+            EXPECT_LT(glm::length(serial.GetPositions()[i] - parallel.GetPositions()[i]), 1.0e-4f) << "particle " << i;
+        }
+    }
+} // namespace OloEngine::Tests
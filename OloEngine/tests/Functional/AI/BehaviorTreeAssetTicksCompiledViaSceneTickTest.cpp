@@ -0,0 +1,113 @@
+#include "OloEnginePCH.h"
+
+// =============================================================================
+// BehaviorTreeAssetTicksCompiledViaSceneTickTest — Functional Test.
+//
+// Cross-subsystem seam under test:
+//   Scene tick × AISystem × AssetManager × BehaviorTreeAsset × BTCompiledTree.
+//   An agent that only carries a BehaviorTreeAssetHandle (no programmatic
+//   RuntimeTree) is ticked from the asset's compiled form, in parallel
+//   batches, at its TickInterval. BTCompiledTreeTest covers the compiled
+//   node semantics in isolation; nothing there sees AISystem resolving the
+//   handle through the asset manager, phasing agents across frames, or
+//   handing each tick the time since that agent's previous tick.
+//
+// Scenario: 64 agents share one memory-only asset, Sequence[Wait 0.5s,
+// SetBlackboardValue], with TickInterval 0.1s. After the first frame only
+// some of them have ticked (the phases are spread over the interval); no
+// agent finishes the wait early, and every agent finishes it within one
+// interval of the deadline.
+// =============================================================================
+
+#include "Functional/FunctionalTest.h"
+
+#include "OloEngine/Scene/Entity.h"
+#include "OloEngine/AI/AIComponents.h"
+#include "OloEngine/AI/BehaviorTree/BehaviorTreeAsset.h"
+#include "OloEngine/Asset/AssetManager.h"
+
+#include <string>
+#include <vector>
+
+using namespace OloEngine;
+using namespace OloEngine::Functional;
+
+class BehaviorTreeAssetTicksCompiledViaSceneTickTest : public FunctionalTest
+{
+  protected:
+    static constexpr const char* kKey = "Functional_CompiledDone";
+    static constexpr u32 kAgentCount = 64;
+    static constexpr f32 kTickInterval = 0.1f;
+
+    void BuildScene() override
+    {
+        EnableAssetManager({});
+
+        auto asset = Ref<BehaviorTreeAsset>::Create();
+        BTNodeData sequence;
+        sequence.ID = UUID(1);
+        sequence.TypeName = "Sequence";
+        sequence.ChildIDs = { UUID(2), UUID(3) };
+        BTNodeData wait;
+        wait.ID = UUID(2);
+        wait.TypeName = "Wait";
+        wait.Properties["Duration"] = "0.5";
+        BTNodeData set;
+        set.ID = UUID(3);
+        set.TypeName = "SetBlackboardValue";
+        set.Properties["Key"] = kKey;
+        set.Properties["ValueToSet"] = "1";
+        asset->AddNode(sequence);
+        asset->AddNode(wait);
+        asset->AddNode(set);
+        asset->SetRootNodeID(UUID(1));
+        const AssetHandle handle = AssetManager::AddMemoryOnlyAsset<BehaviorTreeAsset>(asset);
+
+        for (u32 i = 0; i < kAgentCount; ++i)
+        {
+            Entity agent = GetScene().CreateEntity("Agent" + std::to_string(i));
+            auto& bt = agent.AddComponent<BehaviorTreeComponent>();
+            bt.BehaviorTreeAssetHandle = handle;
+            bt.TickInterval = kTickInterval;
+            m_Agents.push_back(agent);
+        }
+    }
+
+    u32 CountAgents(bool (*predicate)(const BehaviorTreeComponent&))
+    {
+        u32 count = 0;
+        for (auto& agent : m_Agents)
+        {
+            count += predicate(agent.GetComponent<BehaviorTreeComponent>()) ? 1u : 0u;
+        }
+        return count;
+    }
+
+    std::vector<Entity> m_Agents;
+};
+
+TEST_F(BehaviorTreeAssetTicksCompiledViaSceneTickTest, AgentsTickPhasedAndHonourWaitDuration)
+{
+    // Frame 1: an agent ticks iff its phase falls inside the first 1/60 s of
+    // the 0.1 s interval. Ticked agents are mid-Wait, so IsRunning is set.
+    RunFrames(/*count=*/1);
+    const u32 ticked = CountAgents([](const BehaviorTreeComponent& bt)
+                                   { return bt.IsRunning; });
+    EXPECT_GT(ticked, 0u) << "no agent ticked on the first frame — the asset tree was never bound or compiled";
+    EXPECT_LT(ticked, kAgentCount) << "every agent ticked on the same frame — TickInterval phasing is not applied";
+
+    // 0.3 s in: each tick is handed the time since that agent's last tick, so
+    // the 0.5 s Wait can't have elapsed for anyone.
+    RunFrames(/*count=*/17);
+    EXPECT_EQ(CountAgents([](const BehaviorTreeComponent& bt)
+                          { return bt.Blackboard.Has(kKey); }),
+              0u)
+        << "a Wait finished early — skipped frames are not accumulated into the tick dt correctly";
+
+    // 0.8 s in: the deadline plus a full interval of lateness has passed.
+    RunFrames(/*count=*/30);
+    EXPECT_EQ(CountAgents([](const BehaviorTreeComponent& bt)
+                          { return bt.Blackboard.Get<i32>(kKey) == 1; }),
+              kAgentCount)
+        << "some agents never finished the Wait — skipped frames were dropped from the tick dt";
+}
@@ -182,3 +182,22 @@ TEST_F(PerceptionDetectsTargetViaSceneTickTest, RetainsLastKnownPositionAfterTar
     EXPECT_FLOAT_EQ(pc.LastKnownPosition.z, seenAt.z); // still the -5 sighting
     EXPECT_GT(pc.TimeSinceLastSeen, 0.0f);
 }
+
+TEST_F(PerceptionDetectsTargetViaSceneTickTest, SenseIntervalStillNoticesWithinOneInterval)
+{
+    // A staggered perceiver senses once per interval at a UUID-picked phase,
+    // so one interval's worth of ticks must always include a sense.
+    m_Watcher.GetComponent<PerceptionComponent>().SenseInterval = 0.25f;
+
+    RunFrames(16); // 16 / 60 s > 0.25 s
+    EXPECT_TRUE(Perception().HasVisibleTarget)
+        << "a staggered perceiver went a whole interval without sensing";
+
+    m_Intruder.GetComponent<TransformComponent>().Translation = { 0.0f, 0.0f, 8.0f }; // behind
+    RunFrames(16);
+
+    const auto& pc = Perception();
+    EXPECT_FALSE(pc.HasVisibleTarget);
+    EXPECT_GT(pc.TimeSinceLastSeen, 0.0f);
+    EXPECT_FALSE(WatcherBlackboard().Get<bool>(PerceptionKeys::CanSeeTarget));
+}
@@ -8,9 +8,9 @@
 // solver stepping, body-proxy extraction via JoltScene::OverlapBox, and the
 // reaction impulses queued on dynamic bodies before the world step.
 //
-// Headless — no GL — so every domain runs the deterministic CPU reference
-// solver (FluidSolverMode::Auto resolves to CPU without a renderer; tests
-// also pin m_SolverMode = CPU explicitly for clarity).
+// Headless — no GL — so every domain runs the deterministic CPU solver in its
+// parallel mode (FluidSolverMode::Auto resolves to CPU without a renderer;
+// tests also pin m_SolverMode = CPU explicitly for clarity).
 //
 // Assertions are comparative/discriminating rather than absolute where the
 // coupling magnitude is tuning-dependent: a light box must end clearly above
@@ -0,0 +1,145 @@
+#include "OloEnginePCH.h"
+
+// OLO_TEST_LAYER: Functional
+// =============================================================================
+// FlowFieldHordeReachesGoalTest — Functional Test.
+//
+// Cross-subsystem seam under test:
+//   NavMeshGenerator (Recast bake) x FlowFieldManager (shared grid field) x
+//   NavigationSystem (routes m_FlowFieldGroup agents past the crowd and writes
+//   back the follower contract) x NavAgentComponent.
+//
+// A horde larger than DetourCrowd's 256 slots is given one shared target. With
+// m_FlowFieldGroup set, none of it may take a crowd slot or a path request, and
+// every agent must end in the same terminal state the other followers produce:
+// m_HasTarget cleared on arrival, or m_TargetUnreachable latched (with
+// m_HasTarget kept) for a target off the navmesh.
+// =============================================================================
+
+#include "Functional/FunctionalTest.h"
+
+#include "OloEngine/Scene/Entity.h"
+#include "OloEngine/Scene/Components.h"
+#include "OloEngine/Navigation/CrowdManager.h"
+#include "OloEngine/Navigation/FlowFieldManager.h"
+#include "OloEngine/Navigation/NavMeshGenerator.h"
+#include "OloEngine/Navigation/NavMeshSettings.h"
+#include "OloEngine/Navigation/NavMesh.h"
+
+#include <vector>
+
+using namespace OloEngine;
+using namespace OloEngine::Functional;
+
+class FlowFieldHordeReachesGoalTest : public FunctionalTest
+{
+  protected:
+    static constexpr u32 kHordeSize = 300;
+    static constexpr glm::vec3 kGoal{ 15.0f, 0.0f, 0.0f };
+
+    void BuildScene() override
+    {
+        // Thin floor (same recipe as the other nav tests).
+        auto floor = GetScene().CreateEntity("Floor");
+        floor.GetComponent<TransformComponent>().Translation = { 0.0f, -0.05f, 0.0f };
+        Rigidbody3DComponent body;
+        body.m_Type = BodyType3D::Static;
+        BoxCollider3DComponent col;
+        col.m_HalfExtents = { 20.0f, 0.05f, 5.0f };
+        floor.AddComponent<BoxCollider3DComponent>(col);
+        floor.AddComponent<Rigidbody3DComponent>(body);
+
+        EnablePhysics3D();
+
+        NavMeshSettings settings;
+        const auto navMesh = NavMeshGenerator::Generate(
+            &GetScene(), settings,
+            /*boundsMin=*/glm::vec3(-25.0f, -2.0f, -7.0f),
+            /*boundsMax=*/glm::vec3(25.0f, 5.0f, 7.0f));
+        ASSERT_TRUE(navMesh && navMesh->IsValid())
+            << "flat-corridor bake failed — pre-condition broken.";
+        GetScene().SetNavMesh(navMesh);
+
+        // 20 x 15 block at the far end of the corridor.
+        for (u32 i = 0; i < kHordeSize; ++i)
+        {
+            auto agent = GetScene().CreateEntity("Horde");
+            agent.GetComponent<TransformComponent>().Translation = {
+                -18.0f + 0.7f * static_cast<f32>(i / 15), 0.0f, -4.0f + 0.55f * static_cast<f32>(i % 15)
+            };
+            auto& nav = agent.AddComponent<NavAgentComponent>();
+            nav.m_Radius = 0.25f;
+            nav.m_StoppingDistance = 0.3f;
+            nav.m_FlowFieldGroup = 1;
+            m_Horde.push_back(agent);
+        }
+    }
+
+    static void SetTarget(NavAgentComponent& agent, const glm::vec3& target)
+    {
+        agent.m_TargetPosition = target;
+        agent.m_HasTarget = true;
+        agent.m_HasPath = false;
+        agent.m_TargetUnreachable = false;
+    }
+
+    std::vector<Entity> m_Horde;
+};
+
+TEST_F(FlowFieldHordeReachesGoalTest, HordeBeyondCrowdCapacitySettlesAroundTheGoal)
+{
+    for (Entity agent : m_Horde)
+        SetTarget(agent.GetComponent<NavAgentComponent>(), kGoal);
+
+    u32 frames = 0;
+    u32 settled = 0;
+    bool anyFollowing = false;
+    for (; frames < 1800 && settled < kHordeSize; ++frames)
+    {
+        RunFrames(1);
+        settled = 0;
+        for (Entity agent : m_Horde)
+        {
+            const auto& nav = agent.GetComponent<NavAgentComponent>();
+            settled += nav.m_HasTarget ? 0u : 1u;
+            anyFollowing = anyFollowing || nav.m_HasPath;
+        }
+    }
+
+    ASSERT_NE(GetScene().GetFlowFieldManager(), nullptr);
+    EXPECT_EQ(GetScene().GetFlowFieldManager()->GetIntegrationCount(), 1u) << "one shared goal, one field";
+    ASSERT_NE(GetScene().GetCrowdManager(), nullptr);
+    EXPECT_EQ(GetScene().GetCrowdManager()->GetActiveAgentCount(), 0) << "flow-field agents took crowd slots";
+    EXPECT_TRUE(anyFollowing) << "m_HasPath never reported the field being followed";
+    EXPECT_EQ(settled, kHordeSize) << "only " << settled << " of " << kHordeSize << " agents arrived in " << frames << " frames";
+
+    f32 meanDistance = 0.0f;
+    for (Entity agent : m_Horde)
+    {
+        const auto& nav = agent.GetComponent<NavAgentComponent>();
+        EXPECT_FALSE(nav.m_TargetUnreachable);
+        EXPECT_EQ(nav.m_CrowdAgentId, -1);
+        EXPECT_EQ(nav.m_PathRequest, 0u);
+        const glm::vec3 pos = agent.GetComponent<TransformComponent>().Translation;
+        meanDistance += glm::length(glm::vec2(pos.x - kGoal.x, pos.z - kGoal.z)) / static_cast<f32>(kHordeSize);
+    }
+    // The block started ~30 m out; settled around the goal it is a few metres deep.
+    EXPECT_LT(meanDistance, 10.0f);
+}
+
+TEST_F(FlowFieldHordeReachesGoalTest, OffMeshTargetLatchesUnreachable)
+{
+    // Past the long edge of the floor: the goal snaps to the nearest walkable
+    // cell, the agent walks there and reports it can get no closer.
+    auto& nav = m_Horde.front().GetComponent<NavAgentComponent>();
+    nav.m_FlowFieldGroup = 2;
+    SetTarget(nav, { 0.0f, 0.0f, 6.0f });
+
+    for (u32 frame = 0; frame < 900 && !nav.m_TargetUnreachable; ++frame)
+        RunFrames(1);
+
+    EXPECT_TRUE(nav.m_TargetUnreachable);
+    EXPECT_TRUE(nav.m_HasTarget) << "the terminal unreachable state must keep the target, like the other followers";
+    const glm::vec3 pos = m_Horde.front().GetComponent<TransformComponent>().Translation;
+    EXPECT_LT(glm::length(glm::vec2(pos.x, pos.z - 6.0f)), 2.5f) << "stopped short of the nearest reachable point";
+}
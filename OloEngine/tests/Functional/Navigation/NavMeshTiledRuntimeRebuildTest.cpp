@@ -0,0 +1,100 @@
+#include "OloEnginePCH.h"
+
+// =============================================================================
+// NavMeshTiledRuntimeRebuildTest — Functional Test.
+//
+// Cross-subsystem seam under test:
+//   Scene (Rigidbody3DComponent add/remove hooks → MarkNavMeshDirty) ×
+//   NavMeshTileBuilder (re-rasterise only the touched tiles off-thread) ×
+//   NavMeshQuery (sees the swapped-in tiles through the same dtNavMesh).
+//   A tiled bake is only useful if world changes actually reach it: if the
+//   Physics3D hook stops marking tiles, a wall dropped across a corridor leaves
+//   agents pathing straight through it while every static nav test stays green.
+//
+// Scenario: a thin floor baked tiled (TileSize 32 → 6x2 tiles). A static wall
+// is added across it mid-run: the path across becomes Partial after the dirty
+// tiles rebuild, and only some tiles were rebuilt. Removing the wall restores
+// the Complete path.
+// =============================================================================
+
+#include "Functional/FunctionalTest.h"
+
+#include "OloEngine/Scene/Entity.h"
+#include "OloEngine/Scene/Components.h"
+#include "OloEngine/Navigation/NavMeshGenerator.h"
+#include "OloEngine/Navigation/NavMeshSettings.h"
+#include "OloEngine/Navigation/NavMesh.h"
+#include "OloEngine/Navigation/NavMeshQuery.h"
+
+using namespace OloEngine;
+using namespace OloEngine::Functional;
+
+class NavMeshTiledRuntimeRebuildTest : public FunctionalTest
+{
+  protected:
+    static constexpr glm::vec3 kStart{ -8.0f, 0.2f, 0.0f };
+    static constexpr glm::vec3 kEnd{ 8.0f, 0.2f, 0.0f };
+
+    void BuildScene() override
+    {
+        // Thin floor (same recipe as the other nav tests — thicker boxes
+        // confuse Recast's ledge-span filter and produce 0 polys).
+        auto floor = GetScene().CreateEntity("Floor");
+        floor.GetComponent<TransformComponent>().Translation = { 0.0f, -0.05f, 0.0f };
+        Rigidbody3DComponent body;
+        body.m_Type = BodyType3D::Static;
+        BoxCollider3DComponent col;
+        col.m_HalfExtents = { 20.0f, 0.05f, 5.0f };
+        floor.AddComponent<BoxCollider3DComponent>(col);
+        floor.AddComponent<Rigidbody3DComponent>(body);
+
+        EnablePhysics3D();
+
+        NavMeshSettings settings;
+        settings.TileSize = 32;
+        const auto navMesh = NavMeshGenerator::Generate(
+            &GetScene(), settings,
+            /*boundsMin=*/glm::vec3(-25.0f, -2.0f, -7.0f),
+            /*boundsMax=*/glm::vec3(25.0f, 5.0f, 7.0f));
+        ASSERT_TRUE(navMesh && navMesh->IsValid() && navMesh->GetTileBuilder())
+            << "tiled NavMeshGenerator bake failed on a thin-floor scene — pre-condition broken.";
+        GetScene().SetNavMesh(navMesh);
+    }
+
+    FindPathResult PathAcross()
+    {
+        std::vector<glm::vec3> path;
+        return GetScene().GetNavMeshQuery()->FindPath(kStart, kEnd, path);
+    }
+};
+
+TEST_F(NavMeshTiledRuntimeRebuildTest, StaticBodyChangesRebuildOnlyTheirTiles)
+{
+    auto& scene = GetScene();
+    const Ref<NavMesh> navMesh = scene.GetNavMesh();
+    ASSERT_EQ(navMesh->GetTileBuilder()->GetTilesX() * navMesh->GetTileBuilder()->GetTilesZ(), 12);
+    ASSERT_EQ(PathAcross(), FindPathResult::Complete);
+    EXPECT_FALSE(navMesh->GetTileBuilder()->HasPendingWork());
+
+    // A wall across the whole floor at x = 0. Collider first, then the body
+    // (the Rigidbody3D hook is what marks the tiles).
+    auto wall = scene.CreateEntity("Wall");
+    wall.GetComponent<TransformComponent>().Translation = { 0.0f, 1.5f, 0.0f };
+    BoxCollider3DComponent wallCol;
+    wallCol.m_HalfExtents = { 0.5f, 1.5f, 6.0f };
+    wall.AddComponent<BoxCollider3DComponent>(wallCol);
+    Rigidbody3DComponent wallBody;
+    wallBody.m_Type = BodyType3D::Static;
+    wall.AddComponent<Rigidbody3DComponent>(wallBody);
+    ASSERT_TRUE(navMesh->GetTileBuilder()->HasPendingWork()) << "adding a static body did not mark any tile dirty";
+
+    const u32 rebuilt = NavMeshGenerator::UpdateTiles(&scene, *navMesh, /*wait=*/true);
+    EXPECT_GT(rebuilt, 0u);
+    EXPECT_LT(rebuilt, 12u) << "the whole mesh was rebuilt for a local change";
+    EXPECT_EQ(PathAcross(), FindPathResult::Partial) << "the wall did not make it into the rebuilt tiles";
+
+    wall.RemoveComponent<Rigidbody3DComponent>();
+    wall.RemoveComponent<BoxCollider3DComponent>();
+    NavMeshGenerator::UpdateTiles(&scene, *navMesh, /*wait=*/true);
+    EXPECT_EQ(PathAcross(), FindPathResult::Complete) << "removing the wall did not reopen the floor";
+}
@@ -116,6 +116,26 @@ TEST(ServerConfigSerializer, ParseMultipleFlags)
     EXPECT_EQ(config.ScenePath, "Scenes/Test.oloscene");
 }
 
+TEST(ServerConfigSerializer, ParseLoadTestFlags)
+{
+    char* argv[] = {
+        const_cast<char*>("server"),
+        const_cast<char*>("--bots"),
+        const_cast<char*>("200"),
+        const_cast<char*>("--bot-input-rate"),
+        const_cast<char*>("15.5"),
+        const_cast<char*>("--bot-duration"),
+        const_cast<char*>("-5"), // rejected: keeps the default
+        const_cast<char*>("--bot-report"),
+        const_cast<char*>("load.yaml"),
+    };
+    ServerConfig config = ServerConfigSerializer::ParseCommandLine(9, argv);
+    EXPECT_EQ(config.LoadTestBots, 200u);
+    EXPECT_FLOAT_EQ(config.LoadTestInputRate, 15.5f);
+    EXPECT_FLOAT_EQ(config.LoadTestDuration, ServerConfig{}.LoadTestDuration);
+    EXPECT_EQ(config.LoadTestReportPath, "load.yaml");
+}
+
 // ============================================================================
 // ServerConfigSerializer - YAML load/save round-trip
 // ============================================================================
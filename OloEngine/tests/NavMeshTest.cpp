@@ -3,16 +3,24 @@
 #include "OloEngine/Navigation/NavMeshSettings.h"
 #include "OloEngine/Navigation/NavMesh.h"
 #include "OloEngine/Navigation/NavMeshQuery.h"
+#include "OloEngine/Navigation/NavMeshTileBuilder.h"
 #include "OloEngine/Navigation/CrowdManager.h"
+#include "OloEngine/Navigation/FlowFieldManager.h"
+#include "OloEngine/Navigation/PathRequestService.h"
 #include "OloEngine/Navigation/OffMeshLink.h"
 #include "OloEngine/Scene/Components.h"
 #include "OloEngine/Asset/AssetTypes.h"
+#include "TestTaskWorkers.h"
 
 #include <Recast.h>
 #include <DetourNavMesh.h>
 #include <DetourNavMeshBuilder.h>
 
+#include <chrono>
+#include <limits>
+
 using namespace OloEngine;
+using OloEngine::Tests::EnsureTaskWorkers;
 
 // ============================================================================
 // NavMeshSettings
@@ -34,6 +42,7 @@ TEST(NavMeshSettingsTest, DefaultValues)
     EXPECT_EQ(settings.VertsPerPoly, 6);
     EXPECT_FLOAT_EQ(settings.DetailSampleDist, 6.0f);
     EXPECT_FLOAT_EQ(settings.DetailSampleMaxError, 1.0f);
+    EXPECT_EQ(settings.TileSize, 0);
 }
 
 // ============================================================================
@@ -207,6 +216,7 @@ TEST(NavAgentComponentTest, DefaultValues)
     EXPECT_FLOAT_EQ(comp.m_Acceleration, 8.0f);
     EXPECT_FLOAT_EQ(comp.m_StoppingDistance, 0.1f);
     EXPECT_EQ(comp.m_AvoidancePriority, 50);
+    EXPECT_EQ(comp.m_FlowFieldGroup, 0u);
     EXPECT_FALSE(comp.m_HasTarget);
     EXPECT_FALSE(comp.m_HasPath);
     EXPECT_EQ(comp.m_CrowdAgentId, -1);
@@ -613,12 +623,15 @@ TEST(NavAgentComponentTest, CopyOnlySerializedFields)
 {
     NavAgentComponent original;
     original.m_MaxSpeed = 10.0f;
+    original.m_FlowFieldGroup = 3;
     original.m_HasTarget = true;
     original.m_HasPath = true;
     original.m_CrowdAgentId = 42;
 
     NavAgentComponent copy(original);
     EXPECT_FLOAT_EQ(copy.m_MaxSpeed, 10.0f);
+    EXPECT_EQ(copy.m_FlowFieldGroup, 3u);
+    EXPECT_TRUE(copy == original);
     EXPECT_FALSE(copy.m_HasTarget);
     EXPECT_FALSE(copy.m_HasPath);
     EXPECT_EQ(copy.m_CrowdAgentId, -1);
@@ -653,3 +666,555 @@ TEST(NavAgentComponentTest, MoveConstructorResetsRuntime)
     EXPECT_FALSE(moved.m_HasPath);
     EXPECT_EQ(moved.m_CrowdAgentId, -1);
 }
+
+// ============================================================================
+// Tiled build (NavMeshTileBuilder)
+// ============================================================================
+
+namespace
+{
+    void AppendQuad(NavMeshInputGeometry& geometry, f32 minX, f32 maxX, f32 minZ, f32 maxZ)
+    {
+        const auto base = static_cast<i32>(geometry.Verts.size() / 3);
+        geometry.Verts.insert(geometry.Verts.end(), { minX, 0.0f, minZ, maxX, 0.0f, minZ, maxX, 0.0f, maxZ, minX, 0.0f, maxZ });
+        geometry.Tris.insert(geometry.Tris.end(), { base, base + 2, base + 1, base, base + 3, base + 2 });
+    }
+
+    NavMeshSettings TiledSettings()
+    {
+        NavMeshSettings settings;
+        settings.TileSize = 32; // 9.6 m tiles: the 40 m plane below is 5x5
+        return settings;
+    }
+
+    constexpr glm::vec3 kTiledMin{ -20.0f, -1.0f, -20.0f };
+    constexpr glm::vec3 kTiledMax{ 20.0f, 1.0f, 20.0f };
+
+    // Horizontal distance from `point` to the walkable surface. findNearestPoly
+    // matches on poly bounds, so a bare "is there a poly" check can't see a hole.
+    f32 DistanceToNavMesh(const NavMeshQuery& query, const glm::vec3& point)
+    {
+        glm::vec3 nearest{};
+        if (!query.FindNearestPoint(point, 3.0f, nearest))
+            return std::numeric_limits<f32>::infinity();
+        return glm::length(glm::vec2(nearest.x - point.x, nearest.z - point.z));
+    }
+
+    Ref<NavMesh> WrapTiled(dtNavMesh* detourMesh, const NavMeshSettings& settings, Scope<NavMeshTileBuilder> builder)
+    {
+        auto navMesh = Ref<NavMesh>::Create();
+        navMesh->SetDetourNavMesh(detourMesh);
+        navMesh->SetSettings(settings);
+        navMesh->SetTileBuilder(std::move(builder));
+        return navMesh;
+    }
+} // namespace
+
+TEST(NavMeshTileBuilderTest, BuildsEveryTileAndPathsCrossTheSeams)
+{
+    EnsureTaskWorkers();
+    NavMeshInputGeometry plane;
+    AppendQuad(plane, -20.0f, 20.0f, -20.0f, 20.0f);
+
+    const NavMeshSettings settings = TiledSettings();
+    auto builder = CreateScope<NavMeshTileBuilder>(settings, kTiledMin, kTiledMax, std::vector<OffMeshLink>{});
+    dtNavMesh* detourMesh = builder->BuildAll(plane);
+    ASSERT_NE(detourMesh, nullptr);
+    EXPECT_EQ(builder->GetTilesX(), 5);
+    EXPECT_EQ(builder->GetTilesZ(), 5);
+    auto navMesh = WrapTiled(detourMesh, settings, std::move(builder));
+
+    i32 tiles = 0;
+    for (i32 i = 0; i < detourMesh->getMaxTiles(); ++i)
+    {
+        const dtMeshTile* tile = static_cast<const dtNavMesh*>(detourMesh)->getTile(i);
+        if (tile && tile->header)
+            ++tiles;
+    }
+    EXPECT_EQ(tiles, 25);
+
+    // Corner to corner crosses eight tile borders.
+    NavMeshQuery query(navMesh);
+    std::vector<glm::vec3> path;
+    EXPECT_EQ(query.FindPath({ -17.0f, 0.0f, -17.0f }, { 17.0f, 0.0f, 17.0f }, path), FindPathResult::Complete);
+    ASSERT_FALSE(path.empty());
+    EXPECT_NEAR(path.back().x, 17.0f, 0.5f);
+
+    // Tile data round-trips, and so does the tiling.
+    std::vector<u8> blob;
+    ASSERT_TRUE(navMesh->Serialize(blob));
+    NavMesh restored;
+    ASSERT_TRUE(restored.Deserialize(blob));
+    EXPECT_EQ(restored.GetPolyCount(), navMesh->GetPolyCount());
+    EXPECT_EQ(restored.GetSettings().TileSize, 32);
+    EXPECT_EQ(restored.GetTileBuilder(), nullptr);
+}
+
+TEST(NavMeshTileBuilderTest, ObstacleRebuildsOnlyItsTilesAndIsRemovable)
+{
+    EnsureTaskWorkers();
+    NavMeshInputGeometry plane;
+    AppendQuad(plane, -20.0f, 20.0f, -20.0f, 20.0f);
+
+    const NavMeshSettings settings = TiledSettings();
+    auto builder = CreateScope<NavMeshTileBuilder>(settings, kTiledMin, kTiledMax, std::vector<OffMeshLink>{});
+    dtNavMesh* detourMesh = builder->BuildAll(plane);
+    ASSERT_NE(detourMesh, nullptr);
+    NavMeshTileBuilder& tiles = *builder;
+    auto navMesh = WrapTiled(detourMesh, settings, std::move(builder));
+    NavMeshQuery query(navMesh);
+
+    const dtTileRef farTile = detourMesh->getTileRefAt(0, 0, 0);
+    const dtTileRef centreTile = detourMesh->getTileRefAt(2, 2, 0);
+    ASSERT_LT(DistanceToNavMesh(query, { 1.0f, 0.0f, 1.0f }), 0.05f);
+
+    // Re-rasterising must never be needed for an obstacle.
+    const auto noGeometry = [](NavMeshInputGeometry&)
+    { FAIL() << "an obstacle must not re-collect scene geometry"; };
+
+    // Centred in tile (2,2), well clear of its neighbours' borders.
+    const u32 obstacle = tiles.AddObstacle({ { 1.0f, 0.0f, 1.0f }, 1.0f, 2.0f });
+    ASSERT_NE(obstacle, 0u);
+    EXPECT_TRUE(tiles.HasPendingWork());
+    const u32 rebuilt = tiles.Update(*detourMesh, noGeometry, true);
+    EXPECT_GE(rebuilt, 1u);
+    EXPECT_LT(rebuilt, 25u);
+    EXPECT_FALSE(tiles.HasPendingWork());
+
+    // Radius 1 plus the 0.5 agent-radius erosion.
+    EXPECT_GT(DistanceToNavMesh(query, { 1.0f, 0.0f, 1.0f }), 1.2f) << "the obstacle was not carved";
+    EXPECT_EQ(detourMesh->getTileRefAt(0, 0, 0), farTile) << "a tile the obstacle doesn't touch was rebuilt";
+    EXPECT_NE(detourMesh->getTileRefAt(2, 2, 0), centreTile);
+
+    // Paths route around it.
+    std::vector<glm::vec3> path;
+    EXPECT_EQ(query.FindPath({ -5.0f, 0.0f, 1.0f }, { 5.0f, 0.0f, 1.0f }, path), FindPathResult::Complete);
+
+    EXPECT_TRUE(tiles.RemoveObstacle(obstacle));
+    EXPECT_FALSE(tiles.RemoveObstacle(obstacle));
+    tiles.Update(*detourMesh, noGeometry, true);
+    EXPECT_LT(DistanceToNavMesh(query, { 1.0f, 0.0f, 1.0f }), 0.05f) << "removing the obstacle did not restore the floor";
+
+    EXPECT_EQ(tiles.AddObstacle({ { 1.0f, 0.0f, 1.0f }, -1.0f, 2.0f }), 0u);
+}
+
+TEST(NavMeshTileBuilderTest, DirtyTilesReRasteriseFromTheNewGeometry)
+{
+    EnsureTaskWorkers();
+    NavMeshInputGeometry plane;
+    AppendQuad(plane, -20.0f, 20.0f, -20.0f, 20.0f);
+
+    const NavMeshSettings settings = TiledSettings();
+    auto builder = CreateScope<NavMeshTileBuilder>(settings, kTiledMin, kTiledMax, std::vector<OffMeshLink>{});
+    dtNavMesh* detourMesh = builder->BuildAll(plane);
+    ASSERT_NE(detourMesh, nullptr);
+    NavMeshTileBuilder& tiles = *builder;
+    auto navMesh = WrapTiled(detourMesh, settings, std::move(builder));
+    NavMeshQuery query(navMesh);
+
+    std::vector<glm::vec3> path;
+    ASSERT_EQ(query.FindPath({ -15.0f, 0.0f, 0.0f }, { 15.0f, 0.0f, 0.0f }, path), FindPathResult::Complete);
+
+    // The floor collapses along x in [-2, 2]: two islands.
+    u32 collected = 0;
+    const auto collapsed = [&collected](NavMeshInputGeometry& geometry)
+    {
+        ++collected;
+        AppendQuad(geometry, -20.0f, -2.0f, -20.0f, 20.0f);
+        AppendQuad(geometry, 2.0f, 20.0f, -20.0f, 20.0f);
+    };
+    const dtTileRef farTile = detourMesh->getTileRefAt(4, 0, 0);
+    tiles.MarkDirty({ -2.0f, -1.0f, -20.0f }, { 2.0f, 1.0f, 20.0f });
+
+    // Without waiting the swap lands on a later Update; until then the old
+    // tiles stay live.
+    u32 rebuilt = tiles.Update(*detourMesh, collapsed);
+    while (tiles.HasPendingWork())
+        rebuilt += tiles.Update(*detourMesh, collapsed);
+
+    EXPECT_EQ(collected, 1u);
+    // The two tile columns whose rasterised border reaches the gap.
+    EXPECT_EQ(rebuilt, 10u);
+    EXPECT_EQ(tiles.GetRebuiltTileCount(), 10u);
+    EXPECT_EQ(detourMesh->getTileRefAt(4, 0, 0), farTile);
+    EXPECT_EQ(query.FindPath({ -15.0f, 0.0f, 0.0f }, { 15.0f, 0.0f, 0.0f }, path), FindPathResult::Partial);
+}
+
+// ============================================================================
+// PathRequestService
+// ============================================================================
+
+namespace
+{
+    Ref<NavMesh> BuildTiledPlaneNavMesh()
+    {
+        NavMeshInputGeometry plane;
+        AppendQuad(plane, -20.0f, 20.0f, -20.0f, 20.0f);
+        const NavMeshSettings settings = TiledSettings();
+        auto builder = CreateScope<NavMeshTileBuilder>(settings, kTiledMin, kTiledMax, std::vector<OffMeshLink>{});
+        dtNavMesh* detourMesh = builder->BuildAll(plane);
+        if (!detourMesh)
+            return nullptr;
+        return WrapTiled(detourMesh, settings, std::move(builder));
+    }
+} // namespace
+
+TEST(PathRequestServiceTest, InvalidWithoutNavMesh)
+{
+    PathRequestService service(nullptr);
+    EXPECT_FALSE(service.IsValid());
+    EXPECT_EQ(service.Submit({ 0, 0, 0 }, { 1, 0, 0 }), 0u);
+    service.Update();
+    service.Flush();
+}
+
+TEST(PathRequestServiceTest, MatchesSynchronousFindPath)
+{
+    EnsureTaskWorkers();
+    auto navMesh = BuildTiledPlaneNavMesh();
+    ASSERT_NE(navMesh, nullptr);
+    NavMeshQuery query(navMesh);
+    PathRequestService service(navMesh);
+    ASSERT_TRUE(service.IsValid());
+
+    const glm::vec3 start{ -17.0f, 0.0f, -15.0f };
+    const glm::vec3 end{ 16.0f, 0.0f, 17.0f };
+    const u32 ticket = service.Submit(start, end);
+    const u32 offMesh = service.Submit(start, { 100.0f, 0.0f, 100.0f });
+    ASSERT_NE(ticket, 0u);
+    ASSERT_NE(offMesh, ticket);
+
+    PathRequestResult result;
+    EXPECT_FALSE(service.TakeResult(ticket, result)) << "Submit must not search inline";
+    service.Flush();
+    EXPECT_EQ(service.GetStats().Pending, 0u);
+
+    ASSERT_TRUE(service.TakeResult(ticket, result));
+    EXPECT_FALSE(service.TakeResult(ticket, result)) << "a ticket is spent once taken";
+    std::vector<glm::vec3> expected;
+    ASSERT_EQ(query.FindPath(start, end, expected), FindPathResult::Complete);
+    EXPECT_EQ(result.Result, FindPathResult::Complete);
+    EXPECT_EQ(result.Target, end);
+    ASSERT_EQ(result.Corners.size(), expected.size());
+    for (sizet i = 0; i < expected.size(); ++i)
+        EXPECT_LT(glm::length(result.Corners[i] - expected[i]), 1.0e-4f) << "corner " << i;
+
+    ASSERT_TRUE(service.TakeResult(offMesh, result));
+    EXPECT_EQ(result.Result, FindPathResult::Failed);
+    EXPECT_TRUE(result.Corners.empty());
+}
+
+TEST(PathRequestServiceTest, RetargetWaveIsSpreadUnderTheNodeBudget)
+{
+    // 500 agents retarget in one frame: 20 start spots x 25 goals, so every
+    // start/end poly pair repeats and the corridor cache has work to do.
+    EnsureTaskWorkers();
+    auto navMesh = BuildTiledPlaneNavMesh();
+    ASSERT_NE(navMesh, nullptr);
+    NavMeshQuery query(navMesh);
+
+    PathRequestSettings settings;
+    settings.MaxNodesPerFrame = 512;
+    PathRequestService service(navMesh, settings);
+    ASSERT_TRUE(service.IsValid());
+
+    struct Agent
+    {
+        glm::vec3 Start;
+        glm::vec3 End;
+        u32 Ticket = 0;
+        bool Done = false;
+    };
+    std::vector<Agent> agents;
+    for (u32 i = 0; i < 500; ++i)
+    {
+        const auto s = static_cast<f32>(i % 20);
+        const auto g = static_cast<f32>(i % 25);
+        Agent& agent = agents.emplace_back();
+        agent.Start = { -17.0f + 0.2f * s, 0.0f, -17.0f + 1.5f * (s / 2.0f) };
+        agent.End = { 17.0f - 1.3f * (g / 2.0f), 0.0f, 17.0f - 1.3f * g };
+        agent.Ticket = service.Submit(agent.Start, agent.End);
+        ASSERT_NE(agent.Ticket, 0u);
+    }
+    EXPECT_EQ(service.GetStats().Pending, 500u);
+
+    u32 frames = 0;
+    u32 done = 0;
+    while (done < agents.size() && frames < 1000)
+    {
+        service.Update();
+        ++frames;
+        EXPECT_LE(service.GetStats().NodesLastUpdate, settings.MaxNodesPerFrame) << "frame " << frames;
+        for (Agent& agent : agents)
+        {
+            PathRequestResult result;
+            if (agent.Done || !service.TakeResult(agent.Ticket, result))
+                continue;
+            agent.Done = true;
+            ++done;
+            EXPECT_EQ(result.Result, FindPathResult::Complete);
+            ASSERT_FALSE(result.Corners.empty());
+            EXPECT_NEAR(result.Corners.back().x, agent.End.x, 0.1f);
+            EXPECT_NEAR(result.Corners.back().z, agent.End.z, 0.1f);
+        }
+    }
+
+    const PathRequestStats& stats = service.GetStats();
+    EXPECT_EQ(done, 500u);
+    EXPECT_GT(frames, 1u) << "the wave was not sliced across frames";
+    EXPECT_EQ(stats.Completed, 500u);
+    EXPECT_EQ(stats.Pending, 0u);
+    EXPECT_GT(stats.CacheHits, 0u);
+    EXPECT_LE(stats.MaxLatencyFrames, frames);
+    EXPECT_GT(stats.MeanLatencyFrames, 0.0);
+    EXPECT_GE(stats.MaxLatencyMs, stats.MeanLatencyMs);
+    OLO_CORE_INFO("[PathRequestService] 500 requests in {} frames on {} slots: {} cache hits, mean latency {:.1f} frames "
+                  "({:.2f} ms), max {} frames",
+                  frames, service.GetSlotCount(), stats.CacheHits, stats.MeanLatencyFrames, stats.MeanLatencyMs,
+                  stats.MaxLatencyFrames);
+}
+
+TEST(PathRequestServiceTest, InvalidateRestartsAndCancelDrops)
+{
+    EnsureTaskWorkers();
+    auto navMesh = BuildTiledPlaneNavMesh();
+    ASSERT_NE(navMesh, nullptr);
+
+    // One node a frame: the corner-to-corner search is still in flight after
+    // the first update.
+    PathRequestSettings settings;
+    settings.MaxNodesPerFrame = 1;
+    settings.Slots = 1;
+    PathRequestService service(navMesh, settings);
+
+    const u32 kept = service.Submit({ -17.0f, 0.0f, -17.0f }, { 17.0f, 0.0f, 17.0f });
+    const u32 dropped = service.Submit({ -17.0f, 0.0f, 17.0f }, { 17.0f, 0.0f, -17.0f });
+    service.Update();
+    service.Update();
+    EXPECT_EQ(service.GetStats().Pending, 2u);
+
+    service.Invalidate();
+    service.Cancel(dropped);
+    service.Flush();
+
+    PathRequestResult result;
+    ASSERT_TRUE(service.TakeResult(kept, result));
+    EXPECT_EQ(result.Result, FindPathResult::Complete);
+    EXPECT_FALSE(service.TakeResult(dropped, result));
+    EXPECT_EQ(service.GetStats().Completed, 1u);
+}
+
+// ============================================================================
+// FlowFieldManager
+// ============================================================================
+
+namespace
+{
+    // The 40 m plane with a 2 m wide wall up the middle from z = -20 to
+    // z = 10: the only way across is round its end.
+    Ref<NavMesh> BuildWalledPlaneNavMesh()
+    {
+        NavMeshInputGeometry plane;
+        AppendQuad(plane, -20.0f, -1.0f, -20.0f, 20.0f);
+        AppendQuad(plane, 1.0f, 20.0f, -20.0f, 20.0f);
+        AppendQuad(plane, -1.0f, 1.0f, 10.0f, 20.0f);
+        const NavMeshSettings settings = TiledSettings();
+        auto builder = CreateScope<NavMeshTileBuilder>(settings, kTiledMin, kTiledMax, std::vector<OffMeshLink>{});
+        dtNavMesh* detourMesh = builder->BuildAll(plane);
+        if (!detourMesh)
+            return nullptr;
+        return WrapTiled(detourMesh, settings, std::move(builder));
+    }
+
+    bool InsideWall(const glm::vec3& p)
+    {
+        return p.x > -1.0f && p.x < 1.0f && p.z < 10.0f;
+    }
+} // namespace
+
+TEST(FlowFieldManagerTest, InvalidWithoutNavMesh)
+{
+    FlowFieldManager fields(nullptr);
+    EXPECT_FALSE(fields.IsValid());
+    fields.SetGoal(1, { 0.0f, 0.0f, 0.0f });
+    fields.WaitForFields();
+    glm::vec2 direction;
+    EXPECT_FALSE(fields.SampleDirection(1, { 1.0f, 0.0f, 0.0f }, direction));
+}
+
+TEST(FlowFieldManagerTest, FieldRoutesAroundTheWall)
+{
+    EnsureTaskWorkers();
+    auto navMesh = BuildWalledPlaneNavMesh();
+    ASSERT_NE(navMesh, nullptr);
+    FlowFieldManager fields(navMesh);
+    ASSERT_TRUE(fields.IsValid());
+
+    const glm::vec3 goal{ 10.0f, 0.0f, 0.0f };
+    fields.SetGoal(1, goal);
+    fields.WaitForFields();
+
+    const glm::vec3 start{ -10.0f, 0.0f, 0.0f };
+    glm::vec2 direction;
+    ASSERT_TRUE(fields.SampleDirection(1, start, direction));
+    EXPECT_GT(direction.y, 0.5f) << "the field points at the wall instead of round its end";
+    // Straight across is 20 m; round the end of the wall is well over 25.
+    EXPECT_GT(fields.SampleDistance(1, start), 25.0f);
+    EXPECT_LT(fields.SampleDistance(1, start), 40.0f);
+
+    std::vector<FlowFieldAgent> agents(1);
+    agents[0].Position = start;
+    agents[0].Target = goal;
+    agents[0].HasTarget = true;
+    agents[0].Group = 1;
+    u32 frames = 0;
+    for (; frames < 900 && agents[0].State != FlowFieldAgentState::Arrived; ++frames)
+    {
+        fields.Update(agents, 1.0f / 30.0f);
+        ASSERT_FALSE(InsideWall(agents[0].Position)) << "walked through the wall at frame " << frames;
+    }
+    EXPECT_EQ(agents[0].State, FlowFieldAgentState::Arrived);
+    EXPECT_LT(glm::length(glm::vec2(agents[0].Position.x - goal.x, agents[0].Position.z - goal.z)),
+              agents[0].StoppingDistance + 1.0e-3f);
+}
+
+TEST(FlowFieldManagerTest, GoalMovesKeepTheOldFieldUntilTheNewOneLands)
+{
+    EnsureTaskWorkers();
+    auto navMesh = BuildTiledPlaneNavMesh();
+    ASSERT_NE(navMesh, nullptr);
+    FlowFieldManager fields(navMesh);
+
+    fields.SetGoal(1, { 10.0f, 0.0f, 0.0f });
+    fields.WaitForFields();
+    EXPECT_EQ(fields.GetIntegrationCount(), 1u);
+
+    // Within the same cell: nothing to recompute.
+    fields.SetGoal(1, { 10.0f + 0.1f * fields.GetCellSize(), 0.0f, 0.0f });
+    EXPECT_EQ(fields.GetIntegrationCount(), 1u);
+
+    // Another cell: a new integration, but the group is never without a field.
+    fields.SetGoal(1, { -10.0f, 0.0f, 15.0f });
+    EXPECT_EQ(fields.GetIntegrationCount(), 2u);
+    glm::vec2 direction;
+    EXPECT_TRUE(fields.SampleDirection(1, { 0.0f, 0.0f, 0.0f }, direction));
+
+    fields.WaitForFields();
+    ASSERT_TRUE(fields.SampleDirection(1, { 0.0f, 0.0f, 0.0f }, direction));
+    EXPECT_LT(direction.x, 0.0f);
+    EXPECT_GT(direction.y, 0.0f);
+}
+
+TEST(FlowFieldManagerTest, DisconnectedGoalIsUnreachable)
+{
+    EnsureTaskWorkers();
+    NavMeshInputGeometry halves;
+    AppendQuad(halves, -20.0f, -3.0f, -20.0f, 20.0f);
+    AppendQuad(halves, 3.0f, 20.0f, -20.0f, 20.0f);
+    const NavMeshSettings settings = TiledSettings();
+    auto builder = CreateScope<NavMeshTileBuilder>(settings, kTiledMin, kTiledMax, std::vector<OffMeshLink>{});
+    dtNavMesh* detourMesh = builder->BuildAll(halves);
+    ASSERT_NE(detourMesh, nullptr);
+    FlowFieldManager fields(WrapTiled(detourMesh, settings, std::move(builder)));
+
+    fields.SetGoal(1, { 10.0f, 0.0f, 0.0f });
+    fields.WaitForFields();
+    EXPECT_EQ(fields.SampleDistance(1, { -10.0f, 0.0f, 0.0f }), std::numeric_limits<f32>::infinity());
+
+    std::vector<FlowFieldAgent> agents(1);
+    agents[0].Position = { -10.0f, 0.0f, 0.0f };
+    agents[0].Target = { 10.0f, 0.0f, 0.0f };
+    agents[0].HasTarget = true;
+    agents[0].Group = 1;
+    fields.Update(agents, 1.0f / 30.0f);
+    EXPECT_EQ(agents[0].State, FlowFieldAgentState::Unreachable);
+}
+
+TEST(FlowFieldManagerTest, AgentsMeetingHeadOnPassWithoutOverlapping)
+{
+    EnsureTaskWorkers();
+    auto navMesh = BuildTiledPlaneNavMesh();
+    ASSERT_NE(navMesh, nullptr);
+    FlowFieldManager fields(navMesh);
+
+    std::vector<FlowFieldAgent> agents(2);
+    agents[0].Position = { -6.0f, 0.0f, 0.0f };
+    agents[0].Target = { 6.0f, 0.0f, 0.0f };
+    agents[1].Position = { 6.0f, 0.0f, 0.05f };
+    agents[1].Target = { -6.0f, 0.0f, 0.0f };
+    for (u32 i = 0; i < 2; ++i)
+    {
+        agents[i].HasTarget = true;
+        agents[i].Group = i + 1;
+        fields.SetGoal(agents[i].Group, agents[i].Target);
+    }
+    fields.WaitForFields();
+
+    f32 closest = std::numeric_limits<f32>::max();
+    for (u32 frame = 0; frame < 240; ++frame)
+    {
+        fields.Update(agents, 1.0f / 30.0f);
+        closest = std::min(closest, glm::length(agents[0].Position - agents[1].Position));
+    }
+    EXPECT_GT(closest, 0.8f * (agents[0].Radius + agents[1].Radius));
+    EXPECT_EQ(agents[0].State, FlowFieldAgentState::Arrived);
+    EXPECT_EQ(agents[1].State, FlowFieldAgentState::Arrived);
+}
+
+TEST(FlowFieldManagerTest, HordeSharesOneFieldAndPacksAroundTheGoal)
+{
+    EnsureTaskWorkers();
+    auto navMesh = BuildWalledPlaneNavMesh();
+    ASSERT_NE(navMesh, nullptr);
+    FlowFieldManager fields(navMesh);
+
+    constexpr u32 kAgents = 1000;
+    const glm::vec3 goal{ 10.0f, 0.0f, 0.0f };
+    std::vector<FlowFieldAgent> agents(kAgents);
+    for (u32 i = 0; i < kAgents; ++i)
+    {
+        agents[i].Position = { -18.0f + 0.8f * static_cast<f32>(i % 20), 0.0f, -18.0f + 0.7f * static_cast<f32>(i / 20) };
+        agents[i].Target = goal;
+        agents[i].Radius = 0.3f;
+        agents[i].HasTarget = true;
+        agents[i].Group = 1;
+    }
+    fields.SetGoal(1, goal);
+
+    f64 updateMs = 0.0;
+    u32 frames = 0;
+    u32 settled = 0;
+    for (; frames < 1200 && settled < kAgents; ++frames)
+    {
+        const auto begin = std::chrono::steady_clock::now();
+        fields.Update(agents, 1.0f / 30.0f);
+        updateMs += std::chrono::duration<f64, std::milli>(std::chrono::steady_clock::now() - begin).count();
+
+        // What NavigationSystem does with an arrival.
+        settled = 0;
+        for (FlowFieldAgent& agent : agents)
+        {
+            if (agent.State == FlowFieldAgentState::Arrived)
+                agent.HasTarget = false;
+            settled += agent.HasTarget ? 0u : 1u;
+        }
+    }
+
+    EXPECT_EQ(fields.GetIntegrationCount(), 1u) << "a shared goal must be integrated once, not per agent";
+    EXPECT_EQ(settled, kAgents);
+    u32 deepOverlaps = 0;
+    for (u32 i = 0; i < kAgents; ++i)
+    {
+        ASSERT_FALSE(InsideWall(agents[i].Position)) << "agent " << i;
+        for (u32 j = i + 1; j < kAgents; ++j)
+        {
+            const glm::vec2 d(agents[i].Position.x - agents[j].Position.x, agents[i].Position.z - agents[j].Position.z);
+            // Packed crowds touch; collapsing onto each other is the failure.
+            if (glm::length(d) < 0.25f * (agents[i].Radius + agents[j].Radius))
+                ++deepOverlaps;
+        }
+    }
+    EXPECT_LT(deepOverlaps, kAgents / 50) << "separation let the horde collapse onto itself";
+    OLO_CORE_INFO("[FlowFieldManager] {} agents settled in {} frames, {:.3f} ms per update, {} deep overlaps",
+                  kAgents, frames, updateMs / static_cast<f64>(frames), deepOverlaps);
+}
@@ -0,0 +1,121 @@
+// OLO_TEST_LAYER: unit
+#include "OloEnginePCH.h"
+#include "../TestTaskWorkers.h"
+#include <gtest/gtest.h>
+
+// =============================================================================
+// InterZoneMessageBusBenchmarkTest
+//
+// Drain cost of the sharded InterZoneMessageBus as zone count and message rate
+// grow. One "tick" pushes a fixed batch (mostly targeted, ~1 in 16 a 256-byte
+// broadcast) and then every zone drains its own shard, the way ZoneServer::Tick
+// does. With per-zone shards the whole tick costs O(messages + broadcasts x
+// zones); the old single queue was O(zones x messages), because every zone
+// rescanned every message.
+//
+// Follows WorldOriginRebaseBenchmarkTest: logs unconditionally and only
+// asserts a (generous) scaling tripwire under --olo-bench-assert.
+// =============================================================================
+
+#include "OloEngine/Core/Base.h"
+#include "OloEngine/Networking/MMO/InterZoneMessageBus.h"
+
+#include <array>
+#include <chrono>
+
+using namespace OloEngine; // NOLINT(google-build-using-namespace) — test file
+using OloEngine::Tests::BenchAssertEnabled;
+
+namespace
+{
+    using Clock = std::chrono::high_resolution_clock;
+
+    struct TickTiming
+    {
+        f64 PushMs = 0.0;
+        f64 DrainMs = 0.0;
+        u64 Delivered = 0;
+    };
+
+    // Average one push+drain tick over `ticks` iterations.
+    TickTiming TimeTicks(u32 zoneCount, u32 messagesPerTick, u32 ticks)
+    {
+        InterZoneMessageBus bus;
+        for (u32 zone = 1; zone <= zoneCount; ++zone)
+        {
+            bus.RegisterZone(zone);
+        }
+
+        std::array<u8, 256> broadcastBytes{};
+        TickTiming timing;
+        for (u32 tick = 0; tick < ticks; ++tick)
+        {
+            auto const pushStart = Clock::now();
+            for (u32 i = 0; i < messagesPerTick; ++i)
+            {
+                InterZoneMessage msg;
+                msg.Type = EInterZoneMessageType::ChatRelay;
+                msg.SourceZoneID = (i % zoneCount) + 1;
+                if (i % 16 == 0)
+                {
+                    msg.Type = EInterZoneMessageType::WorldEvent;
+                    msg.TargetZoneID = 0;
+                    msg.Payload = InterZonePayload::CopyFrom(broadcastBytes);
+                }
+                else
+                {
+                    msg.TargetZoneID = ((i * 7u) % zoneCount) + 1;
+                }
+                bus.Push(std::move(msg));
+            }
+            auto const drainStart = Clock::now();
+            for (u32 zone = 1; zone <= zoneCount; ++zone)
+            {
+                timing.Delivered += bus.DrainForZone(zone).size();
+            }
+            auto const drainEnd = Clock::now();
+
+            timing.PushMs += std::chrono::duration<f64, std::milli>(drainStart - pushStart).count();
+            timing.DrainMs += std::chrono::duration<f64, std::milli>(drainEnd - drainStart).count();
+        }
+        timing.PushMs /= static_cast<f64>(ticks);
+        timing.DrainMs /= static_cast<f64>(ticks);
+        EXPECT_FALSE(bus.HasMessages());
+        return timing;
+    }
+} // namespace
+
+TEST(InterZoneMessageBusBenchmark, DrainCostAcrossZoneCountsAndRates)
+{
+    constexpr std::array<u32, 3> kZoneCounts = { 4, 16, 64 };
+    constexpr std::array<u32, 2> kRates = { 512, 8192 };
+    constexpr u32 kTicks = 20;
+
+    for (u32 const rate : kRates)
+    {
+        f64 drainPerTargetedMsgAtFewZones = 0.0;
+        for (u32 const zones : kZoneCounts)
+        {
+            TickTiming const timing = TimeTicks(zones, rate, kTicks);
+            u32 const broadcasts = (rate + 15) / 16;
+            u64 const expectedPerTick = static_cast<u64>(rate - broadcasts) + static_cast<u64>(broadcasts) * zones;
+            EXPECT_EQ(timing.Delivered, expectedPerTick * kTicks);
+
+            f64 const nsPerDelivery = timing.DrainMs * 1.0e6 / static_cast<f64>(expectedPerTick);
+            OLO_CORE_INFO("InterZoneMessageBusBenchmark: {0} zones, {1} msgs/tick -> push {2:.3f} ms, drain {3:.3f} ms ({4:.1f} ns/delivery)",
+                          zones, rate, timing.PushMs, timing.DrainMs, nsPerDelivery);
+
+            if (zones == kZoneCounts.front())
+            {
+                drainPerTargetedMsgAtFewZones = nsPerDelivery;
+            }
+            else if (BenchAssertEnabled())
+            {
+                // Per-delivery cost must stay flat as zones grow; the pre-shard bus
+                // grew linearly with zone count here. Generous 4x tripwire.
+                EXPECT_LT(nsPerDelivery, drainPerTargetedMsgAtFewZones * 4.0)
+                    << "drain cost per delivered message grew with zone count (" << zones << " zones)";
+            }
+        }
+    }
+}
@@ -0,0 +1,110 @@
+// OLO_TEST_LAYER: unit
+#include "OloEnginePCH.h"
+#include "../TestTaskWorkers.h"
+#include <gtest/gtest.h>
+
+// =============================================================================
+// ServerLoadTestBenchmarkTest
+//
+// Runs LoadTestHarness end-to-end over a real GameNetworkingSockets loopback: a
+// hosted server plus a few dozen scripted bot clients, each with its own Scene
+// and ClientReplicationDriver, for a few seconds of real time. The report is
+// logged unconditionally, so a CI log is a regression record of server tick
+// percentiles, per-client bandwidth, snapshot size and interpolation stalls.
+//
+// Always asserted: the loop actually ran (bots connected, snapshots arrived,
+// input flowed). Timing tripwires only under --olo-bench-assert, and generous —
+// a shared CI box is not a quiet machine.
+// =============================================================================
+
+#include "OloEngine/Core/Base.h"
+#include "OloEngine/Core/Timer.h"
+#include "OloEngine/Memory/Platform.h" // OLO_ASAN_ENABLED
+#include "OloEngine/Networking/RPC/RpcRegistry.h"
+#include "OloEngine/Networking/Replication/ComponentInterpolationRegistry.h"
+#include "OloEngine/Networking/Replication/ComponentReplicator.h"
+#include "OloEngine/Networking/Replication/EntityLifecycle.h"
+#include "OloEngine/Server/ServerLoadTest.h"
+
+#include <steam/steamnetworkingsockets.h>
+
+#include <chrono>
+#include <thread>
+
+using namespace OloEngine; // NOLINT(google-build-using-namespace) — test file
+using OloEngine::Tests::BenchAssertEnabled;
+
+namespace
+{
+    // Above ServerAuthoritativeLoopTest's [27200, 27800) probe range.
+    constexpr u16 kPortBase = 27900;
+
+    constexpr f32 kFrameDt = 1.0f / 60.0f;
+
+    // Pace a harness frame to real time: the whole point is a real transport
+    // with real latency, and an unpaced loop would just measure spin speed.
+    void RunUntilFinished(LoadTestHarness& harness)
+    {
+        Timer frameTimer;
+        while (!harness.IsFinished())
+        {
+            frameTimer.Reset();
+            harness.Tick(kFrameDt);
+            if (f32 const spent = frameTimer.Elapsed(); spent < kFrameDt)
+            {
+                std::this_thread::sleep_for(std::chrono::duration<f32>(kFrameDt - spent));
+            }
+        }
+    }
+} // namespace
+
+TEST(ServerLoadTestBenchmark, BotsConnectMoveAndReceiveSnapshots)
+{
+#if OLO_ASAN_ENABLED
+    GTEST_SKIP() << "Live GNS sockets are unavailable under AddressSanitizer (issue #317)";
+#else
+    SteamDatagramErrMsg errMsg;
+    ASSERT_TRUE(GameNetworkingSockets_Init(nullptr, errMsg)) << errMsg;
+
+    ComponentReplicator::RegisterDefaults();
+    ComponentInterpolationRegistry::RegisterDefaults();
+    NetworkSpawnRegistry::RegisterDefaults();
+    RpcRegistry::Clear();
+
+    LoadTestConfig config;
+    config.BotCount = 32;
+    config.InputRateHz = 30.0f;
+    config.DurationSeconds = 4.0f;
+    config.Behavior = ELoadTestBotBehavior::RandomWalk;
+
+    LoadTestReport report;
+    {
+        LoadTestHarness harness(config);
+        ASSERT_TRUE(harness.StartHostedServer(kPortBase));
+        harness.Start("127.0.0.1", harness.GetHostedPort());
+        RunUntilFinished(harness);
+        report = harness.BuildReport();
+        harness.Stop();
+    }
+    GameNetworkingSockets_Kill();
+
+    report.Log();
+
+    EXPECT_EQ(report.BotsConnected, config.BotCount);
+    EXPECT_GT(report.ServerTicks, 0u);
+    EXPECT_GT(report.Snapshots, 0u);
+    EXPECT_GT(report.SnapshotMeanBytes, 0.0f);
+    EXPECT_GT(report.InputsSent, 0u);
+    EXPECT_GT(report.ClientDownBytesPerSecMean, 0.0f);
+    EXPECT_LE(report.ServerTickP50Ms, report.ServerTickP99Ms);
+    EXPECT_LE(report.ServerTickP99Ms, report.ServerTickMaxMs);
+
+    if (BenchAssertEnabled())
+    {
+        // 32 clients at 20 Hz on loopback: a p99 past a full 60 Hz frame, or
+        // clients stalled for a quarter of the run, is a regression, not noise.
+        EXPECT_LT(report.ServerTickP99Ms, 16.6f);
+        EXPECT_LT(report.StalledSeconds / static_cast<f32>(config.BotCount), 0.25f * config.DurationSeconds);
+    }
+#endif
+}
@@ -4,6 +4,7 @@
 #include "OloEngine/Networking/Replication/SnapshotInterpolator.h"
 #include "OloEngine/Networking/Replication/ComponentReplicator.h"
 #include "OloEngine/Scene/Components.h"
+#include "OloEngine/Scene/Scene.h"
 #include "OloEngine/Serialization/Archive.h"
 
 #include <cmath>
@@ -182,3 +183,46 @@ TEST(SnapshotInterpolatorTest, RenderTickStaysFiniteAfterPoisonedDelay)
     EXPECT_TRUE(std::isfinite(interp.GetRenderTick()));
     EXPECT_FLOAT_EQ(interp.GetRenderTick(), 8.0f);
 }
+
+// ── Stall accounting ─────────────────────────────────────────────────
+// The load-test harness reports what clients experienced, so the interpolator
+// counts frames it could not interpolate and stretches with no new snapshot.
+// Every frame below has nothing to bracket, so the scene is never touched.
+
+TEST(SnapshotInterpolatorTest, StatsCountStarvedFramesAndOneStallPerGap)
+{
+    using namespace OloEngine;
+
+    Scene scene;
+    SnapshotInterpolator interp;
+    interp.SetServerTickRate(20); // stall threshold: 2 x 50 ms
+
+    // Nothing received yet: frames count, but "not started" is neither starved nor stalled.
+    interp.Interpolate(scene, 0.05f);
+    EXPECT_EQ(interp.GetStats().Frames, 1u);
+    EXPECT_EQ(interp.GetStats().StarvedFrames, 0u);
+
+    interp.PushSnapshot(10, MakeSnapshot(1, { 0.0f, 0.0f, 0.0f }));
+    for (i32 i = 0; i < 6; ++i)
+    {
+        interp.Interpolate(scene, 0.05f);
+    }
+    auto stats = interp.GetStats();
+    EXPECT_EQ(stats.StarvedFrames, 6u);
+    EXPECT_EQ(stats.Stalls, 1u) << "one continuous gap is one stall, however many frames it spans";
+    EXPECT_NEAR(stats.LongestStallSeconds, 0.25f, 1e-4f);
+
+    // A new snapshot ends the stall; the next gap is a second one.
+    interp.PushSnapshot(11, MakeSnapshot(1, { 1.0f, 0.0f, 0.0f }));
+    interp.Interpolate(scene, 0.05f);
+    EXPECT_EQ(interp.GetStats().Stalls, 1u);
+    for (i32 i = 0; i < 4; ++i)
+    {
+        interp.Interpolate(scene, 0.05f);
+    }
+    EXPECT_EQ(interp.GetStats().Stalls, 2u);
+
+    interp.ResetStats();
+    EXPECT_EQ(interp.GetStats().Frames, 0u);
+    EXPECT_EQ(interp.GetStats().Stalls, 0u);
+}
@@ -0,0 +1,298 @@
+// OLO_TEST_LAYER: unit
+#include "OloEnginePCH.h"
+#include <gtest/gtest.h>
+
+#include "OloEngine/Networking/Persistence/InMemoryWorldDatabase.h"
+#include "OloEngine/Networking/Persistence/WorldPersistenceManager.h"
+#include "OloEngine/Networking/Persistence/WorldPersistenceWriter.h"
+#include "OloEngine/SaveGame/SaveFileWorldDatabase.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace OloEngine;
+
+namespace
+{
+    // Forwards to another database, sleeping before every write to stand in
+    // for a network round trip, and optionally failing the first N batches.
+    class SlowWorldDatabase final : public IWorldDatabase
+    {
+      public:
+        SlowWorldDatabase(IWorldDatabase& inner, std::chrono::milliseconds latency)
+            : m_Inner(inner), m_Latency(latency)
+        {
+        }
+
+        bool SavePlayerState(u32 accountID, const PlayerStatePacket& state) override
+        {
+            std::this_thread::sleep_for(m_Latency);
+            return m_Inner.SavePlayerState(accountID, state);
+        }
+        bool LoadPlayerState(u32 accountID, PlayerStatePacket& outState) override
+        {
+            return m_Inner.LoadPlayerState(accountID, outState);
+        }
+        bool DeletePlayerState(u32 accountID) override
+        {
+            return m_Inner.DeletePlayerState(accountID);
+        }
+        bool SaveEntityState(u64 uuid, ZoneID zoneID, const std::vector<u8>& data) override
+        {
+            std::this_thread::sleep_for(m_Latency);
+            return m_Inner.SaveEntityState(uuid, zoneID, data);
+        }
+        bool LoadEntitiesForZone(ZoneID zoneID, std::vector<std::pair<u64, std::vector<u8>>>& outEntities) override
+        {
+            return m_Inner.LoadEntitiesForZone(zoneID, outEntities);
+        }
+        bool DeleteEntityState(u64 uuid) override
+        {
+            return m_Inner.DeleteEntityState(uuid);
+        }
+        bool SetWorldState(const std::string& key, const std::string& value) override
+        {
+            return m_Inner.SetWorldState(key, value);
+        }
+        bool GetWorldState(const std::string& key, std::string& outValue) override
+        {
+            return m_Inner.GetWorldState(key, outValue);
+        }
+
+        bool ApplyBatch(const WorldDatabaseBatch& batch) override
+        {
+            std::this_thread::sleep_for(m_Latency);
+            ++BatchCalls;
+            if (FailBatches.load() > 0)
+            {
+                --FailBatches;
+                return false;
+            }
+            return m_Inner.ApplyBatch(batch);
+        }
+        bool Flush() override
+        {
+            ++FlushCalls;
+            return m_Inner.Flush();
+        }
+
+        bool Initialize(const std::string& connectionString) override
+        {
+            return m_Inner.Initialize(connectionString);
+        }
+        void Shutdown() override
+        {
+            m_Inner.Shutdown();
+        }
+        [[nodiscard]] bool IsInitialized() const override
+        {
+            return m_Inner.IsInitialized();
+        }
+
+        std::atomic<u32> BatchCalls{ 0 };
+        std::atomic<u32> FlushCalls{ 0 };
+        std::atomic<u32> FailBatches{ 0 };
+
+      private:
+        IWorldDatabase& m_Inner;
+        std::chrono::milliseconds m_Latency;
+    };
+
+    std::vector<u8> Payload(u8 value)
+    {
+        return { value, static_cast<u8>(value + 1) };
+    }
+} // namespace
+
+TEST(WorldPersistenceWriter, CoalescesRepeatedWritesToOneKey)
+{
+    InMemoryWorldDatabase memory;
+    memory.Initialize(":memory:");
+    SlowWorldDatabase db(memory, std::chrono::milliseconds(0));
+
+    WorldPersistenceWriterConfig config;
+    config.FlushWindowSeconds = 10.0f; // nothing leaves before Flush()
+    WorldPersistenceWriter writer(db, config);
+    writer.Start();
+
+    for (u8 i = 0; i < 100; ++i)
+    {
+        writer.SaveEntity(7, 1, Payload(i));
+    }
+    EXPECT_EQ(writer.GetPendingCount(), 1u);
+    ASSERT_TRUE(writer.Flush());
+
+    std::vector<std::pair<u64, std::vector<u8>>> entities;
+    ASSERT_TRUE(memory.LoadEntitiesForZone(1, entities));
+    ASSERT_EQ(entities.size(), 1u);
+    EXPECT_EQ(entities[0].second, Payload(99));
+
+    auto const stats = writer.GetStats();
+    EXPECT_EQ(stats.OperationsEnqueued, 100u);
+    EXPECT_EQ(stats.OperationsCoalesced, 99u);
+    EXPECT_EQ(db.BatchCalls.load(), 1u);
+}
+
+TEST(WorldPersistenceWriter, SlowDatabaseDoesNotBlockProducer)
+{
+    InMemoryWorldDatabase memory;
+    memory.Initialize(":memory:");
+    SlowWorldDatabase db(memory, std::chrono::milliseconds(20));
+
+    WorldPersistenceWriterConfig config;
+    config.FlushWindowSeconds = 0.01f;
+    config.MaxBatchOperations = 256;
+    WorldPersistenceWriter writer(db, config);
+    writer.Start();
+
+    auto const start = std::chrono::steady_clock::now();
+    for (u64 uuid = 1; uuid <= 1000; ++uuid)
+    {
+        writer.SaveEntity(uuid, 2, Payload(static_cast<u8>(uuid)));
+    }
+    auto const enqueueTime = std::chrono::steady_clock::now() - start;
+
+    // 1000 synchronous round trips would take 20 s; queuing takes microseconds
+    EXPECT_LT(enqueueTime, std::chrono::milliseconds(500));
+
+    ASSERT_TRUE(writer.Flush());
+    EXPECT_EQ(memory.GetEntityCount(), 1000u);
+    EXPECT_LE(db.BatchCalls.load(), 8u);
+}
+
+TEST(WorldPersistenceWriter, BackPressureBoundsPendingSet)
+{
+    InMemoryWorldDatabase memory;
+    memory.Initialize(":memory:");
+    SlowWorldDatabase db(memory, std::chrono::milliseconds(5));
+
+    WorldPersistenceWriterConfig config;
+    config.MaxPendingOperations = 8;
+    config.MaxBatchOperations = 4;
+    WorldPersistenceWriter writer(db, config);
+    writer.Start();
+
+    for (u64 uuid = 1; uuid <= 64; ++uuid)
+    {
+        writer.SaveEntity(uuid, 3, Payload(1));
+        EXPECT_LE(writer.GetPendingCount(), 8u);
+    }
+    ASSERT_TRUE(writer.Flush());
+    EXPECT_EQ(memory.GetEntityCount(), 64u);
+    EXPECT_GT(writer.GetStats().BackPressureWaits, 0u);
+}
+
+TEST(WorldPersistenceWriter, CheckpointRecordsMarkerAndFlushesOnce)
+{
+    InMemoryWorldDatabase memory;
+    memory.Initialize(":memory:");
+    SlowWorldDatabase db(memory, std::chrono::milliseconds(1));
+
+    WorldPersistenceWriterConfig config;
+    config.MaxBatchOperations = 16;
+    WorldPersistenceWriter writer(db, config);
+    writer.Start();
+
+    for (u64 uuid = 1; uuid <= 100; ++uuid)
+    {
+        writer.SaveEntity(uuid, 4, Payload(2));
+    }
+    writer.SetWorldState("weather", "rain");
+    u64 const checkpoint = writer.RequestCheckpoint();
+    ASSERT_TRUE(writer.WaitForCheckpoint(checkpoint));
+    EXPECT_EQ(writer.GetCommittedCheckpoint(), checkpoint);
+
+    std::string marker;
+    ASSERT_TRUE(memory.GetWorldState(WorldPersistenceWriter::kCheckpointKey, marker));
+    EXPECT_EQ(marker, std::to_string(checkpoint));
+    EXPECT_EQ(memory.GetEntityCount(), 100u);
+    // Several batches, but durability is only asked for at the checkpoint
+    EXPECT_GT(db.BatchCalls.load(), 1u);
+    EXPECT_EQ(db.FlushCalls.load(), 1u);
+}
+
+TEST(WorldPersistenceWriter, FailedBatchIsRetriedWithoutLosingWrites)
+{
+    InMemoryWorldDatabase memory;
+    memory.Initialize(":memory:");
+    SlowWorldDatabase db(memory, std::chrono::milliseconds(0));
+    db.FailBatches = 2;
+
+    WorldPersistenceWriterConfig config;
+    config.FlushWindowSeconds = 0.01f;
+    WorldPersistenceWriter writer(db, config);
+    writer.Start();
+
+    writer.SaveEntity(1, 5, Payload(3));
+    writer.DeleteEntity(2);
+    PlayerStatePacket player;
+    player.ClientID = 9;
+    writer.SavePlayer(11, player);
+
+    ASSERT_TRUE(writer.Flush());
+    EXPECT_EQ(writer.GetStats().BatchesFailed, 2u);
+    EXPECT_EQ(memory.GetEntityCount(), 1u);
+    PlayerStatePacket loaded;
+    ASSERT_TRUE(memory.LoadPlayerState(11, loaded));
+    EXPECT_EQ(loaded.ClientID, 9u);
+}
+
+TEST(WorldPersistenceWriter, RefusingSaveFileDatabaseNeverCommitsCheckpoint)
+{
+    // Not initialized: every write is refused, the way a store that lost its
+    // disk would. The checkpoint must not be reported as committed.
+    SaveFileWorldDatabase saveFile;
+    SlowWorldDatabase db(saveFile, std::chrono::milliseconds(2));
+
+    WorldPersistenceWriterConfig config;
+    config.FlushWindowSeconds = 0.01f;
+    WorldPersistenceWriter writer(db, config);
+    writer.Start();
+
+    writer.SaveEntity(1, 6, Payload(4));
+    u64 const checkpoint = writer.RequestCheckpoint();
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    writer.Stop();
+
+    EXPECT_FALSE(writer.WaitForCheckpoint(checkpoint));
+    EXPECT_EQ(writer.GetCommittedCheckpoint(), 0u);
+    EXPECT_GT(writer.GetStats().BatchesFailed, 0u);
+    EXPECT_EQ(writer.GetPendingCount(), 1u);
+}
+
+TEST(WorldPersistenceWriter, ManagerLoadsSeeQueuedWrites)
+{
+    InMemoryWorldDatabase memory;
+    memory.Initialize(":memory:");
+    SlowWorldDatabase db(memory, std::chrono::milliseconds(10));
+
+    WorldPersistenceManager mgr;
+    WorldPersistenceWriterConfig config;
+    config.FlushWindowSeconds = 10.0f;
+    mgr.Initialize(&db, 300.0f, config);
+    ASSERT_NE(mgr.GetWriter(), nullptr);
+
+    mgr.SetEntityDataProvider(
+        [](u64 uuid, ZoneID& outZone, std::vector<u8>& outData)
+        {
+            outZone = 8;
+            outData = Payload(static_cast<u8>(uuid));
+            return true;
+        });
+    for (u64 uuid = 1; uuid <= 10; ++uuid)
+    {
+        mgr.MarkDirty(uuid);
+    }
+    mgr.SaveAll();
+    EXPECT_EQ(mgr.GetDirtyCount(), 0u);
+
+    std::vector<std::pair<u64, std::vector<u8>>> entities;
+    ASSERT_TRUE(mgr.LoadEntitiesForZone(8, entities));
+    EXPECT_EQ(entities.size(), 10u);
+
+    ASSERT_TRUE(mgr.DeleteEntity(3));
+    ASSERT_TRUE(mgr.Checkpoint());
+    ASSERT_TRUE(mgr.LoadEntitiesForZone(8, entities));
+    EXPECT_EQ(entities.size(), 9u);
+}
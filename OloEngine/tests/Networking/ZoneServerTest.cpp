@@ -6,6 +6,11 @@
 #include "OloEngine/Networking/MMO/ZoneManager.h"
 #include "OloEngine/Networking/MMO/InterZoneMessageBus.h"
 
+#include <algorithm>
+#include <array>
+#include <thread>
+#include <vector>
+
 using namespace OloEngine;
 
 // ============================================================================
@@ -199,3 +204,150 @@ TEST(InterZoneMessageBus, DrainForZone)
     // msg2 and msg3 (broadcast, preserved for other zones) should still be in the bus
     EXPECT_EQ(bus.GetPendingCount(), 2u);
 }
+
+TEST(InterZoneMessageBus, TargetedMessagesOnlyReachTheirZone)
+{
+    InterZoneMessageBus bus;
+    bus.RegisterZone(1);
+    bus.RegisterZone(2);
+
+    for (u32 i = 0; i < 3; ++i)
+    {
+        InterZoneMessage msg;
+        msg.SourceZoneID = 2;
+        msg.TargetZoneID = 1;
+        msg.Payload = InterZonePayload::CopyFrom(std::array<u8, 1>{ static_cast<u8>(i) });
+        bus.Push(std::move(msg));
+    }
+
+    EXPECT_EQ(bus.GetPendingCountForZone(1), 3u);
+    EXPECT_EQ(bus.GetPendingCountForZone(2), 0u);
+    EXPECT_TRUE(bus.DrainForZone(2).empty());
+
+    auto zone1Msgs = bus.DrainForZone(1);
+    ASSERT_EQ(zone1Msgs.size(), 3u);
+    for (u32 i = 0; i < 3; ++i)
+    {
+        ASSERT_EQ(zone1Msgs[i].Payload.GetSize(), 1u);
+        EXPECT_EQ(zone1Msgs[i].Payload.GetData()[0], i) << "per-zone FIFO order broken";
+    }
+    EXPECT_FALSE(bus.HasMessages());
+}
+
+TEST(InterZoneMessageBus, BroadcastPayloadIsSharedNotCopied)
+{
+    InterZoneMessageBus bus;
+    bus.RegisterZone(1);
+    bus.RegisterZone(2);
+    bus.RegisterZone(3);
+
+    const std::array<u8, 4> bytes = { 1, 2, 3, 4 };
+    InterZoneMessage msg;
+    msg.Type = EInterZoneMessageType::WorldEvent;
+    msg.TargetZoneID = 0;
+    msg.Payload = InterZonePayload::CopyFrom(bytes);
+    bus.Push(std::move(msg));
+
+    auto zone1Msgs = bus.DrainForZone(1);
+    auto zone3Msgs = bus.DrainForZone(3);
+    ASSERT_EQ(zone1Msgs.size(), 1u);
+    ASSERT_EQ(zone3Msgs.size(), 1u);
+    EXPECT_TRUE(zone1Msgs[0].Payload.SharesStorageWith(zone3Msgs[0].Payload));
+    EXPECT_TRUE(std::ranges::equal(zone1Msgs[0].Payload.GetView(), bytes));
+
+    // Zone 2 has not drained its copy yet, so the broadcast is still pending.
+    EXPECT_EQ(bus.GetPendingCount(), 1u);
+    auto zone2Msgs = bus.DrainForZone(2);
+    ASSERT_EQ(zone2Msgs.size(), 1u);
+    EXPECT_EQ(zone2Msgs[0].Payload.GetRefCount(), 3u);
+    EXPECT_FALSE(bus.HasMessages());
+}
+
+TEST(InterZoneMessageBus, DrainAllReturnsBroadcastOnceInPushOrder)
+{
+    InterZoneMessageBus bus;
+    bus.RegisterZone(1);
+    bus.RegisterZone(2);
+
+    InterZoneMessage targeted;
+    targeted.TargetZoneID = 2;
+    targeted.Type = EInterZoneMessageType::ChatRelay;
+    bus.Push(std::move(targeted));
+
+    InterZoneMessage broadcast;
+    broadcast.TargetZoneID = 0;
+    broadcast.Type = EInterZoneMessageType::WorldEvent;
+    bus.Push(std::move(broadcast));
+
+    InterZoneMessage admin;
+    admin.TargetZoneID = 1;
+    admin.Type = EInterZoneMessageType::AdminCommand;
+    bus.Push(std::move(admin));
+
+    auto messages = bus.DrainAll();
+    ASSERT_EQ(messages.size(), 3u);
+    EXPECT_EQ(messages[0].Type, EInterZoneMessageType::ChatRelay);
+    EXPECT_EQ(messages[1].Type, EInterZoneMessageType::WorldEvent);
+    EXPECT_EQ(messages[2].Type, EInterZoneMessageType::AdminCommand);
+    EXPECT_FALSE(bus.HasMessages());
+    EXPECT_EQ(bus.GetPendingCountForZone(1), 0u);
+    EXPECT_EQ(bus.GetPendingCountForZone(2), 0u);
+}
+
+TEST(InterZoneMessageBus, ConcurrentProducersLoseNothing)
+{
+    constexpr u32 kProducers = 4;
+    constexpr u32 kPerProducer = 2000;
+
+    InterZoneMessageBus bus;
+    bus.RegisterZone(1);
+    bus.RegisterZone(2);
+
+    std::vector<std::thread> producers;
+    for (u32 p = 0; p < kProducers; ++p)
+    {
+        producers.emplace_back([&bus, p]
+                               {
+            for (u32 i = 0; i < kPerProducer; ++i)
+            {
+                InterZoneMessage msg;
+                msg.SourceZoneID = p + 10;
+                msg.TargetZoneID = (i % 2) + 1;
+                bus.Push(std::move(msg));
+            } });
+    }
+
+    // Zone 1 drains while the producers are still pushing.
+    u32 zone1Received = 0;
+    while (zone1Received < kProducers * kPerProducer / 2)
+    {
+        zone1Received += static_cast<u32>(bus.DrainForZone(1).size());
+    }
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+
+    EXPECT_EQ(zone1Received, kProducers * kPerProducer / 2);
+    EXPECT_EQ(bus.DrainForZone(2).size(), kProducers * kPerProducer / 2);
+    EXPECT_FALSE(bus.HasMessages());
+}
+
+TEST(InterZonePayload, BlocksReturnToThePool)
+{
+    InterZonePayload::TrimPool();
+    auto const before = InterZonePayload::GetPoolStats();
+    {
+        InterZonePayload payload = InterZonePayload::Allocate(100);
+        InterZonePayload copy = payload;
+        EXPECT_EQ(payload.GetRefCount(), 2u);
+        EXPECT_EQ(InterZonePayload::GetPoolStats().BlocksLive, before.BlocksLive + 1);
+    }
+    auto const after = InterZonePayload::GetPoolStats();
+    EXPECT_EQ(after.BlocksLive, before.BlocksLive);
+    EXPECT_EQ(after.BlocksPooled, before.BlocksPooled + 1);
+
+    // The next allocation in the same size class reuses the pooled block.
+    [[maybe_unused]] InterZonePayload reused = InterZonePayload::Allocate(120);
+    EXPECT_EQ(InterZonePayload::GetPoolStats().BlocksPooled, before.BlocksPooled);
+}
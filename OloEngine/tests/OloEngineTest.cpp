@@ -1,5 +1,6 @@
 #include "OloEnginePCH.h"
 #include <gtest/gtest.h>
+#include "OloEngine/Asset/DerivedDataCache.h"
 #include "OloEngine/Core/Log.h"
 #include "OloEngine/Core/Interactivity.h"
 #include "OloEngine/Core/DebugLevers.h"
@@ -22,6 +23,11 @@ int main(int argc, char** argv)
     // read it yet.
     OloEngine::Levers::SetRenderGraphDiagnostics(true);
 
+    // The cookers share a derived-data cache that normally lives in the user's
+    // profile. Keep the suite's entries under this process's scratch root, so a
+    // run neither reuses a developer's cooks nor leaves its own behind.
+    OloEngine::DerivedDataCache::Get().SetRoot(OloEngine::Tests::TempRoot() / "DerivedDataCache");
+
     // Initialize logging explicitly
     OloEngine::Log::Initialize();
 
@@ -353,6 +353,27 @@ namespace OloEngine::Tests
         }
     }
 
+    // The tiled ray-stream bake and the per-texel bake trace the same paths
+    // in a different order; the texels must not notice.
+    TEST(LightmapBakeParity, RayStreamBakeMatchesPerTexelBakeExactly)
+    {
+        const BleedRoom room = MakeBleedRoom();
+        const BakedRoom streamed = BakeRoom(room, /*sharedMesh=*/true);
+        ASSERT_TRUE(streamed.Settings.UseRayStreams);
+        ASSERT_TRUE(streamed.Result.Success) << streamed.Result.Error;
+
+        LightmapBakeSettings perTexelSettings = streamed.Settings;
+        perTexelSettings.UseRayStreams = false;
+        const LightmapBakeResult perTexel = LightmapBaker::BakeTexels(streamed.Prepared, streamed.World, perTexelSettings);
+        ASSERT_TRUE(perTexel.Success) << perTexel.Error;
+
+        const auto& a = streamed.Result.Asset->GetTexelData();
+        const auto& b = perTexel.Asset->GetTexelData();
+        ASSERT_EQ(a.size(), b.size());
+        EXPECT_EQ(std::memcmp(a.data(), b.data(), a.size() * sizeof(f32)), 0)
+            << "the ray-stream bake diverged from the per-texel bake";
+    }
+
     TEST(LightmapBakeParity, DilationNeverBleedsAcrossAtlasRegions)
     {
         // Two colour-isolated floor+wall pairs, 60 m apart, with the coloured
@@ -0,0 +1,225 @@
+// OLO_TEST_LAYER: unit
+#include "OloEnginePCH.h"
+#include "../../TestTaskWorkers.h"
+#include <gtest/gtest.h>
+
+// =============================================================================
+// LightmapBakerBenchmarkTest
+//
+// Wall time of LightmapBaker::BakeTexels on the sandbox lightmap room
+// (SandboxProject/Assets/Scenes/LightmapTest.olo), once with ray streams and
+// once tracing texel by texel. The scene file is read the way the editor's
+// "Bake Lightmaps" gathers it: its lightmap-static primitives become the bake
+// inputs and, with the point lights, the reference world. No GPU and no ECS,
+// so the YAML is walked directly. Both bakes share one Prepare and must come
+// out bit-identical; the speed-up floor applies only under --olo-bench-assert.
+// =============================================================================
+
+#include "OloEngine/Animation/AnimatedMeshComponents.h"
+#include "OloEngine/Renderer/Baking/LightmapBaker.h"
+#include "OloEngine/Renderer/Material.h"
+#include "OloEngine/Renderer/MeshPrimitives.h"
+#include "OloEngine/Renderer/MeshSource.h"
+#include "OloEngine/Renderer/PathTracing/ReferenceSceneBuilder.h"
+#include "OloEngine/Scene/Components.h"
+
+#include <yaml-cpp/yaml.h>
+
+#include <glm/glm.hpp>
+
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+using namespace OloEngine; // NOLINT(google-build-using-namespace) — test file
+using OloEngine::Tests::BenchAssertEnabled;
+using OloEngine::Tests::EnsureTaskWorkers;
+using OloEngine::Tests::SecondsSince;
+
+namespace
+{
+    using Clock = std::chrono::high_resolution_clock;
+
+    // The scene asks for 64 samples per texel, sized for an in-editor bake;
+    // both modes trace the same paths, so fewer keeps the benchmark short
+    // without changing what it compares.
+    constexpr u32 kSamplesPerTexel = 16;
+
+    std::filesystem::path SandboxScenePath()
+    {
+        return std::filesystem::path{ OLO_TEST_EDITOR_ROOT } / "SandboxProject" / "Assets" / "Scenes" / "LightmapTest.olo";
+    }
+
+    Ref<MeshSource> MakePrimitive(MeshPrimitive primitive)
+    {
+        Ref<Mesh> mesh;
+        switch (primitive)
+        {
+            case MeshPrimitive::Cube:
+                mesh = MeshPrimitives::CreateCube();
+                break;
+            case MeshPrimitive::Sphere:
+                mesh = MeshPrimitives::CreateSphere();
+                break;
+            case MeshPrimitive::Plane:
+                mesh = MeshPrimitives::CreatePlane();
+                break;
+            case MeshPrimitive::Cylinder:
+                mesh = MeshPrimitives::CreateCylinder();
+                break;
+            default:
+                return nullptr;
+        }
+        return mesh ? mesh->GetMeshSource() : nullptr;
+    }
+
+    glm::vec3 ReadVec3(const YAML::Node& node, const glm::vec3& fallback)
+    {
+        if (!node || !node.IsSequence() || node.size() != 3)
+            return fallback;
+        return { node[0].as<f32>(), node[1].as<f32>(), node[2].as<f32>() };
+    }
+
+    // The bake inputs and reference world the editor would gather from the
+    // scene, built from one walk over its entities.
+    struct SandboxBake
+    {
+        LightmapBakeSettings Settings;
+        std::vector<LightmapBakeInput> Inputs;
+        std::vector<Ref<Material>> Materials; // alive until the world is built
+        PathTracing::ReferenceSceneBuilder Builder;
+        u32 PointLights = 0;
+    };
+
+    bool LoadSandboxBake(const std::filesystem::path& path, SandboxBake& out, std::string& outError)
+    {
+        YAML::Node root;
+        try
+        {
+            root = YAML::LoadFile(path.string());
+        }
+        catch (const YAML::Exception& e)
+        {
+            outError = e.what();
+            return false;
+        }
+
+        if (const YAML::Node lightmap = root["LightmapSettings"])
+        {
+            out.Settings.AtlasSize = lightmap["AtlasSize"].as<u32>(out.Settings.AtlasSize);
+            out.Settings.MaxBounces = lightmap["MaxBounces"].as<u32>(out.Settings.MaxBounces);
+            out.Settings.TexelsPerMeter = lightmap["TexelsPerMeter"].as<f32>(out.Settings.TexelsPerMeter);
+        }
+        out.Settings.SamplesPerTexel = kSamplesPerTexel;
+
+        for (const YAML::Node& entity : root["Entities"])
+        {
+            TransformComponent transform;
+            if (const YAML::Node node = entity["TransformComponent"])
+            {
+                transform.Translation = ReadVec3(node["Translation"], glm::vec3(0.0f));
+                transform.SetRotationEuler(ReadVec3(node["Rotation"], glm::vec3(0.0f)));
+                transform.Scale = ReadVec3(node["Scale"], glm::vec3(1.0f));
+            }
+
+            if (const YAML::Node light = entity["PointLightComponent"])
+            {
+                PointLightComponent point;
+                point.m_Color = ReadVec3(light["Color"], point.m_Color);
+                point.m_Intensity = light["Intensity"].as<f32>(point.m_Intensity);
+                point.m_Range = light["Range"].as<f32>(point.m_Range);
+                point.m_Attenuation = light["Attenuation"].as<f32>(point.m_Attenuation);
+                out.Builder.AddPointLight(point, transform.Translation);
+                ++out.PointLights;
+                continue;
+            }
+
+            const YAML::Node mesh = entity["MeshComponent"];
+            if (!mesh || !mesh["LightmapStatic"].as<bool>(false))
+                continue;
+
+            Ref<MeshSource> source = MakePrimitive(static_cast<MeshPrimitive>(mesh["Primitive"].as<i32>(0)));
+            if (!source)
+            {
+                outError = "unsupported lightmap-static mesh on entity " + entity["Entity"].as<std::string>("?");
+                return false;
+            }
+
+            glm::vec3 albedo(0.8f);
+            f32 metallic = 0.0f;
+            f32 roughness = 0.5f;
+            if (const YAML::Node material = entity["MaterialComponent"])
+            {
+                albedo = ReadVec3(material["AlbedoColor"], albedo);
+                metallic = material["Metallic"].as<f32>(metallic);
+                roughness = material["Roughness"].as<f32>(roughness);
+            }
+
+            LightmapBakeInput input;
+            input.EntityUUID = entity["Entity"].as<u64>(0);
+            input.Mesh = source;
+            input.WorldTransform = transform.GetTransform();
+            out.Inputs.push_back(input);
+            out.Materials.push_back(Material::CreatePBR("LightmapBenchmark", albedo, metallic, roughness));
+        }
+
+        if (out.Inputs.empty())
+        {
+            outError = "no lightmap-static entities";
+            return false;
+        }
+        return true;
+    }
+} // namespace
+
+TEST(LightmapBakerBenchmark, SandboxSceneRayStreamsVersusPerTexel)
+{
+    EnsureTaskWorkers();
+
+    SandboxBake sandbox;
+    std::string error;
+    ASSERT_TRUE(LoadSandboxBake(SandboxScenePath(), sandbox, error)) << SandboxScenePath().string() << ": " << error;
+    ASSERT_GT(sandbox.PointLights, 0u);
+
+    // Prepare unwraps the meshes in place, so the world is captured after it,
+    // as the editor does.
+    LightmapBakePrepared prepared;
+    ASSERT_TRUE(LightmapBaker::Prepare(sandbox.Inputs, sandbox.Settings, prepared, error)) << error;
+    for (sizet i = 0; i < sandbox.Inputs.size(); ++i)
+        sandbox.Builder.AddMeshEntity(sandbox.Inputs[i].Mesh, sandbox.Inputs[i].WorldTransform, sandbox.Materials[i].get());
+    const PathTracing::ReferenceScene world = sandbox.Builder.Build(PathTracing::ReferenceSceneBuildOptions{});
+
+    LightmapBakeSettings streamed = sandbox.Settings;
+    streamed.UseRayStreams = true;
+    auto start = Clock::now();
+    const LightmapBakeResult streamedBake = LightmapBaker::BakeTexels(prepared, world, streamed);
+    const f64 streamedSeconds = SecondsSince(start);
+    ASSERT_TRUE(streamedBake.Success) << streamedBake.Error;
+
+    LightmapBakeSettings perTexel = sandbox.Settings;
+    perTexel.UseRayStreams = false;
+    start = Clock::now();
+    const LightmapBakeResult perTexelBake = LightmapBaker::BakeTexels(prepared, world, perTexel);
+    const f64 perTexelSeconds = SecondsSince(start);
+    ASSERT_TRUE(perTexelBake.Success) << perTexelBake.Error;
+
+    // Ray streams only reorder the traversal; the texels are the same bits.
+    const auto& a = streamedBake.Asset->GetTexelData();
+    const auto& b = perTexelBake.Asset->GetTexelData();
+    ASSERT_EQ(a.size(), b.size());
+    EXPECT_EQ(std::memcmp(a.data(), b.data(), a.size() * sizeof(f32)), 0) << "ray streams changed the bake";
+
+    OLO_CORE_INFO("[LightmapBakerBenchmark] {}: {} charts, {} texels, {}x{} atlas, {} spp, {} bounces",
+                  SandboxScenePath().filename().string(), prepared.Charts.size(), prepared.Jobs.size(),
+                  sandbox.Settings.AtlasSize, sandbox.Settings.AtlasSize, sandbox.Settings.SamplesPerTexel,
+                  sandbox.Settings.MaxBounces);
+    OLO_CORE_INFO("[LightmapBakerBenchmark] ray streams {:.2f} s, per texel {:.2f} s ({:.2f}x)",
+                  streamedSeconds, perTexelSeconds, perTexelSeconds / streamedSeconds);
+
+    if (BenchAssertEnabled())
+    {
+        EXPECT_LT(streamedSeconds, perTexelSeconds) << "ray streams should beat the per-texel path on coherent bake rays";
+    }
+}
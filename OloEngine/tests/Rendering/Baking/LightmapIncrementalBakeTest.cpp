@@ -0,0 +1,387 @@
+// OLO_TEST_LAYER: L1
+// =============================================================================
+// LightmapIncrementalBakeTest.cpp
+//
+// Incremental lightmap re-bakes (LightmapBaker::PlanDependencies): a chart
+// whose recorded dependencies did not change keeps its previous texels, and
+// every other chart is re-traced. The scene is two pairs 60 m apart, each a
+// baked floor plus a world-only wall and a range-limited light, with a baked
+// prop on pair B's floor. Editing pair B must re-trace only pair B's charts,
+// and because no path from floor A can reach pair B, the incremental result
+// must match a full bake of the edited scene BIT FOR BIT — the reuse is not
+// allowed to be an approximation where the dependency test says it is exact.
+// Those cases opt into a finite DependencyRadius; the default is unbounded,
+// and a far occluder shows why: a sunlit floor whose shadow-caster moves 20 m
+// overhead is stale under a 16 m radius and exact under the default.
+// =============================================================================
+
+#include "OloEnginePCH.h"
+
+#include <gtest/gtest.h>
+
+#include "OloEngine/Core/Hash.h"
+#include "OloEngine/Renderer/Baking/LightmapBaker.h"
+#include "OloEngine/Renderer/MeshPrimitives.h"
+#include "OloEngine/Renderer/MeshSource.h"
+#include "OloEngine/Renderer/PathTracing/ReferenceSceneBuilder.h"
+#include "OloEngine/Scene/Components.h"
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <cstring>
+#include <limits>
+#include <vector>
+
+namespace OloEngine::Tests
+{
+    namespace
+    {
+        constexpr u64 kFloorAUuid = 0x4001;
+        constexpr u64 kFloorBUuid = 0x4002;
+        constexpr u64 kPropBUuid = 0x4003;
+        constexpr u64 kWallAUuid = 0x4101;
+        constexpr u64 kWallBUuid = 0x4102;
+        constexpr u64 kLightAUuid = 0x4201;
+        constexpr u64 kLightBUuid = 0x4202;
+        constexpr u64 kSunFloorUuid = 0x4301;
+        constexpr u64 kOccluderUuid = 0x4302;
+        constexpr u64 kSunUuid = 0x4303;
+
+        Ref<MeshSource> MakeCube()
+        {
+            Ref<Mesh> cube = MeshPrimitives::CreateCube();
+            return cube ? cube->GetMeshSource() : nullptr;
+        }
+
+        [[nodiscard]] glm::mat4 MakeTransform(const glm::vec3& translation, const glm::vec3& scale)
+        {
+            return glm::translate(glm::mat4(1.0f), translation) * glm::scale(glm::mat4(1.0f), scale);
+        }
+
+        // The editable state of the two-pair scene.
+        struct TwoPairs
+        {
+            glm::vec3 PropB{ 30.0f, 0.25f, 0.0f };
+            f32 LightAIntensity = 12.0f;
+        };
+
+        struct Bake
+        {
+            LightmapBakePrepared Prepared;
+            LightmapBakeResult Result;
+            u32 TracedCharts = 0;
+        };
+
+        LightmapBakeSettings MakeSettings()
+        {
+            LightmapBakeSettings settings;
+            settings.AtlasSize = 32;
+            settings.MinRegionSize = 8;
+            settings.SamplesPerTexel = 12;
+            settings.MaxBounces = 2;
+            settings.TexelsPerMeter = 1.5f;
+            settings.DilationPasses = 2;
+            settings.BakeKey = 0x1AC2'0439u;
+            // The pairs are 60 m apart; nothing crosses the walls between them.
+            settings.DependencyRadius = 16.0f;
+            return settings;
+        }
+
+        LightmapBakeDependency MakeSource(u64 id, const BoundingBox& bounds, const glm::mat4& transform, f32 extra = 0.0f)
+        {
+            u64 fingerprint = Hash::FNV1a64(&transform, sizeof(transform));
+            fingerprint = Hash::FNV1a64(&extra, sizeof(extra), fingerprint);
+            return { id, bounds, fingerprint };
+        }
+
+        // Bakes `scene`, optionally against a previous bake. Sources are built
+        // by hand the way SceneLightmapRuntime::GatherBakeDependencies would:
+        // mesh world bounds, light range boxes, a fingerprint per source.
+        Bake BakeTwoPairs(const TwoPairs& scene, const LightmapBakeSettings& settings, const Bake* previous = nullptr)
+        {
+            Bake bake;
+
+            const glm::mat4 floorA = MakeTransform({ -30.0f, -0.1f, 0.0f }, { 2.0f, 0.2f, 2.0f });
+            const glm::mat4 floorB = MakeTransform({ 30.0f, -0.1f, 0.0f }, { 2.0f, 0.2f, 2.0f });
+            const glm::mat4 propB = MakeTransform(scene.PropB, { 0.5f, 0.5f, 0.5f });
+            const glm::mat4 wallA = MakeTransform({ -28.8f, 1.4f, 0.0f }, { 0.2f, 3.0f, 2.0f });
+            const glm::mat4 wallB = MakeTransform({ 28.8f, 1.4f, 0.0f }, { 0.2f, 3.0f, 2.0f });
+            const glm::vec3 lightA(-30.0f, 1.5f, 0.0f);
+            const glm::vec3 lightB(30.0f, 1.5f, 0.0f);
+
+            std::vector<LightmapBakeInput> inputs;
+            inputs.push_back({ kFloorAUuid, MakeCube(), floorA });
+            inputs.push_back({ kFloorBUuid, MakeCube(), floorB });
+            inputs.push_back({ kPropBUuid, MakeCube(), propB });
+
+            // Walls sit between the pairs, so neither floor sees the other pair.
+            PathTracing::ReferenceSceneBuilder builder;
+            std::vector<Ref<Material>> materials; // keep alive until Build()
+            auto addPiece = [&](const Ref<MeshSource>& mesh, const glm::mat4& transform, const glm::vec3& baseColor)
+            {
+                Ref<Material> material = Material::CreatePBR("IncrementalBakePiece", baseColor, 0.0f, 0.9f);
+                materials.push_back(material);
+                builder.AddMeshEntity(mesh, transform, material.get());
+            };
+            for (const LightmapBakeInput& input : inputs)
+                addPiece(input.Mesh, input.WorldTransform, { 0.6f, 0.6f, 0.6f });
+            const Ref<MeshSource> wallMesh = MakeCube();
+            addPiece(wallMesh, wallA, { 0.7f, 0.05f, 0.05f });
+            addPiece(wallMesh, wallB, { 0.05f, 0.7f, 0.05f });
+
+            PointLightComponent light;
+            light.m_Color = { 1.0f, 1.0f, 1.0f };
+            light.m_Range = 10.0f;
+            light.m_Attenuation = 2.0f;
+            light.m_Intensity = scene.LightAIntensity;
+            builder.AddPointLight(light, lightA);
+            light.m_Intensity = 12.0f;
+            builder.AddPointLight(light, lightB);
+
+            const PathTracing::ReferenceScene world = builder.Build(PathTracing::ReferenceSceneBuildOptions{});
+
+            std::string error;
+            EXPECT_TRUE(LightmapBaker::Prepare(inputs, settings, bake.Prepared, error)) << error;
+
+            const BoundingBox unitCube(glm::vec3(-0.5f), glm::vec3(0.5f));
+            const glm::vec3 range(light.m_Range);
+            std::vector<LightmapBakeDependency> sources;
+            for (const LightmapBakeInput& input : inputs)
+                sources.push_back(MakeSource(input.EntityUUID, input.Mesh->GetBoundingBox().Transform(input.WorldTransform),
+                                             input.WorldTransform));
+            sources.push_back(MakeSource(kWallAUuid, unitCube.Transform(wallA), wallA));
+            sources.push_back(MakeSource(kWallBUuid, unitCube.Transform(wallB), wallB));
+            sources.push_back(MakeSource(kLightAUuid, BoundingBox(lightA - range, lightA + range), glm::mat4(1.0f), scene.LightAIntensity));
+            sources.push_back(MakeSource(kLightBUuid, BoundingBox(lightB - range, lightB + range), glm::mat4(1.0f), 12.0f));
+
+            bake.TracedCharts = LightmapBaker::PlanDependencies(bake.Prepared, sources, settings,
+                                                                previous ? &previous->Result.Record : nullptr,
+                                                                previous ? previous->Result.Asset : nullptr);
+            bake.Result = LightmapBaker::BakeTexels(bake.Prepared, world, settings);
+            EXPECT_TRUE(bake.Result.Success) << bake.Result.Error;
+            return bake;
+        }
+
+        // A sunlit floor with a world-only slab 20 m overhead — beyond a 16 m
+        // radius of the floor, yet its shadow is most of the floor's lighting.
+        Bake BakeSunlitFloor(const glm::vec3& occluder, const LightmapBakeSettings& settings, const Bake* previous = nullptr)
+        {
+            Bake bake;
+
+            const glm::mat4 floor = MakeTransform({ 0.0f, -0.1f, 0.0f }, { 4.0f, 0.2f, 4.0f });
+            const glm::mat4 slab = MakeTransform(occluder, { 8.0f, 0.5f, 8.0f });
+
+            std::vector<LightmapBakeInput> inputs;
+            inputs.push_back({ kSunFloorUuid, MakeCube(), floor });
+
+            PathTracing::ReferenceSceneBuilder builder;
+            Ref<Material> grey = Material::CreatePBR("IncrementalBakeFloor", glm::vec3(0.6f), 0.0f, 0.9f);
+            builder.AddMeshEntity(inputs[0].Mesh, floor, grey.get());
+            const Ref<MeshSource> slabMesh = MakeCube();
+            builder.AddMeshEntity(slabMesh, slab, grey.get());
+
+            DirectionalLightComponent sun;
+            sun.m_Direction = { 0.0f, -1.0f, 0.0f };
+            sun.m_Intensity = 3.0f;
+            builder.AddDirectionalLight(sun);
+
+            const PathTracing::ReferenceScene world = builder.Build(PathTracing::ReferenceSceneBuildOptions{});
+
+            std::string error;
+            EXPECT_TRUE(LightmapBaker::Prepare(inputs, settings, bake.Prepared, error)) << error;
+
+            const BoundingBox unitCube(glm::vec3(-0.5f), glm::vec3(0.5f));
+            const BoundingBox everywhere(glm::vec3(-std::numeric_limits<f32>::max()), glm::vec3(std::numeric_limits<f32>::max()));
+            const std::vector<LightmapBakeDependency> sources{
+                MakeSource(kSunFloorUuid, inputs[0].Mesh->GetBoundingBox().Transform(floor), floor),
+                MakeSource(kOccluderUuid, unitCube.Transform(slab), slab),
+                MakeSource(kSunUuid, everywhere, glm::mat4(1.0f), sun.m_Intensity),
+            };
+
+            bake.TracedCharts = LightmapBaker::PlanDependencies(bake.Prepared, sources, settings,
+                                                                previous ? &previous->Result.Record : nullptr,
+                                                                previous ? previous->Result.Asset : nullptr);
+            bake.Result = LightmapBaker::BakeTexels(bake.Prepared, world, settings);
+            EXPECT_TRUE(bake.Result.Success) << bake.Result.Error;
+            return bake;
+        }
+
+        [[nodiscard]] bool TexelsEqual(const Bake& a, const Bake& b)
+        {
+            const auto& ta = a.Result.Asset->GetTexelData();
+            const auto& tb = b.Result.Asset->GetTexelData();
+            return ta.size() == tb.size() && std::memcmp(ta.data(), tb.data(), ta.size() * sizeof(f32)) == 0;
+        }
+
+        [[nodiscard]] sizet ChartIndex(const LightmapBakePrepared& prepared, u64 uuid)
+        {
+            for (sizet i = 0; i < prepared.Entries.size(); ++i)
+            {
+                if (prepared.Entries[i].EntityUUID == uuid)
+                    return i;
+            }
+            return prepared.Entries.size();
+        }
+
+        [[nodiscard]] bool RegionsEqual(const Bake& a, const Bake& b, const LightmapAtlasRegion& region)
+        {
+            const auto& ta = a.Result.Asset->GetTexelData();
+            const auto& tb = b.Result.Asset->GetTexelData();
+            const u32 atlasSize = a.Prepared.AtlasSize;
+            for (u32 y = region.Y; y < region.Y + region.Size; ++y)
+            {
+                const sizet offset = (static_cast<sizet>(y) * atlasSize + region.X) * 4;
+                if (std::memcmp(ta.data() + offset, tb.data() + offset, static_cast<sizet>(region.Size) * 4 * sizeof(f32)) != 0)
+                    return false;
+            }
+            return true;
+        }
+    } // namespace
+
+    TEST(LightmapIncrementalBake, FirstBakeTracesEveryChartAndRecordsDependencies)
+    {
+        const Bake first = BakeTwoPairs(TwoPairs{}, MakeSettings());
+        ASSERT_TRUE(first.Result.Success);
+        EXPECT_EQ(first.TracedCharts, 3u);
+        EXPECT_EQ(first.Result.ReusedChartCount, 0u);
+
+        const LightmapBakeRecord& record = first.Result.Record;
+        ASSERT_EQ(record.Charts.size(), 3u);
+        for (const LightmapChartRecord& chart : record.Charts)
+        {
+            const bool pairA = chart.EntityUUID == kFloorAUuid;
+            const auto dependsOn = [&](u64 id)
+            { return std::find(chart.Dependencies.begin(), chart.Dependencies.end(), id) != chart.Dependencies.end(); };
+            EXPECT_TRUE(dependsOn(chart.EntityUUID));
+            EXPECT_EQ(dependsOn(kLightAUuid), pairA) << "chart " << chart.EntityUUID;
+            EXPECT_EQ(dependsOn(kLightBUuid), !pairA) << "chart " << chart.EntityUUID;
+            EXPECT_EQ(dependsOn(kPropBUuid), !pairA) << "chart " << chart.EntityUUID;
+        }
+    }
+
+    TEST(LightmapIncrementalBake, UnchangedSceneReusesEveryChart)
+    {
+        const LightmapBakeSettings settings = MakeSettings();
+        const Bake first = BakeTwoPairs(TwoPairs{}, settings);
+        const Bake second = BakeTwoPairs(TwoPairs{}, settings, &first);
+        ASSERT_TRUE(second.Result.Success);
+
+        EXPECT_EQ(second.TracedCharts, 0u);
+        EXPECT_EQ(second.Result.ReusedChartCount, 3u);
+        const auto& a = first.Result.Asset->GetTexelData();
+        const auto& b = second.Result.Asset->GetTexelData();
+        ASSERT_EQ(a.size(), b.size());
+        EXPECT_EQ(std::memcmp(a.data(), b.data(), a.size() * sizeof(f32)), 0);
+    }
+
+    TEST(LightmapIncrementalBake, MovingAPropRetracesOnlyTheChartsItCanReach)
+    {
+        const LightmapBakeSettings settings = MakeSettings();
+        const Bake first = BakeTwoPairs(TwoPairs{}, settings);
+
+        TwoPairs edited;
+        edited.PropB = glm::vec3(30.4f, 0.25f, 0.3f);
+        const Bake incremental = BakeTwoPairs(edited, settings, &first);
+        const Bake full = BakeTwoPairs(edited, settings);
+        ASSERT_TRUE(incremental.Result.Success);
+        ASSERT_TRUE(full.Result.Success);
+
+        // Floor A is out of reach of the prop; floor B and the prop itself
+        // are not.
+        EXPECT_EQ(incremental.TracedCharts, 2u);
+        EXPECT_EQ(incremental.Result.ReusedChartCount, 1u);
+
+        const sizet floorA = ChartIndex(incremental.Prepared, kFloorAUuid);
+        const sizet floorB = ChartIndex(incremental.Prepared, kFloorBUuid);
+        ASSERT_LT(floorA, incremental.Prepared.Regions.size());
+        ASSERT_LT(floorB, incremental.Prepared.Regions.size());
+        EXPECT_NE(incremental.Prepared.ReusedCharts[floorA], 0);
+        EXPECT_EQ(incremental.Prepared.ReusedCharts[floorB], 0);
+
+        EXPECT_TRUE(RegionsEqual(incremental, first, incremental.Prepared.Regions[floorA]));
+        EXPECT_FALSE(RegionsEqual(incremental, first, incremental.Prepared.Regions[floorB]))
+            << "floor B was re-traced with the prop moved, yet came out unchanged";
+
+        // Nothing from floor A reaches pair B, so the incremental result is
+        // exactly the full bake of the edited scene.
+        const auto& a = incremental.Result.Asset->GetTexelData();
+        const auto& b = full.Result.Asset->GetTexelData();
+        ASSERT_EQ(a.size(), b.size());
+        EXPECT_EQ(std::memcmp(a.data(), b.data(), a.size() * sizeof(f32)), 0)
+            << "the incremental bake diverged from a full bake of the edited scene";
+    }
+
+    TEST(LightmapIncrementalBake, ChangingALightRetracesTheChartsInItsRange)
+    {
+        const LightmapBakeSettings settings = MakeSettings();
+        const Bake first = BakeTwoPairs(TwoPairs{}, settings);
+
+        TwoPairs edited;
+        edited.LightAIntensity = 20.0f;
+        const Bake incremental = BakeTwoPairs(edited, settings, &first);
+        ASSERT_TRUE(incremental.Result.Success);
+
+        EXPECT_EQ(incremental.TracedCharts, 1u);
+        const sizet floorA = ChartIndex(incremental.Prepared, kFloorAUuid);
+        ASSERT_LT(floorA, incremental.Prepared.ReusedCharts.size());
+        EXPECT_EQ(incremental.Prepared.ReusedCharts[floorA], 0);
+    }
+
+    TEST(LightmapIncrementalBake, DifferentSettingsForceAFullBake)
+    {
+        const Bake first = BakeTwoPairs(TwoPairs{}, MakeSettings());
+
+        LightmapBakeSettings settings = MakeSettings();
+        settings.SamplesPerTexel += 4;
+        const Bake second = BakeTwoPairs(TwoPairs{}, settings, &first);
+        ASSERT_TRUE(second.Result.Success);
+
+        EXPECT_EQ(second.TracedCharts, 3u);
+        EXPECT_EQ(second.Result.ReusedChartCount, 0u);
+    }
+
+    TEST(LightmapIncrementalBake, DefaultRadiusMakesEverySourceADependency)
+    {
+        LightmapBakeSettings settings = MakeSettings();
+        settings.DependencyRadius = LightmapBakeSettings{}.DependencyRadius;
+        const Bake first = BakeTwoPairs(TwoPairs{}, settings);
+        ASSERT_TRUE(first.Result.Success);
+
+        // Even 60 m and a wall away, a source is a dependency: nothing is
+        // ruled out by distance unless the caller opts into a radius.
+        for (const LightmapChartRecord& chart : first.Result.Record.Charts)
+            EXPECT_EQ(chart.Dependencies.size(), first.Result.Record.Sources.size()) << "chart " << chart.EntityUUID;
+    }
+
+    TEST(LightmapIncrementalBake, FarOccluderChangeRetracesUnderTheDefaultRadius)
+    {
+        const glm::vec3 aside(40.0f, 20.0f, 0.0f);
+        const glm::vec3 overhead(0.0f, 20.0f, 0.0f);
+
+        LightmapBakeSettings settings = MakeSettings();
+        settings.DependencyRadius = LightmapBakeSettings{}.DependencyRadius;
+        const Bake full = BakeSunlitFloor(overhead, settings);
+        ASSERT_TRUE(full.Result.Success);
+
+        // Unbounded: the slab sliding over the floor re-traces it, and the
+        // result is exactly the full bake of the shadowed scene.
+        const Bake first = BakeSunlitFloor(aside, settings);
+        const Bake incremental = BakeSunlitFloor(overhead, settings, &first);
+        ASSERT_TRUE(incremental.Result.Success);
+        EXPECT_EQ(incremental.TracedCharts, 1u);
+        EXPECT_FALSE(TexelsEqual(first, full)) << "the slab should shadow the floor";
+        EXPECT_TRUE(TexelsEqual(incremental, full)) << "the incremental bake diverged from a full bake";
+
+        // A 16 m radius misses the slab 20 m up, so the same edit keeps the
+        // floor's sunlit texels: the staleness the finite radius opts into.
+        LightmapBakeSettings bounded = settings;
+        bounded.DependencyRadius = 16.0f;
+        const Bake boundedFirst = BakeSunlitFloor(aside, bounded);
+        const Bake boundedIncremental = BakeSunlitFloor(overhead, bounded, &boundedFirst);
+        ASSERT_TRUE(boundedIncremental.Result.Success);
+        EXPECT_EQ(boundedIncremental.TracedCharts, 0u);
+        EXPECT_TRUE(TexelsEqual(boundedIncremental, boundedFirst));
+        EXPECT_FALSE(TexelsEqual(boundedIncremental, full));
+    }
+} // namespace OloEngine::Tests
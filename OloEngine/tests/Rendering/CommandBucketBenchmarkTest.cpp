@@ -1,12 +1,14 @@
 #include "OloEnginePCH.h"
-#include "../TestOptions.h"
+#include "../TestTaskWorkers.h"
 #include <gtest/gtest.h>
 
 #include "RenderingTestUtils.h"
 #include "OloEngine/Renderer/Commands/CommandBucket.h"
 #include "OloEngine/Renderer/Commands/CommandAllocator.h"
+#include "OloEngine/Renderer/Commands/FrameDataBuffer.h"
 
 #include <chrono>
+#include <cmath>
 #include <cstdlib>
 #include <numeric>
 #include <random>
@@ -14,17 +16,12 @@
 #include <vector>
 
 using namespace OloEngine; // NOLINT(google-build-using-namespace) — test file
+using OloEngine::Tests::BenchAssertEnabled;
 
 // =============================================================================
 // Utilities
 // =============================================================================
 
-/// Whether --olo-bench-assert was passed.
-static bool BenchAssertEnabled()
-{
-    return OloEngine::Tests::Options().BenchAssert;
-}
-
 /// Populate a bucket with N random DrawMeshCommands using different shaders/materials.
 static void PopulateBucket(CommandBucket& bucket, CommandAllocator& allocator, u32 count, std::mt19937& rng)
 {
@@ -239,3 +236,247 @@ TEST(CommandBucketBenchmark, LargeCommandMemoryPressure)
 
     EXPECT_EQ(allocator.GetAllocationCount(), N);
 }
+
+// =============================================================================
+// Retained vs Rebuild — a mostly static scene
+// =============================================================================
+
+static constexpr u32 kSceneDraws = 20000;
+static constexpr u32 kSceneMeshes = 64;
+static constexpr u32 kSceneMaterials = 16;
+
+struct BenchSceneDraw
+{
+    DrawMeshCommand Command;
+    PacketMetadata Metadata;
+};
+
+/// A scene draw: mesh and material cycle with the index, depth drives the sort key.
+static void PlaceSceneDraw(BenchSceneDraw& draw, u32 index, u32 depth)
+{
+    u32 const mesh = index % kSceneMeshes;
+    u32 const material = 1 + (index / kSceneMeshes) % kSceneMaterials;
+    u32 const shader = 1 + material % 4;
+    draw.Command = MakeSyntheticDrawMeshCommand(shader, material, static_cast<f32>(depth) / static_cast<f32>(0xFFFFFF),
+                                                static_cast<i32>(index));
+    draw.Command.vertexArrayID = TestHandle(1 + mesh);
+    draw.Metadata.m_SortKey = MakeSyntheticOpaqueKey(0, ViewLayerType::ThreeD, shader, material, depth);
+}
+
+/// Draws a packet list covers, counting each instanced packet's instances.
+static u32 CountInstances(const std::vector<CommandPacket*>& packets)
+{
+    u32 instances = 0;
+    for (const auto* packet : packets)
+    {
+        if (packet->GetCommandType() == CommandType::DrawMeshInstanced)
+            instances += packet->GetCommandData<DrawMeshInstancedCommand>()->instanceCount;
+        else
+            ++instances;
+    }
+    return instances;
+}
+
+TEST(CommandBucketBenchmark, RetainedVersusRebuildPerFrame)
+{
+    // 5% of the draws move every frame; the rest are identical frame to frame.
+    constexpr u32 movedPerFrame = kSceneDraws / 20;
+    constexpr u32 framesCount = 30;
+
+    const bool ownsFrameData = !FrameDataBufferManager::IsInitialized();
+    if (ownsFrameData)
+        FrameDataBufferManager::Init();
+    FrameDataBuffer& frameData = FrameDataBufferManager::Get();
+
+    auto rng = MakeTestRNG();
+    std::uniform_int_distribution<u32> depthDist(0, 0xFFFFFF);
+    std::vector<BenchSceneDraw> scene(kSceneDraws);
+    for (u32 i = 0; i < kSceneDraws; ++i)
+        PlaceSceneDraw(scene[i], i, depthDist(rng));
+
+    // The same moves for both paths, generated up front and outside the timings.
+    std::vector<std::vector<std::pair<u32, u32>>> moves(framesCount);
+    for (u32 frame = 0; frame < framesCount; ++frame)
+    {
+        for (u32 k = 0; k < movedPerFrame; ++k)
+            moves[frame].emplace_back((frame * movedPerFrame + k * 7) % kSceneDraws, depthDist(rng));
+    }
+
+    CommandBucketConfig config;
+    config.InitialCapacity = kSceneDraws + 1024;
+    config.EnableSorting = true;
+    config.EnableBatching = true;
+
+    // Rebuild everything: submit, sort and batch every draw every frame.
+    f64 rebuildMs = 0.0;
+    std::vector<BenchSceneDraw> rebuildScene = scene;
+    CommandAllocator rebuildAllocator;
+    CommandBucket rebuildBucket(config);
+    for (u32 frame = 0; frame < framesCount; ++frame)
+    {
+        for (auto [index, depth] : moves[frame])
+            PlaceSceneDraw(rebuildScene[index], index, depth);
+
+        rebuildBucket.Reset(rebuildAllocator);
+        frameData.Reset();
+        auto start = Clock::now();
+        for (const auto& draw : rebuildScene)
+            rebuildBucket.Submit(draw.Command, draw.Metadata, &rebuildAllocator);
+        rebuildBucket.BatchCommands(rebuildAllocator);
+        rebuildMs += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    // Retained: one initial build, then only the moved draws each frame.
+    f64 retainedMs = 0.0;
+    std::vector<BenchSceneDraw> retainedScene = scene;
+    CommandAllocator retainedAllocator;
+    CommandBucket retainedBucket(config);
+    frameData.Reset();
+    auto buildStart = Clock::now();
+    for (u32 i = 0; i < kSceneDraws; ++i)
+        retainedBucket.SubmitRetained(RetainedDrawID{ i, 0 }, retainedScene[i].Command, retainedScene[i].Metadata);
+    retainedBucket.FlushRetained();
+    const f64 initialBuildMs = std::chrono::duration<double, std::milli>(Clock::now() - buildStart).count();
+
+    u32 rebuiltBatches = 0;
+    for (u32 frame = 0; frame < framesCount; ++frame)
+    {
+        for (auto [index, depth] : moves[frame])
+            PlaceSceneDraw(retainedScene[index], index, depth);
+
+        retainedBucket.Reset(retainedAllocator);
+        frameData.Reset();
+        auto start = Clock::now();
+        for (auto [index, depth] : moves[frame])
+            retainedBucket.SubmitRetained(RetainedDrawID{ index, 0 }, retainedScene[index].Command,
+                                          retainedScene[index].Metadata);
+        retainedBucket.FlushRetained();
+        retainedMs += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        rebuiltBatches += retainedBucket.GetRetainedStatistics().RebuiltBatches;
+    }
+
+    // Same frame either way: every draw present, the same batches, sorted.
+    const auto& rebuilt = rebuildBucket.GetSortedCommands();
+    const auto& retained = retainedBucket.GetRetainedPackets();
+    EXPECT_EQ(retainedBucket.GetRetainedCount(), kSceneDraws);
+    EXPECT_EQ(CountInstances(retained), kSceneDraws);
+    EXPECT_EQ(CountInstances(rebuilt), kSceneDraws);
+    EXPECT_EQ(retained.size(), rebuilt.size());
+
+    std::vector<DrawKey> keys;
+    keys.reserve(retained.size());
+    for (const auto* pkt : retained)
+        keys.push_back(pkt->GetMetadata().m_SortKey);
+    ExpectCommandOrder(keys);
+
+    const f64 rebuildPerFrame = rebuildMs / framesCount;
+    const f64 retainedPerFrame = retainedMs / framesCount;
+    std::cout << "[BENCHMARK] " << kSceneDraws << " draws, " << movedPerFrame << " moved/frame: rebuild "
+              << rebuildPerFrame << " ms/frame, retained " << retainedPerFrame << " ms/frame ("
+              << (rebuildPerFrame / retainedPerFrame) << "x), retained initial build " << initialBuildMs
+              << " ms, " << (rebuiltBatches / framesCount) << " of " << retained.size()
+              << " batches re-gathered/frame\n";
+
+    if (ownsFrameData)
+        FrameDataBufferManager::Shutdown();
+
+    if (BenchAssertEnabled())
+    {
+        EXPECT_LT(retainedPerFrame, rebuildPerFrame) << "Retained path must beat rebuilding a mostly static frame";
+    }
+}
+
+// =============================================================================
+// Retained vs Rebuild — a moving camera
+// =============================================================================
+
+TEST(CommandBucketBenchmark, RetainedVersusRebuildMovingCamera)
+{
+    // The camera sweeps through the scene, so every draw's view depth, and
+    // with it its sort key, changes every frame. Both paths see every draw
+    // every frame, the way Renderer3D::SubmitStaticPacket resubmits them.
+    constexpr u32 framesCount = 30;
+
+    const bool ownsFrameData = !FrameDataBufferManager::IsInitialized();
+    if (ownsFrameData)
+        FrameDataBufferManager::Init();
+    FrameDataBuffer& frameData = FrameDataBufferManager::Get();
+
+    auto rng = MakeTestRNG();
+    std::uniform_real_distribution<f32> positionDist(0.0f, 1.0f);
+    std::vector<f32> positions(kSceneDraws);
+    for (auto& position : positions)
+        position = positionDist(rng);
+
+    // The frame's draws, placed outside the timings.
+    std::vector<BenchSceneDraw> draws(kSceneDraws);
+    auto placeFrame = [&](u32 frame)
+    {
+        const f32 camera = static_cast<f32>(frame) / static_cast<f32>(framesCount - 1);
+        for (u32 i = 0; i < kSceneDraws; ++i)
+            PlaceSceneDraw(draws[i], i, static_cast<u32>(std::abs(positions[i] - camera) * 0xFFFFFF));
+    };
+
+    CommandBucketConfig config;
+    config.InitialCapacity = kSceneDraws + 1024;
+    config.EnableSorting = true;
+    config.EnableBatching = true;
+
+    f64 rebuildMs = 0.0;
+    CommandAllocator rebuildAllocator;
+    CommandBucket rebuildBucket(config);
+    for (u32 frame = 0; frame < framesCount; ++frame)
+    {
+        placeFrame(frame);
+        rebuildBucket.Reset(rebuildAllocator);
+        frameData.Reset();
+        auto start = Clock::now();
+        for (const auto& draw : draws)
+            rebuildBucket.Submit(draw.Command, draw.Metadata, &rebuildAllocator);
+        rebuildBucket.BatchCommands(rebuildAllocator);
+        rebuildMs += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    f64 retainedMs = 0.0;
+    u32 rekeyed = 0;
+    CommandAllocator retainedAllocator;
+    CommandBucket retainedBucket(config);
+    for (u32 frame = 0; frame < framesCount; ++frame)
+    {
+        placeFrame(frame);
+        retainedBucket.Reset(retainedAllocator);
+        frameData.Reset();
+        auto start = Clock::now();
+        for (u32 i = 0; i < kSceneDraws; ++i)
+            retainedBucket.SubmitRetained(RetainedDrawID{ i, 0 }, draws[i].Command, draws[i].Metadata);
+        retainedBucket.FlushRetained();
+        retainedMs += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        if (frame > 0)
+            rekeyed += retainedBucket.GetRetainedStatistics().Rekeyed;
+    }
+
+    const auto& rebuilt = rebuildBucket.GetSortedCommands();
+    const auto& retained = retainedBucket.GetRetainedPackets();
+    EXPECT_EQ(retainedBucket.GetRetainedCount(), kSceneDraws);
+    EXPECT_EQ(CountInstances(retained), kSceneDraws);
+    EXPECT_EQ(CountInstances(rebuilt), kSceneDraws);
+    EXPECT_EQ(retained.size(), rebuilt.size());
+
+    std::vector<DrawKey> keys;
+    keys.reserve(retained.size());
+    for (const auto* pkt : retained)
+        keys.push_back(pkt->GetMetadata().m_SortKey);
+    ExpectCommandOrder(keys);
+
+    const f64 rebuildPerFrame = rebuildMs / framesCount;
+    const f64 retainedPerFrame = retainedMs / framesCount;
+    std::cout << "[BENCHMARK] " << kSceneDraws << " draws, moving camera: rebuild " << rebuildPerFrame
+              << " ms/frame, retained " << retainedPerFrame << " ms/frame (" << (rebuildPerFrame / retainedPerFrame)
+              << "x), " << (rekeyed / (framesCount - 1)) << " draws re-keyed/frame\n";
+
+    if (ownsFrameData)
+        FrameDataBufferManager::Shutdown();
+
+    // No speed floor: this is the case RendererSettings::RetainedStaticDraws
+    // is off by default for. The figure is what to weigh before turning it on.
+}
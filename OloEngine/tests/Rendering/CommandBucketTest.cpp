@@ -1205,3 +1205,205 @@ TEST_F(CommandBucketBatchTest, SubmeshIndexRangesStaySeparateAndSurviveMerging)
         << kBaseB
         << " — without a merged command the baseIndex carry-over this test guards is never executed";
 }
+
+// =============================================================================
+// Retained (cross-frame) draws
+// =============================================================================
+
+namespace
+{
+    std::vector<u64> ExecutionKeys(const CommandBucket& bucket)
+    {
+        std::vector<u64> keys;
+        bucket.ForEachExecutionPacket([&keys](const CommandPacket* packet)
+                                      {
+                                          keys.push_back(packet->GetMetadata().m_SortKey.GetKey());
+                                      });
+        return keys;
+    }
+
+    PacketMetadata DepthKeyed(u32 depth)
+    {
+        PacketMetadata meta;
+        meta.m_SortKey = MakeSyntheticOpaqueKey(0, ViewLayerType::ThreeD, 1, 1, depth);
+        return meta;
+    }
+} // namespace
+
+TEST_F(CommandBucketTest, RetainedDrawsSurviveResetAndMergeByKey)
+{
+    CommandBucketConfig config;
+    config.EnableBatching = false;
+    CommandBucket bucket(config);
+
+    // Inserted out of order; the flush sorts them.
+    for (u32 depth : { 50u, 10u, 30u })
+        bucket.SubmitRetained(RetainedDrawID{ depth, 0 }, MakeSyntheticDrawMeshCommand(), DepthKeyed(depth));
+
+    // A new frame: the transient packets go, the retained ones stay.
+    bucket.Reset(*m_Allocator);
+    for (u32 depth : { 40u, 20u })
+        bucket.Submit(MakeSyntheticDrawMeshCommand(), DepthKeyed(depth), m_Allocator.get());
+    bucket.SortCommands();
+    bucket.FlushRetained();
+
+    EXPECT_EQ(bucket.GetRetainedCount(), 3u);
+    EXPECT_EQ(bucket.GetCommandCount(), 2u);
+    std::vector<u64> expected;
+    for (u32 depth : { 10u, 20u, 30u, 40u, 50u })
+        expected.push_back(DepthKeyed(depth).m_SortKey.GetKey());
+    EXPECT_EQ(ExecutionKeys(bucket), expected);
+
+    // Identical resubmission is free; a re-key merges the one draw into place.
+    bucket.Reset(*m_Allocator);
+    bucket.SubmitRetained(RetainedDrawID{ 30, 0 }, MakeSyntheticDrawMeshCommand(), DepthKeyed(30));
+    bucket.SubmitRetained(RetainedDrawID{ 10, 0 }, MakeSyntheticDrawMeshCommand(), DepthKeyed(60));
+    EXPECT_TRUE(bucket.RemoveRetained(RetainedDrawID{ 50, 0 }));
+    EXPECT_FALSE(bucket.RemoveRetained(RetainedDrawID{ 50, 0 }));
+    bucket.FlushRetained();
+
+    const auto stats = bucket.GetRetainedStatistics();
+    EXPECT_EQ(stats.Unchanged, 1u);
+    EXPECT_EQ(stats.Rekeyed, 1u);
+    EXPECT_EQ(stats.Removed, 1u);
+    EXPECT_EQ(stats.MergedDraws, 1u);
+    EXPECT_FALSE(bucket.IsRetained(RetainedDrawID{ 50, 0 }));
+    EXPECT_EQ(ExecutionKeys(bucket),
+              (std::vector<u64>{ DepthKeyed(30).m_SortKey.GetKey(), DepthKeyed(60).m_SortKey.GetKey() }));
+
+    bucket.ClearRetained();
+    bucket.FlushRetained();
+    EXPECT_EQ(bucket.GetRetainedCount(), 0u);
+    EXPECT_TRUE(ExecutionKeys(bucket).empty());
+}
+
+TEST_F(CommandBucketTest, RemoveStaleRetainedDropsDrawsNotResubmittedThisFrame)
+{
+    CommandBucketConfig config;
+    config.EnableBatching = false;
+    CommandBucket bucket(config);
+
+    for (u32 depth : { 10u, 20u, 30u })
+        bucket.SubmitRetained(RetainedDrawID{ depth, 0 }, MakeSyntheticDrawMeshCommand(), DepthKeyed(depth));
+    EXPECT_EQ(bucket.RemoveStaleRetained(), 0u) << "everything was submitted this frame";
+
+    // Next frame only two draws are resubmitted (the third was culled).
+    bucket.Reset(*m_Allocator);
+    bucket.SubmitRetained(RetainedDrawID{ 10, 0 }, MakeSyntheticDrawMeshCommand(), DepthKeyed(10));
+    bucket.SubmitRetained(RetainedDrawID{ 30, 0 }, MakeSyntheticDrawMeshCommand(), DepthKeyed(30));
+    EXPECT_EQ(bucket.RemoveStaleRetained(), 1u);
+    bucket.FlushRetained();
+
+    EXPECT_FALSE(bucket.IsRetained(RetainedDrawID{ 20, 0 }));
+    EXPECT_EQ(bucket.GetRetainedStatistics().Unchanged, 2u);
+    EXPECT_EQ(bucket.GetRetainedStatistics().Removed, 1u);
+    EXPECT_EQ(ExecutionKeys(bucket),
+              (std::vector<u64>{ DepthKeyed(10).m_SortKey.GetKey(), DepthKeyed(30).m_SortKey.GetKey() }));
+
+    // A frame with no submissions leaves nothing behind.
+    bucket.Reset(*m_Allocator);
+    EXPECT_EQ(bucket.RemoveStaleRetained(), 2u);
+    bucket.FlushRetained();
+    EXPECT_EQ(bucket.GetRetainedCount(), 0u);
+    EXPECT_TRUE(ExecutionKeys(bucket).empty());
+}
+
+TEST_F(CommandBucketBatchTest, RetainedStaticRunsReuseCachedBatches)
+{
+    CommandBucketConfig config;
+    config.EnableBatching = true;
+    CommandBucket bucket(config);
+
+    // Four instances of one mesh + one lone mesh.
+    auto submitRun = [&bucket](u32 entity, f32 x)
+    {
+        auto cmd = MakeSyntheticDrawMeshCommand(1, 1, 0.0f, static_cast<i32>(entity));
+        cmd.vertexArrayID = TestHandle(100u);
+        cmd.transform = glm::translate(glm::mat4(1.0f), glm::vec3(x, 0.0f, 0.0f));
+        bucket.SubmitRetained(RetainedDrawID{ entity, 0 }, cmd, DepthKeyed(entity));
+    };
+    for (u32 entity = 1; entity <= 4; ++entity)
+        submitRun(entity, static_cast<f32>(entity));
+    auto lone = MakeSyntheticDrawMeshCommand(2, 2);
+    lone.vertexArrayID = TestHandle(200u);
+    bucket.SubmitRetained(RetainedDrawID{ 9, 0 }, lone, DepthKeyed(9));
+    bucket.FlushRetained();
+
+    ASSERT_EQ(bucket.GetRetainedPackets().size(), 2u);
+    const CommandPacket* batched = bucket.GetRetainedPackets()[0];
+    ASSERT_EQ(batched->GetCommandType(), CommandType::DrawMeshInstanced);
+    EXPECT_EQ(batched->GetCommandData<DrawMeshInstancedCommand>()->instanceCount, 4u);
+    EXPECT_EQ(bucket.GetRetainedPackets()[1]->GetCommandType(), CommandType::DrawMesh);
+    EXPECT_EQ(bucket.GetRetainedStatistics().CachedBatches, 1u);
+
+    // A quiet frame: the batch is reused and only its instance data re-staged.
+    bucket.Reset(*m_Allocator);
+    FrameDataBufferManager::Get().Reset();
+    bucket.FlushRetained();
+    EXPECT_EQ(bucket.GetRetainedPackets()[0], batched);
+    EXPECT_EQ(bucket.GetRetainedStatistics().RebuiltBatches, 0u);
+    auto const* icmd = batched->GetCommandData<DrawMeshInstancedCommand>();
+    const glm::mat4* staged = FrameDataBufferManager::Get().GetTransformPtr(icmd->transformBufferOffset);
+    ASSERT_NE(staged, nullptr);
+
+    // Moving one member re-gathers only that batch.
+    bucket.Reset(*m_Allocator);
+    FrameDataBufferManager::Get().Reset();
+    submitRun(3, 30.0f);
+    bucket.FlushRetained();
+    EXPECT_EQ(bucket.GetRetainedStatistics().Updated, 1u);
+    EXPECT_EQ(bucket.GetRetainedStatistics().RebuiltBatches, 1u);
+    staged = FrameDataBufferManager::Get().GetTransformPtr(icmd->transformBufferOffset);
+    ASSERT_NE(staged, nullptr);
+    bool found = false;
+    for (u32 t = 0; t < icmd->instanceCount; ++t)
+        found = found || staged[t][3][0] == 30.0f;
+    EXPECT_TRUE(found) << "the moved instance's transform must be staged this frame";
+
+    // Breaking the run below two members turns the batch back into a plain draw.
+    for (u32 entity = 1; entity <= 3; ++entity)
+        bucket.RemoveRetained(RetainedDrawID{ entity, 0 });
+    bucket.FlushRetained();
+    ASSERT_EQ(bucket.GetRetainedPackets().size(), 2u);
+    EXPECT_EQ(bucket.GetRetainedPackets()[0]->GetCommandType(), CommandType::DrawMesh);
+    EXPECT_EQ(bucket.GetRetainedStatistics().CachedBatches, 0u);
+}
+
+TEST_F(CommandBucketBatchTest, RetainedBatchWithoutFrameDataRoomDrawsItsMembers)
+{
+    CommandBucketConfig config;
+    config.EnableBatching = true;
+    CommandBucket bucket(config);
+
+    for (u32 entity = 1; entity <= 4; ++entity)
+    {
+        auto cmd = MakeSyntheticDrawMeshCommand(1, 1, 0.0f, static_cast<i32>(entity));
+        cmd.vertexArrayID = TestHandle(100u);
+        bucket.SubmitRetained(RetainedDrawID{ entity, 0 }, cmd, DepthKeyed(entity));
+    }
+
+    // Exhaust the transform stream before the batch is staged.
+    FrameDataBuffer& fb = FrameDataBufferManager::Get();
+    const u32 remaining = static_cast<u32>(fb.GetTransformCapacity() - fb.GetTransformCount());
+    ASSERT_NE(fb.AllocateTransforms(remaining), UINT32_MAX);
+    bucket.FlushRetained();
+
+    // Nothing is dropped: the four members draw one by one, in key order.
+    ASSERT_EQ(bucket.GetRetainedPackets().size(), 4u);
+    for (const CommandPacket* packet : bucket.GetRetainedPackets())
+        EXPECT_EQ(packet->GetCommandType(), CommandType::DrawMesh);
+    std::vector<u64> expected;
+    for (u32 entity = 1; entity <= 4; ++entity)
+        expected.push_back(DepthKeyed(entity).m_SortKey.GetKey());
+    EXPECT_EQ(ExecutionKeys(bucket), expected);
+
+    // With room again the next frame, the cached batch stands in for them once more.
+    bucket.Reset(*m_Allocator);
+    fb.Reset();
+    bucket.FlushRetained();
+    ASSERT_EQ(bucket.GetRetainedPackets().size(), 1u);
+    const CommandPacket* batched = bucket.GetRetainedPackets()[0];
+    ASSERT_EQ(batched->GetCommandType(), CommandType::DrawMeshInstanced);
+    EXPECT_EQ(batched->GetCommandData<DrawMeshInstancedCommand>()->instanceCount, 4u);
+    EXPECT_EQ(bucket.GetRetainedStatistics().RebuiltBatches, 0u);
+}
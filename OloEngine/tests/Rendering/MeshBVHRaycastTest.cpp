@@ -9,6 +9,7 @@
 
 #include <glm/glm.hpp>
 
+#include <bit>
 #include <cmath>
 #include <vector>
 
@@ -678,6 +679,96 @@ TEST(MeshBVHParity, MatchesBruteForceOverSphere)
     ExpectBVHMatchesBruteForce(sphere, /*originCount*/ 32);
 }
 
+TEST(MeshBVHParity, MatchesBruteForceForAxisAlignedRaysOverSphere)
+{
+    // The cube above fits in a single leaf; this drives axis-aligned rays (the
+    // interval branch of the wide slab test) through a multi-level tree.
+    const MeshData sphere = MakeUVSphere(1.0f, 16, 24);
+    BoundingVolumeHierarchy bvh;
+    bvh.Build(sphere.Vertices.GetData(), static_cast<sizet>(sphere.Vertices.Num()),
+              sphere.Indices.GetData(), static_cast<sizet>(sphere.Indices.Num()));
+    ASSERT_TRUE(bvh.IsBuilt());
+
+    u32 hitCount = 0;
+    u32 missCount = 0;
+    for (i32 axis = 0; axis < 3; ++axis)
+    {
+        for (f32 sign : { -1.0f, 1.0f })
+        {
+            glm::vec3 dir(0.0f);
+            dir[axis] = sign;
+            for (i32 i = -13; i <= 13; ++i)
+            {
+                for (i32 j = -13; j <= 13; ++j)
+                {
+                    const f32 a = 0.1f * static_cast<f32>(i);
+                    const f32 b = 0.1f * static_cast<f32>(j);
+                    glm::vec3 origin = dir * -5.0f;
+                    origin[(axis + 1) % 3] = a;
+                    origin[(axis + 2) % 3] = b;
+                    const Ray ray(origin, dir, 0.0f, 100.0f);
+
+                    RayHit bvhHit;
+                    const RayHit reference = BruteForceClosest(sphere, ray);
+                    ASSERT_EQ(bvh.CastRay(ray, bvhHit), reference.Hit) << "axis " << axis << " offsets (" << a << "," << b << ")";
+                    ASSERT_EQ(bvh.CastRayAny(ray), reference.Hit);
+                    if (reference.Hit)
+                    {
+                        ++hitCount;
+                        EXPECT_NEAR(bvhHit.Distance, reference.Distance, kTol);
+                    }
+                    else
+                    {
+                        ++missCount;
+                    }
+                }
+            }
+        }
+    }
+
+    EXPECT_GT(hitCount, 0u);
+    EXPECT_GT(missCount, 0u);
+}
+
+TEST(MeshBVHBuild, ParallelBuildIsBitIdenticalToSingleThreaded)
+{
+    // Large enough for the build to fork subtree tasks and bin the root in
+    // parallel chunks. Every query result must match the single-threaded build
+    // to the bit — the path tracer's hash gate depends on it.
+    const MeshData sphere = MakeUVSphere(1.0f, 160, 320);
+
+    BoundingVolumeHierarchy parallel;
+    parallel.Build(sphere.Vertices.GetData(), static_cast<sizet>(sphere.Vertices.Num()),
+                   sphere.Indices.GetData(), static_cast<sizet>(sphere.Indices.Num()));
+
+    BVHBuildSettings serialSettings;
+    serialSettings.ForceSingleThread = true;
+    BoundingVolumeHierarchy serial;
+    serial.Build(sphere.Vertices.GetData(), static_cast<sizet>(sphere.Vertices.Num()),
+                 sphere.Indices.GetData(), static_cast<sizet>(sphere.Indices.Num()), serialSettings);
+
+    ASSERT_TRUE(parallel.IsBuilt());
+    EXPECT_EQ(parallel.GetNodeCount(), serial.GetNodeCount());
+    EXPECT_EQ(parallel.GetTriangleCount(), serial.GetTriangleCount());
+
+    const std::vector<glm::vec3> origins = FibonacciSphere(64, 3.0f);
+    const std::vector<glm::vec3> targets = FibonacciSphere(64, 1.1f);
+    for (const glm::vec3& origin : origins)
+    {
+        for (const glm::vec3& target : targets)
+        {
+            const Ray ray(origin, glm::normalize(target - origin), 0.0f, 100.0f);
+            RayHit a;
+            RayHit b;
+            ASSERT_EQ(parallel.CastRay(ray, a), serial.CastRay(ray, b));
+            EXPECT_EQ(a.TriangleIndex, b.TriangleIndex);
+            EXPECT_EQ(std::bit_cast<u32>(a.Distance), std::bit_cast<u32>(b.Distance));
+            EXPECT_EQ(std::bit_cast<u32>(a.U), std::bit_cast<u32>(b.U));
+            EXPECT_EQ(std::bit_cast<u32>(a.V), std::bit_cast<u32>(b.V));
+        }
+    }
+}
+
 // -----------------------------------------------------------------------------
 // Regression: heap-constructing a MeshSource by COPY must not corrupt the heap.
 //
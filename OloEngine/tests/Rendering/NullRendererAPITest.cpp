@@ -0,0 +1,221 @@
+// OLO_TEST_LAYER: unit
+// =============================================================================
+// NullRendererAPITest — the recording backend CPU-side render benchmarks run on.
+//
+// Pins:
+//   1. Create* mints live, correctly-kinded registry handles owned by
+//      Backend::Null; Delete* retires them; shutdown retires what is left.
+//   2. The stream hash depends only on what was recorded — two instances
+//      (different registry slots) recording the same calls agree, and any
+//      argument change disagrees.
+//   3. Turning capture off keeps counters and hash, drops only the stream.
+//   4. Stages time and hash exactly the commands recorded inside them.
+//   5. A CommandBucket executes through the real dispatch handlers into it.
+//
+// Pure CPU; no GL context, no CommandDispatch::Initialize.
+// =============================================================================
+
+#include "OloEnginePCH.h"
+#include <gtest/gtest.h>
+
+#include "RenderingTestUtils.h"
+#include "OloEngine/Renderer/Commands/CommandAllocator.h"
+#include "OloEngine/Renderer/Commands/CommandBucket.h"
+#include "OloEngine/Renderer/Commands/CommandDispatch.h"
+#include "OloEngine/Renderer/RHI/RHIResourceRegistry.h"
+#include "Platform/Null/NullRendererAPI.h"
+
+#include <array>
+
+using namespace OloEngine; // NOLINT(google-build-using-namespace) — test file
+
+namespace
+{
+    // A short, representative pass body: target setup, state, binds, draws.
+    void RecordPass(NullRendererAPI& api, u32 indexCount)
+    {
+        const RHI::ResourceHandle target = api.CreateTexture2DHandle(1280, 720, RHI::Format::RGBA8UNorm);
+        const RHI::ResourceHandle framebuffer = api.CreateFramebufferHandle();
+        const RHI::ResourceHandle vertexArray = api.CreateVertexArrayHandle();
+
+        api.AttachFramebufferColorTexture(framebuffer, 0, target, 0);
+        api.BindFramebuffer(framebuffer);
+        api.SetViewport(0, 0, 1280, 720);
+        api.SetClearColor({ 0.1f, 0.2f, 0.3f, 1.0f });
+        api.ClearColorAndDepth();
+        api.SetDepthTest(true);
+        api.SetDepthFunc(RHI::CompareOp::LessOrEqual);
+        api.PushDebugGroup(1, "Opaque");
+        api.BindVertexArrayRaw(vertexArray);
+        api.BindTexture(0, target);
+        api.DrawBoundIndexed(RHI::PrimitiveTopology::TriangleList, indexCount, RHI::IndexType::UInt32, 0);
+        api.PopDebugGroup();
+    }
+} // namespace
+
+TEST(NullRendererAPI, MintsAndRetiresRegistryHandles)
+{
+    auto& registry = RHI::ResourceRegistry::Get();
+    NullRendererAPI api;
+
+    const RHI::ResourceHandle texture = api.CreateTexture2DHandle(256, 128, RHI::Format::RGBA16Float);
+    const RHI::ResourceHandle buffer = api.CreateBufferHandle();
+    ASSERT_TRUE(texture.IsValid());
+    ASSERT_TRUE(buffer.IsValid());
+    EXPECT_TRUE(registry.IsLive(texture));
+    EXPECT_EQ(registry.KindOf(texture), RHI::ResourceKind::Texture);
+    EXPECT_EQ(registry.KindOf(buffer), RHI::ResourceKind::Buffer);
+    EXPECT_EQ(registry.ResolveTaggedForBackend(texture).Owner, RHI::Backend::Null);
+    EXPECT_EQ(api.GetLiveResourceCount(), 2u);
+
+    u32 width = 0;
+    u32 height = 0;
+    api.GetTextureDimensions(texture, 1, width, height);
+    EXPECT_EQ(width, 128u);
+    EXPECT_EQ(height, 64u);
+
+    RHI::TextureFormatInfo info;
+    ASSERT_TRUE(api.QueryTextureFormat(texture, 0, info));
+    EXPECT_EQ(info.Neutral, RHI::Format::RGBA16Float);
+
+    // Callers write through a persistent mapping every frame.
+    auto* mapped = static_cast<u8*>(api.AllocatePersistentUploadStorage(buffer, 64));
+    ASSERT_NE(mapped, nullptr);
+    mapped[63] = 0xAB;
+
+    api.DeleteTexture(texture);
+    EXPECT_FALSE(registry.IsLive(texture));
+    EXPECT_EQ(api.GetLiveResourceCount(), 1u);
+
+    api.ShutdownGpuResources();
+    EXPECT_FALSE(registry.IsLive(buffer));
+    EXPECT_EQ(api.GetLiveResourceCount(), 0u);
+}
+
+TEST(NullRendererAPI, StreamHashDependsOnlyOnTheRecordedCalls)
+{
+    NullRendererAPI first;
+    RecordPass(first, 36);
+
+    // A second instance gets different registry slots for the same calls.
+    NullRendererAPI second;
+    RecordPass(second, 36);
+    EXPECT_EQ(first.GetStreamHash(), second.GetStreamHash());
+    EXPECT_EQ(first.GetCommandCount(), second.GetCommandCount());
+
+    NullRendererAPI changed;
+    RecordPass(changed, 37);
+    EXPECT_NE(first.GetStreamHash(), changed.GetStreamHash());
+
+    // The capture is what localises a regression: the first differing command.
+    const auto& a = first.GetCommands();
+    const auto& b = changed.GetCommands();
+    ASSERT_EQ(a.size(), b.size());
+    sizet divergent = a.size();
+    for (sizet i = 0; i < a.size() && divergent == a.size(); ++i)
+    {
+        if (first.DescribeCommand(i) != changed.DescribeCommand(i))
+            divergent = i;
+    }
+    ASSERT_LT(divergent, a.size());
+    EXPECT_EQ(a[divergent].Op, NullCommand::DrawBoundIndexed);
+    EXPECT_EQ(changed.DescribeCommand(divergent).rfind("DrawBoundIndexed(", 0), 0u);
+
+    // Debug-group labels are part of the stream too.
+    NullRendererAPI labelled;
+    labelled.PushDebugGroup(1, "Opaque");
+    NullRendererAPI relabelled;
+    relabelled.PushDebugGroup(1, "Transparent");
+    EXPECT_NE(labelled.GetStreamHash(), relabelled.GetStreamHash());
+
+    first.ResetRecording();
+    EXPECT_EQ(first.GetStreamHash(), NullRendererAPI().GetStreamHash());
+    EXPECT_EQ(first.GetCommandCount(), 0u);
+}
+
+TEST(NullRendererAPI, CaptureOffKeepsCountersAndHash)
+{
+    NullRendererAPI captured;
+    NullRendererAPI uncaptured;
+    uncaptured.SetCaptureEnabled(false);
+
+    RecordPass(captured, 36);
+    RecordPass(uncaptured, 36);
+
+    EXPECT_EQ(captured.GetStreamHash(), uncaptured.GetStreamHash());
+    EXPECT_EQ(captured.GetDrawCallCount(), 1u);
+    EXPECT_EQ(uncaptured.GetDrawCallCount(), 1u);
+    EXPECT_EQ(uncaptured.GetCallCount(NullCommand::BindFramebuffer), 1u);
+    EXPECT_FALSE(captured.GetCommands().empty());
+    EXPECT_TRUE(uncaptured.GetCommands().empty());
+    EXPECT_TRUE(uncaptured.GetArguments().empty());
+}
+
+TEST(NullRendererAPI, StagesAttributeTheirCommands)
+{
+    NullRendererAPI api;
+    {
+        NullRendererAPI::ScopedStage frame(api, "Frame");
+        api.SetViewport(0, 0, 64, 64);
+        {
+            NullRendererAPI::ScopedStage pass(api, "Pass");
+            RecordPass(api, 36);
+        }
+    }
+
+    const auto& stages = api.GetStages();
+    ASSERT_EQ(stages.size(), 2u);
+    EXPECT_EQ(stages[0].Name, "Frame");
+    EXPECT_EQ(stages[1].Name, "Pass");
+    EXPECT_EQ(stages[0].CommandCount, api.GetCommandCount());
+    EXPECT_EQ(stages[1].CommandCount, api.GetCommandCount() - 1);
+    EXPECT_GE(stages[0].Milliseconds, stages[1].Milliseconds);
+
+    // A stage's hash is the hash that stage alone would produce.
+    NullRendererAPI passOnly;
+    RecordPass(passOnly, 36);
+    EXPECT_EQ(stages[1].StreamHash, passOnly.GetStreamHash());
+    EXPECT_EQ(stages[0].StreamHash, api.GetStreamHash());
+}
+
+TEST(NullRendererAPI, ExecutesACommandBucketThroughTheDispatchHandlers)
+{
+    CommandAllocator allocator;
+    CommandBucketConfig config;
+    config.EnableSorting = true;
+    config.EnableBatching = false;
+    CommandBucket bucket(config);
+
+    PacketMetadata first;
+    first.m_ExecutionOrder = 0;
+    first.m_DependsOnPrevious = true;
+    PacketMetadata second = first;
+    second.m_ExecutionOrder = 1;
+
+    bucket.Submit(MakeSyntheticViewportCommand(0, 0, 1920, 1080), first, &allocator)
+        ->SetDispatchFunction(&CommandDispatch::SetViewport);
+    bucket.Submit(MakeSyntheticDepthTestCommand(true), second, &allocator)
+        ->SetDispatchFunction(&CommandDispatch::SetDepthTest);
+    bucket.SortCommands();
+
+    NullRendererAPI api;
+    bucket.Execute(api);
+
+    ASSERT_EQ(api.GetCommandCount(), 2u);
+    EXPECT_EQ(api.GetCommands()[0].Op, NullCommand::SetViewport);
+    EXPECT_EQ(api.GetCommands()[1].Op, NullCommand::SetDepthTest);
+    EXPECT_EQ(api.GetViewport().width, 1920u);
+    EXPECT_EQ(api.GetViewport().height, 1080u);
+    EXPECT_FALSE(api.IsDeviceAvailable());
+}
+
+TEST(NullRendererAPI, IsSelectableThroughRendererAPICreate)
+{
+    const RendererAPI::API previous = RendererAPI::GetAPI();
+    RendererAPI::SetAPI(RendererAPI::API::Null);
+    const Scope<RendererAPI> api = RendererAPI::Create();
+    RendererAPI::SetAPI(previous);
+
+    ASSERT_NE(api, nullptr);
+    EXPECT_NE(dynamic_cast<NullRendererAPI*>(api.get()), nullptr);
+}
@@ -0,0 +1,363 @@
+// OLO_TEST_LAYER: unit
+#include "OloEnginePCH.h"
+#include "../TestTaskWorkers.h"
+#include "RenderingTestUtils.h"
+#include <gtest/gtest.h>
+
+// =============================================================================
+// NullRendererFrameBenchmarkTest
+//
+// A full CommandBucket frame — submit, sort, batch, execute through the real
+// CommandDispatch handlers — with the process-global backend swapped for the
+// recording NullRendererAPI, so it runs on GPU-less CI. Reports per-stage wall
+// time, and pins that replaying the same frame yields the same command-stream
+// hash (the regression signal) and that the dispatch caches elide redundant
+// VAO binds. Throughput floors only under --olo-bench-assert.
+//
+// The second case renders a real Scene on the same backend: Renderer::Init
+// through the Null resource factories, then Scene::OnUpdateRuntime into
+// Renderer3D mesh submission, pass setup, RenderGraph::BuildFrameGraph and
+// Execute. Per-stage times come from the engine's own OLO_PERF_SCOPE_AUTO
+// scopes via a detached PerformanceProfiler (compiled out in Dist builds).
+// =============================================================================
+
+#include "OloEngine/Core/PerformanceProfiler.h"
+#include "OloEngine/Core/Timestep.h"
+#include "OloEngine/Renderer/Commands/CommandAllocator.h"
+#include "OloEngine/Renderer/Commands/CommandBucket.h"
+#include "OloEngine/Renderer/Commands/CommandDispatch.h"
+#include "OloEngine/Renderer/MeshPrimitives.h"
+#include "OloEngine/Renderer/RenderCommand.h"
+#include "OloEngine/Renderer/Renderer.h"
+#include "OloEngine/Renderer/Renderer3D.h"
+#include "OloEngine/Scene/Components.h"
+#include "OloEngine/Scene/Entity.h"
+#include "OloEngine/Scene/Scene.h"
+#include "Platform/Null/NullRendererAPI.h"
+
+#include <glm/gtc/constants.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace OloEngine; // NOLINT(google-build-using-namespace) — test file
+using OloEngine::Tests::BenchAssertEnabled;
+
+namespace
+{
+    // The dispatch handlers bind through the RenderCommand statics, so the
+    // PROCESS-GLOBAL backend has to be the null one for the duration.
+    struct ScopedNullBackend
+    {
+        ScopedNullBackend()
+            : Previous(RendererAPI::GetAPI())
+        {
+            RendererAPI::SetAPI(RendererAPI::API::Null);
+            RenderCommand::RecreateForSelectedBackend();
+        }
+        ~ScopedNullBackend()
+        {
+            RendererAPI::SetAPI(Previous);
+            RenderCommand::RecreateForSelectedBackend();
+        }
+
+        [[nodiscard]] NullRendererAPI& API() const
+        {
+            return static_cast<NullRendererAPI&>(RenderCommand::GetRendererAPI());
+        }
+
+        RendererAPI::API Previous;
+    };
+
+    constexpr u32 kDraws = 20000;
+    constexpr u32 kMeshes = 256;
+    constexpr u32 kShaders = 32;
+
+    struct FrameResult
+    {
+        u64 StreamHash = 0;
+        u64 Commands = 0;
+        u64 Draws = 0;
+        u64 VertexArrayBinds = 0;
+    };
+
+    FrameResult RunFrame(NullRendererAPI& api, CommandBucket& bucket, CommandAllocator& allocator,
+                         const std::vector<RHI::ResourceHandle>& vertexArrays)
+    {
+        CommandDispatch::ResetState();
+        bucket.Reset(allocator);
+        api.ResetRecording();
+
+        NullRendererAPI::ScopedStage frame(api, "Frame");
+        {
+            NullRendererAPI::ScopedStage stage(api, "Submit");
+
+            PacketMetadata setup;
+            setup.m_SortKey = MakeSyntheticCustomKey(0, ViewLayerType::ThreeD, 0);
+            bucket.Submit(MakeSyntheticViewportCommand(0, 0, 1920, 1080), setup, &allocator)
+                ->SetDispatchFunction(&CommandDispatch::SetViewport);
+            bucket.Submit(MakeSyntheticClearCommand(), setup, &allocator)
+                ->SetDispatchFunction(&CommandDispatch::Clear);
+            bucket.Submit(MakeSyntheticDepthTestCommand(true), setup, &allocator)
+                ->SetDispatchFunction(&CommandDispatch::SetDepthTest);
+
+            // Seeded per frame: the same frame every time.
+            std::mt19937 rng(1234u);
+            std::uniform_int_distribution<u32> meshDist(0, kMeshes - 1);
+            std::uniform_int_distribution<u32> depthDist(0, 0xFFFFFF);
+            for (u32 i = 0; i < kDraws; ++i)
+            {
+                const u32 mesh = meshDist(rng);
+                DrawIndexedCommand draw{};
+                draw.header.type = CommandType::DrawIndexed;
+                draw.vertexArrayID = vertexArrays[mesh];
+                draw.indexCount = 36 + mesh * 3;
+                draw.indexType = RHI::IndexType::UInt32;
+
+                PacketMetadata meta;
+                meta.m_SortKey = MakeSyntheticOpaqueKey(0, ViewLayerType::ThreeD, 1 + mesh % kShaders, 1 + mesh, depthDist(rng));
+                bucket.Submit(draw, meta, &allocator)->SetDispatchFunction(&CommandDispatch::DrawIndexed);
+            }
+        }
+        {
+            NullRendererAPI::ScopedStage stage(api, "Sort");
+            bucket.SortCommands();
+        }
+        {
+            NullRendererAPI::ScopedStage stage(api, "Batch");
+            bucket.BatchCommands(allocator);
+        }
+        {
+            NullRendererAPI::ScopedStage stage(api, "Execute");
+            bucket.Execute(api);
+        }
+
+        return { api.GetStreamHash(), api.GetCommandCount(), api.GetDrawCallCount(),
+                 api.GetCallCount(NullCommand::BindVertexArrayRaw) };
+    }
+} // namespace
+
+TEST(NullRendererFrameBenchmark, FrameIsReproducibleAndStagesAreTimed)
+{
+    ScopedNullBackend backend;
+    NullRendererAPI& api = backend.API();
+    api.SetCaptureEnabled(false);
+
+    std::vector<RHI::ResourceHandle> vertexArrays;
+    for (u32 i = 0; i < kMeshes; ++i)
+        vertexArrays.push_back(api.CreateVertexArrayHandle());
+
+    CommandAllocator allocator;
+    CommandBucketConfig config;
+    config.InitialCapacity = kDraws + 16;
+    config.EnableSorting = true;
+    config.EnableBatching = true;
+    CommandBucket bucket(config);
+
+    const FrameResult first = RunFrame(api, bucket, allocator, vertexArrays);
+
+    // Best of a few for the timings; every replay must hash identically.
+    constexpr u32 kFrames = 5;
+    std::vector<NullRendererAPI::StageRecord> best;
+    for (u32 i = 0; i < kFrames; ++i)
+    {
+        const FrameResult replay = RunFrame(api, bucket, allocator, vertexArrays);
+        EXPECT_EQ(replay.StreamHash, first.StreamHash) << "frame " << i << " diverged";
+        EXPECT_EQ(replay.Commands, first.Commands) << "frame " << i;
+
+        const auto& stages = api.GetStages();
+        if (best.empty())
+            best = stages;
+        for (sizet s = 0; s < stages.size() && s < best.size(); ++s)
+            best[s].Milliseconds = std::min(best[s].Milliseconds, stages[s].Milliseconds);
+    }
+
+    EXPECT_EQ(first.Draws, kDraws);
+    // Sorted by shader then material (one material per mesh), so each VAO is
+    // bound once, not once per draw.
+    EXPECT_LE(first.VertexArrayBinds, kMeshes);
+
+    ASSERT_EQ(best.size(), 5u);
+    for (const auto& stage : best)
+    {
+        OLO_CORE_INFO("[NullRendererFrameBenchmark] {:>8}: {:8.3f} ms, {:6} commands", stage.Name, stage.Milliseconds,
+                      stage.CommandCount);
+    }
+    const f64 frameMs = best[0].Milliseconds;
+    OLO_CORE_INFO("[NullRendererFrameBenchmark] {} draws -> {} commands ({} VAO binds), hash {:#018x}, "
+                  "{:.0f} draws/s",
+                  kDraws, first.Commands, first.VertexArrayBinds, first.StreamHash,
+                  static_cast<f64>(kDraws) / (frameMs / 1000.0));
+
+    for (const RHI::ResourceHandle vertexArray : vertexArrays)
+        api.DeleteVertexArray(vertexArray);
+
+    if (BenchAssertEnabled())
+        EXPECT_GT(static_cast<f64>(kDraws) / (frameMs / 1000.0), 1.0e6) << "CPU frame throughput";
+}
+
+namespace
+{
+    constexpr u32 kSceneWidth = 1280;
+    constexpr u32 kSceneHeight = 720;
+    constexpr u32 kGrid = 24; // kGrid^2 cube entities
+    constexpr u32 kPointLights = 16;
+
+    // The engine scopes a Scene frame passes through, in pipeline order.
+    constexpr std::array kEngineStages = {
+        "Scene::ProcessScene3DSharedLogic",
+        "Renderer3D::EndScene",
+        "Renderer3D::ConfigurePassesForFrame",
+        "Renderer3D::PopulateBlackboard",
+        "Renderer3D::UploadExecutionState",
+        "RG::BuildFrameGraph",
+        "RG::BuildFrameGraph/SetupLoop",
+        "RG::Execute",
+    };
+
+    void BuildBenchmarkScene(Scene& scene)
+    {
+        Entity camera = scene.CreateEntity("MainCamera");
+        auto& cameraTransform = camera.GetComponent<TransformComponent>();
+        cameraTransform.Translation = { 0.0f, 12.0f, 40.0f };
+        cameraTransform.SetRotationEuler({ -0.3f, 0.0f, 0.0f });
+        camera.AddComponent<CameraComponent>().Primary = true;
+
+        Entity sun = scene.CreateEntity("Sun");
+        auto& directional = sun.AddComponent<DirectionalLightComponent>();
+        directional.m_Direction = glm::normalize(glm::vec3(-0.4f, -1.0f, -0.3f));
+        directional.m_Intensity = 3.0f;
+
+        // One shared cube source: the instancing and retained-draw paths see
+        // the same mesh many times, as they would in a real level.
+        const Ref<Mesh> cube = MeshPrimitives::CreateCube();
+        ASSERT_TRUE(cube);
+        for (u32 z = 0; z < kGrid; ++z)
+        {
+            for (u32 x = 0; x < kGrid; ++x)
+            {
+                Entity entity = scene.CreateEntity("Cube");
+                auto& transform = entity.GetComponent<TransformComponent>();
+                transform.Translation = { (static_cast<f32>(x) - kGrid * 0.5f) * 2.5f, 0.0f,
+                                          (static_cast<f32>(z) - kGrid * 0.5f) * 2.5f };
+
+                auto& mesh = entity.AddComponent<MeshComponent>();
+                mesh.m_Primitive = MeshPrimitive::Cube;
+                mesh.m_MeshSource = cube->GetMeshSource();
+
+                auto& material = entity.AddComponent<MaterialComponent>();
+                material.m_Material.SetBaseColorFactor(glm::vec4((x % 4) * 0.25f, (z % 4) * 0.25f, 0.5f, 1.0f));
+                material.m_Material.SetRoughnessFactor(0.2f + 0.6f * static_cast<f32>((x + z) % 3) / 2.0f);
+            }
+        }
+
+        for (u32 i = 0; i < kPointLights; ++i)
+        {
+            Entity light = scene.CreateEntity("PointLight");
+            const f32 angle = static_cast<f32>(i) / kPointLights * glm::two_pi<f32>();
+            light.GetComponent<TransformComponent>().Translation = { std::cos(angle) * 20.0f, 3.0f, std::sin(angle) * 20.0f };
+            auto& point = light.AddComponent<PointLightComponent>();
+            point.m_Intensity = 6.0f;
+            point.m_Range = 15.0f;
+        }
+    }
+} // namespace
+
+TEST(NullRendererFrameBenchmark, SceneFrameRunsThroughRenderer3DAndStagesAreTimed)
+{
+    // The renderer is process-wide. If an earlier test brought it up on a
+    // real backend, its resources cannot be recreated under this one.
+    if (Renderer3D::HasInitialized())
+        GTEST_SKIP() << "Renderer3D is already initialized on another backend in this process.";
+
+    ScopedNullBackend backend;
+    PerformanceProfiler profiler;
+    SetDetachedPerformanceProfiler(&profiler);
+
+    Renderer::Init(RendererType::Renderer3D, /*loadingWindow=*/nullptr);
+    NullRendererAPI& api = backend.API();
+    api.SetCaptureEnabled(false);
+
+    {
+        Ref<Scene> scene = Scene::Create();
+        BuildBenchmarkScene(*scene);
+        scene->SetIs3DModeEnabled(true);
+        scene->OnViewportResize(kSceneWidth, kSceneHeight);
+        Renderer3D::OnWindowResize(kSceneWidth, kSceneHeight);
+        scene->SetRenderingEnabled(true);
+
+        const Timestep ts{ 1.0f / 60.0f };
+
+        // Warm-up: the first frames build pass caches, pooled targets and
+        // the frame-graph fingerprint; they are not what a steady frame costs.
+        constexpr u32 kWarmupFrames = 3;
+        for (u32 i = 0; i < kWarmupFrames; ++i)
+        {
+            scene->OnUpdateRuntime(ts);
+            profiler.EndFrame();
+        }
+
+        constexpr u32 kFrames = 5;
+        f64 bestFrameMs = 0.0;
+        u64 commands = 0;
+        u64 draws = 0;
+        u64 dispatches = 0;
+        std::vector<f32> bestStageMs(kEngineStages.size(), 0.0f);
+        for (u32 i = 0; i < kFrames; ++i)
+        {
+            api.ResetRecording();
+            {
+                NullRendererAPI::ScopedStage frame(api, "Frame");
+                scene->OnUpdateRuntime(ts);
+            }
+            profiler.EndFrame();
+
+            const f64 frameMs = api.GetStages().front().Milliseconds;
+            if (i == 0 || frameMs < bestFrameMs)
+                bestFrameMs = frameMs;
+
+            const auto& engineStages = profiler.GetPreviousFrameData();
+            for (sizet s = 0; s < kEngineStages.size(); ++s)
+            {
+                const auto it = engineStages.find(kEngineStages[s]);
+                const f32 stageMs = it != engineStages.end() ? it->second.Time : 0.0f;
+                if (i == 0 || stageMs < bestStageMs[s])
+                    bestStageMs[s] = stageMs;
+            }
+
+            // A static scene with readbacks that always answer zero: every
+            // steady frame issues the same amount of work.
+            if (i == 0)
+            {
+                commands = api.GetCommandCount();
+                draws = api.GetDrawCallCount();
+                dispatches = api.GetDispatchCount();
+            }
+            else
+            {
+                EXPECT_EQ(api.GetDrawCallCount(), draws) << "frame " << i;
+                EXPECT_EQ(api.GetDispatchCount(), dispatches) << "frame " << i;
+            }
+        }
+
+        EXPECT_GT(commands, 0u) << "the Scene frame recorded nothing";
+        EXPECT_GT(draws, 0u) << "the Scene frame issued no draws";
+
+        OLO_CORE_INFO("[NullRendererFrameBenchmark] Scene frame ({} cubes, {} point lights, {}x{}): {:8.3f} ms, "
+                      "{} commands, {} draws, {} dispatches",
+                      kGrid * kGrid, kPointLights, kSceneWidth, kSceneHeight, bestFrameMs, commands, draws, dispatches);
+        for (sizet s = 0; s < kEngineStages.size(); ++s)
+        {
+            OLO_CORE_INFO("[NullRendererFrameBenchmark] {:>38}: {:8.3f} ms", kEngineStages[s], bestStageMs[s]);
+        }
+
+        if (BenchAssertEnabled())
+            EXPECT_LT(bestFrameMs, 33.0) << "CPU cost of a Scene frame on the Null backend";
+    }
+
+    Renderer::Shutdown();
+    SetDetachedPerformanceProfiler(nullptr);
+}
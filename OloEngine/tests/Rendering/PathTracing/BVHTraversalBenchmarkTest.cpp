@@ -0,0 +1,294 @@
+// OLO_TEST_LAYER: unit
+#include "OloEnginePCH.h"
+#include "../../TestTaskWorkers.h"
+#include <gtest/gtest.h>
+
+// =============================================================================
+// BVHTraversalBenchmarkTest
+//
+// Rays per second through BoundingVolumeHierarchy, on its own and as the
+// bottom level of a ReferenceScene: the Cornell-box fixture with dense
+// displaced spheres standing on the floor, so the rays the path tracer and
+// lightmap baker cast spend their time in triangle-heavy leaves rather than in
+// the box's twelve quads. Build time is logged for the parallel and the
+// single-threaded build. Hits are always checked against a brute-force sweep;
+// throughput floors only under --olo-bench-assert.
+// =============================================================================
+
+#include "PathTracing/ReferenceSceneFixtures.h"
+
+#include "OloEngine/Renderer/BoundingVolumeHierarchy.h"
+#include "OloEngine/Renderer/Ray.h"
+#include "OloEngine/Renderer/Vertex.h"
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <span>
+#include <vector>
+
+using namespace OloEngine; // NOLINT(google-build-using-namespace) — test file
+using OloEngine::Tests::BenchAssertEnabled;
+using OloEngine::Tests::SecondsSince;
+using namespace OloEngine::Tests::PathTracingFixtures;
+
+namespace
+{
+    using Clock = std::chrono::high_resolution_clock;
+
+    constexpr u32 kStacks = 160;
+    constexpr u32 kSlices = 320; // ~100k triangles
+    constexpr u32 kRayCount = 200'000;
+
+    // Unit sphere with a deterministic bumpy displacement, so the BVH sees
+    // uneven triangle sizes instead of a perfectly regular tessellation.
+    void MakeDisplacedSphere(u32 stacks, u32 slices, std::vector<Vertex>& outVertices, std::vector<u32>& outIndices)
+    {
+        constexpr f32 pi = 3.14159265358979323846f;
+        for (u32 stack = 0; stack <= stacks; ++stack)
+        {
+            const f32 phi = pi * static_cast<f32>(stack) / static_cast<f32>(stacks);
+            for (u32 slice = 0; slice <= slices; ++slice)
+            {
+                const f32 theta = 2.0f * pi * static_cast<f32>(slice) / static_cast<f32>(slices);
+                const glm::vec3 direction(std::sin(phi) * std::cos(theta), std::cos(phi), std::sin(phi) * std::sin(theta));
+                const f32 radius = 1.0f + 0.08f * std::sin(7.0f * theta) * std::sin(5.0f * phi);
+                outVertices.emplace_back(direction * radius, direction, glm::vec2(0.0f));
+            }
+        }
+
+        const u32 row = slices + 1;
+        for (u32 stack = 0; stack < stacks; ++stack)
+        {
+            for (u32 slice = 0; slice < slices; ++slice)
+            {
+                const u32 a = stack * row + slice;
+                const u32 b = a + row;
+                outIndices.insert(outIndices.end(), { a, b, a + 1, a + 1, b, b + 1 });
+            }
+        }
+    }
+
+    // Rays from random points inside the room in uniformly random directions —
+    // roughly the mix of primary, bounce and gather rays a bake produces.
+    std::vector<Ray> MakeRoomRays(u32 count, u32 seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<f32> position(-0.95f, 0.95f);
+        std::normal_distribution<f32> gaussian(0.0f, 1.0f);
+
+        std::vector<Ray> rays;
+        rays.reserve(count);
+        while (rays.size() < count)
+        {
+            const glm::vec3 direction(gaussian(rng), gaussian(rng), gaussian(rng));
+            const f32 length = glm::length(direction);
+            if (length < 1e-4f)
+                continue;
+            rays.emplace_back(glm::vec3(position(rng), position(rng), position(rng)), direction / length, 1e-4f, 100.0f);
+        }
+        return rays;
+    }
+
+    bool BruteForceClosest(const std::vector<Vertex>& vertices, const std::vector<u32>& indices, const Ray& ray, f32& outDistance)
+    {
+        bool found = false;
+        Ray clipped = ray;
+        for (sizet i = 0; i + 2 < indices.size(); i += 3)
+        {
+            f32 t = 0.0f;
+            f32 u = 0.0f;
+            f32 v = 0.0f;
+            bool frontFace = false;
+            if (RayIntersect::RayTriangle(clipped, vertices[indices[i]].Position, vertices[indices[i + 1]].Position,
+                                          vertices[indices[i + 2]].Position, t, u, v, frontFace))
+            {
+                clipped.TMax = t;
+                found = true;
+            }
+        }
+        outDistance = clipped.TMax;
+        return found;
+    }
+} // namespace
+
+TEST(BVHTraversalBenchmark, MeshRaysPerSecond)
+{
+    std::vector<Vertex> vertices;
+    std::vector<u32> indices;
+    MakeDisplacedSphere(kStacks, kSlices, vertices, indices);
+
+    BoundingVolumeHierarchy bvh;
+    auto start = Clock::now();
+    bvh.Build(vertices.data(), vertices.size(), indices.data(), indices.size());
+    const f64 parallelBuild = SecondsSince(start);
+
+    BoundingVolumeHierarchy serialBvh;
+    BVHBuildSettings serialSettings;
+    serialSettings.ForceSingleThread = true;
+    start = Clock::now();
+    serialBvh.Build(vertices.data(), vertices.size(), indices.data(), indices.size(), serialSettings);
+    const f64 serialBuild = SecondsSince(start);
+
+    ASSERT_TRUE(bvh.IsBuilt());
+    EXPECT_EQ(bvh.GetNodeCount(), serialBvh.GetNodeCount());
+
+    // Rays from a shell around the sphere, aimed at jittered points inside it.
+    std::mt19937 rng(1234u);
+    std::normal_distribution<f32> gaussian(0.0f, 1.0f);
+    std::vector<Ray> rays;
+    rays.reserve(kRayCount);
+    while (rays.size() < kRayCount)
+    {
+        glm::vec3 origin(gaussian(rng), gaussian(rng), gaussian(rng));
+        const glm::vec3 target(gaussian(rng) * 0.6f, gaussian(rng) * 0.6f, gaussian(rng) * 0.6f);
+        if (glm::length(origin) < 1e-4f)
+            continue;
+        origin = origin / glm::length(origin) * 3.0f;
+        const glm::vec3 delta = target - origin;
+        rays.emplace_back(origin, delta / glm::length(delta), 0.0f, 10.0f);
+    }
+
+    u32 hits = 0;
+    start = Clock::now();
+    for (const Ray& ray : rays)
+    {
+        RayHit hit;
+        hits += bvh.CastRay(ray, hit) ? 1u : 0u;
+    }
+    const f64 closestSeconds = SecondsSince(start);
+
+    u32 occluded = 0;
+    start = Clock::now();
+    for (const Ray& ray : rays)
+        occluded += bvh.CastRayAny(ray) ? 1u : 0u;
+    const f64 anySeconds = SecondsSince(start);
+
+    // The same rays as batches through the stream any-hit walk.
+    constexpr sizet kBatch = 256;
+    std::vector<u8> streamOccluded(rays.size(), 0);
+    start = Clock::now();
+    for (sizet first = 0; first < rays.size(); first += kBatch)
+    {
+        const sizet count = std::min(kBatch, rays.size() - first);
+        bvh.CastRaysAny(std::span(rays).subspan(first, count), std::span(streamOccluded).subspan(first, count));
+    }
+    const f64 streamSeconds = SecondsSince(start);
+
+    for (u32 i = 0; i < kRayCount; ++i)
+        ASSERT_EQ(streamOccluded[i] != 0, bvh.CastRayAny(rays[i])) << "ray " << i;
+
+    EXPECT_EQ(hits, occluded);
+    EXPECT_GT(hits, 0u);
+    EXPECT_LT(hits, kRayCount);
+
+    // Spot-check against every triangle.
+    for (u32 i = 0; i < kRayCount; i += kRayCount / 64)
+    {
+        f32 reference = 0.0f;
+        const bool referenceHit = BruteForceClosest(vertices, indices, rays[i], reference);
+        RayHit hit;
+        ASSERT_EQ(bvh.CastRay(rays[i], hit), referenceHit) << "ray " << i;
+        if (referenceHit)
+            EXPECT_NEAR(hit.Distance, reference, 1e-4f) << "ray " << i;
+    }
+
+    const f64 closestRate = kRayCount / closestSeconds;
+    const f64 anyRate = kRayCount / anySeconds;
+    const f64 streamRate = kRayCount / streamSeconds;
+    OLO_CORE_INFO("[BVHTraversalBenchmark] mesh {} tris, {} nodes: build {:.1f} ms (single-threaded {:.1f} ms)",
+                  bvh.GetTriangleCount(), bvh.GetNodeCount(), parallelBuild * 1000.0, serialBuild * 1000.0);
+    OLO_CORE_INFO("[BVHTraversalBenchmark] mesh closest hit {:.2f} Mrays/s, any hit {:.2f} Mrays/s, "
+                  "any hit in batches of {} {:.2f} Mrays/s ({} of {} rays hit)",
+                  closestRate / 1e6, anyRate / 1e6, kBatch, streamRate / 1e6, hits, kRayCount);
+
+    if (BenchAssertEnabled())
+    {
+        EXPECT_GT(closestRate, 1.0e6) << "closest-hit throughput on one thread";
+        EXPECT_GT(anyRate, 2.0e6) << "any-hit throughput on one thread";
+    }
+}
+
+TEST(BVHTraversalBenchmark, ReferenceSceneRaysPerSecond)
+{
+    CornellBoxScene fixture = MakeCornellBoxScene();
+    ReferenceScene& scene = fixture.Scene;
+
+    std::vector<Vertex> vertices;
+    std::vector<u32> indices;
+    MakeDisplacedSphere(kStacks, kSlices, vertices, indices);
+    const u32 sphere = scene.AddGeometry(std::move(vertices), std::move(indices));
+    const glm::vec3 placements[3] = { { -0.5f, -0.7f, -0.3f }, { 0.45f, -0.75f, 0.1f }, { 0.0f, -0.8f, 0.55f } };
+    for (const glm::vec3& placement : placements)
+    {
+        const glm::mat4 transform = glm::scale(glm::translate(glm::mat4(1.0f), placement), glm::vec3(0.2f));
+        ASSERT_NE(scene.AddInstance(sphere, transform, fixture.WhiteMaterial), static_cast<u32>(-1));
+    }
+    scene.Build();
+    ASSERT_TRUE(scene.IsBuilt());
+
+    const std::vector<Ray> rays = MakeRoomRays(kRayCount, 99u);
+
+    u32 hits = 0;
+    auto start = Clock::now();
+    for (const Ray& ray : rays)
+    {
+        SurfaceInteraction interaction;
+        hits += scene.Intersect(ray, interaction) ? 1u : 0u;
+    }
+    const f64 closestSeconds = SecondsSince(start);
+
+    // Shadow rays: from each ray origin to a point on the emitter.
+    u32 occluded = 0;
+    start = Clock::now();
+    for (const Ray& ray : rays)
+        occluded += scene.IsOccluded(ray.Origin, glm::vec3(ray.Direction.x * 0.2f, 0.98f, ray.Direction.z * 0.2f)) ? 1u : 0u;
+    const f64 shadowSeconds = SecondsSince(start);
+
+    // The same shadow rays as ShadowSegment batches. Neighbouring rays here
+    // start anywhere in the room, so this is the incoherent worst case for
+    // the stream walk.
+    constexpr sizet kBatch = 256;
+    std::vector<ShadowSegment> segments;
+    segments.reserve(rays.size());
+    for (const Ray& ray : rays)
+        segments.push_back({ ray.Origin, glm::vec3(ray.Direction.x * 0.2f, 0.98f, ray.Direction.z * 0.2f) });
+
+    std::vector<u8> streamOccluded(segments.size(), 0);
+    start = Clock::now();
+    for (sizet first = 0; first < segments.size(); first += kBatch)
+    {
+        const sizet count = std::min(kBatch, segments.size() - first);
+        scene.OccludedStream(std::span(segments).subspan(first, count), 1e-3f, std::span(streamOccluded).subspan(first, count));
+    }
+    const f64 streamSeconds = SecondsSince(start);
+
+    u32 streamCount = 0;
+    for (sizet i = 0; i < segments.size(); ++i)
+    {
+        ASSERT_EQ(streamOccluded[i] != 0, scene.IsOccluded(segments[i].From, segments[i].To)) << "segment " << i;
+        streamCount += streamOccluded[i];
+    }
+    EXPECT_EQ(streamCount, occluded);
+
+    // Every ray starts inside the closed part of the room, so most hit.
+    EXPECT_GT(hits, kRayCount / 2);
+    EXPECT_GT(occluded, 0u);
+
+    const f64 closestRate = kRayCount / closestSeconds;
+    const f64 shadowRate = kRayCount / shadowSeconds;
+    const f64 streamRate = kRayCount / streamSeconds;
+    OLO_CORE_INFO("[BVHTraversalBenchmark] Cornell box + {} sphere instances: closest hit {:.2f} Mrays/s, "
+                  "shadow {:.2f} Mrays/s, shadow stream {:.2f} Mrays/s ({} hits, {} occluded)",
+                  std::size(placements), closestRate / 1e6, shadowRate / 1e6, streamRate / 1e6, hits, occluded);
+
+    if (BenchAssertEnabled())
+    {
+        EXPECT_GT(closestRate, 0.5e6) << "scene closest-hit throughput on one thread";
+        EXPECT_GT(shadowRate, 1.0e6) << "scene shadow-ray throughput on one thread";
+    }
+}
@@ -40,6 +40,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstdlib>
+#include <cstring>
 #include <filesystem>
 #include <iostream>
 #include <string>
@@ -309,6 +310,63 @@ namespace OloEngine::Tests
             << "the parallel render does not match the sequential one bit-for-bit";
     }
 
+    // Ray-stream mode only reorders the tracing work, so it must reproduce the
+    // scalar image to the bit — a tolerance here would hide a path that picked
+    // up a different hit.
+    TEST(PathTracerCornellBox, RayStreamRenderMatchesScalarRenderExactly)
+    {
+        const Fixtures::CornellBoxScene fixture = Fixtures::MakeCornellBoxScene();
+        const ReferenceCamera camera = fixture.MakeCamera(32, 32);
+
+        PathTracerSettings scalarSettings = GateSettings();
+        scalarSettings.SamplesPerPixel = 16;
+        PathTracerSettings streamSettings = scalarSettings;
+        streamSettings.UseRayStreams = true;
+
+        ReferenceFilm scalarFilm(32, 32);
+        PathTracer::Render(fixture.Scene, camera, scalarSettings, scalarFilm);
+
+        ReferenceFilm streamFilm(32, 32);
+        PathTracer::Render(fixture.Scene, camera, streamSettings, streamFilm);
+
+        EXPECT_EQ(streamFilm.ComputeHash(), scalarFilm.ComputeHash())
+            << "the ray-stream render does not match the scalar one bit-for-bit";
+    }
+
+    TEST(PathTracerCornellBox, IrradianceBatchMatchesPerQueryEstimates)
+    {
+        const Fixtures::CornellBoxScene fixture = Fixtures::MakeCornellBoxScene();
+
+        PathTracerSettings settings = GateSettings();
+        settings.SamplesPerPixel = 8;
+
+        // A strip across the floor plus two degenerate queries: a zero normal
+        // and a point outside the box.
+        std::vector<IrradianceQuery> queries;
+        for (u32 i = 0; i < 24; ++i)
+        {
+            const f32 x = -0.9f + 1.8f * static_cast<f32>(i) / 23.0f;
+            queries.push_back({ glm::vec3(x, -0.99f, 0.1f * static_cast<f32>(i % 5)), glm::vec3(0.0f, 1.0f, 0.0f), 0x1000u + i });
+        }
+        queries.push_back({ glm::vec3(0.0f), glm::vec3(0.0f), 7u });
+        queries.push_back({ glm::vec3(0.0f, 0.0f, 5.0f), glm::vec3(0.0f, 0.0f, 1.0f), 8u });
+
+        for (const bool streams : { false, true })
+        {
+            settings.UseRayStreams = streams;
+            std::vector<glm::vec3> batch(queries.size(), glm::vec3(-1.0f));
+            PathTracer::EstimateIrradianceBatch(fixture.Scene, queries, settings, batch);
+
+            for (sizet i = 0; i < queries.size(); ++i)
+            {
+                const glm::vec3 expected =
+                    PathTracer::EstimateIrradiance(fixture.Scene, queries[i].Position, queries[i].Normal, settings, queries[i].Seed);
+                EXPECT_EQ(0, std::memcmp(&batch[i], &expected, sizeof(glm::vec3)))
+                    << "query " << i << (streams ? " (ray streams)" : " (scalar)");
+            }
+        }
+    }
+
     // Changing only the seed must change the noise but not the converged
     // answer. If it changed the answer, the "reference" would be one of many.
     TEST(PathTracerCornellBox, SeedChangesNoiseButNotTheConvergedMean)
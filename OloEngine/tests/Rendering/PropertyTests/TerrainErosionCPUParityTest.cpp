@@ -0,0 +1,166 @@
+// =============================================================================
+// TerrainErosionCPUParityTest.cpp
+//
+// The headless CPU erosion pass (TerrainErosion::ApplyCPU, on
+// HydraulicErosion::ErodeParallel) against the Terrain_Erosion.comp pass it
+// stands in for on build machines, on small fields with the same u_Seed:
+//
+//   1. One droplet. Nothing races, so the two must trace the same path and
+//      leave the same field up to float rounding — this pins the droplet model
+//      itself: seeding, gradient, capacity, brush and deposit weights.
+//
+//   2. Thousands of droplets. The GPU runs them concurrently and its
+//      read-modify-write brush races, so only the outcome can agree: about as
+//      much terrain moved, in the same places. The CPU pass is also checked to
+//      have re-uploaded its result to the terrain's GPU heightmap.
+//
+// Requires a GL 4.6 context; SKIP'd on headless CI via RendererAttachedTest.
+//
+// OLO_TEST_LAYER: L8
+// =============================================================================
+
+#include "OloEnginePCH.h"
+
+#include "RendererAttachedTest.h"
+
+#include <gtest/gtest.h>
+
+#include "OloEngine/Renderer/Texture.h"
+#include "OloEngine/Terrain/Editor/TerrainErosion.h"
+#include "OloEngine/Terrain/TerrainData.h"
+#include "OloEngine/Terrain/TerrainGenerator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace OloEngine::Tests
+{
+    namespace
+    {
+        std::vector<f32> MakeField(u32 resolution)
+        {
+            TerrainGenerator::HeightParams params;
+            params.Resolution = resolution;
+            params.Seed = 606;
+            params.Octaves = 5;
+            params.Frequency = 3.0f;
+            std::vector<f32> heights;
+            TerrainGenerator::GenerateHeightField(heights, params);
+            return heights;
+        }
+
+        f64 MovedMaterial(const std::vector<f32>& before, const std::vector<f32>& after)
+        {
+            f64 sum = 0.0;
+            for (sizet i = 0; i < before.size(); ++i)
+                sum += std::abs(static_cast<f64>(after[i]) - before[i]);
+            return sum;
+        }
+
+        f64 DeltaCorrelation(const std::vector<f32>& before, const std::vector<f32>& a, const std::vector<f32>& b)
+        {
+            const auto n = static_cast<f64>(before.size());
+            f64 meanA = 0.0;
+            f64 meanB = 0.0;
+            for (sizet i = 0; i < before.size(); ++i)
+            {
+                meanA += static_cast<f64>(a[i]) - before[i];
+                meanB += static_cast<f64>(b[i]) - before[i];
+            }
+            meanA /= n;
+            meanB /= n;
+            f64 cov = 0.0;
+            f64 varA = 0.0;
+            f64 varB = 0.0;
+            for (sizet i = 0; i < before.size(); ++i)
+            {
+                const f64 da = static_cast<f64>(a[i]) - before[i] - meanA;
+                const f64 db = static_cast<f64>(b[i]) - before[i] - meanB;
+                cov += da * db;
+                varA += da * da;
+                varB += db * db;
+            }
+            return cov / std::sqrt(varA * varB);
+        }
+    } // namespace
+
+    // Reuses RendererAttachedTest only for its one-time Renderer::Init; the
+    // erosion shader and heightmap need the renderer, not a scene.
+    class TerrainErosionCPUParityTest : public RendererAttachedTest
+    {
+      protected:
+        void BuildScene() override {}
+    };
+
+    TEST_F(TerrainErosionCPUParityTest, OneDropletMatchesTheShader)
+    {
+        OLO_ENSURE_GPU_OR_SKIP();
+
+        constexpr u32 kRes = 96;
+        constexpr u32 kSeed = 4321;
+        const std::vector<f32> field = MakeField(kRes);
+
+        TerrainErosion erosion;
+        ASSERT_TRUE(erosion.IsReady()) << "Terrain_Erosion.comp did not compile";
+
+        ErosionSettings settings;
+        settings.DropletCount = 1;
+
+        TerrainData gpuTerrain;
+        gpuTerrain.SetHeights(kRes, field);
+        erosion.SetIterationSeed(kSeed);
+        erosion.Apply(gpuTerrain, settings);
+        const std::vector<f32>& gpu = gpuTerrain.GetHeightData();
+        ASSERT_NE(gpu, field) << "the shader's droplet changed nothing";
+
+        std::vector<f32> cpu = field;
+        TerrainErosion::ApplyCPU(cpu, kRes, settings, kSeed);
+
+        f32 maxDiff = 0.0f;
+        for (sizet i = 0; i < cpu.size(); ++i)
+            maxDiff = std::max(maxDiff, std::abs(cpu[i] - gpu[i]));
+        EXPECT_LE(maxDiff, 1e-4f) << "the CPU droplet left the shader's path";
+    }
+
+    TEST_F(TerrainErosionCPUParityTest, ManyDropletsCarveLikeTheShader)
+    {
+        OLO_ENSURE_GPU_OR_SKIP();
+
+        constexpr u32 kRes = 128;
+        constexpr u32 kSeed = 77;
+        const std::vector<f32> field = MakeField(kRes);
+
+        TerrainErosion erosion;
+        ASSERT_TRUE(erosion.IsReady()) << "Terrain_Erosion.comp did not compile";
+
+        ErosionSettings settings;
+        settings.DropletCount = 4096;
+
+        TerrainData gpuTerrain;
+        gpuTerrain.SetHeights(kRes, field);
+        erosion.SetIterationSeed(kSeed);
+        erosion.Apply(gpuTerrain, settings);
+
+        TerrainData cpuTerrain;
+        cpuTerrain.SetHeights(kRes, field);
+        TerrainErosion::ApplyCPU(cpuTerrain, settings, 1, kSeed);
+
+        const std::vector<f32>& gpu = gpuTerrain.GetHeightData();
+        const std::vector<f32>& cpu = cpuTerrain.GetHeightData();
+        const f64 movedGpu = MovedMaterial(field, gpu);
+        const f64 movedCpu = MovedMaterial(field, cpu);
+        ASSERT_GT(movedGpu, 0.0);
+        const f64 ratio = movedCpu / movedGpu;
+        EXPECT_GT(ratio, 0.7) << "CPU moved " << movedCpu << ", GPU " << movedGpu;
+        EXPECT_LT(ratio, 1.4) << "CPU moved " << movedCpu << ", GPU " << movedGpu;
+        EXPECT_GT(DeltaCorrelation(field, gpu, cpu), 0.7) << "the passes carved different places";
+
+        // ApplyCPU must leave the GPU heightmap in step with the CPU heights.
+        std::vector<u8> raw;
+        ASSERT_TRUE(cpuTerrain.GetGPUHeightmap()->GetData(raw));
+        ASSERT_EQ(raw.size(), cpu.size() * sizeof(f32));
+        EXPECT_EQ(std::memcmp(raw.data(), cpu.data(), raw.size()), 0);
+    }
+} // namespace OloEngine::Tests
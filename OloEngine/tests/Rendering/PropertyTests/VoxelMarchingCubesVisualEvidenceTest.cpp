@@ -286,17 +286,17 @@ namespace OloEngine::Tests
         ASSERT_TRUE(terrain.m_VoxelOverride) << "the voxel override was never created";
         terrain.m_VoxelOverride->AddSphere(kBlobCentre, kBlobRadius);
 
-        RunEditorFrames(camera, 3);
+        RunEditorFrames(camera, 1);
+        // Meshing runs on workers; whether a job lands inside a given frame is
+        // scheduling, so collect them all before the measured frames.
+        ASSERT_TRUE(terrain.m_VoxelMeshes) << "the marching-cubes builder was never created";
+        terrain.m_VoxelMeshes->FlushPending(*terrain.m_VoxelOverride);
+        RunEditorFrames(camera, 2);
 
         // (1) The marching-cubes path produced geometry at all.
-        ASSERT_FALSE(terrain.m_VoxelMeshes.empty())
+        ASSERT_FALSE(terrain.m_VoxelMeshes->GetMeshes().empty())
             << "AddSphere marked chunks dirty but marching cubes meshed nothing";
-        u32 mcTriangles = 0;
-        for (const auto& [coord, mesh] : terrain.m_VoxelMeshes)
-        {
-            mcTriangles += mesh.IndexCount / 3u;
-        }
-        EXPECT_GT(mcTriangles, 0u);
+        EXPECT_GT(terrain.m_VoxelMeshes->GetTriangleCount(), 0u);
 
         // (2) Unbound terrain arrays — the configuration that used to render the
         //     whole volume black.
@@ -309,7 +309,7 @@ namespace OloEngine::Tests
                 WritePng("VoxelMarchingCubes_blob_untextured.png", frame);
             }
             std::printf("[#727] marching-cubes blob (no layers): %u tris, coverage %.3f, bg %d, peak %d, spread %d\n",
-                        mcTriangles, static_cast<double>(sample.Coverage), sample.Background, sample.PeakLuma,
+                        terrain.m_VoxelMeshes->GetTriangleCount(), static_cast<double>(sample.Coverage), sample.Background, sample.PeakLuma,
                         sample.Spread);
 
             EXPECT_GT(sample.Coverage, 0.03f) << "the blob did not render";
@@ -0,0 +1,198 @@
+// OLO_TEST_LAYER: unit
+#include "OloEnginePCH.h"
+#include "../TestTaskWorkers.h"
+#include "TestTempDir.h"
+#include <gtest/gtest.h>
+
+// =============================================================================
+// TextureCompressionBenchmarkTest
+//
+// Megapixels per second through the offline BCn cook: each encoder over a
+// full mip chain (tiles across ParallelFor, next mip downsampled while the
+// current one encodes), and a directory of sources cooked by the bounded
+// batch pool against the same files cooked one after another. Batch output is
+// always checked byte-for-byte against the sequential cook; throughput floors
+// only under --olo-bench-assert.
+// =============================================================================
+
+#include "OloEngine/Renderer/TextureCompression.h"
+#include "OloEngine/Task/NamedThreads.h"
+#include "OloEngine/Task/Scheduler.h"
+
+#include <stb_image/stb_image_write.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace OloEngine; // NOLINT(google-build-using-namespace) — test file
+using OloEngine::Tests::BenchAssertEnabled;
+using OloEngine::Tests::SecondsSince;
+using OloEngine::Tests::EnsureTaskWorkers;
+
+namespace
+{
+    using Clock = std::chrono::high_resolution_clock;
+
+    // Texels encoded across a full mip chain of the given base size.
+    f64 ChainMegapixels(u32 width, u32 height)
+    {
+        f64 texels = 0.0;
+        while (true)
+        {
+            texels += static_cast<f64>(width) * height;
+            if (width == 1 && height == 1)
+                return texels / 1e6;
+            width = std::max(1u, width / 2);
+            height = std::max(1u, height / 2);
+        }
+    }
+
+    // Detail at several frequencies, so the encoders search real endpoints
+    // rather than collapsing flat blocks.
+    std::vector<u8> MakeDetailRGBA(u32 width, u32 height)
+    {
+        std::vector<u8> pixels(static_cast<sizet>(width) * height * 4);
+        for (u32 y = 0; y < height; ++y)
+        {
+            for (u32 x = 0; x < width; ++x)
+            {
+                const f32 fx = static_cast<f32>(x);
+                const f32 fy = static_cast<f32>(y);
+                u8* p = &pixels[(static_cast<sizet>(y) * width + x) * 4];
+                p[0] = static_cast<u8>(127.5f + 127.5f * std::sin(fx * 0.050f + fy * 0.020f));
+                p[1] = static_cast<u8>(127.5f + 127.5f * std::sin(fx * 0.310f) * std::cos(fy * 0.170f));
+                p[2] = static_cast<u8>((x * 7 + y * 13) & 0xFF);
+                p[3] = static_cast<u8>(x + y < width ? 255 : 96);
+            }
+        }
+        return pixels;
+    }
+
+    std::vector<f32> MakeDetailHDR(u32 width, u32 height)
+    {
+        std::vector<f32> pixels(static_cast<sizet>(width) * height * 3);
+        for (u32 y = 0; y < height; ++y)
+        {
+            for (u32 x = 0; x < width; ++x)
+            {
+                const f32 fx = static_cast<f32>(x) / static_cast<f32>(width);
+                const f32 fy = static_cast<f32>(y) / static_cast<f32>(height);
+                f32* p = &pixels[(static_cast<sizet>(y) * width + x) * 3];
+                p[0] = 0.05f + 40.0f * fx * fx;
+                p[1] = 0.05f + 4.0f * (0.5f + 0.5f * std::sin(fy * 40.0f));
+                p[2] = 0.05f + 12.0f * fx * fy;
+            }
+        }
+        return pixels;
+    }
+
+    std::vector<u8> ReadBytes(const std::filesystem::path& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        return { std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+    }
+} // namespace
+
+TEST(TextureCompressionBenchmark, EncodeMegapixelsPerSecond)
+{
+    EnsureTaskWorkers();
+
+    constexpr u32 kSize = 1024;
+    const std::vector<u8> ldr = MakeDetailRGBA(kSize, kSize);
+    const std::vector<f32> hdr = MakeDetailHDR(kSize, kSize);
+    const f64 megapixels = ChainMegapixels(kSize, kSize);
+
+    Clock::time_point start = Clock::now();
+    const CompressedTextureImage bc7 = TextureCompression::EncodeBC7(ldr.data(), kSize, kSize, 4, true, true);
+    const f64 bc7Seconds = SecondsSince(start);
+
+    start = Clock::now();
+    const CompressedTextureImage bc5 = TextureCompression::EncodeBC5(ldr.data(), kSize, kSize, 4, true);
+    const f64 bc5Seconds = SecondsSince(start);
+
+    start = Clock::now();
+    const CompressedTextureImage bc6h = TextureCompression::EncodeBC6H(hdr.data(), kSize, kSize, 3, true);
+    const f64 bc6hSeconds = SecondsSince(start);
+
+    ASSERT_TRUE(bc7.IsValid());
+    ASSERT_TRUE(bc5.IsValid());
+    ASSERT_TRUE(bc6h.IsValid());
+    EXPECT_EQ(bc7.MipLevels(), 11u);
+
+    const f64 bc7Rate = megapixels / bc7Seconds;
+    const f64 bc5Rate = megapixels / bc5Seconds;
+    const f64 bc6hRate = megapixels / bc6hSeconds;
+    OLO_CORE_INFO("[TextureCompressionBenchmark] {}x{} + mips ({:.2f} MP) on {} workers: BC7 {:.2f} MP/s, "
+                  "BC5 {:.2f} MP/s, BC6H {:.2f} MP/s",
+                  kSize, kSize, megapixels, LowLevelTasks::FScheduler::Get().GetNumWorkers(), bc7Rate, bc5Rate, bc6hRate);
+
+    if (BenchAssertEnabled())
+    {
+        EXPECT_GT(bc7Rate, 1.0) << "BC7 encode throughput";
+        EXPECT_GT(bc5Rate, 20.0) << "BC5 encode throughput";
+        EXPECT_GT(bc6hRate, 5.0) << "BC6H encode throughput";
+    }
+}
+
+TEST(TextureCompressionBenchmark, BatchDirectoryMegapixelsPerSecond)
+{
+    EnsureTaskWorkers();
+    namespace fs = std::filesystem;
+
+    constexpr u32 kFiles = 12;
+    constexpr u32 kSize = 256;
+    const fs::path srcDir = OloEngine::Tests::TempDir("src");
+    const fs::path batchDir = OloEngine::Tests::TempDir("batch");
+    const fs::path sequentialDir = OloEngine::Tests::TempDir("sequential");
+
+    const std::vector<u8> pixels = MakeDetailRGBA(kSize, kSize);
+    std::vector<std::string> names;
+    for (u32 i = 0; i < kFiles; ++i)
+    {
+        names.push_back("texture_" + std::to_string(i) + ".png");
+        ASSERT_NE(::stbi_write_png((srcDir / names.back()).string().c_str(), static_cast<int>(kSize), static_cast<int>(kSize), 4,
+                                   pixels.data(), static_cast<int>(kSize) * 4),
+                  0);
+    }
+
+    TextureCompression::CompressOptions options;
+    options.GenerateMips = true;
+    options.UseDerivedDataCache = false; // time the encoders, not cache hits
+
+    Clock::time_point start = Clock::now();
+    for (const std::string& name : names)
+    {
+        fs::path dst = sequentialDir / name;
+        dst.replace_extension(".olotex");
+        ASSERT_TRUE(TextureCompression::CompressTextureFile((srcDir / name).string(), dst.string(), options));
+    }
+    const f64 sequentialSeconds = SecondsSince(start);
+
+    start = Clock::now();
+    const TextureCompression::BatchCompressResult result =
+        TextureCompression::CompressDirectory(srcDir.string(), batchDir.string(), options);
+    const f64 batchSeconds = SecondsSince(start);
+
+    EXPECT_TRUE(result.Succeeded());
+    EXPECT_EQ(result.Compressed, kFiles);
+    for (const std::string& name : names)
+    {
+        const fs::path cooked = fs::path(name).replace_extension(".olotex");
+        EXPECT_EQ(ReadBytes(batchDir / cooked), ReadBytes(sequentialDir / cooked)) << name;
+    }
+
+    const f64 megapixels = ChainMegapixels(kSize, kSize) * kFiles;
+    OLO_CORE_INFO("[TextureCompressionBenchmark] {} x {}x{} BC7 files: one by one {:.2f} MP/s, "
+                  "batch {:.2f} MP/s ({:.2f}x)",
+                  kFiles, kSize, kSize, megapixels / sequentialSeconds, megapixels / batchSeconds,
+                  sequentialSeconds / batchSeconds);
+
+    if (BenchAssertEnabled())
+        EXPECT_GT(megapixels / batchSeconds, 1.0) << "batch cook throughput";
+}
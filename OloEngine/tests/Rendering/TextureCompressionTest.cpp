@@ -7,9 +7,11 @@
 // and non-multiple-of-4 (partial block) handling. The GPU upload path is verified
 // separately by the GL evidence test.
 
+#include "OloEngine/Asset/DerivedDataCache.h"
 #include "OloEngine/Renderer/TextureCompression.h"
 
 #include <gtest/gtest.h>
+#include "TestTaskWorkers.h"
 #include "TestTempDir.h"
 #include <stb_image/stb_image_write.h>
 
@@ -17,10 +19,13 @@
 #include <cmath>
 #include <cstdint>
 #include <filesystem>
+#include <fstream>
+#include <iterator>
 #include <string>
 #include <vector>
 
 using namespace OloEngine;
+using OloEngine::Tests::EnsureTaskWorkers;
 
 namespace
 {
@@ -708,3 +713,283 @@ TEST(TextureCompression, WriteThenReadFileRoundTrip)
     std::error_code ec;
     std::filesystem::remove(path, ec);
 }
+
+// ---- Parallel encode / batch cook -----------------------------------------
+// The encoders split each mip into tiles across ParallelFor and downsample the next
+// mip while the current one encodes. The reference below rebuilds every mip on this
+// thread and encodes each block as its own 4x4 image, which pins the contract that
+// tiling and pipelining never change a byte.
+
+namespace
+{
+    // Pseudo-random texels: unlike a gradient, neighbouring blocks never encode alike,
+    // so a block written to the wrong slot cannot go unnoticed.
+    std::vector<u8> MakeNoiseRGBA(u32 width, u32 height)
+    {
+        std::vector<u8> pixels(static_cast<sizet>(width) * height * 4);
+        u32 state = 0x9E3779B9u;
+        for (u8& value : pixels)
+        {
+            state = state * 1664525u + 1013904223u;
+            value = static_cast<u8>(state >> 24);
+        }
+        return pixels;
+    }
+
+    // The same box filters as the encoder's mip build, written out independently.
+    template<typename Pixel, typename AverageFn>
+    std::vector<Pixel> ReferenceDownsample(const std::vector<Pixel>& src, u32 width, u32 height, u32 channels,
+                                           u32& outW, u32& outH, AverageFn&& average)
+    {
+        outW = std::max(1u, width / 2);
+        outH = std::max(1u, height / 2);
+        std::vector<Pixel> dst(static_cast<sizet>(outW) * outH * channels);
+        for (u32 y = 0; y < outH; ++y)
+        {
+            for (u32 x = 0; x < outW; ++x)
+            {
+                const u32 x0 = std::min(x * 2, width - 1);
+                const u32 x1 = std::min(x * 2 + 1, width - 1);
+                const u32 y0 = std::min(y * 2, height - 1);
+                const u32 y1 = std::min(y * 2 + 1, height - 1);
+                for (u32 c = 0; c < channels; ++c)
+                {
+                    const auto at = [&](u32 sx, u32 sy)
+                    { return src[(static_cast<sizet>(sy) * width + sx) * channels + c]; };
+                    dst[(static_cast<sizet>(y) * outW + x) * channels + c] = average(at(x0, y0), at(x1, y0), at(x0, y1), at(x1, y1));
+                }
+            }
+        }
+        return dst;
+    }
+
+    // One mip level encoded a block at a time: each edge-clamped 4x4 block is its own
+    // single-block image, so the encoder never tiles it.
+    template<typename Pixel, typename EncodeBlockFn>
+    std::vector<u8> ReferenceEncodeLevel(const std::vector<Pixel>& level, u32 width, u32 height, u32 channels,
+                                         EncodeBlockFn&& encodeBlock)
+    {
+        std::vector<u8> out;
+        std::vector<Pixel> block(16 * channels);
+        for (u32 by = 0; by < TextureCompression::BlockCount(height); ++by)
+        {
+            for (u32 bx = 0; bx < TextureCompression::BlockCount(width); ++bx)
+            {
+                for (u32 t = 0; t < 16; ++t)
+                {
+                    const u32 sx = std::min(bx * 4 + t % 4, width - 1);
+                    const u32 sy = std::min(by * 4 + t / 4, height - 1);
+                    std::copy_n(&level[(static_cast<sizet>(sy) * width + sx) * channels], channels, &block[t * channels]);
+                }
+                const CompressedTextureImage single = encodeBlock(block.data());
+                EXPECT_EQ(single.MipLevels(), 1u);
+                if (single.MipLevels() != 1u)
+                    return out;
+                out.insert(out.end(), single.Mips[0].begin(), single.Mips[0].end());
+            }
+        }
+        return out;
+    }
+
+    template<typename Pixel, typename AverageFn, typename EncodeBlockFn>
+    std::vector<std::vector<u8>> ReferenceMipChain(std::vector<Pixel> level, u32 width, u32 height, u32 channels,
+                                                   AverageFn&& average, EncodeBlockFn&& encodeBlock)
+    {
+        std::vector<std::vector<u8>> mips;
+        while (true)
+        {
+            mips.push_back(ReferenceEncodeLevel(level, width, height, channels, encodeBlock));
+            if (width == 1 && height == 1)
+                return mips;
+            u32 nw = 0;
+            u32 nh = 0;
+            level = ReferenceDownsample(level, width, height, channels, nw, nh, average);
+            width = nw;
+            height = nh;
+        }
+    }
+
+    u8 AverageU8(u8 a, u8 b, u8 c, u8 d)
+    {
+        return static_cast<u8>((static_cast<u32>(a) + b + c + d + 2) / 4);
+    }
+
+    f32 AverageF32(f32 a, f32 b, f32 c, f32 d)
+    {
+        return (a + b + c + d) * 0.25f;
+    }
+
+    std::vector<u8> ReadBytes(const std::filesystem::path& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        return { std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+    }
+} // namespace
+
+TEST(TextureCompression, ParallelBC7MatchesPerBlockReference)
+{
+    EnsureTaskWorkers();
+    // Odd, non-multiple-of-4 size: partial edge tiles and partial edge blocks at every mip.
+    constexpr u32 kW = 150;
+    constexpr u32 kH = 93;
+    const std::vector<u8> source = MakeNoiseRGBA(kW, kH);
+
+    for (const bool srgb : { true, false })
+    {
+        const CompressedTextureImage image = TextureCompression::EncodeBC7(source.data(), kW, kH, 4, srgb, true);
+        const std::vector<std::vector<u8>> reference = ReferenceMipChain<u8>(
+            source, kW, kH, 4, AverageU8, [srgb](const u8* block)
+            { return TextureCompression::EncodeBC7(block, 4, 4, 4, srgb, false); });
+
+        ASSERT_EQ(image.MipLevels(), reference.size());
+        for (u32 mip = 0; mip < image.MipLevels(); ++mip)
+            EXPECT_EQ(image.Mips[mip], reference[mip]) << "BC7 mip " << mip << (srgb ? " (perceptual)" : " (linear)");
+    }
+}
+
+TEST(TextureCompression, ParallelBC5MatchesPerBlockReference)
+{
+    EnsureTaskWorkers();
+    constexpr u32 kW = 257;
+    constexpr u32 kH = 130;
+    // Feed RGBA so the reference sees the same texels the encoder expands to; BC5
+    // only reads R and G.
+    const std::vector<u8> source = MakeNoiseRGBA(kW, kH);
+
+    const CompressedTextureImage image = TextureCompression::EncodeBC5(source.data(), kW, kH, 4, true);
+    const std::vector<std::vector<u8>> reference = ReferenceMipChain<u8>(
+        source, kW, kH, 4, AverageU8, [](const u8* block)
+        { return TextureCompression::EncodeBC5(block, 4, 4, 4, false); });
+
+    ASSERT_EQ(image.MipLevels(), reference.size());
+    for (u32 mip = 0; mip < image.MipLevels(); ++mip)
+        EXPECT_EQ(image.Mips[mip], reference[mip]) << "BC5 mip " << mip;
+}
+
+TEST(TextureCompression, ParallelBC6HMatchesPerBlockReference)
+{
+    EnsureTaskWorkers();
+    constexpr u32 kW = 133;
+    constexpr u32 kH = 70;
+    const std::vector<f32> source = MakeGradientHDR(kW, kH, 64.0f);
+
+    const CompressedTextureImage image = TextureCompression::EncodeBC6H(source.data(), kW, kH, 3, true);
+    const std::vector<std::vector<u8>> reference = ReferenceMipChain<f32>(
+        source, kW, kH, 3, AverageF32, [](const f32* block)
+        { return TextureCompression::EncodeBC6H(block, 4, 4, 3, false); });
+
+    ASSERT_EQ(image.MipLevels(), reference.size());
+    for (u32 mip = 0; mip < image.MipLevels(); ++mip)
+        EXPECT_EQ(image.Mips[mip], reference[mip]) << "BC6H mip " << mip;
+}
+
+TEST(TextureCompression, CompressDirectoryMatchesPerFileCook)
+{
+    EnsureTaskWorkers();
+    namespace fs = std::filesystem;
+    const fs::path srcDir = OloEngine::Tests::TempDir("src");
+    const fs::path dstDir = OloEngine::Tests::TempDir("dst");
+
+    // Mixed sizes in a nested layout, plus a file that is not an image at all.
+    const std::vector<std::pair<std::string, u32>> sources = {
+        { "albedo_a.png", 64 }, { "rock_normal.png", 48 }, { "sub/ui_icon.png", 20 }, { "sub/deeper/mask.png", 37 }
+    };
+    for (const auto& [name, size] : sources)
+    {
+        const fs::path path = srcDir / name;
+        fs::create_directories(path.parent_path());
+        const std::vector<u8> pixels = MakeNoiseRGBA(size, size + 3);
+        ASSERT_NE(::stbi_write_png(path.string().c_str(), static_cast<int>(size), static_cast<int>(size + 3), 4,
+                                   pixels.data(), static_cast<int>(size) * 4),
+                  0);
+    }
+    std::ofstream(srcDir / "readme.txt") << "not a texture";
+
+    TextureCompression::CompressOptions options;
+    options.GenerateMips = true;
+    options.UseDerivedDataCache = false; // both sides must really encode
+    const TextureCompression::BatchCompressResult result =
+        TextureCompression::CompressDirectory(srcDir.string(), dstDir.string(), options, 2);
+    EXPECT_TRUE(result.Succeeded());
+    EXPECT_EQ(result.Compressed, static_cast<u32>(sources.size()));
+    EXPECT_FALSE(fs::exists(dstDir / "readme.olotex"));
+
+    for (const auto& [name, size] : sources)
+    {
+        CompressedTextureImage expected;
+        ASSERT_TRUE(TextureCompression::CompressImageFile((srcDir / name).string(), options, expected)) << name;
+        const fs::path cooked = fs::path(dstDir / name).replace_extension(".olotex");
+        ASSERT_TRUE(fs::exists(cooked)) << cooked.string();
+        EXPECT_EQ(ReadBytes(cooked), TextureCompression::SerializeToBlob(expected)) << name;
+    }
+}
+
+TEST(TextureCompression, CompressTextureFilesReportsFailuresInJobOrder)
+{
+    EnsureTaskWorkers();
+    const std::filesystem::path pngPath = CaseKeyedTempFile(".png");
+    const std::vector<u8> pixels = MakeGradientRGBA(16, 16);
+    ASSERT_NE(::stbi_write_png(pngPath.string().c_str(), 16, 16, 4, pixels.data(), 16 * 4), 0);
+
+    const std::vector<TextureCompression::CompressFileJob> jobs = {
+        { OloEngine::Tests::TempFile("missing_a.png").string(), OloEngine::Tests::TempFile("a.olotex").string() },
+        { pngPath.string(), OloEngine::Tests::TempFile("ok.olotex").string() },
+        { OloEngine::Tests::TempFile("missing_b.png").string(), OloEngine::Tests::TempFile("b.olotex").string() },
+    };
+    const TextureCompression::BatchCompressResult result =
+        TextureCompression::CompressTextureFiles(jobs, TextureCompression::CompressOptions{}, 3);
+
+    EXPECT_EQ(result.Compressed, 1u);
+    ASSERT_EQ(result.FailedPaths.size(), 2u);
+    EXPECT_EQ(result.FailedPaths[0], jobs[0].SrcImagePath);
+    EXPECT_EQ(result.FailedPaths[1], jobs[2].SrcImagePath);
+    EXPECT_FALSE(TextureCompression::CompressDirectory(OloEngine::Tests::TempFile("no_such_dir").string(),
+                                                       OloEngine::Tests::TempDir("unused").string(),
+                                                       TextureCompression::CompressOptions{})
+                     .Succeeded());
+}
+
+TEST(TextureCompression, CompressImageFileReusesDerivedDataForIdenticalContent)
+{
+    // The derived-data cache keys a cook on the source BYTES and resolved settings, so the
+    // same image under another name and directory is a hit, and a hit is the same chain
+    // bit-for-bit. The test main roots DerivedDataCache::Get() in this process's scratch.
+    EnsureTaskWorkers();
+    DerivedDataCache& cache = DerivedDataCache::Get();
+    ASSERT_TRUE(cache.IsEnabled());
+
+    const std::vector<u8> pixels = MakeGradientRGBA(24, 20);
+    const std::filesystem::path first = OloEngine::Tests::TempDir("a") / "detail_mask.png";
+    const std::filesystem::path second = OloEngine::Tests::TempDir("b") / "renamed_mask.png";
+    for (const std::filesystem::path& path : { first, second })
+    {
+        ASSERT_NE(::stbi_write_png(path.string().c_str(), 24, 20, 4, pixels.data(), 24 * 4), 0);
+    }
+
+    TextureCompression::CompressOptions options;
+    options.GenerateMips = true;
+    CompressedTextureImage cooked;
+    ASSERT_TRUE(TextureCompression::CompressImageFile(first.string(), options, cooked));
+
+    const u64 hitsBefore = cache.GetStatistics().Hits;
+    CompressedTextureImage reused;
+    ASSERT_TRUE(TextureCompression::CompressImageFile(second.string(), options, reused));
+    EXPECT_EQ(cache.GetStatistics().Hits, hitsBefore + 1);
+    EXPECT_EQ(TextureCompression::SerializeToBlob(reused), TextureCompression::SerializeToBlob(cooked));
+
+    // A setting that changes the output is part of the key, so the mipped entry is not
+    // handed back for a single-level cook...
+    options.GenerateMips = false;
+    CompressedTextureImage singleLevel;
+    ASSERT_TRUE(TextureCompression::CompressImageFile(second.string(), options, singleLevel));
+    EXPECT_EQ(singleLevel.MipLevels(), 1u);
+
+    // ...and a caller can opt out entirely.
+    options.GenerateMips = true;
+    options.UseDerivedDataCache = false;
+    const u64 hitsBeforeOptOut = cache.GetStatistics().Hits;
+    CompressedTextureImage fresh;
+    ASSERT_TRUE(TextureCompression::CompressImageFile(second.string(), options, fresh));
+    EXPECT_EQ(cache.GetStatistics().Hits, hitsBeforeOptOut);
+    EXPECT_EQ(TextureCompression::SerializeToBlob(fresh), TextureCompression::SerializeToBlob(cooked));
+}
@@ -0,0 +1,136 @@
+// OLO_TEST_LAYER: unit
+#include "OloEnginePCH.h"
+#include "../TestTaskWorkers.h"
+#include "VirtualMeshFixtures.h"
+#include <gtest/gtest.h>
+
+// =============================================================================
+// VirtualMeshBuilderBenchmarkTest
+//
+// Source triangles per second through the offline cluster-DAG cook on large
+// meshes: one dense submesh (the groups of each level simplified across
+// ParallelFor), and a multi-submesh set (submeshes built concurrently). Both
+// are checked for bit-identical output across runs and for the streamed
+// levels arriving in order; throughput floors only under --olo-bench-assert.
+// =============================================================================
+
+#include "OloEngine/Renderer/MeshSource.h"
+#include "OloEngine/Renderer/VirtualGeometry/VirtualMesh.h"
+#include "OloEngine/Renderer/VirtualGeometry/VirtualMeshBuilder.h"
+#include "OloEngine/Task/NamedThreads.h"
+#include "OloEngine/Task/Scheduler.h"
+
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+using namespace OloEngine; // NOLINT(google-build-using-namespace) — test file
+using OloEngine::Tests::BenchAssertEnabled;
+using OloEngine::Tests::SecondsSince;
+using OloEngine::Tests::EnsureTaskWorkers;
+
+namespace
+{
+    using Clock = std::chrono::high_resolution_clock;
+
+    // Splits the source's index buffer into `count` triangle-aligned submeshes.
+    void SplitIntoSubmeshes(MeshSource& mesh, u32 count)
+    {
+        auto const totalIndices = static_cast<u32>(mesh.GetIndices().Num());
+        u32 const slice = (totalIndices / (3u * count)) * 3u;
+        for (u32 i = 0; i < count; ++i)
+        {
+            Submesh submesh;
+            submesh.m_BaseIndex = i * slice;
+            submesh.m_IndexCount = i + 1 == count ? totalIndices - i * slice : slice;
+            submesh.m_MaterialIndex = i;
+            mesh.AddSubmesh(submesh);
+        }
+    }
+} // namespace
+
+TEST(VirtualMeshBuilderBenchmark, DenseSubmeshTrianglesPerSecond)
+{
+    EnsureTaskWorkers();
+
+    // 327,680 triangles: deep enough that most of the cook is in the level loop.
+    auto mesh = OloEngine::Tests::VirtualMeshFixtures::MakeIcosphereMesh(7);
+
+    std::vector<u32> streamedLevels;
+    Clock::time_point start = Clock::now();
+    VirtualMesh const streamed = VirtualMeshBuilder::BuildSubmesh(*mesh, 0, {},
+                                                                  [&streamedLevels](u32, const VirtualMesh& snapshot)
+                                                                  {
+                                                                      streamedLevels.push_back(snapshot.LevelCount);
+                                                                  });
+    const f64 streamedSeconds = SecondsSince(start);
+
+    start = Clock::now();
+    VirtualMesh const plain = VirtualMeshBuilder::Build(*mesh);
+    const f64 plainSeconds = SecondsSince(start);
+
+    ASSERT_TRUE(plain.IsValid());
+    EXPECT_GT(plain.LevelCount, 4u);
+    EXPECT_EQ(VirtualMeshSerializer::SerializeToBlob(streamed), VirtualMeshSerializer::SerializeToBlob(plain))
+        << "the parallel cook must be bit-reproducible, with or without a level sink";
+
+    ASSERT_FALSE(streamedLevels.empty());
+    EXPECT_EQ(streamedLevels.back(), plain.LevelCount);
+    for (sizet i = 1; i < streamedLevels.size(); ++i)
+        EXPECT_GT(streamedLevels[i], streamedLevels[i - 1]) << "levels must stream in order";
+
+    const f64 triangles = static_cast<f64>(plain.SourceTriangleCount);
+    OLO_CORE_INFO("[VirtualMeshBuilderBenchmark] {} triangles -> {} clusters, {} levels on {} workers: "
+                  "{:.0f} tris/s ({:.2f} s), streaming {:.0f} tris/s ({} snapshots)",
+                  plain.SourceTriangleCount, plain.Clusters.size(), plain.LevelCount,
+                  LowLevelTasks::FScheduler::Get().GetNumWorkers(), triangles / plainSeconds, plainSeconds,
+                  triangles / streamedSeconds, streamedLevels.size());
+
+    if (BenchAssertEnabled())
+        EXPECT_GT(triangles / plainSeconds, 50000.0) << "dense DAG cook throughput";
+}
+
+TEST(VirtualMeshBuilderBenchmark, MultiSubmeshSetTrianglesPerSecond)
+{
+    EnsureTaskWorkers();
+
+    constexpr u32 kSubmeshes = 8;
+    auto mesh = OloEngine::Tests::VirtualMeshFixtures::MakeIcosphereMesh(6);
+    SplitIntoSubmeshes(*mesh, kSubmeshes);
+
+    std::mutex sinkMutex;
+    std::vector<std::vector<u32>> streamedLevels(kSubmeshes);
+    Clock::time_point start = Clock::now();
+    VirtualMeshSet const set = VirtualMeshBuilder::BuildSet(*mesh, {},
+                                                            [&](u32 submeshIndex, const VirtualMesh& snapshot)
+                                                            {
+                                                                std::scoped_lock lock(sinkMutex);
+                                                                streamedLevels[submeshIndex].push_back(snapshot.LevelCount);
+                                                            });
+    const f64 setSeconds = SecondsSince(start);
+
+    start = Clock::now();
+    std::vector<VirtualMesh> oneByOne;
+    for (u32 i = 0; i < kSubmeshes; ++i)
+        oneByOne.push_back(VirtualMeshBuilder::BuildSubmesh(*mesh, i));
+    const f64 oneByOneSeconds = SecondsSince(start);
+
+    ASSERT_TRUE(set.IsValid());
+    ASSERT_EQ(set.Parts.size(), kSubmeshes);
+    for (u32 i = 0; i < kSubmeshes; ++i)
+    {
+        EXPECT_EQ(VirtualMeshSerializer::SerializeToBlob(set.Parts[i].Dag), VirtualMeshSerializer::SerializeToBlob(oneByOne[i]))
+            << "part " << i;
+        ASSERT_FALSE(streamedLevels[i].empty()) << "part " << i;
+        EXPECT_EQ(streamedLevels[i].back(), set.Parts[i].Dag.LevelCount) << "part " << i;
+    }
+
+    const f64 triangles = static_cast<f64>(set.TotalSourceTriangles());
+    OLO_CORE_INFO("[VirtualMeshBuilderBenchmark] {} submeshes, {} triangles: set {:.0f} tris/s, "
+                  "one by one {:.0f} tris/s ({:.2f}x)",
+                  kSubmeshes, set.TotalSourceTriangles(), triangles / setSeconds, triangles / oneByOneSeconds,
+                  oneByOneSeconds / setSeconds);
+
+    if (BenchAssertEnabled())
+        EXPECT_GT(triangles / setSeconds, 50000.0) << "multi-submesh set cook throughput";
+}
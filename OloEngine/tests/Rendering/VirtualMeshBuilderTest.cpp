@@ -14,11 +14,13 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <bit>
 #include <cmath>
 #include <cstring>
 #include <limits>
 #include <map>
+#include <mutex>
 #include <random>
 #include <set>
 #include <string>
@@ -1230,6 +1232,111 @@ TEST(VirtualMeshBuilder, BuildIsDeterministic)
     EXPECT_EQ(blobA, blobB) << "the cook must be bit-reproducible for identical input";
 }
 
+// Streaming mode: every snapshot handed to the LevelSink is a complete, loadable DAG whose
+// cuts are watertight, the snapshots deepen monotonically, and the last one IS the result.
+TEST(VirtualMeshBuilder, StreamedSnapshotsAreWatertightAndEndWithTheFinalDag)
+{
+    auto mesh = MakeIcosphereMesh(4);
+
+    std::vector<VirtualMesh> snapshots;
+    VirtualMesh const vm = VirtualMeshBuilder::BuildSubmesh(*mesh, 0, {},
+                                                            [&snapshots](u32 submeshIndex, const VirtualMesh& snapshot)
+                                                            {
+                                                                EXPECT_EQ(submeshIndex, 0u);
+                                                                snapshots.push_back(snapshot);
+                                                            });
+    ASSERT_TRUE(vm.IsValid());
+    ASSERT_GE(snapshots.size(), 3u) << "the 5120-triangle sphere needs several levels, each one streamed";
+
+    EXPECT_EQ(VirtualMeshSerializer::SerializeToBlob(snapshots.back()), VirtualMeshSerializer::SerializeToBlob(vm));
+
+    u32 previousLevels = 0;
+    for (sizet i = 0; i < snapshots.size(); ++i)
+    {
+        const VirtualMesh& snapshot = snapshots[i];
+        ASSERT_TRUE(snapshot.IsValid()) << "snapshot " << i;
+        EXPECT_EQ(snapshot.SourceTriangleCount, vm.SourceTriangleCount);
+        EXPECT_GT(snapshot.LevelCount, previousLevels) << "snapshot " << i;
+        previousLevels = snapshot.LevelCount;
+
+        for (f32 const threshold : InterestingThresholds(snapshot))
+        {
+            ExpectWatertightSelection(snapshot, snapshot.SelectClusters(threshold), "streamed snapshot cut");
+        }
+
+        VirtualMesh loaded;
+        EXPECT_TRUE(VirtualMeshSerializer::DeserializeFromBlob(VirtualMeshSerializer::SerializeToBlob(snapshot), loaded))
+            << "snapshot " << i << " must load like any cooked DAG";
+    }
+}
+
+// BuildSet builds its submeshes concurrently; each part must still be exactly the DAG a
+// lone BuildSubmesh produces, and every part must reach the sink.
+TEST(VirtualMeshBuilder, ConcurrentBuildSetMatchesPerSubmeshBuilds)
+{
+    auto multi = MakeIcosphereMesh(4);
+    auto const totalIndices = static_cast<u32>(multi->GetIndices().Num());
+    u32 const quarter = (totalIndices / 12u) * 3u; // triangle-aligned
+    for (u32 i = 0; i < 4; ++i)
+    {
+        Submesh submesh;
+        submesh.m_BaseIndex = i * quarter;
+        submesh.m_IndexCount = i == 3 ? totalIndices - 3 * quarter : quarter;
+        submesh.m_MaterialIndex = i;
+        multi->AddSubmesh(submesh);
+    }
+
+    std::mutex sinkMutex;
+    std::set<u32> streamedParts;
+    VirtualMeshSet const set = VirtualMeshBuilder::BuildSet(*multi, {},
+                                                            [&](u32 submeshIndex, const VirtualMesh&)
+                                                            {
+                                                                std::scoped_lock lock(sinkMutex);
+                                                                streamedParts.insert(submeshIndex);
+                                                            });
+    ASSERT_EQ(set.Parts.size(), 4u);
+    EXPECT_EQ(streamedParts, (std::set<u32>{ 0u, 1u, 2u, 3u }));
+
+    for (u32 i = 0; i < 4; ++i)
+    {
+        EXPECT_EQ(set.Parts[i].SubmeshIndex, i);
+        EXPECT_EQ(VirtualMeshSerializer::SerializeToBlob(set.Parts[i].Dag),
+                  VirtualMeshSerializer::SerializeToBlob(VirtualMeshBuilder::BuildSubmesh(*multi, i)))
+            << "part " << i;
+    }
+}
+
+// A cancelled build stops at the next level or group: it returns nothing and streams no
+// further snapshot, so a stale background build can never publish over a newer one.
+TEST(VirtualMeshBuilder, CancelledBuildStopsAndStreamsNothingFurther)
+{
+    auto mesh = MakeIcosphereMesh(4);
+
+    std::atomic<bool> cancel = true;
+    VirtualMeshBuildConfig config;
+    config.CancelToken = &cancel;
+    u32 snapshotCount = 0;
+    auto const countSnapshots = [&snapshotCount](u32, const VirtualMesh&)
+    {
+        ++snapshotCount;
+    };
+
+    EXPECT_FALSE(VirtualMeshBuilder::BuildSubmesh(*mesh, 0, config, countSnapshots).IsValid());
+    EXPECT_FALSE(VirtualMeshBuilder::BuildSet(*mesh, config, countSnapshots).IsValid());
+    EXPECT_EQ(snapshotCount, 0u) << "a build cancelled up front must not reach the sink";
+
+    // Cancelled from inside the sink after the first level, as Invalidate does mid-build
+    cancel = false;
+    VirtualMesh const vm = VirtualMeshBuilder::BuildSubmesh(*mesh, 0, config,
+                                                            [&](u32, const VirtualMesh&)
+                                                            {
+                                                                ++snapshotCount;
+                                                                cancel = true;
+                                                            });
+    EXPECT_FALSE(vm.IsValid());
+    EXPECT_EQ(snapshotCount, 1u) << "no level after the cancellation may be streamed";
+}
+
 // =============================================================================
 // Serialization
 // =============================================================================
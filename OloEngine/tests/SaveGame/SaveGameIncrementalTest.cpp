@@ -0,0 +1,169 @@
+// OLO_TEST_LAYER: unit
+// =============================================================================
+// SaveGameIncrementalTest.cpp
+//
+// Pins the three pieces the async save/load path is built from:
+//
+//   * SnapshotSceneState + SerializeSnapshot must produce byte-for-byte the
+//     payload CaptureSceneState does — the snapshot is an optimisation of
+//     *when* the work happens, never of *what* is written.
+//   * An incremental payload merged onto its base must restore exactly the
+//     scene it was taken from (changed, removed and newly created entities).
+//   * SaveGameRestoreJob must leave the live scene untouched until Commit.
+// =============================================================================
+
+#include "OloEnginePCH.h"
+#include <gtest/gtest.h>
+
+#include "OloEngine/Core/Ref.h"
+#include "OloEngine/SaveGame/SaveGameSerializer.h"
+#include "OloEngine/Scene/Components.h"
+#include "OloEngine/Scene/Entity.h"
+#include "OloEngine/Scene/Scene.h"
+
+using namespace OloEngine;
+
+class SaveGameIncrementalTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        m_Scene = Ref<Scene>::Create();
+        for (u32 i = 0; i < 8; ++i)
+        {
+            Entity e = m_Scene->CreateEntity("Entity" + std::to_string(i));
+            e.GetComponent<TransformComponent>().Translation = { static_cast<f32>(i), 0.0f, 0.0f };
+            m_UUIDs.push_back(e.GetUUID());
+        }
+    }
+
+    static u32 CountEntities(const Ref<Scene>& scene)
+    {
+        u32 count = 0;
+        auto view = scene->GetAllEntitiesWith<IDComponent>();
+        for ([[maybe_unused]] auto e : view)
+        {
+            ++count;
+        }
+        return count;
+    }
+
+    Ref<Scene> m_Scene;
+    std::vector<UUID> m_UUIDs;
+};
+
+TEST_F(SaveGameIncrementalTest, SnapshotSerializesToCapturedBytes)
+{
+    m_Scene->GetEntityByUUID(m_UUIDs[2]).AddComponent<SpriteRendererComponent>().TilingFactor = 3.0f;
+
+    auto captured = SaveGameSerializer::CaptureSceneState(*m_Scene);
+    auto snapshot = SaveGameSerializer::SnapshotSceneState(*m_Scene);
+    ASSERT_NE(snapshot, nullptr);
+    EXPECT_EQ(snapshot->GetEntityCount(), 8u);
+
+    // Mutating the live scene after the snapshot must not leak into it
+    m_Scene->GetEntityByUUID(m_UUIDs[0]).GetComponent<TransformComponent>().Translation.x = 100.0f;
+
+    EXPECT_EQ(SaveGameSerializer::SerializeSnapshot(*snapshot), captured);
+}
+
+TEST_F(SaveGameIncrementalTest, UnchangedSceneHasNoDirtyEntities)
+{
+    auto baseSnapshot = SaveGameSerializer::SnapshotSceneState(*m_Scene);
+    ASSERT_NE(baseSnapshot, nullptr);
+    SaveGameCheckpoint base;
+    (void)SaveGameSerializer::SerializeSnapshot(*baseSnapshot, &base);
+    EXPECT_EQ(base.RecordHashes.size(), 8u);
+
+    auto snapshot = SaveGameSerializer::SnapshotSceneState(*m_Scene);
+    ASSERT_NE(snapshot, nullptr);
+    u32 dirty = ~0u;
+    (void)SaveGameSerializer::SerializeSnapshotIncremental(*snapshot, base, dirty);
+    EXPECT_EQ(dirty, 0u);
+}
+
+TEST_F(SaveGameIncrementalTest, MergedIncrementalRestoresCurrentState)
+{
+    auto baseSnapshot = SaveGameSerializer::SnapshotSceneState(*m_Scene);
+    ASSERT_NE(baseSnapshot, nullptr);
+    SaveGameCheckpoint base;
+    auto basePayload = SaveGameSerializer::SerializeSnapshot(*baseSnapshot, &base);
+
+    // One modified in place (no registry signal), one removed, one created
+    m_Scene->GetEntityByUUID(m_UUIDs[1]).GetComponent<TransformComponent>().Translation.y = 42.0f;
+    m_Scene->DestroyEntity(m_Scene->GetEntityByUUID(m_UUIDs[5]));
+    Entity added = m_Scene->CreateEntity("Added");
+    added.GetComponent<TransformComponent>().Translation = { 7.0f, 8.0f, 9.0f };
+
+    auto snapshot = SaveGameSerializer::SnapshotSceneState(*m_Scene);
+    ASSERT_NE(snapshot, nullptr);
+    u32 dirty = 0;
+    auto incremental = SaveGameSerializer::SerializeSnapshotIncremental(*snapshot, base, dirty);
+    EXPECT_EQ(dirty, 3u);
+    EXPECT_LT(incremental.size(), basePayload.size());
+
+    std::vector<u8> merged;
+    ASSERT_TRUE(SaveGameSerializer::MergeIncrementalPayload(basePayload, incremental, merged));
+
+    Ref<Scene> restored = Ref<Scene>::Create();
+    ASSERT_TRUE(SaveGameSerializer::RestoreSceneState(*restored, merged));
+    EXPECT_EQ(CountEntities(restored), 8u);
+
+    EXPECT_FALSE(restored->TryGetEntityWithUUID(m_UUIDs[5]).has_value());
+    EXPECT_FLOAT_EQ(restored->GetEntityByUUID(m_UUIDs[1]).GetComponent<TransformComponent>().Translation.y, 42.0f);
+    EXPECT_FLOAT_EQ(restored->GetEntityByUUID(m_UUIDs[3]).GetComponent<TransformComponent>().Translation.x, 3.0f);
+
+    auto restoredAdded = restored->TryGetEntityWithUUID(added.GetUUID());
+    ASSERT_TRUE(restoredAdded.has_value());
+    EXPECT_EQ(restoredAdded->GetComponent<TagComponent>().Tag, "Added");
+    EXPECT_FLOAT_EQ(restoredAdded->GetComponent<TransformComponent>().Translation.z, 9.0f);
+}
+
+TEST_F(SaveGameIncrementalTest, MergeRejectsTruncatedIncremental)
+{
+    auto snapshot = SaveGameSerializer::SnapshotSceneState(*m_Scene);
+    ASSERT_NE(snapshot, nullptr);
+    SaveGameCheckpoint base;
+    auto basePayload = SaveGameSerializer::SerializeSnapshot(*snapshot, &base);
+
+    m_Scene->GetEntityByUUID(m_UUIDs[0]).GetComponent<TransformComponent>().Translation.x = -1.0f;
+    auto current = SaveGameSerializer::SnapshotSceneState(*m_Scene);
+    ASSERT_NE(current, nullptr);
+    u32 dirty = 0;
+    auto incremental = SaveGameSerializer::SerializeSnapshotIncremental(*current, base, dirty);
+    incremental.resize(incremental.size() - 3);
+
+    std::vector<u8> merged;
+    EXPECT_FALSE(SaveGameSerializer::MergeIncrementalPayload(basePayload, incremental, merged));
+}
+
+TEST_F(SaveGameIncrementalTest, RestoreJobLeavesLiveSceneAloneUntilCommit)
+{
+    auto payload = SaveGameSerializer::CaptureSceneState(*m_Scene);
+
+    Ref<Scene> target = Ref<Scene>::Create();
+    Entity survivor = target->CreateEntity("Survivor");
+    const UUID survivorId = survivor.GetUUID();
+
+    SaveGameRestoreJob job(*target, payload);
+    ASSERT_EQ(job.GetStatus(), SaveGameRestoreJob::EStatus::InProgress);
+    EXPECT_EQ(job.GetEntityCount(), 8u);
+
+    u32 steps = 0;
+    while (job.GetStatus() == SaveGameRestoreJob::EStatus::InProgress)
+    {
+        job.Step(1);
+        ++steps;
+        EXPECT_EQ(CountEntities(target), 1u);
+        EXPECT_TRUE(target->TryGetEntityWithUUID(survivorId).has_value());
+    }
+    EXPECT_GE(steps, 8u);
+    ASSERT_EQ(job.GetStatus(), SaveGameRestoreJob::EStatus::ReadyToCommit);
+    EXPECT_EQ(job.GetEntitiesRestored(), 8u);
+
+    ASSERT_TRUE(job.Commit(*target));
+    EXPECT_EQ(job.GetStatus(), SaveGameRestoreJob::EStatus::Committed);
+    EXPECT_EQ(CountEntities(target), 8u);
+    EXPECT_FALSE(target->TryGetEntityWithUUID(survivorId).has_value());
+    EXPECT_FLOAT_EQ(target->GetEntityByUUID(m_UUIDs[6]).GetComponent<TransformComponent>().Translation.x, 6.0f);
+}
@@ -0,0 +1,141 @@
+// OLO_TEST_LAYER: unit
+#include "OloEnginePCH.h"
+#include "../TestTaskWorkers.h"
+#include <gtest/gtest.h>
+
+// =============================================================================
+// SaveGameSerializerBenchmarkTest
+//
+// Captures and restores a 20k-entity scene through the sectioned (v20) layout,
+// and restores the same scene from the per-entity record layout for reference.
+// Entities per second are logged unconditionally; the restored scene is always
+// checked against the source. Timing bounds only under --olo-bench-assert.
+// =============================================================================
+
+#include "OloEngine/Core/Base.h"
+#include "OloEngine/Core/Ref.h"
+#include "OloEngine/SaveGame/SaveGameSerializer.h"
+#include "OloEngine/Scene/Components.h"
+#include "OloEngine/Scene/Entity.h"
+#include "OloEngine/Scene/Scene.h"
+
+#include <chrono>
+
+using namespace OloEngine; // NOLINT(google-build-using-namespace) — test file
+using OloEngine::Tests::BenchAssertEnabled;
+
+namespace
+{
+    using Clock = std::chrono::high_resolution_clock;
+
+    constexpr u32 kEntityCount = 20'000;
+
+    f64 MillisecondsSince(Clock::time_point start)
+    {
+        return std::chrono::duration<f64, std::milli>(Clock::now() - start).count();
+    }
+
+    f64 EntitiesPerSecond(f64 ms)
+    {
+        return ms > 0.0 ? static_cast<f64>(kEntityCount) * 1000.0 / ms : 0.0;
+    }
+
+    Ref<Scene> BuildScene(std::vector<UUID>& outUUIDs)
+    {
+        Ref<Scene> scene = Ref<Scene>::Create();
+        outUUIDs.reserve(kEntityCount);
+        for (u32 i = 0; i < kEntityCount; ++i)
+        {
+            Entity e = scene->CreateEntity("Entity" + std::to_string(i));
+            e.GetComponent<TransformComponent>().Translation = { static_cast<f32>(i), 1.0f, 2.0f };
+            if (i % 2 == 0)
+            {
+                e.AddComponent<SpriteRendererComponent>().TilingFactor = static_cast<f32>(i % 7);
+            }
+            if (i % 5 == 0)
+            {
+                e.AddComponent<CircleRendererComponent>().Thickness = 0.5f;
+            }
+            outUUIDs.push_back(e.GetUUID());
+        }
+        return scene;
+    }
+
+    u32 CountEntities(Scene& scene)
+    {
+        u32 count = 0;
+        for ([[maybe_unused]] auto e : scene.GetAllEntitiesWith<IDComponent>())
+        {
+            ++count;
+        }
+        return count;
+    }
+} // namespace
+
+TEST(SaveGameSerializerBenchmark, SectionedCaptureAndRestore)
+{
+    std::vector<UUID> uuids;
+    Ref<Scene> scene = BuildScene(uuids);
+
+    auto start = Clock::now();
+    std::vector<u8> payload = SaveGameSerializer::CaptureSceneState(*scene);
+    f64 const captureMs = MillisecondsSince(start);
+    ASSERT_FALSE(payload.empty());
+
+    auto snapshot = SaveGameSerializer::SnapshotSceneState(*scene);
+    ASSERT_NE(snapshot, nullptr);
+    start = Clock::now();
+    SaveGameCheckpoint checkpoint;
+    std::vector<u8> snapshotPayload = SaveGameSerializer::SerializeSnapshot(*snapshot, &checkpoint);
+    f64 const serializeMs = MillisecondsSince(start);
+    EXPECT_EQ(snapshotPayload, payload);
+    EXPECT_EQ(checkpoint.RecordHashes.size(), kEntityCount);
+
+    std::vector<u8> legacyPayload;
+    ASSERT_TRUE(SaveGameSerializer::ConvertToEntityRecordLayout(payload, legacyPayload));
+
+    Ref<Scene> restored = Ref<Scene>::Create();
+    start = Clock::now();
+    ASSERT_TRUE(SaveGameSerializer::RestoreSceneState(*restored, payload));
+    f64 const restoreMs = MillisecondsSince(start);
+
+    Ref<Scene> restoredLegacy = Ref<Scene>::Create();
+    start = Clock::now();
+    ASSERT_TRUE(SaveGameSerializer::RestoreSceneState(*restoredLegacy, legacyPayload));
+    f64 const restoreLegacyMs = MillisecondsSince(start);
+
+    OLO_CORE_INFO("[SaveGameSerializerBenchmark] {} entities, {} KiB: capture {:.2f} ms ({:.0f} ent/s), "
+                  "snapshot serialize {:.2f} ms ({:.0f} ent/s)",
+                  kEntityCount, payload.size() / 1024, captureMs, EntitiesPerSecond(captureMs), serializeMs,
+                  EntitiesPerSecond(serializeMs));
+    OLO_CORE_INFO("[SaveGameSerializerBenchmark] restore sectioned {:.2f} ms ({:.0f} ent/s), "
+                  "per-entity records {:.2f} ms ({:.0f} ent/s)",
+                  restoreMs, EntitiesPerSecond(restoreMs), restoreLegacyMs, EntitiesPerSecond(restoreLegacyMs));
+
+    // Both layouts restore the same scene
+    EXPECT_EQ(CountEntities(*restored), kEntityCount);
+    EXPECT_EQ(CountEntities(*restoredLegacy), kEntityCount);
+    for (u32 i = 0; i < kEntityCount; i += 997)
+    {
+        Entity e = restored->GetEntityByUUID(uuids[i]);
+        Entity legacy = restoredLegacy->GetEntityByUUID(uuids[i]);
+        EXPECT_EQ(e.GetComponent<TagComponent>().Tag, "Entity" + std::to_string(i));
+        EXPECT_FLOAT_EQ(e.GetComponent<TransformComponent>().Translation.x, static_cast<f32>(i));
+        EXPECT_EQ(e.HasComponent<SpriteRendererComponent>(), i % 2 == 0);
+        EXPECT_EQ(e.HasComponent<CircleRendererComponent>(), i % 5 == 0);
+        EXPECT_EQ(legacy.GetComponent<TagComponent>().Tag, e.GetComponent<TagComponent>().Tag);
+        EXPECT_EQ(legacy.HasComponent<SpriteRendererComponent>(), e.HasComponent<SpriteRendererComponent>());
+    }
+
+    // And re-capture to the same bytes
+    EXPECT_EQ(SaveGameSerializer::CaptureSceneState(*restored).size(), payload.size());
+
+    if (BenchAssertEnabled())
+    {
+        // Well under a second for 20k small entities on any CI box; the sectioned
+        // restore must not regress behind the per-entity one it replaced.
+        EXPECT_LT(captureMs, 1000.0);
+        EXPECT_LT(restoreMs, 2000.0);
+        EXPECT_LT(restoreMs, restoreLegacyMs * 1.5);
+    }
+}
@@ -472,7 +472,9 @@ namespace OloEngine::Tests
         // Capture with the current (v6) serializer, then surgically replace the
         // TerrainComponent's on-disk block with a hand-written pre-v3 payload --
         // exactly what a genuine pre-v3 save would have contained for it.
-        std::vector<u8> data = SaveGameSerializer::CaptureSceneState(*scene);
+        // Saves that old use the per-entity record layout, so convert first.
+        std::vector<u8> data;
+        ASSERT_TRUE(SaveGameSerializer::ConvertToEntityRecordLayout(SaveGameSerializer::CaptureSceneState(*scene), data));
 
         constexpr u32 kTerrainTypeHash = Hash::GenerateFNVHash("TerrainComponent");
         auto [start, end] = FindComponentBlock(data, kTerrainTypeHash);
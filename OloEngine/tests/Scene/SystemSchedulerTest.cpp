@@ -540,7 +540,7 @@ TEST(SystemSchedulerTest, GameplayScheduleHonoursDocumentedSeams)
     EXPECT_TRUE(sched.DependsOn("PropagateTransforms", "PhysicsFence")); // compose after movers (#499)
     EXPECT_TRUE(sched.DependsOn("Navigation", "PropagateTransforms"));   // nav writes after compose read
     EXPECT_TRUE(sched.DependsOn("SpatialIndex", "Navigation"));          // index sees nav-moved agents
-    EXPECT_TRUE(sched.DependsOn("Perception", "SpatialIndex"));          // perception queries the index
+    EXPECT_TRUE(sched.DependsOn("Perception", "SpatialIndex"));          // perception runs after the index
     EXPECT_TRUE(sched.DependsOn("AI", "Perception"));                    // AI consumes fresh sensor data
     EXPECT_TRUE(sched.DependsOn("Inventory", "PhysicsFence"));           // pickup proximity reads post-physics transforms
     // Destructibles must observe the joint-break phase run inside PhysicsFence,
@@ -1,6 +1,6 @@
 // OLO_TEST_LAYER: unit
 #include "OloEnginePCH.h"
-#include "../TestOptions.h"
+#include "../TestTaskWorkers.h"
 #include <gtest/gtest.h>
 
 // =============================================================================
@@ -36,14 +36,10 @@
 #include <string>
 
 using namespace OloEngine; // NOLINT(google-build-using-namespace) — test file
+using OloEngine::Tests::BenchAssertEnabled;
 
 namespace
 {
-    bool BenchAssertEnabled()
-    {
-        return OloEngine::Tests::Options().BenchAssert;
-    }
-
     using Clock = std::chrono::high_resolution_clock;
 
     // N root entities spread along a diagonal — the realistic "many entities in
@@ -1,6 +1,6 @@
 // OLO_TEST_LAYER: unit
 #include "OloEnginePCH.h"
-#include "../TestOptions.h"
+#include "../TestTaskWorkers.h"
 #include <gtest/gtest.h>
 
 // =============================================================================
@@ -30,14 +30,10 @@
 #include <string>
 
 using namespace OloEngine; // NOLINT(google-build-using-namespace) — test file
+using OloEngine::Tests::BenchAssertEnabled;
 
 namespace
 {
-    bool BenchAssertEnabled()
-    {
-        return OloEngine::Tests::Options().BenchAssert;
-    }
-
     using Clock = std::chrono::high_resolution_clock;
 
     // N entities, all roots (no parenting) — the common case for e.g. the
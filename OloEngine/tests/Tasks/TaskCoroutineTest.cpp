@@ -0,0 +1,322 @@
+/**
+ * @file TaskCoroutineTest.cpp
+ * @brief Unit tests for TCoTask coroutines on the task system
+ *
+ * Tests cover: co_await on TTask/FTaskEvent/TCoTask, ResumeOn(FPipe),
+ *              ResumeOnGameThread, cancellation through TCoTask::Cancel and
+ *              FCancellationToken parameters, waiting without parking workers
+ */
+
+#include "OloEnginePCH.h"
+#include <gtest/gtest.h>
+
+#include "OloEngine/Task/Coroutine.h"
+#include "OloEngine/Task/Scheduler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace OloEngine;
+using namespace OloEngine::Tasks;
+
+namespace
+{
+    // Sets a flag when destroyed, to observe frame unwinding
+    struct FDestructionFlag
+    {
+        std::atomic<bool>* Flag;
+        ~FDestructionFlag()
+        {
+            Flag->store(true);
+        }
+    };
+
+    TCoTask<i32> AddOneAfterTask(i32 Value)
+    {
+        i32 Result = co_await Launch("Produce", [Value]()
+                                     { return Value; });
+        co_return Result + 1;
+    }
+
+    TCoTask<i32> AwaitEvent(FTaskEvent Event, std::atomic<bool>* Resumed)
+    {
+        co_await Event;
+        Resumed->store(true);
+        co_return 7;
+    }
+
+    TCoTask<i32> AwaitCoroutine(i32 Value)
+    {
+        i32 Inner = co_await AddOneAfterTask(Value);
+        co_return Inner * 2;
+    }
+
+    TCoTask<void> IncrementInPipe(FPipe& Pipe, i32& Counter, std::atomic<i32>& Concurrent, std::atomic<bool>& Overlapped)
+    {
+        co_await ResumeOn(Pipe);
+        if (Concurrent.fetch_add(1) != 0)
+        {
+            Overlapped.store(true);
+        }
+        ++Counter;
+        std::this_thread::yield();
+        Concurrent.fetch_sub(1);
+    }
+
+    TCoTask<std::thread::id> HopToGameThread()
+    {
+        co_await ResumeOnGameThread();
+        std::thread::id const GameThread = std::this_thread::get_id();
+        co_await ResumeOnScheduler();
+        co_return GameThread;
+    }
+
+    TCoTask<i32> CancelableAwait(FTaskEvent Event, std::atomic<bool>* Started, std::atomic<bool>* Unwound, std::atomic<bool>* Resumed)
+    {
+        FDestructionFlag Flag{ Unwound };
+        Started->store(true);
+        co_await Event;
+        Resumed->store(true);
+        co_return 1;
+    }
+
+    TCoTask<i32> AwaitWithToken(FTaskEvent Event, [[maybe_unused]] const FCancellationToken& Token, std::atomic<bool>* Resumed)
+    {
+        co_await Event;
+        Resumed->store(true);
+        co_return 1;
+    }
+
+    TCoTask<i32> AwaitCanceledChild(FTaskEvent Event, std::atomic<bool>* ChildFlags, std::atomic<bool>* CancelIssued,
+                                    std::atomic<bool>* ParentResumed)
+    {
+        TCoTask<i32> Child = CancelableAwait(Event, &ChildFlags[0], &ChildFlags[1], &ChildFlags[2]);
+        Child.Cancel();
+        CancelIssued->store(true);
+        i32 const Value = co_await Child;
+        ParentResumed->store(true);
+        co_return Value;
+    }
+
+    TCoTask<bool> ReportCancellation(FTaskEvent Event)
+    {
+        co_await Event;
+        co_return co_await IsCancelRequested();
+    }
+} // namespace
+
+class TaskCoroutineTest : public ::testing::Test
+{
+  protected:
+    static void SetUpTestSuite()
+    {
+        LowLevelTasks::FScheduler::Get().StartWorkers();
+    }
+
+    static void TearDownTestSuite()
+    {
+        LowLevelTasks::FScheduler::Get().StopWorkers();
+    }
+};
+
+TEST_F(TaskCoroutineTest, AwaitsTaskResult)
+{
+    TCoTask<i32> Task = AddOneAfterTask(41);
+    EXPECT_EQ(Task.GetResult(), 42);
+    EXPECT_FALSE(Task.IsCanceled());
+}
+
+TEST_F(TaskCoroutineTest, SuspendsUntilEventWithoutBlockingCaller)
+{
+    FTaskEvent Event("Gate");
+    std::atomic<bool> Resumed{ false };
+    TCoTask<i32> Task = AwaitEvent(Event, &Resumed);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_FALSE(Task.IsCompleted());
+    EXPECT_FALSE(Resumed.load());
+
+    Event.Trigger();
+    EXPECT_EQ(Task.GetResult(), 7);
+    EXPECT_TRUE(Resumed.load());
+}
+
+TEST_F(TaskCoroutineTest, AwaitsOtherCoroutine)
+{
+    EXPECT_EQ(AwaitCoroutine(4).GetResult(), 10);
+}
+
+TEST_F(TaskCoroutineTest, CompletionTaskIsPrerequisite)
+{
+    TCoTask<i32> Task = AddOneAfterTask(1);
+    FTask Completion = Task.GetCompletionTask();
+    TTask<i32> After = Launch("After", [Task]()
+                              { return Task.GetResult() * 10; },
+                              Prerequisites(Completion));
+    EXPECT_EQ(After.GetResult(), 20);
+}
+
+TEST_F(TaskCoroutineTest, ResumeOnPipeIsSerialized)
+{
+    constexpr i32 kCoroutines = 256;
+    FPipe Pipe{ "CoroutinePipe" };
+    i32 Counter = 0;
+    std::atomic<i32> Concurrent{ 0 };
+    std::atomic<bool> Overlapped{ false };
+
+    std::vector<TCoTask<void>> Tasks;
+    Tasks.reserve(kCoroutines);
+    for (i32 i = 0; i < kCoroutines; ++i)
+    {
+        Tasks.push_back(IncrementInPipe(Pipe, Counter, Concurrent, Overlapped));
+    }
+    for (auto& Task : Tasks)
+    {
+        Task.Wait();
+    }
+    Pipe.WaitUntilEmpty();
+
+    EXPECT_EQ(Counter, kCoroutines);
+    EXPECT_FALSE(Overlapped.load());
+}
+
+TEST_F(TaskCoroutineTest, ResumeOnGameThreadRunsInProcessTasks)
+{
+    FNamedThreadManager::Get().AttachToThread(ENamedThread::GameThread);
+
+    TCoTask<std::thread::id> Task = HopToGameThread();
+    auto const Deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!Task.IsCompleted() && std::chrono::steady_clock::now() < Deadline)
+    {
+        FNamedThreadManager::Get().ProcessTasks(true);
+        std::this_thread::yield();
+    }
+
+    FNamedThreadManager::Get().DetachFromThread(ENamedThread::GameThread);
+    ASSERT_TRUE(Task.IsCompleted());
+    EXPECT_EQ(Task.GetResult(), std::this_thread::get_id());
+}
+
+TEST_F(TaskCoroutineTest, CancelDestroysSuspendedFrame)
+{
+    FTaskEvent Event("Gate");
+    std::atomic<bool> Started{ false };
+    std::atomic<bool> Unwound{ false };
+    std::atomic<bool> Resumed{ false };
+    TCoTask<i32> Task = CancelableAwait(Event, &Started, &Unwound, &Resumed);
+    while (!Started.load())
+    {
+        std::this_thread::yield();
+    }
+
+    // Suspended on the event now; cancel before it fires
+    Task.Cancel();
+    Event.Trigger();
+    Task.Wait();
+
+    EXPECT_TRUE(Task.IsCanceled());
+    EXPECT_TRUE(Unwound.load());
+    EXPECT_FALSE(Resumed.load());
+}
+
+TEST_F(TaskCoroutineTest, TokenParameterCancels)
+{
+    FTaskEvent Event("Gate");
+    FCancellationToken Token;
+    std::atomic<bool> Resumed{ false };
+    TCoTask<i32> Task = AwaitWithToken(Event, Token, &Resumed);
+
+    Token.Cancel();
+    Event.Trigger();
+    Task.Wait();
+
+    EXPECT_TRUE(Task.IsCanceled());
+    EXPECT_TRUE(Task.IsCancelRequested());
+    EXPECT_FALSE(Resumed.load());
+}
+
+TEST_F(TaskCoroutineTest, TokenParameterIsReleasedWithTheFrame)
+{
+    FTaskEvent Event("Gate");
+    std::atomic<bool> Resumed{ false };
+    TCoTask<i32> Task;
+    {
+        FCancellationToken Token;
+        Task = AwaitWithToken(Event, Token, &Resumed);
+        Event.Trigger();
+        Task.Wait();
+
+        // The frame is gone, so the handle stops observing the caller's
+        // token: a late Cancel() is not seen, and neither is its lifetime end.
+        Token.Cancel();
+        EXPECT_FALSE(Task.IsCancelRequested());
+    }
+
+    EXPECT_TRUE(Resumed.load());
+    EXPECT_FALSE(Task.IsCanceled());
+    EXPECT_FALSE(Task.IsCancelRequested());
+    EXPECT_EQ(Task.GetResult(), 1);
+}
+
+TEST_F(TaskCoroutineTest, CancellationPropagatesToAwaiter)
+{
+    FTaskEvent Event("Gate");
+    std::atomic<bool> ChildFlags[3] = { false, false, false };
+    std::atomic<bool> CancelIssued{ false };
+    std::atomic<bool> ParentResumed{ false };
+    TCoTask<i32> Parent = AwaitCanceledChild(Event, ChildFlags, &CancelIssued, &ParentResumed);
+    while (!CancelIssued.load())
+    {
+        std::this_thread::yield();
+    }
+
+    Event.Trigger();
+    Parent.Wait();
+
+    EXPECT_TRUE(Parent.IsCanceled());
+    EXPECT_FALSE(ParentResumed.load());
+}
+
+TEST_F(TaskCoroutineTest, IsCancelRequestedDoesNotSuspend)
+{
+    FTaskEvent Event("Gate");
+    TCoTask<bool> Task = ReportCancellation(Event);
+    Event.Trigger();
+    EXPECT_FALSE(Task.GetResult());
+}
+
+TEST_F(TaskCoroutineTest, SuspendedCoroutinesDoNotParkWorkers)
+{
+    // Far more waiters than workers. Had each blocked a worker, the task below
+    // could not run until the event fired.
+    u32 const Count = std::max(LowLevelTasks::FScheduler::Get().GetNumWorkers(), 1u) * 8;
+    FTaskEvent Event("Gate");
+    std::atomic<bool> Resumed{ false };
+
+    std::vector<TCoTask<i32>> Waiters;
+    Waiters.reserve(Count);
+    for (u32 i = 0; i < Count; ++i)
+    {
+        Waiters.push_back(AwaitEvent(Event, &Resumed));
+    }
+
+    // Polled rather than waited on: Wait() would retract it onto this thread
+    TTask<bool> Independent = Launch("Independent", []()
+                                     { return true; });
+    auto const Deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!Independent.IsCompleted() && std::chrono::steady_clock::now() < Deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_TRUE(Independent.IsCompleted());
+    EXPECT_FALSE(Resumed.load());
+
+    Event.Trigger();
+    for (auto& Waiter : Waiters)
+    {
+        EXPECT_EQ(Waiter.GetResult(), 7);
+    }
+}
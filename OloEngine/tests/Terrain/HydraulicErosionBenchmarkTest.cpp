@@ -0,0 +1,86 @@
+// OLO_TEST_LAYER: unit
+#include "OloEnginePCH.h"
+#include "../TestTaskWorkers.h"
+#include <gtest/gtest.h>
+
+// =============================================================================
+// HydraulicErosionBenchmarkTest
+//
+// Droplets per second through one CPU erosion pass (one droplet per cell, the
+// editor brush's default droplet settings) on a generated 512² field: the
+// sequential reference and the tiled pass on the worker pool. Reports how much
+// terrain each moved so a speedup bought by dropping droplets would show;
+// throughput floors only under --olo-bench-assert.
+// =============================================================================
+
+#include "OloEngine/Task/NamedThreads.h"
+#include "OloEngine/Task/Scheduler.h"
+#include "OloEngine/Terrain/HydraulicErosion.h"
+#include "OloEngine/Terrain/TerrainGenerator.h"
+
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+using namespace OloEngine; // NOLINT(google-build-using-namespace) — test file
+using OloEngine::Tests::BenchAssertEnabled;
+using OloEngine::Tests::SecondsSince;
+using OloEngine::Tests::EnsureTaskWorkers;
+
+namespace
+{
+    using Clock = std::chrono::high_resolution_clock;
+
+    constexpr u32 kResolution = 512;
+
+    f64 MovedMaterial(const std::vector<f32>& before, const std::vector<f32>& after)
+    {
+        f64 sum = 0.0;
+        for (sizet i = 0; i < before.size(); ++i)
+            sum += std::abs(static_cast<f64>(after[i]) - before[i]);
+        return sum;
+    }
+} // namespace
+
+TEST(HydraulicErosionBenchmark, DropletsPerSecond)
+{
+    EnsureTaskWorkers();
+
+    TerrainGenerator::HeightParams heightParams;
+    heightParams.Resolution = kResolution;
+    heightParams.Seed = 2024;
+    heightParams.Octaves = 6;
+    std::vector<f32> field;
+    TerrainGenerator::GenerateHeightField(field, heightParams);
+
+    const ErosionParams params; // DropletCount 0 → one per cell
+    const auto droplets = static_cast<f64>(kResolution) * kResolution;
+
+    std::vector<f32> sequential = field;
+    Clock::time_point start = Clock::now();
+    HydraulicErosion::ErodeSequential(sequential, kResolution, params, 11);
+    const f64 sequentialPerSecond = droplets / SecondsSince(start);
+
+    std::vector<f32> parallel = field;
+    start = Clock::now();
+    HydraulicErosion::ErodeParallel(parallel, kResolution, params, 11);
+    const f64 parallelPerSecond = droplets / SecondsSince(start);
+
+    const f64 movedSequential = MovedMaterial(field, sequential);
+    const f64 movedParallel = MovedMaterial(field, parallel);
+    ASSERT_GT(movedSequential, 0.0);
+    EXPECT_NEAR(movedParallel / movedSequential, 1.0, 0.05) << "the tiled pass must erode as much as the reference";
+
+    OLO_CORE_INFO("[HydraulicErosionBenchmark] {}^2, {:.0f} droplets x {} steps, halo {} texels",
+                  kResolution, droplets, params.MaxDropletSteps, HydraulicErosion::GetHaloWidth(params));
+    OLO_CORE_INFO("[HydraulicErosionBenchmark] sequential {:.0f} droplets/s, tiled on {} workers {:.0f} droplets/s "
+                  "({:.2f}x), moved material ratio {:.3f}",
+                  sequentialPerSecond, LowLevelTasks::FScheduler::Get().GetNumWorkers(), parallelPerSecond,
+                  parallelPerSecond / sequentialPerSecond, movedParallel / movedSequential);
+
+    if (BenchAssertEnabled())
+    {
+        EXPECT_GT(sequentialPerSecond, 5.0e4) << "single-thread droplet throughput";
+        EXPECT_GT(parallelPerSecond, 1.5 * sequentialPerSecond) << "the tiled pass must beat one thread";
+    }
+}
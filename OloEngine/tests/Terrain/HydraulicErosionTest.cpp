@@ -0,0 +1,196 @@
+// OLO_TEST_LAYER: unit
+//
+// Contracts for HydraulicErosion, the CPU droplet model behind the generator's
+// erosion post-pass and the headless TerrainErosion::ApplyCPU. Pure CPU.
+//
+// The parallel pass is pinned three ways: on a field of one tile it is the
+// sequential pass bit for bit; on larger fields it is bit-reproducible run to
+// run, whatever the scheduling; and it carves the same amount of terrain in the
+// same places as the sequential pass, which differs from it only in droplet
+// order. The halo that keeps concurrent tiles apart is checked directly
+// against a lone droplet's footprint.
+
+#include "OloEnginePCH.h"
+#include <gtest/gtest.h>
+
+#include "OloEngine/Terrain/HydraulicErosion.h"
+#include "OloEngine/Terrain/TerrainGenerator.h"
+#include "TestTaskWorkers.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+using namespace OloEngine;
+using OloEngine::Tests::EnsureTaskWorkers;
+
+namespace
+{
+    std::vector<f32> MakeField(u32 resolution, i32 seed = 1337)
+    {
+        TerrainGenerator::HeightParams params;
+        params.Resolution = resolution;
+        params.Seed = seed;
+        params.Octaves = 5;
+        params.Frequency = 3.0f;
+        std::vector<f32> heights;
+        TerrainGenerator::GenerateHeightField(heights, params);
+        return heights;
+    }
+
+    // Σ|after - before|: the terrain a pass moved, eroded and deposited alike.
+    f64 MovedMaterial(const std::vector<f32>& before, const std::vector<f32>& after)
+    {
+        f64 sum = 0.0;
+        for (sizet i = 0; i < before.size(); ++i)
+            sum += std::abs(static_cast<f64>(after[i]) - before[i]);
+        return sum;
+    }
+
+    // Pearson correlation of two passes' height changes.
+    f64 DeltaCorrelation(const std::vector<f32>& before, const std::vector<f32>& a, const std::vector<f32>& b)
+    {
+        const auto n = static_cast<f64>(before.size());
+        f64 meanA = 0.0;
+        f64 meanB = 0.0;
+        for (sizet i = 0; i < before.size(); ++i)
+        {
+            meanA += static_cast<f64>(a[i]) - before[i];
+            meanB += static_cast<f64>(b[i]) - before[i];
+        }
+        meanA /= n;
+        meanB /= n;
+        f64 cov = 0.0;
+        f64 varA = 0.0;
+        f64 varB = 0.0;
+        for (sizet i = 0; i < before.size(); ++i)
+        {
+            const f64 da = static_cast<f64>(a[i]) - before[i] - meanA;
+            const f64 db = static_cast<f64>(b[i]) - before[i] - meanB;
+            cov += da * db;
+            varA += da * da;
+            varB += db * db;
+        }
+        return cov / std::sqrt(varA * varB);
+    }
+} // namespace
+
+TEST(HydraulicErosion, ParallelIsSequentialOnASingleTile)
+{
+    EnsureTaskWorkers();
+    constexpr u32 kRes = HydraulicErosion::kTileSize;
+    const std::vector<f32> field = MakeField(kRes);
+
+    ErosionParams params;
+    params.DropletCount = 3 * kRes * kRes;
+    std::vector<f32> sequential = field;
+    std::vector<f32> parallel = field;
+    HydraulicErosion::ErodeSequential(sequential, kRes, params, 99);
+    HydraulicErosion::ErodeParallel(parallel, kRes, params, 99);
+
+    EXPECT_NE(sequential, field);
+    EXPECT_EQ(parallel, sequential);
+}
+
+TEST(HydraulicErosion, ParallelIsReproducible)
+{
+    EnsureTaskWorkers();
+    // 9x9 tiles, the last row and column ragged, and more droplets than one
+    // batch. Short droplets with a small brush keep that affordable, and
+    // their narrow halo runs every other tile in one phase.
+    constexpr u32 kRes = 520;
+    const std::vector<f32> field = MakeField(kRes);
+
+    ErosionParams params;
+    params.DropletCount = HydraulicErosion::kBatchDroplets + 12345;
+    params.MaxDropletSteps = 3;
+    params.ErosionRadius = 1;
+    std::vector<f32> first = field;
+    HydraulicErosion::ErodeParallel(first, kRes, params, 7);
+    EXPECT_NE(first, field);
+
+    for (int run = 0; run < 2; ++run)
+    {
+        std::vector<f32> again = field;
+        HydraulicErosion::ErodeParallel(again, kRes, params, 7);
+        ASSERT_EQ(again, first) << "run " << run;
+    }
+
+    std::vector<f32> reseeded = field;
+    HydraulicErosion::ErodeParallel(reseeded, kRes, params, 8);
+    EXPECT_NE(reseeded, first);
+}
+
+TEST(HydraulicErosion, ParallelCarvesLikeSequential)
+{
+    EnsureTaskWorkers();
+    constexpr u32 kRes = 256;
+    const std::vector<f32> field = MakeField(kRes, 4242);
+
+    const ErosionParams params; // one droplet per cell
+    std::vector<f32> sequential = field;
+    std::vector<f32> parallel = field;
+    HydraulicErosion::ErodeSequential(sequential, kRes, params, 31);
+    HydraulicErosion::ErodeParallel(parallel, kRes, params, 31);
+    ASSERT_NE(parallel, sequential) << "a 4x4-tile field should not run in sequential order";
+
+    // Only the order droplets meet each other's channels differs, so both
+    // move about as much terrain, and in the same places.
+    const f64 movedSequential = MovedMaterial(field, sequential);
+    const f64 movedParallel = MovedMaterial(field, parallel);
+    ASSERT_GT(movedSequential, 0.0);
+    EXPECT_NEAR(movedParallel / movedSequential, 1.0, 0.05);
+    EXPECT_GT(DeltaCorrelation(field, sequential, parallel), 0.9);
+}
+
+TEST(HydraulicErosion, OneDropletStaysInsideTheHalo)
+{
+    constexpr u32 kRes = 256;
+    constexpr u32 kSeed = 5;
+    const std::vector<f32> field = MakeField(kRes, 77);
+
+    for (const u32 steps : { 8u, 24u, 64u })
+    {
+        ErosionParams params;
+        params.DropletCount = 1;
+        params.MaxDropletSteps = steps;
+        params.EvaporateSpeed = 0.0f; // run every step
+        std::vector<f32> eroded = field;
+        HydraulicErosion::ErodeSequential(eroded, kRes, params, kSeed);
+
+        // Droplet 0 starts where the shader's thread 0 would.
+        const auto maxIndex = static_cast<f32>(kRes - 1);
+        const u32 rng = HydraulicErosion::PcgHash(0 + kSeed);
+        const auto startX = static_cast<i32>(static_cast<f32>(HydraulicErosion::PcgHash(rng)) * (1.0f / 4294967296.0f) * maxIndex);
+        const auto startY = static_cast<i32>(static_cast<f32>(HydraulicErosion::PcgHash(HydraulicErosion::PcgHash(rng))) * (1.0f / 4294967296.0f) * maxIndex);
+
+        const auto halo = static_cast<i32>(HydraulicErosion::GetHaloWidth(params));
+        i32 reach = 0;
+        for (u32 y = 0; y < kRes; ++y)
+        {
+            for (u32 x = 0; x < kRes; ++x)
+            {
+                if (eroded[y * kRes + x] == field[y * kRes + x])
+                    continue;
+                reach = std::max({ reach, std::abs(static_cast<i32>(x) - startX), std::abs(static_cast<i32>(y) - startY) });
+            }
+        }
+        EXPECT_GT(reach, 0) << steps << " steps";
+        EXPECT_LE(reach, halo) << steps << " steps";
+    }
+}
+
+TEST(HydraulicErosion, MismatchedBuffersAreLeftAlone)
+{
+    const ErosionParams params;
+    std::vector<f32> wrongSize(64 * 64 + 1, 0.5f);
+    const std::vector<f32> before = wrongSize;
+    HydraulicErosion::ErodeSequential(wrongSize, 64, params, 1);
+    HydraulicErosion::ErodeParallel(wrongSize, 64, params, 1);
+    EXPECT_EQ(wrongSize, before);
+
+    std::vector<f32> single(1, 0.5f);
+    HydraulicErosion::ErodeParallel(single, 1, params, 1);
+    EXPECT_EQ(single[0], 0.5f);
+}
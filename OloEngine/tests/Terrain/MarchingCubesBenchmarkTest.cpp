@@ -0,0 +1,142 @@
+// OLO_TEST_LAYER: unit
+#include "OloEnginePCH.h"
+#include "../TestTaskWorkers.h"
+#include <gtest/gtest.h>
+
+// =============================================================================
+// MarchingCubesBenchmarkTest
+//
+// Chunk meshes per second through MarchingCubes::Polygonize on a dug-out
+// terrain volume (a rolling surface with spherical caves, 4x2x4 chunks):
+// serially on the calling thread and across the worker pool the way
+// RebuildDirtyMeshes dispatches it. Reports triangles and welded vertices per
+// triangle; throughput floors only under --olo-bench-assert.
+// =============================================================================
+
+#include "OloEngine/Task/NamedThreads.h"
+#include "OloEngine/Task/ParallelFor.h"
+#include "OloEngine/Task/Scheduler.h"
+#include "OloEngine/Terrain/Voxel/MarchingCubes.h"
+#include "OloEngine/Terrain/Voxel/VoxelOverride.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+using namespace OloEngine; // NOLINT(google-build-using-namespace) — test file
+using OloEngine::Tests::BenchAssertEnabled;
+using OloEngine::Tests::SecondsSince;
+using OloEngine::Tests::EnsureTaskWorkers;
+
+namespace
+{
+    using Clock = std::chrono::high_resolution_clock;
+
+    constexpr u32 CS = VoxelChunk::CHUNK_SIZE;
+    constexpr u32 kPasses = 4;
+
+    struct BenchChunk
+    {
+        VoxelCoord Coord;
+        VoxelChunk Chunk;
+    };
+
+    // Ground at y ~ 40 voxels, rolling by +-6, with a cave every 24 voxels
+    // along x and z. Half the chunks straddle the surface; the rest are
+    // solid or empty apart from caves, which is what a dig actually dirties.
+    std::vector<BenchChunk> MakeDugTerrain()
+    {
+        std::vector<BenchChunk> chunks;
+        for (i32 cz = 0; cz < 4; ++cz)
+        {
+            for (i32 cy = 0; cy < 2; ++cy)
+            {
+                for (i32 cx = 0; cx < 4; ++cx)
+                {
+                    BenchChunk& bench = chunks.emplace_back();
+                    bench.Coord = { cx, cy, cz };
+                    for (u32 z = 0; z < CS; ++z)
+                    {
+                        for (u32 y = 0; y < CS; ++y)
+                        {
+                            for (u32 x = 0; x < CS; ++x)
+                            {
+                                const f32 wx = static_cast<f32>(cx * static_cast<i32>(CS) + static_cast<i32>(x)) + 0.5f;
+                                const f32 wy = static_cast<f32>(cy * static_cast<i32>(CS) + static_cast<i32>(y)) + 0.5f;
+                                const f32 wz = static_cast<f32>(cz * static_cast<i32>(CS) + static_cast<i32>(z)) + 0.5f;
+                                const f32 ground = wy - (40.0f + 6.0f * std::sin(wx * 0.11f) * std::cos(wz * 0.07f));
+                                const glm::vec3 cave(std::round(wx / 24.0f) * 24.0f, 30.0f, std::round(wz / 24.0f) * 24.0f);
+                                const f32 carve = 7.5f - glm::length(glm::vec3(wx, wy, wz) - cave);
+                                bench.Chunk.At(x, y, z) = std::max(ground, carve);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        return chunks;
+    }
+} // namespace
+
+TEST(MarchingCubesBenchmark, ChunkMeshesPerSecond)
+{
+    EnsureTaskWorkers();
+    const std::vector<BenchChunk> chunks = MakeDugTerrain();
+    const auto chunkCount = static_cast<i32>(chunks.size());
+    std::vector<VoxelMeshData> meshes(chunks.size());
+
+    const auto meshAll = [&](bool parallel)
+    {
+        const auto polygonize = [&](i32 i)
+        {
+            MarchingCubes::Polygonize(chunks[i].Chunk, chunks[i].Coord, 1.0f, meshes[i]);
+        };
+        const Clock::time_point start = Clock::now();
+        for (u32 pass = 0; pass < kPasses; ++pass)
+        {
+            if (parallel)
+            {
+                ParallelFor("MarchingCubesBenchmark", chunkCount, 1, polygonize);
+            }
+            else
+            {
+                for (i32 i = 0; i < chunkCount; ++i)
+                    polygonize(i);
+            }
+        }
+        return static_cast<f64>(chunkCount) * kPasses / SecondsSince(start);
+    };
+
+    meshAll(false); // warm: sizes every output buffer
+    const f64 serialMeshesPerSecond = meshAll(false);
+    const f64 parallelMeshesPerSecond = meshAll(true);
+
+    sizet triangles = 0;
+    sizet vertices = 0;
+    u32 nonEmpty = 0;
+    for (const VoxelMeshData& mesh : meshes)
+    {
+        triangles += mesh.Indices.size() / 3;
+        vertices += mesh.Vertices.size();
+        nonEmpty += mesh.IsEmpty() ? 0u : 1u;
+    }
+    ASSERT_GT(triangles, 0u);
+    EXPECT_GT(nonEmpty, 0u);
+    // An unwelded mesher spends three vertices per triangle; a welded surface
+    // with chunk borders comes in a little over one per two.
+    const f64 verticesPerTriangle = static_cast<f64>(vertices) / static_cast<f64>(triangles);
+    EXPECT_LT(verticesPerTriangle, 1.0);
+
+    OLO_CORE_INFO("[MarchingCubesBenchmark] {} chunks ({} with surface), {} triangles, {:.2f} vertices/triangle",
+                  chunkCount, nonEmpty, triangles, verticesPerTriangle);
+    OLO_CORE_INFO("[MarchingCubesBenchmark] serial {:.0f} meshes/s, parallel on {} workers {:.0f} meshes/s ({:.2f}x)",
+                  serialMeshesPerSecond, LowLevelTasks::FScheduler::Get().GetNumWorkers(), parallelMeshesPerSecond,
+                  parallelMeshesPerSecond / serialMeshesPerSecond);
+
+    if (BenchAssertEnabled())
+    {
+        EXPECT_GT(serialMeshesPerSecond, 1000.0) << "single-thread marching-cubes throughput";
+        EXPECT_GT(parallelMeshesPerSecond, serialMeshesPerSecond) << "the worker pool must beat one thread";
+    }
+}
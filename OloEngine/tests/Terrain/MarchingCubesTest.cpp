@@ -0,0 +1,225 @@
+// OLO_TEST_LAYER: unit
+//
+// Contract tests for MarchingCubes::Polygonize, the CPU half of the smooth
+// voxel mesher. Pure CPU — no GL context, no task system.
+//
+// The load-bearing checks are the welding ones: a sphere inside one chunk is a
+// closed genus-0 surface, so every mesh edge must be shared by exactly two
+// triangles in opposite directions and V - E + F must equal 2; and on an
+// arbitrary field there must be exactly one vertex per grid edge whose ends
+// disagree in sign. The second is counted here per voxel with plain scalar
+// compares, independently of the row-mask classification under test.
+
+#include "OloEnginePCH.h"
+#include <gtest/gtest.h>
+
+#include "OloEngine/Terrain/Voxel/MarchingCubes.h"
+#include "OloEngine/Terrain/Voxel/VoxelOverride.h"
+
+#include <cmath>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace OloEngine;
+
+namespace
+{
+    constexpr u32 CS = VoxelChunk::CHUNK_SIZE;
+
+    // Voxel (x, y, z) sits at its centre, (x + 0.5) * voxelSize — the same
+    // placement Polygonize uses — so SDFs below are written in that space.
+    glm::vec3 VoxelCentre(u32 x, u32 y, u32 z)
+    {
+        return glm::vec3(static_cast<f32>(x), static_cast<f32>(y), static_cast<f32>(z)) + 0.5f;
+    }
+
+    // A signed distance sphere. The centre is off the voxel lattice so no
+    // sample lands exactly on the surface.
+    VoxelChunk MakeSphereChunk(const glm::vec3& centre, f32 radius)
+    {
+        VoxelChunk chunk;
+        for (u32 z = 0; z < CS; ++z)
+        {
+            for (u32 y = 0; y < CS; ++y)
+            {
+                for (u32 x = 0; x < CS; ++x)
+                {
+                    chunk.At(x, y, z) = glm::length(VoxelCentre(x, y, z) - centre) - radius;
+                }
+            }
+        }
+        return chunk;
+    }
+
+    // Grid edges between two voxels of opposite sign, counted one at a time.
+    u32 CountSignChangingEdges(const VoxelChunk& chunk)
+    {
+        u32 count = 0;
+        for (u32 z = 0; z < CS; ++z)
+        {
+            for (u32 y = 0; y < CS; ++y)
+            {
+                for (u32 x = 0; x < CS; ++x)
+                {
+                    const bool inside = chunk.At(x, y, z) < 0.0f;
+                    if (x + 1 < CS && inside != (chunk.At(x + 1, y, z) < 0.0f))
+                        ++count;
+                    if (y + 1 < CS && inside != (chunk.At(x, y + 1, z) < 0.0f))
+                        ++count;
+                    if (z + 1 < CS && inside != (chunk.At(x, y, z + 1) < 0.0f))
+                        ++count;
+                }
+            }
+        }
+        return count;
+    }
+
+    VoxelMeshData Polygonize(const VoxelChunk& chunk, const VoxelCoord& coord = { 0, 0, 0 }, f32 voxelSize = 1.0f)
+    {
+        VoxelMeshData data;
+        MarchingCubes::Polygonize(chunk, coord, voxelSize, data);
+        return data;
+    }
+} // namespace
+
+TEST(MarchingCubes, EmptyAndSolidChunksEmitNothing)
+{
+    VoxelChunk empty;
+    VoxelMeshData data;
+    EXPECT_FALSE(MarchingCubes::Polygonize(empty, {}, 1.0f, data));
+    EXPECT_TRUE(data.IsEmpty());
+
+    VoxelChunk solid;
+    std::ranges::fill(solid.SDFData, -1.0f);
+    EXPECT_FALSE(MarchingCubes::Polygonize(solid, {}, 1.0f, data));
+    EXPECT_TRUE(data.IsEmpty());
+    EXPECT_TRUE(data.Vertices.empty());
+}
+
+TEST(MarchingCubes, SphereIsAClosedWeldedSurface)
+{
+    const glm::vec3 centre(16.2f, 15.7f, 16.4f);
+    const VoxelMeshData data = Polygonize(MakeSphereChunk(centre, 9.3f));
+    ASSERT_FALSE(data.IsEmpty());
+    ASSERT_EQ(data.Indices.size() % 3, 0u);
+
+    // Every directed edge appears once and its reverse once: each undirected
+    // edge borders exactly two consistently wound triangles.
+    std::map<std::pair<u32, u32>, u32> directed;
+    for (sizet t = 0; t < data.Indices.size(); t += 3)
+    {
+        for (sizet k = 0; k < 3; ++k)
+        {
+            const u32 a = data.Indices[t + k];
+            const u32 b = data.Indices[t + (k + 1) % 3];
+            ASSERT_LT(a, data.Vertices.size());
+            ++directed[{ a, b }];
+        }
+    }
+    for (const auto& [edge, count] : directed)
+    {
+        ASSERT_EQ(count, 1u) << "edge " << edge.first << "->" << edge.second << " used by several triangles";
+        ASSERT_TRUE(directed.contains({ edge.second, edge.first }))
+            << "edge " << edge.first << "->" << edge.second << " is on a hole: vertices were not welded";
+    }
+
+    const auto faces = static_cast<i64>(data.Indices.size() / 3);
+    const auto edges = static_cast<i64>(directed.size() / 2);
+    const auto vertices = static_cast<i64>(data.Vertices.size());
+    EXPECT_EQ(vertices - edges + faces, 2) << "a sphere's Euler characteristic";
+}
+
+TEST(MarchingCubes, SphereVerticesLieOnTheSurfaceWithOutwardNormals)
+{
+    const glm::vec3 centre(15.6f, 16.3f, 15.9f);
+    const f32 radius = 10.4f;
+    const VoxelMeshData data = Polygonize(MakeSphereChunk(centre, radius));
+    ASSERT_FALSE(data.IsEmpty());
+
+    for (const VoxelVertex& v : data.Vertices)
+    {
+        // Linear interpolation along a voxel edge of a sphere this size is
+        // off by far less than a tenth of a voxel.
+        EXPECT_NEAR(glm::length(v.Position - centre), radius, 0.1f);
+        EXPECT_NEAR(glm::length(v.Normal), 1.0f, 1e-4f);
+        EXPECT_GT(glm::dot(v.Normal, glm::normalize(v.Position - centre)), 0.95f);
+
+        EXPECT_GE(v.Position.x, data.BoundsMin.x);
+        EXPECT_LE(v.Position.x, data.BoundsMax.x);
+        EXPECT_GE(v.Position.y, data.BoundsMin.y);
+        EXPECT_LE(v.Position.y, data.BoundsMax.y);
+        EXPECT_GE(v.Position.z, data.BoundsMin.z);
+        EXPECT_LE(v.Position.z, data.BoundsMax.z);
+    }
+}
+
+TEST(MarchingCubes, OneVertexPerSignChangingEdgeOnNoise)
+{
+    // Random signs everywhere: every row mask pattern, every cube index, and
+    // rows that are mixed in every lane of the SSE classification.
+    std::mt19937 rng(727);
+    std::uniform_real_distribution<f32> dist(-1.0f, 1.0f);
+    for (const f32 bias : { 0.0f, 0.6f, -0.6f })
+    {
+        VoxelChunk chunk;
+        for (f32& v : chunk.SDFData)
+        {
+            v = dist(rng) + bias;
+        }
+
+        const VoxelMeshData data = Polygonize(chunk);
+        EXPECT_EQ(data.Vertices.size(), CountSignChangingEdges(chunk)) << "bias " << bias;
+        EXPECT_GT(data.Indices.size(), data.Vertices.size()) << "welding should index most vertices more than once";
+    }
+}
+
+TEST(MarchingCubes, SingleInsideVoxelMakesOneClosedBlob)
+{
+    // One solid voxel surrounded by empty space: six crossing edges and the
+    // eight corner cases around it close into an octahedron.
+    VoxelChunk chunk;
+    chunk.At(10, 11, 12) = -0.5f;
+
+    const VoxelMeshData data = Polygonize(chunk);
+    EXPECT_EQ(data.Vertices.size(), 6u);
+    EXPECT_EQ(data.Indices.size(), 8u * 3u);
+}
+
+TEST(MarchingCubes, ChunkCoordAndVoxelSizePlaceTheMesh)
+{
+    const VoxelChunk chunk = MakeSphereChunk(glm::vec3(16.1f, 16.2f, 15.8f), 6.3f);
+    const VoxelMeshData local = Polygonize(chunk, { 0, 0, 0 }, 1.0f);
+    const VoxelMeshData placed = Polygonize(chunk, { 2, -1, 3 }, 0.5f);
+
+    ASSERT_EQ(local.Vertices.size(), placed.Vertices.size());
+    ASSERT_EQ(local.Indices, placed.Indices);
+
+    const glm::vec3 origin = glm::vec3(2.0f, -1.0f, 3.0f) * (static_cast<f32>(CS) * 0.5f);
+    for (sizet i = 0; i < local.Vertices.size(); ++i)
+    {
+        const glm::vec3 expected = origin + local.Vertices[i].Position * 0.5f;
+        EXPECT_NEAR(placed.Vertices[i].Position.x, expected.x, 1e-4f);
+        EXPECT_NEAR(placed.Vertices[i].Position.y, expected.y, 1e-4f);
+        EXPECT_NEAR(placed.Vertices[i].Position.z, expected.z, 1e-4f);
+    }
+}
+
+TEST(MarchingCubes, RepeatedPolygonizeIsIdentical)
+{
+    const VoxelChunk chunk = MakeSphereChunk(glm::vec3(12.3f, 20.1f, 14.6f), 8.8f);
+    const VoxelMeshData first = Polygonize(chunk);
+
+    // Reusing the output buffer must not leak the previous contents.
+    VoxelMeshData reused = Polygonize(MakeSphereChunk(glm::vec3(16.5f), 4.2f));
+    ASSERT_TRUE(MarchingCubes::Polygonize(chunk, {}, 1.0f, reused));
+
+    ASSERT_EQ(first.Indices, reused.Indices);
+    ASSERT_EQ(first.Vertices.size(), reused.Vertices.size());
+    for (sizet i = 0; i < first.Vertices.size(); ++i)
+    {
+        EXPECT_EQ(first.Vertices[i].Position, reused.Vertices[i].Position);
+        EXPECT_EQ(first.Vertices[i].Normal, reused.Vertices[i].Normal);
+    }
+}
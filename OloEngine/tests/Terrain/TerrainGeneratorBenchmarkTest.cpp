@@ -0,0 +1,113 @@
+// OLO_TEST_LAYER: unit
+#include "OloEnginePCH.h"
+#include "../TestTaskWorkers.h"
+#include <gtest/gtest.h>
+
+// =============================================================================
+// TerrainGeneratorBenchmarkTest
+//
+// Texels per second through TerrainGenerator::GenerateHeightField at world-map
+// sizes (4k and 8k) with typical mountain params: the tiled path on the worker
+// pool with the batched SSE noise, and the per-texel scalar reference timed
+// once at 4k for the speedup and the largest difference between the two.
+// Every result is checked finite and normalized; throughput floors only under
+// --olo-bench-assert.
+// =============================================================================
+
+#include "TerrainGeneratorTestHelpers.h"
+
+#include "OloEngine/Task/NamedThreads.h"
+#include "OloEngine/Task/Scheduler.h"
+#include "OloEngine/Terrain/TerrainGenerator.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+using namespace OloEngine; // NOLINT(google-build-using-namespace) — test file
+using OloEngine::Tests::BenchAssertEnabled;
+using OloEngine::Tests::SecondsSince;
+using OloEngine::Tests::EnsureTaskWorkers;
+
+namespace
+{
+    using Clock = std::chrono::high_resolution_clock;
+
+    // The world-map preset: six octaves, half ridged, warped and reshaped.
+    TerrainGenerator::HeightParams MakeWorldParams(u32 resolution)
+    {
+        TerrainGenerator::HeightParams params;
+        params.Resolution = resolution;
+        params.Seed = 2024;
+        params.Octaves = 6;
+        params.Shaping.RidgeBlend = 0.5f;
+        params.Shaping.WarpStrength = 0.15f;
+        params.Shaping.HeightExponent = 1.3f;
+        return params;
+    }
+
+    bool AllNormalized(const std::vector<f32>& heights)
+    {
+        return std::ranges::all_of(heights, [](f32 h)
+                                   { return std::isfinite(h) && h >= 0.0f && h <= 1.0f; });
+    }
+} // namespace
+
+TEST(TerrainGeneratorBenchmark, HeightFieldTexelsPerSecond)
+{
+    EnsureTaskWorkers();
+
+    f64 tiledAt4k = 0.0;
+    std::vector<f32> tiled4k;
+    for (const u32 resolution : { 4096u, 8192u })
+    {
+        const TerrainGenerator::HeightParams params = MakeWorldParams(resolution);
+        std::vector<f32> heights;
+        const Clock::time_point start = Clock::now();
+        TerrainGenerator::GenerateHeightField(heights, params);
+        const f64 seconds = SecondsSince(start);
+
+        ASSERT_EQ(heights.size(), static_cast<sizet>(resolution) * resolution);
+        EXPECT_TRUE(AllNormalized(heights)) << resolution << "^2 field";
+
+        const f64 throughput = static_cast<f64>(heights.size()) / seconds;
+        if (resolution == 4096u)
+        {
+            tiledAt4k = throughput;
+            tiled4k = std::move(heights);
+        }
+        OLO_CORE_INFO("[TerrainGeneratorBenchmark] tiled {}^2 on {} workers: {:.1f} ms, {:.0f} texels/s",
+                      resolution, LowLevelTasks::FScheduler::Get().GetNumWorkers(), seconds * 1000.0, throughput);
+    }
+
+    // The oracle, for the speedup figure and the tolerance check.
+    const Clock::time_point start = Clock::now();
+    const std::vector<f32> scalar = TerrainTest::ScalarReferenceField(MakeWorldParams(4096u));
+    const f64 scalarThroughput = static_cast<f64>(scalar.size()) / SecondsSince(start);
+
+    // A scalar build that fuses multiply-adds can put a texel lying exactly on
+    // a simplex boundary in the neighbouring cell; those are the only texels
+    // allowed past kEps, and only a handful of them.
+    ASSERT_EQ(scalar.size(), tiled4k.size());
+    constexpr f32 kEps = 1e-4f;
+    f32 maxDiff = 0.0f;
+    sizet outliers = 0;
+    for (sizet i = 0; i < scalar.size(); ++i)
+    {
+        const f32 diff = std::abs(scalar[i] - tiled4k[i]);
+        maxDiff = std::max(maxDiff, diff);
+        outliers += diff > kEps ? 1u : 0u;
+    }
+    OLO_CORE_INFO("[TerrainGeneratorBenchmark] scalar 4096^2: {:.0f} texels/s ({:.2f}x tiled speedup, "
+                  "max |diff| {:.2e}, {} texels past {:.0e})",
+                  scalarThroughput, tiledAt4k / scalarThroughput, maxDiff, outliers, kEps);
+    EXPECT_LE(outliers, scalar.size() / 100'000u) << "tiled field drifted from the scalar reference";
+    EXPECT_LE(maxDiff, 0.05f);
+
+    if (BenchAssertEnabled())
+    {
+        EXPECT_GT(tiledAt4k, 2.0e6) << "tiled height-field throughput at 4k";
+        EXPECT_GT(tiledAt4k, 1.5 * scalarThroughput) << "the tiled path must beat the scalar reference";
+    }
+}
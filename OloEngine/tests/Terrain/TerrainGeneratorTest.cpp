@@ -1,9 +1,13 @@
 #include "OloEnginePCH.h"
 #include <gtest/gtest.h>
 
+#include "TerrainGeneratorTestHelpers.h"
+
+#include "OloEngine/Particle/SimplexNoise.h"
 #include "OloEngine/Terrain/Foliage/FoliageLayer.h"
 #include "OloEngine/Terrain/TerrainGenerator.h"
 #include "OloEngine/Terrain/TerrainLayer.h"
+#include "TestTaskWorkers.h"
 
 #include <stb_image/stb_image_write.h>
 
@@ -11,6 +15,8 @@
 #include <array>
 #include <cmath>
 #include <cstdint>
+#include <limits>
+#include <random>
 #include <string>
 #include <vector>
 
@@ -22,6 +28,8 @@
 //   * Height-field generation — determinism, [0,1] range / finiteness, seed
 //     sensitivity, and that each shaping knob (ridge, warp, terrace, exponent)
 //     keeps the field valid.
+//   * Tiled / batched generation — the parallel SSE path against a per-texel
+//     scalar transcription of the generator, and region regeneration.
 //   * Terrace remap — endpoints, monotonicity, identity at steps==0, plateaus.
 //   * Auto-material rule evaluation — band membership, slope selection, weight
 //     normalization, the "no rule matched → layer 0" fallback, and the byte
@@ -33,6 +41,7 @@
 // =============================================================================
 
 using namespace OloEngine;
+using OloEngine::Tests::EnsureTaskWorkers;
 
 namespace
 {
@@ -222,6 +231,137 @@ TEST(TerrainGeneratorTest, ApplyErosionStandaloneIsDeterministicAndGuarded)
     EXPECT_EQ(wrongSize, before);
 }
 
+// ── Tiled / batched generation ──────────────────────────────────────────────
+
+TEST(TerrainGeneratorTest, BatchedSimplexNoiseMatchesScalar)
+{
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<f32> coord(-300.0f, 300.0f);
+    constexpr sizet kCount = 4099; // not a multiple of the lane width: the tail is padded
+    std::vector<f32> x(kCount);
+    std::vector<f32> y(kCount);
+    std::vector<f32> z(kCount);
+    for (sizet i = 0; i < kCount; ++i)
+    {
+        x[i] = coord(rng);
+        y[i] = (i % 3 == 0) ? 0.0f : coord(rng); // the terrain's y = 0 plane, and general 3D
+        z[i] = coord(rng);
+    }
+
+    std::vector<f32> batched(kCount);
+    SimplexNoise3D(x.data(), y.data(), z.data(), batched.data(), kCount);
+    for (sizet i = 0; i < kCount; ++i)
+    {
+        // Same arithmetic as the scalar call; only a compiler-fused
+        // multiply-add in the scalar build can move the last bits.
+        ASSERT_NEAR(batched[i], SimplexNoise3D(x[i], y[i], z[i]), kEps) << "point " << i;
+    }
+}
+
+TEST(TerrainGeneratorTest, HeightFieldMatchesScalarReference)
+{
+    EnsureTaskWorkers();
+
+    // 97 is odd and not a multiple of the lane width or the row-tile height,
+    // so ragged lane blocks and a short last tile are both covered.
+    auto plain = MakeParams(1337, 97);
+    auto shaped = MakeParams(20240611, 97);
+    shaped.Shaping.RidgeBlend = 0.6f;
+    shaped.Shaping.WarpStrength = 0.2f;
+    shaped.Shaping.WarpFrequency = 3.0f;
+    shaped.Shaping.HeightExponent = 1.8f;
+
+    for (const auto& params : { plain, shaped })
+    {
+        std::vector<f32> heights;
+        TerrainGenerator::GenerateHeightField(heights, params);
+        const std::vector<f32> reference = TerrainTest::ScalarReferenceField(params);
+        ASSERT_EQ(heights.size(), reference.size());
+        for (sizet i = 0; i < heights.size(); ++i)
+            ASSERT_NEAR(heights[i], reference[i], kEps) << "texel " << i << " (seed " << params.Seed << ")";
+    }
+}
+
+TEST(TerrainGeneratorTest, RegionRegenerateReproducesTheFullField)
+{
+    EnsureTaskWorkers();
+    auto params = MakeParams(4242, 100);
+    params.Shaping.WarpStrength = 0.15f;
+    params.Shaping.TerraceSteps = 5;
+
+    std::vector<f32> full;
+    TerrainGenerator::HeightFieldRange range;
+    TerrainGenerator::GenerateHeightField(full, params, &range);
+    EXPECT_LT(range.RawMin, range.RawMax);
+
+    // Wipe an interior block and one running off the far corner (clamped),
+    // then regenerate both: the field must come back bit-identical.
+    std::vector<f32> patched = full;
+    const auto wipe = [&patched](u32 x0, u32 z0, u32 w, u32 h)
+    {
+        for (u32 z = z0; z < std::min(z0 + h, 100u); ++z)
+            for (u32 x = x0; x < std::min(x0 + w, 100u); ++x)
+                patched[static_cast<sizet>(z) * 100 + x] = -1.0f;
+    };
+    wipe(13, 7, 50, 60);
+    wipe(90, 85, 50, 50);
+    ASSERT_TRUE(TerrainGenerator::RegenerateHeightFieldRegion(patched, params, range, 13, 7, 50, 60));
+    ASSERT_TRUE(TerrainGenerator::RegenerateHeightFieldRegion(patched, params, range, 90, 85, 50, 50));
+    EXPECT_EQ(patched, full);
+}
+
+TEST(TerrainGeneratorTest, RegionRegenerateWithNewParamsOnlyTouchesTheRegion)
+{
+    auto params = MakeParams(77, 64);
+    std::vector<f32> original;
+    TerrainGenerator::HeightFieldRange range;
+    TerrainGenerator::GenerateHeightField(original, params, &range);
+
+    // An editor tweak: more octaves and a redistribution exponent.
+    auto tweaked = params;
+    tweaked.Octaves = 7;
+    tweaked.Shaping.HeightExponent = 2.0f;
+    std::vector<f32> edited = original;
+    constexpr u32 kX = 20;
+    constexpr u32 kZ = 10;
+    constexpr u32 kW = 24;
+    constexpr u32 kH = 30;
+    ASSERT_TRUE(TerrainGenerator::RegenerateHeightFieldRegion(edited, tweaked, range, kX, kZ, kW, kH));
+    ExpectNormalizedField(edited, 64);
+
+    u32 changedInside = 0;
+    for (u32 z = 0; z < 64; ++z)
+    {
+        for (u32 x = 0; x < 64; ++x)
+        {
+            const sizet idx = static_cast<sizet>(z) * 64 + x;
+            const bool inside = x >= kX && x < kX + kW && z >= kZ && z < kZ + kH;
+            if (inside)
+                changedInside += (edited[idx] != original[idx]) ? 1u : 0u;
+            else
+                ASSERT_EQ(edited[idx], original[idx]) << "texel outside the region changed at " << x << "," << z;
+        }
+    }
+    EXPECT_GT(changedInside, kW * kH / 2) << "the tweak barely changed the regenerated region";
+}
+
+TEST(TerrainGeneratorTest, RegionRegenerateRejectsMismatchedBuffer)
+{
+    const auto params = MakeParams(1, 32);
+    std::vector<f32> wrongSize(32 * 32 + 1, 0.5f);
+    const std::vector<f32> before = wrongSize;
+    EXPECT_FALSE(TerrainGenerator::RegenerateHeightFieldRegion(wrongSize, params, { 0.0f, 1.0f }, 0, 0, 8, 8));
+    EXPECT_EQ(wrongSize, before);
+
+    // A region entirely outside the field is an empty (successful) update.
+    std::vector<f32> field;
+    TerrainGenerator::HeightFieldRange range;
+    TerrainGenerator::GenerateHeightField(field, params, &range);
+    const std::vector<f32> unchanged = field;
+    EXPECT_TRUE(TerrainGenerator::RegenerateHeightFieldRegion(field, params, range, 40, 40, 8, 8));
+    EXPECT_EQ(field, unchanged);
+}
+
 // ── Terrace remap ─────────────────────────────────────────────────────────
 
 TEST(TerrainGeneratorTest, TerraceEndpointsAndIdentity)
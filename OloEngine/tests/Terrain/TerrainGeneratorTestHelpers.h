@@ -0,0 +1,79 @@
+#pragma once
+
+// =============================================================================
+// TerrainGeneratorTestHelpers.h — shared by the TerrainGenerator unit test and
+// benchmark: the scalar oracle the tiled, batched generator is checked against.
+// =============================================================================
+
+#include "OloEngine/Particle/SimplexNoise.h"
+#include "OloEngine/Terrain/TerrainGenerator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace OloEngine::TerrainTest
+{
+    // The generator as a per-texel loop over the scalar SimplexNoise3D — the
+    // oracle for the tiled, batched implementation. Erosion is left out (it
+    // runs on the finished field either way).
+    inline std::vector<f32> ScalarReferenceField(const TerrainGenerator::HeightParams& params)
+    {
+        const u32 res = params.Resolution;
+        const TerrainHeightShaping& sh = params.Shaping;
+        const auto seedOffsetFor = [seed = params.Seed](u32 salt) -> f32
+        {
+            u32 h = static_cast<u32>(seed) * 374761393u + salt * 668265263u;
+            h = (h ^ (h >> 13)) * 1274126177u;
+            h ^= h >> 16;
+            return static_cast<f32>(h % 256000u) * (1.0f / 1000.0f);
+        };
+        const f32 seedOffset = seedOffsetFor(0u);
+        const f32 warpOffsetX = seedOffsetFor(1u);
+        const f32 warpOffsetZ = seedOffsetFor(2u);
+
+        std::vector<f32> raw(static_cast<sizet>(res) * res);
+        for (u32 z = 0; z < res; ++z)
+        {
+            for (u32 x = 0; x < res; ++x)
+            {
+                f32 nx = static_cast<f32>(x) / static_cast<f32>(res);
+                f32 nz = static_cast<f32>(z) / static_cast<f32>(res);
+                if (sh.WarpStrength > 1e-6f)
+                {
+                    const f32 wx = SimplexNoise3D(nx * sh.WarpFrequency + warpOffsetX, 0.0f, nz * sh.WarpFrequency + warpOffsetX);
+                    const f32 wz = SimplexNoise3D(nx * sh.WarpFrequency + warpOffsetZ, 0.0f, nz * sh.WarpFrequency + warpOffsetZ);
+                    nx += wx * sh.WarpStrength;
+                    nz += wz * sh.WarpStrength;
+                }
+                f32 fbm = 0.0f;
+                f32 ridged = 0.0f;
+                f32 freq = params.Frequency;
+                f32 amp = 1.0f;
+                for (u32 o = 0; o < params.Octaves; ++o)
+                {
+                    const f32 n = SimplexNoise3D(nx * freq + seedOffset, 0.0f, nz * freq + seedOffset);
+                    fbm += n * amp;
+                    const f32 r = 1.0f - std::fabs(n);
+                    ridged += r * r * amp;
+                    freq *= params.Lacunarity;
+                    amp *= params.Persistence;
+                }
+                const f32 blend = std::clamp(sh.RidgeBlend, 0.0f, 1.0f);
+                raw[static_cast<sizet>(z) * res + x] = fbm * (1.0f - blend) + ridged * blend;
+            }
+        }
+
+        const auto [minIt, maxIt] = std::minmax_element(raw.begin(), raw.end());
+        const f32 minH = *minIt;
+        const f32 range = *maxIt - minH;
+        for (f32& h : raw)
+        {
+            h = range > 1e-6f ? std::clamp((h - minH) / range, 0.0f, 1.0f) : 0.0f;
+            if (sh.HeightExponent > 1e-4f)
+                h = std::pow(h, sh.HeightExponent);
+            h = TerrainGenerator::Terrace(h, sh.TerraceSteps, sh.TerraceSharpness);
+        }
+        return raw;
+    }
+} // namespace OloEngine::TerrainTest
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "OloEngine/Core/Base.h"
+#include "OloEngine/Task/NamedThreads.h"
+#include "OloEngine/Task/Scheduler.h"
+#include "TestOptions.h"
+
+#include <chrono>
+
+// -----------------------------------------------------------------------------
+// Shared scaffolding for the tests that drive the task system and for the
+// micro-benchmarks.
+//
+// The test binary never starts the scheduler's workers, and with none started
+// ParallelFor silently runs inline and launched tasks never run at all. A test
+// that wants the parallel path really exercised calls EnsureTaskWorkers()
+// first; the workers start once per process and stay up for every later case.
+// -----------------------------------------------------------------------------
+
+namespace OloEngine::Tests
+{
+    using BenchClock = std::chrono::high_resolution_clock;
+
+    // Whether the benchmarks should assert their budgets (--olo-bench-assert)
+    // rather than only report.
+    [[nodiscard]] inline bool BenchAssertEnabled()
+    {
+        return Options().BenchAssert;
+    }
+
+    [[nodiscard]] inline f64 SecondsSince(BenchClock::time_point start)
+    {
+        return std::chrono::duration<f64>(BenchClock::now() - start).count();
+    }
+
+    inline void EnsureTaskWorkers()
+    {
+        static const bool s_Started = []
+        {
+            LowLevelTasks::InitGameThreadId();
+            Tasks::FNamedThreadManager::Get().AttachToThread(Tasks::ENamedThread::GameThread);
+            LowLevelTasks::FScheduler::Get().StartWorkers();
+            return true;
+        }();
+        (void)s_Started;
+    }
+} // namespace OloEngine::Tests
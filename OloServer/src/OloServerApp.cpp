@@ -5,15 +5,18 @@
 #include "OloEngine/Server/ServerConsole.h"
 #include "OloEngine/Server/ServerConfig.h"
 #include "OloEngine/Server/ServerConfigSerializer.h"
+#include "OloEngine/Server/ServerLoadTest.h"
 #include "OloEngine/Server/ServerMonitor.h"
 #include "OloEngine/Scene/Scene.h"
 #include "OloEngine/Scene/SceneSerializer.h"
 #include "OloEngine/Networking/Core/NetworkManager.h"
+#include "OloEngine/Networking/Prediction/NetworkMovementInput.h"
 #include "OloEngine/Core/Timer.h"
 #include "OloEngine/Project/Project.h"
 
 #include <charconv>
 #include <filesystem>
+#include <fstream>
 #include <system_error>
 
 static_assert(OLO_HEADLESS, "OloServer must be compiled with OLO_HEADLESS=1");
@@ -86,10 +89,23 @@ namespace OloEngine
             NetworkManager::SetSnapshotRate(m_Config.SnapshotRate);
 
             OLO_CORE_INFO("[Server] Listening on port {} (snapshot rate {} Hz)", m_Config.Port, m_Config.SnapshotRate);
+
+            if (m_Config.LoadTestBots > 0)
+            {
+                StartLoadTest();
+            }
         }
 
         void OnDetach() override
         {
+            // Bots first: their sockets and the status callback they own must go
+            // before the server they are connected to.
+            if (m_LoadTest)
+            {
+                m_LoadTest->Stop();
+                m_LoadTest.reset();
+            }
+
             if (NetworkManager::IsServer())
             {
                 NetworkManager::StopServer();
@@ -140,6 +156,18 @@ namespace OloEngine
 
             // Record measured tick execution time for monitoring
             m_Monitor.RecordTick(tickDuration);
+
+            // The bots tick outside the measured window: they share this thread,
+            // but their cost is the load, not part of the server tick.
+            if (m_LoadTest)
+            {
+                m_LoadTest->RecordServerTick(tickDuration);
+                m_LoadTest->Tick(ts);
+                if (m_LoadTest->IsFinished())
+                {
+                    FinishLoadTest();
+                }
+            }
         }
 
       private:
@@ -252,6 +280,64 @@ namespace OloEngine
             return false;
         }
 
+        // `--bots N`: connect N scripted in-process clients to our own port over
+        // localhost, run for the configured duration, report, and exit.
+        void StartLoadTest()
+        {
+            if (!m_ActiveScene)
+            {
+                // No --scene: replicate an empty world, so every bot still gets a
+                // pawn and every snapshot still carries every player.
+                m_ActiveScene = Scene::Create();
+                m_ActiveScene->OnRuntimeStart();
+                NetworkManager::SetActiveScene(m_ActiveScene.get());
+            }
+
+            // Bot input is NetworkMovementInput; without an apply callback the
+            // server would accept and discard it and no pawn would ever move.
+            NetworkManager::SetInputApplyCallback(MakeMovementApplyCallback());
+
+            if (auto* server = NetworkManager::GetServer(); server && m_Config.LoadTestBots > m_Config.MaxPlayers)
+            {
+                OLO_CORE_WARN("[Server] --bots {} exceeds max players {}; raising the connection limit for the load test",
+                              m_Config.LoadTestBots, m_Config.MaxPlayers);
+                server->SetMaxConnections(m_Config.LoadTestBots);
+            }
+
+            LoadTestConfig config;
+            config.BotCount = m_Config.LoadTestBots;
+            config.InputRateHz = m_Config.LoadTestInputRate;
+            config.DurationSeconds = m_Config.LoadTestDuration;
+            config.SnapshotRate = m_Config.SnapshotRate;
+
+            m_LoadTest = CreateScope<LoadTestHarness>(config);
+            m_LoadTest->Start("127.0.0.1", m_Config.Port);
+        }
+
+        void FinishLoadTest()
+        {
+            const LoadTestReport report = m_LoadTest->BuildReport();
+            report.Log();
+
+            if (!m_Config.LoadTestReportPath.empty())
+            {
+                std::ofstream out(m_Config.LoadTestReportPath);
+                out << report.ToString();
+                if (!out.good())
+                {
+                    OLO_CORE_ERROR("[Server] Failed to write load test report to '{}'", m_Config.LoadTestReportPath);
+                }
+                else
+                {
+                    OLO_CORE_INFO("[Server] Load test report written to '{}'", m_Config.LoadTestReportPath);
+                }
+            }
+
+            m_LoadTest->Stop();
+            m_LoadTest.reset();
+            Application::Get().Close();
+        }
+
         void RegisterConsoleCommands()
         {
             m_Console.RegisterCommand("players", [this](const std::vector<std::string>&)
@@ -403,6 +489,7 @@ namespace OloEngine
         ServerConsole m_Console;
         ServerMonitor m_Monitor{ 30.0f };
         Ref<Scene> m_ActiveScene;
+        Scope<LoadTestHarness> m_LoadTest;
     };
 
     class OloServerApplication : public Application